@@ -48,3 +48,12 @@ if("${NE10_TARGET_ARCH}" STREQUAL "armv7")
         endif()
     endif()
 endif()
+
+# The physics functions have intrinsic versions under aarch64.
+if("${NE10_TARGET_ARCH}" STREQUAL "aarch64")
+    if(NE10_ENABLE_PHYSICS)
+        add_definitions(-DENABLE_NE10_PHYSICS_COMPUTE_AABB_VEC2F_NEON)
+        add_definitions(-DENABLE_NE10_PHYSICS_RELATIVE_V_VEC2F_NEON)
+        add_definitions(-DENABLE_NE10_PHYSICS_APPLY_IMPULSE_VEC2F_NEON)
+    endif()
+endif()
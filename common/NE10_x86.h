@@ -0,0 +1,527 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : common/NE10_x86.h
+ */
+
+/*
+ * Vector abstraction shared by the x86 implementations.
+ *
+ * The bodies in the *.x86.c.h files are written once against the names below
+ * and compiled twice: the *.sse.c translation units include them as they are
+ * (built with -msse4.1) and the *.avx2.c ones define NE10_X86_AVX2 first (built
+ * with -mavx2). NE10_X86_NAME appends the matching suffix to each function.
+ *
+ * Complex data is kept interleaved ([r0 i0 r1 i1 ...]), so a vector holds
+ * NE10_X86_LANES / 2 complex values. None of the helpers contracts a multiply
+ * and an add, so the results round exactly like the C versions.
+ */
+
+#ifndef NE10_X86_H
+#define NE10_X86_H
+
+#include <immintrin.h>
+
+#include "NE10_types.h"
+
+#if defined(NE10_X86_AVX2)
+
+typedef __m256 ne10_x86_f32_t;
+#define NE10_X86_LANES 8
+#define NE10_X86_NAME(name) name##_avx2
+
+static inline ne10_x86_f32_t ne10_x86_load (const ne10_float32_t *p)
+{
+    return _mm256_loadu_ps (p);
+}
+
+static inline void ne10_x86_store (ne10_float32_t *p, ne10_x86_f32_t a)
+{
+    _mm256_storeu_ps (p, a);
+}
+
+static inline ne10_x86_f32_t ne10_x86_dup (ne10_float32_t a)
+{
+    return _mm256_set1_ps (a);
+}
+
+static inline ne10_x86_f32_t ne10_x86_add (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_add_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_sub (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_sub_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_mul (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_mul_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_div (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_div_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_sqrt (ne10_x86_f32_t a)
+{
+    return _mm256_sqrt_ps (a);
+}
+
+// (a < b) ? a : b, and (a > b) ? a : b
+static inline ne10_x86_f32_t ne10_x86_min (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_min_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_max (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_max_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_xor (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_xor_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_andnot (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_andnot_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_and (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_and_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_or (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_or_ps (a, b);
+}
+
+/* all ones in the lanes where a < b (a <= b, a == b), none for NaNs */
+static inline ne10_x86_f32_t ne10_x86_cmplt (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_cmp_ps (a, b, _CMP_LT_OQ);
+}
+
+static inline ne10_x86_f32_t ne10_x86_cmple (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_cmp_ps (a, b, _CMP_LE_OQ);
+}
+
+static inline ne10_x86_f32_t ne10_x86_cmpeq (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_cmp_ps (a, b, _CMP_EQ_OQ);
+}
+
+// m ? a : b, for a mask m from the comparisons
+static inline ne10_x86_f32_t ne10_x86_select (ne10_x86_f32_t m, ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm256_blendv_ps (b, a, m);
+}
+
+// non-zero if every lane of the mask m is set
+static inline ne10_int32_t ne10_x86_all (ne10_x86_f32_t m)
+{
+    return _mm256_movemask_ps (m) == 0xff;
+}
+
+// non-zero if any lane of the mask m is set
+static inline ne10_int32_t ne10_x86_any (ne10_x86_f32_t m)
+{
+    return _mm256_movemask_ps (m) != 0;
+}
+
+/* estimate of 1 / sqrt (a), with a relative error of at most 1.5 * 2^-12 */
+static inline ne10_x86_f32_t ne10_x86_rsqrt_estimate (ne10_x86_f32_t a)
+{
+    return _mm256_rsqrt_ps (a);
+}
+
+/* 2^n for integral n in [-126, 127] */
+static inline ne10_x86_f32_t ne10_x86_pow2 (ne10_x86_f32_t n)
+{
+    __m256i e = _mm256_add_epi32 (_mm256_cvtps_epi32 (n), _mm256_set1_epi32 (127));
+    return _mm256_castsi256_ps (_mm256_slli_epi32 (e, 23));
+}
+
+/* m in [0.5, 1) and e such that a = m * 2^e, for positive normal a */
+static inline ne10_x86_f32_t ne10_x86_frexp (ne10_x86_f32_t a, ne10_x86_f32_t *e)
+{
+    __m256i b = _mm256_castps_si256 (a);
+    *e = _mm256_cvtepi32_ps (_mm256_sub_epi32 (_mm256_srli_epi32 (b, 23), _mm256_set1_epi32 (126)));
+    b = _mm256_and_si256 (b, _mm256_set1_epi32 (0x007fffff));
+    return _mm256_castsi256_ps (_mm256_or_si256 (b, _mm256_set1_epi32 (0x3f000000)));
+}
+
+/* all ones in the lanes where bit b of the integral n is set */
+static inline ne10_x86_f32_t ne10_x86_bit_mask (ne10_x86_f32_t n, ne10_int32_t b)
+{
+    __m256i k = _mm256_set1_epi32 (1 << b);
+    __m256i v = _mm256_and_si256 (_mm256_cvtps_epi32 (n), k);
+    return _mm256_castsi256_ps (_mm256_cmpeq_epi32 (v, k));
+}
+
+/* all ones in the lanes with the sign bit set */
+static inline ne10_x86_f32_t ne10_x86_sign_mask (ne10_x86_f32_t a)
+{
+    return _mm256_castsi256_ps (_mm256_srai_epi32 (_mm256_castps_si256 (a), 31));
+}
+
+/* [r0 r0 r1 r1 ...] and [i0 i0 i1 i1 ...] */
+static inline ne10_x86_f32_t ne10_x86_dup_real (ne10_x86_f32_t a)
+{
+    return _mm256_moveldup_ps (a);
+}
+
+static inline ne10_x86_f32_t ne10_x86_dup_imag (ne10_x86_f32_t a)
+{
+    return _mm256_movehdup_ps (a);
+}
+
+/* [i0 r0 i1 r1 ...] */
+static inline ne10_x86_f32_t ne10_x86_swap_pairs (ne10_x86_f32_t a)
+{
+    return _mm256_permute_ps (a, 0xB1);
+}
+
+/* sign masks for the real (even) and the imaginary (odd) lanes */
+static inline ne10_x86_f32_t ne10_x86_neg_real_mask (void)
+{
+    return _mm256_set_ps (0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+}
+
+static inline ne10_x86_f32_t ne10_x86_neg_imag_mask (void)
+{
+    return _mm256_set_ps (-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+}
+
+/*
+ * Stores four vectors of complex values so that dst[j * stride + k] is the
+ * j-th complex value of vector k (stride counts complex values).
+ */
+static inline void ne10_x86_store_cpx_x4 (ne10_float32_t *dst,
+        ne10_int32_t stride,
+        ne10_x86_f32_t a0,
+        ne10_x86_f32_t a1,
+        ne10_x86_f32_t a2,
+        ne10_x86_f32_t a3)
+{
+    __m256d t0 = _mm256_unpacklo_pd (_mm256_castps_pd (a0), _mm256_castps_pd (a1));
+    __m256d t1 = _mm256_unpackhi_pd (_mm256_castps_pd (a0), _mm256_castps_pd (a1));
+    __m256d t2 = _mm256_unpacklo_pd (_mm256_castps_pd (a2), _mm256_castps_pd (a3));
+    __m256d t3 = _mm256_unpackhi_pd (_mm256_castps_pd (a2), _mm256_castps_pd (a3));
+
+    _mm256_storeu_pd ( (double*) dst, _mm256_permute2f128_pd (t0, t2, 0x20));
+    _mm256_storeu_pd ( (double*) (dst + 2 * stride), _mm256_permute2f128_pd (t1, t3, 0x20));
+    _mm256_storeu_pd ( (double*) (dst + 4 * stride), _mm256_permute2f128_pd (t0, t2, 0x31));
+    _mm256_storeu_pd ( (double*) (dst + 6 * stride), _mm256_permute2f128_pd (t1, t3, 0x31));
+}
+
+/*
+ * Loads NE10_X86_LANES complex values with the real parts in re and the
+ * imaginary parts in im, and stores them back interleaved.
+ */
+static inline void ne10_x86_load_cpx (const ne10_float32_t *p, ne10_x86_f32_t *re, ne10_x86_f32_t *im)
+{
+    __m256 a = _mm256_loadu_ps (p);
+    __m256 b = _mm256_loadu_ps (p + 8);
+
+    /* [r0 r1 r4 r5 r2 r3 r6 r7], with the middle pairs then swapped */
+    *re = _mm256_castpd_ps (_mm256_permute4x64_pd (_mm256_castps_pd (_mm256_shuffle_ps (a, b, 0x88)), 0xD8));
+    *im = _mm256_castpd_ps (_mm256_permute4x64_pd (_mm256_castps_pd (_mm256_shuffle_ps (a, b, 0xDD)), 0xD8));
+}
+
+static inline void ne10_x86_store_cpx (ne10_float32_t *p, ne10_x86_f32_t re, ne10_x86_f32_t im)
+{
+    __m256 r = _mm256_castpd_ps (_mm256_permute4x64_pd (_mm256_castps_pd (re), 0xD8));
+    __m256 i = _mm256_castpd_ps (_mm256_permute4x64_pd (_mm256_castps_pd (im), 0xD8));
+
+    _mm256_storeu_ps (p, _mm256_unpacklo_ps (r, i));
+    _mm256_storeu_ps (p + 8, _mm256_unpackhi_ps (r, i));
+}
+
+#else // NE10_X86_AVX2
+
+typedef __m128 ne10_x86_f32_t;
+#define NE10_X86_LANES 4
+#define NE10_X86_NAME(name) name##_sse
+
+static inline ne10_x86_f32_t ne10_x86_load (const ne10_float32_t *p)
+{
+    return _mm_loadu_ps (p);
+}
+
+static inline void ne10_x86_store (ne10_float32_t *p, ne10_x86_f32_t a)
+{
+    _mm_storeu_ps (p, a);
+}
+
+static inline ne10_x86_f32_t ne10_x86_dup (ne10_float32_t a)
+{
+    return _mm_set1_ps (a);
+}
+
+static inline ne10_x86_f32_t ne10_x86_add (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_add_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_sub (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_sub_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_mul (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_mul_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_div (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_div_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_sqrt (ne10_x86_f32_t a)
+{
+    return _mm_sqrt_ps (a);
+}
+
+// (a < b) ? a : b, and (a > b) ? a : b
+static inline ne10_x86_f32_t ne10_x86_min (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_min_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_max (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_max_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_xor (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_xor_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_andnot (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_andnot_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_and (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_and_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_or (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_or_ps (a, b);
+}
+
+/* all ones in the lanes where a < b (a <= b, a == b), none for NaNs */
+static inline ne10_x86_f32_t ne10_x86_cmplt (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_cmplt_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_cmple (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_cmple_ps (a, b);
+}
+
+static inline ne10_x86_f32_t ne10_x86_cmpeq (ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_cmpeq_ps (a, b);
+}
+
+// m ? a : b, for a mask m from the comparisons
+static inline ne10_x86_f32_t ne10_x86_select (ne10_x86_f32_t m, ne10_x86_f32_t a, ne10_x86_f32_t b)
+{
+    return _mm_blendv_ps (b, a, m);
+}
+
+// non-zero if every lane of the mask m is set
+static inline ne10_int32_t ne10_x86_all (ne10_x86_f32_t m)
+{
+    return _mm_movemask_ps (m) == 0xf;
+}
+
+// non-zero if any lane of the mask m is set
+static inline ne10_int32_t ne10_x86_any (ne10_x86_f32_t m)
+{
+    return _mm_movemask_ps (m) != 0;
+}
+
+/* estimate of 1 / sqrt (a), with a relative error of at most 1.5 * 2^-12 */
+static inline ne10_x86_f32_t ne10_x86_rsqrt_estimate (ne10_x86_f32_t a)
+{
+    return _mm_rsqrt_ps (a);
+}
+
+/* 2^n for integral n in [-126, 127] */
+static inline ne10_x86_f32_t ne10_x86_pow2 (ne10_x86_f32_t n)
+{
+    __m128i e = _mm_add_epi32 (_mm_cvtps_epi32 (n), _mm_set1_epi32 (127));
+    return _mm_castsi128_ps (_mm_slli_epi32 (e, 23));
+}
+
+/* m in [0.5, 1) and e such that a = m * 2^e, for positive normal a */
+static inline ne10_x86_f32_t ne10_x86_frexp (ne10_x86_f32_t a, ne10_x86_f32_t *e)
+{
+    __m128i b = _mm_castps_si128 (a);
+    *e = _mm_cvtepi32_ps (_mm_sub_epi32 (_mm_srli_epi32 (b, 23), _mm_set1_epi32 (126)));
+    b = _mm_and_si128 (b, _mm_set1_epi32 (0x007fffff));
+    return _mm_castsi128_ps (_mm_or_si128 (b, _mm_set1_epi32 (0x3f000000)));
+}
+
+/* all ones in the lanes where bit b of the integral n is set */
+static inline ne10_x86_f32_t ne10_x86_bit_mask (ne10_x86_f32_t n, ne10_int32_t b)
+{
+    __m128i k = _mm_set1_epi32 (1 << b);
+    __m128i v = _mm_and_si128 (_mm_cvtps_epi32 (n), k);
+    return _mm_castsi128_ps (_mm_cmpeq_epi32 (v, k));
+}
+
+/* all ones in the lanes with the sign bit set */
+static inline ne10_x86_f32_t ne10_x86_sign_mask (ne10_x86_f32_t a)
+{
+    return _mm_castsi128_ps (_mm_srai_epi32 (_mm_castps_si128 (a), 31));
+}
+
+/* [r0 r0 r1 r1] and [i0 i0 i1 i1] */
+static inline ne10_x86_f32_t ne10_x86_dup_real (ne10_x86_f32_t a)
+{
+    return _mm_moveldup_ps (a);
+}
+
+static inline ne10_x86_f32_t ne10_x86_dup_imag (ne10_x86_f32_t a)
+{
+    return _mm_movehdup_ps (a);
+}
+
+/* [i0 r0 i1 r1] */
+static inline ne10_x86_f32_t ne10_x86_swap_pairs (ne10_x86_f32_t a)
+{
+    return _mm_shuffle_ps (a, a, 0xB1);
+}
+
+/* sign masks for the real (even) and the imaginary (odd) lanes */
+static inline ne10_x86_f32_t ne10_x86_neg_real_mask (void)
+{
+    return _mm_set_ps (0.0f, -0.0f, 0.0f, -0.0f);
+}
+
+static inline ne10_x86_f32_t ne10_x86_neg_imag_mask (void)
+{
+    return _mm_set_ps (-0.0f, 0.0f, -0.0f, 0.0f);
+}
+
+/*
+ * Stores four vectors of complex values so that dst[j * stride + k] is the
+ * j-th complex value of vector k (stride counts complex values).
+ */
+static inline void ne10_x86_store_cpx_x4 (ne10_float32_t *dst,
+        ne10_int32_t stride,
+        ne10_x86_f32_t a0,
+        ne10_x86_f32_t a1,
+        ne10_x86_f32_t a2,
+        ne10_x86_f32_t a3)
+{
+    __m128d d0 = _mm_castps_pd (a0);
+    __m128d d1 = _mm_castps_pd (a1);
+    __m128d d2 = _mm_castps_pd (a2);
+    __m128d d3 = _mm_castps_pd (a3);
+
+    _mm_storeu_pd ( (double*) dst, _mm_unpacklo_pd (d0, d1));
+    _mm_storeu_pd ( (double*) (dst + 4), _mm_unpacklo_pd (d2, d3));
+    _mm_storeu_pd ( (double*) (dst + 2 * stride), _mm_unpackhi_pd (d0, d1));
+    _mm_storeu_pd ( (double*) (dst + 2 * stride + 4), _mm_unpackhi_pd (d2, d3));
+}
+
+/*
+ * Loads NE10_X86_LANES complex values with the real parts in re and the
+ * imaginary parts in im, and stores them back interleaved.
+ */
+static inline void ne10_x86_load_cpx (const ne10_float32_t *p, ne10_x86_f32_t *re, ne10_x86_f32_t *im)
+{
+    __m128 a = _mm_loadu_ps (p);
+    __m128 b = _mm_loadu_ps (p + 4);
+
+    *re = _mm_shuffle_ps (a, b, 0x88);
+    *im = _mm_shuffle_ps (a, b, 0xDD);
+}
+
+static inline void ne10_x86_store_cpx (ne10_float32_t *p, ne10_x86_f32_t re, ne10_x86_f32_t im)
+{
+    _mm_storeu_ps (p, _mm_unpacklo_ps (re, im));
+    _mm_storeu_ps (p + 4, _mm_unpackhi_ps (re, im));
+}
+
+#endif // NE10_X86_AVX2
+
+#define NE10_X86_CPX_LANES (NE10_X86_LANES / 2)
+
+static inline ne10_x86_f32_t ne10_x86_abs (ne10_x86_f32_t a)
+{
+    return ne10_x86_andnot (ne10_x86_dup (-0.0f), a);
+}
+
+/* (-i) * a and i * a */
+static inline ne10_x86_f32_t ne10_x86_mul_neg_i (ne10_x86_f32_t a)
+{
+    return ne10_x86_xor (ne10_x86_swap_pairs (a), ne10_x86_neg_imag_mask ());
+}
+
+static inline ne10_x86_f32_t ne10_x86_mul_pos_i (ne10_x86_f32_t a)
+{
+    return ne10_x86_xor (ne10_x86_swap_pairs (a), ne10_x86_neg_real_mask ());
+}
+
+/*
+ * a * w and a * conj (w), evaluated as
+ *     r = a.r * w.r -/+ a.i * w.i
+ *     i = a.i * w.r +/- a.r * w.i
+ */
+static inline ne10_x86_f32_t ne10_x86_cpx_mul (ne10_x86_f32_t a, ne10_x86_f32_t w)
+{
+    ne10_x86_f32_t p1 = ne10_x86_mul (a, ne10_x86_dup_real (w));
+    ne10_x86_f32_t p2 = ne10_x86_mul (ne10_x86_swap_pairs (a), ne10_x86_dup_imag (w));
+    return ne10_x86_add (p1, ne10_x86_xor (p2, ne10_x86_neg_real_mask ()));
+}
+
+static inline ne10_x86_f32_t ne10_x86_cpx_mul_conj (ne10_x86_f32_t a, ne10_x86_f32_t w)
+{
+    ne10_x86_f32_t p1 = ne10_x86_mul (a, ne10_x86_dup_real (w));
+    ne10_x86_f32_t p2 = ne10_x86_mul (ne10_x86_swap_pairs (a), ne10_x86_dup_imag (w));
+    return ne10_x86_add (p1, ne10_x86_xor (p2, ne10_x86_neg_imag_mask ()));
+}
+
+#endif // NE10_X86_H
@@ -576,3 +576,99 @@
      }
 
 #define NE10_DstAccSrc1Src2_OPERATION_FLOAT_NEON NE10_DstAccSrcCst_OPERATION_FLOAT_NEON
+
+/****************************************************
+ *                                                  *
+ *  The complex (ne10_fft_cpx_*_t) groups           *
+ *                                                  *
+ ****************************************************/
+
+// T is FLOAT32, INT32 or INT16. vld2q de-interleaves the complex values, so
+// that val[0] of n_src holds the real parts and val[1] the imaginary ones,
+// and vst2q interleaves n_dst back. The main loop processes LANES complex
+// values at a time; loopCode2 is run once after it, for the count - itr
+// values left over from itr.
+
+#define NE10_CPX_FLOAT32_NEON_T float32x4x2_t
+#define NE10_CPX_FLOAT32_NEON_LANES 4
+#define NE10_CPX_FLOAT32_NEON_LOAD(p) vld2q_f32 ( (ne10_float32_t *) (p))
+#define NE10_CPX_FLOAT32_NEON_STORE(p, v) vst2q_f32 ( (ne10_float32_t *) (p), v)
+#define NE10_CPX_FLOAT32_NEON_STORE_REAL(p, v) vst1q_f32 (p, v)
+#define NE10_CPX_FLOAT32_NEON_DUP(c) vdupq_n_f32 (c)
+#define NE10_CPX_FLOAT32_NEON_REAL_T float32x4_t
+
+#define NE10_CPX_INT32_NEON_T int32x4x2_t
+#define NE10_CPX_INT32_NEON_LANES 4
+#define NE10_CPX_INT32_NEON_LOAD(p) vld2q_s32 ( (ne10_int32_t *) (p))
+#define NE10_CPX_INT32_NEON_STORE(p, v) vst2q_s32 ( (ne10_int32_t *) (p), v)
+#define NE10_CPX_INT32_NEON_STORE_REAL(p, v) vst1q_s32 (p, v)
+#define NE10_CPX_INT32_NEON_DUP(c) vdupq_n_s32 (c)
+#define NE10_CPX_INT32_NEON_REAL_T int32x4_t
+
+#define NE10_CPX_INT16_NEON_T int16x8x2_t
+#define NE10_CPX_INT16_NEON_LANES 8
+#define NE10_CPX_INT16_NEON_LOAD(p) vld2q_s16 ( (ne10_int16_t *) (p))
+#define NE10_CPX_INT16_NEON_STORE(p, v) vst2q_s16 ( (ne10_int16_t *) (p), v)
+#define NE10_CPX_INT16_NEON_STORE_REAL(p, v) vst1q_s16 (p, v)
+#define NE10_CPX_INT16_NEON_DUP(c) vdupq_n_s16 (c)
+#define NE10_CPX_INT16_NEON_REAL_T int16x8_t
+
+#define NE10_CPX_MAINLOOP_NEON(T) \
+   for (itr = 0; itr + NE10_CPX_##T##_NEON_LANES <= count; itr += NE10_CPX_##T##_NEON_LANES)
+
+// dst[], src1[] and src2[] are complex
+#define NE10_DstSrc1Src2_OPERATION_CPX_NEON(T, loopCode1, loopCode2) { \
+   NE10_CPX_##T##_NEON_T n_src, n_src2, n_dst; \
+   ne10_uint32_t itr; \
+   NE10_CPX_MAINLOOP_NEON (T) { \
+     n_src = NE10_CPX_##T##_NEON_LOAD (src1 + itr); \
+     n_src2 = NE10_CPX_##T##_NEON_LOAD (src2 + itr); \
+     loopCode1; /* the actual operation is placed here... */ \
+     NE10_CPX_##T##_NEON_STORE (dst + itr, n_dst); \
+    } \
+   loopCode2; /* the values left over */ \
+   return NE10_OK; \
+  }
+
+// dst[], acc[], src1[] and src2[] are complex
+#define NE10_DstAccSrc1Src2_OPERATION_CPX_NEON(T, loopCode1, loopCode2) { \
+   NE10_CPX_##T##_NEON_T n_acc, n_src, n_src2, n_dst; \
+   ne10_uint32_t itr; \
+   NE10_CPX_MAINLOOP_NEON (T) { \
+     n_acc = NE10_CPX_##T##_NEON_LOAD (acc + itr); \
+     n_src = NE10_CPX_##T##_NEON_LOAD (src1 + itr); \
+     n_src2 = NE10_CPX_##T##_NEON_LOAD (src2 + itr); \
+     loopCode1; /* the actual operation is placed here... */ \
+     NE10_CPX_##T##_NEON_STORE (dst + itr, n_dst); \
+    } \
+   loopCode2; /* the values left over */ \
+   return NE10_OK; \
+  }
+
+// dst[] and src[] are complex, cst is a real scalar
+#define NE10_DstSrcCst_OPERATION_CPX_NEON(T, loopCode1, loopCode2) { \
+   NE10_CPX_##T##_NEON_T n_src, n_dst; \
+   NE10_CPX_##T##_NEON_REAL_T n_cst = NE10_CPX_##T##_NEON_DUP (cst); \
+   ne10_uint32_t itr; \
+   NE10_CPX_MAINLOOP_NEON (T) { \
+     n_src = NE10_CPX_##T##_NEON_LOAD (src + itr); \
+     loopCode1; /* the actual operation is placed here... */ \
+     NE10_CPX_##T##_NEON_STORE (dst + itr, n_dst); \
+    } \
+   loopCode2; /* the values left over */ \
+   return NE10_OK; \
+  }
+
+// src[] is complex and dst[] real
+#define NE10_DstSrc_OPERATION_CPX_REAL_NEON(T, loopCode1, loopCode2) { \
+   NE10_CPX_##T##_NEON_T n_src; \
+   NE10_CPX_##T##_NEON_REAL_T n_dst; \
+   ne10_uint32_t itr; \
+   NE10_CPX_MAINLOOP_NEON (T) { \
+     n_src = NE10_CPX_##T##_NEON_LOAD (src + itr); \
+     loopCode1; /* the actual operation is placed here... */ \
+     NE10_CPX_##T##_NEON_STORE_REAL (dst + itr, n_dst); \
+    } \
+   loopCode2; /* the values left over */ \
+   return NE10_OK; \
+  }
@@ -161,3 +161,30 @@
         NE10_DstAccSrc1Src2_SECONDLOOP_FLOAT_NEON(loopCode2); \
     ); \
 }
+
+/*
+ * The CPX macros work on arrays of complex values (ne10_fft_cpx_float32_t,
+ * ne10_fft_cpx_int32_t or ne10_fft_cpx_int16_t, selected by T = FLOAT32, INT32
+ * or INT16), de-interleaved by the loads. loopCode2 is run once, for the
+ * count - itr values left over from itr.
+ */
+
+#define NE10_DstSrc1Src2_DO_COUNT_TIMES_CPX_NEON(T, loopCode1, loopCode2) { \
+    NE10_CHECKPOINTER_DstSrc1Src2; \
+    NE10_DstSrc1Src2_OPERATION_CPX_NEON(T, loopCode1, loopCode2); \
+}
+
+#define NE10_DstAccSrc1Src2_DO_COUNT_TIMES_CPX_NEON(T, loopCode1, loopCode2) { \
+    NE10_CHECKPOINTER_DstAccSrc1Src2; \
+    NE10_DstAccSrc1Src2_OPERATION_CPX_NEON(T, loopCode1, loopCode2); \
+}
+
+#define NE10_DstSrcCst_DO_COUNT_TIMES_CPX_NEON(T, loopCode1, loopCode2) { \
+    NE10_CHECKPOINTER_DstSrcCst; \
+    NE10_DstSrcCst_OPERATION_CPX_NEON(T, loopCode1, loopCode2); \
+}
+
+#define NE10_DstSrc_DO_COUNT_TIMES_CPX_REAL_NEON(T, loopCode1, loopCode2) { \
+    NE10_CHECKPOINTER_DstSrc; \
+    NE10_DstSrc_OPERATION_CPX_REAL_NEON(T, loopCode1, loopCode2); \
+}
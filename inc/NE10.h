@@ -74,11 +74,14 @@ extern "C" {
 
 #include "NE10_types.h"
 #include "NE10_macros.h"
+#include "NE10_alloc.h"
 #include "NE10_init.h"
 #include "NE10_math.h"
 #include "NE10_dsp.h"
 #include "NE10_imgproc.h"
 #include "NE10_physics.h"
+#include "NE10_trace.h"
+#include "NE10_threadpool.h"
 
 #ifdef __cplusplus
 }
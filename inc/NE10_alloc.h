@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : inc/NE10_alloc.h
+ */
+
+#include "NE10_types.h"
+
+#ifndef NE10_ALLOC_H
+#define NE10_ALLOC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** The alignment of the memory allocated by the library, a cache line. */
+#define NE10_MEMORY_ALIGNMENT 64
+
+    /**
+     * The hooks used for all the memory allocated by the library: the FFT configurations,
+     * the image resize plans, and the scratch buffers of some functions (ne10_sgemm, the
+     * generic-radix FFTs and the image filters).
+     *
+     * @c alloc returns a block of @c size bytes aligned to @c alignment, a power of two, or
+     * NULL if there is not enough memory. @c free releases a block returned by @c alloc, and
+     * does nothing for NULL. Both receive @c context unchanged. The hooks may be called from
+     * several threads at the same time.
+     */
+    typedef struct
+    {
+        void * (*alloc) (size_t size, ne10_uint32_t alignment, void *context);
+        void (*free) (void *ptr, void *context);
+        void *context;
+    } ne10_allocator_t;
+
+    /**
+     * @brief Replaces the hooks used to allocate memory.
+     *
+     * @param[in]   *allocator            the new hooks, or NULL to go back to the C library allocator
+     * @return      NE10_OK, or NE10_ERR if one of the hooks is NULL
+     *
+     * The memory allocated before the change must be released while the same hooks are in
+     * place, since it is always released through the current ones. The allocator must not be
+     * changed while other threads are using the library.
+     */
+    extern ne10_result_t ne10_set_allocator (const ne10_allocator_t *allocator);
+
+    /**
+     * @brief Returns the hooks in use.
+     */
+    extern void ne10_get_allocator (ne10_allocator_t *allocator);
+
+    /**
+     * @brief Allocates @c size bytes aligned to @ref NE10_MEMORY_ALIGNMENT with the current hooks.
+     *
+     * This is what NE10_MALLOC expands to. The block must be released with @ref ne10_free
+     * (or NE10_FREE).
+     */
+    extern void *ne10_malloc (size_t size);
+    extern void ne10_free (void *ptr);
+
+    /**
+     * An allocator working inside a buffer supplied by the application, so that the library
+     * can run without calling malloc, for example in a real-time thread.
+     *
+     * The blocks are taken from the start of the buffer upwards. Freeing the block at the top
+     * gives its memory back at once, so the scratch buffers that functions allocate and free
+     * during a call do not use up the arena. The memory of a block freed while a later block is
+     * still allocated is only given back by @ref ne10_arena_reset. Allocations and frees may
+     * run on several threads at the same time.
+     *
+     * The fields are read-only for the application; @c peak is the highest @c used so far,
+     * which is how much memory a given workload needs.
+     */
+    typedef struct
+    {
+        ne10_uint8_t *base;
+        ne10_uint32_t size;
+        ne10_uint32_t used;
+        ne10_uint32_t peak;
+    } ne10_arena_t;
+
+    /**
+     * @brief Sets up an arena in a buffer.
+     *
+     * @param[out]  *arena                arena to set up
+     * @param[in]   *buffer               memory for the blocks, owned by the application
+     * @param[in]   size                  size of the buffer in bytes
+     * @return      NE10_OK, or NE10_ERR if the buffer is NULL
+     */
+    extern ne10_result_t ne10_arena_init (ne10_arena_t *arena, void *buffer, ne10_uint32_t size);
+
+    /**
+     * @brief Gives back all the blocks of an arena. None of them may be in use.
+     */
+    extern void ne10_arena_reset (ne10_arena_t *arena);
+
+    /**
+     * @brief Fills in hooks that allocate from an arena, to be passed to @ref ne10_set_allocator.
+     */
+    extern void ne10_arena_allocator (ne10_allocator_t *allocator, ne10_arena_t *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
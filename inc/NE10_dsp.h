@@ -131,7 +131,7 @@ extern "C" {
      * @brief Creates a configuration structure for @ref ne10_fft_c2c_1d_float32.
      *
      * @param[in]   nfft             input length
-     * @retval      st               pointer to an FFT configuration structure (allocated with `malloc`), or `NULL` to indicate an error
+     * @retval      st               pointer to an FFT configuration structure (allocated with `NE10_MALLOC`), or `NULL` to indicate an error
      *
      * Allocates and initialises an @ref ne10_fft_cfg_float32_t configuration structure for
      * the complex-to-complex single precision floating point FFT/IFFT. As part of this, it reserves
@@ -157,7 +157,9 @@ extern "C" {
      * form 2<sup>N</sup>*3<sup>M</sup>*5<sup>K</sup> (N > 0). Points to
      * @ref ne10_fft_c2c_1d_float32_c or @ref ne10_fft_c2c_1d_float32_neon, the
      * latter of which has the additional constraint that `fftSize % 4 == 0` must
-     * hold if fftSize > 2. This is an out-of-place algorithm. For usage
+     * hold if fftSize > 2. On x86 it points to @ref ne10_fft_c2c_1d_float32_avx2
+     * or @ref ne10_fft_c2c_1d_float32_sse when the CPU supports them. This is an
+     * out-of-place algorithm. For usage
      * information, please check test/test_suite_fft_float32.c.
      */
     extern void (*ne10_fft_c2c_1d_float32) (ne10_fft_cpx_float32_t *fout,
@@ -172,6 +174,19 @@ extern "C" {
             ne10_fft_cpx_float32_t *fin,
             ne10_fft_cfg_float32_t cfg,
             ne10_int32_t inverse_fft);
+    /**
+     * Specific implementations of @ref ne10_fft_c2c_1d_float32 using SSE4.1 and
+     * AVX2 (x86 only). Power-of-two sizes of at least 16 points are vectorized;
+     * other sizes use @ref ne10_fft_c2c_1d_float32_c.
+     */
+    extern void ne10_fft_c2c_1d_float32_sse (ne10_fft_cpx_float32_t *fout,
+            ne10_fft_cpx_float32_t *fin,
+            ne10_fft_cfg_float32_t cfg,
+            ne10_int32_t inverse_fft);
+    extern void ne10_fft_c2c_1d_float32_avx2 (ne10_fft_cpx_float32_t *fout,
+            ne10_fft_cpx_float32_t *fin,
+            ne10_fft_cfg_float32_t cfg,
+            ne10_int32_t inverse_fft);
 
     extern void ne10_fft_destroy_c2c_float32 (ne10_fft_cfg_float32_t);
 
@@ -179,7 +194,7 @@ extern "C" {
      * @brief Creates a configuration structure for @ref ne10_fft_c2c_1d_int32.
      *
      * @param[in]   nfft             input length
-     * @retval      st               pointer to an FFT configuration structure (allocated with `malloc`), or `NULL` to indicate an error
+     * @retval      st               pointer to an FFT configuration structure (allocated with `NE10_MALLOC`), or `NULL` to indicate an error
      *
      * Allocates and initialises an @ref ne10_fft_cfg_int32_t configuration structure for
      * the complex-to-complex 32-bit integer fixed point FFT/IFFT. As part of this, it reserves a
@@ -540,7 +555,8 @@ extern "C" {
      * @param[out] *pDst points to the block of output data.
      * @param[in]  blockSize number of samples to process per call.
      *
-     * Points to @ref ne10_fir_float_c or @ref ne10_fir_float_neon.
+     * Points to @ref ne10_fir_float_c or @ref ne10_fir_float_neon (on x86,
+     * @ref ne10_fir_float_avx2 or @ref ne10_fir_float_sse).
      */
     extern void (*ne10_fir_float) (const ne10_fir_instance_f32_t * S,
                                    ne10_float32_t * pSrc,
@@ -560,6 +576,17 @@ extern "C" {
                                      ne10_uint32_t blockSize)
     asm ("ne10_fir_float_neon");
 #endif // ENABLE_NE10_FIR_FLOAT_NEON
+    /**
+     * Specific implementations of @ref ne10_fir_float using SSE4.1 and AVX2 (x86 only).
+     */
+    extern void ne10_fir_float_sse (const ne10_fir_instance_f32_t * S,
+                                    ne10_float32_t * pSrc,
+                                    ne10_float32_t * pDst,
+                                    ne10_uint32_t blockSize);
+    extern void ne10_fir_float_avx2 (const ne10_fir_instance_f32_t * S,
+                                     ne10_float32_t * pSrc,
+                                     ne10_float32_t * pDst,
+                                     ne10_uint32_t blockSize);
     /** @} */ // FIR
 
     /**
@@ -78,6 +78,63 @@ extern "C" {
             ne10_uint32_t src_stride)
     asm ("ne10_img_resize_bilinear_rgba_neon");
 
+    /**
+     * @ingroup IMG_RESIZE
+     * @brief Creates a plan for image resize of 8-bit data.
+     *
+     * @param[in]   src_width             width of source image
+     * @param[in]   src_height            height of source image
+     * @param[in]   dst_width             width of destination image
+     * @param[in]   dst_height            height of destination image
+     * @param[in]   channels              number of interleaved channels (1 to 4)
+     * @param[in]   mode                  interpolation mode
+     * @return      pointer to the plan, or NULL if the parameters are not supported
+     *
+     * The plan owns the interpolation tables and the row buffer, so a stream of frames
+     * with a fixed geometry can be resized by @ref ne10_img_resize_plan_execute without
+     * any per-frame setup or allocation. To free the plan, call @ref ne10_img_resize_plan_destroy.
+     */
+    extern ne10_img_resize_plan_t ne10_img_resize_plan_create (ne10_uint32_t src_width,
+            ne10_uint32_t src_height,
+            ne10_uint32_t dst_width,
+            ne10_uint32_t dst_height,
+            ne10_uint32_t channels,
+            ne10_img_resize_mode_t mode);
+    extern void ne10_img_resize_plan_destroy (ne10_img_resize_plan_t plan);
+
+    /**
+     * @ingroup IMG_RESIZE
+     * @brief Image resize of 8-bit data with a precomputed plan.
+     *
+     * @param[in]   plan                  plan created by @ref ne10_img_resize_plan_create
+     * @param[out]  *dst                  point to the destination image
+     * @param[in]   dst_stride            stride of destination buffer, in bytes
+     * @param[in]   *src                  point to the source image
+     * @param[in]   src_stride            stride of source buffer, in bytes
+     *
+     * The function implements image resize. Each destination row is dst_width * channels bytes,
+     * and dst_stride must be at least that.
+     * A plan must not be shared by calls running at the same time, since its row buffer is
+     * used as scratch memory.
+     * Points to @ref ne10_img_resize_plan_execute_c or @ref ne10_img_resize_plan_execute_neon.
+     */
+    extern void (*ne10_img_resize_plan_execute) (ne10_img_resize_plan_t plan,
+            ne10_uint8_t* dst,
+            ne10_uint32_t dst_stride,
+            ne10_uint8_t* src,
+            ne10_uint32_t src_stride);
+    extern void ne10_img_resize_plan_execute_c (ne10_img_resize_plan_t plan,
+            ne10_uint8_t* dst,
+            ne10_uint32_t dst_stride,
+            ne10_uint8_t* src,
+            ne10_uint32_t src_stride);
+    extern void ne10_img_resize_plan_execute_neon (ne10_img_resize_plan_t plan,
+            ne10_uint8_t* dst,
+            ne10_uint32_t dst_stride,
+            ne10_uint8_t* src,
+            ne10_uint32_t src_stride)
+    asm ("ne10_img_resize_plan_execute_neon");
+
     /**
      * @ingroup IMG_ROTATE
      * @brief Image rotate of 8-bit data.
@@ -91,6 +148,9 @@ extern "C" {
      * @param[in]   angle                 angle of rotate
      *
      * The function extracts pixels from src at sub-pixel accuracy and stores them to dst.
+     * When angle is a multiple of 90 the pixels are copied exactly through
+     * @ref ne10_img_rotate_right_angle_rgba_c or @ref ne10_img_rotate_right_angle_rgba_neon,
+     * and the destination image is exactly src_height x src_width (or src_width x src_height).
      * Points to @ref ne10_img_rotate_rgba_c or @ref ne10_img_rotate_rgba_neon.
      */
     extern void (*ne10_img_rotate_rgba) (ne10_uint8_t* dst,
@@ -107,7 +167,6 @@ extern "C" {
                                         ne10_uint32_t src_width,
                                         ne10_uint32_t src_height,
                                         ne10_int32_t angle);
-#ifdef ENABLE_NE10_IMG_ROTATE_RGBA_NEON
     extern void ne10_img_rotate_rgba_neon (ne10_uint8_t* dst,
                                            ne10_uint32_t* dst_width,
                                            ne10_uint32_t* dst_height,
@@ -116,7 +175,101 @@ extern "C" {
                                            ne10_uint32_t src_height,
                                            ne10_int32_t angle)
     asm ("ne10_img_rotate_rgba_neon");
-#endif // ENABLE_NE10_IMG_ROTATE_RGBA_NEON
+
+    /**
+     * @ingroup IMG_ROTATE
+     * @brief Lossless rotation of RGBA8888 image data by a multiple of 90 degrees.
+     *
+     * @param[in]   *src         pointer to the source image
+     * @param[out]  *dst         pointer to the destination image
+     * @param[in]   src_size     size of the source image
+     * @param[in]   src_stride   source stride, in bytes
+     * @param[in]   dst_stride   destination stride, in bytes
+     * @param[in]   angle        angle of rotate, a multiple of 90
+     *
+     * The image is rotated clockwise, in the same direction as @ref ne10_img_rotate_rgba.
+     * For 90 and 270 degrees the destination image is src_size.y pixels wide and
+     * src_size.x pixels high; otherwise it has the size of the source image.
+     * Points to @ref ne10_img_rotate_right_angle_rgba_c or
+     * @ref ne10_img_rotate_right_angle_rgba_neon. This is an out-of-place algorithm.
+     */
+    extern void (*ne10_img_rotate_right_angle_rgba) (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t dst_stride,
+            ne10_int32_t angle);
+    extern void ne10_img_rotate_right_angle_rgba_c (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t dst_stride,
+            ne10_int32_t angle);
+    extern void ne10_img_rotate_right_angle_rgba_neon (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t dst_stride,
+            ne10_int32_t angle);
+
+    /**
+     * @ingroup IMG_ROTATE
+     * @brief In-place lossless rotation of a square RGBA8888 image by a multiple of 90 degrees.
+     *
+     * @param[in,out] *img       pointer to the image
+     * @param[in]   side         width and height of the image
+     * @param[in]   stride       image stride, in bytes
+     * @param[in]   angle        angle of rotate, a multiple of 90
+     *
+     * Gives the same result as @ref ne10_img_rotate_right_angle_rgba without a second buffer.
+     * Points to @ref ne10_img_rotate_right_angle_inplace_rgba_c or
+     * @ref ne10_img_rotate_right_angle_inplace_rgba_neon.
+     */
+    extern void (*ne10_img_rotate_right_angle_inplace_rgba) (ne10_uint8_t *img,
+            ne10_uint32_t side,
+            ne10_int32_t stride,
+            ne10_int32_t angle);
+    extern void ne10_img_rotate_right_angle_inplace_rgba_c (ne10_uint8_t *img,
+            ne10_uint32_t side,
+            ne10_int32_t stride,
+            ne10_int32_t angle);
+    extern void ne10_img_rotate_right_angle_inplace_rgba_neon (ne10_uint8_t *img,
+            ne10_uint32_t side,
+            ne10_int32_t stride,
+            ne10_int32_t angle);
+
+    /**
+     * @ingroup IMG_ROTATE
+     * @brief Flip of RGBA8888 image data.
+     *
+     * @param[in]   *src         pointer to the source image
+     * @param[out]  *dst         pointer to the destination image
+     * @param[in]   size         size of the source and destination images
+     * @param[in]   src_stride   source stride, in bytes
+     * @param[in]   dst_stride   destination stride, in bytes
+     * @param[in]   flip         axis of the flip
+     *
+     * Points to @ref ne10_img_flip_rgba_c or @ref ne10_img_flip_rgba_neon.
+     * This is an out-of-place algorithm.
+     */
+    extern void (*ne10_img_flip_rgba) (const ne10_uint8_t *src,
+                                       ne10_uint8_t *dst,
+                                       ne10_size_t size,
+                                       ne10_int32_t src_stride,
+                                       ne10_int32_t dst_stride,
+                                       ne10_img_flip_t flip);
+    extern void ne10_img_flip_rgba_c (const ne10_uint8_t *src,
+                                      ne10_uint8_t *dst,
+                                      ne10_size_t size,
+                                      ne10_int32_t src_stride,
+                                      ne10_int32_t dst_stride,
+                                      ne10_img_flip_t flip);
+    extern void ne10_img_flip_rgba_neon (const ne10_uint8_t *src,
+                                         ne10_uint8_t *dst,
+                                         ne10_size_t size,
+                                         ne10_int32_t src_stride,
+                                         ne10_int32_t dst_stride,
+                                         ne10_img_flip_t flip);
 
     /**
      * @ingroup IMG_BOXFILTER
@@ -157,6 +310,316 @@ extern "C" {
             ne10_int32_t dst_stride,
             ne10_size_t kernel_size);
 
+    /**
+     * @ingroup IMG_WARP
+     * @brief Affine warp of RGBA8888 image data.
+     *
+     * @param[in]   *src         pointer to the source image
+     * @param[out]  *dst         pointer to the destination image
+     * @param[in]   src_size     size of the source image
+     * @param[in]   src_stride   source stride, in bytes
+     * @param[in]   dst_size     size of the destination image
+     * @param[in]   dst_stride   destination stride, in bytes
+     * @param[in]   *matrix      2x3 matrix, row-major
+     * @param[in]   border       handling of samples outside of the source image
+     * @param[in]   *border_value RGBA value used with @ref NE10_IMG_BORDER_CONSTANT
+     *
+     * Every destination pixel (x, y) is interpolated from the source image at
+     * <pre>(m[0] * x + m[1] * y + m[2], m[3] * x + m[4] * y + m[5])</pre>
+     * that is, the matrix maps destination coordinates to source coordinates.
+     * Points to @ref ne10_img_warp_affine_rgba_c or @ref ne10_img_warp_affine_rgba_neon.
+     * This is an out-of-place algorithm.
+     */
+    extern void (*ne10_img_warp_affine_rgba) (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_size_t dst_size,
+            ne10_int32_t dst_stride,
+            const ne10_float32_t *matrix,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value);
+    extern void ne10_img_warp_affine_rgba_c (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_size_t dst_size,
+            ne10_int32_t dst_stride,
+            const ne10_float32_t *matrix,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value);
+    extern void ne10_img_warp_affine_rgba_neon (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_size_t dst_size,
+            ne10_int32_t dst_stride,
+            const ne10_float32_t *matrix,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value);
+
+    /**
+     * @ingroup IMG_WARP
+     * @brief Perspective warp of RGBA8888 image data.
+     *
+     * @param[in]   *src         pointer to the source image
+     * @param[out]  *dst         pointer to the destination image
+     * @param[in]   src_size     size of the source image
+     * @param[in]   src_stride   source stride, in bytes
+     * @param[in]   dst_size     size of the destination image
+     * @param[in]   dst_stride   destination stride, in bytes
+     * @param[in]   *matrix      3x3 homography, row-major
+     * @param[in]   border       handling of samples outside of the source image
+     * @param[in]   *border_value RGBA value used with @ref NE10_IMG_BORDER_CONSTANT
+     *
+     * Every destination pixel (x, y) is interpolated from the source image at
+     * <pre>((m[0] * x + m[1] * y + m[2]) / w, (m[3] * x + m[4] * y + m[5]) / w)</pre>
+     * where <pre>w = m[6] * x + m[7] * y + m[8]</pre>
+     * Points to @ref ne10_img_warp_perspective_rgba_c or @ref ne10_img_warp_perspective_rgba_neon.
+     * This is an out-of-place algorithm.
+     */
+    extern void (*ne10_img_warp_perspective_rgba) (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_size_t dst_size,
+            ne10_int32_t dst_stride,
+            const ne10_float32_t *matrix,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value);
+    extern void ne10_img_warp_perspective_rgba_c (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_size_t dst_size,
+            ne10_int32_t dst_stride,
+            const ne10_float32_t *matrix,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value);
+    extern void ne10_img_warp_perspective_rgba_neon (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_size_t dst_size,
+            ne10_int32_t dst_stride,
+            const ne10_float32_t *matrix,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value);
+
+    /**
+     * @ingroup IMG_SEPFILTER
+     * @brief Separable convolution of RGBA8888 image data.
+     *
+     * @param[in]   *src         pointer to the source image
+     * @param[out]  *dst         pointer to the destination image
+     * @param[in]   src_size     size of the source and destination images
+     * @param[in]   src_stride   source stride, in bytes
+     * @param[in]   dst_stride   destination stride, in bytes
+     * @param[in]   *kernel_x    horizontal kernel
+     * @param[in]   ksize_x      number of taps of the horizontal kernel
+     * @param[in]   shift_x      right shift (with rounding) applied after the horizontal pass
+     * @param[in]   *kernel_y    vertical kernel
+     * @param[in]   ksize_y      number of taps of the vertical kernel
+     * @param[in]   shift_y      right shift (with rounding) applied after the vertical pass
+     * @param[in]   delta        value added to every result before saturation
+     * @param[in]   border       handling of pixels outside of the source image
+     * @param[in]   *border_value RGBA value used with @ref NE10_IMG_BORDER_CONSTANT
+     *
+     * Every channel is convolved with kernel_x along the rows and kernel_y along the columns.
+     * The result of the horizontal pass is saturated to 16 bits, and the final result to
+     * 8 bits. For example a Sobel x derivative is kernel_x = {-1, 0, 1}, kernel_y = {1, 2, 1},
+     * shift_x = 0, shift_y = 2 and delta = 128.
+     * Points to @ref ne10_img_sepfilter_rgba8888_c or @ref ne10_img_sepfilter_rgba8888_neon.
+     * This is an out-of-place algorithm.
+     */
+    extern void (*ne10_img_sepfilter_rgba8888) (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t dst_stride,
+            const ne10_int16_t *kernel_x,
+            ne10_uint32_t ksize_x,
+            ne10_int32_t shift_x,
+            const ne10_int16_t *kernel_y,
+            ne10_uint32_t ksize_y,
+            ne10_int32_t shift_y,
+            ne10_int32_t delta,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value);
+    extern void ne10_img_sepfilter_rgba8888_c (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t dst_stride,
+            const ne10_int16_t *kernel_x,
+            ne10_uint32_t ksize_x,
+            ne10_int32_t shift_x,
+            const ne10_int16_t *kernel_y,
+            ne10_uint32_t ksize_y,
+            ne10_int32_t shift_y,
+            ne10_int32_t delta,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value);
+    extern void ne10_img_sepfilter_rgba8888_neon (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t dst_stride,
+            const ne10_int16_t *kernel_x,
+            ne10_uint32_t ksize_x,
+            ne10_int32_t shift_x,
+            const ne10_int16_t *kernel_y,
+            ne10_uint32_t ksize_y,
+            ne10_int32_t shift_y,
+            ne10_int32_t delta,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value);
+
+    /**
+     * @ingroup IMG_SEPFILTER
+     * @brief Size of the buffer needed by @ref ne10_img_gaussian_rgba8888.
+     *
+     * @param[in]   src_size     size of the source image
+     * @param[in]   sigma        standard deviation of the Gaussian, in pixels
+     * @return      size in bytes
+     */
+    extern ne10_uint32_t ne10_img_gaussian_buffer_size (ne10_size_t src_size,
+            ne10_float32_t sigma);
+
+    /**
+     * @ingroup IMG_SEPFILTER
+     * @brief Gaussian blur of RGBA8888 image data.
+     *
+     * @param[in]   *src         pointer to the source image
+     * @param[out]  *dst         pointer to the destination image
+     * @param[in]   src_size     size of the source and destination images
+     * @param[in]   src_stride   source stride, in bytes
+     * @param[in]   dst_stride   destination stride, in bytes
+     * @param[in]   sigma        standard deviation of the Gaussian, in pixels
+     * @param[in]   border       handling of pixels outside of the source image
+     * @param[in]   *border_value RGBA value used with @ref NE10_IMG_BORDER_CONSTANT
+     * @param[in]   *buffer      working buffer of at least @ref ne10_img_gaussian_buffer_size
+     *                           bytes for this size and sigma; it can be reused between calls
+     *
+     * Sigma up to 3 uses a sampled kernel of 2 * ceil (3 * sigma) + 1 taps through
+     * @ref ne10_img_sepfilter_rgba8888; larger sigma uses a recursive filter whose cost
+     * does not depend on sigma. The recursive filter runs in float64, so it stays accurate
+     * for sigma in the hundreds of pixels. No memory is allocated.
+     * Points to @ref ne10_img_gaussian_rgba8888_c or @ref ne10_img_gaussian_rgba8888_neon.
+     * This is an out-of-place algorithm.
+     */
+    extern void (*ne10_img_gaussian_rgba8888) (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t dst_stride,
+            ne10_float32_t sigma,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value,
+            ne10_uint8_t *buffer);
+    extern void ne10_img_gaussian_rgba8888_c (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t dst_stride,
+            ne10_float32_t sigma,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value,
+            ne10_uint8_t *buffer);
+    extern void ne10_img_gaussian_rgba8888_neon (const ne10_uint8_t *src,
+            ne10_uint8_t *dst,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t dst_stride,
+            ne10_float32_t sigma,
+            ne10_img_border_t border,
+            const ne10_uint8_t *border_value,
+            ne10_uint8_t *buffer);
+
+    /**
+     * @ingroup IMG_PYRAMID
+     * @brief Size of the arena needed by @ref ne10_img_pyramid_rgba8888.
+     *
+     * @param[in]   src_size     size of the source image
+     * @param[in]   levels       number of levels, including the source image
+     * @param[in]   laplacian    non-zero if the Laplacian residuals are requested
+     * @return      size in bytes
+     */
+    extern ne10_uint32_t ne10_img_pyramid_buffer_size (ne10_size_t src_size,
+            ne10_int32_t levels,
+            ne10_int32_t laplacian);
+
+    /**
+     * @ingroup IMG_PYRAMID
+     * @brief Gaussian and Laplacian pyramid of RGBA8888 image data.
+     *
+     * @param[in]   *src         pointer to the source image
+     * @param[in]   src_size     size of the source image
+     * @param[in]   src_stride   source stride, in bytes
+     * @param[in]   levels       number of levels, including the source image
+     * @param[in]   laplacian    non-zero to also compute the Laplacian residuals
+     * @param[in]   *arena       buffer of at least @ref ne10_img_pyramid_buffer_size bytes
+     * @param[in]   arena_size   size of the arena, in bytes
+     * @param[out]  *pyramid     array of levels entries describing the result
+     * @return      NE10_OK, or NE10_ERR if the arguments are invalid or the arena is too small
+     *
+     * pyramid[0].image is src; the other images are stored in the arena. When laplacian is
+     * set, pyramid[i].laplacian for i < levels - 1 holds 4 int16 values per pixel, rows of
+     * pyramid[i].size.x * 4 values, such that adding the expansion of level i + 1 gives
+     * level i back exactly, see @ref ne10_img_pyramid_expand_rgba8888. It is NULL for the
+     * last level.
+     * Points to @ref ne10_img_pyramid_rgba8888_c or @ref ne10_img_pyramid_rgba8888_neon.
+     */
+    extern ne10_result_t (*ne10_img_pyramid_rgba8888) (const ne10_uint8_t *src,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t levels,
+            ne10_int32_t laplacian,
+            ne10_uint8_t *arena,
+            ne10_uint32_t arena_size,
+            ne10_img_pyramid_level_t *pyramid);
+    extern ne10_result_t ne10_img_pyramid_rgba8888_c (const ne10_uint8_t *src,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t levels,
+            ne10_int32_t laplacian,
+            ne10_uint8_t *arena,
+            ne10_uint32_t arena_size,
+            ne10_img_pyramid_level_t *pyramid);
+    extern ne10_result_t ne10_img_pyramid_rgba8888_neon (const ne10_uint8_t *src,
+            ne10_size_t src_size,
+            ne10_int32_t src_stride,
+            ne10_int32_t levels,
+            ne10_int32_t laplacian,
+            ne10_uint8_t *arena,
+            ne10_uint32_t arena_size,
+            ne10_img_pyramid_level_t *pyramid);
+
+    /**
+     * @ingroup IMG_PYRAMID
+     * @brief Expansion of an RGBA8888 pyramid level, optionally plus a Laplacian residual.
+     *
+     * @param[in]   *coarse        pointer to the coarse level
+     * @param[in]   coarse_size    size of the coarse level
+     * @param[in]   coarse_stride  coarse level stride, in bytes
+     * @param[in]   *laplacian     residual of the fine level, rows of dst_size.x * 4 values, or NULL
+     * @param[out]  *dst           pointer to the fine level
+     * @param[in]   dst_size       size of the fine level; coarse_size must be its half, rounded up
+     * @param[in]   dst_stride     fine level stride, in bytes
+     * @return      NE10_OK, or NE10_ERR if the arguments are invalid
+     *
+     * Uses the same upsampling as the residuals of @ref ne10_img_pyramid_rgba8888, so
+     * expanding pyramid[i + 1].image with pyramid[i].laplacian writes pyramid[i].image.
+     * Collapsing a Laplacian pyramid applies it from the last level down to level 0.
+     */
+    extern ne10_result_t ne10_img_pyramid_expand_rgba8888 (const ne10_uint8_t *coarse,
+            ne10_size_t coarse_size,
+            ne10_int32_t coarse_stride,
+            const ne10_int16_t *laplacian,
+            ne10_uint8_t *dst,
+            ne10_size_t dst_size,
+            ne10_int32_t dst_stride);
+
 #ifdef __cplusplus
 }
 #endif
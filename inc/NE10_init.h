@@ -34,16 +34,65 @@
 extern "C" {
 #endif
 
+    /*!
+        The CPU features that the function pointers can be selected for. Each field is 1 if the
+        feature is present, 0 otherwise.
+     */
+    typedef struct
+    {
+        ne10_uint32_t neon;     // Advanced SIMD, in the AArch32 or the AArch64 state
+        ne10_uint32_t asimd;    // Advanced SIMD in the AArch64 state
+        ne10_uint32_t sse41;    // SSE4.1 (x86)
+        ne10_uint32_t avx2;     // AVX2, with the OS saving the YMM registers (x86)
+    } ne10_cpu_features_t;
+
+    /*!
+        The Linux hardware capability bit read by ne10_init, as returned by getauxval(AT_HWCAP)
+        for the target architecture.
+     */
+#if defined (__aarch64__)
+#define NE10_HWCAP_ASIMD        (1ULL << 1)
+#else
+#define NE10_HWCAP_NEON         (1ULL << 12)
+#endif
+
+    /*!
+        This routine fills in the ARM features from the hardware capability bits. The x86 fields are
+        set to 0.
+     */
+    extern void ne10_cpu_features_from_hwcap (ne10_cpu_features_t *features,
+            ne10_uint64_t hwcap);
+
+    /*!
+        This routine returns the features that the function pointers were last initialized for.
+        All the fields are 0 before ne10_init is called.
+     */
+    extern const ne10_cpu_features_t *ne10_get_cpu_features (void);
+
     /*!
         This routine returns NE10_OK if the running platform supports NEON, otherwise it returns NE10_ERR
      */
     extern ne10_result_t ne10_HasNEON(void);
 
+    /*!
+        These routines return NE10_OK if the running platform supports SSE4.1 (respectively AVX2), otherwise they return NE10_ERR.
+        They always return NE10_ERR on ARM builds.
+     */
+    extern ne10_result_t ne10_HasSSE41(void);
+    extern ne10_result_t ne10_HasAVX2(void);
+
     /*!
         This routine initializes all the function pointers.
      */
     extern ne10_result_t ne10_init(void);
 
+    /*!
+        This routine initializes all the function pointers for the given features, instead of the
+        detected ones. It allows the dispatch to be tested for CPUs other than the running one; the
+        functions must not be called unless the running CPU has the given features.
+     */
+    extern ne10_result_t ne10_init_features (const ne10_cpu_features_t *features);
+
     /*!
         This routine initializes all the math function pointers defined in "NE10_math.h" with pointers to ARM NEON or ARM VFP implementations.
      */
@@ -36,6 +36,8 @@
 #ifndef NE10_MACROS_H
 #define NE10_MACROS_H
 
+#include "NE10_alloc.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -50,10 +52,11 @@ extern "C" {
 // some external macro definitions to be exposed to the users
 /////////////////////////////////////////////////////////
 
-#define NE10_MALLOC malloc
+// These allocate and free through the hooks set with ne10_set_allocator (see NE10_alloc.h)
+#define NE10_MALLOC ne10_malloc
 #define NE10_FREE(p) \
     do { \
-        free(p); \
+        ne10_free(p); \
         p = NULL; \
     }while(0)
 
@@ -135,6 +135,10 @@ extern "C" {
     extern ne10_result_t ne10_add_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_add_float_neon");
     /** Specific implementation of @ref ne10_add_float using NEON assembly. */
     extern ne10_result_t ne10_add_float_asm (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_add_float_sse (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_add_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
 
     /**
      * Adds the 2D vectors of one input array with those of the same index in another,
@@ -153,6 +157,10 @@ extern "C" {
     extern ne10_result_t ne10_add_vec2f_neon (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count) asm ("ne10_add_vec2f_neon");
     /** Specific implementation of @ref ne10_add_vec2f using NEON assembly. */
     extern ne10_result_t ne10_add_vec2f_asm (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec2f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_add_vec2f_sse (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec2f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_add_vec2f_avx2 (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
 
     /**
      * Adds the 3D vectors of one input array with those of the same index in another,
@@ -171,6 +179,10 @@ extern "C" {
     extern ne10_result_t ne10_add_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count) asm ("ne10_add_vec3f_neon");
     /** Specific implementation of @ref ne10_add_vec3f using NEON assembly. */
     extern ne10_result_t ne10_add_vec3f_asm (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec3f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_add_vec3f_sse (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec3f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_add_vec3f_avx2 (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
 
     /**
      * Adds the 4D vectors of one input array with those of the same index in another,
@@ -189,6 +201,10 @@ extern "C" {
     extern ne10_result_t ne10_add_vec4f_neon (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count) asm ("ne10_add_vec4f_neon");
     /** Specific implementation of @ref ne10_add_vec4f using NEON assembly. */
     extern ne10_result_t ne10_add_vec4f_asm (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec4f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_add_vec4f_sse (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_add_vec4f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_add_vec4f_avx2 (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
     /** @} */
 
     /**
@@ -354,6 +370,10 @@ extern "C" {
     extern ne10_result_t ne10_sub_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_sub_float_neon");
     /** Specific implementation of @ref ne10_sub_float using NEON assembly. */
     extern ne10_result_t ne10_sub_float_asm (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_sub_float_sse (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_sub_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
 
     /**
      * Subtracts the 2D vectors of one input array from those of the same index in another,
@@ -372,6 +392,10 @@ extern "C" {
     extern ne10_result_t ne10_sub_vec2f_neon (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count) asm ("ne10_sub_vec2f_neon");
     /** Specific implementation of @ref ne10_sub_vec2f using NEON assembly. */
     extern ne10_result_t ne10_sub_vec2f_asm (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec2f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_sub_vec2f_sse (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec2f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_sub_vec2f_avx2 (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
 
     /**
      * Subtracts the 3D vectors of one input array from those of the same index in another,
@@ -390,6 +414,10 @@ extern "C" {
     extern ne10_result_t ne10_sub_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count) asm ("ne10_sub_vec3f_neon");
     /** Specific implementation of @ref ne10_sub_vec3f using NEON assembly. */
     extern ne10_result_t ne10_sub_vec3f_asm (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec3f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_sub_vec3f_sse (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec3f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_sub_vec3f_avx2 (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
 
     /**
      * Subtracts the 4D vectors of one input array from those of the same index in another,
@@ -408,6 +436,10 @@ extern "C" {
     extern ne10_result_t ne10_sub_vec4f_neon (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count) asm ("ne10_sub_vec4f_neon");
     /** Specific implementation of @ref ne10_sub_vec4f using NEON assembly. */
     extern ne10_result_t ne10_sub_vec4f_asm (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec4f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_sub_vec4f_sse (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sub_vec4f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_sub_vec4f_avx2 (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
     /** @} */
 
     /**
@@ -654,6 +686,10 @@ extern "C" {
     extern ne10_result_t ne10_mul_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_mul_float_neon");
     /** Specific implementation of @ref ne10_mul_float using NEON assembly. */
     extern ne10_result_t ne10_mul_float_asm (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_mul_float_sse (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_mul_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
 
     /**
      * Element-wise multiplies the 2D vectors of one input array by those of the same index
@@ -672,6 +708,10 @@ extern "C" {
     extern ne10_result_t ne10_vmul_vec2f_neon (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count) asm ("ne10_vmul_vec2f_neon");
     /** Specific implementation of @ref ne10_vmul_vec2f using NEON assembly. */
     extern ne10_result_t ne10_vmul_vec2f_asm (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec2f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vmul_vec2f_sse (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec2f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vmul_vec2f_avx2 (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
 
     /**
      * Element-wise multiplies the 3D vectors of one input array by those of the same index
@@ -690,6 +730,10 @@ extern "C" {
     extern ne10_result_t ne10_vmul_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count) asm ("ne10_vmul_vec3f_neon");
     /** Specific implementation of @ref ne10_vmul_vec3f using NEON assembly. */
     extern ne10_result_t ne10_vmul_vec3f_asm (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec3f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vmul_vec3f_sse (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec3f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vmul_vec3f_avx2 (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
 
     /**
      * Element-wise multiplies the 4D vectors of one input array by those of the same index
@@ -708,6 +752,10 @@ extern "C" {
     extern ne10_result_t ne10_vmul_vec4f_neon (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count) asm ("ne10_vmul_vec4f_neon");
     /** Specific implementation of @ref ne10_vmul_vec4f using NEON assembly. */
     extern ne10_result_t ne10_vmul_vec4f_asm (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec4f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vmul_vec4f_sse (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmul_vec4f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vmul_vec4f_avx2 (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
     /** @} */
 
     /**
@@ -818,6 +866,10 @@ extern "C" {
     extern ne10_result_t ne10_mla_float_neon (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_mla_float_neon");
     /** Specific implementation of @ref ne10_mla_float using NEON assembly. */
     extern ne10_result_t ne10_mla_float_asm (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mla_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_mla_float_sse (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mla_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_mla_float_avx2 (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
 
     /**
      * Element-wise multiplies all the 2D vector elements of an input array by those of the
@@ -838,6 +890,10 @@ extern "C" {
     extern ne10_result_t ne10_vmla_vec2f_neon (ne10_vec2f_t * dst, ne10_vec2f_t * acc, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count) asm ("ne10_vmla_vec2f_neon");
     /** Specific implementation of @ref ne10_vmla_vec2f using NEON assembly. */
     extern ne10_result_t ne10_vmla_vec2f_asm (ne10_vec2f_t * dst, ne10_vec2f_t * acc, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmla_vec2f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vmla_vec2f_sse (ne10_vec2f_t * dst, ne10_vec2f_t * acc, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmla_vec2f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vmla_vec2f_avx2 (ne10_vec2f_t * dst, ne10_vec2f_t * acc, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
 
     /**
      * Element-wise multiplies all the 3D vector elements of an input array by those of the
@@ -858,6 +914,10 @@ extern "C" {
     extern ne10_result_t ne10_vmla_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * acc, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count) asm ("ne10_vmla_vec3f_neon");
     /** Specific implementation of @ref ne10_vmla_vec3f using NEON assembly. */
     extern ne10_result_t ne10_vmla_vec3f_asm (ne10_vec3f_t * dst, ne10_vec3f_t * acc, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmla_vec3f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vmla_vec3f_sse (ne10_vec3f_t * dst, ne10_vec3f_t * acc, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmla_vec3f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vmla_vec3f_avx2 (ne10_vec3f_t * dst, ne10_vec3f_t * acc, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
 
     /**
      * Element-wise multiplies all the 4D vector elements of an input array by those of the
@@ -878,6 +938,10 @@ extern "C" {
     extern ne10_result_t ne10_vmla_vec4f_neon (ne10_vec4f_t * dst, ne10_vec4f_t * acc, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count) asm ("ne10_vmla_vec4f_neon");
     /** Specific implementation of @ref ne10_vmla_vec4f using NEON assembly. */
     extern ne10_result_t ne10_vmla_vec4f_asm (ne10_vec4f_t * dst, ne10_vec4f_t * acc, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmla_vec4f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vmla_vec4f_sse (ne10_vec4f_t * dst, ne10_vec4f_t * acc, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vmla_vec4f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vmla_vec4f_avx2 (ne10_vec4f_t * dst, ne10_vec4f_t * acc, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
     /** @} */
 
     /**
@@ -1109,6 +1173,10 @@ extern "C" {
     extern ne10_result_t ne10_div_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) asm ("ne10_div_float_neon");
     /** Specific implementation of @ref ne10_div_float using NEON assembly. */
     extern ne10_result_t ne10_div_float_asm (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_div_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_div_float_sse (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_div_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_div_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
 
     /**
      * Element-wise divides the 2D vectors of one input array by those of the same index in
@@ -1127,6 +1195,10 @@ extern "C" {
     extern ne10_result_t ne10_vdiv_vec2f_neon (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count) asm ("ne10_vdiv_vec2f_neon");
     /** Specific implementation of @ref ne10_vdiv_vec2f using NEON assembly. */
     extern ne10_result_t ne10_vdiv_vec2f_asm (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vdiv_vec2f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vdiv_vec2f_sse (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vdiv_vec2f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vdiv_vec2f_avx2 (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count);
 
     /**
      * Element-wise divides the 3D vectors of one input array by those of the same index in
@@ -1145,6 +1217,10 @@ extern "C" {
     extern ne10_result_t ne10_vdiv_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count) asm ("ne10_vdiv_vec3f_neon");
     /** Specific implementation of @ref ne10_vdiv_vec3f using NEON assembly. */
     extern ne10_result_t ne10_vdiv_vec3f_asm (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vdiv_vec3f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vdiv_vec3f_sse (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vdiv_vec3f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vdiv_vec3f_avx2 (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count);
 
     /**
      * Element-wise divides the 4D vectors of one input array by those of the same index in
@@ -1163,6 +1239,10 @@ extern "C" {
     extern ne10_result_t ne10_vdiv_vec4f_neon (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count) asm ("ne10_vdiv_vec4f_neon");
     /** Specific implementation of @ref ne10_vdiv_vec4f using NEON assembly. */
     extern ne10_result_t ne10_vdiv_vec4f_asm (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vdiv_vec4f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vdiv_vec4f_sse (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vdiv_vec4f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vdiv_vec4f_avx2 (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count);
     /** @} */
 
     /**
@@ -1455,6 +1535,10 @@ extern "C" {
     extern ne10_result_t ne10_abs_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count) asm ("ne10_abs_float_neon");
     /** Specific implementation of @ref ne10_abs_float using NEON assembly. */
     extern ne10_result_t ne10_abs_float_asm (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_abs_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_abs_float_sse (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_abs_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_abs_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
 
     /**
      * Calculates the element-wise absolute value of 2D vectors within an input array, storing
@@ -1472,6 +1556,10 @@ extern "C" {
     extern ne10_result_t ne10_abs_vec2f_neon (ne10_vec2f_t * dst, ne10_vec2f_t * src, ne10_uint32_t count) asm ("ne10_abs_vec2f_neon");
     /** Specific implementation of @ref ne10_abs_vec2f using NEON assembly. */
     extern ne10_result_t ne10_abs_vec2f_asm (ne10_vec2f_t * dst, ne10_vec2f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_abs_vec2f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_abs_vec2f_sse (ne10_vec2f_t * dst, ne10_vec2f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_abs_vec2f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_abs_vec2f_avx2 (ne10_vec2f_t * dst, ne10_vec2f_t * src, ne10_uint32_t count);
 
     /**
      * Calculates the element-wise absolute value of 3D vectors within an input array, storing
@@ -1489,6 +1577,10 @@ extern "C" {
     extern ne10_result_t ne10_abs_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * src, ne10_uint32_t count) asm ("ne10_abs_vec3f_neon");
     /** Specific implementation of @ref ne10_abs_vec3f using NEON assembly. */
     extern ne10_result_t ne10_abs_vec3f_asm (ne10_vec3f_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_abs_vec3f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_abs_vec3f_sse (ne10_vec3f_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_abs_vec3f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_abs_vec3f_avx2 (ne10_vec3f_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
 
     /**
      * Calculates the element-wise absolute value of 4D vectors within an input array, storing
@@ -1506,6 +1598,10 @@ extern "C" {
     extern ne10_result_t ne10_abs_vec4f_neon (ne10_vec4f_t * dst, ne10_vec4f_t * src, ne10_uint32_t count) asm ("ne10_abs_vec4f_neon");
     /** Specific implementation of @ref ne10_abs_vec4f using NEON assembly. */
     extern ne10_result_t ne10_abs_vec4f_asm (ne10_vec4f_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_abs_vec4f using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_abs_vec4f_sse (ne10_vec4f_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_abs_vec4f using AVX2 (x86 only). */
+    extern ne10_result_t ne10_abs_vec4f_avx2 (ne10_vec4f_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
     /** @} */
 
     /**
@@ -1839,6 +1935,1534 @@ extern "C" {
     extern ne10_result_t ne10_identity_mat2x2f_asm (ne10_mat2x2f_t * dst, ne10_uint32_t count);
     /** @} */
 
+    /**
+     * @ingroup groupMaths
+     * @defgroup CHAIN Fused Element-wise Operation Chains
+     *
+     * \par
+     * These functions apply a list of element-wise operations (see @ref ne10_chain_opcode_t)
+     * to an array of single precision floating point values in a single pass. Calling
+     * @ref ne10_mulc_float, @ref ne10_addc_float, @ref ne10_abs_float and
+     * @ref ne10_mla_float one after the other streams the whole array through memory four
+     * times; a chain of the same four operations reads and writes it once, applying every
+     * operation to a tile of elements held in registers (NEON) or in L1 cache (C).
+     * @{
+     */
+
+    /**
+     * Applies a chain of element-wise operations to every element of an input array,
+     * storing the results in an output array. The operations are applied in order and each
+     * one rounds exactly like the corresponding single-operation function. Points to
+     * @ref ne10_chain_float_c or @ref ne10_chain_float_neon (@ref ne10_chain_float_avx2 or
+     * @ref ne10_chain_float_sse on x86). This operation can be performed
+     * in-place, and the operand arrays of the chain may also be the input or output array.
+     *
+     * @param[out] dst      Pointer to the destination array
+     * @param[in]  src      Pointer to the source array
+     * @param[in]  ops      Pointer to the operations to apply
+     * @param[in]  op_count The number of operations, at most @ref NE10_CHAIN_MAX_OPS
+     * @param[in]  count    The number of elements in the arrays
+     * @return @ref NE10_OK, or @ref NE10_ERR (and nothing written) if the chain is invalid
+     */
+    extern ne10_result_t (*ne10_chain_float) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_chain_op_t * ops, ne10_uint32_t op_count, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_chain_float using plain C code. */
+    extern ne10_result_t ne10_chain_float_c (ne10_float32_t * dst, ne10_float32_t * src, const ne10_chain_op_t * ops, ne10_uint32_t op_count, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_chain_float using NEON intrinsics. */
+    extern ne10_result_t ne10_chain_float_neon (ne10_float32_t * dst, ne10_float32_t * src, const ne10_chain_op_t * ops, ne10_uint32_t op_count, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_chain_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_chain_float_sse (ne10_float32_t * dst, ne10_float32_t * src, const ne10_chain_op_t * ops, ne10_uint32_t op_count, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_chain_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_chain_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src, const ne10_chain_op_t * ops, ne10_uint32_t op_count, ne10_uint32_t count);
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup SOA Structure-of-Arrays Vector Operations
+     *
+     * \par
+     * These functions work on vectors stored as separate x, y, z (and w) arrays
+     * (see @ref ne10_vec3f_soa_t and @ref ne10_vec4f_soa_t) rather than as arrays of
+     * @ref ne10_vec3f_t or @ref ne10_vec4f_t. Every SIMD lane then holds a different
+     * vector, so no lane is wasted on padding and no shuffles are needed inside the loop.
+     * Data that is produced and consumed in array-of-structures form can be converted
+     * with the ne10_vec3f_aos_to_soa family of functions, which are also vectorized.
+     * The results are the same as those of the array-of-structures functions.
+     * @{
+     */
+
+    /**
+     * Converts an array of 3D vectors to structure-of-arrays form.
+     * Points to @ref ne10_vec3f_aos_to_soa_c or @ref ne10_vec3f_aos_to_soa_neon (@ref ne10_vec3f_aos_to_soa_avx2 or
+     * @ref ne10_vec3f_aos_to_soa_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination x, y and z arrays
+     * @param[in]  src   Pointer to the source array of vectors
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vec3f_aos_to_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_aos_to_soa using plain C code. */
+    extern ne10_result_t ne10_vec3f_aos_to_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_aos_to_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_vec3f_aos_to_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_aos_to_soa using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vec3f_aos_to_soa_sse (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_aos_to_soa using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vec3f_aos_to_soa_avx2 (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+
+    /**
+     * Converts 3D vectors in structure-of-arrays form back to an array of vectors.
+     * Points to @ref ne10_vec3f_soa_to_aos_c or @ref ne10_vec3f_soa_to_aos_neon (@ref ne10_vec3f_soa_to_aos_avx2 or
+     * @ref ne10_vec3f_soa_to_aos_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination array of vectors
+     * @param[in]  src   Pointer to the source x, y and z arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vec3f_soa_to_aos) (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_soa_to_aos using plain C code. */
+    extern ne10_result_t ne10_vec3f_soa_to_aos_c (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_soa_to_aos using NEON intrinsics. */
+    extern ne10_result_t ne10_vec3f_soa_to_aos_neon (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_soa_to_aos using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vec3f_soa_to_aos_sse (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec3f_soa_to_aos using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vec3f_soa_to_aos_avx2 (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+
+    /**
+     * Converts an array of 4D vectors to structure-of-arrays form.
+     * Points to @ref ne10_vec4f_aos_to_soa_c or @ref ne10_vec4f_aos_to_soa_neon (@ref ne10_vec4f_aos_to_soa_avx2 or
+     * @ref ne10_vec4f_aos_to_soa_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination x, y, z and w arrays
+     * @param[in]  src   Pointer to the source array of vectors
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vec4f_aos_to_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_aos_to_soa using plain C code. */
+    extern ne10_result_t ne10_vec4f_aos_to_soa_c (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_aos_to_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_vec4f_aos_to_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_aos_to_soa using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vec4f_aos_to_soa_sse (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_aos_to_soa using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vec4f_aos_to_soa_avx2 (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+
+    /**
+     * Converts 4D vectors in structure-of-arrays form back to an array of vectors.
+     * Points to @ref ne10_vec4f_soa_to_aos_c or @ref ne10_vec4f_soa_to_aos_neon (@ref ne10_vec4f_soa_to_aos_avx2 or
+     * @ref ne10_vec4f_soa_to_aos_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination array of vectors
+     * @param[in]  src   Pointer to the source x, y, z and w arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_vec4f_soa_to_aos) (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_soa_to_aos using plain C code. */
+    extern ne10_result_t ne10_vec4f_soa_to_aos_c (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_soa_to_aos using NEON intrinsics. */
+    extern ne10_result_t ne10_vec4f_soa_to_aos_neon (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_soa_to_aos using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_vec4f_soa_to_aos_sse (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_vec4f_soa_to_aos using AVX2 (x86 only). */
+    extern ne10_result_t ne10_vec4f_soa_to_aos_avx2 (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+
+    /**
+     * Returns the lengths of 3D vectors in structure-of-arrays form, like @ref ne10_len_vec3f.
+     * Points to @ref ne10_len_vec3f_soa_c or @ref ne10_len_vec3f_soa_neon (@ref ne10_len_vec3f_soa_avx2 or
+     * @ref ne10_len_vec3f_soa_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source x, y and z arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_len_vec3f_soa) (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_len_vec3f_soa_c (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_len_vec3f_soa_neon (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec3f_soa using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_len_vec3f_soa_sse (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec3f_soa using AVX2 (x86 only). */
+    extern ne10_result_t ne10_len_vec3f_soa_avx2 (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+
+    /**
+     * Returns the lengths of 4D vectors in structure-of-arrays form, like @ref ne10_len_vec4f.
+     * Points to @ref ne10_len_vec4f_soa_c or @ref ne10_len_vec4f_soa_neon (@ref ne10_len_vec4f_soa_avx2 or
+     * @ref ne10_len_vec4f_soa_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source x, y, z and w arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_len_vec4f_soa) (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec4f_soa using plain C code. */
+    extern ne10_result_t ne10_len_vec4f_soa_c (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec4f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_len_vec4f_soa_neon (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec4f_soa using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_len_vec4f_soa_sse (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_len_vec4f_soa using AVX2 (x86 only). */
+    extern ne10_result_t ne10_len_vec4f_soa_avx2 (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+
+    /**
+     * Normalizes 3D vectors in structure-of-arrays form, like @ref ne10_normalize_vec3f. This operation can be performed in-place.
+     * Points to @ref ne10_normalize_vec3f_soa_c or @ref ne10_normalize_vec3f_soa_neon (@ref ne10_normalize_vec3f_soa_avx2 or
+     * @ref ne10_normalize_vec3f_soa_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination x, y and z arrays
+     * @param[in]  src   Pointer to the source x, y and z arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_normalize_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_normalize_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_normalize_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec3f_soa using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_normalize_vec3f_soa_sse (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec3f_soa using AVX2 (x86 only). */
+    extern ne10_result_t ne10_normalize_vec3f_soa_avx2 (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+
+    /**
+     * Normalizes 4D vectors in structure-of-arrays form, like @ref ne10_normalize_vec4f. This operation can be performed in-place.
+     * Points to @ref ne10_normalize_vec4f_soa_c or @ref ne10_normalize_vec4f_soa_neon (@ref ne10_normalize_vec4f_soa_avx2 or
+     * @ref ne10_normalize_vec4f_soa_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination x, y, z and w arrays
+     * @param[in]  src   Pointer to the source x, y, z and w arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_normalize_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec4f_soa using plain C code. */
+    extern ne10_result_t ne10_normalize_vec4f_soa_c (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec4f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_normalize_vec4f_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec4f_soa using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_normalize_vec4f_soa_sse (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_vec4f_soa using AVX2 (x86 only). */
+    extern ne10_result_t ne10_normalize_vec4f_soa_avx2 (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+
+    /**
+     * Dot product of two sets of 3D vectors in structure-of-arrays form, like @ref ne10_dot_vec3f.
+     * Points to @ref ne10_dot_vec3f_soa_c or @ref ne10_dot_vec3f_soa_neon (@ref ne10_dot_vec3f_soa_avx2 or
+     * @ref ne10_dot_vec3f_soa_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source x, y and z arrays
+     * @param[in]  src2  Pointer to the second source x, y and z arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_dot_vec3f_soa) (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_dot_vec3f_soa_c (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_dot_vec3f_soa_neon (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec3f_soa using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_dot_vec3f_soa_sse (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec3f_soa using AVX2 (x86 only). */
+    extern ne10_result_t ne10_dot_vec3f_soa_avx2 (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+
+    /**
+     * Dot product of two sets of 4D vectors in structure-of-arrays form, like @ref ne10_dot_vec4f.
+     * Points to @ref ne10_dot_vec4f_soa_c or @ref ne10_dot_vec4f_soa_neon (@ref ne10_dot_vec4f_soa_avx2 or
+     * @ref ne10_dot_vec4f_soa_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source x, y, z and w arrays
+     * @param[in]  src2  Pointer to the second source x, y, z and w arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_dot_vec4f_soa) (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec4f_soa using plain C code. */
+    extern ne10_result_t ne10_dot_vec4f_soa_c (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec4f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_dot_vec4f_soa_neon (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec4f_soa using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_dot_vec4f_soa_sse (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dot_vec4f_soa using AVX2 (x86 only). */
+    extern ne10_result_t ne10_dot_vec4f_soa_avx2 (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+
+    /**
+     * Cross product of two sets of 3D vectors in structure-of-arrays form, like @ref ne10_cross_vec3f.
+     * Points to @ref ne10_cross_vec3f_soa_c or @ref ne10_cross_vec3f_soa_neon (@ref ne10_cross_vec3f_soa_avx2 or
+     * @ref ne10_cross_vec3f_soa_sse on x86).
+     *
+     * @param[out] dst   Pointer to the destination x, y and z arrays
+     * @param[in]  src1  Pointer to the first source x, y and z arrays
+     * @param[in]  src2  Pointer to the second source x, y and z arrays
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_cross_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cross_vec3f_soa using plain C code. */
+    extern ne10_result_t ne10_cross_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cross_vec3f_soa using NEON intrinsics. */
+    extern ne10_result_t ne10_cross_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cross_vec3f_soa using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_cross_vec3f_soa_sse (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cross_vec3f_soa using AVX2 (x86 only). */
+    extern ne10_result_t ne10_cross_vec3f_soa_avx2 (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup SGEMM General Matrix Multiplication
+     *
+     * \par
+     * These functions compute C = alpha * op(A) * op(B) + beta * C for general
+     * single precision matrices, where op(X) is X or its transpose (see
+     * @ref ne10_transpose_t), op(A) is m x k, op(B) is k x n and C is m x n. As in
+     * BLAS, and as in @ref ne10_mat4x4f_t, the matrices are stored in column major
+     * order: element (i, j) of A is a[i + j * lda].
+     *
+     * \par
+     * The product is computed in cache-sized blocks: panels of op(B) and op(A) are
+     * first copied ("packed") into contiguous buffers, then a register-blocked
+     * micro-kernel multiplies them, one small tile of C at a time. When the library
+     * is built with NE10_ENABLE_OPENMP, the blocks of rows of C are computed in
+     * parallel.
+     * @{
+     */
+
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C. When beta is zero, C is not read,
+     * so it does not need to be initialized. Points to @ref ne10_sgemm_c or
+     * @ref ne10_sgemm_neon (@ref ne10_sgemm_avx2 or @ref ne10_sgemm_sse on x86).
+     *
+     * @param[in]     trans_a Whether op(A) is A or its transpose
+     * @param[in]     trans_b Whether op(B) is B or its transpose
+     * @param[in]     m       The number of rows of op(A) and C
+     * @param[in]     n       The number of columns of op(B) and C
+     * @param[in]     k       The number of columns of op(A) and rows of op(B)
+     * @param[in]     alpha   The scale of the product
+     * @param[in]     a       Pointer to A, m x k (k x m when transposed)
+     * @param[in]     lda     The leading dimension of A, at least its number of rows
+     * @param[in]     b       Pointer to B, k x n (n x k when transposed)
+     * @param[in]     ldb     The leading dimension of B, at least its number of rows
+     * @param[in]     beta    The scale of the original C
+     * @param[in,out] c       Pointer to C, m x n
+     * @param[in]     ldc     The leading dimension of C, at least m
+     * @return @ref NE10_OK, or @ref NE10_ERR (and C unchanged) if a leading dimension
+     *         is too small or the packing buffers cannot be allocated
+     */
+    extern ne10_result_t (*ne10_sgemm) (ne10_transpose_t trans_a, ne10_transpose_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, const ne10_float32_t * a, ne10_uint32_t lda, const ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc);
+    /** Specific implementation of @ref ne10_sgemm using plain C code. */
+    extern ne10_result_t ne10_sgemm_c (ne10_transpose_t trans_a, ne10_transpose_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, const ne10_float32_t * a, ne10_uint32_t lda, const ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc);
+    /** Specific implementation of @ref ne10_sgemm using NEON intrinsics. */
+    extern ne10_result_t ne10_sgemm_neon (ne10_transpose_t trans_a, ne10_transpose_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, const ne10_float32_t * a, ne10_uint32_t lda, const ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc);
+    /** Specific implementation of @ref ne10_sgemm using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_sgemm_sse (ne10_transpose_t trans_a, ne10_transpose_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, const ne10_float32_t * a, ne10_uint32_t lda, const ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc);
+    /** Specific implementation of @ref ne10_sgemm using AVX2 (x86 only). */
+    extern ne10_result_t ne10_sgemm_avx2 (ne10_transpose_t trans_a, ne10_transpose_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, const ne10_float32_t * a, ne10_uint32_t lda, const ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc);
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup BATCH_MAT Strided and Pointer-Array Matrix Operations
+     *
+     * \par
+     * These functions are the 3x3 and 4x4 matrix functions for matrices that are not
+     * stored in a dense array. The _strided forms take a base pointer and a stride in
+     * bytes for every array, so that element i lives at byte offset i * stride; the
+     * matrices, vectors or determinants can then be members of larger structures. A
+     * source stride of 0 uses the same element for every operation. The _ptr forms
+     * take an array of pointers, one per element, for each operand.
+     *
+     * \par
+     * The NEON versions gather four matrices at a time straight into registers, one
+     * matrix per lane, so no copies into temporary dense arrays are needed. The
+     * results are the same as those of the dense functions. As with those, the
+     * destination elements must not overlap the sources or each other.
+     *
+     * \par
+     * The _strided forms return @ref NE10_ERR, without writing anything, if the
+     * destination stride is smaller than the destination element or if a stride is
+     * not a multiple of 4.
+     * @{
+     */
+
+    /**
+     * Multiplies 3x3 matrices that are a fixed number of bytes apart, as
+     * @ref ne10_mulmat_3x3f. The strides are in bytes. Points to @ref ne10_mulmat_3x3f_strided_c
+     * or @ref ne10_mulmat_3x3f_strided_neon.
+     *
+     * @param[out] dst         Pointer to the first destination matrix
+     * @param[in]  dst_stride  The distance between destination matrices
+     * @param[in]  src1        Pointer to the first left-hand matrix
+     * @param[in]  src1_stride The distance between left-hand matrices
+     * @param[in]  src2        Pointer to the first right-hand matrix
+     * @param[in]  src2_stride The distance between right-hand matrices
+     * @param[in]  count       The number of products
+     */
+    extern ne10_result_t (*ne10_mulmat_3x3f_strided) (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src1, ne10_uint32_t src1_stride, ne10_mat3x3f_t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_3x3f_strided using plain C code. */
+    extern ne10_result_t ne10_mulmat_3x3f_strided_c (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src1, ne10_uint32_t src1_stride, ne10_mat3x3f_t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_3x3f_strided using NEON intrinsics. */
+    extern ne10_result_t ne10_mulmat_3x3f_strided_neon (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src1, ne10_uint32_t src1_stride, ne10_mat3x3f_t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count);
+
+    /**
+     * Multiplies 3x3 matrices given by arrays of pointers, as @ref ne10_mulmat_3x3f. Points
+     * to @ref ne10_mulmat_3x3f_ptr_c or @ref ne10_mulmat_3x3f_ptr_neon.
+     *
+     * @param[out] dst   Pointers to the destination matrices
+     * @param[in]  src1  Pointers to the left-hand matrices
+     * @param[in]  src2  Pointers to the right-hand matrices
+     * @param[in]  count The number of products
+     */
+    extern ne10_result_t (*ne10_mulmat_3x3f_ptr) (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src1, ne10_mat3x3f_t ** src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_3x3f_ptr using plain C code. */
+    extern ne10_result_t ne10_mulmat_3x3f_ptr_c (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src1, ne10_mat3x3f_t ** src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_3x3f_ptr using NEON intrinsics. */
+    extern ne10_result_t ne10_mulmat_3x3f_ptr_neon (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src1, ne10_mat3x3f_t ** src2, ne10_uint32_t count);
+
+    /**
+     * Multiplies 4x4 matrices that are a fixed number of bytes apart, as
+     * @ref ne10_mulmat_4x4f. The strides are in bytes. Points to @ref ne10_mulmat_4x4f_strided_c
+     * or @ref ne10_mulmat_4x4f_strided_neon.
+     *
+     * @param[out] dst         Pointer to the first destination matrix
+     * @param[in]  dst_stride  The distance between destination matrices
+     * @param[in]  src1        Pointer to the first left-hand matrix
+     * @param[in]  src1_stride The distance between left-hand matrices
+     * @param[in]  src2        Pointer to the first right-hand matrix
+     * @param[in]  src2_stride The distance between right-hand matrices
+     * @param[in]  count       The number of products
+     */
+    extern ne10_result_t (*ne10_mulmat_4x4f_strided) (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src1, ne10_uint32_t src1_stride, ne10_mat4x4f_t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_4x4f_strided using plain C code. */
+    extern ne10_result_t ne10_mulmat_4x4f_strided_c (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src1, ne10_uint32_t src1_stride, ne10_mat4x4f_t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_4x4f_strided using NEON intrinsics. */
+    extern ne10_result_t ne10_mulmat_4x4f_strided_neon (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src1, ne10_uint32_t src1_stride, ne10_mat4x4f_t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count);
+
+    /**
+     * Multiplies 4x4 matrices given by arrays of pointers, as @ref ne10_mulmat_4x4f. Points
+     * to @ref ne10_mulmat_4x4f_ptr_c or @ref ne10_mulmat_4x4f_ptr_neon.
+     *
+     * @param[out] dst   Pointers to the destination matrices
+     * @param[in]  src1  Pointers to the left-hand matrices
+     * @param[in]  src2  Pointers to the right-hand matrices
+     * @param[in]  count The number of products
+     */
+    extern ne10_result_t (*ne10_mulmat_4x4f_ptr) (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src1, ne10_mat4x4f_t ** src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_4x4f_ptr using plain C code. */
+    extern ne10_result_t ne10_mulmat_4x4f_ptr_c (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src1, ne10_mat4x4f_t ** src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulmat_4x4f_ptr using NEON intrinsics. */
+    extern ne10_result_t ne10_mulmat_4x4f_ptr_neon (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src1, ne10_mat4x4f_t ** src2, ne10_uint32_t count);
+
+    /**
+     * Inverts 3x3 matrices that are a fixed number of bytes apart, as @ref ne10_invmat_3x3f.
+     * The strides are in bytes. Points to @ref ne10_invmat_3x3f_strided_c or
+     * @ref ne10_invmat_3x3f_strided_neon.
+     *
+     * @param[out] dst        Pointer to the first destination matrix
+     * @param[in]  dst_stride The distance between destination matrices
+     * @param[in]  src        Pointer to the first source matrix
+     * @param[in]  src_stride The distance between source matrices
+     * @param[in]  count      The number of matrices
+     */
+    extern ne10_result_t (*ne10_invmat_3x3f_strided) (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_3x3f_strided using plain C code. */
+    extern ne10_result_t ne10_invmat_3x3f_strided_c (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_3x3f_strided using NEON intrinsics. */
+    extern ne10_result_t ne10_invmat_3x3f_strided_neon (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+
+    /**
+     * Inverts 3x3 matrices given by arrays of pointers, as @ref ne10_invmat_3x3f. Points to
+     * @ref ne10_invmat_3x3f_ptr_c or @ref ne10_invmat_3x3f_ptr_neon.
+     *
+     * @param[out] dst   Pointers to the destination matrices
+     * @param[in]  src   Pointers to the source matrices
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_invmat_3x3f_ptr) (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_3x3f_ptr using plain C code. */
+    extern ne10_result_t ne10_invmat_3x3f_ptr_c (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_3x3f_ptr using NEON intrinsics. */
+    extern ne10_result_t ne10_invmat_3x3f_ptr_neon (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+
+    /**
+     * Inverts 4x4 matrices that are a fixed number of bytes apart, as @ref ne10_invmat_4x4f.
+     * The strides are in bytes. Points to @ref ne10_invmat_4x4f_strided_c or
+     * @ref ne10_invmat_4x4f_strided_neon.
+     *
+     * @param[out] dst        Pointer to the first destination matrix
+     * @param[in]  dst_stride The distance between destination matrices
+     * @param[in]  src        Pointer to the first source matrix
+     * @param[in]  src_stride The distance between source matrices
+     * @param[in]  count      The number of matrices
+     */
+    extern ne10_result_t (*ne10_invmat_4x4f_strided) (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_4x4f_strided using plain C code. */
+    extern ne10_result_t ne10_invmat_4x4f_strided_c (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_4x4f_strided using NEON intrinsics. */
+    extern ne10_result_t ne10_invmat_4x4f_strided_neon (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+
+    /**
+     * Inverts 4x4 matrices given by arrays of pointers, as @ref ne10_invmat_4x4f. Points to
+     * @ref ne10_invmat_4x4f_ptr_c or @ref ne10_invmat_4x4f_ptr_neon.
+     *
+     * @param[out] dst   Pointers to the destination matrices
+     * @param[in]  src   Pointers to the source matrices
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_invmat_4x4f_ptr) (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_4x4f_ptr using plain C code. */
+    extern ne10_result_t ne10_invmat_4x4f_ptr_c (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_invmat_4x4f_ptr using NEON intrinsics. */
+    extern ne10_result_t ne10_invmat_4x4f_ptr_neon (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+
+    /**
+     * Transposes 3x3 matrices that are a fixed number of bytes apart, as
+     * @ref ne10_transmat_3x3f. The strides are in bytes. Points to
+     * @ref ne10_transmat_3x3f_strided_c or @ref ne10_transmat_3x3f_strided_neon.
+     *
+     * @param[out] dst        Pointer to the first destination matrix
+     * @param[in]  dst_stride The distance between destination matrices
+     * @param[in]  src        Pointer to the first source matrix
+     * @param[in]  src_stride The distance between source matrices
+     * @param[in]  count      The number of matrices
+     */
+    extern ne10_result_t (*ne10_transmat_3x3f_strided) (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_3x3f_strided using plain C code. */
+    extern ne10_result_t ne10_transmat_3x3f_strided_c (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_3x3f_strided using NEON intrinsics. */
+    extern ne10_result_t ne10_transmat_3x3f_strided_neon (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+
+    /**
+     * Transposes 3x3 matrices given by arrays of pointers, as @ref ne10_transmat_3x3f.
+     * Points to @ref ne10_transmat_3x3f_ptr_c or @ref ne10_transmat_3x3f_ptr_neon.
+     *
+     * @param[out] dst   Pointers to the destination matrices
+     * @param[in]  src   Pointers to the source matrices
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_transmat_3x3f_ptr) (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_3x3f_ptr using plain C code. */
+    extern ne10_result_t ne10_transmat_3x3f_ptr_c (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_3x3f_ptr using NEON intrinsics. */
+    extern ne10_result_t ne10_transmat_3x3f_ptr_neon (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+
+    /**
+     * Transposes 4x4 matrices that are a fixed number of bytes apart, as
+     * @ref ne10_transmat_4x4f. The strides are in bytes. Points to
+     * @ref ne10_transmat_4x4f_strided_c or @ref ne10_transmat_4x4f_strided_neon.
+     *
+     * @param[out] dst        Pointer to the first destination matrix
+     * @param[in]  dst_stride The distance between destination matrices
+     * @param[in]  src        Pointer to the first source matrix
+     * @param[in]  src_stride The distance between source matrices
+     * @param[in]  count      The number of matrices
+     */
+    extern ne10_result_t (*ne10_transmat_4x4f_strided) (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_4x4f_strided using plain C code. */
+    extern ne10_result_t ne10_transmat_4x4f_strided_c (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_4x4f_strided using NEON intrinsics. */
+    extern ne10_result_t ne10_transmat_4x4f_strided_neon (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+
+    /**
+     * Transposes 4x4 matrices given by arrays of pointers, as @ref ne10_transmat_4x4f.
+     * Points to @ref ne10_transmat_4x4f_ptr_c or @ref ne10_transmat_4x4f_ptr_neon.
+     *
+     * @param[out] dst   Pointers to the destination matrices
+     * @param[in]  src   Pointers to the source matrices
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_transmat_4x4f_ptr) (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_4x4f_ptr using plain C code. */
+    extern ne10_result_t ne10_transmat_4x4f_ptr_c (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_transmat_4x4f_ptr using NEON intrinsics. */
+    extern ne10_result_t ne10_transmat_4x4f_ptr_neon (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+
+    /**
+     * Calculates the determinants of 3x3 matrices that are a fixed number of bytes apart, as
+     * @ref ne10_detmat_3x3f. The strides are in bytes. Points to
+     * @ref ne10_detmat_3x3f_strided_c or @ref ne10_detmat_3x3f_strided_neon.
+     *
+     * @param[out] dst        Pointer to the first determinant
+     * @param[in]  dst_stride The distance between determinants
+     * @param[in]  src        Pointer to the first source matrix
+     * @param[in]  src_stride The distance between source matrices
+     * @param[in]  count      The number of matrices
+     */
+    extern ne10_result_t (*ne10_detmat_3x3f_strided) (ne10_float32_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_3x3f_strided using plain C code. */
+    extern ne10_result_t ne10_detmat_3x3f_strided_c (ne10_float32_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_3x3f_strided using NEON intrinsics. */
+    extern ne10_result_t ne10_detmat_3x3f_strided_neon (ne10_float32_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+
+    /**
+     * Calculates the determinants of 3x3 matrices given by an array of pointers, as
+     * @ref ne10_detmat_3x3f. Points to @ref ne10_detmat_3x3f_ptr_c or
+     * @ref ne10_detmat_3x3f_ptr_neon.
+     *
+     * @param[out] dst   Pointers to the determinants
+     * @param[in]  src   Pointers to the source matrices
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_detmat_3x3f_ptr) (ne10_float32_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_3x3f_ptr using plain C code. */
+    extern ne10_result_t ne10_detmat_3x3f_ptr_c (ne10_float32_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_3x3f_ptr using NEON intrinsics. */
+    extern ne10_result_t ne10_detmat_3x3f_ptr_neon (ne10_float32_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+
+    /**
+     * Calculates the determinants of 4x4 matrices that are a fixed number of bytes apart, as
+     * @ref ne10_detmat_4x4f. The strides are in bytes. Points to
+     * @ref ne10_detmat_4x4f_strided_c or @ref ne10_detmat_4x4f_strided_neon.
+     *
+     * @param[out] dst        Pointer to the first determinant
+     * @param[in]  dst_stride The distance between determinants
+     * @param[in]  src        Pointer to the first source matrix
+     * @param[in]  src_stride The distance between source matrices
+     * @param[in]  count      The number of matrices
+     */
+    extern ne10_result_t (*ne10_detmat_4x4f_strided) (ne10_float32_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_4x4f_strided using plain C code. */
+    extern ne10_result_t ne10_detmat_4x4f_strided_c (ne10_float32_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_4x4f_strided using NEON intrinsics. */
+    extern ne10_result_t ne10_detmat_4x4f_strided_neon (ne10_float32_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+
+    /**
+     * Calculates the determinants of 4x4 matrices given by an array of pointers, as
+     * @ref ne10_detmat_4x4f. Points to @ref ne10_detmat_4x4f_ptr_c or
+     * @ref ne10_detmat_4x4f_ptr_neon.
+     *
+     * @param[out] dst   Pointers to the determinants
+     * @param[in]  src   Pointers to the source matrices
+     * @param[in]  count The number of matrices
+     */
+    extern ne10_result_t (*ne10_detmat_4x4f_ptr) (ne10_float32_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_4x4f_ptr using plain C code. */
+    extern ne10_result_t ne10_detmat_4x4f_ptr_c (ne10_float32_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_detmat_4x4f_ptr using NEON intrinsics. */
+    extern ne10_result_t ne10_detmat_4x4f_ptr_neon (ne10_float32_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+
+    /**
+     * Multiplies one 3x3 matrix by vectors that are a fixed number of bytes apart, as
+     * @ref ne10_mulcmatvec_cm3x3f_v3f. The strides are in bytes. Points to
+     * @ref ne10_mulcmatvec_cm3x3f_v3f_strided_c or @ref ne10_mulcmatvec_cm3x3f_v3f_strided_neon.
+     *
+     * @param[out] dst        Pointer to the first destination vector
+     * @param[in]  dst_stride The distance between destination vectors
+     * @param[in]  cst        Pointer to the matrix
+     * @param[in]  src        Pointer to the first source vector
+     * @param[in]  src_stride The distance between source vectors
+     * @param[in]  count      The number of vectors
+     */
+    extern ne10_result_t (*ne10_mulcmatvec_cm3x3f_v3f_strided) (ne10_vec3f_t * dst, ne10_uint32_t dst_stride, const ne10_mat3x3f_t * cst, ne10_vec3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulcmatvec_cm3x3f_v3f_strided using plain C code. */
+    extern ne10_result_t ne10_mulcmatvec_cm3x3f_v3f_strided_c (ne10_vec3f_t * dst, ne10_uint32_t dst_stride, const ne10_mat3x3f_t * cst, ne10_vec3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulcmatvec_cm3x3f_v3f_strided using NEON intrinsics. */
+    extern ne10_result_t ne10_mulcmatvec_cm3x3f_v3f_strided_neon (ne10_vec3f_t * dst, ne10_uint32_t dst_stride, const ne10_mat3x3f_t * cst, ne10_vec3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+
+    /**
+     * Multiplies one 3x3 matrix by vectors given by arrays of pointers, as
+     * @ref ne10_mulcmatvec_cm3x3f_v3f. Points to @ref ne10_mulcmatvec_cm3x3f_v3f_ptr_c or
+     * @ref ne10_mulcmatvec_cm3x3f_v3f_ptr_neon.
+     *
+     * @param[out] dst   Pointers to the destination vectors
+     * @param[in]  cst   Pointer to the matrix
+     * @param[in]  src   Pointers to the source vectors
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_mulcmatvec_cm3x3f_v3f_ptr) (ne10_vec3f_t ** dst, const ne10_mat3x3f_t * cst, ne10_vec3f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulcmatvec_cm3x3f_v3f_ptr using plain C code. */
+    extern ne10_result_t ne10_mulcmatvec_cm3x3f_v3f_ptr_c (ne10_vec3f_t ** dst, const ne10_mat3x3f_t * cst, ne10_vec3f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulcmatvec_cm3x3f_v3f_ptr using NEON intrinsics. */
+    extern ne10_result_t ne10_mulcmatvec_cm3x3f_v3f_ptr_neon (ne10_vec3f_t ** dst, const ne10_mat3x3f_t * cst, ne10_vec3f_t ** src, ne10_uint32_t count);
+
+    /**
+     * Multiplies one 4x4 matrix by vectors that are a fixed number of bytes apart, as
+     * @ref ne10_mulcmatvec_cm4x4f_v4f. The strides are in bytes. Points to
+     * @ref ne10_mulcmatvec_cm4x4f_v4f_strided_c or @ref ne10_mulcmatvec_cm4x4f_v4f_strided_neon.
+     *
+     * @param[out] dst        Pointer to the first destination vector
+     * @param[in]  dst_stride The distance between destination vectors
+     * @param[in]  cst        Pointer to the matrix
+     * @param[in]  src        Pointer to the first source vector
+     * @param[in]  src_stride The distance between source vectors
+     * @param[in]  count      The number of vectors
+     */
+    extern ne10_result_t (*ne10_mulcmatvec_cm4x4f_v4f_strided) (ne10_vec4f_t * dst, ne10_uint32_t dst_stride, const ne10_mat4x4f_t * cst, ne10_vec4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulcmatvec_cm4x4f_v4f_strided using plain C code. */
+    extern ne10_result_t ne10_mulcmatvec_cm4x4f_v4f_strided_c (ne10_vec4f_t * dst, ne10_uint32_t dst_stride, const ne10_mat4x4f_t * cst, ne10_vec4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulcmatvec_cm4x4f_v4f_strided using NEON intrinsics. */
+    extern ne10_result_t ne10_mulcmatvec_cm4x4f_v4f_strided_neon (ne10_vec4f_t * dst, ne10_uint32_t dst_stride, const ne10_mat4x4f_t * cst, ne10_vec4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+
+    /**
+     * Multiplies one 4x4 matrix by vectors given by arrays of pointers, as
+     * @ref ne10_mulcmatvec_cm4x4f_v4f. Points to @ref ne10_mulcmatvec_cm4x4f_v4f_ptr_c or
+     * @ref ne10_mulcmatvec_cm4x4f_v4f_ptr_neon.
+     *
+     * @param[out] dst   Pointers to the destination vectors
+     * @param[in]  cst   Pointer to the matrix
+     * @param[in]  src   Pointers to the source vectors
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_mulcmatvec_cm4x4f_v4f_ptr) (ne10_vec4f_t ** dst, const ne10_mat4x4f_t * cst, ne10_vec4f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulcmatvec_cm4x4f_v4f_ptr using plain C code. */
+    extern ne10_result_t ne10_mulcmatvec_cm4x4f_v4f_ptr_c (ne10_vec4f_t ** dst, const ne10_mat4x4f_t * cst, ne10_vec4f_t ** src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mulcmatvec_cm4x4f_v4f_ptr using NEON intrinsics. */
+    extern ne10_result_t ne10_mulcmatvec_cm4x4f_v4f_ptr_neon (ne10_vec4f_t ** dst, const ne10_mat4x4f_t * cst, ne10_vec4f_t ** src, ne10_uint32_t count);
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup QUAT Quaternion Operations
+     *
+     * \par
+     * These functions work on arrays of quaternions (see @ref ne10_quatf_t), for
+     * example the joint rotations of an animation. Each quaternion of the result is
+     * computed from the quaternions at the same index of the sources. The functions
+     * whose results are quaternions or vectors may work in-place; the others cannot.
+     * @{
+     */
+
+    /**
+     * Multiplies quaternions: dst = src1 * src2, the rotation by src2 followed by the
+     * rotation by src1. Points to @ref ne10_mul_quatf_c or @ref ne10_mul_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the left-hand quaternions
+     * @param[in]  src2  Pointer to the right-hand quaternions
+     * @param[in]  count The number of quaternions
+     */
+    extern ne10_result_t (*ne10_mul_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_quatf using plain C code. */
+    extern ne10_result_t ne10_mul_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mul_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_mul_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count);
+
+    /**
+     * Scales quaternions to unit length. Points to @ref ne10_normalize_quatf_c or
+     * @ref ne10_normalize_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of quaternions
+     */
+    extern ne10_result_t (*ne10_normalize_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_quatf using plain C code. */
+    extern ne10_result_t ne10_normalize_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_normalize_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_normalize_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+
+    /**
+     * Interpolates between unit quaternions linearly and normalizes the result, the shorter
+     * way round (src2 is negated when its dot product with src1 is negative). Cheaper than
+     * @ref ne10_slerp_quatf, but the rotation speed is not constant in t. Points to
+     * @ref ne10_nlerp_quatf_c or @ref ne10_nlerp_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the quaternions at t = 0
+     * @param[in]  src2  Pointer to the quaternions at t = 1
+     * @param[in]  t     Pointer to the interpolation parameters, in [0, 1]
+     * @param[in]  count The number of quaternions
+     */
+    extern ne10_result_t (*ne10_nlerp_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_nlerp_quatf using plain C code. */
+    extern ne10_result_t ne10_nlerp_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_nlerp_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_nlerp_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count);
+
+    /**
+     * Interpolates between unit quaternions along the great arc, at constant angular speed,
+     * the shorter way round. sin (t theta) / sin (theta) is evaluated with a polynomial that
+     * needs no division or trigonometric function and is accurate to about 3e-7, including
+     * for nearly equal quaternions. Points to @ref ne10_slerp_quatf_c or
+     * @ref ne10_slerp_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the quaternions at t = 0
+     * @param[in]  src2  Pointer to the quaternions at t = 1
+     * @param[in]  t     Pointer to the interpolation parameters, in [0, 1]
+     * @param[in]  count The number of quaternions
+     */
+    extern ne10_result_t (*ne10_slerp_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_slerp_quatf using plain C code. */
+    extern ne10_result_t ne10_slerp_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_slerp_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_slerp_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count);
+
+    /**
+     * Rotates 3D vectors by unit quaternions: dst = quat * src * conj (quat). Points to
+     * @ref ne10_rotate_vec3f_quatf_c or @ref ne10_rotate_vec3f_quatf_neon.
+     *
+     * @param[out] dst   Pointer to the destination vectors
+     * @param[in]  quat  Pointer to the rotations
+     * @param[in]  src   Pointer to the source vectors
+     * @param[in]  count The number of vectors
+     */
+    extern ne10_result_t (*ne10_rotate_vec3f_quatf) (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rotate_vec3f_quatf using plain C code. */
+    extern ne10_result_t ne10_rotate_vec3f_quatf_c (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rotate_vec3f_quatf using NEON intrinsics. */
+    extern ne10_result_t ne10_rotate_vec3f_quatf_neon (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count);
+
+    /**
+     * Converts unit quaternions to the equivalent rotation matrices. Points to
+     * @ref ne10_quatf_to_mat3x3f_c or @ref ne10_quatf_to_mat3x3f_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrices
+     * @param[in]  src   Pointer to the quaternions
+     * @param[in]  count The number of quaternions
+     */
+    extern ne10_result_t (*ne10_quatf_to_mat3x3f) (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_quatf_to_mat3x3f using plain C code. */
+    extern ne10_result_t ne10_quatf_to_mat3x3f_c (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_quatf_to_mat3x3f using NEON intrinsics. */
+    extern ne10_result_t ne10_quatf_to_mat3x3f_neon (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+
+    /**
+     * Converts unit quaternions to the equivalent 4x4 transformation matrices, with no
+     * translation. Points to @ref ne10_quatf_to_mat4x4f_c or
+     * @ref ne10_quatf_to_mat4x4f_neon.
+     *
+     * @param[out] dst   Pointer to the destination matrices
+     * @param[in]  src   Pointer to the quaternions
+     * @param[in]  count The number of quaternions
+     */
+    extern ne10_result_t (*ne10_quatf_to_mat4x4f) (ne10_mat4x4f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_quatf_to_mat4x4f using plain C code. */
+    extern ne10_result_t ne10_quatf_to_mat4x4f_c (ne10_mat4x4f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_quatf_to_mat4x4f using NEON intrinsics. */
+    extern ne10_result_t ne10_quatf_to_mat4x4f_neon (ne10_mat4x4f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup TRANSCEND Transcendental Functions
+     *
+     * \par
+     * These functions apply a transcendental function to every element of an array
+     * of floats and may work in-place. They use polynomial approximations after a
+     * reduction of the argument, rather than the C library. The C versions evaluate
+     * the same operations as the NEON and x86 ones, so the results of the C, AArch64
+     * NEON and x86 versions are identical except where noted. The errors given are
+     * bounds on the largest found against the C library in double precision, testing
+     * every float argument (a sample of the pairs for atan2, and a sample of the
+     * arguments for the versions refining estimates). NaN arguments give NaN results.
+     * @{
+     */
+
+    /**
+     * Computes e^x for every element. The largest error is 1 ulp; results below
+     * the smallest denormal are 0 and above the largest float are infinite. Points to
+     * @ref ne10_exp_float_c, @ref ne10_exp_float_neon, @ref ne10_exp_float_sse or
+     * @ref ne10_exp_float_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_exp_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_exp_float using plain C code. */
+    extern ne10_result_t ne10_exp_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_exp_float using NEON intrinsics. */
+    extern ne10_result_t ne10_exp_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_exp_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_exp_float_sse (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_exp_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_exp_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Computes the natural logarithm of every element. The largest error is 1
+     * ulp. log (0) is -infinity and the logarithm of a negative number is NaN. Points to
+     * @ref ne10_log_float_c, @ref ne10_log_float_neon, @ref ne10_log_float_sse or
+     * @ref ne10_log_float_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_log_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_log_float using plain C code. */
+    extern ne10_result_t ne10_log_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_log_float using NEON intrinsics. */
+    extern ne10_result_t ne10_log_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_log_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_log_float_sse (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_log_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_log_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Computes the sine and the cosine of every element. The largest error is 2.5
+     * ulp for the sine and 2.5 ulp for the cosine while |x| <= 8192 (a sine or
+     * cosine close to 0 counts in ulp of the result); larger arguments are passed to sinf
+     * and cosf. Points to @ref ne10_sincos_float_c, @ref ne10_sincos_float_neon,
+     * @ref ne10_sincos_float_sse or @ref ne10_sincos_float_avx2.
+     *
+     * @param[out] dst_sin Pointer to the destination array of sines
+     * @param[out] dst_cos Pointer to the destination array of cosines
+     * @param[in]  src     Pointer to the source array
+     * @param[in]  count   The number of elements
+     */
+    extern ne10_result_t (*ne10_sincos_float) (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sincos_float using plain C code. */
+    extern ne10_result_t ne10_sincos_float_c (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sincos_float using NEON intrinsics. */
+    extern ne10_result_t ne10_sincos_float_neon (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sincos_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_sincos_float_sse (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sincos_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_sincos_float_avx2 (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Computes atan2 (src1, src2), the angle in [-pi, pi] of the point (src2, src1), for
+     * every pair of elements, with the special cases of the C library for zeros and
+     * infinities. The largest error is 2.5 ulp (3.5 ulp for the ARMv7
+     * NEON version, which divides with a refined estimate). Points to
+     * @ref ne10_atan2_float_c, @ref ne10_atan2_float_neon, @ref ne10_atan2_float_sse or
+     * @ref ne10_atan2_float_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the y coordinates
+     * @param[in]  src2  Pointer to the x coordinates
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_atan2_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_atan2_float using plain C code. */
+    extern ne10_result_t ne10_atan2_float_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_atan2_float using NEON intrinsics. */
+    extern ne10_result_t ne10_atan2_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_atan2_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_atan2_float_sse (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_atan2_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_atan2_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+
+    /**
+     * Computes the square root of every element, correctly rounded (within 3
+     * ulp for the ARMv7 NEON version, which refines an estimate). Points to
+     * @ref ne10_sqrt_float_c, @ref ne10_sqrt_float_neon, @ref ne10_sqrt_float_sse or
+     * @ref ne10_sqrt_float_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_sqrt_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sqrt_float using plain C code. */
+    extern ne10_result_t ne10_sqrt_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sqrt_float using NEON intrinsics. */
+    extern ne10_result_t ne10_sqrt_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sqrt_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_sqrt_float_sse (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sqrt_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_sqrt_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Computes 1 / sqrt (x) for every element. The C version divides by sqrtf, within 1.5
+     * ulp; the others refine the reciprocal square root estimate of the processor by
+     * Newton-Raphson steps, within 2.5 ulp (NEON) and 4.5 ulp
+     * (x86). Points to @ref ne10_rsqrt_float_c, @ref ne10_rsqrt_float_neon,
+     * @ref ne10_rsqrt_float_sse or @ref ne10_rsqrt_float_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_rsqrt_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rsqrt_float using plain C code. */
+    extern ne10_result_t ne10_rsqrt_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rsqrt_float using NEON intrinsics. */
+    extern ne10_result_t ne10_rsqrt_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rsqrt_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_rsqrt_float_sse (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_rsqrt_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_rsqrt_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** @} */
+
+    /**
+     * @ingroup groupMaths
+     * @defgroup REDUCE Reductions
+     *
+     * \par
+     * These functions reduce a whole array to a single value. The float sums
+     * add element i to partial sum i % 32, in order, and then combine the 32
+     * partial sums pairwise, so the C, NEON and x86 versions give the same results
+     * (on ARMv7, NEON flushes denormals to zero). The minimum and maximum searches
+     * skip NaNs and give the first index of the value found; the result is the
+     * first element if every element is a NaN. They return NE10_ERR, writing
+     * nothing, if count is 0.
+     *
+     * \par
+     * The fixed-point versions work on Q15 (ne10_int16_t) and Q31 (ne10_int32_t)
+     * data. Their sums are kept in 64 bits and are exact, except for the rounding
+     * of each product by @ref ne10_dotprod_int32.
+     * @{
+     */
+
+    /**
+     * Computes the sum of the elements. Points to @ref ne10_sum_float_c,
+     * @ref ne10_sum_float_neon, @ref ne10_sum_float_sse or @ref ne10_sum_float_avx2.
+     *
+     * @param[out] dst   Pointer to the result
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_sum_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_float using plain C code. */
+    extern ne10_result_t ne10_sum_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_float using NEON intrinsics. */
+    extern ne10_result_t ne10_sum_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_sum_float_sse (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_sum_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Computes the mean of the elements, the sum divided by count. Points to
+     * @ref ne10_mean_float_c, @ref ne10_mean_float_neon, @ref ne10_mean_float_sse
+     * or @ref ne10_mean_float_avx2.
+     *
+     * @param[out] dst   Pointer to the result
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements, at least 1
+     */
+    extern ne10_result_t (*ne10_mean_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mean_float using plain C code. */
+    extern ne10_result_t ne10_mean_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mean_float using NEON intrinsics. */
+    extern ne10_result_t ne10_mean_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mean_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_mean_float_sse (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_mean_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_mean_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Computes the dot product of two arrays, the sum of src1[i] * src2[i]. Points to
+     * @ref ne10_dotprod_float_c, @ref ne10_dotprod_float_neon, @ref ne10_dotprod_float_sse
+     * or @ref ne10_dotprod_float_avx2.
+     *
+     * @param[out] dst   Pointer to the result
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_dotprod_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dotprod_float using plain C code. */
+    extern ne10_result_t ne10_dotprod_float_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dotprod_float using NEON intrinsics. */
+    extern ne10_result_t ne10_dotprod_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dotprod_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_dotprod_float_sse (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dotprod_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_dotprod_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+
+    /**
+     * Computes the L2 norm of an array, the square root of the sum of the squares
+     * of the elements (without scaling: the sum of the squares overflows above about
+     * 1.8e19). Points to @ref ne10_norm2_float_c, @ref ne10_norm2_float_neon,
+     * @ref ne10_norm2_float_sse or @ref ne10_norm2_float_avx2.
+     *
+     * @param[out] dst   Pointer to the result
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_norm2_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm2_float using plain C code. */
+    extern ne10_result_t ne10_norm2_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm2_float using NEON intrinsics. */
+    extern ne10_result_t ne10_norm2_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm2_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_norm2_float_sse (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_norm2_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_norm2_float_avx2 (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Finds the largest element and the index of its first occurrence. Points to
+     * @ref ne10_max_float_c, @ref ne10_max_float_neon, @ref ne10_max_float_sse
+     * or @ref ne10_max_float_avx2.
+     *
+     * @param[out] dst   Pointer to the value found
+     * @param[out] index Pointer to the index of the element found
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements, at least 1
+     */
+    extern ne10_result_t (*ne10_max_float) (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_max_float using plain C code. */
+    extern ne10_result_t ne10_max_float_c (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_max_float using NEON intrinsics. */
+    extern ne10_result_t ne10_max_float_neon (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_max_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_max_float_sse (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_max_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_max_float_avx2 (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Finds the smallest element and the index of its first occurrence. Points to
+     * @ref ne10_min_float_c, @ref ne10_min_float_neon, @ref ne10_min_float_sse
+     * or @ref ne10_min_float_avx2.
+     *
+     * @param[out] dst   Pointer to the value found
+     * @param[out] index Pointer to the index of the element found
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements, at least 1
+     */
+    extern ne10_result_t (*ne10_min_float) (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_min_float using plain C code. */
+    extern ne10_result_t ne10_min_float_c (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_min_float using NEON intrinsics. */
+    extern ne10_result_t ne10_min_float_neon (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_min_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_min_float_sse (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_min_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_min_float_avx2 (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Finds the largest absolute value of the elements and the index of its first
+     * occurrence. Points to @ref ne10_maxabs_float_c, @ref ne10_maxabs_float_neon,
+     * @ref ne10_maxabs_float_sse or @ref ne10_maxabs_float_avx2.
+     *
+     * @param[out] dst   Pointer to the value found
+     * @param[out] index Pointer to the index of the element found
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements, at least 1
+     */
+    extern ne10_result_t (*ne10_maxabs_float) (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_maxabs_float using plain C code. */
+    extern ne10_result_t ne10_maxabs_float_c (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_maxabs_float using NEON intrinsics. */
+    extern ne10_result_t ne10_maxabs_float_neon (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_maxabs_float using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_maxabs_float_sse (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_maxabs_float using AVX2 (x86 only). */
+    extern ne10_result_t ne10_maxabs_float_avx2 (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Computes the exact sum of an array of Q15 values, in Q15. Points to
+     * @ref ne10_sum_int16_c or @ref ne10_sum_int16_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the result
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_sum_int16) (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_int16 using plain C code. */
+    extern ne10_result_t ne10_sum_int16_c (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_sum_int16_neon (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+
+    /**
+     * Computes the exact sum of an array of Q31 values, in Q31. Points to
+     * @ref ne10_sum_int32_c or @ref ne10_sum_int32_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the result
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_sum_int32) (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_int32 using plain C code. */
+    extern ne10_result_t ne10_sum_int32_c (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_sum_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_sum_int32_neon (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+
+    /**
+     * Computes the exact dot product of two arrays of Q15 values, in Q30. Points to
+     * @ref ne10_dotprod_int16_c or @ref ne10_dotprod_int16_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the result
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_dotprod_int16) (ne10_int64_t * dst, ne10_int16_t * src1, ne10_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dotprod_int16 using plain C code. */
+    extern ne10_result_t ne10_dotprod_int16_c (ne10_int64_t * dst, ne10_int16_t * src1, ne10_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dotprod_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_dotprod_int16_neon (ne10_int64_t * dst, ne10_int16_t * src1, ne10_int16_t * src2, ne10_uint32_t count);
+
+    /**
+     * Computes the dot product of two arrays of Q31 values, in Q31: each product is
+     * rounded down to Q31 (shifted right by 31) before it is added. Points to
+     * @ref ne10_dotprod_int32_c or @ref ne10_dotprod_int32_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the result
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_dotprod_int32) (ne10_int64_t * dst, ne10_int32_t * src1, ne10_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dotprod_int32 using plain C code. */
+    extern ne10_result_t ne10_dotprod_int32_c (ne10_int64_t * dst, ne10_int32_t * src1, ne10_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_dotprod_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_dotprod_int32_neon (ne10_int64_t * dst, ne10_int32_t * src1, ne10_int32_t * src2, ne10_uint32_t count);
+
+    /**
+     * Finds the largest absolute value of the elements and the index of its first
+     * occurrence. The absolute values saturate: -32768 counts as 32767. Points to
+     * @ref ne10_maxabs_int16_c or @ref ne10_maxabs_int16_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the value found
+     * @param[out] index Pointer to the index of the element found
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements, at least 1
+     */
+    extern ne10_result_t (*ne10_maxabs_int16) (ne10_int16_t * dst, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_maxabs_int16 using plain C code. */
+    extern ne10_result_t ne10_maxabs_int16_c (ne10_int16_t * dst, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_maxabs_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_maxabs_int16_neon (ne10_int16_t * dst, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count);
+
+    /**
+     * Finds the largest absolute value of the elements and the index of its first
+     * occurrence. The absolute values saturate: -2^31 counts as 2^31 - 1. Points to
+     * @ref ne10_maxabs_int32_c or @ref ne10_maxabs_int32_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the value found
+     * @param[out] index Pointer to the index of the element found
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements, at least 1
+     */
+    extern ne10_result_t (*ne10_maxabs_int32) (ne10_int32_t * dst, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_maxabs_int32 using plain C code. */
+    extern ne10_result_t ne10_maxabs_int32_c (ne10_int32_t * dst, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_maxabs_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_maxabs_int32_neon (ne10_int32_t * dst, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count);
+    /** @} */
+
+    /**
+     * @defgroup COMPLEX Complex-Vector Operations
+     *
+     * \par
+     * These functions work element by element on arrays of complex values, of the
+     * types the FFT functions use. The NEON versions load the real and the imaginary
+     * parts into separate registers (vld2q), so each operation is done on four (or
+     * eight) elements at a time without any shuffling. The float products are not
+     * fused, so the C, NEON and x86 versions give the same results, except on ARMv7,
+     * where NEON flushes denormals to zero and the square root, arctangent, sine and
+     * cosine are those of @ref TRANSCEND.
+     *
+     * \par
+     * The fixed-point versions work on Q31 (ne10_fft_cpx_int32_t) and Q15
+     * (ne10_fft_cpx_int16_t) data. Each product is rounded down to the input format
+     * and the sums saturate, as vqdmulh and vqadd do; the C and NEON versions give
+     * the same results.
+     * @{
+     */
+
+    /**
+     * Multiplies two complex arrays element by element: dst[i] = src1[i] * src2[i]. Points
+     * to @ref ne10_cmul_float32_c, @ref ne10_cmul_float32_neon, @ref ne10_cmul_float32_sse
+     * or @ref ne10_cmul_float32_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cmul_float32) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_float32 using plain C code. */
+    extern ne10_result_t ne10_cmul_float32_c (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_float32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cmul_float32_neon (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_float32 using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_cmul_float32_sse (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_float32 using AVX2 (x86 only). */
+    extern ne10_result_t ne10_cmul_float32_avx2 (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+
+    /**
+     * Multiplies a complex array by the conjugate of another element by element:
+     * dst[i] = src1[i] * conj(src2[i]). Points to @ref ne10_cmul_conj_float32_c,
+     * @ref ne10_cmul_conj_float32_neon, @ref ne10_cmul_conj_float32_sse or
+     * @ref ne10_cmul_conj_float32_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cmul_conj_float32) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_conj_float32 using plain C code. */
+    extern ne10_result_t ne10_cmul_conj_float32_c (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_conj_float32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cmul_conj_float32_neon (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_conj_float32 using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_cmul_conj_float32_sse (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_conj_float32 using AVX2 (x86 only). */
+    extern ne10_result_t ne10_cmul_conj_float32_avx2 (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+
+    /**
+     * Adds the element-wise product of two complex arrays to an accumulator array:
+     * dst[i] = acc[i] + src1[i] * src2[i]. Points to @ref ne10_cmac_float32_c,
+     * @ref ne10_cmac_float32_neon, @ref ne10_cmac_float32_sse or
+     * @ref ne10_cmac_float32_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  acc   Pointer to the accumulator array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cmac_float32) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmac_float32 using plain C code. */
+    extern ne10_result_t ne10_cmac_float32_c (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmac_float32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cmac_float32_neon (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmac_float32 using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_cmac_float32_sse (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmac_float32 using AVX2 (x86 only). */
+    extern ne10_result_t ne10_cmac_float32_avx2 (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+
+    /**
+     * Computes the magnitude of each element of a complex array, sqrt(r * r + i * i),
+     * without scaling: it overflows above about 1.8e19. Points to
+     * @ref ne10_cabs_float32_c, @ref ne10_cabs_float32_neon, @ref ne10_cabs_float32_sse or
+     * @ref ne10_cabs_float32_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cabs_float32) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs_float32 using plain C code. */
+    extern ne10_result_t ne10_cabs_float32_c (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs_float32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cabs_float32_neon (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs_float32 using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_cabs_float32_sse (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs_float32 using AVX2 (x86 only). */
+    extern ne10_result_t ne10_cabs_float32_avx2 (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Computes the squared magnitude of each element of a complex array, r * r + i * i.
+     * Points to @ref ne10_cabs2_float32_c, @ref ne10_cabs2_float32_neon,
+     * @ref ne10_cabs2_float32_sse or @ref ne10_cabs2_float32_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cabs2_float32) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs2_float32 using plain C code. */
+    extern ne10_result_t ne10_cabs2_float32_c (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs2_float32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cabs2_float32_neon (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs2_float32 using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_cabs2_float32_sse (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs2_float32 using AVX2 (x86 only). */
+    extern ne10_result_t ne10_cabs2_float32_avx2 (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Multiplies each element of a complex array by a real value. Points to
+     * @ref ne10_cscale_float32_c, @ref ne10_cscale_float32_neon,
+     * @ref ne10_cscale_float32_sse or @ref ne10_cscale_float32_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  cst   The scale factor
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cscale_float32) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cscale_float32 using plain C code. */
+    extern ne10_result_t ne10_cscale_float32_c (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cscale_float32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cscale_float32_neon (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cscale_float32 using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_cscale_float32_sse (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_float32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cscale_float32 using AVX2 (x86 only). */
+    extern ne10_result_t ne10_cscale_float32_avx2 (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_float32_t cst, ne10_uint32_t count);
+
+    /**
+     * Converts a complex array to polar form: the magnitudes as by @ref ne10_cabs_float32
+     * and the phases, in [-pi, pi], as by @ref ne10_atan2_float. Points to
+     * @ref ne10_cpolar_float32_c, @ref ne10_cpolar_float32_neon,
+     * @ref ne10_cpolar_float32_sse or @ref ne10_cpolar_float32_avx2.
+     *
+     * @param[out] mag   Pointer to the magnitudes
+     * @param[out] phase Pointer to the phases
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cpolar_float32) (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpolar_float32 using plain C code. */
+    extern ne10_result_t ne10_cpolar_float32_c (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpolar_float32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cpolar_float32_neon (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpolar_float32 using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_cpolar_float32_sse (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cpolar_float32 using AVX2 (x86 only). */
+    extern ne10_result_t ne10_cpolar_float32_avx2 (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+
+    /**
+     * Converts polar form to a complex array: dst[i] = mag[i] * (cos(phase[i]),
+     * sin(phase[i])), with the sine and cosine as by @ref ne10_sincos_float. Points to
+     * @ref ne10_crect_float32_c, @ref ne10_crect_float32_neon, @ref ne10_crect_float32_sse
+     * or @ref ne10_crect_float32_avx2.
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  mag   Pointer to the magnitudes
+     * @param[in]  phase Pointer to the phases
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_crect_float32) (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_crect_float32 using plain C code. */
+    extern ne10_result_t ne10_crect_float32_c (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_crect_float32 using NEON intrinsics. */
+    extern ne10_result_t ne10_crect_float32_neon (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_crect_float32 using SSE4.1 (x86 only). */
+    extern ne10_result_t ne10_crect_float32_sse (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_crect_float32 using AVX2 (x86 only). */
+    extern ne10_result_t ne10_crect_float32_avx2 (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count);
+
+    /**
+     * Multiplies two complex Q31 arrays element by element: dst[i] = src1[i] * src2[i].
+     * Points to @ref ne10_cmul_int32_c or @ref ne10_cmul_int32_neon (the C version on
+     * x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cmul_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_int32 using plain C code. */
+    extern ne10_result_t ne10_cmul_int32_c (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cmul_int32_neon (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+
+    /**
+     * Multiplies a complex Q31 array by the conjugate of another element by element:
+     * dst[i] = src1[i] * conj(src2[i]). Points to @ref ne10_cmul_conj_int32_c or
+     * @ref ne10_cmul_conj_int32_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cmul_conj_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_conj_int32 using plain C code. */
+    extern ne10_result_t ne10_cmul_conj_int32_c (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_conj_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cmul_conj_int32_neon (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+
+    /**
+     * Adds the element-wise product of two complex Q31 arrays to an accumulator array:
+     * dst[i] = acc[i] + src1[i] * src2[i]. Points to @ref ne10_cmac_int32_c or
+     * @ref ne10_cmac_int32_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  acc   Pointer to the accumulator array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cmac_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmac_int32 using plain C code. */
+    extern ne10_result_t ne10_cmac_int32_c (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmac_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cmac_int32_neon (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+
+    /**
+     * Computes the squared magnitude of each element of a complex Q31 array,
+     * r * r + i * i, in Q31. Points to @ref ne10_cabs2_int32_c or
+     * @ref ne10_cabs2_int32_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cabs2_int32) (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs2_int32 using plain C code. */
+    extern ne10_result_t ne10_cabs2_int32_c (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs2_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cabs2_int32_neon (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count);
+
+    /**
+     * Multiplies each element of a complex Q31 array by a real Q31 value. Points to
+     * @ref ne10_cscale_int32_c or @ref ne10_cscale_int32_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  cst   The scale factor
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cscale_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_int32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cscale_int32 using plain C code. */
+    extern ne10_result_t ne10_cscale_int32_c (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_int32_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cscale_int32 using NEON intrinsics. */
+    extern ne10_result_t ne10_cscale_int32_neon (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_int32_t cst, ne10_uint32_t count);
+
+    /**
+     * Multiplies two complex Q15 arrays element by element: dst[i] = src1[i] * src2[i].
+     * Points to @ref ne10_cmul_int16_c or @ref ne10_cmul_int16_neon (the C version on
+     * x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cmul_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_int16 using plain C code. */
+    extern ne10_result_t ne10_cmul_int16_c (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_cmul_int16_neon (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+
+    /**
+     * Multiplies a complex Q15 array by the conjugate of another element by element:
+     * dst[i] = src1[i] * conj(src2[i]). Points to @ref ne10_cmul_conj_int16_c or
+     * @ref ne10_cmul_conj_int16_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cmul_conj_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_conj_int16 using plain C code. */
+    extern ne10_result_t ne10_cmul_conj_int16_c (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmul_conj_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_cmul_conj_int16_neon (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+
+    /**
+     * Adds the element-wise product of two complex Q15 arrays to an accumulator array:
+     * dst[i] = acc[i] + src1[i] * src2[i]. Points to @ref ne10_cmac_int16_c or
+     * @ref ne10_cmac_int16_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  acc   Pointer to the accumulator array
+     * @param[in]  src1  Pointer to the first source array
+     * @param[in]  src2  Pointer to the second source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cmac_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmac_int16 using plain C code. */
+    extern ne10_result_t ne10_cmac_int16_c (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cmac_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_cmac_int16_neon (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+
+    /**
+     * Computes the squared magnitude of each element of a complex Q15 array,
+     * r * r + i * i, in Q15. Points to @ref ne10_cabs2_int16_c or
+     * @ref ne10_cabs2_int16_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cabs2_int16) (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs2_int16 using plain C code. */
+    extern ne10_result_t ne10_cabs2_int16_c (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cabs2_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_cabs2_int16_neon (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count);
+
+    /**
+     * Multiplies each element of a complex Q15 array by a real Q15 value. Points to
+     * @ref ne10_cscale_int16_c or @ref ne10_cscale_int16_neon (the C version on x86).
+     *
+     * @param[out] dst   Pointer to the destination array
+     * @param[in]  src   Pointer to the source array
+     * @param[in]  cst   The scale factor
+     * @param[in]  count The number of elements
+     */
+    extern ne10_result_t (*ne10_cscale_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_int16_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cscale_int16 using plain C code. */
+    extern ne10_result_t ne10_cscale_int16_c (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_int16_t cst, ne10_uint32_t count);
+    /** Specific implementation of @ref ne10_cscale_int16 using NEON intrinsics. */
+    extern ne10_result_t ne10_cscale_int16_neon (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_int16_t cst, ne10_uint32_t count);
+    /** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,8 +51,9 @@ extern "C" {
      * @param[in]  vertex_count        vertices count of convex ploygen
      *
      * The function computes the AABB for a polygon. Points to @ref ne10_physics_compute_aabb_vec2f_c
-     * or @ref ne10_physics_compute_aabb_vec2f_neon, the latter of which requires that vertex_count
-     * is a multiple of 4.
+     * or @ref ne10_physics_compute_aabb_vec2f_neon. On armv7, the NEON version handles vertex_count
+     * a multiple of 4 with the assembly kernel and the remaining vertices in C; on AArch64 it is
+     * written with intrinsics and handles any vertex_count.
      */
     extern void (*ne10_physics_compute_aabb_vec2f) (ne10_mat2x2f_t *aabb,
             ne10_vec2f_t *vertices,
@@ -72,6 +73,47 @@ extern "C" {
             ne10_uint32_t vertex_count);
 #endif // ENABLE_NE10_PHYSICS_COMPUTE_AABB_VEC2F_NEON
 
+    /**
+     * @ingroup COLLISION_DETECT
+     * @brief Compute the AABBs of many polygons.
+     *
+     * @param[out] *aabbs              return axis aligned boxes, shape_count entries
+     * @param[in]  *vertices           the vertices of all the polygons
+     * @param[in]  *offsets            shape_count + 1 entries: the vertices of polygon i are
+     *                                 vertices[offsets[i]] to vertices[offsets[i + 1] - 1]
+     * @param[in]  *xfs                the position and orientation of each polygon
+     * @param[in]  *radii              the radius of each polygon
+     * @param[in]  shape_count         the number of polygons
+     *
+     * The function computes the same boxes as @ref ne10_physics_compute_aabb_vec2f called on
+     * each polygon in turn, for polygons of any number of vertices (at least 1). When the
+     * thread pool is running (see @ref ne10_threadpool_init), large batches are shared out
+     * between its threads. Points to @ref ne10_physics_compute_aabb_batch_vec2f_c or
+     * @ref ne10_physics_compute_aabb_batch_vec2f_neon, the latter of which computes the boxes
+     * of 4 polygons at a time.
+     */
+    extern void (*ne10_physics_compute_aabb_batch_vec2f) (ne10_mat2x2f_t *aabbs,
+            const ne10_vec2f_t *vertices,
+            const ne10_uint32_t *offsets,
+            const ne10_mat2x2f_t *xfs,
+            const ne10_vec2f_t *radii,
+            ne10_uint32_t shape_count);
+    extern void ne10_physics_compute_aabb_batch_vec2f_c (ne10_mat2x2f_t *aabbs,
+            const ne10_vec2f_t *vertices,
+            const ne10_uint32_t *offsets,
+            const ne10_mat2x2f_t *xfs,
+            const ne10_vec2f_t *radii,
+            ne10_uint32_t shape_count);
+#if !defined (NE10_ENABLE_X86)
+    extern void ne10_physics_compute_aabb_batch_vec2f_neon (ne10_mat2x2f_t *aabbs,
+            const ne10_vec2f_t *vertices,
+            const ne10_uint32_t *offsets,
+            const ne10_mat2x2f_t *xfs,
+            const ne10_vec2f_t *radii,
+            ne10_uint32_t shape_count)
+    asm ("ne10_physics_compute_aabb_batch_vec2f_neon");
+#endif // NE10_ENABLE_X86
+
     /**
      * @ingroup COLLISION_DETECT
      * @brief Calculate relative velocity at contact.
@@ -160,6 +202,130 @@ extern "C" {
     asm ("ne10_physics_apply_impulse_vec2f_neon");
 #endif // ENABLE_NE10_PHYSICS_APPLY_IMPULSE_VEC2F_NEON
 
+    /**
+     * @ingroup BROAD_PHASE
+     * @brief Creates a broad phase.
+     *
+     * @param[in]  capacity          the largest number of boxes it will be given
+     * @param[in]  mode              @ref NE10_PHYSICS_BROADPHASE_SAP or @ref NE10_PHYSICS_BROADPHASE_GRID
+     * @param[in]  cell_size         side of the grid cells, ignored by @ref NE10_PHYSICS_BROADPHASE_SAP
+     * @return     pointer to the broad phase, or NULL if the parameters are not supported
+     *
+     * The broad phase owns all the memory of the search, so that finding the pairs of a new
+     * frame does not allocate (but for the grid, whose cell lists grow when needed). For the
+     * grid, the cells should be about as large as the largest common box; a box covering
+     * more than 16 cells is tested against every other box instead. To free the broad phase,
+     * call @ref ne10_physics_broadphase_destroy.
+     */
+    extern ne10_physics_broadphase_t ne10_physics_broadphase_create (ne10_uint32_t capacity,
+            ne10_physics_broadphase_mode_t mode,
+            ne10_float32_t cell_size);
+    extern void ne10_physics_broadphase_destroy (ne10_physics_broadphase_t bp);
+
+    /**
+     * @ingroup BROAD_PHASE
+     * @brief Find the overlapping pairs of axis aligned boxes.
+     *
+     * @param[in]  bp                broad phase created by @ref ne10_physics_broadphase_create
+     * @param[out] *pairs            return the overlapping pairs, in no particular order
+     * @param[in]  max_pairs         the number of pairs that pairs can hold
+     * @param[in]  *aabbs            the boxes, as returned by @ref ne10_physics_compute_aabb_vec2f
+     * @param[in]  count             the number of boxes, at most the capacity
+     * @return     the number of overlapping pairs, of which the first max_pairs are written
+     *
+     * Boxes that touch overlap. The bounds must not be NaN. When called again with the same
+     * count, the pairs are found incrementally: the sort along x starts from the order of the
+     * previous call, which costs little when the boxes have moved by a fraction of their
+     * size. The function returns 0 if count exceeds the capacity, or if the grid cannot
+     * allocate its cell lists. A broad phase must not be shared by calls running at the
+     * same time.
+     * Points to @ref ne10_physics_broadphase_find_pairs_c or @ref ne10_physics_broadphase_find_pairs_neon,
+     * which differ in the sweep of @ref NE10_PHYSICS_BROADPHASE_SAP.
+     */
+    extern ne10_uint32_t (*ne10_physics_broadphase_find_pairs) (ne10_physics_broadphase_t bp,
+            ne10_physics_pair_t *pairs,
+            ne10_uint32_t max_pairs,
+            const ne10_mat2x2f_t *aabbs,
+            ne10_uint32_t count);
+    extern ne10_uint32_t ne10_physics_broadphase_find_pairs_c (ne10_physics_broadphase_t bp,
+            ne10_physics_pair_t *pairs,
+            ne10_uint32_t max_pairs,
+            const ne10_mat2x2f_t *aabbs,
+            ne10_uint32_t count);
+#if !defined (NE10_ENABLE_X86)
+    extern ne10_uint32_t ne10_physics_broadphase_find_pairs_neon (ne10_physics_broadphase_t bp,
+            ne10_physics_pair_t *pairs,
+            ne10_uint32_t max_pairs,
+            const ne10_mat2x2f_t *aabbs,
+            ne10_uint32_t count)
+    asm ("ne10_physics_broadphase_find_pairs_neon");
+#endif // NE10_ENABLE_X86
+
+    /**
+     * @ingroup CONTACT_SOLVER
+     * @brief Creates a contact solver.
+     *
+     * @param[in]  max_contacts      the largest number of contacts it will be given
+     * @param[in]  max_bodies        the largest number of bodies it will be given
+     * @return     pointer to the solver, or NULL if the parameters are not supported
+     *
+     * The solver owns all the memory of a step, so that solving does not allocate. To free
+     * the solver, call @ref ne10_physics_solver_destroy.
+     */
+    extern ne10_physics_solver_t ne10_physics_solver_create (ne10_uint32_t max_contacts,
+            ne10_uint32_t max_bodies);
+    extern void ne10_physics_solver_destroy (ne10_physics_solver_t solver);
+
+    /**
+     * @ingroup CONTACT_SOLVER
+     * @brief Solve the velocity constraints of the contacts of a step.
+     *
+     * @param[in]  solver            solver created by @ref ne10_physics_solver_create
+     * @param[in,out] *v_w           velocity and angular velocity of each body
+     * @param[in]  *inv_mass         inverse mass (x) and inverse inertia (y) of each body, 0 for static bodies
+     * @param[in]  body_count        the number of bodies, at most max_bodies
+     * @param[in,out] *contacts      the contacts, whose accumulated impulses warm start the step and are replaced
+     * @param[in]  contact_count     the number of contacts, at most max_contacts
+     * @param[in]  iterations        the number of iterations over all the contacts
+     * @return     NE10_OK, or NE10_ERR, leaving everything unchanged, if a count exceeds the solver's
+     *             or a contact refers to a body past body_count
+     *
+     * The contacts are solved by sequential impulses: the accumulated impulses of the previous
+     * step are applied first, then each iteration applies to every contact the friction impulse,
+     * bounded by the friction coefficient times the normal impulse, and the normal impulse, which
+     * never pulls the bodies together. Restitution applies to the contacts whose bodies approach
+     * faster than 1 unit per second at the start of the step. Pass zero accumulated impulses to
+     * start cold. The contacts are batched into groups of 4 that share no moving body, in the
+     * order they are given, and solved a group at a time; the order of the groups and lanes is
+     * in the solver until the next step.
+     * Points to @ref ne10_physics_solve_contacts_vec2f_c or @ref ne10_physics_solve_contacts_vec2f_neon,
+     * the latter of which solves the 4 contacts of a group at once.
+     */
+    extern ne10_result_t (*ne10_physics_solve_contacts_vec2f) (ne10_physics_solver_t solver,
+            ne10_vec3f_t *v_w,
+            const ne10_vec2f_t *inv_mass,
+            ne10_uint32_t body_count,
+            ne10_physics_contacts_t *contacts,
+            ne10_uint32_t contact_count,
+            ne10_uint32_t iterations);
+    extern ne10_result_t ne10_physics_solve_contacts_vec2f_c (ne10_physics_solver_t solver,
+            ne10_vec3f_t *v_w,
+            const ne10_vec2f_t *inv_mass,
+            ne10_uint32_t body_count,
+            ne10_physics_contacts_t *contacts,
+            ne10_uint32_t contact_count,
+            ne10_uint32_t iterations);
+#if !defined (NE10_ENABLE_X86)
+    extern ne10_result_t ne10_physics_solve_contacts_vec2f_neon (ne10_physics_solver_t solver,
+            ne10_vec3f_t *v_w,
+            const ne10_vec2f_t *inv_mass,
+            ne10_uint32_t body_count,
+            ne10_physics_contacts_t *contacts,
+            ne10_uint32_t contact_count,
+            ne10_uint32_t iterations)
+    asm ("ne10_physics_solve_contacts_vec2f_neon");
+#endif // NE10_ENABLE_X86
+
 #ifdef __cplusplus
 }
 #endif
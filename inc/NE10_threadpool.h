@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : inc/NE10_threadpool.h
+ */
+
+#include "NE10_types.h"
+
+#ifndef NE10_THREADPOOL_H
+#define NE10_THREADPOOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** The largest number of threads in the pool, the calling thread included. */
+#define NE10_THREADPOOL_MAX_THREADS 64
+
+    typedef void (*ne10_task_fn_t) (void *arg);
+
+    /**
+     * The body of a parallel loop, called for the indices [begin, end). @c slot identifies
+     * the caller among the threads running the same loop at the same time; it is less than
+     * @ref ne10_threadpool_size, so it can select per-thread scratch memory.
+     */
+    typedef void (*ne10_parallel_for_fn_t) (ne10_uint32_t begin,
+                                            ne10_uint32_t end,
+                                            ne10_uint32_t slot,
+                                            void *arg);
+
+    /**
+     * A set of tasks that can be waited for together. The fields are private.
+     */
+    typedef struct
+    {
+        ne10_uint32_t pending;
+    } ne10_task_group_t;
+
+    /**
+     * A task, in memory owned by the caller so that running it does not allocate. It must
+     * stay valid until the group it was run in has been waited for. The fields are private.
+     */
+    typedef struct ne10_task_s
+    {
+        ne10_task_fn_t fn;
+        void *arg;
+        ne10_task_group_t *group;
+        struct ne10_task_s *next;
+    } ne10_task_t;
+
+    /**
+     * @brief Starts the worker threads shared by all the parallel functions of the library.
+     *
+     * @param[in]   nthreads              number of threads running tasks, the calling thread
+     *                                    included; 0 for one per CPU of affinity_mask (or per
+     *                                    online CPU if the mask is 0)
+     * @param[in]   affinity_mask         CPUs the workers may run on, bit i for CPU i, or 0 to
+     *                                    leave them to the scheduler; for example the big cores
+     *                                    of a big.LITTLE system
+     * @return      NE10_OK, or NE10_ERR if the pool is already running or the threads could
+     *              not be started
+     *
+     * The pool starts nthreads - 1 workers. Each one takes tasks from its own queue first and
+     * steals from the others when it runs out. A thread waiting for a group runs tasks too.
+     * Until the pool is started, and after it is destroyed, tasks and loops run inline on
+     * the calling thread.
+     *
+     * ne10_init starts the pool when the NE10_NUM_THREADS environment variable is set, with
+     * the affinity mask given in hexadecimal by NE10_CPU_MASK if it is set.
+     */
+    extern ne10_result_t ne10_threadpool_init (ne10_uint32_t nthreads, ne10_uint64_t affinity_mask);
+
+    /**
+     * @brief Stops the worker threads. No task may be pending.
+     */
+    extern void ne10_threadpool_destroy (void);
+
+    /**
+     * @brief Returns the number of threads running tasks, the calling thread included; 1 if the
+     * pool is not running.
+     */
+    extern ne10_uint32_t ne10_threadpool_size (void);
+
+    extern void ne10_task_group_init (ne10_task_group_t *group);
+
+    /**
+     * @brief Queues a task in a group, to call fn (arg) on one of the pool threads.
+     *
+     * If the pool is not running, or the queue of the calling worker is full, the task runs
+     * before this routine returns. Tasks may run further tasks, in the same group or others.
+     */
+    extern void ne10_task_group_run (ne10_task_group_t *group,
+                                     ne10_task_t *task,
+                                     ne10_task_fn_t fn,
+                                     void *arg);
+
+    /**
+     * @brief Returns when all the tasks of a group have finished, running queued tasks meanwhile.
+     */
+    extern void ne10_task_group_wait (ne10_task_group_t *group);
+
+    /**
+     * @brief Calls fn over the index range [begin, end) on the pool threads.
+     *
+     * @param[in]   begin, end            index range
+     * @param[in]   grain                 number of indices handed out at a time (at least 1)
+     * @param[in]   fn                    loop body
+     * @param[in]   arg                   passed to fn
+     *
+     * The range is handed out in pieces of grain indices to the calling thread and to up to
+     * ne10_threadpool_size() - 1 workers as they become free, so uneven pieces balance out.
+     * The routine returns when the whole range has been processed.
+     */
+    extern void ne10_parallel_for (ne10_uint32_t begin,
+                                   ne10_uint32_t end,
+                                   ne10_uint32_t grain,
+                                   ne10_parallel_for_fn_t fn,
+                                   void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : inc/NE10_trace.h
+ */
+
+#include <stdio.h>
+
+#include "NE10_types.h"
+
+#ifndef NE10_TRACE_H
+#define NE10_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * The counters of one dispatched function, as returned by @ref ne10_trace_snapshot.
+     *
+     * @c items is the sum of the problem sizes of the calls, in the unit of the function
+     * (elements, samples, FFT points or pixels). @c ticks is the time spent in the calls,
+     * in the units of @ref ne10_trace_ticks_per_second.
+     */
+    typedef struct
+    {
+        const char *name;
+        ne10_uint64_t calls;
+        ne10_uint64_t items;
+        ne10_uint64_t ticks;
+    } ne10_trace_entry_t;
+
+    /**
+     * @brief Reads the counters of all the traced functions.
+     *
+     * @param[out]  *entries              array receiving the counters, may be NULL if capacity is 0
+     * @param[in]   capacity              number of entries the array can hold
+     * @return      number of traced functions
+     *
+     * The counters are summed over all the threads that have called a traced function,
+     * and are relative to the last call to @ref ne10_trace_reset. The snapshot may run
+     * while other threads make calls; each counter is read atomically, but a call in
+     * progress may be counted in some counters and not yet in others.
+     *
+     * Without the NE10_ENABLE_TRACE build option, there are no traced functions and this
+     * routine returns 0.
+     */
+    extern ne10_uint32_t ne10_trace_snapshot (ne10_trace_entry_t *entries, ne10_uint32_t capacity);
+
+    /**
+     * @brief Sets all the counters to zero.
+     *
+     * The counters keep running; the reset records their current totals, which the later
+     * snapshots subtract. It must not run at the same time as @ref ne10_trace_snapshot.
+     */
+    extern void ne10_trace_reset (void);
+
+    /**
+     * @brief Returns the number of ticks per second of the trace counters.
+     *
+     * The ticks are the time stamp counter on x86, the generic timer on AArch64, and
+     * nanoseconds elsewhere. The time stamp counter frequency is estimated from the time
+     * elapsed since @ref ne10_init, so it is more accurate late in a run.
+     */
+    extern ne10_float64_t ne10_trace_ticks_per_second (void);
+
+    /**
+     * @brief Writes the counters of the functions that have been called, as JSON.
+     *
+     * @param[in]   *file                 stream to write to
+     * @return      NE10_OK, or NE10_ERR if tracing is not built in or the write failed
+     */
+    extern ne10_result_t ne10_trace_dump_json (FILE *file);
+
+    /**
+     * These routines are called at the end of the matching ne10_init_<module> when the
+     * library is built with NE10_ENABLE_TRACE. Each replaces the function pointers of the
+     * module with wrappers that count the calls into the bound implementations.
+     */
+    extern void ne10_trace_wrap_math (void);
+    extern void ne10_trace_wrap_dsp (void);
+    extern void ne10_trace_wrap_imgproc (void);
+    extern void ne10_trace_wrap_physics (void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -111,6 +111,41 @@ typedef struct
     ne10_float32_t w;
 } ne10_vec4f_t;
 
+/**
+ * @brief Structure-of-arrays form of an array of 3D vectors: vector i is
+ * (x[i], y[i], z[i]).
+ */
+typedef struct
+{
+    ne10_float32_t *x;
+    ne10_float32_t *y;
+    ne10_float32_t *z;
+} ne10_vec3f_soa_t;
+
+/**
+ * @brief Structure-of-arrays form of an array of 4D vectors: vector i is
+ * (x[i], y[i], z[i], w[i]).
+ */
+typedef struct
+{
+    ne10_float32_t *x;
+    ne10_float32_t *y;
+    ne10_float32_t *z;
+    ne10_float32_t *w;
+} ne10_vec4f_soa_t;
+
+/**
+ * @brief A quaternion w + xi + yj + zk, with the scalar part last. Rotations
+ * are unit quaternions; q and -q are the same rotation.
+ */
+typedef struct
+{
+    ne10_float32_t x;
+    ne10_float32_t y;
+    ne10_float32_t z;
+    ne10_float32_t w;
+} ne10_quatf_t;
+
 /////////////////////////////////////////////////////////
 // definitions for matrix
 /////////////////////////////////////////////////////////
@@ -219,6 +254,55 @@ static inline void createColumnMajorMatrix4x4 (ne10_mat4x4f_t * outMat, ne10_flo
     outMat->c4.r4 = m44;
 }
 
+/**
+ * @brief Whether a general matrix operand is used as stored or transposed.
+ */
+typedef enum
+{
+    NE10_NO_TRANSPOSE = 0,
+    NE10_TRANSPOSE = 1
+} ne10_transpose_t;
+
+/////////////////////////////////////////////////////////
+// definitions for fused operation chains
+/////////////////////////////////////////////////////////
+
+/**
+ * @brief Maximum number of operations in a chain passed to ne10_chain_float.
+ */
+#define NE10_CHAIN_MAX_OPS          16
+
+/**
+ * @brief Element-wise operations of a fused chain. `x` is the running value of
+ * an element, `src[k][i]` the element of the same index in an operand array.
+ */
+typedef enum
+{
+    NE10_CHAIN_ADDC = 0,    /**< x = x + cst[0] */
+    NE10_CHAIN_SUBC,        /**< x = x - cst[0] */
+    NE10_CHAIN_RSBC,        /**< x = cst[0] - x */
+    NE10_CHAIN_MULC,        /**< x = x * cst[0] */
+    NE10_CHAIN_ADD,         /**< x = x + src[0][i] */
+    NE10_CHAIN_SUB,         /**< x = x - src[0][i] */
+    NE10_CHAIN_MUL,         /**< x = x * src[0][i] */
+    NE10_CHAIN_MLA,         /**< x = x + src[0][i] * src[1][i] */
+    NE10_CHAIN_ABS,         /**< x = |x| */
+    NE10_CHAIN_MINC,        /**< x = min (x, cst[0]) */
+    NE10_CHAIN_MAXC,        /**< x = max (x, cst[0]) */
+    NE10_CHAIN_CLAMP,       /**< x = min (max (x, cst[0]), cst[1]) */
+    NE10_CHAIN_OP_COUNT
+} ne10_chain_opcode_t;
+
+/**
+ * @brief One operation of a fused chain. Only the operands used by `op` are read.
+ */
+typedef struct
+{
+    ne10_chain_opcode_t op;
+    ne10_float32_t cst[2];          /**< Constant operands. */
+    ne10_float32_t *src[2];         /**< Operand arrays, as long as the chain's input. */
+} ne10_chain_op_t;
+
 /////////////////////////////////////////////////////////
 // definitions for fft
 /////////////////////////////////////////////////////////
@@ -440,6 +524,191 @@ typedef struct
     ne10_uint32_t y;
 } ne10_size_t;
 
+/**
+ * @brief Handling of pixels outside of the source image.
+ */
+typedef enum
+{
+    NE10_IMG_BORDER_CONSTANT = 0,   /**< Pixels outside the image take a given value. */
+    NE10_IMG_BORDER_REPLICATE       /**< Pixels outside the image take the value of the nearest edge pixel. */
+} ne10_img_border_t;
+
+/**
+ * @brief Axis of an image flip.
+ */
+typedef enum
+{
+    NE10_IMG_FLIP_HORIZONTAL = 0,   /**< Mirror every row, left to right. */
+    NE10_IMG_FLIP_VERTICAL          /**< Mirror every column, top to bottom. */
+} ne10_img_flip_t;
+
+/**
+ * @brief Interpolation mode of an image resize plan.
+ */
+typedef enum
+{
+    NE10_IMG_RESIZE_BILINEAR = 0
+} ne10_img_resize_mode_t;
+
+/**
+ * @brief Structure for the image resize plan state.
+ */
+typedef struct
+{
+    ne10_int32_t src_width;
+    ne10_int32_t src_height;
+    ne10_int32_t dst_width;
+    ne10_int32_t dst_height;
+    ne10_int32_t channels;
+    ne10_img_resize_mode_t mode;
+    ne10_int32_t ksize;         /**< Number of source rows blended into one destination row. */
+    ne10_int32_t xmin;
+    ne10_int32_t xmax;
+    ne10_int32_t bufstep;       /**< Length (in elements) of one row of the ring buffer. */
+    ne10_int32_t *xofs;         /**< Horizontal source offsets, dst_width * channels entries. */
+    ne10_int32_t *yofs;         /**< Vertical source offsets, dst_height entries. */
+    ne10_int16_t *ialpha;       /**< Horizontal fixed-point coefficients. */
+    ne10_int16_t *ibeta;        /**< Vertical fixed-point coefficients. */
+    ne10_int32_t *buffer;       /**< Ring buffer of ksize horizontally resized rows. */
+} ne10_img_resize_plan_state_t;
+
+/**
+ * @brief Plan for image resize.
+ */
+typedef ne10_img_resize_plan_state_t* ne10_img_resize_plan_t;
+
+/**
+ * @brief One level of an image pyramid.
+ */
+typedef struct
+{
+    const ne10_uint8_t *image;      /**< Gaussian level, RGBA8888 */
+    ne10_int16_t *laplacian;        /**< Laplacian residual, 4 values per pixel and size.x * 4 per row, or NULL */
+    ne10_size_t size;               /**< size of the level */
+    ne10_int32_t stride;            /**< stride of image, in bytes */
+} ne10_img_pyramid_level_t;
+
+/////////////////////////////////////////////////////////
+// definitions for physics module
+/////////////////////////////////////////////////////////
+
+/**
+ * @brief Algorithm of a broad phase.
+ */
+typedef enum
+{
+    NE10_PHYSICS_BROADPHASE_SAP = 0,    /**< Sort the boxes along x and sweep. */
+    NE10_PHYSICS_BROADPHASE_GRID        /**< Hash the boxes into a uniform grid of square cells. */
+} ne10_physics_broadphase_mode_t;
+
+/**
+ * @brief Two overlapping boxes, by their indices, with a < b.
+ */
+typedef struct
+{
+    ne10_uint32_t a;
+    ne10_uint32_t b;
+} ne10_physics_pair_t;
+
+/**
+ * @brief Cell of the grid broad phase that a box covers.
+ */
+typedef struct
+{
+    ne10_uint32_t body;
+    ne10_int32_t x;
+    ne10_int32_t y;
+} ne10_physics_grid_entry_t;
+
+/**
+ * @brief Structure for the broad phase state.
+ */
+typedef struct
+{
+    ne10_physics_broadphase_mode_t mode;
+    ne10_uint32_t capacity;         /**< Largest number of boxes. */
+    ne10_uint32_t count;            /**< Number of boxes of the previous call, 0 before the first. */
+    ne10_float32_t cell_size;       /**< Side of a grid cell. */
+    ne10_uint32_t *order;           /**< Box indices sorted by lower x, kept from one call to the next. */
+    ne10_uint32_t *order_tmp;       /**< Second buffer of the radix sort, capacity entries. */
+    ne10_uint32_t *keys;            /**< Sort keys of order, capacity entries. */
+    ne10_uint32_t *keys_tmp;        /**< Second buffer of the radix sort, capacity entries. */
+    ne10_float32_t *min_x;          /**< Bounds of the boxes in the sorted order, capacity + 4 entries, */
+    ne10_float32_t *max_x;          /**< the last 4 of which stop the sweep. */
+    ne10_float32_t *min_y;
+    ne10_float32_t *max_y;
+    ne10_uint32_t buckets;          /**< Number of hash buckets of the grid, a power of 2. */
+    ne10_uint32_t *bucket_start;    /**< First entry of each bucket, buckets + 1 entries. */
+    ne10_uint32_t entry_capacity;   /**< Number of entries allocated, grown as needed. */
+    ne10_physics_grid_entry_t *entries; /**< Cells covered by the boxes, grouped by bucket. */
+} ne10_physics_broadphase_state_t;
+
+/**
+ * @brief Broad phase, which keeps its state from one frame to the next.
+ */
+typedef ne10_physics_broadphase_state_t* ne10_physics_broadphase_t;
+
+/**
+ * @brief Contacts between pairs of bodies, one array per field.
+ */
+typedef struct
+{
+    const ne10_uint32_t *body_a;        /**< Index of the first body. */
+    const ne10_uint32_t *body_b;        /**< Index of the second body. */
+    const ne10_float32_t *normal_x;     /**< Unit normal, from body a to body b. */
+    const ne10_float32_t *normal_y;
+    const ne10_float32_t *ra_x;         /**< From the centre of mass of body a to the contact point. */
+    const ne10_float32_t *ra_y;
+    const ne10_float32_t *rb_x;         /**< From the centre of mass of body b to the contact point. */
+    const ne10_float32_t *rb_y;
+    const ne10_float32_t *friction;     /**< Friction coefficient. */
+    const ne10_float32_t *restitution;  /**< Restitution coefficient, 0 for no bounce. */
+    ne10_float32_t *normal_impulse;     /**< Accumulated impulses: the previous step's, to warm start, */
+    ne10_float32_t *tangent_impulse;    /**< replaced by this step's. */
+} ne10_physics_contacts_t;
+
+/** Contact of the empty lanes of the contact solver. */
+#define NE10_PHYSICS_SOLVER_NO_CONTACT 0xFFFFFFFFu
+
+/**
+ * @brief Structure for the contact solver state.
+ *
+ * The contacts are batched in groups of 4, none of whose lanes share a moving body, and
+ * the fields of each lane are gathered into one array each, 4 entries per group.
+ */
+typedef struct
+{
+    ne10_uint32_t max_contacts;         /**< Largest number of contacts. */
+    ne10_uint32_t max_bodies;           /**< Largest number of bodies. */
+    ne10_uint32_t group_count;          /**< Number of groups of the last step. */
+    ne10_uint32_t *contact;             /**< Contact of each lane, or NE10_PHYSICS_SOLVER_NO_CONTACT. */
+    ne10_uint32_t *body_a;              /**< Bodies of each lane, max_bodies for the empty lanes. */
+    ne10_uint32_t *body_b;
+    ne10_uint32_t *body_mask;           /**< Open groups of each body, while batching. */
+    ne10_float32_t *normal_x;
+    ne10_float32_t *normal_y;
+    ne10_float32_t *ra_x;
+    ne10_float32_t *ra_y;
+    ne10_float32_t *rb_x;
+    ne10_float32_t *rb_y;
+    ne10_float32_t *inv_mass_a;         /**< Inverse mass and inertia of the bodies of each lane. */
+    ne10_float32_t *inv_inertia_a;
+    ne10_float32_t *inv_mass_b;
+    ne10_float32_t *inv_inertia_b;
+    ne10_float32_t *normal_mass;        /**< Effective mass along the normal and the tangent. */
+    ne10_float32_t *tangent_mass;
+    ne10_float32_t *friction;
+    ne10_float32_t *velocity_bias;      /**< Normal velocity that restitution aims for. */
+    ne10_float32_t *normal_impulse;
+    ne10_float32_t *tangent_impulse;
+    ne10_float32_t *bodies;             /**< Velocity, angular velocity and 0 of each body, max_bodies + 1 entries. */
+} ne10_physics_solver_state_t;
+
+/**
+ * @brief Contact solver, which owns the memory of a step.
+ */
+typedef ne10_physics_solver_state_t* ne10_physics_solver_t;
+
 typedef enum
 {
     UBUNTU_COMMAND_LINE,
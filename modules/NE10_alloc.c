@@ -0,0 +1,185 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : modules/NE10_alloc.c
+ */
+
+#include <stdlib.h>
+
+#include "NE10.h"
+
+static void *ne10_default_alloc (size_t size, ne10_uint32_t alignment, void *context)
+{
+    void *ptr = NULL;
+
+    (void) context;
+    if (alignment < sizeof (void *))
+    {
+        alignment = sizeof (void *);
+    }
+    if (posix_memalign (&ptr, alignment, size) != 0)
+    {
+        return NULL;
+    }
+    return ptr;
+}
+
+static void ne10_default_free (void *ptr, void *context)
+{
+    (void) context;
+    free (ptr);
+}
+
+static ne10_allocator_t ne10_allocator =
+{
+    ne10_default_alloc,
+    ne10_default_free,
+    NULL
+};
+
+ne10_result_t ne10_set_allocator (const ne10_allocator_t *allocator)
+{
+    if (allocator == NULL)
+    {
+        ne10_allocator.alloc = ne10_default_alloc;
+        ne10_allocator.free = ne10_default_free;
+        ne10_allocator.context = NULL;
+        return NE10_OK;
+    }
+    if (allocator->alloc == NULL || allocator->free == NULL)
+    {
+        return NE10_ERR;
+    }
+    ne10_allocator = *allocator;
+    return NE10_OK;
+}
+
+void ne10_get_allocator (ne10_allocator_t *allocator)
+{
+    *allocator = ne10_allocator;
+}
+
+void *ne10_malloc (size_t size)
+{
+    return ne10_allocator.alloc (size, NE10_MEMORY_ALIGNMENT, ne10_allocator.context);
+}
+
+void ne10_free (void *ptr)
+{
+    if (ptr != NULL)
+    {
+        ne10_allocator.free (ptr, ne10_allocator.context);
+    }
+}
+
+/*
+ * Each arena block is preceded by its header, which records the top of the arena before and
+ * after the block was allocated. A free moves the top back only if it is still at the end of
+ * the block, so the top is a single word updated by compare-and-swap and no lock is needed.
+ */
+typedef struct
+{
+    ne10_uint32_t start;
+    ne10_uint32_t end;
+} ne10_arena_block_t;
+
+static void *ne10_arena_alloc (size_t size, ne10_uint32_t alignment, void *context)
+{
+    ne10_arena_t *arena = (ne10_arena_t *) context;
+    uintptr_t base = (uintptr_t) arena->base;
+    uintptr_t address;
+    ne10_uint32_t used, offset, end, peak;
+    ne10_arena_block_t *block;
+
+    if (alignment < sizeof (ne10_arena_block_t))
+    {
+        alignment = sizeof (ne10_arena_block_t);
+    }
+
+    used = __atomic_load_n (&arena->used, __ATOMIC_RELAXED);
+    do
+    {
+        address = base + used + sizeof (ne10_arena_block_t);
+        NE10_BYTE_ALIGNMENT (address, (uintptr_t) alignment);
+        offset = (ne10_uint32_t) (address - base);
+        if (address - base > arena->size || size > arena->size - offset)
+        {
+            return NULL;
+        }
+        end = offset + (ne10_uint32_t) size;
+    }
+    while (!__atomic_compare_exchange_n (&arena->used, &used, end, 1,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    block = (ne10_arena_block_t *) address - 1;
+    block->start = used;
+    block->end = end;
+
+    peak = __atomic_load_n (&arena->peak, __ATOMIC_RELAXED);
+    while (peak < end && !__atomic_compare_exchange_n (&arena->peak, &peak, end, 1,
+            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+    return (void *) address;
+}
+
+static void ne10_arena_free (void *ptr, void *context)
+{
+    ne10_arena_t *arena = (ne10_arena_t *) context;
+    ne10_arena_block_t *block = (ne10_arena_block_t *) ptr - 1;
+    ne10_uint32_t top = block->end;
+
+    // Fails, keeping the memory until the next reset, if a later block is still allocated
+    __atomic_compare_exchange_n (&arena->used, &top, block->start, 0,
+                                 __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+ne10_result_t ne10_arena_init (ne10_arena_t *arena, void *buffer, ne10_uint32_t size)
+{
+    if (buffer == NULL)
+    {
+        return NE10_ERR;
+    }
+    arena->base = (ne10_uint8_t *) buffer;
+    arena->size = size;
+    arena->used = 0;
+    arena->peak = 0;
+    return NE10_OK;
+}
+
+void ne10_arena_reset (ne10_arena_t *arena)
+{
+    __atomic_store_n (&arena->used, 0, __ATOMIC_RELEASE);
+}
+
+void ne10_arena_allocator (ne10_allocator_t *allocator, ne10_arena_t *arena)
+{
+    allocator->alloc = ne10_arena_alloc;
+    allocator->free = ne10_arena_free;
+    allocator->context = arena;
+}
@@ -26,62 +26,237 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 
 #include "NE10.h"
 
-#define CPUINFO_BUFFER_SIZE  (1024*4)
+#if defined (NE10_ENABLE_X86)
+#include <cpuid.h>
+#elif !defined (__MACH__)
+// getauxval is in glibc 2.16 and later, and in Bionic from API level 18
+#if !defined (__ANDROID__) || (__ANDROID_API__ >= 18)
+#define NE10_HAVE_GETAUXVAL
+#include <sys/auxv.h>
+#endif
+#endif
+
+#define CPUINFO_LINE_SIZE  1024
 
 // This local variable indicates whether or not the running platform supports ARM NEON
 ne10_result_t is_NEON_available = NE10_ERR;
 
+// These local variables indicate whether or not the running platform supports SSE4.1 and AVX2
+ne10_result_t is_SSE41_available = NE10_ERR;
+ne10_result_t is_AVX2_available = NE10_ERR;
+
+// The features the function pointers were last initialized for
+static ne10_cpu_features_t ne10_cpu_features;
+
 ne10_result_t ne10_HasNEON()
 {
     return is_NEON_available;
 }
 
-ne10_result_t ne10_init()
+ne10_result_t ne10_HasSSE41()
 {
-    ne10_result_t status = NE10_ERR;
-#ifndef __MACH__
-    FILE*   infofile = NULL;               // To open the file /proc/cpuinfo
-    ne10_int8_t    cpuinfo[CPUINFO_BUFFER_SIZE];  // The buffer to read in the string
-    ne10_uint32_t  bytes = 0;                     // Numbers of bytes read from the file
-    ne10_int32_t     i = 0;                         // Temporary loop counter
+    return is_SSE41_available;
+}
 
-    memset (cpuinfo, 0, CPUINFO_BUFFER_SIZE);
-    infofile = fopen ("/proc/cpuinfo", "r");
+ne10_result_t ne10_HasAVX2()
+{
+    return is_AVX2_available;
+}
+
+const ne10_cpu_features_t *ne10_get_cpu_features (void)
+{
+    return &ne10_cpu_features;
+}
+
+void ne10_cpu_features_from_hwcap (ne10_cpu_features_t *features,
+                                   ne10_uint64_t hwcap)
+{
+    memset (features, 0, sizeof (ne10_cpu_features_t));
+#if defined (__aarch64__)
+    features->asimd = (hwcap & NE10_HWCAP_ASIMD) != 0;
+    features->neon = features->asimd;
+#else
+    features->neon = (hwcap & NE10_HWCAP_NEON) != 0;
+#endif
+}
+
+#if defined (NE10_ENABLE_X86)
+static ne10_result_t ne10_detect_features (ne10_cpu_features_t *features)
+{
+    unsigned int eax, ebx, ecx, edx;
+    unsigned int xcr0_lo, xcr0_hi;
+
+    memset (features, 0, sizeof (ne10_cpu_features_t));
+    if (!__get_cpuid (1, &eax, &ebx, &ecx, &edx))
+    {
+        return NE10_OK;
+    }
+
+    features->sse41 = (ecx & bit_SSE4_1) != 0;
+
+    // AVX2 also needs the OS to save the YMM registers on context switches
+    if (! (ecx & bit_OSXSAVE) || ! (ecx & bit_AVX))
+    {
+        return NE10_OK;
+    }
+    __asm__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+    if ( (xcr0_lo & 0x6) != 0x6)
+    {
+        return NE10_OK;
+    }
+
+    if (__get_cpuid_count (7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_AVX2))
+    {
+        features->avx2 = 1;
+    }
+    return NE10_OK;
+}
+#elif defined (__MACH__)
+static ne10_result_t ne10_detect_features (ne10_cpu_features_t *features)
+{
+    // Every ARM CPU supported by iOS has NEON
+    memset (features, 0, sizeof (ne10_cpu_features_t));
+    features->neon = 1;
+#if defined (__aarch64__)
+    features->asimd = 1;
+#endif
+    return NE10_OK;
+}
+#else // Linux and Android
 
+// The names of the capability bits in the "Features" lines of /proc/cpuinfo
+typedef struct
+{
+    const char *name;
+    ne10_uint64_t hwcap;
+} ne10_hwcap_name_t;
+
+static const ne10_hwcap_name_t ne10_hwcap_names[] =
+{
+#if defined (__aarch64__)
+    { "asimd", NE10_HWCAP_ASIMD },
+#else
+    { "neon", NE10_HWCAP_NEON },
+    // An AArch64 kernel lists the AArch64 names for AArch32 processes
+    { "asimd", NE10_HWCAP_NEON },
+#endif
+    { NULL, 0 }
+};
+
+/*
+ * Reads the capability bits from the "Features" lines of /proc/cpuinfo, for the systems
+ * without getauxval. The file is read line by line, as its size grows with the number of
+ * cores.
+ */
+static ne10_result_t ne10_read_cpuinfo_hwcap (ne10_uint64_t *hwcap)
+{
+    FILE *infofile = NULL;
+    char line[CPUINFO_LINE_SIZE];
+    char *token;
+    char *saveptr = NULL;
+    ne10_int32_t i;
+
+    *hwcap = 0;
+    infofile = fopen ("/proc/cpuinfo", "r");
     if (!infofile)
     {
-        fprintf(stderr, "ERROR: couldn't read file \"/proc/cpuinfo\".\n");
+        fprintf (stderr, "ERROR: couldn't read file \"/proc/cpuinfo\".\n");
         return NE10_ERR;
     }
 
-    bytes    = fread (cpuinfo, 1, sizeof (cpuinfo), infofile);
+    while (fgets (line, sizeof (line), infofile) != NULL)
+    {
+        for (i = 0; line[i] != '\0'; i++)
+        {
+            line[i] = (char) tolower ((unsigned char) line[i]);
+        }
+        if (strncmp (line, "features", 8) != 0 || strchr (line, ':') == NULL)
+        {
+            continue;
+        }
+
+        for (token = strtok_r (strchr (line, ':') + 1, " \t\n", &saveptr);
+             token != NULL;
+             token = strtok_r (NULL, " \t\n", &saveptr))
+        {
+            for (i = 0; ne10_hwcap_names[i].name != NULL; i++)
+            {
+                if (strcmp (token, ne10_hwcap_names[i].name) == 0)
+                {
+                    *hwcap |= ne10_hwcap_names[i].hwcap;
+                }
+            }
+        }
+    }
     fclose (infofile);
+    return NE10_OK;
+}
 
-    if (0 == bytes || CPUINFO_BUFFER_SIZE == bytes)
+static ne10_result_t ne10_detect_features (ne10_cpu_features_t *features)
+{
+    ne10_uint64_t hwcap = 0;
+
+#if defined (NE10_HAVE_GETAUXVAL)
+    hwcap = getauxval (AT_HWCAP);
+#endif
+    // Without getauxval, or with a kernel that does not pass the capabilities
+    if (hwcap == 0 && ne10_read_cpuinfo_hwcap (&hwcap) != NE10_OK)
     {
-        fprintf (stderr, "ERROR: Couldn't read the file \"/proc/cpuinfo\". NE10_init() failed.\n");
+        fprintf (stderr, "ERROR: Couldn't read the CPU features. NE10_init() failed.\n");
         return NE10_ERR;
     }
+    ne10_cpu_features_from_hwcap (features, hwcap);
+    return NE10_OK;
+}
+#endif // NE10_ENABLE_X86, __MACH__
+
+// Starts the thread pool if NE10_NUM_THREADS is set; without it, the tasks run inline
+static void ne10_init_threadpool (void)
+{
+    const char *threads = getenv ("NE10_NUM_THREADS");
+    const char *mask = getenv ("NE10_CPU_MASK");
 
-    while ('\0' != cpuinfo[i])
+    if (threads == NULL || ne10_threadpool_size () > 1)
+    {
+        return;
+    }
+    if (ne10_threadpool_init ( (ne10_uint32_t) strtoul (threads, NULL, 10),
+                               (mask != NULL) ? strtoull (mask, NULL, 16) : 0) != NE10_OK)
     {
-        cpuinfo[i] = (ne10_int8_t) tolower (cpuinfo[i]);
-        ++i;
+        fprintf (stderr, "WARNING: couldn't start the thread pool, running on one thread.\n");
     }
+}
 
-    if (strstr ((const char *)cpuinfo, "neon") != NULL ||
-        strstr ((const char *)cpuinfo, "asimd") != NULL)
+ne10_result_t ne10_init()
+{
+    ne10_cpu_features_t features;
+
+    if (ne10_detect_features (&features) != NE10_OK)
     {
-        is_NEON_available = NE10_OK;
+        return NE10_ERR;
     }
-#else  //__MACH__
-    is_NEON_available = NE10_OK;
-#endif //__MACH__
+    if (ne10_init_features (&features) != NE10_OK)
+    {
+        return NE10_ERR;
+    }
+    ne10_init_threadpool ();
+    return NE10_OK;
+}
+
+ne10_result_t ne10_init_features (const ne10_cpu_features_t *features)
+{
+    ne10_result_t status = NE10_ERR;
+
+    ne10_cpu_features = *features;
+    is_NEON_available = features->neon ? NE10_OK : NE10_ERR;
+    is_SSE41_available = features->sse41 ? NE10_OK : NE10_ERR;
+    is_AVX2_available = features->avx2 ? NE10_OK : NE10_ERR;
 
 #if defined (NE10_ENABLE_MATH)
     status = ne10_init_math (is_NEON_available);
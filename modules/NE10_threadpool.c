@@ -0,0 +1,559 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : modules/NE10_threadpool.c
+ */
+
+/*
+ * The worker threads shared by the parallel functions.
+ *
+ * Each worker owns a fixed-size work-stealing deque (Chase and Lev, with the memory
+ * orderings of Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models"):
+ * the owner pushes and pops at the bottom without a lock, and the other threads steal
+ * from the top with a compare-and-swap. Threads that are not workers queue their tasks on a
+ * shared list under a mutex. Idle workers spin for a while and then sleep on a condition
+ * variable until a task is queued.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "NE10.h"
+
+// Tasks a worker can queue before further ones run inline; a power of two
+#define NE10_DEQUE_SIZE 1024
+#define NE10_DEQUE_MASK (NE10_DEQUE_SIZE - 1)
+
+// Failed searches for a task before an idle worker goes to sleep
+#define NE10_IDLE_SPINS 256
+
+typedef struct
+{
+    // top is written by thieves and bottom by the owner; they are kept on separate lines
+    ne10_int64_t top __attribute__ ( (aligned (NE10_MEMORY_ALIGNMENT)));
+    ne10_int64_t bottom __attribute__ ( (aligned (NE10_MEMORY_ALIGNMENT)));
+    ne10_task_t *slots[NE10_DEQUE_SIZE] __attribute__ ( (aligned (NE10_MEMORY_ALIGNMENT)));
+    pthread_t thread;
+    ne10_uint32_t index;
+} ne10_worker_t;
+
+typedef struct
+{
+    ne10_worker_t *workers;
+    ne10_uint32_t worker_count;
+    ne10_uint32_t started;
+    ne10_uint32_t threads;
+    ne10_uint64_t affinity_mask;
+
+    // Tasks queued by threads that are not workers
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    ne10_task_t *queue_head;
+    ne10_task_t *queue_tail;
+    ne10_uint32_t queued;
+
+    ne10_uint32_t sleepers;
+    ne10_uint32_t epoch;
+    ne10_uint32_t shutdown;
+} ne10_threadpool_t;
+
+static ne10_threadpool_t ne10_pool =
+{
+    NULL, 0, 0, 0, 0,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL, 0,
+    0, 0, 0
+};
+
+// The worker running on this thread, NULL for other threads
+static __thread ne10_worker_t *ne10_self = NULL;
+
+static ne10_int32_t ne10_deque_push (ne10_worker_t *worker, ne10_task_t *task)
+{
+    ne10_int64_t bottom = __atomic_load_n (&worker->bottom, __ATOMIC_RELAXED);
+    ne10_int64_t top = __atomic_load_n (&worker->top, __ATOMIC_ACQUIRE);
+
+    if (bottom - top >= NE10_DEQUE_SIZE)
+    {
+        return 0;
+    }
+    __atomic_store_n (&worker->slots[bottom & NE10_DEQUE_MASK], task, __ATOMIC_RELAXED);
+    __atomic_thread_fence (__ATOMIC_RELEASE);
+    __atomic_store_n (&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+    return 1;
+}
+
+static ne10_task_t *ne10_deque_pop (ne10_worker_t *worker)
+{
+    ne10_int64_t bottom = __atomic_load_n (&worker->bottom, __ATOMIC_RELAXED) - 1;
+    ne10_int64_t top;
+    ne10_task_t *task = NULL;
+
+    __atomic_store_n (&worker->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+    top = __atomic_load_n (&worker->top, __ATOMIC_RELAXED);
+    if (top <= bottom)
+    {
+        task = __atomic_load_n (&worker->slots[bottom & NE10_DEQUE_MASK], __ATOMIC_RELAXED);
+        if (top == bottom)
+        {
+            // The last task: race the thieves for it
+            if (!__atomic_compare_exchange_n (&worker->top, &top, top + 1, 0,
+                                              __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+            {
+                task = NULL;
+            }
+            __atomic_store_n (&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+        }
+    }
+    else
+    {
+        __atomic_store_n (&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+    return task;
+}
+
+static ne10_task_t *ne10_deque_steal (ne10_worker_t *worker)
+{
+    ne10_int64_t top = __atomic_load_n (&worker->top, __ATOMIC_ACQUIRE);
+    ne10_int64_t bottom;
+    ne10_task_t *task;
+
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+    bottom = __atomic_load_n (&worker->bottom, __ATOMIC_ACQUIRE);
+    if (top >= bottom)
+    {
+        return NULL;
+    }
+    task = __atomic_load_n (&worker->slots[top & NE10_DEQUE_MASK], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n (&worker->top, &top, top + 1, 0,
+                                      __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+    {
+        return NULL;
+    }
+    return task;
+}
+
+static void ne10_queue_push (ne10_task_t *task)
+{
+    task->next = NULL;
+    pthread_mutex_lock (&ne10_pool.lock);
+    if (ne10_pool.queue_tail != NULL)
+    {
+        ne10_pool.queue_tail->next = task;
+    }
+    else
+    {
+        ne10_pool.queue_head = task;
+    }
+    ne10_pool.queue_tail = task;
+    __atomic_store_n (&ne10_pool.queued, ne10_pool.queued + 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock (&ne10_pool.lock);
+}
+
+static ne10_task_t *ne10_queue_pop (void)
+{
+    ne10_task_t *task;
+
+    if (__atomic_load_n (&ne10_pool.queued, __ATOMIC_SEQ_CST) == 0)
+    {
+        return NULL;
+    }
+    pthread_mutex_lock (&ne10_pool.lock);
+    task = ne10_pool.queue_head;
+    if (task != NULL)
+    {
+        ne10_pool.queue_head = task->next;
+        if (ne10_pool.queue_head == NULL)
+        {
+            ne10_pool.queue_tail = NULL;
+        }
+        __atomic_store_n (&ne10_pool.queued, ne10_pool.queued - 1, __ATOMIC_SEQ_CST);
+    }
+    pthread_mutex_unlock (&ne10_pool.lock);
+    return task;
+}
+
+static ne10_task_t *ne10_find_task (ne10_worker_t *self)
+{
+    ne10_task_t *task;
+    ne10_uint32_t i, start;
+
+    if (self != NULL && (task = ne10_deque_pop (self)) != NULL)
+    {
+        return task;
+    }
+    if ( (task = ne10_queue_pop ()) != NULL)
+    {
+        return task;
+    }
+
+    // Steal, starting from the next worker so that the thieves spread out
+    start = (self != NULL) ? self->index + 1 : 0;
+    for (i = 0; i < ne10_pool.worker_count; i++)
+    {
+        ne10_worker_t *victim = &ne10_pool.workers[ (start + i) % ne10_pool.worker_count];
+        if (victim != self && (task = ne10_deque_steal (victim)) != NULL)
+        {
+            return task;
+        }
+    }
+    return NULL;
+}
+
+static void ne10_run_task (ne10_task_t *task)
+{
+    ne10_task_group_t *group = task->group;
+
+    // The task may be freed by its owner as soon as the group count drops
+    task->fn (task->arg);
+    __atomic_sub_fetch (&group->pending, 1, __ATOMIC_ACQ_REL);
+}
+
+static void ne10_wake_one (void)
+{
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+    if (__atomic_load_n (&ne10_pool.sleepers, __ATOMIC_SEQ_CST) != 0)
+    {
+        pthread_mutex_lock (&ne10_pool.lock);
+        ne10_pool.epoch++;
+        pthread_cond_signal (&ne10_pool.wake);
+        pthread_mutex_unlock (&ne10_pool.lock);
+    }
+}
+
+static void ne10_set_affinity (ne10_uint64_t mask)
+{
+#if defined (__linux__)
+    cpu_set_t set;
+    ne10_uint32_t cpu;
+
+    if (mask == 0)
+    {
+        return;
+    }
+    CPU_ZERO (&set);
+    for (cpu = 0; cpu < 64; cpu++)
+    {
+        if (mask & (1ULL << cpu))
+        {
+            CPU_SET (cpu, &set);
+        }
+    }
+    // A failure (CPUs that are offline or not allowed) leaves the thread unpinned
+    sched_setaffinity (0, sizeof (set), &set);
+#else
+    (void) mask;
+#endif
+}
+
+static void *ne10_worker_main (void *arg)
+{
+    ne10_worker_t *self = (ne10_worker_t *) arg;
+    ne10_task_t *task;
+    ne10_uint32_t spins = 0;
+    ne10_uint32_t epoch;
+
+    ne10_self = self;
+    ne10_set_affinity (ne10_pool.affinity_mask);
+
+    while (!__atomic_load_n (&ne10_pool.shutdown, __ATOMIC_ACQUIRE))
+    {
+        task = ne10_find_task (self);
+        if (task != NULL)
+        {
+            ne10_run_task (task);
+            spins = 0;
+            continue;
+        }
+        if (++spins < NE10_IDLE_SPINS)
+        {
+            sched_yield ();
+            continue;
+        }
+
+        // Announce the sleep before the last look, so that a task queued meanwhile wakes us
+        pthread_mutex_lock (&ne10_pool.lock);
+        epoch = ne10_pool.epoch;
+        __atomic_add_fetch (&ne10_pool.sleepers, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock (&ne10_pool.lock);
+
+        task = ne10_find_task (self);
+
+        pthread_mutex_lock (&ne10_pool.lock);
+        if (task == NULL)
+        {
+            while (ne10_pool.epoch == epoch && !ne10_pool.shutdown)
+            {
+                pthread_cond_wait (&ne10_pool.wake, &ne10_pool.lock);
+            }
+        }
+        __atomic_sub_fetch (&ne10_pool.sleepers, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock (&ne10_pool.lock);
+
+        if (task != NULL)
+        {
+            ne10_run_task (task);
+        }
+        spins = 0;
+    }
+    return NULL;
+}
+
+static ne10_uint32_t ne10_count_cpus (ne10_uint64_t mask)
+{
+    ne10_uint32_t count = 0;
+    long online;
+
+    if (mask != 0)
+    {
+        for (; mask != 0; mask &= mask - 1)
+        {
+            count++;
+        }
+        return count;
+    }
+    online = sysconf (_SC_NPROCESSORS_ONLN);
+    return (online > 0) ? (ne10_uint32_t) online : 1;
+}
+
+ne10_result_t ne10_threadpool_init (ne10_uint32_t nthreads, ne10_uint64_t affinity_mask)
+{
+    ne10_uint32_t i;
+
+    if (ne10_pool.threads != 0)
+    {
+        return NE10_ERR;
+    }
+    if (nthreads == 0)
+    {
+        nthreads = ne10_count_cpus (affinity_mask);
+    }
+    nthreads = NE10_MIN (nthreads, NE10_THREADPOOL_MAX_THREADS);
+    if (nthreads <= 1)
+    {
+        return NE10_OK;
+    }
+
+    ne10_pool.workers = (ne10_worker_t *) NE10_MALLOC ( (nthreads - 1) * sizeof (ne10_worker_t));
+    if (ne10_pool.workers == NULL)
+    {
+        return NE10_ERR;
+    }
+    memset (ne10_pool.workers, 0, (nthreads - 1) * sizeof (ne10_worker_t));
+    ne10_pool.affinity_mask = affinity_mask;
+    ne10_pool.shutdown = 0;
+    // The deques of workers that fail to start stay empty, so the others can look at them all
+    ne10_pool.worker_count = nthreads - 1;
+    ne10_pool.started = 0;
+    __atomic_store_n (&ne10_pool.threads, nthreads, __ATOMIC_RELEASE);
+
+    for (i = 0; i < nthreads - 1; i++)
+    {
+        ne10_pool.workers[i].index = i;
+        if (pthread_create (&ne10_pool.workers[i].thread, NULL, ne10_worker_main, &ne10_pool.workers[i]) != 0)
+        {
+            ne10_threadpool_destroy ();
+            return NE10_ERR;
+        }
+        ne10_pool.started++;
+    }
+    return NE10_OK;
+}
+
+void ne10_threadpool_destroy (void)
+{
+    ne10_uint32_t i;
+
+    if (ne10_pool.threads == 0)
+    {
+        return;
+    }
+
+    pthread_mutex_lock (&ne10_pool.lock);
+    __atomic_store_n (&ne10_pool.shutdown, 1, __ATOMIC_RELEASE);
+    pthread_cond_broadcast (&ne10_pool.wake);
+    pthread_mutex_unlock (&ne10_pool.lock);
+
+    for (i = 0; i < ne10_pool.started; i++)
+    {
+        pthread_join (ne10_pool.workers[i].thread, NULL);
+    }
+    NE10_FREE (ne10_pool.workers);
+    ne10_pool.worker_count = 0;
+    ne10_pool.started = 0;
+    __atomic_store_n (&ne10_pool.threads, 0, __ATOMIC_RELEASE);
+}
+
+ne10_uint32_t ne10_threadpool_size (void)
+{
+    ne10_uint32_t threads = __atomic_load_n (&ne10_pool.threads, __ATOMIC_ACQUIRE);
+    return (threads != 0) ? threads : 1;
+}
+
+void ne10_task_group_init (ne10_task_group_t *group)
+{
+    group->pending = 0;
+}
+
+void ne10_task_group_run (ne10_task_group_t *group,
+                          ne10_task_t *task,
+                          ne10_task_fn_t fn,
+                          void *arg)
+{
+    ne10_worker_t *self = ne10_self;
+
+    if (__atomic_load_n (&ne10_pool.threads, __ATOMIC_ACQUIRE) == 0)
+    {
+        fn (arg);
+        return;
+    }
+
+    task->fn = fn;
+    task->arg = arg;
+    task->group = group;
+    __atomic_add_fetch (&group->pending, 1, __ATOMIC_RELAXED);
+    if (self != NULL)
+    {
+        if (!ne10_deque_push (self, task))
+        {
+            ne10_run_task (task);
+            return;
+        }
+    }
+    else
+    {
+        ne10_queue_push (task);
+    }
+    ne10_wake_one ();
+}
+
+void ne10_task_group_wait (ne10_task_group_t *group)
+{
+    ne10_worker_t *self = ne10_self;
+    ne10_task_t *task;
+
+    while (__atomic_load_n (&group->pending, __ATOMIC_ACQUIRE) != 0)
+    {
+        task = ne10_find_task (self);
+        if (task != NULL)
+        {
+            ne10_run_task (task);
+        }
+        else
+        {
+            sched_yield ();
+        }
+    }
+}
+
+typedef struct
+{
+    ne10_uint64_t next;
+    ne10_uint64_t end;
+    ne10_uint32_t grain;
+    ne10_parallel_for_fn_t fn;
+    void *arg;
+} ne10_parallel_loop_t;
+
+typedef struct
+{
+    ne10_parallel_loop_t *loop;
+    ne10_uint32_t slot;
+} ne10_parallel_slot_t;
+
+static void ne10_parallel_for_task (void *arg)
+{
+    ne10_parallel_slot_t *slot = (ne10_parallel_slot_t *) arg;
+    ne10_parallel_loop_t *loop = slot->loop;
+    ne10_uint64_t begin;
+
+    for (;;)
+    {
+        begin = __atomic_fetch_add (&loop->next, loop->grain, __ATOMIC_RELAXED);
+        if (begin >= loop->end)
+        {
+            break;
+        }
+        loop->fn ( (ne10_uint32_t) begin, (ne10_uint32_t) NE10_MIN (begin + loop->grain, loop->end),
+                   slot->slot, loop->arg);
+    }
+}
+
+void ne10_parallel_for (ne10_uint32_t begin,
+                        ne10_uint32_t end,
+                        ne10_uint32_t grain,
+                        ne10_parallel_for_fn_t fn,
+                        void *arg)
+{
+    ne10_parallel_loop_t loop;
+    ne10_parallel_slot_t slots[NE10_THREADPOOL_MAX_THREADS];
+    ne10_task_t tasks[NE10_THREADPOOL_MAX_THREADS];
+    ne10_task_group_t group;
+    ne10_uint32_t pieces, participants, i;
+
+    if (end <= begin)
+    {
+        return;
+    }
+    if (grain == 0)
+    {
+        grain = 1;
+    }
+    pieces = (ne10_uint32_t) ( ( (ne10_uint64_t) end - begin + grain - 1) / grain);
+    participants = NE10_MIN (ne10_threadpool_size (), pieces);
+    if (participants <= 1)
+    {
+        fn (begin, end, 0, arg);
+        return;
+    }
+
+    loop.next = begin;
+    loop.end = end;
+    loop.grain = grain;
+    loop.fn = fn;
+    loop.arg = arg;
+
+    // The calling thread takes slot 0 and works on the loop while the workers join in
+    ne10_task_group_init (&group);
+    for (i = 0; i < participants; i++)
+    {
+        slots[i].loop = &loop;
+        slots[i].slot = i;
+    }
+    for (i = 1; i < participants; i++)
+    {
+        ne10_task_group_run (&group, &tasks[i], ne10_parallel_for_task, &slots[i]);
+    }
+    ne10_parallel_for_task (&slots[0]);
+    ne10_task_group_wait (&group);
+}
@@ -0,0 +1,604 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : modules/NE10_trace.c
+ */
+
+/*
+ * Call counters for the dispatched functions.
+ *
+ * With NE10_ENABLE_TRACE, ne10_init_<module> finishes by calling ne10_trace_wrap_<module>,
+ * which moves each function pointer that was bound into a private pointer and replaces it
+ * with a wrapper of the same signature. The wrapper reads a tick counter, calls the bound
+ * implementation, and adds the call, its problem size and its duration to counters owned
+ * by the calling thread, so that no locks or shared cache lines are written on the call
+ * path. The per-thread counters are linked into a list when a thread makes its first
+ * traced call and summed when a snapshot is taken.
+ *
+ * Without NE10_ENABLE_TRACE, only the stubs at the end of this file are built, and the
+ * function pointers are left as they are.
+ */
+
+#include "NE10.h"
+
+#if defined (NE10_ENABLE_TRACE)
+
+#include <time.h>
+
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h>
+#endif
+
+/*
+ * The traced functions of each module, with
+ *     R (return type, name, (parameters), (arguments), problem size) for functions returning a value,
+ *     V (name, (parameters), (arguments), problem size) for functions returning void.
+ * The problem size is evaluated before the call.
+ */
+#if defined (NE10_ENABLE_MATH)
+#define NE10_TRACE_LIST_MATH(R, V) \
+    R (ne10_result_t, ne10_addc_float, (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_addc_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src, const ne10_vec2f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_addc_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src, const ne10_vec3f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_addc_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src, const ne10_vec4f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_add_float, (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_add_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_add_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_add_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_addmat_4x4f, (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src1, ne10_mat4x4f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_addmat_3x3f, (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src1, ne10_mat3x3f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_addmat_2x2f, (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src1, ne10_mat2x2f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_subc_float, (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_subc_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src, const ne10_vec2f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_subc_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src, const ne10_vec3f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_subc_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src, const ne10_vec4f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_sub_float, (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_sub_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_sub_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_sub_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_rsbc_float, (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_rsbc_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src, const ne10_vec2f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_rsbc_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src, const ne10_vec3f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_rsbc_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src, const ne10_vec4f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_submat_4x4f, (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src1, ne10_mat4x4f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_submat_3x3f, (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src1, ne10_mat3x3f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_submat_2x2f, (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src1, ne10_mat2x2f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_mulc_float, (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_mulc_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src, const ne10_vec2f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_mulc_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src, const ne10_vec3f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_mulc_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src, const ne10_vec4f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_mul_float, (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_vmul_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_vmul_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_vmul_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_mlac_float, (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count), (dst, acc, src, cst, count), count) \
+    R (ne10_result_t, ne10_mlac_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * acc, ne10_vec2f_t * src, const ne10_vec2f_t * cst, ne10_uint32_t count), (dst, acc, src, cst, count), count) \
+    R (ne10_result_t, ne10_mlac_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * acc, ne10_vec3f_t * src, const ne10_vec3f_t * cst, ne10_uint32_t count), (dst, acc, src, cst, count), count) \
+    R (ne10_result_t, ne10_mlac_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * acc, ne10_vec4f_t * src, const ne10_vec4f_t * cst, ne10_uint32_t count), (dst, acc, src, cst, count), count) \
+    R (ne10_result_t, ne10_mla_float, (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count), (dst, acc, src1, src2, count), count) \
+    R (ne10_result_t, ne10_vmla_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * acc, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count), (dst, acc, src1, src2, count), count) \
+    R (ne10_result_t, ne10_vmla_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * acc, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count), (dst, acc, src1, src2, count), count) \
+    R (ne10_result_t, ne10_vmla_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * acc, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count), (dst, acc, src1, src2, count), count) \
+    R (ne10_result_t, ne10_mulmat_4x4f, (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src1, ne10_mat4x4f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_mulmat_3x3f, (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src1, ne10_mat3x3f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_mulmat_2x2f, (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src1, ne10_mat2x2f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_mulcmatvec_cm4x4f_v4f, (ne10_vec4f_t * dst, const ne10_mat4x4f_t * cst, ne10_vec4f_t * src, ne10_uint32_t count), (dst, cst, src, count), count) \
+    R (ne10_result_t, ne10_mulcmatvec_cm3x3f_v3f, (ne10_vec3f_t * dst, const ne10_mat3x3f_t * cst, ne10_vec3f_t * src, ne10_uint32_t count), (dst, cst, src, count), count) \
+    R (ne10_result_t, ne10_mulcmatvec_cm2x2f_v2f, (ne10_vec2f_t * dst, const ne10_mat2x2f_t * cst, ne10_vec2f_t * src, ne10_uint32_t count), (dst, cst, src, count), count) \
+    R (ne10_result_t, ne10_divc_float, (ne10_float32_t * dst, ne10_float32_t * src, const ne10_float32_t cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_divc_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src, const ne10_vec2f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_divc_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src, const ne10_vec3f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_divc_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src, const ne10_vec4f_t * cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_div_float, (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_vdiv_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_vdiv_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_vdiv_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_setc_float, (ne10_float32_t * dst, const ne10_float32_t cst, ne10_uint32_t count), (dst, cst, count), count) \
+    R (ne10_result_t, ne10_setc_vec2f, (ne10_vec2f_t * dst, const ne10_vec2f_t * cst, ne10_uint32_t count), (dst, cst, count), count) \
+    R (ne10_result_t, ne10_setc_vec3f, (ne10_vec3f_t * dst, const ne10_vec3f_t * cst, ne10_uint32_t count), (dst, cst, count), count) \
+    R (ne10_result_t, ne10_setc_vec4f, (ne10_vec4f_t * dst, const ne10_vec4f_t * cst, ne10_uint32_t count), (dst, cst, count), count) \
+    R (ne10_result_t, ne10_len_vec2f, (ne10_float32_t * dst, ne10_vec2f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_len_vec3f, (ne10_float32_t * dst, ne10_vec3f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_len_vec4f, (ne10_float32_t * dst, ne10_vec4f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_normalize_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_normalize_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_normalize_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_abs_float, (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_abs_vec2f, (ne10_vec2f_t * dst, ne10_vec2f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_abs_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_abs_vec4f, (ne10_vec4f_t * dst, ne10_vec4f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_dot_vec2f, (ne10_float32_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_dot_vec3f, (ne10_float32_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_dot_vec4f, (ne10_float32_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cross_vec3f, (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_detmat_4x4f, (ne10_float32_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_detmat_3x3f, (ne10_float32_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_detmat_2x2f, (ne10_float32_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_invmat_4x4f, (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_invmat_3x3f, (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_invmat_2x2f, (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_transmat_4x4f, (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_transmat_3x3f, (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_transmat_2x2f, (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_identitymat_4x4f, (ne10_mat4x4f_t * dst, ne10_uint32_t count), (dst, count), count) \
+    R (ne10_result_t, ne10_identitymat_3x3f, (ne10_mat3x3f_t * dst, ne10_uint32_t count), (dst, count), count) \
+    R (ne10_result_t, ne10_identitymat_2x2f, (ne10_mat2x2f_t * dst, ne10_uint32_t count), (dst, count), count) \
+    R (ne10_result_t, ne10_chain_float, (ne10_float32_t * dst, ne10_float32_t * src, const ne10_chain_op_t * ops, ne10_uint32_t op_count, ne10_uint32_t count), (dst, src, ops, op_count, count), count) \
+    R (ne10_result_t, ne10_vec3f_aos_to_soa, (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_vec3f_soa_to_aos, (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_vec4f_aos_to_soa, (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_vec4f_soa_to_aos, (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_len_vec3f_soa, (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_len_vec4f_soa, (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_normalize_vec3f_soa, (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_normalize_vec4f_soa, (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_dot_vec3f_soa, (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_dot_vec4f_soa, (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cross_vec3f_soa, (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_sgemm, (ne10_transpose_t trans_a, ne10_transpose_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, const ne10_float32_t * a, ne10_uint32_t lda, const ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc), (trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc), m * n) \
+    R (ne10_result_t, ne10_mulmat_3x3f_strided, (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src1, ne10_uint32_t src1_stride, ne10_mat3x3f_t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count), (dst, dst_stride, src1, src1_stride, src2, src2_stride, count), count) \
+    R (ne10_result_t, ne10_mulmat_3x3f_ptr, (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src1, ne10_mat3x3f_t ** src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_mulmat_4x4f_strided, (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src1, ne10_uint32_t src1_stride, ne10_mat4x4f_t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count), (dst, dst_stride, src1, src1_stride, src2, src2_stride, count), count) \
+    R (ne10_result_t, ne10_mulmat_4x4f_ptr, (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src1, ne10_mat4x4f_t ** src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_invmat_3x3f_strided, (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count), (dst, dst_stride, src, src_stride, count), count) \
+    R (ne10_result_t, ne10_invmat_3x3f_ptr, (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_invmat_4x4f_strided, (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count), (dst, dst_stride, src, src_stride, count), count) \
+    R (ne10_result_t, ne10_invmat_4x4f_ptr, (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_transmat_3x3f_strided, (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count), (dst, dst_stride, src, src_stride, count), count) \
+    R (ne10_result_t, ne10_transmat_3x3f_ptr, (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_transmat_4x4f_strided, (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count), (dst, dst_stride, src, src_stride, count), count) \
+    R (ne10_result_t, ne10_transmat_4x4f_ptr, (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_detmat_3x3f_strided, (ne10_float32_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count), (dst, dst_stride, src, src_stride, count), count) \
+    R (ne10_result_t, ne10_detmat_3x3f_ptr, (ne10_float32_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_detmat_4x4f_strided, (ne10_float32_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count), (dst, dst_stride, src, src_stride, count), count) \
+    R (ne10_result_t, ne10_detmat_4x4f_ptr, (ne10_float32_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_mulcmatvec_cm3x3f_v3f_strided, (ne10_vec3f_t * dst, ne10_uint32_t dst_stride, const ne10_mat3x3f_t * cst, ne10_vec3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count), (dst, dst_stride, cst, src, src_stride, count), count) \
+    R (ne10_result_t, ne10_mulcmatvec_cm3x3f_v3f_ptr, (ne10_vec3f_t ** dst, const ne10_mat3x3f_t * cst, ne10_vec3f_t ** src, ne10_uint32_t count), (dst, cst, src, count), count) \
+    R (ne10_result_t, ne10_mulcmatvec_cm4x4f_v4f_strided, (ne10_vec4f_t * dst, ne10_uint32_t dst_stride, const ne10_mat4x4f_t * cst, ne10_vec4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count), (dst, dst_stride, cst, src, src_stride, count), count) \
+    R (ne10_result_t, ne10_mulcmatvec_cm4x4f_v4f_ptr, (ne10_vec4f_t ** dst, const ne10_mat4x4f_t * cst, ne10_vec4f_t ** src, ne10_uint32_t count), (dst, cst, src, count), count) \
+    R (ne10_result_t, ne10_mul_quatf, (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_normalize_quatf, (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_nlerp_quatf, (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count), (dst, src1, src2, t, count), count) \
+    R (ne10_result_t, ne10_slerp_quatf, (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count), (dst, src1, src2, t, count), count) \
+    R (ne10_result_t, ne10_rotate_vec3f_quatf, (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count), (dst, quat, src, count), count) \
+    R (ne10_result_t, ne10_quatf_to_mat3x3f, (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_quatf_to_mat4x4f, (ne10_mat4x4f_t * dst, ne10_quatf_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_exp_float, (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_log_float, (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_sincos_float, (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count), (dst_sin, dst_cos, src, count), count) \
+    R (ne10_result_t, ne10_atan2_float, (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_sqrt_float, (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_rsqrt_float, (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_sum_float, (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_mean_float, (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_dotprod_float, (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_norm2_float, (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_max_float, (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count), (dst, index, src, count), count) \
+    R (ne10_result_t, ne10_min_float, (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count), (dst, index, src, count), count) \
+    R (ne10_result_t, ne10_maxabs_float, (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count), (dst, index, src, count), count) \
+    R (ne10_result_t, ne10_sum_int16, (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_sum_int32, (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_dotprod_int16, (ne10_int64_t * dst, ne10_int16_t * src1, ne10_int16_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_dotprod_int32, (ne10_int64_t * dst, ne10_int32_t * src1, ne10_int32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_maxabs_int16, (ne10_int16_t * dst, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count), (dst, index, src, count), count) \
+    R (ne10_result_t, ne10_maxabs_int32, (ne10_int32_t * dst, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count), (dst, index, src, count), count) \
+    R (ne10_result_t, ne10_cmul_float32, (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cmul_conj_float32, (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cmac_float32, (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count), (dst, acc, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cabs_float32, (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_cabs2_float32, (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_cscale_float32, (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_float32_t cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_cpolar_float32, (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count), (mag, phase, src, count), count) \
+    R (ne10_result_t, ne10_crect_float32, (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count), (dst, mag, phase, count), count) \
+    R (ne10_result_t, ne10_cmul_int32, (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cmul_conj_int32, (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cmac_int32, (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count), (dst, acc, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cabs2_int32, (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_cscale_int32, (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_int32_t cst, ne10_uint32_t count), (dst, src, cst, count), count) \
+    R (ne10_result_t, ne10_cmul_int16, (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cmul_conj_int16, (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count), (dst, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cmac_int16, (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count), (dst, acc, src1, src2, count), count) \
+    R (ne10_result_t, ne10_cabs2_int16, (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count), (dst, src, count), count) \
+    R (ne10_result_t, ne10_cscale_int16, (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_int16_t cst, ne10_uint32_t count), (dst, src, cst, count), count)
+#else
+#define NE10_TRACE_LIST_MATH(R, V)
+#endif
+
+#if defined (NE10_ENABLE_DSP)
+// The float32 real FFT keeps only the complex length in the assembly (unroll level 0) layout
+#if (NE10_UNROLL_LEVEL > 0)
+#define NE10_TRACE_R2C_NFFT_FLOAT32(cfg) ((cfg)->nfft)
+#else
+#define NE10_TRACE_R2C_NFFT_FLOAT32(cfg) (2 * (cfg)->ncfft)
+#endif
+
+#define NE10_TRACE_LIST_DSP(R, V) \
+    R (ne10_fft_cfg_float32_t, ne10_fft_alloc_c2c_float32, (ne10_int32_t nfft), (nfft), nfft) \
+    V (ne10_fft_c2c_1d_float32, (ne10_fft_cpx_float32_t * fout, ne10_fft_cpx_float32_t * fin, ne10_fft_cfg_float32_t cfg, ne10_int32_t inverse_fft), (fout, fin, cfg, inverse_fft), cfg->nfft) \
+    R (ne10_fft_cfg_int32_t, ne10_fft_alloc_c2c_int32, (ne10_int32_t nfft), (nfft), nfft) \
+    V (ne10_fft_c2c_1d_int32, (ne10_fft_cpx_int32_t * fout, ne10_fft_cpx_int32_t * fin, ne10_fft_cfg_int32_t cfg, ne10_int32_t inverse_fft, ne10_int32_t scaled_flag), (fout, fin, cfg, inverse_fft, scaled_flag), cfg->nfft) \
+    V (ne10_fft_c2c_1d_int16, (ne10_fft_cpx_int16_t * fout, ne10_fft_cpx_int16_t * fin, ne10_fft_cfg_int16_t cfg, ne10_int32_t inverse_fft, ne10_int32_t scaled_flag), (fout, fin, cfg, inverse_fft, scaled_flag), cfg->nfft) \
+    V (ne10_fft_r2c_1d_float32, (ne10_fft_cpx_float32_t * fout, ne10_float32_t * fin, ne10_fft_r2c_cfg_float32_t cfg), (fout, fin, cfg), NE10_TRACE_R2C_NFFT_FLOAT32 (cfg)) \
+    V (ne10_fft_c2r_1d_float32, (ne10_float32_t * fout, ne10_fft_cpx_float32_t * fin, ne10_fft_r2c_cfg_float32_t cfg), (fout, fin, cfg), NE10_TRACE_R2C_NFFT_FLOAT32 (cfg)) \
+    V (ne10_fft_r2c_1d_int32, (ne10_fft_cpx_int32_t * fout, ne10_int32_t * fin, ne10_fft_r2c_cfg_int32_t cfg, ne10_int32_t scaled_flag), (fout, fin, cfg, scaled_flag), cfg->nfft) \
+    V (ne10_fft_c2r_1d_int32, (ne10_int32_t * fout, ne10_fft_cpx_int32_t * fin, ne10_fft_r2c_cfg_int32_t cfg, ne10_int32_t scaled_flag), (fout, fin, cfg, scaled_flag), cfg->nfft) \
+    V (ne10_fft_r2c_1d_int16, (ne10_fft_cpx_int16_t * fout, ne10_int16_t * fin, ne10_fft_r2c_cfg_int16_t cfg, ne10_int32_t scaled_flag), (fout, fin, cfg, scaled_flag), cfg->nfft) \
+    V (ne10_fft_c2r_1d_int16, (ne10_int16_t * fout, ne10_fft_cpx_int16_t * fin, ne10_fft_r2c_cfg_int16_t cfg, ne10_int32_t scaled_flag), (fout, fin, cfg, scaled_flag), cfg->nfft) \
+    V (ne10_fir_float, (const ne10_fir_instance_f32_t * S, ne10_float32_t * pSrc, ne10_float32_t * pDst, ne10_uint32_t blockSize), (S, pSrc, pDst, blockSize), blockSize) \
+    V (ne10_fir_decimate_float, (const ne10_fir_decimate_instance_f32_t * S, ne10_float32_t * pSrc, ne10_float32_t * pDst, ne10_uint32_t blockSize), (S, pSrc, pDst, blockSize), blockSize) \
+    V (ne10_fir_interpolate_float, (const ne10_fir_interpolate_instance_f32_t * S, ne10_float32_t * pSrc, ne10_float32_t * pDst, ne10_uint32_t blockSize), (S, pSrc, pDst, blockSize), blockSize) \
+    V (ne10_fir_lattice_float, (const ne10_fir_lattice_instance_f32_t * S, ne10_float32_t * pSrc, ne10_float32_t * pDst, ne10_uint32_t blockSize), (S, pSrc, pDst, blockSize), blockSize) \
+    V (ne10_fir_sparse_float, (ne10_fir_sparse_instance_f32_t * S, ne10_float32_t * pSrc, ne10_float32_t * pDst, ne10_float32_t * pScratchIn, ne10_uint32_t blockSize), (S, pSrc, pDst, pScratchIn, blockSize), blockSize) \
+    V (ne10_iir_lattice_float, (const ne10_iir_lattice_instance_f32_t * S, ne10_float32_t * pSrc, ne10_float32_t * pDst, ne10_uint32_t blockSize), (S, pSrc, pDst, blockSize), blockSize)
+#else
+#define NE10_TRACE_LIST_DSP(R, V)
+#endif
+
+#if defined (NE10_ENABLE_IMGPROC)
+#define NE10_TRACE_LIST_IMGPROC(R, V) \
+    V (ne10_img_resize_bilinear_rgba, (ne10_uint8_t * dst, ne10_uint32_t dst_width, ne10_uint32_t dst_height, ne10_uint8_t * src, ne10_uint32_t src_width, ne10_uint32_t src_height, ne10_uint32_t src_stride), (dst, dst_width, dst_height, src, src_width, src_height, src_stride), dst_width * dst_height) \
+    V (ne10_img_resize_plan_execute, (ne10_img_resize_plan_t plan, ne10_uint8_t * dst, ne10_uint32_t dst_stride, ne10_uint8_t * src, ne10_uint32_t src_stride), (plan, dst, dst_stride, src, src_stride), plan->dst_width * plan->dst_height) \
+    V (ne10_img_rotate_rgba, (ne10_uint8_t * dst, ne10_uint32_t * dst_width, ne10_uint32_t * dst_height, ne10_uint8_t * src, ne10_uint32_t src_width, ne10_uint32_t src_height, ne10_int32_t angle), (dst, dst_width, dst_height, src, src_width, src_height, angle), src_width * src_height) \
+    V (ne10_img_rotate_right_angle_rgba, (const ne10_uint8_t * src, ne10_uint8_t * dst, ne10_size_t src_size, ne10_int32_t src_stride, ne10_int32_t dst_stride, ne10_int32_t angle), (src, dst, src_size, src_stride, dst_stride, angle), src_size.x * src_size.y) \
+    V (ne10_img_rotate_right_angle_inplace_rgba, (ne10_uint8_t * img, ne10_uint32_t side, ne10_int32_t stride, ne10_int32_t angle), (img, side, stride, angle), side * side) \
+    V (ne10_img_flip_rgba, (const ne10_uint8_t * src, ne10_uint8_t * dst, ne10_size_t size, ne10_int32_t src_stride, ne10_int32_t dst_stride, ne10_img_flip_t flip), (src, dst, size, src_stride, dst_stride, flip), size.x * size.y) \
+    V (ne10_img_boxfilter_rgba8888, (const ne10_uint8_t * src, ne10_uint8_t * dst, ne10_size_t src_size, ne10_int32_t src_stride, ne10_int32_t dst_stride, ne10_size_t kernel_size), (src, dst, src_size, src_stride, dst_stride, kernel_size), src_size.x * src_size.y) \
+    V (ne10_img_warp_affine_rgba, (const ne10_uint8_t * src, ne10_uint8_t * dst, ne10_size_t src_size, ne10_int32_t src_stride, ne10_size_t dst_size, ne10_int32_t dst_stride, const ne10_float32_t * matrix, ne10_img_border_t border, const ne10_uint8_t * border_value), (src, dst, src_size, src_stride, dst_size, dst_stride, matrix, border, border_value), dst_size.x * dst_size.y) \
+    V (ne10_img_warp_perspective_rgba, (const ne10_uint8_t * src, ne10_uint8_t * dst, ne10_size_t src_size, ne10_int32_t src_stride, ne10_size_t dst_size, ne10_int32_t dst_stride, const ne10_float32_t * matrix, ne10_img_border_t border, const ne10_uint8_t * border_value), (src, dst, src_size, src_stride, dst_size, dst_stride, matrix, border, border_value), dst_size.x * dst_size.y) \
+    V (ne10_img_sepfilter_rgba8888, (const ne10_uint8_t * src, ne10_uint8_t * dst, ne10_size_t src_size, ne10_int32_t src_stride, ne10_int32_t dst_stride, const ne10_int16_t * kernel_x, ne10_uint32_t ksize_x, ne10_int32_t shift_x, const ne10_int16_t * kernel_y, ne10_uint32_t ksize_y, ne10_int32_t shift_y, ne10_int32_t delta, ne10_img_border_t border, const ne10_uint8_t * border_value), (src, dst, src_size, src_stride, dst_stride, kernel_x, ksize_x, shift_x, kernel_y, ksize_y, shift_y, delta, border, border_value), src_size.x * src_size.y) \
+    V (ne10_img_gaussian_rgba8888, (const ne10_uint8_t * src, ne10_uint8_t * dst, ne10_size_t src_size, ne10_int32_t src_stride, ne10_int32_t dst_stride, ne10_float32_t sigma, ne10_img_border_t border, const ne10_uint8_t * border_value, ne10_uint8_t * buffer), (src, dst, src_size, src_stride, dst_stride, sigma, border, border_value, buffer), src_size.x * src_size.y) \
+    R (ne10_result_t, ne10_img_pyramid_rgba8888, (const ne10_uint8_t * src, ne10_size_t src_size, ne10_int32_t src_stride, ne10_int32_t levels, ne10_int32_t laplacian, ne10_uint8_t * arena, ne10_uint32_t arena_size, ne10_img_pyramid_level_t * pyramid), (src, src_size, src_stride, levels, laplacian, arena, arena_size, pyramid), src_size.x * src_size.y)
+#else
+#define NE10_TRACE_LIST_IMGPROC(R, V)
+#endif
+
+#if defined (NE10_ENABLE_PHYSICS)
+#define NE10_TRACE_LIST_PHYSICS(R, V) \
+    V (ne10_physics_compute_aabb_vec2f, (ne10_mat2x2f_t * aabb, ne10_vec2f_t * vertices, ne10_mat2x2f_t * xf, ne10_vec2f_t * radius, ne10_uint32_t vertex_count), (aabb, vertices, xf, radius, vertex_count), vertex_count) \
+    V (ne10_physics_compute_aabb_batch_vec2f, (ne10_mat2x2f_t * aabbs, const ne10_vec2f_t * vertices, const ne10_uint32_t * offsets, const ne10_mat2x2f_t * xfs, const ne10_vec2f_t * radii, ne10_uint32_t shape_count), (aabbs, vertices, offsets, xfs, radii, shape_count), shape_count) \
+    V (ne10_physics_relative_v_vec2f, (ne10_vec2f_t * dv, ne10_vec3f_t * v_wa, ne10_vec2f_t * ra, ne10_vec3f_t * v_wb, ne10_vec2f_t * rb, ne10_uint32_t count), (dv, v_wa, ra, v_wb, rb, count), count) \
+    V (ne10_physics_apply_impulse_vec2f, (ne10_vec3f_t * v_wa, ne10_vec3f_t * v_wb, ne10_vec2f_t * ra, ne10_vec2f_t * rb, ne10_vec2f_t * ima, ne10_vec2f_t * imb, ne10_vec2f_t * p, ne10_uint32_t count), (v_wa, v_wb, ra, rb, ima, imb, p, count), count) \
+    R (ne10_uint32_t, ne10_physics_broadphase_find_pairs, (ne10_physics_broadphase_t bp, ne10_physics_pair_t * pairs, ne10_uint32_t max_pairs, const ne10_mat2x2f_t * aabbs, ne10_uint32_t count), (bp, pairs, max_pairs, aabbs, count), count) \
+    R (ne10_result_t, ne10_physics_solve_contacts_vec2f, (ne10_physics_solver_t solver, ne10_vec3f_t * v_w, const ne10_vec2f_t * inv_mass, ne10_uint32_t body_count, ne10_physics_contacts_t * contacts, ne10_uint32_t contact_count, ne10_uint32_t iterations), (solver, v_w, inv_mass, body_count, contacts, contact_count, iterations), contact_count)
+#else
+#define NE10_TRACE_LIST_PHYSICS(R, V)
+#endif
+#define NE10_TRACE_LIST(R, V) \
+    NE10_TRACE_LIST_MATH (R, V) \
+    NE10_TRACE_LIST_DSP (R, V) \
+    NE10_TRACE_LIST_IMGPROC (R, V) \
+    NE10_TRACE_LIST_PHYSICS (R, V)
+
+#define NE10_TRACE_ID_R(ret, name, params, args, items) NE10_TRACE_ID_##name,
+#define NE10_TRACE_ID_V(name, params, args, items) NE10_TRACE_ID_##name,
+
+enum
+{
+    NE10_TRACE_LIST (NE10_TRACE_ID_R, NE10_TRACE_ID_V)
+    NE10_TRACE_COUNT
+};
+
+#define NE10_TRACE_NAME_R(ret, name, params, args, items) #name,
+#define NE10_TRACE_NAME_V(name, params, args, items) #name,
+
+static const char *const ne10_trace_names[NE10_TRACE_COUNT + 1] =
+{
+    NE10_TRACE_LIST (NE10_TRACE_NAME_R, NE10_TRACE_NAME_V)
+    NULL
+};
+
+typedef struct
+{
+    ne10_uint64_t calls;
+    ne10_uint64_t items;
+    ne10_uint64_t ticks;
+} ne10_trace_counter_t;
+
+typedef struct ne10_trace_thread_s
+{
+    ne10_trace_counter_t counters[NE10_TRACE_COUNT + 1];
+    struct ne10_trace_thread_s *next;
+} ne10_trace_thread_t;
+
+// Counters of every thread that has made a traced call. Blocks are never removed, so that
+// the calls of threads that have exited are still counted.
+static ne10_trace_thread_t *ne10_trace_threads = NULL;
+static __thread ne10_trace_thread_t *ne10_trace_local = NULL;
+
+// Totals at the last ne10_trace_reset, subtracted from the snapshots
+static ne10_trace_counter_t ne10_trace_baseline[NE10_TRACE_COUNT + 1];
+
+// Tick counter and monotonic clock when the first module was wrapped, to calibrate the ticks
+static ne10_uint64_t ne10_trace_start_ticks = 0;
+static ne10_uint64_t ne10_trace_start_ns = 0;
+
+static inline ne10_uint64_t ne10_trace_clock_ns (void)
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (ne10_uint64_t) ts.tv_sec * 1000000000ULL + (ne10_uint64_t) ts.tv_nsec;
+}
+
+static inline ne10_uint64_t ne10_trace_ticks (void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+    return __rdtsc ();
+#elif defined (__aarch64__)
+    ne10_uint64_t ticks;
+    __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (ticks));
+    return ticks;
+#else
+    return ne10_trace_clock_ns ();
+#endif
+}
+
+static ne10_trace_thread_t *ne10_trace_register (void)
+{
+    ne10_trace_thread_t *block = (ne10_trace_thread_t *) calloc (1, sizeof (ne10_trace_thread_t));
+
+    if (block == NULL)
+    {
+        return NULL;
+    }
+
+    block->next = __atomic_load_n (&ne10_trace_threads, __ATOMIC_ACQUIRE);
+    while (!__atomic_compare_exchange_n (&ne10_trace_threads, &block->next, block, 1,
+                                         __ATOMIC_RELEASE, __ATOMIC_ACQUIRE))
+    {
+    }
+    ne10_trace_local = block;
+    return block;
+}
+
+static inline void ne10_trace_record (ne10_uint32_t id, ne10_uint64_t items, ne10_uint64_t start)
+{
+    ne10_uint64_t ticks = ne10_trace_ticks () - start;
+    ne10_trace_thread_t *block = ne10_trace_local;
+    ne10_trace_counter_t *counter;
+
+    if (block == NULL)
+    {
+        block = ne10_trace_register ();
+        if (block == NULL)
+        {
+            return;
+        }
+    }
+
+    // Only this thread writes its counters, so plain increments are enough; the stores
+    // are atomic so that a snapshot taken at the same time never reads a torn value.
+    counter = &block->counters[id];
+    __atomic_store_n (&counter->calls, counter->calls + 1, __ATOMIC_RELAXED);
+    __atomic_store_n (&counter->items, counter->items + items, __ATOMIC_RELAXED);
+    __atomic_store_n (&counter->ticks, counter->ticks + ticks, __ATOMIC_RELAXED);
+}
+
+#define NE10_TRACE_WRAPPER_R(ret, name, params, args, items) \
+    static ret (*ne10_trace_impl_##name) params = NULL; \
+    static ret ne10_trace_##name params \
+    { \
+        ne10_uint64_t trace_items = (ne10_uint64_t) (items); \
+        ne10_uint64_t trace_start = ne10_trace_ticks (); \
+        ret trace_result = ne10_trace_impl_##name args; \
+        ne10_trace_record (NE10_TRACE_ID_##name, trace_items, trace_start); \
+        return trace_result; \
+    }
+
+#define NE10_TRACE_WRAPPER_V(name, params, args, items) \
+    static void (*ne10_trace_impl_##name) params = NULL; \
+    static void ne10_trace_##name params \
+    { \
+        ne10_uint64_t trace_items = (ne10_uint64_t) (items); \
+        ne10_uint64_t trace_start = ne10_trace_ticks (); \
+        ne10_trace_impl_##name args; \
+        ne10_trace_record (NE10_TRACE_ID_##name, trace_items, trace_start); \
+    }
+
+NE10_TRACE_LIST (NE10_TRACE_WRAPPER_R, NE10_TRACE_WRAPPER_V)
+
+// Pointers that are not bound on this platform are left NULL, and a pointer that is
+// already wrapped (ne10_init called twice) is not wrapped again.
+#define NE10_TRACE_INSTALL_V(name, params, args, items) \
+    if (name != NULL && name != ne10_trace_##name) \
+    { \
+        ne10_trace_impl_##name = name; \
+        name = ne10_trace_##name; \
+    }
+#define NE10_TRACE_INSTALL_R(ret, name, params, args, items) \
+    NE10_TRACE_INSTALL_V (name, params, args, items)
+
+static void ne10_trace_start (void)
+{
+    if (ne10_trace_start_ns == 0)
+    {
+        ne10_trace_start_ticks = ne10_trace_ticks ();
+        ne10_trace_start_ns = ne10_trace_clock_ns ();
+    }
+}
+
+void ne10_trace_wrap_math (void)
+{
+    ne10_trace_start ();
+    NE10_TRACE_LIST_MATH (NE10_TRACE_INSTALL_R, NE10_TRACE_INSTALL_V)
+}
+
+void ne10_trace_wrap_dsp (void)
+{
+    ne10_trace_start ();
+    NE10_TRACE_LIST_DSP (NE10_TRACE_INSTALL_R, NE10_TRACE_INSTALL_V)
+}
+
+void ne10_trace_wrap_imgproc (void)
+{
+    ne10_trace_start ();
+    NE10_TRACE_LIST_IMGPROC (NE10_TRACE_INSTALL_R, NE10_TRACE_INSTALL_V)
+}
+
+void ne10_trace_wrap_physics (void)
+{
+    ne10_trace_start ();
+    NE10_TRACE_LIST_PHYSICS (NE10_TRACE_INSTALL_R, NE10_TRACE_INSTALL_V)
+}
+
+static void ne10_trace_totals (ne10_trace_counter_t *totals)
+{
+    ne10_trace_thread_t *block;
+    ne10_uint32_t i;
+
+    memset (totals, 0, sizeof (ne10_trace_counter_t) * NE10_TRACE_COUNT);
+    for (block = __atomic_load_n (&ne10_trace_threads, __ATOMIC_ACQUIRE); block != NULL; block = block->next)
+    {
+        for (i = 0; i < NE10_TRACE_COUNT; i++)
+        {
+            totals[i].calls += __atomic_load_n (&block->counters[i].calls, __ATOMIC_RELAXED);
+            totals[i].items += __atomic_load_n (&block->counters[i].items, __ATOMIC_RELAXED);
+            totals[i].ticks += __atomic_load_n (&block->counters[i].ticks, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+ne10_uint32_t ne10_trace_snapshot (ne10_trace_entry_t *entries, ne10_uint32_t capacity)
+{
+    ne10_trace_counter_t totals[NE10_TRACE_COUNT + 1];
+    ne10_uint32_t i;
+
+    if (entries == NULL || capacity == 0)
+    {
+        return NE10_TRACE_COUNT;
+    }
+
+    ne10_trace_totals (totals);
+    for (i = 0; i < NE10_TRACE_COUNT && i < capacity; i++)
+    {
+        entries[i].name = ne10_trace_names[i];
+        entries[i].calls = totals[i].calls - ne10_trace_baseline[i].calls;
+        entries[i].items = totals[i].items - ne10_trace_baseline[i].items;
+        entries[i].ticks = totals[i].ticks - ne10_trace_baseline[i].ticks;
+    }
+    return NE10_TRACE_COUNT;
+}
+
+void ne10_trace_reset (void)
+{
+    ne10_trace_totals (ne10_trace_baseline);
+}
+
+ne10_float64_t ne10_trace_ticks_per_second (void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+    ne10_uint64_t ticks, ns;
+
+    if (ne10_trace_start_ns == 0)
+    {
+        ne10_trace_start ();
+    }
+    // Measure over at least 10 ms for a usable estimate
+    do
+    {
+        ticks = ne10_trace_ticks ();
+        ns = ne10_trace_clock_ns ();
+    }
+    while (ns - ne10_trace_start_ns < 10000000ULL);
+    return (ne10_float64_t) (ticks - ne10_trace_start_ticks) * 1e9 / (ne10_float64_t) (ns - ne10_trace_start_ns);
+#elif defined (__aarch64__)
+    ne10_uint64_t frequency;
+    __asm__ __volatile__ ("mrs %0, cntfrq_el0" : "=r" (frequency));
+    return (ne10_float64_t) frequency;
+#else
+    return 1e9;
+#endif
+}
+
+ne10_result_t ne10_trace_dump_json (FILE *file)
+{
+    ne10_trace_entry_t entries[NE10_TRACE_COUNT + 1];
+    ne10_float64_t ticks_per_second = ne10_trace_ticks_per_second ();
+    ne10_uint32_t i;
+    const char *separator = "";
+
+    ne10_trace_snapshot (entries, NE10_TRACE_COUNT);
+    fprintf (file, "{\n  \"ticks_per_second\": %.0f,\n  \"functions\": [", ticks_per_second);
+    for (i = 0; i < NE10_TRACE_COUNT; i++)
+    {
+        if (entries[i].calls == 0)
+        {
+            continue;
+        }
+        fprintf (file, "%s\n    {\"name\": \"%s\", \"calls\": %llu, \"items\": %llu, \"ticks\": %llu, \"ns\": %.0f}",
+                 separator, entries[i].name,
+                 (unsigned long long) entries[i].calls,
+                 (unsigned long long) entries[i].items,
+                 (unsigned long long) entries[i].ticks,
+                 (ne10_float64_t) entries[i].ticks * 1e9 / ticks_per_second);
+        separator = ",";
+    }
+    fprintf (file, "\n  ]\n}\n");
+    return ferror (file) ? NE10_ERR : NE10_OK;
+}
+
+#else // NE10_ENABLE_TRACE
+
+ne10_uint32_t ne10_trace_snapshot (ne10_trace_entry_t *entries, ne10_uint32_t capacity)
+{
+    (void) entries;
+    (void) capacity;
+    return 0;
+}
+
+void ne10_trace_reset (void)
+{
+}
+
+ne10_float64_t ne10_trace_ticks_per_second (void)
+{
+    return 0.0;
+}
+
+ne10_result_t ne10_trace_dump_json (FILE *file)
+{
+    (void) file;
+    return NE10_ERR;
+}
+
+void ne10_trace_wrap_math (void)
+{
+}
+
+void ne10_trace_wrap_dsp (void)
+{
+}
+
+void ne10_trace_wrap_imgproc (void)
+{
+}
+
+void ne10_trace_wrap_physics (void)
+{
+}
+
+#endif // NE10_ENABLE_TRACE
@@ -363,16 +363,16 @@ ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_neon (ne10_int32_t nfft)
 
     st = (ne10_fft_cfg_float32_t) NE10_MALLOC (memneeded);
 
-    // Only backward FFT is scaled by default.
-    st->is_forward_scaled = 0;
-    st->is_backward_scaled = 1;
-
     // Bad allocation.
     if (st == NULL)
     {
         return NULL;
     }
 
+    // Only backward FFT is scaled by default.
+    st->is_forward_scaled = 0;
+    st->is_backward_scaled = 1;
+
     uintptr_t address = (uintptr_t) st + sizeof (ne10_fft_state_float32_t);
     NE10_BYTE_ALIGNMENT (address, NE10_FFT_BYTE_ALIGNMENT);
     st->factors = (ne10_int32_t*) address;
@@ -555,7 +555,7 @@ ne10_fft_cfg_int32_t ne10_fft_alloc_c2c_int32_neon (ne10_int32_t nfft)
  */
 void ne10_fft_destroy_c2c_float32 (ne10_fft_cfg_float32_t cfg)
 {
-    free(cfg);
+    NE10_FREE (cfg);
 }
 
 /**
@@ -565,7 +565,7 @@ void ne10_fft_destroy_c2c_float32 (ne10_fft_cfg_float32_t cfg)
  */
 void ne10_fft_destroy_c2c_int32 (ne10_fft_cfg_int32_t cfg)
 {
-    free (cfg);
+    NE10_FREE (cfg);
 }
 
 /**
@@ -575,7 +575,7 @@ void ne10_fft_destroy_c2c_int32 (ne10_fft_cfg_int32_t cfg)
  */
 void ne10_fft_destroy_c2c_int16 (ne10_fft_cfg_int16_t cfg)
 {
-    free (cfg);
+    NE10_FREE (cfg);
 }
 
 /** @} */ // C2C_FFT_IFFT
@@ -592,7 +592,7 @@ void ne10_fft_destroy_c2c_int16 (ne10_fft_cfg_int16_t cfg)
  */
 void ne10_fft_destroy_r2c_float32 (ne10_fft_r2c_cfg_float32_t cfg)
 {
-    free(cfg);
+    NE10_FREE (cfg);
 }
 
 /**
@@ -602,7 +602,7 @@ void ne10_fft_destroy_r2c_float32 (ne10_fft_r2c_cfg_float32_t cfg)
  */
 void ne10_fft_destroy_r2c_int32 (ne10_fft_r2c_cfg_int32_t cfg)
 {
-    free (cfg);
+    NE10_FREE (cfg);
 }
 
 /**
@@ -612,7 +612,7 @@ void ne10_fft_destroy_r2c_int32 (ne10_fft_r2c_cfg_int32_t cfg)
  */
 void ne10_fft_destroy_r2c_int16 (ne10_fft_r2c_cfg_int16_t cfg)
 {
-    free (cfg);
+    NE10_FREE (cfg);
 }
 
 /** @} */ // R2C_FFT_IFFT
@@ -836,15 +836,15 @@ ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_c (ne10_int32_t nfft)
 
     st = (ne10_fft_cfg_float32_t) NE10_MALLOC (memneeded);
 
-    // Only backward FFT is scaled by default.
-    st->is_forward_scaled = 0;
-    st->is_backward_scaled = 1;
-
     if (st == NULL)
     {
         return st;
     }
 
+    // Only backward FFT is scaled by default.
+    st->is_forward_scaled = 0;
+    st->is_backward_scaled = 1;
+
     uintptr_t address = (uintptr_t) st + sizeof (ne10_fft_state_float32_t);
     NE10_BYTE_ALIGNMENT (address, NE10_FFT_BYTE_ALIGNMENT);
     st->factors = (ne10_int32_t*) address;
@@ -931,7 +931,7 @@ void ne10_fft_c2c_1d_float32_c (ne10_fft_cpx_float32_t *fout,
  * @brief Creates a configuration structure for variants of @ref ne10_fft_r2c_1d_float32 and @ref ne10_fft_c2r_1d_float32.
  *
  * @param[in]   nfft             input length
- * @retval      st               pointer to an FFT configuration structure (allocated with `malloc`), or `NULL` to indicate an error
+ * @retval      st               pointer to an FFT configuration structure (allocated with `NE10_MALLOC`), or `NULL` to indicate an error
  *
  * Allocates and initialises an @ref ne10_fft_r2c_cfg_float32_t configuration structure for
  * the FP32 real-to-complex and complex-to-real FFT/IFFT. As part of this, it reserves a buffer used
@@ -0,0 +1,277 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_fft_float32.x86.c.h
+ */
+
+/*
+ * Power-of-two complex FFT for x86. This file is compiled once per instruction
+ * set by NE10_fft_float32.sse.c and NE10_fft_float32.avx2.c (see
+ * common/NE10_x86.h).
+ *
+ * It follows the stages of ne10_mixed_radix_butterfly_float32_c: a radix-8 or
+ * radix-4 first stage, then radix-4 stages. A vector holds the butterflies of
+ * NE10_X86_CPX_LANES consecutive sections in the first stage and of as many
+ * consecutive twiddles in the others, which needs nfft >= 16; the arithmetic
+ * is evaluated in the same order as in C.
+ */
+
+/* multiplies by -i for the forward transform and by i for the inverse one */
+static inline ne10_x86_f32_t ne10_x86_fft_rot (ne10_x86_f32_t a, ne10_int32_t inverse)
+{
+    return inverse ? ne10_x86_mul_pos_i (a) : ne10_x86_mul_neg_i (a);
+}
+
+static inline ne10_x86_f32_t ne10_x86_fft_twiddle (ne10_x86_f32_t a, ne10_x86_f32_t w, ne10_int32_t inverse)
+{
+    return inverse ? ne10_x86_cpx_mul_conj (a, w) : ne10_x86_cpx_mul (a, w);
+}
+
+static inline ne10_x86_f32_t ne10_x86_fft_load (const ne10_fft_cpx_float32_t *p)
+{
+    return ne10_x86_load ( (const ne10_float32_t*) p);
+}
+
+static inline void ne10_x86_fft_store (ne10_fft_cpx_float32_t *p, ne10_x86_f32_t a)
+{
+    ne10_x86_store ( (ne10_float32_t*) p, a);
+}
+
+static inline void ne10_x86_mixed_radix_butterfly_float32 (ne10_fft_cpx_float32_t *out,
+        ne10_fft_cpx_float32_t *in,
+        ne10_int32_t *factors,
+        ne10_fft_cpx_float32_t *twiddles,
+        ne10_fft_cpx_float32_t *buffer,
+        ne10_int32_t inverse)
+{
+    ne10_int32_t stage_count = factors[0];
+    ne10_int32_t fstride = factors[1];
+    ne10_int32_t mstride = factors[ (stage_count << 1) - 1];
+    ne10_int32_t first_radix = factors[stage_count << 1];
+    ne10_int32_t step, f_count, m_count;
+    ne10_fft_cpx_float32_t *src, *dst, *tmp;
+    ne10_fft_cpx_float32_t *out_final = out;
+    const ne10_float32_t TW_81 = 0.70710678;
+    const ne10_x86_f32_t one_by_nfft = ne10_x86_dup (1.0f / (ne10_float32_t) (fstride * first_radix));
+    ne10_x86_f32_t a0, a1, a2, a3, a4, a5, a6, a7;
+    ne10_x86_f32_t s0, s1, s2, s3, s4, s5, s6, s7;
+    ne10_x86_f32_t w0, w1, w2;
+
+    // The first stage (using hardcoded twiddles)
+    if (first_radix == 8)
+    {
+        const ne10_x86_f32_t tw_81 = ne10_x86_dup (TW_81);
+
+        for (f_count = 0; f_count < fstride; f_count += NE10_X86_CPX_LANES)
+        {
+            src = in + f_count;
+
+            // X[k] +/- X[k + 4N/8]
+            a0 = ne10_x86_fft_load (src);
+            a4 = ne10_x86_fft_load (src + fstride * 4);
+            s0 = ne10_x86_add (a0, a4);
+            s1 = ne10_x86_sub (a0, a4);
+            a1 = ne10_x86_fft_load (src + fstride);
+            a5 = ne10_x86_fft_load (src + fstride * 5);
+            s2 = ne10_x86_add (a1, a5);
+            s3 = ne10_x86_sub (a1, a5);
+            a2 = ne10_x86_fft_load (src + fstride * 2);
+            a6 = ne10_x86_fft_load (src + fstride * 6);
+            s4 = ne10_x86_add (a2, a6);
+            s5 = ne10_x86_sub (a2, a6);
+            a3 = ne10_x86_fft_load (src + fstride * 3);
+            a7 = ne10_x86_fft_load (src + fstride * 7);
+            s6 = ne10_x86_add (a3, a7);
+            s7 = ne10_x86_sub (a3, a7);
+
+            // Hardcoded radix-8 twiddles
+            s5 = ne10_x86_fft_rot (s5, inverse);
+            s3 = ne10_x86_mul (ne10_x86_add (s3, ne10_x86_fft_rot (s3, inverse)), tw_81);
+            s7 = ne10_x86_mul (ne10_x86_sub (s7, ne10_x86_fft_rot (s7, inverse)), tw_81);
+
+            // Combine the pairs of sums
+            a0 = ne10_x86_add (s0, s4);
+            a1 = ne10_x86_add (s1, s5);
+            a2 = ne10_x86_sub (s0, s4);
+            a3 = ne10_x86_sub (s1, s5);
+            a4 = ne10_x86_add (s2, s6);
+            a5 = ne10_x86_sub (s3, s7);
+            a6 = ne10_x86_sub (s2, s6);
+            a7 = ne10_x86_add (s3, s7);
+
+            // The full radix-8 butterfly
+            s0 = ne10_x86_add (a0, a4);
+            s1 = ne10_x86_add (a1, a5);
+            s2 = ne10_x86_add (a2, ne10_x86_fft_rot (a6, inverse));
+            s3 = ne10_x86_add (a3, ne10_x86_fft_rot (a7, inverse));
+            s4 = ne10_x86_sub (a0, a4);
+            s5 = ne10_x86_sub (a1, a5);
+            s6 = ne10_x86_sub (a2, ne10_x86_fft_rot (a6, inverse));
+            s7 = ne10_x86_sub (a3, ne10_x86_fft_rot (a7, inverse));
+
+            // Each section writes eight consecutive outputs
+            dst = out + f_count * 8;
+            ne10_x86_store_cpx_x4 ( (ne10_float32_t*) dst, 8, s0, s1, s2, s3);
+            ne10_x86_store_cpx_x4 ( (ne10_float32_t*) (dst + 4), 8, s4, s5, s6, s7);
+        }
+
+        step = fstride << 1;
+        stage_count--;
+        fstride /= 4;
+    }
+    else // first_radix == 4
+    {
+        for (f_count = 0; f_count < fstride; f_count += NE10_X86_CPX_LANES)
+        {
+            src = in + f_count;
+
+            a0 = ne10_x86_fft_load (src);
+            a1 = ne10_x86_fft_load (src + fstride);
+            a2 = ne10_x86_fft_load (src + fstride * 2);
+            a3 = ne10_x86_fft_load (src + fstride * 3);
+
+            s0 = ne10_x86_add (a0, a2);
+            s1 = ne10_x86_sub (a0, a2);
+            s2 = ne10_x86_add (a1, a3);
+            s3 = ne10_x86_sub (a1, a3);
+
+            a0 = ne10_x86_add (s0, s2);
+            a1 = ne10_x86_add (s1, ne10_x86_fft_rot (s3, inverse));
+            a2 = ne10_x86_sub (s0, s2);
+            a3 = ne10_x86_sub (s1, ne10_x86_fft_rot (s3, inverse));
+
+            // Each section writes four consecutive outputs
+            ne10_x86_store_cpx_x4 ( (ne10_float32_t*) (out + f_count * 4), 4, a0, a1, a2, a3);
+        }
+
+        step = fstride;
+        stage_count--;
+        fstride /= 4;
+    }
+
+    // The next stage should read the output of the first stage as input
+    in = out;
+    out = buffer;
+
+    // Radix-4 stages, the last one writing to the final output (possibly in-place)
+    for (; stage_count > 0; stage_count--)
+    {
+        if (stage_count == 1)
+        {
+            out = out_final;
+        }
+
+        for (f_count = 0; f_count < fstride; f_count++)
+        {
+            src = in + f_count * mstride;
+            dst = out + f_count * mstride * (stage_count == 1 ? 1 : 4);
+
+            for (m_count = 0; m_count < mstride; m_count += NE10_X86_CPX_LANES)
+            {
+                // Load the three twiddles and four input values for the butterflies
+                w0 = ne10_x86_fft_load (twiddles + m_count);
+                w1 = ne10_x86_fft_load (twiddles + mstride + m_count);
+                w2 = ne10_x86_fft_load (twiddles + mstride * 2 + m_count);
+                a0 = ne10_x86_fft_load (src + m_count);
+                a1 = ne10_x86_fft_twiddle (ne10_x86_fft_load (src + step + m_count), w0, inverse);
+                a2 = ne10_x86_fft_twiddle (ne10_x86_fft_load (src + step * 2 + m_count), w1, inverse);
+                a3 = ne10_x86_fft_twiddle (ne10_x86_fft_load (src + step * 3 + m_count), w2, inverse);
+
+                s4 = ne10_x86_add (a0, a2);
+                s5 = ne10_x86_sub (a0, a2);
+                s6 = ne10_x86_add (a1, a3);
+                s7 = ne10_x86_sub (a1, a3);
+
+                a0 = ne10_x86_add (s4, s6);
+                a1 = ne10_x86_add (s5, ne10_x86_fft_rot (s7, inverse));
+                a2 = ne10_x86_sub (s4, s6);
+                a3 = ne10_x86_sub (s5, ne10_x86_fft_rot (s7, inverse));
+
+                if (stage_count == 1)
+                {
+                    if (inverse)
+                    {
+                        a0 = ne10_x86_mul (a0, one_by_nfft);
+                        a1 = ne10_x86_mul (a1, one_by_nfft);
+                        a2 = ne10_x86_mul (a2, one_by_nfft);
+                        a3 = ne10_x86_mul (a3, one_by_nfft);
+                    }
+                    ne10_x86_fft_store (dst + m_count, a0);
+                    ne10_x86_fft_store (dst + step + m_count, a1);
+                    ne10_x86_fft_store (dst + step * 2 + m_count, a2);
+                    ne10_x86_fft_store (dst + step * 3 + m_count, a3);
+                }
+                else
+                {
+                    ne10_x86_fft_store (dst + m_count, a0);
+                    ne10_x86_fft_store (dst + mstride + m_count, a1);
+                    ne10_x86_fft_store (dst + mstride * 2 + m_count, a2);
+                    ne10_x86_fft_store (dst + mstride * 3 + m_count, a3);
+                }
+            }
+        }
+
+        // Update variables for the next stage
+        twiddles += mstride * 3;
+        mstride *= 4;
+        fstride /= 4;
+
+        // Swap the input and output buffers for the next stage
+        tmp = in;
+        in = out;
+        out = tmp;
+    }
+}
+
+/*
+ * Transforms that are not a power of two, or shorter than 16 points, use the
+ * plain C implementation.
+ */
+void NE10_X86_NAME (ne10_fft_c2c_1d_float32) (ne10_fft_cpx_float32_t *fout,
+        ne10_fft_cpx_float32_t *fin,
+        ne10_fft_cfg_float32_t cfg,
+        ne10_int32_t inverse_fft)
+{
+    ne10_int32_t stage_count = cfg->factors[0];
+    ne10_int32_t algorithm_flag = cfg->factors[2 * (stage_count + 1)];
+
+    if ( (algorithm_flag != NE10_FFT_ALG_DEFAULT) || (cfg->nfft < 16))
+    {
+        ne10_fft_c2c_1d_float32_c (fout, fin, cfg, inverse_fft);
+        return;
+    }
+
+    if (inverse_fft)
+    {
+        ne10_x86_mixed_radix_butterfly_float32 (fout, fin, cfg->factors, cfg->twiddles, cfg->buffer, 1);
+    }
+    else
+    {
+        ne10_x86_mixed_radix_butterfly_float32 (fout, fin, cfg->factors, cfg->twiddles, cfg->buffer, 0);
+    }
+}
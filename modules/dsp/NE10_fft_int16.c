@@ -1059,7 +1059,7 @@ static void ne10_fft_split_c2r_1d_int16 (ne10_fft_cpx_int16_t *dst,
  * @brief Creates a configuration structure for variants of @ref ne10_fft_c2c_1d_int16.
  *
  * @param[in]   nfft             input length
- * @retval      st               pointer to an FFT configuration structure (allocated with `malloc`), or `NULL` to indicate an error
+ * @retval      st               pointer to an FFT configuration structure (allocated with `NE10_MALLOC`), or `NULL` to indicate an error
  *
  * Allocates and initialises an @ref ne10_fft_cfg_int16_t configuration structure for
  * the complex-to-complex 16-bit integer fixed point FFT/IFFT. As part of this, it reserves a
@@ -1151,7 +1151,7 @@ void ne10_fft_c2c_1d_int16_c (ne10_fft_cpx_int16_t *fout,
  * @brief Creates a configuration structure for variants of @ref ne10_fft_r2c_1d_int16 and @ref ne10_fft_c2r_1d_int16.
  *
  * @param[in]   nfft             input length
- * @retval      st               pointer to an FFT configuration structure (allocated with `malloc`), or `NULL` to indicate an error
+ * @retval      st               pointer to an FFT configuration structure (allocated with `NE10_MALLOC`), or `NULL` to indicate an error
  *
  * Allocates and initialises an @ref ne10_fft_r2c_cfg_int16_t configuration structure for
  * the INT16 real-to-complex and complex-to-real FFT/IFFT. As part of this, it reserves a buffer used
@@ -1145,7 +1145,7 @@ void ne10_fft_c2c_1d_int32_c (ne10_fft_cpx_int32_t *fout,
  * @brief Creates a configuration structure for variants of @ref ne10_fft_r2c_1d_int32 and @ref ne10_fft_c2r_1d_int32.
  *
  * @param[in]   nfft             input length
- * @retval      st               pointer to an FFT configuration structure (allocated with `malloc`), or `NULL` to indicate an error
+ * @retval      st               pointer to an FFT configuration structure (allocated with `NE10_MALLOC`), or `NULL` to indicate an error
  *
  * Allocates and initialises an @ref ne10_fft_r2c_cfg_int32_t configuration structure for
  * the INT32 real-to-complex and complex-to-real FFT/IFFT. As part of this, it reserves a buffer used
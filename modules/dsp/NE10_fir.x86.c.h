@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/NE10_fir.x86.c.h
+ */
+
+/*
+ * FIR filter for x86. This file is compiled once per instruction set by
+ * NE10_fir.sse.c and NE10_fir.avx2.c (see common/NE10_x86.h).
+ *
+ * Each vector accumulates NE10_X86_LANES consecutive outputs, tap by tap in
+ * the same order as ne10_fir_float_c; four vectors are kept in flight to hide
+ * the latency of the additions.
+ */
+
+static inline ne10_x86_f32_t ne10_x86_fir_tap (ne10_x86_f32_t acc,
+        const ne10_float32_t *x,
+        ne10_x86_f32_t c)
+{
+    return ne10_x86_add (acc, ne10_x86_mul (ne10_x86_load (x), c));
+}
+
+void NE10_X86_NAME (ne10_fir_float) (const ne10_fir_instance_f32_t * S,
+                                     ne10_float32_t * pSrc,
+                                     ne10_float32_t * pDst,
+                                     ne10_uint32_t blockSize)
+{
+    ne10_float32_t *pState = S->pState;                 /* State pointer */
+    ne10_float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+    ne10_uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+    ne10_uint32_t i, k;
+
+    /* The state holds the last (numTaps - 1) samples of the previous block; append the new block */
+    memcpy (pState + (numTaps - 1), pSrc, blockSize * sizeof (ne10_float32_t));
+
+    for (i = 0; i + 4 * NE10_X86_LANES <= blockSize; i += 4 * NE10_X86_LANES)
+    {
+        const ne10_float32_t *px = pState + i;
+        ne10_x86_f32_t acc0 = ne10_x86_dup (0.0f);
+        ne10_x86_f32_t acc1 = acc0;
+        ne10_x86_f32_t acc2 = acc0;
+        ne10_x86_f32_t acc3 = acc0;
+
+        for (k = 0; k < numTaps; k++)
+        {
+            ne10_x86_f32_t c = ne10_x86_dup (pCoeffs[k]);
+            acc0 = ne10_x86_fir_tap (acc0, px + k, c);
+            acc1 = ne10_x86_fir_tap (acc1, px + k + NE10_X86_LANES, c);
+            acc2 = ne10_x86_fir_tap (acc2, px + k + 2 * NE10_X86_LANES, c);
+            acc3 = ne10_x86_fir_tap (acc3, px + k + 3 * NE10_X86_LANES, c);
+        }
+        ne10_x86_store (pDst + i, acc0);
+        ne10_x86_store (pDst + i + NE10_X86_LANES, acc1);
+        ne10_x86_store (pDst + i + 2 * NE10_X86_LANES, acc2);
+        ne10_x86_store (pDst + i + 3 * NE10_X86_LANES, acc3);
+    }
+
+    for (; i + NE10_X86_LANES <= blockSize; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t acc = ne10_x86_dup (0.0f);
+
+        for (k = 0; k < numTaps; k++)
+        {
+            acc = ne10_x86_fir_tap (acc, pState + i + k, ne10_x86_dup (pCoeffs[k]));
+        }
+        ne10_x86_store (pDst + i, acc);
+    }
+
+    for (; i < blockSize; i++)
+    {
+        ne10_float32_t acc = 0.0f;
+
+        for (k = 0; k < numTaps; k++)
+        {
+            acc += pState[i + k] * pCoeffs[k];
+        }
+        pDst[i] = acc;
+    }
+
+    /* Keep the last (numTaps - 1) samples for the next call */
+    memmove (pState, pState + blockSize, (numTaps - 1) * sizeof (ne10_float32_t));
+}
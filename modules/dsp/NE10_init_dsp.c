@@ -28,9 +28,13 @@
 #include <stdio.h>
 
 #include "NE10_dsp.h"
+#if defined (NE10_ENABLE_X86)
+#include "NE10_init.h"
+#endif
 
 ne10_result_t ne10_init_dsp (ne10_int32_t is_NEON_available)
 {
+#if !defined (NE10_ENABLE_X86)
     if (NE10_OK == is_NEON_available)
     {
         ne10_fft_alloc_c2c_float32 = ne10_fft_alloc_c2c_float32_neon;
@@ -84,6 +88,7 @@ ne10_result_t ne10_init_dsp (ne10_int32_t is_NEON_available)
 #endif // ENABLE_NE10_IIR_LATTICE_FLOAT_NEON
     }
     else
+#endif // NE10_ENABLE_X86
     {
         ne10_fft_alloc_c2c_float32 = ne10_fft_alloc_c2c_float32_c;
         ne10_fft_alloc_c2c_int32 = ne10_fft_alloc_c2c_int32_c;
@@ -107,6 +112,22 @@ ne10_result_t ne10_init_dsp (ne10_int32_t is_NEON_available)
 
         ne10_iir_lattice_float = ne10_iir_lattice_float_c;
     }
+#if defined (NE10_ENABLE_X86)
+    // The power-of-two complex FFT and the FIR filter have SSE4.1 and AVX2 versions
+    if (NE10_OK == ne10_HasAVX2 ())
+    {
+        ne10_fft_c2c_1d_float32 = ne10_fft_c2c_1d_float32_avx2;
+        ne10_fir_float = ne10_fir_float_avx2;
+    }
+    else if (NE10_OK == ne10_HasSSE41 ())
+    {
+        ne10_fft_c2c_1d_float32 = ne10_fft_c2c_1d_float32_sse;
+        ne10_fir_float = ne10_fir_float_sse;
+    }
+#endif // NE10_ENABLE_X86
+#if defined (NE10_ENABLE_TRACE)
+    ne10_trace_wrap_dsp ();
+#endif
     return NE10_OK;
 }
 
@@ -746,7 +746,7 @@ NE10_INLINE void ne10_mixed_radix_c2r_butterfly_float32_c (
 /**
  * @brief User-callable function to create a configuration structure for the R2C/C2R FFT/IFFT.
  * @param[in]   nfft             length of FFT
- * @retval      st               pointer to the FFT configuration memory, allocated with malloc.
+ * @retval      st               pointer to the FFT configuration memory, allocated with NE10_MALLOC.
  *
  * This function allocates and initialises an ne10_fft_r2c_cfg_float32_t configuration structure for the
  * real-to-complex and complex-to-real FFT/IFFT. As part of this, it reserves a buffer used internally
@@ -0,0 +1,380 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : dsp/test/bench_dsp.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "NE10_dsp.h"
+#include "NE10_bench.h"
+
+#define NE10_BENCH_FIR_TAPS 32
+#define NE10_BENCH_FIR_FACTOR 4
+#define NE10_BENCH_SPARSE_DELAY 256
+#define NE10_BENCH_IIR_STAGES 16
+
+/*
+ * FFTs: one configuration of each precision and kind for a size, and input
+ * and output buffers large enough for any of them (complex, 8 bytes per
+ * sample at most).
+ */
+typedef struct
+{
+    ne10_int32_t nfft;
+    void * in;
+    void * out;
+    ne10_fft_cfg_float32_t c2c_float32;
+    ne10_fft_cfg_int32_t c2c_int32;
+    ne10_fft_cfg_int16_t c2c_int16;
+    ne10_fft_r2c_cfg_float32_t r2c_float32;
+    ne10_fft_r2c_cfg_int32_t r2c_int32;
+    ne10_fft_r2c_cfg_int16_t r2c_int16;
+} ne10_bench_fft_state_t;
+
+static void bench_fft_teardown (void * state)
+{
+    ne10_bench_fft_state_t * st = (ne10_bench_fft_state_t *) state;
+
+    if (st->c2c_float32 != NULL)
+        ne10_fft_destroy_c2c_float32 (st->c2c_float32);
+    if (st->c2c_int32 != NULL)
+        ne10_fft_destroy_c2c_int32 (st->c2c_int32);
+    if (st->c2c_int16 != NULL)
+        ne10_fft_destroy_c2c_int16 (st->c2c_int16);
+    if (st->r2c_float32 != NULL)
+        ne10_fft_destroy_r2c_float32 (st->r2c_float32);
+    if (st->r2c_int32 != NULL)
+        ne10_fft_destroy_r2c_int32 (st->r2c_int32);
+    if (st->r2c_int16 != NULL)
+        ne10_fft_destroy_r2c_int16 (st->r2c_int16);
+    ne10_bench_free (st->in);
+    ne10_bench_free (st->out);
+    free (st);
+}
+
+static void * bench_fft_setup (ne10_uint32_t nfft)
+{
+    ne10_bench_fft_state_t * st = (ne10_bench_fft_state_t *) calloc (1, sizeof (ne10_bench_fft_state_t));
+
+    if (st == NULL)
+        return NULL;
+    st->nfft = nfft;
+    st->in = ne10_bench_alloc (nfft * sizeof (ne10_fft_cpx_float32_t));
+    st->out = ne10_bench_alloc ( (nfft + 2) * sizeof (ne10_fft_cpx_float32_t));
+    st->c2c_float32 = ne10_fft_alloc_c2c_float32 (nfft);
+    st->c2c_int32 = ne10_fft_alloc_c2c_int32 (nfft);
+    st->c2c_int16 = ne10_fft_alloc_c2c_int16 (nfft);
+    st->r2c_float32 = ne10_fft_alloc_r2c_float32 (nfft);
+    st->r2c_int32 = ne10_fft_alloc_r2c_int32 (nfft);
+    st->r2c_int16 = ne10_fft_alloc_r2c_int16 (nfft);
+    if (st->in == NULL || st->out == NULL || st->c2c_float32 == NULL || st->c2c_int32 == NULL
+            || st->c2c_int16 == NULL || st->r2c_float32 == NULL || st->r2c_int32 == NULL
+            || st->r2c_int16 == NULL)
+    {
+        bench_fft_teardown (st);
+        return NULL;
+    }
+    return st;
+}
+
+#define FFT_STATE ne10_bench_fft_state_t * st = (ne10_bench_fft_state_t *) state
+
+static void bench_fft_c2c_float32 (void * state)
+{
+    FFT_STATE;
+    ne10_fft_c2c_1d_float32 (st->out, st->in, st->c2c_float32, 0);
+}
+
+static void bench_fft_c2c_float32_inverse (void * state)
+{
+    FFT_STATE;
+    ne10_fft_c2c_1d_float32 (st->out, st->in, st->c2c_float32, 1);
+}
+
+static void bench_fft_r2c_float32 (void * state)
+{
+    FFT_STATE;
+    ne10_fft_r2c_1d_float32 (st->out, st->in, st->r2c_float32);
+}
+
+static void bench_fft_c2r_float32 (void * state)
+{
+    FFT_STATE;
+    ne10_fft_c2r_1d_float32 (st->out, st->in, st->r2c_float32);
+}
+
+static void bench_fft_c2c_int32 (void * state)
+{
+    FFT_STATE;
+    ne10_fft_c2c_1d_int32 (st->out, st->in, st->c2c_int32, 0, 1);
+}
+
+static void bench_fft_c2c_int32_inverse (void * state)
+{
+    FFT_STATE;
+    ne10_fft_c2c_1d_int32 (st->out, st->in, st->c2c_int32, 1, 1);
+}
+
+static void bench_fft_r2c_int32 (void * state)
+{
+    FFT_STATE;
+    ne10_fft_r2c_1d_int32 (st->out, st->in, st->r2c_int32, 1);
+}
+
+static void bench_fft_c2r_int32 (void * state)
+{
+    FFT_STATE;
+    ne10_fft_c2r_1d_int32 (st->out, st->in, st->r2c_int32, 1);
+}
+
+static void bench_fft_c2c_int16 (void * state)
+{
+    FFT_STATE;
+    ne10_fft_c2c_1d_int16 (st->out, st->in, st->c2c_int16, 0, 1);
+}
+
+static void bench_fft_c2c_int16_inverse (void * state)
+{
+    FFT_STATE;
+    ne10_fft_c2c_1d_int16 (st->out, st->in, st->c2c_int16, 1, 1);
+}
+
+static void bench_fft_r2c_int16 (void * state)
+{
+    FFT_STATE;
+    ne10_fft_r2c_1d_int16 (st->out, st->in, st->r2c_int16, 1);
+}
+
+static void bench_fft_c2r_int16 (void * state)
+{
+    FFT_STATE;
+    ne10_fft_c2r_1d_int16 (st->out, st->in, st->r2c_int16, 1);
+}
+
+/*
+ * Filters: an instance of each filter over blocks of size samples. The
+ * decimator and interpolator change the rate by NE10_BENCH_FIR_FACTOR.
+ */
+typedef struct
+{
+    ne10_uint32_t block;
+    ne10_float32_t * in;
+    ne10_float32_t * out;
+    ne10_float32_t * scratch;
+    ne10_float32_t * coeffs;
+    ne10_float32_t * state;
+    ne10_int32_t tap_delay[NE10_BENCH_FIR_TAPS];
+    ne10_fir_instance_f32_t fir;
+    ne10_fir_decimate_instance_f32_t decimate;
+    ne10_fir_interpolate_instance_f32_t interpolate;
+    ne10_fir_lattice_instance_f32_t lattice;
+    ne10_fir_sparse_instance_f32_t sparse;
+    ne10_iir_lattice_instance_f32_t iir;
+} ne10_bench_filter_state_t;
+
+static void bench_filter_teardown (void * state)
+{
+    ne10_bench_filter_state_t * st = (ne10_bench_filter_state_t *) state;
+
+    ne10_bench_free (st->in);
+    ne10_bench_free (st->out);
+    ne10_bench_free (st->scratch);
+    ne10_bench_free (st->coeffs);
+    ne10_bench_free (st->state);
+    free (st);
+}
+
+static void * bench_filter_setup (ne10_uint32_t block)
+{
+    ne10_bench_filter_state_t * st = (ne10_bench_filter_state_t *) calloc (1, sizeof (ne10_bench_filter_state_t));
+    // every filter has its own state, the largest being the sparse filter's
+    ne10_uint32_t state_size = NE10_BENCH_SPARSE_DELAY + block;
+    ne10_float32_t * s;
+    ne10_uint32_t i;
+
+    if (st == NULL)
+        return NULL;
+    st->block = block;
+    st->in = (ne10_float32_t *) ne10_bench_alloc (block * sizeof (ne10_float32_t));
+    st->out = (ne10_float32_t *) ne10_bench_alloc (block * NE10_BENCH_FIR_FACTOR * sizeof (ne10_float32_t));
+    st->scratch = (ne10_float32_t *) ne10_bench_alloc (block * sizeof (ne10_float32_t));
+    st->coeffs = (ne10_float32_t *) ne10_bench_alloc ( (NE10_BENCH_FIR_TAPS + NE10_BENCH_IIR_STAGES + 1) * sizeof (ne10_float32_t));
+    st->state = (ne10_float32_t *) ne10_bench_alloc (6 * state_size * sizeof (ne10_float32_t));
+    if (st->in == NULL || st->out == NULL || st->scratch == NULL || st->coeffs == NULL || st->state == NULL)
+    {
+        bench_filter_teardown (st);
+        return NULL;
+    }
+
+    // keep the lattice reflection coefficients inside (-1, 1)
+    for (i = 0; i < NE10_BENCH_FIR_TAPS + NE10_BENCH_IIR_STAGES + 1; i++)
+        st->coeffs[i] *= 0.25f;
+    for (i = 0; i < NE10_BENCH_FIR_TAPS; i++)
+        st->tap_delay[i] = i * (NE10_BENCH_SPARSE_DELAY / NE10_BENCH_FIR_TAPS);
+
+    s = st->state;
+    if (ne10_fir_init_float (&st->fir, NE10_BENCH_FIR_TAPS, st->coeffs, s, block) != NE10_OK
+            || ne10_fir_decimate_init_float (&st->decimate, NE10_BENCH_FIR_TAPS, NE10_BENCH_FIR_FACTOR,
+                    st->coeffs, s + state_size, block) != NE10_OK
+            || ne10_fir_interpolate_init_float (&st->interpolate, NE10_BENCH_FIR_FACTOR, NE10_BENCH_FIR_TAPS,
+                    st->coeffs, s + 2 * state_size, block) != NE10_OK
+            || ne10_fir_lattice_init_float (&st->lattice, NE10_BENCH_FIR_TAPS, st->coeffs,
+                    s + 3 * state_size) != NE10_OK
+            || ne10_fir_sparse_init_float (&st->sparse, NE10_BENCH_FIR_TAPS, st->coeffs, s + 4 * state_size,
+                    st->tap_delay, NE10_BENCH_SPARSE_DELAY, block) != NE10_OK
+            || ne10_iir_lattice_init_float (&st->iir, NE10_BENCH_IIR_STAGES, st->coeffs,
+                    st->coeffs + NE10_BENCH_IIR_STAGES, s + 5 * state_size, block) != NE10_OK)
+    {
+        bench_filter_teardown (st);
+        return NULL;
+    }
+    return st;
+}
+
+#define FILTER_STATE ne10_bench_filter_state_t * st = (ne10_bench_filter_state_t *) state
+
+static void bench_fir_float (void * state)
+{
+    FILTER_STATE;
+    ne10_fir_float (&st->fir, st->in, st->out, st->block);
+}
+
+static void bench_fir_decimate_float (void * state)
+{
+    FILTER_STATE;
+    ne10_fir_decimate_float (&st->decimate, st->in, st->out, st->block);
+}
+
+static void bench_fir_interpolate_float (void * state)
+{
+    FILTER_STATE;
+    ne10_fir_interpolate_float (&st->interpolate, st->in, st->out, st->block);
+}
+
+static void bench_fir_lattice_float (void * state)
+{
+    FILTER_STATE;
+    ne10_fir_lattice_float (&st->lattice, st->in, st->out, st->block);
+}
+
+static void bench_fir_sparse_float (void * state)
+{
+    FILTER_STATE;
+    ne10_fir_sparse_float (&st->sparse, st->in, st->out, st->scratch, st->block);
+}
+
+static void bench_iir_lattice_float (void * state)
+{
+    FILTER_STATE;
+    ne10_iir_lattice_float (&st->iir, st->in, st->out, st->block);
+}
+
+/*
+ * name, run, bytes per sample of input and output, and flops per sample
+ * (0 for the fixed-point transforms). The transforms count 5 N log2 N flops
+ * for a complex transform and half that for a real one, and each filter
+ * the multiply-accumulates of its taps or stages.
+ */
+static const struct
+{
+    const char * name;
+    ne10_bench_run_t run;
+    ne10_float64_t bytes;
+    ne10_float64_t flops;
+} bench_fft_functions[] =
+{
+    { "ne10_fft_c2c_1d_float32", bench_fft_c2c_float32, 16, 5 },
+    { "ne10_fft_c2c_1d_float32_inverse", bench_fft_c2c_float32_inverse, 16, 5 },
+    { "ne10_fft_r2c_1d_float32", bench_fft_r2c_float32, 12, 2.5 },
+    { "ne10_fft_c2r_1d_float32", bench_fft_c2r_float32, 12, 2.5 },
+    { "ne10_fft_c2c_1d_int32", bench_fft_c2c_int32, 16, 0 },
+    { "ne10_fft_c2c_1d_int32_inverse", bench_fft_c2c_int32_inverse, 16, 0 },
+    { "ne10_fft_r2c_1d_int32", bench_fft_r2c_int32, 12, 0 },
+    { "ne10_fft_c2r_1d_int32", bench_fft_c2r_int32, 12, 0 },
+    { "ne10_fft_c2c_1d_int16", bench_fft_c2c_int16, 8, 0 },
+    { "ne10_fft_c2c_1d_int16_inverse", bench_fft_c2c_int16_inverse, 8, 0 },
+    { "ne10_fft_r2c_1d_int16", bench_fft_r2c_int16, 6, 0 },
+    { "ne10_fft_c2r_1d_int16", bench_fft_c2r_int16, 6, 0 },
+}, bench_filter_functions[] =
+{
+    { "ne10_fir_float", bench_fir_float, 8, 2 * NE10_BENCH_FIR_TAPS },
+    { "ne10_fir_decimate_float", bench_fir_decimate_float, 4 + 4.0 / NE10_BENCH_FIR_FACTOR, 2.0 * NE10_BENCH_FIR_TAPS / NE10_BENCH_FIR_FACTOR },
+    { "ne10_fir_interpolate_float", bench_fir_interpolate_float, 4 + 4 * NE10_BENCH_FIR_FACTOR, 2 * NE10_BENCH_FIR_TAPS },
+    { "ne10_fir_lattice_float", bench_fir_lattice_float, 8, 4 * NE10_BENCH_FIR_TAPS },
+    { "ne10_fir_sparse_float", bench_fir_sparse_float, 8, 2 * NE10_BENCH_FIR_TAPS },
+    { "ne10_iir_lattice_float", bench_iir_lattice_float, 8, 6 * NE10_BENCH_IIR_STAGES + 2 },
+};
+
+void ne10_bench_register_dsp (void)
+{
+    static const ne10_uint32_t fft_sizes[] = { 256, 1024, 4096 };
+    static const ne10_uint32_t blocks[] = { 256, 4096 };
+    ne10_bench_case_t c;
+    ne10_uint32_t i, s;
+
+    c.module = "dsp";
+    c.setup = bench_fft_setup;
+    c.teardown = bench_fft_teardown;
+    for (i = 0; i < sizeof (bench_fft_functions) / sizeof (bench_fft_functions[0]); i++)
+    {
+        for (s = 0; s < sizeof (fft_sizes) / sizeof (fft_sizes[0]); s++)
+        {
+            ne10_float64_t n = fft_sizes[s];
+            ne10_float64_t log2n = 0;
+            ne10_uint32_t m;
+
+            for (m = fft_sizes[s]; m > 1; m >>= 1)
+                log2n++;
+            snprintf (c.name, sizeof (c.name), "%s", bench_fft_functions[i].name);
+            c.size = fft_sizes[s];
+            c.items = n;
+            c.bytes = n * bench_fft_functions[i].bytes;
+            c.flops = n * log2n * bench_fft_functions[i].flops;
+            c.run = bench_fft_functions[i].run;
+            ne10_bench_add (&c);
+        }
+    }
+
+    c.setup = bench_filter_setup;
+    c.teardown = bench_filter_teardown;
+    for (i = 0; i < sizeof (bench_filter_functions) / sizeof (bench_filter_functions[0]); i++)
+    {
+        for (s = 0; s < sizeof (blocks) / sizeof (blocks[0]); s++)
+        {
+            snprintf (c.name, sizeof (c.name), "%s", bench_filter_functions[i].name);
+            c.size = blocks[s];
+            c.items = blocks[s];
+            c.bytes = blocks[s] * bench_filter_functions[i].bytes;
+            c.flops = blocks[s] * bench_filter_functions[i].flops;
+            c.run = bench_filter_functions[i].run;
+            ne10_bench_add (&c);
+        }
+    }
+}
@@ -30,7 +30,11 @@
  */
 
 #include "seatest.h"
+#include "unit_test_common.h"
 
+#if defined (NE10_ENABLE_X86)
+void test_fixture_dsp_x86 (void);
+#else
 void test_fixture_fft_c2c_1d_float32 (void);
 void test_fixture_fft_c2c_1d_int32 (void);
 void test_fixture_fft_c2c_1d_int16 (void);
@@ -43,9 +47,15 @@ void test_fixture_fir_interpolate (void);
 void test_fixture_fir_lattice (void);
 void test_fixture_fir_sparse (void);
 void test_fixture_iir_lattice (void);
+#endif // NE10_ENABLE_X86
+void test_fixture_alloc (void);
 
 void all_tests (void)
 {
+#if defined (NE10_ENABLE_X86)
+    // x86 builds have no NEON versions to test, only the SSE4.1 and AVX2 ones
+    test_fixture_dsp_x86();
+#else
     test_fixture_fft_c2c_1d_float32();
     test_fixture_fft_r2c_1d_float32();
     test_fixture_fft_c2c_1d_int32();
@@ -58,6 +68,8 @@ void all_tests (void)
     test_fixture_fir_lattice();
     test_fixture_fir_sparse();
     test_fixture_iir_lattice();
+#endif // NE10_ENABLE_X86
+    test_fixture_alloc();
 }
 
 
@@ -73,7 +85,8 @@ void my_suite_teardown (void)
 
 int main (ne10_int32_t argc, char** argv)
 {
+    ne10_test_init (argc, argv);
     suite_setup (my_suite_setup);
     suite_teardown (my_suite_teardown);
-    return !run_tests (all_tests);
+    return ne10_test_finish (run_tests (all_tests));
 }
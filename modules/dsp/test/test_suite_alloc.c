@@ -0,0 +1,233 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_alloc.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "NE10_dsp.h"
+#include "NE10_init.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define TEST_ARENA_SIZE (512 * 1024)
+
+/* a power of two, and a size that goes through the generic radix butterflies */
+static const ne10_int32_t test_sizes[] = { 1024, 840 };
+
+#define TEST_SIZE_COUNT (sizeof (test_sizes) / sizeof (test_sizes[0]))
+#define TEST_NFFT_MAX 1024
+
+static ne10_uint8_t *arena_buffer = NULL;
+static ne10_fft_cpx_float32_t *in = NULL;
+static ne10_fft_cpx_float32_t *out_default = NULL;
+static ne10_fft_cpx_float32_t *out_arena = NULL;
+
+/* Hooks that count the blocks allocated through them */
+static ne10_int32_t counting_live = 0;
+static ne10_int32_t counting_calls = 0;
+static size_t counting_size = 0;
+
+static void *counting_alloc (size_t size, ne10_uint32_t alignment, void *context)
+{
+    void *ptr = NULL;
+
+    (void) context;
+    counting_size = size;
+    if (posix_memalign (&ptr, alignment, size) != 0)
+    {
+        return NULL;
+    }
+    counting_live++;
+    counting_calls++;
+    return ptr;
+}
+
+static void counting_free (void *ptr, void *context)
+{
+    (void) context;
+    counting_live--;
+    free (ptr);
+}
+
+static ne10_int32_t in_arena (const ne10_arena_t *arena, const void *ptr)
+{
+    return (const ne10_uint8_t *) ptr >= arena->base
+           && (const ne10_uint8_t *) ptr < arena->base + arena->size;
+}
+
+/* ----------------------------------------------------------------------
+** Test cases
+** ------------------------------------------------------------------- */
+
+void test_alloc_arena()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_arena_t arena;
+    ne10_allocator_t allocator;
+    ne10_fft_cfg_float32_t cfg_default, cfg_arena;
+    ne10_uint32_t i, used;
+
+    FILL_FLOAT_ARRAY ( (ne10_float32_t *) in, TEST_NFFT_MAX * 2);
+
+    assert_int_equal (NE10_OK, ne10_arena_init (&arena, arena_buffer, TEST_ARENA_SIZE));
+    ne10_arena_allocator (&allocator, &arena);
+
+    for (i = 0; i < TEST_SIZE_COUNT; i++)
+    {
+        ne10_int32_t nfft = test_sizes[i];
+        fprintf (stdout, "%-30s %d\n", "arena c2c float32", nfft);
+
+        cfg_default = ne10_fft_alloc_c2c_float32 (nfft);
+        assert_true (cfg_default != NULL);
+        assert_int_equal (0, (uintptr_t) cfg_default % NE10_MEMORY_ALIGNMENT);
+
+        assert_int_equal (NE10_OK, ne10_set_allocator (&allocator));
+        cfg_arena = ne10_fft_alloc_c2c_float32 (nfft);
+        assert_true (cfg_arena != NULL);
+        assert_true (in_arena (&arena, cfg_arena));
+        assert_int_equal (0, (uintptr_t) cfg_arena % NE10_MEMORY_ALIGNMENT);
+
+        // The scratch memory taken during the call is given back at its end
+        used = arena.used;
+        ne10_fft_c2c_1d_float32 (out_arena, in, cfg_arena, 0);
+        assert_int_equal (used, arena.used);
+        ne10_fft_destroy_c2c_float32 (cfg_arena);
+        assert_int_equal (0, arena.used);
+        assert_true (arena.peak >= used);
+
+        // The configurations do not depend on where they were allocated
+        assert_int_equal (NE10_OK, ne10_set_allocator (NULL));
+        ne10_fft_c2c_1d_float32 (out_default, in, cfg_default, 0);
+        assert_true (memcmp (out_default, out_arena, nfft * sizeof (ne10_fft_cpx_float32_t)) == 0);
+        ne10_fft_destroy_c2c_float32 (cfg_default);
+    }
+
+    // An arena that is too small makes the allocation fail cleanly
+    assert_int_equal (NE10_OK, ne10_arena_init (&arena, arena_buffer, 256));
+    assert_int_equal (NE10_OK, ne10_set_allocator (&allocator));
+    assert_true (ne10_fft_alloc_c2c_float32 (1024) == NULL);
+    assert_true (ne10_fft_alloc_r2c_float32 (1024) == NULL);
+    assert_int_equal (0, arena.used);
+
+    // A block freed below the top is only given back by a reset
+    assert_int_equal (NE10_OK, ne10_arena_init (&arena, arena_buffer, TEST_ARENA_SIZE));
+    {
+        void *a = ne10_malloc (100);
+        void *b = ne10_malloc (100);
+        assert_true (a != NULL && b != NULL);
+        assert_int_equal (0, (uintptr_t) b % NE10_MEMORY_ALIGNMENT);
+        ne10_free (a);
+        used = arena.used;
+        assert_true (used > 0);
+        ne10_free (b);
+        assert_true (arena.used < used);
+        ne10_arena_reset (&arena);
+        assert_int_equal (0, arena.used);
+    }
+    assert_int_equal (NE10_OK, ne10_set_allocator (NULL));
+#endif
+}
+
+void test_alloc_hooks()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_allocator_t allocator = { counting_alloc, NULL, NULL };
+    ne10_allocator_t current;
+    ne10_fft_cfg_float32_t cfg;
+    ne10_fft_r2c_cfg_float32_t cfg_r2c;
+    ne10_fft_cfg_int32_t cfg_int32;
+
+    assert_int_equal (NE10_ERR, ne10_set_allocator (&allocator));
+    allocator.free = counting_free;
+    assert_int_equal (NE10_OK, ne10_set_allocator (&allocator));
+    ne10_get_allocator (&current);
+    assert_true (current.alloc == counting_alloc && current.free == counting_free);
+
+    counting_live = 0;
+    counting_calls = 0;
+    cfg = ne10_fft_alloc_c2c_float32 (840);
+    cfg_r2c = ne10_fft_alloc_r2c_float32 (1024);
+    cfg_int32 = ne10_fft_alloc_c2c_int32 (1024);
+    assert_true (cfg != NULL && cfg_r2c != NULL && cfg_int32 != NULL);
+    assert_int_equal (3, counting_live);
+
+    ne10_fft_c2c_1d_float32 (out_arena, in, cfg, 0);
+    assert_int_equal (3, counting_live);
+
+    ne10_fft_destroy_c2c_float32 (cfg);
+    ne10_fft_destroy_r2c_float32 (cfg_r2c);
+    ne10_fft_destroy_c2c_int32 (cfg_int32);
+    assert_int_equal (0, counting_live);
+    assert_true (counting_calls >= 3);
+
+    // The size reaches the hook whole, even beyond 32 bits
+    assert_true (ne10_malloc ( (size_t) -1) == NULL);
+    assert_true (counting_size == (size_t) -1);
+    assert_int_equal (0, counting_live);
+
+    assert_int_equal (NE10_OK, ne10_set_allocator (NULL));
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_alloc (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The tests go through the function pointers, as applications do
+    ne10_init();
+
+    arena_buffer = (ne10_uint8_t *) malloc (TEST_ARENA_SIZE);
+    in = (ne10_fft_cpx_float32_t *) malloc (TEST_NFFT_MAX * sizeof (ne10_fft_cpx_float32_t));
+    out_default = (ne10_fft_cpx_float32_t *) malloc (TEST_NFFT_MAX * sizeof (ne10_fft_cpx_float32_t));
+    out_arena = (ne10_fft_cpx_float32_t *) malloc (TEST_NFFT_MAX * sizeof (ne10_fft_cpx_float32_t));
+
+    run_test (test_alloc_arena);        // run tests
+    run_test (test_alloc_hooks);
+
+    free (arena_buffer);
+    free (in);
+    free (out_default);
+    free (out_arena);
+
+    test_fixture_end();                 // ends a fixture
+}
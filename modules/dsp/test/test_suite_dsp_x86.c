@@ -0,0 +1,352 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_dsp_x86.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "NE10_dsp.h"
+#include "NE10_init.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+/* Max FFT Length and double buffer for real and imag */
+#define TEST_LENGTH_SAMPLES (4096)
+#define MIN_LENGTH_SAMPLES_CPX (4)
+
+/* Max FIR block size and number of taps */
+#define MAX_BLOCKSIZE 320
+#define MAX_NUMTAPS 100
+#define MAX_NUMFRAMES 16
+
+#define TEST_COUNT 5000
+
+typedef void (*ne10_fft_c2c_float32_func_t) (ne10_fft_cpx_float32_t *fout,
+        ne10_fft_cpx_float32_t *fin,
+        ne10_fft_cfg_float32_t cfg,
+        ne10_int32_t inverse_fft);
+typedef void (*ne10_fir_float_func_t) (const ne10_fir_instance_f32_t * S,
+                                       ne10_float32_t * pSrc,
+                                       ne10_float32_t * pDst,
+                                       ne10_uint32_t blockSize);
+
+typedef struct
+{
+    ne10_uint32_t blockSize;
+    ne10_uint32_t numTaps;
+    ne10_uint32_t numFrames;
+} test_fir_config;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static test_fir_config FIR_CONFIG[] =
+{
+    {64, 32, 5},
+    {64, 3, 5},
+    {64, 7, 5},
+    {64, 1, 5},
+    {5, 3, 16},
+    {2, 7, 16},
+    {4, 1, 16},
+    {32, 32, 10},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 4, 1},
+    {31, 100, 3},
+    {320, 17, 1},
+};
+#define NUM_FIR_TESTS (sizeof (FIR_CONFIG) / sizeof (FIR_CONFIG[0]) )
+#endif
+#ifdef PERFORMANCE_TEST
+static test_fir_config FIR_CONFIG_PERF[] =
+{
+    {64, 32, 5},
+    {64, 3, 5},
+    {64, 7, 5},
+};
+#define NUM_FIR_PERF_TESTS (sizeof (FIR_CONFIG_PERF) / sizeof (FIR_CONFIG_PERF[0]) )
+#endif
+
+//input and output
+static ne10_float32_t * guarded_in_c = NULL;
+static ne10_float32_t * guarded_in_x86 = NULL;
+static ne10_float32_t * in_c = NULL;
+static ne10_float32_t * in_x86 = NULL;
+
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_float32_t * guarded_out_x86 = NULL;
+static ne10_float32_t * out_c = NULL;
+static ne10_float32_t * out_x86 = NULL;
+
+static ne10_float32_t * guarded_coeffs = NULL;
+static ne10_float32_t * coeffs = NULL;
+static ne10_float32_t * guarded_fir_state_c = NULL;
+static ne10_float32_t * guarded_fir_state_x86 = NULL;
+static ne10_float32_t * fir_state_c = NULL;
+static ne10_float32_t * fir_state_x86 = NULL;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t snr = 0.0f;
+#endif
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_x86 = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+static void test_fft_c2c_1d_float32_x86 (const char *isa, ne10_fft_c2c_float32_func_t fft_x86)
+{
+    ne10_int32_t fftSize = 0;
+    ne10_int32_t inverse;
+    ne10_fft_cfg_float32_t cfg;
+
+    fprintf (stdout, "%s FFT\n", isa);
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    // Powers of two use the x86 butterflies; the others check the C fallback
+    for (fftSize = MIN_LENGTH_SAMPLES_CPX; fftSize <= TEST_LENGTH_SAMPLES; fftSize++)
+    {
+#if defined (SMOKE_TEST)
+        if ( (fftSize & (fftSize - 1)) && (fftSize % 15))
+            continue;
+#endif
+        cfg = ne10_fft_alloc_c2c_float32_c (fftSize);
+        if (cfg == NULL)
+        {
+            fprintf (stdout, "======ERROR, FFT alloc fails\n");
+            return;
+        }
+
+        for (inverse = 0; inverse <= 1; inverse++)
+        {
+            memcpy (in_x86, in_c, 2 * fftSize * sizeof (ne10_float32_t));
+
+            GUARD_ARRAY (out_c, fftSize * 2);
+            GUARD_ARRAY (out_x86, fftSize * 2);
+
+            ne10_fft_c2c_1d_float32_c ( (ne10_fft_cpx_float32_t*) out_c, (ne10_fft_cpx_float32_t*) in_c, cfg, inverse);
+            fft_x86 ( (ne10_fft_cpx_float32_t*) out_x86, (ne10_fft_cpx_float32_t*) in_x86, cfg, inverse);
+
+            assert_true (CHECK_ARRAY_GUARD (out_c, fftSize * 2));
+            assert_true (CHECK_ARRAY_GUARD (out_x86, fftSize * 2));
+
+            snr = CAL_SNR_FLOAT32 (out_c, out_x86, fftSize * 2);
+            assert_false ( (snr < SNR_THRESHOLD));
+        }
+
+        NE10_FREE (cfg);
+    }
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_int32_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "FFT Length", "C Time (micro-s)", "x86 Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (fftSize = 16; fftSize <= TEST_LENGTH_SAMPLES; fftSize *= 2)
+    {
+        cfg = ne10_fft_alloc_c2c_float32_c (fftSize);
+        if (cfg == NULL)
+        {
+            fprintf (stdout, "======ERROR, FFT alloc fails\n");
+            return;
+        }
+        ne10_int32_t test_loop = TEST_COUNT * 64 / fftSize;
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < test_loop; k++)
+                ne10_fft_c2c_1d_float32_c ( (ne10_fft_cpx_float32_t*) out_c, (ne10_fft_cpx_float32_t*) in_c, cfg, 0);
+        }
+        );
+        GET_TIME
+        (
+            time_x86,
+        {
+            for (k = 0; k < test_loop; k++)
+                fft_x86 ( (ne10_fft_cpx_float32_t*) out_x86, (ne10_fft_cpx_float32_t*) in_x86, cfg, 0);
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_x86;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_x86)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", fftSize, time_c, time_x86, time_savings, time_speedup);
+
+        NE10_FREE (cfg);
+    }
+#endif
+}
+
+static void test_fir_x86 (const char *isa, ne10_fir_float_func_t fir_x86)
+{
+    ne10_fir_instance_f32_t SC, SX;
+    ne10_uint32_t loop;
+    ne10_uint32_t block;
+    test_fir_config *config;
+
+    fprintf (stdout, "%s FIR\n", isa);
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    for (loop = 0; loop < NUM_FIR_TESTS; loop++)
+    {
+        config = &FIR_CONFIG[loop];
+        ne10_uint32_t length = config->blockSize * config->numFrames;
+
+        ne10_fir_init_float (&SC, config->numTaps, coeffs, fir_state_c, config->blockSize);
+        ne10_fir_init_float (&SX, config->numTaps, coeffs, fir_state_x86, config->blockSize);
+        memcpy (in_x86, in_c, length * sizeof (ne10_float32_t));
+
+        GUARD_ARRAY (out_c, length);
+        GUARD_ARRAY (out_x86, length);
+
+        for (block = 0; block < config->numFrames; block++)
+        {
+            ne10_fir_float_c (&SC, in_c + (block * config->blockSize), out_c + (block * config->blockSize), config->blockSize);
+            fir_x86 (&SX, in_x86 + (block * config->blockSize), out_x86 + (block * config->blockSize), config->blockSize);
+        }
+
+        assert_true (CHECK_ARRAY_GUARD (out_c, length));
+        assert_true (CHECK_ARRAY_GUARD (out_x86, length));
+
+        snr = CAL_SNR_FLOAT32 (out_c, out_x86, length);
+        assert_false ( (snr < SNR_THRESHOLD));
+        assert_float_vec_equal (out_c, out_x86, ERROR_MARGIN_SMALL, length);
+    }
+#endif
+
+#ifdef PERFORMANCE_TEST
+    ne10_uint32_t k;
+    fprintf (stdout, "%25s%20s%20s%20s%20s\n", "FIR Length&Taps", "C Time (micro-s)", "x86 Time (micro-s)", "Time Savings", "Performance Ratio");
+    for (loop = 0; loop < NUM_FIR_PERF_TESTS; loop++)
+    {
+        config = &FIR_CONFIG_PERF[loop];
+
+        ne10_fir_init_float (&SC, config->numTaps, coeffs, fir_state_c, config->blockSize);
+        ne10_fir_init_float (&SX, config->numTaps, coeffs, fir_state_x86, config->blockSize);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                for (block = 0; block < config->numFrames; block++)
+                {
+                    ne10_fir_float_c (&SC, in_c + (block * config->blockSize), out_c + (block * config->blockSize), config->blockSize);
+                }
+            }
+        }
+        );
+        GET_TIME
+        (
+            time_x86,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+            {
+                for (block = 0; block < config->numFrames; block++)
+                {
+                    fir_x86 (&SX, in_x86 + (block * config->blockSize), out_x86 + (block * config->blockSize), config->blockSize);
+                }
+            }
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_x86;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_x86)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%20d,%4d%20lld%20lld%19.2f%%%18.2f:1\n", config->numTaps, time_c, time_x86, time_savings, time_speedup);
+    }
+#endif
+}
+
+void test_dsp_x86()
+{
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    if (NE10_OK == ne10_HasSSE41())
+    {
+        test_fft_c2c_1d_float32_x86 ("SSE4.1", ne10_fft_c2c_1d_float32_sse);
+        test_fir_x86 ("SSE4.1", ne10_fir_float_sse);
+    }
+    else
+    {
+        fprintf (stdout, "SSE4.1 not supported by this CPU, skipped\n");
+    }
+
+    if (NE10_OK == ne10_HasAVX2())
+    {
+        test_fft_c2c_1d_float32_x86 ("AVX2", ne10_fft_c2c_1d_float32_avx2);
+        test_fir_x86 ("AVX2", ne10_fir_float_avx2);
+    }
+    else
+    {
+        fprintf (stdout, "AVX2 not supported by this CPU, skipped\n");
+    }
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_dsp_x86 (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The feature flags are only filled in by ne10_init
+    ne10_init();
+
+    NE10_SRC_ALLOC_LIMIT (in_c, guarded_in_c, TEST_LENGTH_SAMPLES * 2);
+    NE10_DST_ALLOC (in_x86, guarded_in_x86, TEST_LENGTH_SAMPLES * 2);
+    NE10_DST_ALLOC (out_c, guarded_out_c, TEST_LENGTH_SAMPLES * 2);
+    NE10_DST_ALLOC (out_x86, guarded_out_x86, TEST_LENGTH_SAMPLES * 2);
+    NE10_SRC_ALLOC_LIMIT (coeffs, guarded_coeffs, MAX_NUMTAPS);
+    NE10_DST_ALLOC (fir_state_c, guarded_fir_state_c, MAX_NUMTAPS + MAX_BLOCKSIZE);
+    NE10_DST_ALLOC (fir_state_x86, guarded_fir_state_x86, MAX_NUMTAPS + MAX_BLOCKSIZE);
+    memcpy (in_x86, in_c, TEST_LENGTH_SAMPLES * 2 * sizeof (ne10_float32_t));
+
+    run_test (test_dsp_x86);       // run tests
+
+    free (guarded_in_c);
+    free (guarded_in_x86);
+    free (guarded_out_c);
+    free (guarded_out_x86);
+    free (guarded_coeffs);
+    free (guarded_fir_state_c);
+    free (guarded_fir_state_x86);
+
+    test_fixture_end();                 // ends a fixture
+}
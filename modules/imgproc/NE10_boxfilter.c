@@ -72,6 +72,7 @@
  */
 
 #include "NE10.h"
+#include "NE10_separable.h"
 #include <stdlib.h>
 
 /* RGBA CHANNEL number is 4 */
@@ -332,82 +333,69 @@ void ne10_img_boxfilter_col_c (const ne10_uint8_t *src,
     }
 }
 
-/**
- * @ingroup groupIMGPROCs
- * @defgroup IMG_BOXFILTER Image Box Filter (Blur)
- */
-
-/**
- * @ingroup IMG_BOXFILTER
- * Specific implementation of @ref ne10_img_boxfilter_rgba8888 using plain C.
+/*
+ * boxfilter is separable filter, and then can be apply row filter and
+ * column filter sequentially. params points to the kernel size.
  */
-void ne10_img_boxfilter_rgba8888_c (const ne10_uint8_t *src,
-                                    ne10_uint8_t *dst,
-                                    ne10_size_t src_sz,
-                                    ne10_int32_t src_stride,
-                                    ne10_int32_t dst_stride,
-                                    ne10_size_t kernel)
+static void ne10_img_boxfilter_row_pass_c (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_sz,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_uint8_t *scratch,
+        const void *params)
 {
-    ne10_int32_t border_l, border_r, border_t, border_b;
+    ne10_size_t kernel = * (const ne10_size_t *) params;
+    ne10_int32_t border_l, border_r;
     ne10_point_t anchor;
 
-    assert (src != 0 && dst != 0);
-    assert (src_sz.x > 0 && src_sz.y > 0);
-    assert (src_stride > 0 && dst_stride > 0);
-    assert (kernel.x > 0 && kernel.x <= src_sz.x
-            && kernel.y > 0 && kernel.y <= src_sz.y);
-
     anchor.x = kernel.x / 2;
     anchor.y = kernel.y / 2;
 
-    ne10_uint8_t *dst_buf = (ne10_uint8_t *) malloc (sizeof (ne10_uint8_t) *
-                            src_sz.x *
-                            src_sz.y *
-                            RGBA_CH);
-
-    if (!dst_buf)
-    {
-        fprintf (stderr,
-                 "ERROR: buffer allocation fails!\nallocation size: %zu\n",
-                 sizeof (ne10_uint8_t) *
-                 src_sz.x *
-                 src_sz.y *
-                 RGBA_CH);
-        return;
-    }
-
-    ne10_int32_t dst_buf_stride = src_sz.x * RGBA_CH;
-
     /* compute the row border of dst image */
     ne10_img_boxfilter_row_border (src,
-                                   dst_buf,
+                                   dst,
                                    src_sz,
                                    src_stride,
-                                   dst_buf_stride,
+                                   dst_stride,
                                    kernel,
                                    anchor,
                                    &border_l,
                                    &border_r);
-    /* boxfilter is separable filter, and then can be apply row filter and
-     * column filter sequentially. here apply boxfilter's row part to image
-     */
+    /* here apply boxfilter's row part to image */
     ne10_img_boxfilter_row_c (src,
-                              dst_buf,
+                              dst,
                               src_sz,
                               src_stride,
-                              dst_buf_stride,
+                              dst_stride,
                               kernel,
                               anchor,
                               border_l,
                               border_r);
+}
+
+static void ne10_img_boxfilter_col_pass_c (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_sz,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_uint8_t *scratch,
+        const void *params)
+{
+    ne10_size_t kernel = * (const ne10_size_t *) params;
+    ne10_int32_t border_t, border_b;
+    ne10_point_t anchor;
+
+    anchor.x = kernel.x / 2;
+    anchor.y = kernel.y / 2;
 
     /* compute the column border of dst image,
      * which is based on previous row filter result.
      */
-    ne10_img_boxfilter_col_border (dst_buf,
+    ne10_img_boxfilter_col_border (src,
                                    dst,
                                    src_sz,
-                                   dst_buf_stride,
+                                   src_stride,
                                    dst_stride,
                                    kernel,
                                    anchor,
@@ -415,15 +403,48 @@ void ne10_img_boxfilter_rgba8888_c (const ne10_uint8_t *src,
                                    &border_b);
 
     /* apply boxfilter column filter to image */
-    ne10_img_boxfilter_col_c (dst_buf,
+    ne10_img_boxfilter_col_c (src,
                               dst,
                               src_sz,
-                              dst_buf_stride,
+                              src_stride,
                               dst_stride,
                               kernel,
                               anchor,
                               border_t,
                               border_b);
+}
+
+/**
+ * @ingroup groupIMGPROCs
+ * @defgroup IMG_BOXFILTER Image Box Filter (Blur)
+ */
+
+/**
+ * @ingroup IMG_BOXFILTER
+ * Specific implementation of @ref ne10_img_boxfilter_rgba8888 using plain C.
+ */
+void ne10_img_boxfilter_rgba8888_c (const ne10_uint8_t *src,
+                                    ne10_uint8_t *dst,
+                                    ne10_size_t src_sz,
+                                    ne10_int32_t src_stride,
+                                    ne10_int32_t dst_stride,
+                                    ne10_size_t kernel)
+{
+    assert (src != 0 && dst != 0);
+    assert (src_sz.x > 0 && src_sz.y > 0);
+    assert (src_stride > 0 && dst_stride > 0);
+    assert (kernel.x > 0 && kernel.x <= src_sz.x
+            && kernel.y > 0 && kernel.y <= src_sz.y);
 
-    free (dst_buf);
+    ne10_img_separable_rgba8888 (src,
+                                 dst,
+                                 src_sz,
+                                 src_stride,
+                                 dst_stride,
+                                 sizeof (ne10_uint8_t),
+                                 0,
+                                 ne10_img_boxfilter_row_pass_c,
+                                 ne10_img_boxfilter_col_pass_c,
+                                 &kernel,
+                                 NULL);
 }
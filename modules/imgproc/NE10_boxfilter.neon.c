@@ -30,6 +30,7 @@
  */
 
 #include "NE10.h"
+#include "NE10_separable.h"
 #include <stdlib.h>
 #include <math.h>
 #include <arm_neon.h>
@@ -266,7 +267,7 @@ void ne10_img_boxfilter_col_neon (const ne10_uint8_t *src,
              (kernel.y > 1));
 
     ne10_int32_t x, y, k;
-    ne10_uint16_t *sum_row = (ne10_uint16_t *) malloc (src_sz.x *
+    ne10_uint16_t *sum_row = (ne10_uint16_t *) NE10_MALLOC (src_sz.x *
                              RGBA_CH *
                              sizeof (ne10_uint16_t));
     ne10_uint16_t mul = (1 << DIV_SHIFT) / kernel.y;
@@ -406,81 +407,72 @@ void ne10_img_boxfilter_col_neon (const ne10_uint8_t *src,
         }
     }
 
-    free (sum_row);
+    NE10_FREE (sum_row);
 }
 
-/**
- * @ingroup IMG_BOXFILTER
- * Specific implementation of @ref ne10_img_boxfilter_rgba8888 using NEON SIMD capabilities.
- * Calls through to the non-optimised @ref ne10_img_boxfilter_rgba8888_c routine for
- * kernels with sides smaller than 2 pixels or larger than 127 pixels.
+/*
+ * the NEON row and column filters, after the same border computation as the C
+ * version. params points to the kernel size.
  */
-void ne10_img_boxfilter_rgba8888_neon (const ne10_uint8_t *src,
-                                       ne10_uint8_t *dst,
-                                       ne10_size_t src_sz,
-                                       ne10_int32_t src_stride,
-                                       ne10_int32_t dst_stride,
-                                       ne10_size_t kernel)
+static void ne10_img_boxfilter_row_pass_neon (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_sz,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_uint8_t *scratch,
+        const void *params)
 {
-    assert (src != 0 && dst != 0);
-    assert (src_sz.x > 0 && src_sz.y > 0);
-    assert (src_stride > 0 && dst_stride > 0);
-    assert (kernel.x > 0 && kernel.x <= src_sz.x
-            && kernel.y > 0 && kernel.y <= src_sz.y);
-
-    ne10_int32_t border_l, border_r, border_t, border_b;
+    ne10_size_t kernel = * (const ne10_size_t *) params;
+    ne10_int32_t border_l, border_r;
     ne10_point_t anchor;
 
     anchor.x = kernel.x / 2;
     anchor.y = kernel.y / 2;
 
-    /* the extra 2 elements here is reserved for pre-load when do row or column
-     * filter */
-    ne10_uint32_t mem_bytes = (sizeof (ne10_uint8_t) * src_sz.x * src_sz.y + 2)
-        * RGBA_CH;
-
-    ne10_uint8_t *dst_buf = (ne10_uint8_t *) malloc (mem_bytes);
-
-    if (!dst_buf)
-    {
-        fprintf (stderr,
-                 "ERROR: buffer allocation fails!\nallocation size: %d\n",
-                 mem_bytes);
-        return;
-    }
-
-    ne10_int32_t dst_buf_stride = src_sz.x * RGBA_CH;
-
     /* compute the row border of dst image */
     ne10_img_boxfilter_row_border (src,
-                                   dst_buf,
+                                   dst,
                                    src_sz,
                                    src_stride,
-                                   dst_buf_stride,
+                                   dst_stride,
                                    kernel,
                                    anchor,
                                    &border_l,
                                    &border_r);
-    /* boxfilter is separable filter, and then can be apply row filter and
-     * column filter sequentially. here apply boxfilter's row part to image
-     */
+    /* here apply boxfilter's row part to image */
     ne10_img_boxfilter_row_neon (src,
-                                 dst_buf,
+                                 dst,
                                  src_sz,
                                  src_stride,
-                                 dst_buf_stride,
+                                 dst_stride,
                                  kernel,
                                  anchor,
                                  border_l,
                                  border_r);
+}
+
+static void ne10_img_boxfilter_col_pass_neon (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_sz,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_uint8_t *scratch,
+        const void *params)
+{
+    ne10_size_t kernel = * (const ne10_size_t *) params;
+    ne10_int32_t border_t, border_b;
+    ne10_point_t anchor;
+
+    anchor.x = kernel.x / 2;
+    anchor.y = kernel.y / 2;
 
     /* compute the column border of dst image,
      * which is based on previous row filter result.
      */
-    ne10_img_boxfilter_col_border (dst_buf,
+    ne10_img_boxfilter_col_border (src,
                                    dst,
                                    src_sz,
-                                   dst_buf_stride,
+                                   src_stride,
                                    dst_stride,
                                    kernel,
                                    anchor,
@@ -488,15 +480,47 @@ void ne10_img_boxfilter_rgba8888_neon (const ne10_uint8_t *src,
                                    &border_b);
 
     /* apply boxfilter column filter to image */
-    ne10_img_boxfilter_col_neon (dst_buf,
+    ne10_img_boxfilter_col_neon (src,
                                  dst,
                                  src_sz,
-                                 dst_buf_stride,
+                                 src_stride,
                                  dst_stride,
                                  kernel,
                                  anchor,
                                  border_t,
                                  border_b);
+}
+
+/**
+ * @ingroup IMG_BOXFILTER
+ * Specific implementation of @ref ne10_img_boxfilter_rgba8888 using NEON SIMD capabilities.
+ * Calls through to the non-optimised @ref ne10_img_boxfilter_rgba8888_c routine for
+ * kernels with sides smaller than 2 pixels or larger than 127 pixels.
+ */
+void ne10_img_boxfilter_rgba8888_neon (const ne10_uint8_t *src,
+                                       ne10_uint8_t *dst,
+                                       ne10_size_t src_sz,
+                                       ne10_int32_t src_stride,
+                                       ne10_int32_t dst_stride,
+                                       ne10_size_t kernel)
+{
+    assert (src != 0 && dst != 0);
+    assert (src_sz.x > 0 && src_sz.y > 0);
+    assert (src_stride > 0 && dst_stride > 0);
+    assert (kernel.x > 0 && kernel.x <= src_sz.x
+            && kernel.y > 0 && kernel.y <= src_sz.y);
 
-    free (dst_buf);
+    /* the extra 2 elements here is reserved for pre-load when do row or column
+     * filter */
+    ne10_img_separable_rgba8888 (src,
+                                 dst,
+                                 src_sz,
+                                 src_stride,
+                                 dst_stride,
+                                 sizeof (ne10_uint8_t),
+                                 2 * RGBA_CH,
+                                 ne10_img_boxfilter_row_pass_neon,
+                                 ne10_img_boxfilter_col_pass_neon,
+                                 &kernel,
+                                 NULL);
 }
@@ -28,26 +28,46 @@
 #include <stdio.h>
 
 #include "NE10_imgproc.h"
+#include "NE10_trace.h"
 
 ne10_result_t ne10_init_imgproc (ne10_int32_t is_NEON_available)
 {
+#if !defined (NE10_ENABLE_X86)
     if (NE10_OK == is_NEON_available)
     {
         ne10_img_resize_bilinear_rgba = ne10_img_resize_bilinear_rgba_neon;
+        ne10_img_resize_plan_execute = ne10_img_resize_plan_execute_neon;
 
-#ifdef ENABLE_NE10_IMG_ROTATE_RGBA_NEON
         ne10_img_rotate_rgba = ne10_img_rotate_rgba_neon;
-#else
-        ne10_img_rotate_rgba = ne10_img_rotate_rgba_c;
-#endif
+        ne10_img_rotate_right_angle_rgba = ne10_img_rotate_right_angle_rgba_neon;
+        ne10_img_rotate_right_angle_inplace_rgba = ne10_img_rotate_right_angle_inplace_rgba_neon;
+        ne10_img_flip_rgba = ne10_img_flip_rgba_neon;
         ne10_img_boxfilter_rgba8888 = ne10_img_boxfilter_rgba8888_neon;
+        ne10_img_warp_affine_rgba = ne10_img_warp_affine_rgba_neon;
+        ne10_img_warp_perspective_rgba = ne10_img_warp_perspective_rgba_neon;
+        ne10_img_sepfilter_rgba8888 = ne10_img_sepfilter_rgba8888_neon;
+        ne10_img_gaussian_rgba8888 = ne10_img_gaussian_rgba8888_neon;
+        ne10_img_pyramid_rgba8888 = ne10_img_pyramid_rgba8888_neon;
     }
     else
+#endif // NE10_ENABLE_X86
     {
         ne10_img_resize_bilinear_rgba = ne10_img_resize_bilinear_rgba_c;
+        ne10_img_resize_plan_execute = ne10_img_resize_plan_execute_c;
         ne10_img_rotate_rgba = ne10_img_rotate_rgba_c;
+        ne10_img_rotate_right_angle_rgba = ne10_img_rotate_right_angle_rgba_c;
+        ne10_img_rotate_right_angle_inplace_rgba = ne10_img_rotate_right_angle_inplace_rgba_c;
+        ne10_img_flip_rgba = ne10_img_flip_rgba_c;
         ne10_img_boxfilter_rgba8888 = ne10_img_boxfilter_rgba8888_c;
+        ne10_img_warp_affine_rgba = ne10_img_warp_affine_rgba_c;
+        ne10_img_warp_perspective_rgba = ne10_img_warp_perspective_rgba_c;
+        ne10_img_sepfilter_rgba8888 = ne10_img_sepfilter_rgba8888_c;
+        ne10_img_gaussian_rgba8888 = ne10_img_gaussian_rgba8888_c;
+        ne10_img_pyramid_rgba8888 = ne10_img_pyramid_rgba8888_c;
     }
+#if defined (NE10_ENABLE_TRACE)
+    ne10_trace_wrap_imgproc ();
+#endif
     return NE10_OK;
 }
 
@@ -59,6 +79,11 @@ void (*ne10_img_resize_bilinear_rgba) (ne10_uint8_t* dst,
                                        ne10_uint32_t src_width,
                                        ne10_uint32_t src_height,
                                        ne10_uint32_t src_stride);
+void (*ne10_img_resize_plan_execute) (ne10_img_resize_plan_t plan,
+                                      ne10_uint8_t* dst,
+                                      ne10_uint32_t dst_stride,
+                                      ne10_uint8_t* src,
+                                      ne10_uint32_t src_stride);
 void (*ne10_img_rotate_rgba) (ne10_uint8_t* dst,
                               ne10_uint32_t* dst_width,
                               ne10_uint32_t* dst_height,
@@ -66,9 +91,74 @@ void (*ne10_img_rotate_rgba) (ne10_uint8_t* dst,
                               ne10_uint32_t src_width,
                               ne10_uint32_t src_height,
                               ne10_int32_t angle);
+void (*ne10_img_rotate_right_angle_rgba) (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_int32_t angle);
+void (*ne10_img_rotate_right_angle_inplace_rgba) (ne10_uint8_t *img,
+        ne10_uint32_t side,
+        ne10_int32_t stride,
+        ne10_int32_t angle);
+void (*ne10_img_flip_rgba) (const ne10_uint8_t *src,
+                            ne10_uint8_t *dst,
+                            ne10_size_t size,
+                            ne10_int32_t src_stride,
+                            ne10_int32_t dst_stride,
+                            ne10_img_flip_t flip);
 void (*ne10_img_boxfilter_rgba8888) (const ne10_uint8_t *src,
                                      ne10_uint8_t *dst,
                                      ne10_size_t src_size,
                                      ne10_int32_t src_stride,
                                      ne10_int32_t dst_stride,
                                      ne10_size_t kernel_size);
+void (*ne10_img_warp_affine_rgba) (const ne10_uint8_t *src,
+                                   ne10_uint8_t *dst,
+                                   ne10_size_t src_size,
+                                   ne10_int32_t src_stride,
+                                   ne10_size_t dst_size,
+                                   ne10_int32_t dst_stride,
+                                   const ne10_float32_t *matrix,
+                                   ne10_img_border_t border,
+                                   const ne10_uint8_t *border_value);
+void (*ne10_img_warp_perspective_rgba) (const ne10_uint8_t *src,
+                                        ne10_uint8_t *dst,
+                                        ne10_size_t src_size,
+                                        ne10_int32_t src_stride,
+                                        ne10_size_t dst_size,
+                                        ne10_int32_t dst_stride,
+                                        const ne10_float32_t *matrix,
+                                        ne10_img_border_t border,
+                                        const ne10_uint8_t *border_value);
+void (*ne10_img_sepfilter_rgba8888) (const ne10_uint8_t *src,
+                                     ne10_uint8_t *dst,
+                                     ne10_size_t src_size,
+                                     ne10_int32_t src_stride,
+                                     ne10_int32_t dst_stride,
+                                     const ne10_int16_t *kernel_x,
+                                     ne10_uint32_t ksize_x,
+                                     ne10_int32_t shift_x,
+                                     const ne10_int16_t *kernel_y,
+                                     ne10_uint32_t ksize_y,
+                                     ne10_int32_t shift_y,
+                                     ne10_int32_t delta,
+                                     ne10_img_border_t border,
+                                     const ne10_uint8_t *border_value);
+void (*ne10_img_gaussian_rgba8888) (const ne10_uint8_t *src,
+                                    ne10_uint8_t *dst,
+                                    ne10_size_t src_size,
+                                    ne10_int32_t src_stride,
+                                    ne10_int32_t dst_stride,
+                                    ne10_float32_t sigma,
+                                    ne10_img_border_t border,
+                                    const ne10_uint8_t *border_value,
+                                    ne10_uint8_t *buffer);
+ne10_result_t (*ne10_img_pyramid_rgba8888) (const ne10_uint8_t *src,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t levels,
+        ne10_int32_t laplacian,
+        ne10_uint8_t *arena,
+        ne10_uint32_t arena_size,
+        ne10_img_pyramid_level_t *pyramid);
@@ -0,0 +1,365 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_pyramid.c
+ */
+
+#include "NE10.h"
+#include "NE10_pyramid.h"
+
+/**
+ * @ingroup groupIMGPROCs
+ * @defgroup IMG_PYRAMID Image Pyramid
+ *
+ * \par
+ * A Gaussian pyramid is a sequence of images where each level is the previous one
+ * blurred by the 5x5 binomial kernel
+ * <pre>[1 4 6 4 1]^T [1 4 6 4 1] / 256</pre>
+ * and decimated by 2 in both directions, to ((w + 1) / 2) x ((h + 1) / 2) pixels. The
+ * blur is only evaluated at the pixels that are kept, and both passes of a row are
+ * done together, so every level is produced in a single pass over the previous one.
+ * Pixels beyond the image borders replicate the nearest edge pixel.
+ * \par
+ * The Laplacian residual of a level is the level minus the expansion of the next level
+ * (Burt and Adelson): the coarse level is upsampled by 2 with the same binomial kernel,
+ * and the difference is stored as int16.
+ * \par
+ * All levels are written into a single arena provided by the caller, whose size is
+ * given by @ref ne10_img_pyramid_buffer_size. Level 0 is the input image itself.
+ */
+
+static ne10_uint32_t ne10_img_pyramid_align (ne10_uint32_t bytes)
+{
+    return (bytes + NE10_PYRAMID_ALIGNMENT - 1) & ~ (NE10_PYRAMID_ALIGNMENT - 1);
+}
+
+static ne10_size_t ne10_img_pyramid_next_size (ne10_size_t size)
+{
+    ne10_size_t next = { (size.x + 1) / 2, (size.y + 1) / 2};
+    return next;
+}
+
+/* coarse rows and vertical weights of the expansion at fine row y */
+static void ne10_img_pyramid_expand_rows (const ne10_uint8_t *image,
+        ne10_int32_t stride,
+        ne10_int32_t height,
+        ne10_int32_t y,
+        const ne10_uint8_t **c,
+        ne10_uint8_t *w)
+{
+    ne10_int32_t r = y >> 1;
+    ne10_int32_t last = height - 1;
+
+    if ( (y & 1) == 0)
+    {
+        /* (1 6 1) / 8 around coarse row r */
+        c[0] = image + NE10_MAX (r - 1, 0) * stride;
+        c[1] = image + r * stride;
+        c[2] = image + NE10_MIN (r + 1, last) * stride;
+        w[0] = 1;
+        w[1] = 6;
+        w[2] = 1;
+    }
+    else
+    {
+        /* (4 4) / 8 between coarse rows r and r + 1 */
+        c[0] = image + r * stride;
+        c[1] = image + NE10_MIN (r + 1, last) * stride;
+        c[2] = c[1];
+        w[0] = 4;
+        w[1] = 4;
+        w[2] = 0;
+    }
+}
+
+/**
+ * @ingroup IMG_PYRAMID
+ * @brief Size of the arena needed by @ref ne10_img_pyramid_rgba8888.
+ *
+ * @param[in]   src_size     size of the base image
+ * @param[in]   levels       number of levels, including the base image
+ * @param[in]   laplacian    non-zero when Laplacian residuals are requested
+ * @return      size of the arena in bytes
+ */
+ne10_uint32_t ne10_img_pyramid_buffer_size (ne10_size_t src_size,
+        ne10_int32_t levels,
+        ne10_int32_t laplacian)
+{
+    ne10_size_t size = src_size;
+    /* scratch rows, then the alignment slack of the arena itself */
+    ne10_uint32_t bytes = ne10_img_pyramid_align ( (src_size.x + 8) * NE10_PYRAMID_CH * sizeof (ne10_uint16_t))
+                          + NE10_PYRAMID_ALIGNMENT;
+    ne10_int32_t i;
+
+    for (i = 0; i < levels; i++)
+    {
+        if (i > 0)
+            bytes += size.y * ne10_img_pyramid_align (size.x * NE10_PYRAMID_CH);
+        if (laplacian && (i < levels - 1))
+            bytes += ne10_img_pyramid_align (size.x * size.y * NE10_PYRAMID_CH * sizeof (ne10_int16_t));
+        size = ne10_img_pyramid_next_size (size);
+    }
+    return bytes;
+}
+
+ne10_result_t ne10_img_pyramid_generic_rgba8888 (const ne10_uint8_t *src,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t levels,
+        ne10_int32_t laplacian,
+        ne10_uint8_t *arena,
+        ne10_uint32_t arena_size,
+        ne10_img_pyramid_level_t *pyramid,
+        ne10_img_pyramid_down_row_t down_row,
+        ne10_img_pyramid_laplacian_row_t laplacian_row)
+{
+    ne10_uint16_t *scratch;
+    ne10_uint8_t *next;
+    uintptr_t address;
+    ne10_int32_t i, y;
+
+    if ( (src == NULL) || (arena == NULL) || (pyramid == NULL) || (levels < 1)
+            || (src_size.x == 0) || (src_size.y == 0)
+            || (arena_size < ne10_img_pyramid_buffer_size (src_size, levels, laplacian)))
+    {
+        return NE10_ERR;
+    }
+
+    address = (uintptr_t) arena;
+    NE10_BYTE_ALIGNMENT (address, NE10_PYRAMID_ALIGNMENT);
+    next = (ne10_uint8_t*) address;
+    scratch = (ne10_uint16_t*) next;
+    next += ne10_img_pyramid_align ( (src_size.x + 8) * NE10_PYRAMID_CH * sizeof (ne10_uint16_t));
+
+    pyramid[0].image = src;
+    pyramid[0].laplacian = NULL;
+    pyramid[0].size = src_size;
+    pyramid[0].stride = src_stride;
+
+    for (i = 1; i < levels; i++)
+    {
+        ne10_img_pyramid_level_t *cur = &pyramid[i];
+        ne10_img_pyramid_level_t *prev = &pyramid[i - 1];
+
+        cur->laplacian = NULL;
+        cur->size = ne10_img_pyramid_next_size (prev->size);
+        cur->stride = ne10_img_pyramid_align (cur->size.x * NE10_PYRAMID_CH);
+        cur->image = next;
+        next += cur->size.y * cur->stride;
+
+        /* blur and decimate */
+        for (y = 0; y < cur->size.y; y++)
+        {
+            const ne10_uint8_t *rows[5];
+            ne10_int32_t k;
+            for (k = 0; k < 5; k++)
+            {
+                ne10_int32_t sy = NE10_MAX (NE10_MIN (2 * y - 2 + k, (ne10_int32_t) prev->size.y - 1), 0);
+                rows[k] = prev->image + sy * prev->stride;
+            }
+            down_row (rows, (ne10_uint8_t*) cur->image + y * cur->stride,
+                      prev->size.x, cur->size.x, scratch);
+        }
+
+        /* residual of the previous level, while both levels are still warm */
+        if (laplacian)
+        {
+            prev->laplacian = (ne10_int16_t*) next;
+            next += ne10_img_pyramid_align (prev->size.x * prev->size.y * NE10_PYRAMID_CH * sizeof (ne10_int16_t));
+
+            for (y = 0; y < prev->size.y; y++)
+            {
+                const ne10_uint8_t *c[3];
+                ne10_uint8_t w[3];
+
+                ne10_img_pyramid_expand_rows (cur->image, cur->stride, cur->size.y, y, c, w);
+                laplacian_row (prev->image + y * prev->stride, c[0], c[1], c[2], w[0], w[1], w[2],
+                               prev->laplacian + y * prev->size.x * NE10_PYRAMID_CH,
+                               prev->size.x, cur->size.x, scratch);
+            }
+        }
+    }
+
+    return NE10_OK;
+}
+
+static void ne10_img_pyramid_down_row_c (const ne10_uint8_t **rows,
+        ne10_uint8_t *dst,
+        ne10_int32_t src_width,
+        ne10_int32_t dst_width,
+        ne10_uint16_t *scratch)
+{
+    /* vertical pass, into a row padded by two pixels on each side */
+    ne10_uint16_t *t = scratch + 2 * NE10_PYRAMID_CH;
+    ne10_int32_t count = src_width * NE10_PYRAMID_CH;
+    ne10_int32_t i, k;
+
+    for (i = 0; i < count; i++)
+    {
+        t[i] = rows[0][i] + 4 * rows[1][i] + 6 * rows[2][i] + 4 * rows[3][i] + rows[4][i];
+    }
+    for (k = 0; k < 2 * NE10_PYRAMID_CH; k++)
+    {
+        t[k - 2 * NE10_PYRAMID_CH] = t[k % NE10_PYRAMID_CH];
+        t[count + k] = t[count - NE10_PYRAMID_CH + k % NE10_PYRAMID_CH];
+    }
+
+    /* horizontal pass, at the even pixels only */
+    for (i = 0; i < dst_width * NE10_PYRAMID_CH; i++)
+    {
+        const ne10_uint16_t *p = t + 2 * i - (i % NE10_PYRAMID_CH);
+        ne10_uint32_t sum = p[-8] + 4 * p[-4] + 6 * p[0] + 4 * p[4] + p[8];
+        dst[i] = (sum + 128) >> 8;
+    }
+}
+
+static void ne10_img_pyramid_laplacian_row_c (const ne10_uint8_t *fine,
+        const ne10_uint8_t *c0,
+        const ne10_uint8_t *c1,
+        const ne10_uint8_t *c2,
+        ne10_uint8_t w0,
+        ne10_uint8_t w1,
+        ne10_uint8_t w2,
+        ne10_int16_t *dst,
+        ne10_int32_t fine_width,
+        ne10_int32_t coarse_width,
+        ne10_uint16_t *scratch)
+{
+    /* vertical pass, into a row padded by one pixel on each side */
+    ne10_uint16_t *v = scratch + NE10_PYRAMID_CH;
+    ne10_int32_t count = coarse_width * NE10_PYRAMID_CH;
+    ne10_int32_t i, k;
+
+    for (i = 0; i < count; i++)
+    {
+        v[i] = w0 * c0[i] + w1 * c1[i] + w2 * c2[i];
+    }
+    for (k = 0; k < NE10_PYRAMID_CH; k++)
+    {
+        v[k - NE10_PYRAMID_CH] = v[k];
+        v[count + k] = v[count - NE10_PYRAMID_CH + k];
+    }
+
+    /* horizontal pass: (1 6 1) / 8 at even pixels, (4 4) / 8 at odd pixels */
+    for (i = 0; i < fine_width * NE10_PYRAMID_CH; i++)
+    {
+        ne10_int32_t x = i / NE10_PYRAMID_CH;
+        const ne10_uint16_t *p = v + (x >> 1) * NE10_PYRAMID_CH + (i % NE10_PYRAMID_CH);
+        ne10_uint32_t sum = (x & 1) ? 4 * p[0] + 4 * p[4] : p[-4] + 6 * p[0] + p[4];
+        dst[i] = fine[i] - (ne10_int16_t) ( (sum + 32) >> 6);
+    }
+}
+
+/**
+ * @ingroup IMG_PYRAMID
+ * Specific implementation of @ref ne10_img_pyramid_rgba8888 using plain C.
+ */
+ne10_result_t ne10_img_pyramid_rgba8888_c (const ne10_uint8_t *src,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t levels,
+        ne10_int32_t laplacian,
+        ne10_uint8_t *arena,
+        ne10_uint32_t arena_size,
+        ne10_img_pyramid_level_t *pyramid)
+{
+    return ne10_img_pyramid_generic_rgba8888 (src, src_size, src_stride, levels, laplacian,
+            arena, arena_size, pyramid,
+            ne10_img_pyramid_down_row_c,
+            ne10_img_pyramid_laplacian_row_c);
+}
+
+/**
+ * @ingroup IMG_PYRAMID
+ * @brief Expansion of a pyramid level, optionally plus a Laplacian residual.
+ *
+ * @param[in]   *coarse        pointer to the coarse level
+ * @param[in]   coarse_size    size of the coarse level
+ * @param[in]   coarse_stride  coarse level stride, in bytes
+ * @param[in]   *laplacian     residual of the fine level, rows of dst_size.x * 4 values, or NULL
+ * @param[out]  *dst           pointer to the fine level
+ * @param[in]   dst_size       size of the fine level
+ * @param[in]   dst_stride     fine level stride, in bytes
+ * @return      NE10_OK, or NE10_ERR if the arguments are invalid
+ *
+ * The coarse level is upsampled with the kernel used for the residuals of
+ * @ref ne10_img_pyramid_rgba8888, so that the expansion of pyramid[i + 1].image plus
+ * pyramid[i].laplacian is pyramid[i].image. The result saturates to [0, 255], which only
+ * matters when the residuals or the coarse level have been modified.
+ */
+ne10_result_t ne10_img_pyramid_expand_rgba8888 (const ne10_uint8_t *coarse,
+        ne10_size_t coarse_size,
+        ne10_int32_t coarse_stride,
+        const ne10_int16_t *laplacian,
+        ne10_uint8_t *dst,
+        ne10_size_t dst_size,
+        ne10_int32_t dst_stride)
+{
+    ne10_int32_t x, y, k;
+
+    if ( (coarse == NULL) || (dst == NULL) || (dst_size.x == 0) || (dst_size.y == 0)
+            || (coarse_size.x != (dst_size.x + 1) / 2) || (coarse_size.y != (dst_size.y + 1) / 2))
+    {
+        return NE10_ERR;
+    }
+
+    for (y = 0; y < dst_size.y; y++)
+    {
+        const ne10_uint8_t *c[3];
+        ne10_uint8_t w[3];
+        ne10_uint8_t *d = dst + y * dst_stride;
+
+        ne10_img_pyramid_expand_rows (coarse, coarse_stride, coarse_size.y, y, c, w);
+
+        for (x = 0; x < dst_size.x; x++)
+        {
+            /* coarse columns left of, at and right of x / 2, replicated at the borders */
+            ne10_int32_t j = x >> 1;
+            ne10_int32_t j0 = NE10_MAX (j - 1, 0) * NE10_PYRAMID_CH;
+            ne10_int32_t j1 = j * NE10_PYRAMID_CH;
+            ne10_int32_t j2 = NE10_MIN (j + 1, (ne10_int32_t) coarse_size.x - 1) * NE10_PYRAMID_CH;
+
+            for (k = 0; k < NE10_PYRAMID_CH; k++)
+            {
+                ne10_uint32_t v0 = w[0] * c[0][j0 + k] + w[1] * c[1][j0 + k] + w[2] * c[2][j0 + k];
+                ne10_uint32_t v1 = w[0] * c[0][j1 + k] + w[1] * c[1][j1 + k] + w[2] * c[2][j1 + k];
+                ne10_uint32_t v2 = w[0] * c[0][j2 + k] + w[1] * c[1][j2 + k] + w[2] * c[2][j2 + k];
+                ne10_uint32_t sum = (x & 1) ? 4 * v1 + 4 * v2 : v0 + 6 * v1 + v2;
+                ne10_int32_t value = (ne10_int32_t) ( (sum + 32) >> 6);
+
+                if (laplacian != NULL)
+                {
+                    value += laplacian[ (y * dst_size.x + x) * NE10_PYRAMID_CH + k];
+                }
+                d[x * NE10_PYRAMID_CH + k] = (ne10_uint8_t) NE10_MAX (NE10_MIN (value, 255), 0);
+            }
+        }
+    }
+
+    return NE10_OK;
+}
@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_pyramid.h
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+
+#ifndef NE10_PYRAMID_H
+#define NE10_PYRAMID_H
+
+///////////////////////////
+// Internal macro define
+///////////////////////////
+
+/* RGBA CHANNEL number is 4 */
+#define NE10_PYRAMID_CH         4
+/* alignment of the level images and rows in the arena */
+#define NE10_PYRAMID_ALIGNMENT  16
+
+/*
+ * Blur and decimate: one row of the next level from the five rows of the
+ * current level around it. scratch holds src_width + 8 pixels of uint16.
+ */
+typedef void (*ne10_img_pyramid_down_row_t) (const ne10_uint8_t **rows,
+        ne10_uint8_t *dst,
+        ne10_int32_t src_width,
+        ne10_int32_t dst_width,
+        ne10_uint16_t *scratch);
+
+/*
+ * Laplacian residual of one row: fine minus the expansion of the coarse rows
+ * c0, c1, c2, weighted vertically by w0, w1, w2 (which sum to 8).
+ */
+typedef void (*ne10_img_pyramid_laplacian_row_t) (const ne10_uint8_t *fine,
+        const ne10_uint8_t *c0,
+        const ne10_uint8_t *c1,
+        const ne10_uint8_t *c2,
+        ne10_uint8_t w0,
+        ne10_uint8_t w1,
+        ne10_uint8_t w2,
+        ne10_int16_t *dst,
+        ne10_int32_t fine_width,
+        ne10_int32_t coarse_width,
+        ne10_uint16_t *scratch);
+
+extern ne10_result_t ne10_img_pyramid_generic_rgba8888 (const ne10_uint8_t *src,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t levels,
+        ne10_int32_t laplacian,
+        ne10_uint8_t *arena,
+        ne10_uint32_t arena_size,
+        ne10_img_pyramid_level_t *pyramid,
+        ne10_img_pyramid_down_row_t down_row,
+        ne10_img_pyramid_laplacian_row_t laplacian_row);
+
+#endif // NE10_PYRAMID_H
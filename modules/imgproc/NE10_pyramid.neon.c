@@ -0,0 +1,209 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_pyramid.neon.c
+ */
+
+#include <arm_neon.h>
+
+#include "NE10.h"
+#include "NE10_pyramid.h"
+
+/*
+ * The vertical pass writes the even and the odd pixels of the row to two
+ * separate arrays, E and O, so that the decimating horizontal pass only needs
+ * contiguous loads: output pixel x is
+ * E[x - 1] + 4 * O[x - 1] + 6 * E[x] + 4 * O[x] + E[x + 1].
+ */
+static void ne10_img_pyramid_down_row_neon (const ne10_uint8_t **rows,
+        ne10_uint8_t *dst,
+        ne10_int32_t src_width,
+        ne10_int32_t dst_width,
+        ne10_uint16_t *scratch)
+{
+    /* E spans pixels -1 .. dst_width, O spans -1 .. dst_width - 1 */
+    ne10_uint16_t *E = scratch + NE10_PYRAMID_CH;
+    ne10_uint16_t *O = E + (dst_width + 2) * NE10_PYRAMID_CH;
+    const ne10_uint16_t *edge;
+    uint8x8_t six_u8 = vdup_n_u8 (6);
+    uint16x8_t six = vdupq_n_u16 (6);
+    ne10_int32_t x, k;
+
+    /* vertical pass, four pixels per iteration */
+    for (x = 0; x + 4 <= src_width; x += 4)
+    {
+        uint8x16_t r0 = vld1q_u8 (rows[0] + x * NE10_PYRAMID_CH);
+        uint8x16_t r1 = vld1q_u8 (rows[1] + x * NE10_PYRAMID_CH);
+        uint8x16_t r2 = vld1q_u8 (rows[2] + x * NE10_PYRAMID_CH);
+        uint8x16_t r3 = vld1q_u8 (rows[3] + x * NE10_PYRAMID_CH);
+        uint8x16_t r4 = vld1q_u8 (rows[4] + x * NE10_PYRAMID_CH);
+        uint16x8_t lo, hi;
+
+        lo = vaddl_u8 (vget_low_u8 (r0), vget_low_u8 (r4));
+        lo = vaddq_u16 (lo, vshlq_n_u16 (vaddl_u8 (vget_low_u8 (r1), vget_low_u8 (r3)), 2));
+        lo = vmlal_u8 (lo, vget_low_u8 (r2), six_u8);
+        hi = vaddl_u8 (vget_high_u8 (r0), vget_high_u8 (r4));
+        hi = vaddq_u16 (hi, vshlq_n_u16 (vaddl_u8 (vget_high_u8 (r1), vget_high_u8 (r3)), 2));
+        hi = vmlal_u8 (hi, vget_high_u8 (r2), six_u8);
+
+        vst1q_u16 (E + (x >> 1) * NE10_PYRAMID_CH, vcombine_u16 (vget_low_u16 (lo), vget_low_u16 (hi)));
+        vst1q_u16 (O + (x >> 1) * NE10_PYRAMID_CH, vcombine_u16 (vget_high_u16 (lo), vget_high_u16 (hi)));
+    }
+    for (; x < src_width; x++)
+    {
+        ne10_uint16_t *t = ( (x & 1) ? O : E) + (x >> 1) * NE10_PYRAMID_CH;
+        for (k = 0; k < NE10_PYRAMID_CH; k++)
+        {
+            ne10_int32_t i = x * NE10_PYRAMID_CH + k;
+            t[k] = rows[0][i] + 4 * rows[1][i] + 6 * rows[2][i] + 4 * rows[3][i] + rows[4][i];
+        }
+    }
+
+    /* replicate the first and last pixels */
+    edge = ( ( (src_width - 1) & 1) ? O : E) + ( (src_width - 1) >> 1) * NE10_PYRAMID_CH;
+    for (k = 0; k < NE10_PYRAMID_CH; k++)
+    {
+        E[k - NE10_PYRAMID_CH] = E[k];
+        O[k - NE10_PYRAMID_CH] = E[k];
+        E[dst_width * NE10_PYRAMID_CH + k] = edge[k];
+        if (src_width & 1)
+            O[ (dst_width - 1) * NE10_PYRAMID_CH + k] = edge[k];
+    }
+
+    /* horizontal pass, two output pixels per iteration */
+    for (x = 0; x + 2 <= dst_width; x += 2)
+    {
+        uint16x8_t s = vaddq_u16 (vld1q_u16 (E + (x - 1) * NE10_PYRAMID_CH),
+                                  vld1q_u16 (E + (x + 1) * NE10_PYRAMID_CH));
+        s = vaddq_u16 (s, vshlq_n_u16 (vaddq_u16 (vld1q_u16 (O + (x - 1) * NE10_PYRAMID_CH),
+                                       vld1q_u16 (O + x * NE10_PYRAMID_CH)), 2));
+        s = vmlaq_u16 (s, vld1q_u16 (E + x * NE10_PYRAMID_CH), six);
+        vst1_u8 (dst + x * NE10_PYRAMID_CH, vrshrn_n_u16 (s, 8));
+    }
+    for (; x < dst_width; x++)
+    {
+        for (k = 0; k < NE10_PYRAMID_CH; k++)
+        {
+            ne10_int32_t i = x * NE10_PYRAMID_CH + k;
+            ne10_uint32_t sum = E[i - NE10_PYRAMID_CH] + 4 * O[i - NE10_PYRAMID_CH] + 6 * E[i]
+                                + 4 * O[i] + E[i + NE10_PYRAMID_CH];
+            dst[i] = (sum + 128) >> 8;
+        }
+    }
+}
+
+/*
+ * Four fine pixels per iteration: the even ones are (1 6 1) / 8 and the odd
+ * ones (4 4) / 8 of the same three coarse pixels, and are interleaved back
+ * before the subtraction.
+ */
+static void ne10_img_pyramid_laplacian_row_neon (const ne10_uint8_t *fine,
+        const ne10_uint8_t *c0,
+        const ne10_uint8_t *c1,
+        const ne10_uint8_t *c2,
+        ne10_uint8_t w0,
+        ne10_uint8_t w1,
+        ne10_uint8_t w2,
+        ne10_int16_t *dst,
+        ne10_int32_t fine_width,
+        ne10_int32_t coarse_width,
+        ne10_uint16_t *scratch)
+{
+    ne10_uint16_t *v = scratch + NE10_PYRAMID_CH;
+    ne10_int32_t count = coarse_width * NE10_PYRAMID_CH;
+    uint8x8_t vw0 = vdup_n_u8 (w0);
+    uint8x8_t vw1 = vdup_n_u8 (w1);
+    uint8x8_t vw2 = vdup_n_u8 (w2);
+    uint16x8_t six = vdupq_n_u16 (6);
+    ne10_int32_t i, k, c, x;
+
+    /* vertical pass */
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        uint16x8_t s = vmull_u8 (vld1_u8 (c0 + i), vw0);
+        s = vmlal_u8 (s, vld1_u8 (c1 + i), vw1);
+        s = vmlal_u8 (s, vld1_u8 (c2 + i), vw2);
+        vst1q_u16 (v + i, s);
+    }
+    for (; i < count; i++)
+    {
+        v[i] = w0 * c0[i] + w1 * c1[i] + w2 * c2[i];
+    }
+    for (k = 0; k < NE10_PYRAMID_CH; k++)
+    {
+        v[k - NE10_PYRAMID_CH] = v[k];
+        v[count + k] = v[count - NE10_PYRAMID_CH + k];
+    }
+
+    /* horizontal pass and subtraction */
+    for (c = 0; 2 * c + 4 <= fine_width; c += 2)
+    {
+        uint16x8_t a = vld1q_u16 (v + (c - 1) * NE10_PYRAMID_CH);
+        uint16x8_t b = vld1q_u16 (v + c * NE10_PYRAMID_CH);
+        uint16x8_t d = vld1q_u16 (v + (c + 1) * NE10_PYRAMID_CH);
+        uint16x8_t even = vrshrq_n_u16 (vmlaq_u16 (vaddq_u16 (a, d), b, six), 6);
+        uint16x8_t odd = vrshrq_n_u16 (vshlq_n_u16 (vaddq_u16 (b, d), 2), 6);
+        uint8x16_t f = vld1q_u8 (fine + 2 * c * NE10_PYRAMID_CH);
+        uint16x8_t e0 = vcombine_u16 (vget_low_u16 (even), vget_low_u16 (odd));
+        uint16x8_t e1 = vcombine_u16 (vget_high_u16 (even), vget_high_u16 (odd));
+
+        vst1q_s16 (dst + 2 * c * NE10_PYRAMID_CH,
+                   vreinterpretq_s16_u16 (vsubq_u16 (vmovl_u8 (vget_low_u8 (f)), e0)));
+        vst1q_s16 (dst + (2 * c + 2) * NE10_PYRAMID_CH,
+                   vreinterpretq_s16_u16 (vsubq_u16 (vmovl_u8 (vget_high_u8 (f)), e1)));
+    }
+    for (x = 2 * c; x < fine_width; x++)
+    {
+        for (k = 0; k < NE10_PYRAMID_CH; k++)
+        {
+            const ne10_uint16_t *p = v + (x >> 1) * NE10_PYRAMID_CH + k;
+            ne10_uint32_t sum = (x & 1) ? 4 * p[0] + 4 * p[4] : p[-4] + 6 * p[0] + p[4];
+            i = x * NE10_PYRAMID_CH + k;
+            dst[i] = fine[i] - (ne10_int16_t) ( (sum + 32) >> 6);
+        }
+    }
+}
+
+/**
+ * @ingroup IMG_PYRAMID
+ * Specific implementation of @ref ne10_img_pyramid_rgba8888 using NEON SIMD capabilities.
+ */
+ne10_result_t ne10_img_pyramid_rgba8888_neon (const ne10_uint8_t *src,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t levels,
+        ne10_int32_t laplacian,
+        ne10_uint8_t *arena,
+        ne10_uint32_t arena_size,
+        ne10_img_pyramid_level_t *pyramid)
+{
+    return ne10_img_pyramid_generic_rgba8888 (src, src_size, src_stride, levels, laplacian,
+            arena, arena_size, pyramid,
+            ne10_img_pyramid_down_row_neon,
+            ne10_img_pyramid_laplacian_row_neon);
+}
@@ -90,6 +90,7 @@
 #define INTER_RESIZE_COEF_BITS  11
 #define INTER_RESIZE_COEF_SCALE (1 << 11)
 #define NE10_MAX_ESIZE          16
+#define NE10_RESIZE_BYTE_ALIGNMENT 16
 
 static inline ne10_uint32_t ne10_align_size (ne10_int32_t sz, ne10_int32_t n)
 {
@@ -201,6 +202,7 @@ static void ne10_img_resize_generic_linear_c (ne10_uint8_t* src,
         const ne10_int16_t* _alpha,
         const ne10_int32_t* yofs,
         const ne10_int16_t* _beta,
+        ne10_int32_t* buffer_,
         ne10_int32_t xmin,
         ne10_int32_t xmax,
         ne10_int32_t ksize,
@@ -209,6 +211,7 @@ static void ne10_img_resize_generic_linear_c (ne10_uint8_t* src,
         ne10_int32_t srcstep,
         ne10_int32_t dstw,
         ne10_int32_t dsth,
+        ne10_int32_t dststep,
         ne10_int32_t channels)
 {
 
@@ -219,10 +222,6 @@ static void ne10_img_resize_generic_linear_c (ne10_uint8_t* src,
     dstw *= cn;
 
     ne10_int32_t bufstep = (ne10_int32_t) ne10_align_size (dstw, 16);
-    ne10_int32_t dststep = (ne10_int32_t) ne10_align_size (dstw, 4);
-
-
-    ne10_int32_t *buffer_ = (ne10_int32_t*) NE10_MALLOC (bufstep * ksize * sizeof (ne10_int32_t));
 
     const ne10_uint8_t* srows[NE10_MAX_ESIZE];
     ne10_int32_t* rows[NE10_MAX_ESIZE];
@@ -266,8 +265,6 @@ static void ne10_img_resize_generic_linear_c (ne10_uint8_t* src,
 
         ne10_img_vresize_linear_c ( (const ne10_int32_t**) rows, (ne10_uint8_t*) (dst + dststep * dy), beta, dstw);
     }
-
-    NE10_FREE (buffer_);
 }
 
 static void ne10_img_resize_cal_offset_linear (ne10_int32_t* xofs,
@@ -347,6 +344,7 @@ static void ne10_img_resize_cal_offset_linear (ne10_int32_t* xofs,
 
 }
 
+#if !defined (NE10_ENABLE_X86)
 extern void ne10_img_hresize_4channels_linear_neon (const ne10_uint8_t** src,
         ne10_int32_t** dst,
         ne10_int32_t count,
@@ -365,6 +363,7 @@ static void ne10_img_resize_generic_linear_neon (ne10_uint8_t* src,
         const ne10_int16_t* _alpha,
         const ne10_int32_t* yofs,
         const ne10_int16_t* _beta,
+        ne10_int32_t* buffer_,
         ne10_int32_t xmin,
         ne10_int32_t xmax,
         ne10_int32_t ksize,
@@ -373,6 +372,7 @@ static void ne10_img_resize_generic_linear_neon (ne10_uint8_t* src,
         ne10_int32_t srcstep,
         ne10_int32_t dstw,
         ne10_int32_t dsth,
+        ne10_int32_t dststep,
         ne10_int32_t channels)
 {
 
@@ -383,10 +383,6 @@ static void ne10_img_resize_generic_linear_neon (ne10_uint8_t* src,
     dstw *= cn;
 
     ne10_int32_t bufstep = (ne10_int32_t) ne10_align_size (dstw, 16);
-    ne10_int32_t dststep = (ne10_int32_t) ne10_align_size (dstw, 4);
-
-
-    ne10_int32_t *buffer_ = (ne10_int32_t*) NE10_MALLOC (bufstep * ksize * sizeof (ne10_int32_t));
 
     const ne10_uint8_t* srows[NE10_MAX_ESIZE];
     ne10_int32_t* rows[NE10_MAX_ESIZE];
@@ -435,10 +431,127 @@ static void ne10_img_resize_generic_linear_neon (ne10_uint8_t* src,
         }
         ne10_img_vresize_linear_neon ( (const ne10_int32_t**) rows, (ne10_uint8_t*) (dst + dststep * dy), beta, dstw);
     }
+}
+#endif // NE10_ENABLE_X86
+
+/**
+ * @ingroup IMG_RESIZE
+ * @brief Creates a plan for image resize.
+ *
+ * @param[in]   src_width             width of source image
+ * @param[in]   src_height            height of source image
+ * @param[in]   dst_width             width of destination image
+ * @param[in]   dst_height            height of destination image
+ * @param[in]   channels              number of interleaved 8-bit channels (1 to 4)
+ * @param[in]   mode                  interpolation mode
+ * @return      pointer to the plan, or NULL if the parameters are not supported
+ *
+ * All the interpolation tables and the row ring buffer are computed and allocated
+ * here, so that @ref ne10_img_resize_plan_execute does no allocation at all. The plan
+ * can be reused for every frame of the same geometry. To free it, call
+ * @ref ne10_img_resize_plan_destroy.
+ */
+ne10_img_resize_plan_t ne10_img_resize_plan_create (ne10_uint32_t src_width,
+        ne10_uint32_t src_height,
+        ne10_uint32_t dst_width,
+        ne10_uint32_t dst_height,
+        ne10_uint32_t channels,
+        ne10_img_resize_mode_t mode)
+{
+    ne10_img_resize_plan_t plan = NULL;
+    ne10_int32_t cn = channels;
+    ne10_int32_t dsth = dst_height;
+    ne10_int32_t width = dst_width * cn;
+    ne10_int32_t ksize = 2;
+    ne10_int32_t bufstep = (ne10_int32_t) ne10_align_size (width, 16);
+
+    if ( (mode != NE10_IMG_RESIZE_BILINEAR) || (channels < 1) || (channels > 4)
+            || (src_width == 0) || (src_height == 0) || (dst_width == 0) || (dst_height == 0))
+        return NULL;
+
+    ne10_uint32_t memneeded = sizeof (ne10_img_resize_plan_state_t)
+                              + sizeof (ne10_int32_t) * bufstep * ksize     /* buffer */
+                              + sizeof (ne10_int32_t) * width               /* xofs */
+                              + sizeof (ne10_int32_t) * dsth                /* yofs */
+                              + sizeof (ne10_int16_t) * width * ksize       /* ialpha */
+                              + sizeof (ne10_int16_t) * dsth * ksize        /* ibeta */
+                              + NE10_RESIZE_BYTE_ALIGNMENT;
+
+    plan = (ne10_img_resize_plan_t) NE10_MALLOC (memneeded);
+
+    if (plan)
+    {
+        uintptr_t address = (uintptr_t) plan + sizeof (ne10_img_resize_plan_state_t);
+        NE10_BYTE_ALIGNMENT (address, NE10_RESIZE_BYTE_ALIGNMENT);
+        plan->buffer = (ne10_int32_t*) address;
+        plan->xofs = plan->buffer + bufstep * ksize;
+        plan->yofs = plan->xofs + width;
+        plan->ialpha = (ne10_int16_t*) (plan->yofs + dsth);
+        plan->ibeta = plan->ialpha + width * ksize;
+
+        plan->src_width = src_width;
+        plan->src_height = src_height;
+        plan->dst_width = dst_width;
+        plan->dst_height = dst_height;
+        plan->channels = cn;
+        plan->mode = mode;
+        plan->ksize = ksize;
+        plan->bufstep = bufstep;
+        plan->xmin = 0;
+        plan->xmax = dst_width;
+
+        ne10_img_resize_cal_offset_linear (plan->xofs, plan->ialpha, plan->yofs, plan->ibeta,
+                                           &plan->xmin, &plan->xmax, ksize, ksize / 2,
+                                           plan->src_width, plan->src_height,
+                                           plan->dst_width, plan->dst_height, cn);
+    }
+
+    return plan;
+}
+
+/**
+ * @ingroup IMG_RESIZE
+ * @brief Destroys a plan created by @ref ne10_img_resize_plan_create.
+ */
+void ne10_img_resize_plan_destroy (ne10_img_resize_plan_t plan)
+{
+    NE10_FREE (plan);
+}
 
-    NE10_FREE (buffer_);
+/**
+ * @ingroup IMG_RESIZE
+ * Specific implementation of @ref ne10_img_resize_plan_execute using plain C.
+ */
+void ne10_img_resize_plan_execute_c (ne10_img_resize_plan_t plan,
+                                     ne10_uint8_t* dst,
+                                     ne10_uint32_t dst_stride,
+                                     ne10_uint8_t* src,
+                                     ne10_uint32_t src_stride)
+{
+    ne10_img_resize_generic_linear_c (src, dst, plan->xofs, plan->ialpha, plan->yofs, plan->ibeta,
+                                      plan->buffer, plan->xmin, plan->xmax, plan->ksize,
+                                      plan->src_width, plan->src_height, src_stride,
+                                      plan->dst_width, plan->dst_height, dst_stride, plan->channels);
 }
 
+#if !defined (NE10_ENABLE_X86)
+/**
+ * @ingroup IMG_RESIZE
+ * Specific implementation of @ref ne10_img_resize_plan_execute using NEON SIMD capabilities.
+ */
+void ne10_img_resize_plan_execute_neon (ne10_img_resize_plan_t plan,
+                                        ne10_uint8_t* dst,
+                                        ne10_uint32_t dst_stride,
+                                        ne10_uint8_t* src,
+                                        ne10_uint32_t src_stride)
+{
+    ne10_img_resize_generic_linear_neon (src, dst, plan->xofs, plan->ialpha, plan->yofs, plan->ibeta,
+                                         plan->buffer, plan->xmin, plan->xmax, plan->ksize,
+                                         plan->src_width, plan->src_height, src_stride,
+                                         plan->dst_width, plan->dst_height, dst_stride, plan->channels);
+}
+#endif // NE10_ENABLE_X86
+
 /**
  * @ingroup IMG_RESIZE
  * Specific implementation of @ref ne10_img_resize_bilinear_rgba using plain C.
@@ -451,35 +564,16 @@ void ne10_img_resize_bilinear_rgba_c (ne10_uint8_t* dst,
                                       ne10_uint32_t src_height,
                                       ne10_uint32_t src_stride)
 {
-    ne10_int32_t dstw = dst_width;
-    ne10_int32_t dsth = dst_height;
-    ne10_int32_t srcw = src_width;
-    ne10_int32_t srch = src_height;
-
-    ne10_int32_t cn = 4;
+    ne10_img_resize_plan_t plan = ne10_img_resize_plan_create (src_width, src_height,
+                                  dst_width, dst_height, 4, NE10_IMG_RESIZE_BILINEAR);
+    if (plan == NULL)
+        return;
 
-
-    ne10_int32_t xmin = 0;
-    ne10_int32_t xmax = dstw;
-    ne10_int32_t width = dstw * cn;
-
-    ne10_int32_t ksize = 0, ksize2;
-    ksize = 2;
-    ksize2 = ksize / 2;
-
-    ne10_uint8_t *buffer_ = (ne10_uint8_t*) NE10_MALLOC ( (width + dsth) * (sizeof (ne10_int32_t) + sizeof (ne10_float32_t) * ksize));
-
-    ne10_int32_t* xofs = (ne10_int32_t*) buffer_;
-    ne10_int32_t* yofs = xofs + width;
-    ne10_int16_t* ialpha = (ne10_int16_t*) (yofs + dsth);
-    ne10_int16_t* ibeta = ialpha + width * ksize;
-
-    ne10_img_resize_cal_offset_linear (xofs, ialpha, yofs, ibeta, &xmin, &xmax, ksize, ksize2, srcw, srch, dstw, dsth, cn);
-
-    ne10_img_resize_generic_linear_c (src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, cn);
-    NE10_FREE (buffer_);
+    ne10_img_resize_plan_execute_c (plan, dst, dst_width * 4, src, src_stride);
+    ne10_img_resize_plan_destroy (plan);
 }
 
+#if !defined (NE10_ENABLE_X86)
 /**
  * @ingroup IMG_RESIZE
  * Specific implementation of @ref ne10_img_resize_bilinear_rgba using NEON SIMD capabilities.
@@ -492,34 +586,15 @@ void ne10_img_resize_bilinear_rgba_neon (ne10_uint8_t* dst,
         ne10_uint32_t src_height,
         ne10_uint32_t src_stride)
 {
-    ne10_int32_t dstw = dst_width;
-    ne10_int32_t dsth = dst_height;
-    ne10_int32_t srcw = src_width;
-    ne10_int32_t srch = src_height;
-
-    ne10_int32_t cn = 4;
-
-
-    ne10_int32_t xmin = 0;
-    ne10_int32_t xmax = dstw;
-    ne10_int32_t width = dstw * cn;
-
-    ne10_int32_t ksize = 0, ksize2;
-    ksize = 2;
-    ksize2 = ksize / 2;
-
-    ne10_uint8_t *buffer_ = (ne10_uint8_t*) NE10_MALLOC ( (width + dsth) * (sizeof (ne10_int32_t) + sizeof (ne10_float32_t) * ksize));
-
-    ne10_int32_t* xofs = (ne10_int32_t*) buffer_;
-    ne10_int32_t* yofs = xofs + width;
-    ne10_int16_t* ialpha = (ne10_int16_t*) (yofs + dsth);
-    ne10_int16_t* ibeta = ialpha + width * ksize;
-
-    ne10_img_resize_cal_offset_linear (xofs, ialpha, yofs, ibeta, &xmin, &xmax, ksize, ksize2, srcw, srch, dstw, dsth, cn);
+    ne10_img_resize_plan_t plan = ne10_img_resize_plan_create (src_width, src_height,
+                                  dst_width, dst_height, 4, NE10_IMG_RESIZE_BILINEAR);
+    if (plan == NULL)
+        return;
 
-    ne10_img_resize_generic_linear_neon (src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, cn);
-    NE10_FREE (buffer_);
+    ne10_img_resize_plan_execute_neon (plan, dst, dst_width * 4, src, src_stride);
+    ne10_img_resize_plan_destroy (plan);
 }
+#endif // NE10_ENABLE_X86
 
 /**
  * @} end of IMG_RESIZE group
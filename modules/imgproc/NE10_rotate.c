@@ -217,6 +217,16 @@ void ne10_img_rotate_rgba_c (ne10_uint8_t* dst,
                              ne10_uint32_t src_height,
                              ne10_int32_t angle)
 {
+    if (angle % 90 == 0)
+    {
+        ne10_size_t src_size = {src_width, src_height};
+
+        *dst_width = ( (angle / 90) & 1) ? src_height : src_width;
+        *dst_height = ( (angle / 90) & 1) ? src_width : src_height;
+        ne10_img_rotate_right_angle_rgba_c (src, dst, src_size, src_width * 4, *dst_width * 4, angle);
+        return;
+    }
+
     ne10_float32_t radian = (angle * NE10_PI / 180.0);
     ne10_float32_t a = sin (radian), b = cos (radian);
     ne10_int32_t srcw = src_width;
@@ -248,10 +258,14 @@ extern void ne10_img_rotate_get_quad_rangle_subpix_rgba_neon (ne10_uint8_t *dst,
         ne10_int32_t dsth,
         ne10_float32_t *matrix)
     asm("ne10_img_rotate_get_quad_rangle_subpix_rgba_neon");
+#endif // ENABLE_NE10_IMG_ROTATE_RGBA_NEON
 
+#if !defined (NE10_ENABLE_X86)
 /**
  * @ingroup IMG_ROTATE
  * Specific implementation of @ref ne10_img_rotate_rgba using NEON SIMD capabilities.
+ * Arbitrary angles use the NEON sub-pixel kernel where it is available (armv7)
+ * and the C one otherwise.
  */
 void ne10_img_rotate_rgba_neon (ne10_uint8_t* dst,
                                 ne10_uint32_t* dst_width,
@@ -261,6 +275,16 @@ void ne10_img_rotate_rgba_neon (ne10_uint8_t* dst,
                                 ne10_uint32_t src_height,
                                 ne10_int32_t angle)
 {
+    if (angle % 90 == 0)
+    {
+        ne10_size_t src_size = {src_width, src_height};
+
+        *dst_width = ( (angle / 90) & 1) ? src_height : src_width;
+        *dst_height = ( (angle / 90) & 1) ? src_width : src_height;
+        ne10_img_rotate_right_angle_rgba_neon (src, dst, src_size, src_width * 4, *dst_width * 4, angle);
+        return;
+    }
+
     ne10_float32_t radian = (angle * NE10_PI / 180.0);
     ne10_float32_t a = sin (radian), b = cos (radian);
     ne10_int32_t srcw = src_width;
@@ -280,6 +304,10 @@ void ne10_img_rotate_rgba_neon (ne10_uint8_t* dst,
 
     *dst_width = dstw;
     *dst_height = dsth;
+#ifdef ENABLE_NE10_IMG_ROTATE_RGBA_NEON
     ne10_img_rotate_get_quad_rangle_subpix_rgba_neon (dst, src, srcw, srch, dstw, dsth, m);
-}
+#else
+    ne10_img_rotate_get_quad_rangle_subpix_rgba_c (dst, src, srcw, srch, dstw, dsth, m);
 #endif // ENABLE_NE10_IMG_ROTATE_RGBA_NEON
+}
+#endif // NE10_ENABLE_X86
@@ -0,0 +1,241 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_rotate90.c
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "NE10.h"
+
+/**
+ * @ingroup IMG_ROTATE
+ *
+ * \par
+ * Rotations by a multiple of 90 degrees and flips only move pixels around, so they are
+ * implemented as exact copies rather than through the bilinear sampler. A rotation by
+ * 90 or 270 degrees is a transpose combined with a flip; the C code walks the image in
+ * square tiles so that both the rows read and the columns written stay in cache, and the
+ * NEON code transposes 4x4 pixel blocks in registers.
+ * @ref ne10_img_rotate_rgba dispatches to these functions when the angle is a multiple of 90.
+ */
+
+#define NE10_ROTATE90_TILE 32
+
+/* copy one RGBA pixel */
+static inline void ne10_img_copy_pixel (ne10_uint8_t *dst, const ne10_uint8_t *src)
+{
+    memcpy (dst, src, 4);
+}
+
+/* swap two RGBA pixels */
+static inline void ne10_img_swap_pixel (ne10_uint8_t *a, ne10_uint8_t *b)
+{
+    ne10_uint8_t t[4];
+    memcpy (t, a, 4);
+    memcpy (a, b, 4);
+    memcpy (b, t, 4);
+}
+
+/*
+ * Rotate the source pixels in [x0, x1) x [y0, y1) clockwise by turns * 90 degrees into
+ * their place in dst. Also used by the NEON code for the edges that do not fill a block.
+ */
+void ne10_img_rotate_right_angle_region_rgba_c (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_int32_t turns,
+        ne10_int32_t x0,
+        ne10_int32_t y0,
+        ne10_int32_t x1,
+        ne10_int32_t y1)
+{
+    ne10_int32_t w = src_size.x;
+    ne10_int32_t h = src_size.y;
+    ne10_int32_t x, y;
+
+    for (y = y0; y < y1; y++)
+    {
+        const ne10_uint8_t *src_row = src + y * src_stride;
+        ne10_uint8_t *dst_ptr;
+        ne10_int32_t dst_step;
+
+        switch (turns)
+        {
+        case 1:
+            dst_ptr = dst + x0 * dst_stride + (h - 1 - y) * 4;
+            dst_step = dst_stride;
+            break;
+        case 2:
+            dst_ptr = dst + (h - 1 - y) * dst_stride + (w - 1 - x0) * 4;
+            dst_step = -4;
+            break;
+        case 3:
+            dst_ptr = dst + (w - 1 - x0) * dst_stride + y * 4;
+            dst_step = -dst_stride;
+            break;
+        default:
+            dst_ptr = dst + y * dst_stride + x0 * 4;
+            dst_step = 4;
+            break;
+        }
+
+        for (x = x0; x < x1; x++, dst_ptr += dst_step)
+        {
+            ne10_img_copy_pixel (dst_ptr, src_row + x * 4);
+        }
+    }
+}
+
+/**
+ * @ingroup IMG_ROTATE
+ * Specific implementation of @ref ne10_img_rotate_right_angle_rgba using plain C.
+ */
+void ne10_img_rotate_right_angle_rgba_c (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_int32_t angle)
+{
+    ne10_int32_t x, y;
+
+    assert (angle % 90 == 0);
+
+    for (y = 0; y < src_size.y; y += NE10_ROTATE90_TILE)
+    {
+        for (x = 0; x < src_size.x; x += NE10_ROTATE90_TILE)
+        {
+            ne10_img_rotate_right_angle_region_rgba_c (src, dst, src_size, src_stride, dst_stride,
+                    (angle / 90) & 3, x, y,
+                    NE10_MIN (x + NE10_ROTATE90_TILE, (ne10_int32_t) src_size.x),
+                    NE10_MIN (y + NE10_ROTATE90_TILE, (ne10_int32_t) src_size.y));
+        }
+    }
+}
+
+/**
+ * @ingroup IMG_ROTATE
+ * Specific implementation of @ref ne10_img_flip_rgba using plain C.
+ */
+void ne10_img_flip_rgba_c (const ne10_uint8_t *src,
+                           ne10_uint8_t *dst,
+                           ne10_size_t size,
+                           ne10_int32_t src_stride,
+                           ne10_int32_t dst_stride,
+                           ne10_img_flip_t flip)
+{
+    ne10_int32_t x, y;
+
+    for (y = 0; y < size.y; y++)
+    {
+        const ne10_uint8_t *src_row = src + y * src_stride;
+
+        if (flip == NE10_IMG_FLIP_VERTICAL)
+        {
+            memcpy (dst + (size.y - 1 - y) * dst_stride, src_row, size.x * 4);
+        }
+        else
+        {
+            ne10_uint8_t *dst_row = dst + y * dst_stride;
+            for (x = 0; x < size.x; x++)
+            {
+                ne10_img_copy_pixel (dst_row + (size.x - 1 - x) * 4, src_row + x * 4);
+            }
+        }
+    }
+}
+
+/**
+ * @ingroup IMG_ROTATE
+ * Specific implementation of @ref ne10_img_rotate_right_angle_inplace_rgba using plain C.
+ */
+void ne10_img_rotate_right_angle_inplace_rgba_c (ne10_uint8_t *img,
+        ne10_uint32_t side,
+        ne10_int32_t stride,
+        ne10_int32_t angle)
+{
+    ne10_int32_t n = side;
+    ne10_int32_t turns;
+    ne10_int32_t x, y;
+
+    assert (angle % 90 == 0);
+    turns = (angle / 90) & 3;
+
+    if (turns == 0)
+        return;
+
+    if (turns == 2)
+    {
+        /* reverse the order of all pixels */
+        for (y = 0; y < (n + 1) / 2; y++)
+        {
+            ne10_uint8_t *top = img + y * stride;
+            ne10_uint8_t *bottom = img + (n - 1 - y) * stride;
+            ne10_int32_t xend = (top == bottom) ? n / 2 : n;
+            for (x = 0; x < xend; x++)
+            {
+                ne10_img_swap_pixel (top + x * 4, bottom + (n - 1 - x) * 4);
+            }
+        }
+        return;
+    }
+
+    /* transpose ... */
+    for (y = 0; y < n; y++)
+    {
+        for (x = y + 1; x < n; x++)
+        {
+            ne10_img_swap_pixel (img + y * stride + x * 4, img + x * stride + y * 4);
+        }
+    }
+
+    /* ... then mirror the rows for 90 degrees, or the columns for 270 degrees */
+    for (y = 0; y < n; y++)
+    {
+        ne10_uint8_t *row = img + y * stride;
+        if (turns == 1)
+        {
+            for (x = 0; x < n / 2; x++)
+            {
+                ne10_img_swap_pixel (row + x * 4, row + (n - 1 - x) * 4);
+            }
+        }
+        else if (y < n / 2)
+        {
+            ne10_uint8_t *mirror = img + (n - 1 - y) * stride;
+            for (x = 0; x < n; x++)
+            {
+                ne10_img_swap_pixel (row + x * 4, mirror + x * 4);
+            }
+        }
+    }
+}
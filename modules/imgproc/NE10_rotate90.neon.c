@@ -0,0 +1,388 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_rotate90.neon.c
+ */
+
+#include <arm_neon.h>
+#include <assert.h>
+#include <string.h>
+
+#include "NE10.h"
+
+#define NE10_ROTATE90_TILE 32
+
+extern void ne10_img_rotate_right_angle_region_rgba_c (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_int32_t turns,
+        ne10_int32_t x0,
+        ne10_int32_t y0,
+        ne10_int32_t x1,
+        ne10_int32_t y1);
+
+/* four RGBA pixels, byte aligned */
+static inline uint32x4_t ne10_img_load4_rgba (const ne10_uint8_t *p)
+{
+    return vreinterpretq_u32_u8 (vld1q_u8 (p));
+}
+
+static inline void ne10_img_store4_rgba (ne10_uint8_t *p, uint32x4_t v)
+{
+    vst1q_u8 (p, vreinterpretq_u8_u32 (v));
+}
+
+static inline uint32x4_t ne10_img_reverse4_rgba (uint32x4_t v)
+{
+    v = vrev64q_u32 (v);
+    return vcombine_u32 (vget_high_u32 (v), vget_low_u32 (v));
+}
+
+static inline void ne10_img_swap4_rgba (ne10_uint8_t *a, ne10_uint8_t *b)
+{
+    uint8x16_t va = vld1q_u8 (a);
+    uint8x16_t vb = vld1q_u8 (b);
+    vst1q_u8 (a, vb);
+    vst1q_u8 (b, va);
+}
+
+static inline void ne10_img_swap_pixel (ne10_uint8_t *a, ne10_uint8_t *b)
+{
+    ne10_uint8_t t[4];
+    memcpy (t, a, 4);
+    memcpy (a, b, 4);
+    memcpy (b, t, 4);
+}
+
+/* transpose a 4x4 block of pixels held in four registers, one row each */
+static inline void ne10_img_transpose4x4_rgba (uint32x4_t *r0,
+        uint32x4_t *r1,
+        uint32x4_t *r2,
+        uint32x4_t *r3)
+{
+    uint32x4x2_t t01 = vtrnq_u32 (*r0, *r1);
+    uint32x4x2_t t23 = vtrnq_u32 (*r2, *r3);
+
+    *r0 = vcombine_u32 (vget_low_u32 (t01.val[0]), vget_low_u32 (t23.val[0]));
+    *r1 = vcombine_u32 (vget_low_u32 (t01.val[1]), vget_low_u32 (t23.val[1]));
+    *r2 = vcombine_u32 (vget_high_u32 (t01.val[0]), vget_high_u32 (t23.val[0]));
+    *r3 = vcombine_u32 (vget_high_u32 (t01.val[1]), vget_high_u32 (t23.val[1]));
+}
+
+/*
+ * Rotate the 4x4 block of src whose top-left pixel is (x, y) by 90 (turns == 1) or
+ * 270 (turns == 3) degrees. The rows are loaded bottom-up for 90 degrees so that the
+ * transposed columns come out in destination order.
+ */
+static inline void ne10_img_rotate_block4x4_rgba (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_int32_t turns,
+        ne10_int32_t x,
+        ne10_int32_t y)
+{
+    const ne10_uint8_t *s = src + y * src_stride + x * 4;
+    uint32x4_t r0, r1, r2, r3;
+    ne10_uint8_t *d;
+
+    if (turns == 1)
+    {
+        r3 = ne10_img_load4_rgba (s);
+        r2 = ne10_img_load4_rgba (s + src_stride);
+        r1 = ne10_img_load4_rgba (s + 2 * src_stride);
+        r0 = ne10_img_load4_rgba (s + 3 * src_stride);
+        ne10_img_transpose4x4_rgba (&r0, &r1, &r2, &r3);
+
+        d = dst + x * dst_stride + (src_size.y - 4 - y) * 4;
+        ne10_img_store4_rgba (d, r0);
+        ne10_img_store4_rgba (d + dst_stride, r1);
+        ne10_img_store4_rgba (d + 2 * dst_stride, r2);
+        ne10_img_store4_rgba (d + 3 * dst_stride, r3);
+    }
+    else
+    {
+        r0 = ne10_img_load4_rgba (s);
+        r1 = ne10_img_load4_rgba (s + src_stride);
+        r2 = ne10_img_load4_rgba (s + 2 * src_stride);
+        r3 = ne10_img_load4_rgba (s + 3 * src_stride);
+        ne10_img_transpose4x4_rgba (&r0, &r1, &r2, &r3);
+
+        d = dst + (src_size.x - 1 - x) * dst_stride + y * 4;
+        ne10_img_store4_rgba (d, r0);
+        ne10_img_store4_rgba (d - dst_stride, r1);
+        ne10_img_store4_rgba (d - 2 * dst_stride, r2);
+        ne10_img_store4_rgba (d - 3 * dst_stride, r3);
+    }
+}
+
+/* copy one row of pixels, mirrored left to right */
+static void ne10_img_mirror_row_rgba_neon (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_int32_t width)
+{
+    ne10_int32_t x;
+    ne10_uint8_t *d = dst + width * 4;
+
+    for (x = 0; x + 4 <= width; x += 4)
+    {
+        d -= 16;
+        ne10_img_store4_rgba (d, ne10_img_reverse4_rgba (ne10_img_load4_rgba (src + x * 4)));
+    }
+    for (; x < width; x++)
+    {
+        d -= 4;
+        memcpy (d, src + x * 4, 4);
+    }
+}
+
+/* mirror one row of pixels left to right, in place */
+static void ne10_img_mirror_row_inplace_rgba_neon (ne10_uint8_t *row, ne10_int32_t width)
+{
+    ne10_uint8_t *l = row;
+    ne10_uint8_t *r = row + width * 4;
+
+    while (r - l >= 32)
+    {
+        uint32x4_t vl = ne10_img_load4_rgba (l);
+        uint32x4_t vr = ne10_img_load4_rgba (r - 16);
+        ne10_img_store4_rgba (l, ne10_img_reverse4_rgba (vr));
+        ne10_img_store4_rgba (r - 16, ne10_img_reverse4_rgba (vl));
+        l += 16;
+        r -= 16;
+    }
+    while (r - l >= 8)
+    {
+        r -= 4;
+        ne10_img_swap_pixel (l, r);
+        l += 4;
+    }
+}
+
+/* swap two rows of pixels */
+static void ne10_img_swap_rows_rgba_neon (ne10_uint8_t *a, ne10_uint8_t *b, ne10_int32_t width)
+{
+    ne10_int32_t x;
+
+    for (x = 0; x + 4 <= width; x += 4)
+    {
+        ne10_img_swap4_rgba (a + x * 4, b + x * 4);
+    }
+    for (; x < width; x++)
+    {
+        ne10_img_swap_pixel (a + x * 4, b + x * 4);
+    }
+}
+
+/**
+ * @ingroup IMG_ROTATE
+ * Specific implementation of @ref ne10_img_rotate_right_angle_rgba using NEON SIMD capabilities.
+ */
+void ne10_img_rotate_right_angle_rgba_neon (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_int32_t angle)
+{
+    ne10_int32_t turns;
+    ne10_int32_t w = src_size.x;
+    ne10_int32_t h = src_size.y;
+    ne10_int32_t w4 = w & ~3;
+    ne10_int32_t h4 = h & ~3;
+    ne10_int32_t tx, ty, x, y;
+
+    assert (angle % 90 == 0);
+    turns = (angle / 90) & 3;
+
+    if ( (turns & 1) == 0)
+    {
+        for (y = 0; y < h; y++)
+        {
+            const ne10_uint8_t *src_row = src + y * src_stride;
+            if (turns == 0)
+                memcpy (dst + y * dst_stride, src_row, w * 4);
+            else
+                ne10_img_mirror_row_rgba_neon (src_row, dst + (h - 1 - y) * dst_stride, w);
+        }
+        return;
+    }
+
+    /* 4x4 blocks, walked in tiles so that the destination rows stay in cache */
+    for (ty = 0; ty < h4; ty += NE10_ROTATE90_TILE)
+    {
+        ne10_int32_t yend = NE10_MIN (ty + NE10_ROTATE90_TILE, h4);
+        for (tx = 0; tx < w4; tx += NE10_ROTATE90_TILE)
+        {
+            ne10_int32_t xend = NE10_MIN (tx + NE10_ROTATE90_TILE, w4);
+            for (y = ty; y < yend; y += 4)
+            {
+                for (x = tx; x < xend; x += 4)
+                {
+                    ne10_img_rotate_block4x4_rgba (src, dst, src_size, src_stride, dst_stride, turns, x, y);
+                }
+            }
+        }
+    }
+
+    /* right and bottom edges */
+    ne10_img_rotate_right_angle_region_rgba_c (src, dst, src_size, src_stride, dst_stride,
+            turns, w4, 0, w, h4);
+    ne10_img_rotate_right_angle_region_rgba_c (src, dst, src_size, src_stride, dst_stride,
+            turns, 0, h4, w, h);
+}
+
+/**
+ * @ingroup IMG_ROTATE
+ * Specific implementation of @ref ne10_img_flip_rgba using NEON SIMD capabilities.
+ */
+void ne10_img_flip_rgba_neon (const ne10_uint8_t *src,
+                              ne10_uint8_t *dst,
+                              ne10_size_t size,
+                              ne10_int32_t src_stride,
+                              ne10_int32_t dst_stride,
+                              ne10_img_flip_t flip)
+{
+    ne10_int32_t y;
+
+    for (y = 0; y < size.y; y++)
+    {
+        const ne10_uint8_t *src_row = src + y * src_stride;
+
+        if (flip == NE10_IMG_FLIP_VERTICAL)
+            memcpy (dst + (size.y - 1 - y) * dst_stride, src_row, size.x * 4);
+        else
+            ne10_img_mirror_row_rgba_neon (src_row, dst + y * dst_stride, size.x);
+    }
+}
+
+/**
+ * @ingroup IMG_ROTATE
+ * Specific implementation of @ref ne10_img_rotate_right_angle_inplace_rgba using NEON SIMD capabilities.
+ */
+void ne10_img_rotate_right_angle_inplace_rgba_neon (ne10_uint8_t *img,
+        ne10_uint32_t side,
+        ne10_int32_t stride,
+        ne10_int32_t angle)
+{
+    ne10_int32_t n = side;
+    ne10_int32_t n4 = n & ~3;
+    ne10_int32_t turns;
+    ne10_int32_t x, y;
+
+    assert (angle % 90 == 0);
+    turns = (angle / 90) & 3;
+
+    if (turns == 0)
+        return;
+
+    if (turns == 2)
+    {
+        /* swap each row with the mirrored row at the other end */
+        for (y = 0; y < n / 2; y++)
+        {
+            ne10_uint8_t *top = img + y * stride;
+            ne10_uint8_t *bottom = img + (n - 1 - y) * stride;
+            for (x = 0; x + 4 <= n; x += 4)
+            {
+                uint32x4_t vt = ne10_img_load4_rgba (top + x * 4);
+                uint32x4_t vb = ne10_img_load4_rgba (bottom + (n - 4 - x) * 4);
+                ne10_img_store4_rgba (top + x * 4, ne10_img_reverse4_rgba (vb));
+                ne10_img_store4_rgba (bottom + (n - 4 - x) * 4, ne10_img_reverse4_rgba (vt));
+            }
+            for (; x < n; x++)
+            {
+                ne10_img_swap_pixel (top + x * 4, bottom + (n - 1 - x) * 4);
+            }
+        }
+        if (n & 1)
+            ne10_img_mirror_row_inplace_rgba_neon (img + (n / 2) * stride, n);
+        return;
+    }
+
+    /* transpose: swap each 4x4 block above the diagonal with its mirror below */
+    for (y = 0; y < n4; y += 4)
+    {
+        ne10_uint8_t *row = img + y * stride;
+        uint32x4_t r0 = ne10_img_load4_rgba (row + y * 4);
+        uint32x4_t r1 = ne10_img_load4_rgba (row + stride + y * 4);
+        uint32x4_t r2 = ne10_img_load4_rgba (row + 2 * stride + y * 4);
+        uint32x4_t r3 = ne10_img_load4_rgba (row + 3 * stride + y * 4);
+        ne10_img_transpose4x4_rgba (&r0, &r1, &r2, &r3);
+        ne10_img_store4_rgba (row + y * 4, r0);
+        ne10_img_store4_rgba (row + stride + y * 4, r1);
+        ne10_img_store4_rgba (row + 2 * stride + y * 4, r2);
+        ne10_img_store4_rgba (row + 3 * stride + y * 4, r3);
+
+        for (x = y + 4; x < n4; x += 4)
+        {
+            ne10_uint8_t *col = img + x * stride;
+            uint32x4_t a0 = ne10_img_load4_rgba (row + x * 4);
+            uint32x4_t a1 = ne10_img_load4_rgba (row + stride + x * 4);
+            uint32x4_t a2 = ne10_img_load4_rgba (row + 2 * stride + x * 4);
+            uint32x4_t a3 = ne10_img_load4_rgba (row + 3 * stride + x * 4);
+            uint32x4_t b0 = ne10_img_load4_rgba (col + y * 4);
+            uint32x4_t b1 = ne10_img_load4_rgba (col + stride + y * 4);
+            uint32x4_t b2 = ne10_img_load4_rgba (col + 2 * stride + y * 4);
+            uint32x4_t b3 = ne10_img_load4_rgba (col + 3 * stride + y * 4);
+            ne10_img_transpose4x4_rgba (&a0, &a1, &a2, &a3);
+            ne10_img_transpose4x4_rgba (&b0, &b1, &b2, &b3);
+            ne10_img_store4_rgba (row + x * 4, b0);
+            ne10_img_store4_rgba (row + stride + x * 4, b1);
+            ne10_img_store4_rgba (row + 2 * stride + x * 4, b2);
+            ne10_img_store4_rgba (row + 3 * stride + x * 4, b3);
+            ne10_img_store4_rgba (col + y * 4, a0);
+            ne10_img_store4_rgba (col + stride + y * 4, a1);
+            ne10_img_store4_rgba (col + 2 * stride + y * 4, a2);
+            ne10_img_store4_rgba (col + 3 * stride + y * 4, a3);
+        }
+    }
+    /* pixels on the right and bottom edges that do not fill a block */
+    for (y = 0; y < n; y++)
+    {
+        for (x = NE10_MAX (y + 1, n4); x < n; x++)
+        {
+            ne10_img_swap_pixel (img + y * stride + x * 4, img + x * stride + y * 4);
+        }
+    }
+
+    /* mirror the rows for 90 degrees, or the columns for 270 degrees */
+    if (turns == 1)
+    {
+        for (y = 0; y < n; y++)
+            ne10_img_mirror_row_inplace_rgba_neon (img + y * stride, n);
+    }
+    else
+    {
+        for (y = 0; y < n / 2; y++)
+            ne10_img_swap_rows_rgba_neon (img + y * stride, img + (n - 1 - y) * stride, n);
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_separable.c
+ */
+
+#include "NE10.h"
+#include "NE10_separable.h"
+
+/*
+ * The row and column passes share one buffer: the intermediate image, rows of
+ * size.x pixels without padding, then the scratch space of the filter.
+ */
+size_t ne10_img_separable_buffer_size (ne10_size_t size,
+        ne10_uint32_t elem_size,
+        size_t scratch_bytes)
+{
+    return (size_t) size.x * NE10_SEPARABLE_CH * elem_size * size.y + scratch_bytes;
+}
+
+void ne10_img_separable_rgba8888 (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_uint32_t elem_size,
+        size_t scratch_bytes,
+        ne10_img_separable_pass_t row_pass,
+        ne10_img_separable_pass_t col_pass,
+        const void *params,
+        ne10_uint8_t *buffer)
+{
+    ne10_int32_t buf_stride = size.x * NE10_SEPARABLE_CH * elem_size;
+    size_t buf_bytes = (size_t) buf_stride * size.y;
+    ne10_uint8_t *buf;
+
+    assert (src != 0 && dst != 0 && src != dst);
+    assert (size.x > 0 && size.y > 0);
+    assert (elem_size > 0);
+
+    buf = buffer ? buffer : (ne10_uint8_t *) NE10_MALLOC (buf_bytes + scratch_bytes);
+    if (!buf)
+    {
+        fprintf (stderr,
+                 "ERROR: buffer allocation fails!\nallocation size: %zu\n",
+                 buf_bytes + scratch_bytes);
+        return;
+    }
+
+    row_pass (src, buf, size, src_stride, buf_stride, buf + buf_bytes, params);
+    col_pass (buf, dst, size, buf_stride, dst_stride, buf + buf_bytes, params);
+
+    if (buf != buffer)
+        NE10_FREE (buf);
+}
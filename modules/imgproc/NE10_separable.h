@@ -0,0 +1,85 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_separable.h
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+
+#ifndef NE10_SEPARABLE_H
+#define NE10_SEPARABLE_H
+
+///////////////////////////
+// Internal macro define
+///////////////////////////
+
+/* RGBA CHANNEL number is 4 */
+#define NE10_SEPARABLE_CH   4
+
+/*
+ * One pass of a separable filter over a whole image of size pixels: the row
+ * pass from the source to the intermediate image, or the column pass from the
+ * intermediate image to the destination. scratch is the space the filter asked
+ * for after the intermediate image, and params its own parameters.
+ */
+typedef void (*ne10_img_separable_pass_t) (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_uint8_t *scratch,
+        const void *params);
+
+/*
+ * Bytes needed for the intermediate image of elem_size bytes per channel and
+ * the scratch space of the filter.
+ */
+extern size_t ne10_img_separable_buffer_size (ne10_size_t size,
+        ne10_uint32_t elem_size,
+        size_t scratch_bytes);
+
+/*
+ * Run a separable filter as a row pass into an intermediate image of
+ * elem_size bytes per channel, followed by a column pass from it. buffer holds
+ * ne10_img_separable_buffer_size bytes, aligned for pointers, or is NULL to
+ * allocate it for this call.
+ */
+extern void ne10_img_separable_rgba8888 (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_uint32_t elem_size,
+        size_t scratch_bytes,
+        ne10_img_separable_pass_t row_pass,
+        ne10_img_separable_pass_t col_pass,
+        const void *params,
+        ne10_uint8_t *buffer);
+
+#endif // NE10_SEPARABLE_H
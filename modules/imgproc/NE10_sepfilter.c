@@ -0,0 +1,595 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_sepfilter.c
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "NE10.h"
+#include "NE10_separable.h"
+#include "NE10_sepfilter.h"
+
+/**
+ * @ingroup groupIMGPROCs
+ * @defgroup IMG_SEPFILTER Image Separable Filter
+ *
+ * \par
+ * A separable filter convolves every row of the image with a horizontal 1-D kernel,
+ * then every column of the result with a vertical 1-D kernel, like the row and column
+ * parts of @ref IMG_BOXFILTER. Kernels are 16-bit fixed point: the row pass keeps its
+ * sums in a 16-bit intermediate image, which the NEON code combines with 16x16->32-bit
+ * multiply-accumulates. Typical uses are Sobel or Scharr derivatives and custom smoothing.
+ * \par
+ * The kernels are anchored at their center (index ksize / 2). Pixels outside the image
+ * are obtained according to the border mode:
+ * - @ref NE10_IMG_BORDER_CONSTANT: pixels outside the image take the given border value.
+ * - @ref NE10_IMG_BORDER_REPLICATE: pixels outside the image take the nearest edge pixel.
+ * \par
+ * Gaussian blur uses a sampled Q14 kernel for small sigma. For sigma above 3 it uses
+ * the recursive filter of Young and van Vliet ("Recursive implementation of the Gaussian
+ * filter", Signal Processing 44, 1995), a third order forward and backward IIR pass in
+ * each direction, so that its cost does not depend on sigma. The backward passes start
+ * from the exact state of the extended signal given by Triggs and Sdika.
+ */
+
+/* parameters of the separable filter passes */
+typedef struct
+{
+    const ne10_int16_t *kernel_x;
+    ne10_int32_t ksize_x;
+    ne10_int32_t shift_x;
+    const ne10_int16_t *kernel_y;
+    ne10_int32_t ksize_y;
+    ne10_int32_t shift_y;
+    ne10_int32_t delta;
+    ne10_img_border_t border;
+    const ne10_uint8_t *border_value;
+    ne10_img_sepfilter_row_t row_kernel;
+    ne10_img_sepfilter_col_t col_kernel;
+} ne10_img_sepfilter_params_t;
+
+/* fill count pixels with pixel p */
+static void ne10_img_sepfilter_fill (ne10_uint8_t *dst, const ne10_uint8_t *p, ne10_int32_t count)
+{
+    ne10_int32_t x;
+
+    for (x = 0; x < count; x++)
+    {
+        memcpy (dst + x * NE10_SEPFILTER_CH, p, NE10_SEPFILTER_CH);
+    }
+}
+
+/*
+ * The scratch space after the intermediate image holds the row pass of a
+ * constant border row, the row pointers of the column pass and a padded row.
+ */
+static size_t ne10_img_sepfilter_scratch_bytes (ne10_size_t size, const ne10_img_sepfilter_params_t *p)
+{
+    return (size_t) size.x * NE10_SEPFILTER_CH * sizeof (ne10_int16_t)
+           + (size.y + p->ksize_y - 1) * sizeof (ne10_int16_t*)
+           + (size.x + p->ksize_x - 1) * NE10_SEPFILTER_CH;
+}
+
+/* row pass, on rows padded with their border pixels */
+static void ne10_img_sepfilter_row_pass (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_uint8_t *scratch,
+        const void *params)
+{
+    const ne10_img_sepfilter_params_t *p = (const ne10_img_sepfilter_params_t *) params;
+    ne10_int32_t w = size.x;
+    ne10_int32_t count = w * NE10_SEPFILTER_CH;
+    ne10_int32_t anchor_x = p->ksize_x / 2;
+    ne10_int32_t pad_w = w + p->ksize_x - 1;
+    ne10_int16_t *const_row = (ne10_int16_t*) scratch;
+    ne10_uint8_t *padded = scratch + ne10_img_sepfilter_scratch_bytes (size, p) - pad_w * NE10_SEPFILTER_CH;
+    ne10_int32_t y;
+
+    for (y = 0; y < size.y; y++)
+    {
+        const ne10_uint8_t *src_row = src + y * src_stride;
+        const ne10_uint8_t *left = (p->border == NE10_IMG_BORDER_CONSTANT) ? p->border_value : src_row;
+        const ne10_uint8_t *right = (p->border == NE10_IMG_BORDER_CONSTANT) ? p->border_value :
+                                    src_row + (w - 1) * NE10_SEPFILTER_CH;
+
+        ne10_img_sepfilter_fill (padded, left, anchor_x);
+        memcpy (padded + anchor_x * NE10_SEPFILTER_CH, src_row, count);
+        ne10_img_sepfilter_fill (padded + (anchor_x + w) * NE10_SEPFILTER_CH, right, p->ksize_x - 1 - anchor_x);
+        p->row_kernel (padded, (ne10_int16_t*) (dst + y * dst_stride), count, p->kernel_x, p->ksize_x, p->shift_x);
+    }
+
+    /* the rows above and below the image, for the constant border */
+    if (p->border == NE10_IMG_BORDER_CONSTANT)
+    {
+        ne10_img_sepfilter_fill (padded, p->border_value, pad_w);
+        p->row_kernel (padded, const_row, count, p->kernel_x, p->ksize_x, p->shift_x);
+    }
+}
+
+/* column pass, through a table of row pointers, so border rows are never materialised */
+static void ne10_img_sepfilter_col_pass (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_uint8_t *scratch,
+        const void *params)
+{
+    const ne10_img_sepfilter_params_t *p = (const ne10_img_sepfilter_params_t *) params;
+    ne10_int32_t h = size.y;
+    ne10_int32_t count = size.x * NE10_SEPFILTER_CH;
+    ne10_int32_t anchor_y = p->ksize_y / 2;
+    ne10_int32_t nrows = h + p->ksize_y - 1;
+    const ne10_int16_t *const_row = (const ne10_int16_t*) scratch;
+    const ne10_int16_t **rows = (const ne10_int16_t**) (scratch + count * sizeof (ne10_int16_t));
+    ne10_int32_t i, y;
+
+    for (i = 0; i < nrows; i++)
+    {
+        ne10_int32_t sy = i - anchor_y;
+        if (p->border == NE10_IMG_BORDER_CONSTANT && (sy < 0 || sy >= h))
+            rows[i] = const_row;
+        else
+            rows[i] = (const ne10_int16_t*) (src + NE10_MAX (NE10_MIN (sy, h - 1), 0) * src_stride);
+    }
+
+    for (y = 0; y < h; y++)
+    {
+        p->col_kernel (rows + y, dst + y * dst_stride, count, p->kernel_y, p->ksize_y, p->shift_y, p->delta);
+    }
+}
+
+void ne10_img_sepfilter_generic_rgba8888 (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        const ne10_int16_t *kernel_x,
+        ne10_uint32_t ksize_x,
+        ne10_int32_t shift_x,
+        const ne10_int16_t *kernel_y,
+        ne10_uint32_t ksize_y,
+        ne10_int32_t shift_y,
+        ne10_int32_t delta,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value,
+        ne10_img_sepfilter_row_t row_kernel,
+        ne10_img_sepfilter_col_t col_kernel,
+        ne10_uint8_t *buffer)
+{
+    ne10_img_sepfilter_params_t params;
+
+    assert (src != 0 && dst != 0 && src != dst);
+    assert (src_size.x > 0 && src_size.y > 0);
+    assert (kernel_x != 0 && ksize_x > 0 && kernel_y != 0 && ksize_y > 0);
+    assert (shift_x >= 0 && shift_x < 32 && shift_y >= 0 && shift_y < 32);
+    assert (border != NE10_IMG_BORDER_CONSTANT || border_value != 0);
+
+    params.kernel_x = kernel_x;
+    params.ksize_x = ksize_x;
+    params.shift_x = shift_x;
+    params.kernel_y = kernel_y;
+    params.ksize_y = ksize_y;
+    params.shift_y = shift_y;
+    params.delta = delta;
+    params.border = border;
+    params.border_value = border_value;
+    params.row_kernel = row_kernel;
+    params.col_kernel = col_kernel;
+
+    /* the same row then column driver as the box filter, with an int16 intermediate image */
+    ne10_img_separable_rgba8888 (src, dst, src_size, src_stride, dst_stride,
+                                 sizeof (ne10_int16_t),
+                                 ne10_img_sepfilter_scratch_bytes (src_size, &params),
+                                 ne10_img_sepfilter_row_pass,
+                                 ne10_img_sepfilter_col_pass,
+                                 &params,
+                                 buffer);
+}
+
+/* radius of the sampled Gaussian kernel used up to NE10_GAUSSIAN_IIR_SIGMA */
+static ne10_int32_t ne10_img_gaussian_radius (ne10_float32_t sigma)
+{
+    return (ne10_int32_t) ceil (3 * sigma);
+}
+
+/**
+ * @ingroup IMG_SEPFILTER
+ * @brief Size of the buffer needed by @ref ne10_img_gaussian_rgba8888.
+ *
+ * @param[in]   src_size     size of the source image
+ * @param[in]   sigma        standard deviation of the Gaussian, in pixels
+ * @return      size of the buffer in bytes
+ */
+ne10_uint32_t ne10_img_gaussian_buffer_size (ne10_size_t src_size, ne10_float32_t sigma)
+{
+    size_t bytes;
+
+    if (sigma <= NE10_GAUSSIAN_IIR_SIGMA)
+    {
+        /* int16 intermediate image and the scratch space of the separable filter */
+        ne10_img_sepfilter_params_t params;
+
+        params.ksize_x = params.ksize_y = 2 * ne10_img_gaussian_radius (sigma) + 1;
+        bytes = ne10_img_separable_buffer_size (src_size, sizeof (ne10_int16_t),
+                                                ne10_img_sepfilter_scratch_bytes (src_size, &params));
+    }
+    else
+    {
+        /* float64 intermediate image and two rows of column state */
+        bytes = (size_t) (src_size.y + 2) * src_size.x * NE10_SEPFILTER_CH * sizeof (ne10_float64_t);
+    }
+    /* slack to align the buffer */
+    return (ne10_uint32_t) (bytes + NE10_GAUSSIAN_ALIGNMENT);
+}
+
+/* Young - van Vliet coefficients for sigma, and the matrix of Triggs and Sdika */
+static void ne10_img_gaussian_iir_coeffs (ne10_img_gaussian_iir_coeffs_t *coeffs, ne10_float64_t sigma)
+{
+    ne10_float64_t q, q2, q3, b0, a1, a2, a3, B, scale;
+
+    if (sigma >= 2.5)
+        q = 0.98711 * sigma - 0.96330;
+    else
+        q = 3.97156 - 4.14554 * sqrt (1.0 - 0.26891 * sigma);
+    q2 = q * q;
+    q3 = q2 * q;
+
+    b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + 0.422205 * q3;
+    a1 = (2.44413 * q + 2.85619 * q2 + 1.26661 * q3) / b0;
+    a2 = - (1.4281 * q2 + 1.26661 * q3) / b0;
+    a3 = (0.422205 * q3) / b0;
+    B = 1.0 - (a1 + a2 + a3);
+
+    coeffs->B = B;
+    coeffs->b1 = a1;
+    coeffs->b2 = a2;
+    coeffs->b3 = a3;
+
+    /*
+     * B. Triggs and M. Sdika, "Boundary conditions for Young - van Vliet recursive
+     * filtering", IEEE Trans. Signal Processing 54, 2006. Row i gives the backward
+     * output at n = N - 1 + i from the last three forward outputs, all relative to
+     * the value the signal is extended with.
+     */
+    scale = B / ( (1.0 + a1 - a2 + a3) * (1.0 - a1 - a2 - a3) * (1.0 + a2 + (a1 - a3) * a3));
+    coeffs->M[0] = scale * (-a3 * a1 + 1.0 - a3 * a3 - a2);
+    coeffs->M[1] = scale * (a3 + a1) * (a2 + a3 * a1);
+    coeffs->M[2] = scale * a3 * (a1 + a3 * a2);
+    coeffs->M[3] = scale * (a1 + a3 * a2);
+    coeffs->M[4] = -scale * (a2 - 1.0) * (a2 + a3 * a1);
+    coeffs->M[5] = -scale * a3 * (a3 * a1 + a3 * a3 + a2 - 1.0);
+    coeffs->M[6] = scale * (a3 * a1 + a2 + a1 * a1 - a2 * a2);
+    coeffs->M[7] = scale * (a1 * a2 + a3 * a2 * a2 - a1 * a3 * a3 - a3 * a3 * a3 - a3 * a2 + a3);
+    coeffs->M[8] = scale * a3 * (a1 + a3 * a2);
+}
+
+void ne10_img_gaussian_generic_rgba8888 (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_float32_t sigma,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value,
+        ne10_uint8_t *buffer,
+        ne10_img_sepfilter_row_t row_kernel,
+        ne10_img_sepfilter_col_t col_kernel,
+        ne10_img_gaussian_iir_row_t iir_row_kernel,
+        ne10_img_gaussian_iir_col_t iir_col_kernel)
+{
+    ne10_int32_t w = src_size.x;
+    ne10_int32_t h = src_size.y;
+    uintptr_t address = (uintptr_t) buffer;
+    ne10_int32_t y;
+
+    assert (sigma > 0);
+    assert (buffer != 0);
+
+    NE10_BYTE_ALIGNMENT (address, NE10_GAUSSIAN_ALIGNMENT);
+    buffer = (ne10_uint8_t*) address;
+
+    if (sigma <= NE10_GAUSSIAN_IIR_SIGMA)
+    {
+        ne10_int16_t kernel[NE10_GAUSSIAN_MAX_TAPS];
+        ne10_float32_t weight[NE10_GAUSSIAN_MAX_TAPS];
+        ne10_int32_t radius = ne10_img_gaussian_radius (sigma);
+        ne10_int32_t ksize = 2 * radius + 1;
+        ne10_float32_t total = 0;
+        ne10_int32_t sum = 0;
+        ne10_int32_t i;
+
+        for (i = 0; i < ksize; i++)
+        {
+            weight[i] = exp (- (i - radius) * (i - radius) / (2.0 * sigma * sigma));
+            total += weight[i];
+        }
+        for (i = 0; i < ksize; i++)
+        {
+            kernel[i] = (ne10_int16_t) floor (weight[i] * (1 << NE10_GAUSSIAN_Q) / total + 0.5f);
+            sum += kernel[i];
+        }
+        /* make the kernel sum exactly one, so flat areas are preserved */
+        kernel[radius] += (1 << NE10_GAUSSIAN_Q) - sum;
+
+        ne10_img_sepfilter_generic_rgba8888 (src, dst, src_size, src_stride, dst_stride,
+                                             kernel, ksize, NE10_GAUSSIAN_ROW_SHIFT,
+                                             kernel, ksize, 2 * NE10_GAUSSIAN_Q - NE10_GAUSSIAN_ROW_SHIFT,
+                                             0, border, border_value, row_kernel, col_kernel, buffer);
+    }
+    else
+    {
+        ne10_img_gaussian_iir_coeffs_t coeffs;
+        ne10_int32_t count = w * NE10_SEPFILTER_CH;
+        ne10_float64_t *buf = (ne10_float64_t*) buffer;
+
+        assert (src != 0 && dst != 0);
+        assert (w > 0 && h > 0);
+        assert (border != NE10_IMG_BORDER_CONSTANT || border_value != 0);
+
+        ne10_img_gaussian_iir_coeffs (&coeffs, sigma);
+        for (y = 0; y < h; y++)
+        {
+            iir_row_kernel (src + y * src_stride, buf + y * count, w, &coeffs, border, border_value);
+        }
+        iir_col_kernel (buf, buf + h * count, dst, dst_stride, src_size, &coeffs, border, border_value);
+    }
+}
+
+static void ne10_img_sepfilter_row_c (const ne10_uint8_t *src,
+                                      ne10_int16_t *dst,
+                                      ne10_int32_t count,
+                                      const ne10_int16_t *kernel,
+                                      ne10_int32_t ksize,
+                                      ne10_int32_t shift)
+{
+    ne10_int32_t i, k;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_int32_t sum = 0;
+        for (k = 0; k < ksize; k++)
+        {
+            sum += src[i + k * NE10_SEPFILTER_CH] * kernel[k];
+        }
+        sum = ne10_img_sepfilter_round_shift (sum, shift);
+        dst[i] = (ne10_int16_t) NE10_MAX (NE10_MIN (sum, 32767), -32768);
+    }
+}
+
+static void ne10_img_sepfilter_col_c (const ne10_int16_t **rows,
+                                      ne10_uint8_t *dst,
+                                      ne10_int32_t count,
+                                      const ne10_int16_t *kernel,
+                                      ne10_int32_t ksize,
+                                      ne10_int32_t shift,
+                                      ne10_int32_t delta)
+{
+    ne10_int32_t i, k;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_int32_t sum = 0;
+        for (k = 0; k < ksize; k++)
+        {
+            sum += rows[k][i] * kernel[k];
+        }
+        sum = ne10_img_sepfilter_round_shift (sum, shift) + delta;
+        dst[i] = (ne10_uint8_t) NE10_MAX (NE10_MIN (sum, 255), 0);
+    }
+}
+
+void ne10_img_gaussian_iir_row_c (const ne10_uint8_t *src,
+        ne10_float64_t *dst,
+        ne10_int32_t width,
+        const ne10_img_gaussian_iir_coeffs_t *coeffs,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value)
+{
+    const ne10_float64_t *M = coeffs->M;
+    ne10_int32_t x, k;
+
+    for (k = 0; k < NE10_SEPFILTER_CH; k++)
+    {
+        ne10_float64_t p1, p2, p3, d1, d2, d3, e, v;
+
+        /* forward, from the steady state of the left extension */
+        p1 = p2 = p3 = (border == NE10_IMG_BORDER_CONSTANT) ? border_value[k] : src[k];
+        for (x = 0; x < width; x++)
+        {
+            v = coeffs->B * src[x * NE10_SEPFILTER_CH + k];
+            v += coeffs->b1 * p1;
+            v += coeffs->b2 * p2;
+            v += coeffs->b3 * p3;
+            dst[x * NE10_SEPFILTER_CH + k] = v;
+            p3 = p2;
+            p2 = p1;
+            p1 = v;
+        }
+
+        /* backward, from the exact state of the right extension */
+        e = (border == NE10_IMG_BORDER_CONSTANT) ? border_value[k] : src[ (width - 1) * NE10_SEPFILTER_CH + k];
+        d1 = p1 - e;
+        d2 = p2 - e;
+        d3 = p3 - e;
+        p1 = e + M[0] * d1 + M[1] * d2 + M[2] * d3;
+        p2 = e + M[3] * d1 + M[4] * d2 + M[5] * d3;
+        p3 = e + M[6] * d1 + M[7] * d2 + M[8] * d3;
+        dst[ (width - 1) * NE10_SEPFILTER_CH + k] = p1;
+        for (x = width - 2; x >= 0; x--)
+        {
+            v = coeffs->B * dst[x * NE10_SEPFILTER_CH + k];
+            v += coeffs->b1 * p1;
+            v += coeffs->b2 * p2;
+            v += coeffs->b3 * p3;
+            dst[x * NE10_SEPFILTER_CH + k] = v;
+            p3 = p2;
+            p2 = p1;
+            p1 = v;
+        }
+    }
+}
+
+static inline ne10_uint8_t ne10_img_gaussian_iir_round (ne10_float64_t v)
+{
+    return (ne10_uint8_t) NE10_MAX (NE10_MIN (v + 0.5, 255.0), 0.0);
+}
+
+void ne10_img_gaussian_iir_col_c (ne10_float64_t *buf,
+        ne10_float64_t *scratch,
+        ne10_uint8_t *dst,
+        ne10_int32_t dst_stride,
+        ne10_size_t size,
+        const ne10_img_gaussian_iir_coeffs_t *coeffs,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value)
+{
+    ne10_int32_t count = size.x * NE10_SEPFILTER_CH;
+    ne10_int32_t h = size.y;
+    const ne10_float64_t *M = coeffs->M;
+    ne10_float64_t *init = scratch;
+    ne10_float64_t *ext = scratch + count;
+    ne10_float64_t *last = buf + (h - 1) * count;
+    const ne10_float64_t *p1, *p2, *p3;
+    ne10_int32_t i, y;
+
+    /* values the columns are extended with, above and below */
+    for (i = 0; i < count; i++)
+    {
+        init[i] = (border == NE10_IMG_BORDER_CONSTANT) ? border_value[i % NE10_SEPFILTER_CH] : buf[i];
+        ext[i] = (border == NE10_IMG_BORDER_CONSTANT) ? border_value[i % NE10_SEPFILTER_CH] : last[i];
+    }
+
+    /* forward */
+    p1 = p2 = p3 = init;
+    for (y = 0; y < h; y++)
+    {
+        ne10_float64_t *row = buf + y * count;
+        for (i = 0; i < count; i++)
+        {
+            ne10_float64_t v = coeffs->B * row[i];
+            v += coeffs->b1 * p1[i];
+            v += coeffs->b2 * p2[i];
+            v += coeffs->b3 * p3[i];
+            row[i] = v;
+        }
+        p3 = p2;
+        p2 = p1;
+        p1 = row;
+    }
+
+    /* state of the backward pass at the last row; init and ext are reused for it */
+    for (i = 0; i < count; i++)
+    {
+        ne10_float64_t e = ext[i];
+        ne10_float64_t d1 = p1[i] - e;
+        ne10_float64_t d2 = p2[i] - e;
+        ne10_float64_t d3 = p3[i] - e;
+        last[i] = e + M[0] * d1 + M[1] * d2 + M[2] * d3;
+        init[i] = e + M[3] * d1 + M[4] * d2 + M[5] * d3;
+        ext[i] = e + M[6] * d1 + M[7] * d2 + M[8] * d3;
+        dst[ (h - 1) * dst_stride + i] = ne10_img_gaussian_iir_round (last[i]);
+    }
+
+    /* backward */
+    p1 = last;
+    p2 = init;
+    p3 = ext;
+    for (y = h - 2; y >= 0; y--)
+    {
+        ne10_float64_t *row = buf + y * count;
+        ne10_uint8_t *dst_row = dst + y * dst_stride;
+        for (i = 0; i < count; i++)
+        {
+            ne10_float64_t v = coeffs->B * row[i];
+            v += coeffs->b1 * p1[i];
+            v += coeffs->b2 * p2[i];
+            v += coeffs->b3 * p3[i];
+            row[i] = v;
+            dst_row[i] = ne10_img_gaussian_iir_round (v);
+        }
+        p3 = p2;
+        p2 = p1;
+        p1 = row;
+    }
+}
+
+/**
+ * @ingroup IMG_SEPFILTER
+ * Specific implementation of @ref ne10_img_sepfilter_rgba8888 using plain C.
+ */
+void ne10_img_sepfilter_rgba8888_c (const ne10_uint8_t *src,
+                                    ne10_uint8_t *dst,
+                                    ne10_size_t src_size,
+                                    ne10_int32_t src_stride,
+                                    ne10_int32_t dst_stride,
+                                    const ne10_int16_t *kernel_x,
+                                    ne10_uint32_t ksize_x,
+                                    ne10_int32_t shift_x,
+                                    const ne10_int16_t *kernel_y,
+                                    ne10_uint32_t ksize_y,
+                                    ne10_int32_t shift_y,
+                                    ne10_int32_t delta,
+                                    ne10_img_border_t border,
+                                    const ne10_uint8_t *border_value)
+{
+    ne10_img_sepfilter_generic_rgba8888 (src, dst, src_size, src_stride, dst_stride,
+                                         kernel_x, ksize_x, shift_x,
+                                         kernel_y, ksize_y, shift_y,
+                                         delta, border, border_value,
+                                         ne10_img_sepfilter_row_c,
+                                         ne10_img_sepfilter_col_c,
+                                         NULL);
+}
+
+/**
+ * @ingroup IMG_SEPFILTER
+ * Specific implementation of @ref ne10_img_gaussian_rgba8888 using plain C.
+ */
+void ne10_img_gaussian_rgba8888_c (const ne10_uint8_t *src,
+                                   ne10_uint8_t *dst,
+                                   ne10_size_t src_size,
+                                   ne10_int32_t src_stride,
+                                   ne10_int32_t dst_stride,
+                                   ne10_float32_t sigma,
+                                   ne10_img_border_t border,
+                                   const ne10_uint8_t *border_value,
+                                   ne10_uint8_t *buffer)
+{
+    ne10_img_gaussian_generic_rgba8888 (src, dst, src_size, src_stride, dst_stride,
+                                        sigma, border, border_value, buffer,
+                                        ne10_img_sepfilter_row_c,
+                                        ne10_img_sepfilter_col_c,
+                                        ne10_img_gaussian_iir_row_c,
+                                        ne10_img_gaussian_iir_col_c);
+}
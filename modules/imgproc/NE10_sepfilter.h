@@ -0,0 +1,174 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_sepfilter.h
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+
+#ifndef NE10_SEPFILTER_H
+#define NE10_SEPFILTER_H
+
+///////////////////////////
+// Internal macro define
+///////////////////////////
+
+/* RGBA CHANNEL number is 4 */
+#define NE10_SEPFILTER_CH           4
+/* Gaussian kernels are built in Q14 */
+#define NE10_GAUSSIAN_Q             14
+/* fractional bits kept in the int16 intermediate image of a Gaussian */
+#define NE10_GAUSSIAN_ROW_SHIFT     7
+/* above this sigma the Gaussian is computed recursively */
+#define NE10_GAUSSIAN_IIR_SIGMA     3.0f
+/* longest FIR Gaussian kernel: 2 * ceil (3 * NE10_GAUSSIAN_IIR_SIGMA) + 1 */
+#define NE10_GAUSSIAN_MAX_TAPS      19
+/* alignment of the Gaussian buffer, which holds float64 data on the IIR path */
+#define NE10_GAUSSIAN_ALIGNMENT     16
+
+/*
+ * coefficients of the Young - van Vliet recursive Gaussian, divided by b0, and
+ * the Triggs - Sdika matrix giving the state of the backward pass at the end of
+ * a signal from the state of the forward pass. The poles approach 1 as sigma
+ * grows, so the coefficients and the recursion are kept in float64: in float32
+ * the output drifts by tens of levels at sigma 100.
+ */
+typedef struct
+{
+    ne10_float64_t B;
+    ne10_float64_t b1;
+    ne10_float64_t b2;
+    ne10_float64_t b3;
+    ne10_float64_t M[9];
+} ne10_img_gaussian_iir_coeffs_t;
+
+/* sum rounded right by shift, as NEON VRSHL does with a negative shift */
+static inline ne10_int32_t ne10_img_sepfilter_round_shift (ne10_int32_t sum, ne10_int32_t shift)
+{
+    return (shift > 0) ? (ne10_int32_t) ( ( (ne10_int64_t) sum + (1 << (shift - 1))) >> shift) : sum;
+}
+
+/*
+ * Row pass: filter count int16 elements (count / 4 pixels) of a border-padded
+ * source row, rounding the sums right by shift and saturating to int16.
+ */
+typedef void (*ne10_img_sepfilter_row_t) (const ne10_uint8_t *src,
+        ne10_int16_t *dst,
+        ne10_int32_t count,
+        const ne10_int16_t *kernel,
+        ne10_int32_t ksize,
+        ne10_int32_t shift);
+
+/*
+ * Column pass: combine ksize rows of the intermediate image, round right by
+ * shift, add delta and saturate to uint8.
+ */
+typedef void (*ne10_img_sepfilter_col_t) (const ne10_int16_t **rows,
+        ne10_uint8_t *dst,
+        ne10_int32_t count,
+        const ne10_int16_t *kernel,
+        ne10_int32_t ksize,
+        ne10_int32_t shift,
+        ne10_int32_t delta);
+
+/*
+ * Recursive Gaussian along a row: forward and backward passes over width
+ * pixels, from uint8 source to float64 destination.
+ */
+typedef void (*ne10_img_gaussian_iir_row_t) (const ne10_uint8_t *src,
+        ne10_float64_t *dst,
+        ne10_int32_t width,
+        const ne10_img_gaussian_iir_coeffs_t *coeffs,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value);
+
+/*
+ * Recursive Gaussian along the columns of the float64 image produced by the row
+ * pass, in place, writing the rounded result to dst. scratch is space for two
+ * rows.
+ */
+typedef void (*ne10_img_gaussian_iir_col_t) (ne10_float64_t *buf,
+        ne10_float64_t *scratch,
+        ne10_uint8_t *dst,
+        ne10_int32_t dst_stride,
+        ne10_size_t size,
+        const ne10_img_gaussian_iir_coeffs_t *coeffs,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value);
+
+/* plain C recursive passes, also used by the NEON code where there are no float64 vectors */
+extern void ne10_img_gaussian_iir_row_c (const ne10_uint8_t *src,
+        ne10_float64_t *dst,
+        ne10_int32_t width,
+        const ne10_img_gaussian_iir_coeffs_t *coeffs,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value);
+
+extern void ne10_img_gaussian_iir_col_c (ne10_float64_t *buf,
+        ne10_float64_t *scratch,
+        ne10_uint8_t *dst,
+        ne10_int32_t dst_stride,
+        ne10_size_t size,
+        const ne10_img_gaussian_iir_coeffs_t *coeffs,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value);
+
+extern void ne10_img_sepfilter_generic_rgba8888 (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        const ne10_int16_t *kernel_x,
+        ne10_uint32_t ksize_x,
+        ne10_int32_t shift_x,
+        const ne10_int16_t *kernel_y,
+        ne10_uint32_t ksize_y,
+        ne10_int32_t shift_y,
+        ne10_int32_t delta,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value,
+        ne10_img_sepfilter_row_t row_kernel,
+        ne10_img_sepfilter_col_t col_kernel,
+        ne10_uint8_t *buffer);
+
+extern void ne10_img_gaussian_generic_rgba8888 (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t dst_stride,
+        ne10_float32_t sigma,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value,
+        ne10_uint8_t *buffer,
+        ne10_img_sepfilter_row_t row_kernel,
+        ne10_img_sepfilter_col_t col_kernel,
+        ne10_img_gaussian_iir_row_t iir_row_kernel,
+        ne10_img_gaussian_iir_col_t iir_col_kernel);
+
+#endif // NE10_SEPFILTER_H
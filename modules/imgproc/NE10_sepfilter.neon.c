@@ -0,0 +1,395 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_sepfilter.neon.c
+ */
+
+#include <arm_neon.h>
+#include <string.h>
+
+#include "NE10.h"
+#include "NE10_sepfilter.h"
+
+/*
+ * 8 outputs per iteration: the uint8 taps are widened to int16 and
+ * accumulated with 16x16->32-bit multiplies.
+ */
+static void ne10_img_sepfilter_row_neon (const ne10_uint8_t *src,
+        ne10_int16_t *dst,
+        ne10_int32_t count,
+        const ne10_int16_t *kernel,
+        ne10_int32_t ksize,
+        ne10_int32_t shift)
+{
+    int32x4_t shift_vec = vdupq_n_s32 (-shift);
+    ne10_int32_t i, k;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        int32x4_t acc_lo = vdupq_n_s32 (0);
+        int32x4_t acc_hi = vdupq_n_s32 (0);
+
+        for (k = 0; k < ksize; k++)
+        {
+            int16x8_t v = vreinterpretq_s16_u16 (vmovl_u8 (vld1_u8 (src + i + k * NE10_SEPFILTER_CH)));
+            acc_lo = vmlal_n_s16 (acc_lo, vget_low_s16 (v), kernel[k]);
+            acc_hi = vmlal_n_s16 (acc_hi, vget_high_s16 (v), kernel[k]);
+        }
+        acc_lo = vrshlq_s32 (acc_lo, shift_vec);
+        acc_hi = vrshlq_s32 (acc_hi, shift_vec);
+        vst1q_s16 (dst + i, vcombine_s16 (vqmovn_s32 (acc_lo), vqmovn_s32 (acc_hi)));
+    }
+
+    /* the last pixel of an odd width */
+    for (; i < count; i++)
+    {
+        ne10_int32_t sum = 0;
+        for (k = 0; k < ksize; k++)
+        {
+            sum += src[i + k * NE10_SEPFILTER_CH] * kernel[k];
+        }
+        sum = ne10_img_sepfilter_round_shift (sum, shift);
+        dst[i] = (ne10_int16_t) NE10_MAX (NE10_MIN (sum, 32767), -32768);
+    }
+}
+
+static void ne10_img_sepfilter_col_neon (const ne10_int16_t **rows,
+        ne10_uint8_t *dst,
+        ne10_int32_t count,
+        const ne10_int16_t *kernel,
+        ne10_int32_t ksize,
+        ne10_int32_t shift,
+        ne10_int32_t delta)
+{
+    int32x4_t shift_vec = vdupq_n_s32 (-shift);
+    int32x4_t delta_vec = vdupq_n_s32 (delta);
+    ne10_int32_t i, k;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        int32x4_t acc_lo = vdupq_n_s32 (0);
+        int32x4_t acc_hi = vdupq_n_s32 (0);
+        int16x8_t res;
+
+        for (k = 0; k < ksize; k++)
+        {
+            int16x8_t v = vld1q_s16 (rows[k] + i);
+            acc_lo = vmlal_n_s16 (acc_lo, vget_low_s16 (v), kernel[k]);
+            acc_hi = vmlal_n_s16 (acc_hi, vget_high_s16 (v), kernel[k]);
+        }
+        acc_lo = vaddq_s32 (vrshlq_s32 (acc_lo, shift_vec), delta_vec);
+        acc_hi = vaddq_s32 (vrshlq_s32 (acc_hi, shift_vec), delta_vec);
+        res = vcombine_s16 (vqmovn_s32 (acc_lo), vqmovn_s32 (acc_hi));
+        vst1_u8 (dst + i, vqmovun_s16 (res));
+    }
+
+    /* the last pixel of an odd width */
+    for (; i < count; i++)
+    {
+        ne10_int32_t sum = 0;
+        for (k = 0; k < ksize; k++)
+        {
+            sum += rows[k][i] * kernel[k];
+        }
+        sum = ne10_img_sepfilter_round_shift (sum, shift) + delta;
+        dst[i] = (ne10_uint8_t) NE10_MAX (NE10_MIN (sum, 255), 0);
+    }
+}
+
+#if defined(__aarch64__)
+/*
+ * The recursion is kept in float64, so a RGBA pixel, or four channels of a
+ * row, is a pair of float64x2_t.
+ */
+static inline float64x2x2_t ne10_img_load_pixel_f64 (const ne10_uint8_t *p)
+{
+    ne10_uint32_t word;
+    float32x4_t f;
+    float64x2x2_t v;
+
+    memcpy (&word, p, sizeof (word));
+    f = vcvtq_f32_u32 (vmovl_u16 (vget_low_u16 (vmovl_u8 (vreinterpret_u8_u32 (vdup_n_u32 (word))))));
+    v.val[0] = vcvt_f64_f32 (vget_low_f32 (f));
+    v.val[1] = vcvt_f64_f32 (vget_high_f32 (f));
+    return v;
+}
+
+static inline float64x2x2_t ne10_img_load_f64x4 (const ne10_float64_t *p)
+{
+    float64x2x2_t v;
+
+    v.val[0] = vld1q_f64 (p);
+    v.val[1] = vld1q_f64 (p + 2);
+    return v;
+}
+
+static inline void ne10_img_store_f64x4 (ne10_float64_t *p, float64x2x2_t v)
+{
+    vst1q_f64 (p, v.val[0]);
+    vst1q_f64 (p + 2, v.val[1]);
+}
+
+/* state of the backward pass at the end of a signal extended with e */
+static inline void ne10_img_gaussian_iir_end_state (float64x2x2_t *p1,
+        float64x2x2_t *p2,
+        float64x2x2_t *p3,
+        float64x2x2_t e,
+        const ne10_float64_t *M)
+{
+    ne10_int32_t j;
+
+    for (j = 0; j < 2; j++)
+    {
+        float64x2_t d1 = vsubq_f64 (p1->val[j], e.val[j]);
+        float64x2_t d2 = vsubq_f64 (p2->val[j], e.val[j]);
+        float64x2_t d3 = vsubq_f64 (p3->val[j], e.val[j]);
+
+        p1->val[j] = vfmaq_n_f64 (vfmaq_n_f64 (vfmaq_n_f64 (e.val[j], d1, M[0]), d2, M[1]), d3, M[2]);
+        p2->val[j] = vfmaq_n_f64 (vfmaq_n_f64 (vfmaq_n_f64 (e.val[j], d1, M[3]), d2, M[4]), d3, M[5]);
+        p3->val[j] = vfmaq_n_f64 (vfmaq_n_f64 (vfmaq_n_f64 (e.val[j], d1, M[6]), d2, M[7]), d3, M[8]);
+    }
+}
+
+static inline float64x2x2_t ne10_img_gaussian_iir_step (float64x2x2_t x,
+        float64x2x2_t p1,
+        float64x2x2_t p2,
+        float64x2x2_t p3,
+        const ne10_img_gaussian_iir_coeffs_t *coeffs)
+{
+    float64x2x2_t v;
+    ne10_int32_t j;
+
+    for (j = 0; j < 2; j++)
+    {
+        v.val[j] = vmulq_n_f64 (x.val[j], coeffs->B);
+        v.val[j] = vfmaq_n_f64 (v.val[j], p1.val[j], coeffs->b1);
+        v.val[j] = vfmaq_n_f64 (v.val[j], p2.val[j], coeffs->b2);
+        v.val[j] = vfmaq_n_f64 (v.val[j], p3.val[j], coeffs->b3);
+    }
+    return v;
+}
+
+/* 4 rounded and saturated values to uint8 */
+static inline void ne10_img_gaussian_iir_store_u8 (ne10_uint8_t *dst, float64x2x2_t v)
+{
+    uint64x2_t u[2];
+    uint16x4_t h;
+    ne10_uint32_t word;
+    ne10_int32_t j;
+
+    for (j = 0; j < 2; j++)
+    {
+        float64x2_t r = vaddq_f64 (v.val[j], vdupq_n_f64 (0.5));
+        r = vmaxq_f64 (vminq_f64 (r, vdupq_n_f64 (255.0)), vdupq_n_f64 (0.0));
+        u[j] = vcvtq_u64_f64 (r);
+    }
+    h = vmovn_u32 (vcombine_u32 (vmovn_u64 (u[0]), vmovn_u64 (u[1])));
+    word = vget_lane_u32 (vreinterpret_u32_u8 (vmovn_u16 (vcombine_u16 (h, h))), 0);
+    memcpy (dst, &word, sizeof (word));
+}
+
+/* the recursion runs along the row, so the four channels of a pixel form the vector */
+static void ne10_img_gaussian_iir_row_neon (const ne10_uint8_t *src,
+        ne10_float64_t *dst,
+        ne10_int32_t width,
+        const ne10_img_gaussian_iir_coeffs_t *coeffs,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value)
+{
+    float64x2x2_t p1, p2, p3, v;
+    ne10_int32_t x;
+
+    /* forward, from the steady state of the left extension */
+    p1 = ne10_img_load_pixel_f64 ( (border == NE10_IMG_BORDER_CONSTANT) ? border_value : src);
+    p2 = p3 = p1;
+    for (x = 0; x < width; x++)
+    {
+        v = ne10_img_gaussian_iir_step (ne10_img_load_pixel_f64 (src + x * NE10_SEPFILTER_CH), p1, p2, p3, coeffs);
+        ne10_img_store_f64x4 (dst + x * NE10_SEPFILTER_CH, v);
+        p3 = p2;
+        p2 = p1;
+        p1 = v;
+    }
+
+    /* backward, from the exact state of the right extension */
+    ne10_img_gaussian_iir_end_state (&p1, &p2, &p3,
+                                     ne10_img_load_pixel_f64 ( (border == NE10_IMG_BORDER_CONSTANT) ? border_value :
+                                             src + (width - 1) * NE10_SEPFILTER_CH),
+                                     coeffs->M);
+    ne10_img_store_f64x4 (dst + (width - 1) * NE10_SEPFILTER_CH, p1);
+    for (x = width - 2; x >= 0; x--)
+    {
+        v = ne10_img_gaussian_iir_step (ne10_img_load_f64x4 (dst + x * NE10_SEPFILTER_CH), p1, p2, p3, coeffs);
+        ne10_img_store_f64x4 (dst + x * NE10_SEPFILTER_CH, v);
+        p3 = p2;
+        p2 = p1;
+        p1 = v;
+    }
+}
+
+/* the recursion runs down the columns, so a whole row is processed in vectors */
+static void ne10_img_gaussian_iir_col_neon (ne10_float64_t *buf,
+        ne10_float64_t *scratch,
+        ne10_uint8_t *dst,
+        ne10_int32_t dst_stride,
+        ne10_size_t size,
+        const ne10_img_gaussian_iir_coeffs_t *coeffs,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value)
+{
+    ne10_int32_t count = size.x * NE10_SEPFILTER_CH;
+    ne10_int32_t h = size.y;
+    ne10_float64_t *init = scratch;
+    ne10_float64_t *ext = scratch + count;
+    ne10_float64_t *last = buf + (h - 1) * count;
+    const ne10_float64_t *p1, *p2, *p3;
+    ne10_int32_t i, y;
+
+    /* values the columns are extended with, above and below */
+    if (border == NE10_IMG_BORDER_CONSTANT)
+    {
+        float64x2x2_t bv = ne10_img_load_pixel_f64 (border_value);
+        for (i = 0; i < count; i += 4)
+        {
+            ne10_img_store_f64x4 (init + i, bv);
+            ne10_img_store_f64x4 (ext + i, bv);
+        }
+    }
+    else
+    {
+        memcpy (init, buf, count * sizeof (ne10_float64_t));
+        memcpy (ext, last, count * sizeof (ne10_float64_t));
+    }
+
+    /* forward */
+    p1 = p2 = p3 = init;
+    for (y = 0; y < h; y++)
+    {
+        ne10_float64_t *row = buf + y * count;
+        for (i = 0; i < count; i += 4)
+        {
+            ne10_img_store_f64x4 (row + i, ne10_img_gaussian_iir_step (ne10_img_load_f64x4 (row + i),
+                                  ne10_img_load_f64x4 (p1 + i), ne10_img_load_f64x4 (p2 + i),
+                                  ne10_img_load_f64x4 (p3 + i), coeffs));
+        }
+        p3 = p2;
+        p2 = p1;
+        p1 = row;
+    }
+
+    /* state of the backward pass at the last row; init and ext are reused for it */
+    for (i = 0; i < count; i += 4)
+    {
+        float64x2x2_t v1 = ne10_img_load_f64x4 (p1 + i);
+        float64x2x2_t v2 = ne10_img_load_f64x4 (p2 + i);
+        float64x2x2_t v3 = ne10_img_load_f64x4 (p3 + i);
+        ne10_img_gaussian_iir_end_state (&v1, &v2, &v3, ne10_img_load_f64x4 (ext + i), coeffs->M);
+        ne10_img_store_f64x4 (last + i, v1);
+        ne10_img_store_f64x4 (init + i, v2);
+        ne10_img_store_f64x4 (ext + i, v3);
+        ne10_img_gaussian_iir_store_u8 (dst + (h - 1) * dst_stride + i, v1);
+    }
+
+    /* backward */
+    p1 = last;
+    p2 = init;
+    p3 = ext;
+    for (y = h - 2; y >= 0; y--)
+    {
+        ne10_float64_t *row = buf + y * count;
+        ne10_uint8_t *dst_row = dst + y * dst_stride;
+        for (i = 0; i < count; i += 4)
+        {
+            float64x2x2_t v = ne10_img_gaussian_iir_step (ne10_img_load_f64x4 (row + i),
+                              ne10_img_load_f64x4 (p1 + i), ne10_img_load_f64x4 (p2 + i),
+                              ne10_img_load_f64x4 (p3 + i), coeffs);
+            ne10_img_store_f64x4 (row + i, v);
+            ne10_img_gaussian_iir_store_u8 (dst_row + i, v);
+        }
+        p3 = p2;
+        p2 = p1;
+        p1 = row;
+    }
+}
+#endif // __aarch64__
+
+/**
+ * @ingroup IMG_SEPFILTER
+ * Specific implementation of @ref ne10_img_sepfilter_rgba8888 using NEON SIMD capabilities.
+ */
+void ne10_img_sepfilter_rgba8888_neon (const ne10_uint8_t *src,
+                                       ne10_uint8_t *dst,
+                                       ne10_size_t src_size,
+                                       ne10_int32_t src_stride,
+                                       ne10_int32_t dst_stride,
+                                       const ne10_int16_t *kernel_x,
+                                       ne10_uint32_t ksize_x,
+                                       ne10_int32_t shift_x,
+                                       const ne10_int16_t *kernel_y,
+                                       ne10_uint32_t ksize_y,
+                                       ne10_int32_t shift_y,
+                                       ne10_int32_t delta,
+                                       ne10_img_border_t border,
+                                       const ne10_uint8_t *border_value)
+{
+    ne10_img_sepfilter_generic_rgba8888 (src, dst, src_size, src_stride, dst_stride,
+                                         kernel_x, ksize_x, shift_x,
+                                         kernel_y, ksize_y, shift_y,
+                                         delta, border, border_value,
+                                         ne10_img_sepfilter_row_neon,
+                                         ne10_img_sepfilter_col_neon,
+                                         NULL);
+}
+
+/**
+ * @ingroup IMG_SEPFILTER
+ * Specific implementation of @ref ne10_img_gaussian_rgba8888 using NEON SIMD capabilities.
+ */
+void ne10_img_gaussian_rgba8888_neon (const ne10_uint8_t *src,
+                                      ne10_uint8_t *dst,
+                                      ne10_size_t src_size,
+                                      ne10_int32_t src_stride,
+                                      ne10_int32_t dst_stride,
+                                      ne10_float32_t sigma,
+                                      ne10_img_border_t border,
+                                      const ne10_uint8_t *border_value,
+                                      ne10_uint8_t *buffer)
+{
+    ne10_img_gaussian_generic_rgba8888 (src, dst, src_size, src_stride, dst_stride,
+                                        sigma, border, border_value, buffer,
+                                        ne10_img_sepfilter_row_neon,
+                                        ne10_img_sepfilter_col_neon,
+#if defined(__aarch64__)
+                                        ne10_img_gaussian_iir_row_neon,
+                                        ne10_img_gaussian_iir_col_neon);
+#else
+                                        /* ARMv7 NEON has no float64 vectors */
+                                        ne10_img_gaussian_iir_row_c,
+                                        ne10_img_gaussian_iir_col_c);
+#endif
+}
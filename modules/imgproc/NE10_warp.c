@@ -0,0 +1,350 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_warp.c
+ */
+
+#include "NE10.h"
+#include "NE10_warp.h"
+
+/**
+ * @ingroup groupIMGPROCs
+ * @defgroup IMG_WARP Image Warp
+ *
+ * \par
+ * These functions map every pixel of the destination image back into the source image
+ * through a 2x3 affine matrix or a 3x3 perspective (homography) matrix, and interpolate
+ * the source at sub-pixel accuracy with the same Q15 bilinear blend as @ref IMG_ROTATE.
+ * \par
+ * Source coordinates are carried in 16.16 fixed point. For affine warps the coordinates
+ * of a row are produced by an incremental walk (one addition per pixel), and the span of
+ * the row whose 2x2 neighbourhoods lie inside the source image is computed up front, so
+ * the inner loop needs no bound checks. Pixels whose neighbourhood leaves the source
+ * image are handled according to the border mode:
+ * - @ref NE10_IMG_BORDER_CONSTANT: samples outside the image take the given border value.
+ * - @ref NE10_IMG_BORDER_REPLICATE: samples outside the image take the nearest edge pixel.
+ */
+
+/* sample (x, y) of a 2x2 neighbourhood, with border handling */
+static inline const ne10_uint8_t* ne10_img_warp_tap (const ne10_uint8_t *src,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_int32_t x,
+        ne10_int32_t y,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value)
+{
+    if ( ( (ne10_uint32_t) x < src_size.x) && ( (ne10_uint32_t) y < src_size.y))
+        return src + y * src_stride + x * NE10_WARP_CH;
+
+    if (border == NE10_IMG_BORDER_CONSTANT)
+        return border_value;
+
+    x = NE10_MIN (NE10_MAX (x, 0), (ne10_int32_t) src_size.x - 1);
+    y = NE10_MIN (NE10_MAX (y, 0), (ne10_int32_t) src_size.y - 1);
+    return src + y * src_stride + x * NE10_WARP_CH;
+}
+
+/*
+ * Interpolate one pixel at the fixed point position (xs, ys), which must have been
+ * clamped with ne10_img_warp_clamp_fixed.
+ */
+void ne10_img_warp_sample_rgba (ne10_uint8_t *dst,
+                                const ne10_uint8_t *src,
+                                ne10_size_t src_size,
+                                ne10_int32_t src_stride,
+                                ne10_int32_t xs,
+                                ne10_int32_t ys,
+                                ne10_img_border_t border,
+                                const ne10_uint8_t *border_value)
+{
+    ne10_int32_t ix = xs >> NE10_WARP_FRAC_BITS;
+    ne10_int32_t iy = ys >> NE10_WARP_FRAC_BITS;
+    const ne10_uint8_t *p00 = ne10_img_warp_tap (src, src_size, src_stride, ix, iy, border, border_value);
+    const ne10_uint8_t *p01 = ne10_img_warp_tap (src, src_size, src_stride, ix + 1, iy, border, border_value);
+    const ne10_uint8_t *p10 = ne10_img_warp_tap (src, src_size, src_stride, ix, iy + 1, border, border_value);
+    const ne10_uint8_t *p11 = ne10_img_warp_tap (src, src_size, src_stride, ix + 1, iy + 1, border, border_value);
+
+    ne10_img_warp_blend_rgba (dst, p00, p01, p10, p11, NE10_WARP_WEIGHT (xs), NE10_WARP_WEIGHT (ys));
+}
+
+static inline ne10_int64_t ne10_img_warp_floor_div (ne10_int64_t a, ne10_int64_t b)
+{
+    return (a >= 0) ? (a / b) : - ( (-a + b - 1) / b);
+}
+
+/*
+ * Restrict [*begin, *end) to the x for which 0 <= start + x * step < limit.
+ */
+static void ne10_img_warp_clip_span (ne10_int64_t start,
+                                     ne10_int64_t step,
+                                     ne10_int64_t limit,
+                                     ne10_int32_t *begin,
+                                     ne10_int32_t *end)
+{
+    ne10_int64_t lo, hi;
+
+    if (step == 0)
+    {
+        lo = 0;
+        hi = ( (start >= 0) && (start < limit)) ? *end : 0;
+    }
+    else if (step > 0)
+    {
+        lo = ne10_img_warp_floor_div (-start + step - 1, step);
+        hi = ne10_img_warp_floor_div (limit - start + step - 1, step);
+    }
+    else
+    {
+        lo = ne10_img_warp_floor_div (start - limit, -step) + 1;
+        hi = ne10_img_warp_floor_div (start, -step) + 1;
+    }
+
+    if (lo > *begin)
+        *begin = (lo < *end) ? (ne10_int32_t) lo : *end;
+    if (hi < *end)
+        *end = (hi > *begin) ? (ne10_int32_t) hi : *begin;
+}
+
+/*
+ * Affine warp driver shared by the C and NEON implementations. Only the pixels whose
+ * 2x2 neighbourhood is entirely inside the source image are passed to row_kernel.
+ */
+void ne10_img_warp_affine_generic_rgba (const ne10_uint8_t *src,
+                                        ne10_uint8_t *dst,
+                                        ne10_size_t src_size,
+                                        ne10_int32_t src_stride,
+                                        ne10_size_t dst_size,
+                                        ne10_int32_t dst_stride,
+                                        const ne10_float32_t *matrix,
+                                        ne10_img_border_t border,
+                                        const ne10_uint8_t *border_value,
+                                        ne10_img_warp_affine_row_t row_kernel)
+{
+    ne10_int32_t x, y;
+    ne10_int64_t dxs = ne10_img_warp_to_fixed (matrix[0]);
+    ne10_int64_t dys = ne10_img_warp_to_fixed (matrix[3]);
+    ne10_int64_t xlimit = (ne10_int64_t) ( (ne10_int32_t) src_size.x - 1) << NE10_WARP_FRAC_BITS;
+    ne10_int64_t ylimit = (ne10_int64_t) ( (ne10_int32_t) src_size.y - 1) << NE10_WARP_FRAC_BITS;
+
+    if ( (src_size.x == 0) || (src_size.y == 0))
+        return;
+
+    for (y = 0; y < dst_size.y; y++)
+    {
+        ne10_uint8_t *dst_row = dst + y * dst_stride;
+        ne10_int64_t xs = ne10_img_warp_to_fixed ( (ne10_float64_t) matrix[1] * y + matrix[2]);
+        ne10_int64_t ys = ne10_img_warp_to_fixed ( (ne10_float64_t) matrix[4] * y + matrix[5]);
+        ne10_int32_t begin = 0;
+        ne10_int32_t end = dst_size.x;
+
+        ne10_img_warp_clip_span (xs, dxs, xlimit, &begin, &end);
+        ne10_img_warp_clip_span (ys, dys, ylimit, &begin, &end);
+
+        for (x = 0; x < begin; x++)
+        {
+            ne10_img_warp_sample_rgba (dst_row + x * NE10_WARP_CH, src, src_size, src_stride,
+                                       ne10_img_warp_clamp_fixed (xs + x * dxs, src_size.x),
+                                       ne10_img_warp_clamp_fixed (ys + x * dys, src_size.y),
+                                       border, border_value);
+        }
+
+        /* a span of two pixels or more bounds the steps by the image size */
+        if (end - begin > 1)
+        {
+            row_kernel (dst_row + begin * NE10_WARP_CH, src, src_stride,
+                        (ne10_int32_t) (xs + begin * dxs), (ne10_int32_t) (ys + begin * dys),
+                        (ne10_int32_t) dxs, (ne10_int32_t) dys, end - begin);
+        }
+        else if (end > begin)
+        {
+            row_kernel (dst_row + begin * NE10_WARP_CH, src, src_stride,
+                        (ne10_int32_t) (xs + begin * dxs), (ne10_int32_t) (ys + begin * dys),
+                        0, 0, 1);
+        }
+
+        for (x = end; x < dst_size.x; x++)
+        {
+            ne10_img_warp_sample_rgba (dst_row + x * NE10_WARP_CH, src, src_size, src_stride,
+                                       ne10_img_warp_clamp_fixed (xs + x * dxs, src_size.x),
+                                       ne10_img_warp_clamp_fixed (ys + x * dys, src_size.y),
+                                       border, border_value);
+        }
+    }
+}
+
+/*
+ * Perspective warp driver shared by the C and NEON implementations. Every row is
+ * processed in chunks: coord_kernel maps a chunk of destination pixels to clamped fixed
+ * point source positions, and gather_kernel interpolates them.
+ */
+void ne10_img_warp_perspective_generic_rgba (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_size_t dst_size,
+        ne10_int32_t dst_stride,
+        const ne10_float32_t *matrix,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value,
+        ne10_img_warp_coord_t coord_kernel,
+        ne10_img_warp_gather_t gather_kernel)
+{
+    ne10_int32_t xs[NE10_WARP_CHUNK];
+    ne10_int32_t ys[NE10_WARP_CHUNK];
+    ne10_int32_t x, y, count;
+
+    if ( (src_size.x == 0) || (src_size.y == 0))
+        return;
+
+    for (y = 0; y < dst_size.y; y++)
+    {
+        ne10_uint8_t *dst_row = dst + y * dst_stride;
+
+        for (x = 0; x < dst_size.x; x += count)
+        {
+            count = NE10_MIN ( (ne10_int32_t) dst_size.x - x, NE10_WARP_CHUNK);
+            coord_kernel (xs, ys, x, y, count, matrix, src_size);
+            gather_kernel (dst_row + x * NE10_WARP_CH, src, src_size, src_stride,
+                           xs, ys, count, border, border_value);
+        }
+    }
+}
+
+static void ne10_img_warp_affine_row_rgba_c (ne10_uint8_t *dst,
+        const ne10_uint8_t *src,
+        ne10_int32_t src_stride,
+        ne10_int32_t xs,
+        ne10_int32_t ys,
+        ne10_int32_t dxs,
+        ne10_int32_t dys,
+        ne10_int32_t count)
+{
+    ne10_int32_t x;
+
+    for (x = 0; x < count; x++)
+    {
+        ne10_int32_t u = xs + x * dxs;
+        ne10_int32_t v = ys + x * dys;
+        const ne10_uint8_t *p0 = src + (v >> NE10_WARP_FRAC_BITS) * src_stride
+                                 + (u >> NE10_WARP_FRAC_BITS) * NE10_WARP_CH;
+        const ne10_uint8_t *p1 = p0 + src_stride;
+
+        ne10_img_warp_blend_rgba (dst + x * NE10_WARP_CH, p0, p0 + NE10_WARP_CH, p1, p1 + NE10_WARP_CH,
+                                  NE10_WARP_WEIGHT (u), NE10_WARP_WEIGHT (v));
+    }
+}
+
+static void ne10_img_warp_perspective_coord_c (ne10_int32_t *xs,
+        ne10_int32_t *ys,
+        ne10_int32_t x,
+        ne10_int32_t y,
+        ne10_int32_t count,
+        const ne10_float32_t *matrix,
+        ne10_size_t src_size)
+{
+    ne10_int32_t i;
+    ne10_float32_t nx0 = matrix[1] * y + matrix[2];
+    ne10_float32_t ny0 = matrix[4] * y + matrix[5];
+    ne10_float32_t nw0 = matrix[7] * y + matrix[8];
+    ne10_float32_t xmax = (ne10_float32_t) src_size.x + 1.0f;
+    ne10_float32_t ymax = (ne10_float32_t) src_size.y + 1.0f;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t fx = (ne10_float32_t) (x + i);
+        ne10_float32_t w = matrix[6] * fx + nw0;
+        ne10_float32_t u = (matrix[0] * fx + nx0) / w;
+        ne10_float32_t v = (matrix[3] * fx + ny0) / w;
+
+        /* written so that NaN (w == 0) goes to the lower bound */
+        u = (u >= -2.0f) ? u : -2.0f;
+        v = (v >= -2.0f) ? v : -2.0f;
+        u = (u <= xmax) ? u : xmax;
+        v = (v <= ymax) ? v : ymax;
+
+        xs[i] = (ne10_int32_t) (u * NE10_WARP_ONE + 0.5f);
+        ys[i] = (ne10_int32_t) (v * NE10_WARP_ONE + 0.5f);
+    }
+}
+
+static void ne10_img_warp_gather_rgba_c (ne10_uint8_t *dst,
+        const ne10_uint8_t *src,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        const ne10_int32_t *xs,
+        const ne10_int32_t *ys,
+        ne10_int32_t count,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value)
+{
+    ne10_int32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_img_warp_sample_rgba (dst + i * NE10_WARP_CH, src, src_size, src_stride,
+                                   xs[i], ys[i], border, border_value);
+    }
+}
+
+/**
+ * @ingroup IMG_WARP
+ * Specific implementation of @ref ne10_img_warp_affine_rgba using plain C.
+ */
+void ne10_img_warp_affine_rgba_c (const ne10_uint8_t *src,
+                                  ne10_uint8_t *dst,
+                                  ne10_size_t src_size,
+                                  ne10_int32_t src_stride,
+                                  ne10_size_t dst_size,
+                                  ne10_int32_t dst_stride,
+                                  const ne10_float32_t *matrix,
+                                  ne10_img_border_t border,
+                                  const ne10_uint8_t *border_value)
+{
+    ne10_img_warp_affine_generic_rgba (src, dst, src_size, src_stride, dst_size, dst_stride,
+                                       matrix, border, border_value, ne10_img_warp_affine_row_rgba_c);
+}
+
+/**
+ * @ingroup IMG_WARP
+ * Specific implementation of @ref ne10_img_warp_perspective_rgba using plain C.
+ */
+void ne10_img_warp_perspective_rgba_c (const ne10_uint8_t *src,
+                                       ne10_uint8_t *dst,
+                                       ne10_size_t src_size,
+                                       ne10_int32_t src_stride,
+                                       ne10_size_t dst_size,
+                                       ne10_int32_t dst_stride,
+                                       const ne10_float32_t *matrix,
+                                       ne10_img_border_t border,
+                                       const ne10_uint8_t *border_value)
+{
+    ne10_img_warp_perspective_generic_rgba (src, dst, src_size, src_stride, dst_size, dst_stride,
+                                            matrix, border, border_value,
+                                            ne10_img_warp_perspective_coord_c, ne10_img_warp_gather_rgba_c);
+}
@@ -0,0 +1,154 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_warp.h
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+
+#ifndef NE10_WARP_H
+#define NE10_WARP_H
+
+///////////////////////////
+// Internal macro define
+///////////////////////////
+
+/* RGBA CHANNEL number is 4 */
+#define NE10_WARP_CH            4
+/* source coordinates are 16.16 fixed point */
+#define NE10_WARP_FRAC_BITS     16
+#define NE10_WARP_ONE           (1 << NE10_WARP_FRAC_BITS)
+/* number of pixels whose coordinates are computed at once by perspective warps */
+#define NE10_WARP_CHUNK         64
+/* Q15 interpolation weight of a 16.16 coordinate */
+#define NE10_WARP_WEIGHT(v)     (((v) & (NE10_WARP_ONE - 1)) >> 1)
+
+typedef void (*ne10_img_warp_affine_row_t) (ne10_uint8_t *dst,
+        const ne10_uint8_t *src,
+        ne10_int32_t src_stride,
+        ne10_int32_t xs,
+        ne10_int32_t ys,
+        ne10_int32_t dxs,
+        ne10_int32_t dys,
+        ne10_int32_t count);
+
+typedef void (*ne10_img_warp_coord_t) (ne10_int32_t *xs,
+                                       ne10_int32_t *ys,
+                                       ne10_int32_t x,
+                                       ne10_int32_t y,
+                                       ne10_int32_t count,
+                                       const ne10_float32_t *matrix,
+                                       ne10_size_t src_size);
+
+typedef void (*ne10_img_warp_gather_t) (ne10_uint8_t *dst,
+                                        const ne10_uint8_t *src,
+                                        ne10_size_t src_size,
+                                        ne10_int32_t src_stride,
+                                        const ne10_int32_t *xs,
+                                        const ne10_int32_t *ys,
+                                        ne10_int32_t count,
+                                        ne10_img_border_t border,
+                                        const ne10_uint8_t *border_value);
+
+/* convert to 16.16 fixed point, saturating far outside any image */
+static inline ne10_int64_t ne10_img_warp_to_fixed (ne10_float64_t v)
+{
+    v = v * NE10_WARP_ONE + 0.5;
+    v = (v >= -1099511627776.0) ? v : -1099511627776.0;
+    v = (v <= 1099511627776.0) ? v : 1099511627776.0;
+    return (ne10_int64_t) floor (v);
+}
+
+/*
+ * Beyond two pixels outside the image every tap of a 2x2 neighbourhood falls on the
+ * border, so coordinates can be clamped there without changing the result.
+ */
+static inline ne10_int32_t ne10_img_warp_clamp_fixed (ne10_int64_t v, ne10_uint32_t size)
+{
+    ne10_int64_t lo = -2 * (ne10_int64_t) NE10_WARP_ONE;
+    ne10_int64_t hi = ( (ne10_int64_t) size + 1) * NE10_WARP_ONE;
+    return (ne10_int32_t) NE10_MIN (NE10_MAX (v, lo), hi);
+}
+
+/*
+ * Q15 bilinear blend, same arithmetic as ne10_img_rotate_get_quad_rangle_subpix_rgba_c:
+ * a horizontal pass on both rows, then a vertical pass, each rounded with NE10_F2I16_SROUND.
+ */
+static inline void ne10_img_warp_blend_rgba (ne10_uint8_t *dst,
+        const ne10_uint8_t *p00,
+        const ne10_uint8_t *p01,
+        const ne10_uint8_t *p10,
+        const ne10_uint8_t *p11,
+        ne10_int32_t a,
+        ne10_int32_t b)
+{
+    ne10_int32_t a1 = NE10_F2I16_MAX - a;
+    ne10_int32_t k;
+
+    for (k = 0; k < NE10_WARP_CH; k++)
+    {
+        ne10_int32_t t0 = NE10_F2I16_SROUND (p00[k] * a1 + p01[k] * a);
+        ne10_int32_t t1 = NE10_F2I16_SROUND (p10[k] * a1 + p11[k] * a);
+        dst[k] = (ne10_uint8_t) NE10_F2I16_SROUND (t0 * NE10_F2I16_MAX + b * (t1 - t0));
+    }
+}
+
+extern void ne10_img_warp_sample_rgba (ne10_uint8_t *dst,
+                                       const ne10_uint8_t *src,
+                                       ne10_size_t src_size,
+                                       ne10_int32_t src_stride,
+                                       ne10_int32_t xs,
+                                       ne10_int32_t ys,
+                                       ne10_img_border_t border,
+                                       const ne10_uint8_t *border_value);
+
+extern void ne10_img_warp_affine_generic_rgba (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_size_t dst_size,
+        ne10_int32_t dst_stride,
+        const ne10_float32_t *matrix,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value,
+        ne10_img_warp_affine_row_t row_kernel);
+
+extern void ne10_img_warp_perspective_generic_rgba (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_size_t dst_size,
+        ne10_int32_t dst_stride,
+        const ne10_float32_t *matrix,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value,
+        ne10_img_warp_coord_t coord_kernel,
+        ne10_img_warp_gather_t gather_kernel);
+
+#endif // NE10_WARP_H
@@ -0,0 +1,289 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/NE10_warp.neon.c
+ */
+
+#include "NE10.h"
+#include "NE10_warp.h"
+#include <arm_neon.h>
+
+static const ne10_int32_t ne10_img_warp_lane_index[4] = {0, 1, 2, 3};
+
+/*
+ * Interpolate the four pixels at fixed point positions (vx, vy) whose 2x2
+ * neighbourhoods are all inside the source image.
+ */
+static inline void ne10_img_warp_blend4_rgba_neon (ne10_uint8_t *dst,
+        const ne10_uint8_t *src,
+        ne10_int32_t src_stride,
+        int32x4_t vx,
+        int32x4_t vy)
+{
+    const int32x4_t frac_mask = vdupq_n_s32 (NE10_WARP_ONE - 1);
+    int32x4_t offset;
+    ne10_int32_t offsets[4];
+    int16x4_t a, a1, b;
+    int16x4x2_t a_2, a1_2, b_2;
+    ne10_int32_t k;
+
+    /* gather offsets of the top left pixels */
+    offset = vshlq_n_s32 (vshrq_n_s32 (vx, NE10_WARP_FRAC_BITS), 2);
+    offset = vmlaq_n_s32 (offset, vshrq_n_s32 (vy, NE10_WARP_FRAC_BITS), src_stride);
+    vst1q_s32 (offsets, offset);
+
+    /* Q15 weights */
+    a = vmovn_s32 (vshrq_n_s32 (vandq_s32 (vx, frac_mask), 1));
+    b = vmovn_s32 (vshrq_n_s32 (vandq_s32 (vy, frac_mask), 1));
+    a1 = vsub_s16 (vdup_n_s16 (NE10_F2I16_MAX), a);
+
+    /* spread every weight over the four channels of its pixel */
+    a_2 = vzip_s16 (a, a);
+    a1_2 = vzip_s16 (a1, a1);
+    b_2 = vzip_s16 (b, b);
+
+    for (k = 0; k < 2; k++)
+    {
+        const ne10_uint8_t *p0 = src + offsets[2 * k];
+        const ne10_uint8_t *p1 = src + offsets[2 * k + 1];
+        uint32x2x2_t top, bottom;
+        int16x8_t p00, p01, p10, p11;
+        int16x4x2_t wa, wa1, wb;
+        int16x4_t t0_lo, t0_hi, t1_lo, t1_hi, d_lo, d_hi;
+        int32x4_t acc;
+        int16x8_t res;
+
+        /* two pixels per register: [p00 p01] of each pixel, zipped to [p00 p00'] [p01 p01'] */
+        top = vzip_u32 (vreinterpret_u32_u8 (vld1_u8 (p0)), vreinterpret_u32_u8 (vld1_u8 (p1)));
+        bottom = vzip_u32 (vreinterpret_u32_u8 (vld1_u8 (p0 + src_stride)),
+                           vreinterpret_u32_u8 (vld1_u8 (p1 + src_stride)));
+        p00 = vreinterpretq_s16_u16 (vmovl_u8 (vreinterpret_u8_u32 (top.val[0])));
+        p01 = vreinterpretq_s16_u16 (vmovl_u8 (vreinterpret_u8_u32 (top.val[1])));
+        p10 = vreinterpretq_s16_u16 (vmovl_u8 (vreinterpret_u8_u32 (bottom.val[0])));
+        p11 = vreinterpretq_s16_u16 (vmovl_u8 (vreinterpret_u8_u32 (bottom.val[1])));
+
+        wa = vzip_s16 (a_2.val[k], a_2.val[k]);
+        wa1 = vzip_s16 (a1_2.val[k], a1_2.val[k]);
+        wb = vzip_s16 (b_2.val[k], b_2.val[k]);
+
+        /* horizontal pass */
+        acc = vmull_s16 (vget_low_s16 (p00), wa1.val[0]);
+        acc = vmlal_s16 (acc, vget_low_s16 (p01), wa.val[0]);
+        t0_lo = vrshrn_n_s32 (acc, NE10_F2I16_SHIFT);
+        acc = vmull_s16 (vget_high_s16 (p00), wa1.val[1]);
+        acc = vmlal_s16 (acc, vget_high_s16 (p01), wa.val[1]);
+        t0_hi = vrshrn_n_s32 (acc, NE10_F2I16_SHIFT);
+        acc = vmull_s16 (vget_low_s16 (p10), wa1.val[0]);
+        acc = vmlal_s16 (acc, vget_low_s16 (p11), wa.val[0]);
+        t1_lo = vrshrn_n_s32 (acc, NE10_F2I16_SHIFT);
+        acc = vmull_s16 (vget_high_s16 (p10), wa1.val[1]);
+        acc = vmlal_s16 (acc, vget_high_s16 (p11), wa.val[1]);
+        t1_hi = vrshrn_n_s32 (acc, NE10_F2I16_SHIFT);
+
+        /* vertical pass */
+        d_lo = vsub_s16 (t1_lo, t0_lo);
+        d_hi = vsub_s16 (t1_hi, t0_hi);
+        acc = vmull_n_s16 (t0_lo, NE10_F2I16_MAX);
+        acc = vmlal_s16 (acc, d_lo, wb.val[0]);
+        t0_lo = vrshrn_n_s32 (acc, NE10_F2I16_SHIFT);
+        acc = vmull_n_s16 (t0_hi, NE10_F2I16_MAX);
+        acc = vmlal_s16 (acc, d_hi, wb.val[1]);
+        t0_hi = vrshrn_n_s32 (acc, NE10_F2I16_SHIFT);
+
+        res = vcombine_s16 (t0_lo, t0_hi);
+        vst1_u8 (dst + k * 2 * NE10_WARP_CH, vqmovun_s16 (res));
+    }
+}
+
+static void ne10_img_warp_affine_row_rgba_neon (ne10_uint8_t *dst,
+        const ne10_uint8_t *src,
+        ne10_int32_t src_stride,
+        ne10_int32_t xs,
+        ne10_int32_t ys,
+        ne10_int32_t dxs,
+        ne10_int32_t dys,
+        ne10_int32_t count)
+{
+    int32x4_t index = vld1q_s32 (ne10_img_warp_lane_index);
+    int32x4_t vx = vmlaq_n_s32 (vdupq_n_s32 (xs), index, dxs);
+    int32x4_t vy = vmlaq_n_s32 (vdupq_n_s32 (ys), index, dys);
+    int32x4_t step_x = vshlq_n_s32 (vdupq_n_s32 (dxs), 2);
+    int32x4_t step_y = vshlq_n_s32 (vdupq_n_s32 (dys), 2);
+    ne10_int32_t x;
+
+    /* incremental coordinate walk, four pixels per iteration */
+    for (x = 0; x + 4 <= count; x += 4)
+    {
+        ne10_img_warp_blend4_rgba_neon (dst + x * NE10_WARP_CH, src, src_stride, vx, vy);
+        vx = vaddq_s32 (vx, step_x);
+        vy = vaddq_s32 (vy, step_y);
+    }
+
+    for (; x < count; x++)
+    {
+        ne10_int32_t u = xs + x * dxs;
+        ne10_int32_t v = ys + x * dys;
+        const ne10_uint8_t *p0 = src + (v >> NE10_WARP_FRAC_BITS) * src_stride
+                                 + (u >> NE10_WARP_FRAC_BITS) * NE10_WARP_CH;
+        const ne10_uint8_t *p1 = p0 + src_stride;
+
+        ne10_img_warp_blend_rgba (dst + x * NE10_WARP_CH, p0, p0 + NE10_WARP_CH, p1, p1 + NE10_WARP_CH,
+                                  NE10_WARP_WEIGHT (u), NE10_WARP_WEIGHT (v));
+    }
+}
+
+static void ne10_img_warp_perspective_coord_neon (ne10_int32_t *xs,
+        ne10_int32_t *ys,
+        ne10_int32_t x,
+        ne10_int32_t y,
+        ne10_int32_t count,
+        const ne10_float32_t *matrix,
+        ne10_size_t src_size)
+{
+    /* NE10_WARP_CHUNK is a multiple of 4, so whole vectors can be stored */
+    const float32x4_t lo = vdupq_n_f32 (-2.0f);
+    const float32x4_t xmax = vdupq_n_f32 ( (ne10_float32_t) src_size.x + 1.0f);
+    const float32x4_t ymax = vdupq_n_f32 ( (ne10_float32_t) src_size.y + 1.0f);
+    const float32x4_t half = vdupq_n_f32 (0.5f);
+    float32x4_t nx0 = vdupq_n_f32 (matrix[1] * y + matrix[2]);
+    float32x4_t ny0 = vdupq_n_f32 (matrix[4] * y + matrix[5]);
+    float32x4_t nw0 = vdupq_n_f32 (matrix[7] * y + matrix[8]);
+    int32x4_t vx = vaddq_s32 (vdupq_n_s32 (x), vld1q_s32 (ne10_img_warp_lane_index));
+    ne10_int32_t i;
+
+    for (i = 0; i < count; i += 4)
+    {
+        float32x4_t fx = vcvtq_f32_s32 (vx);
+        float32x4_t w = vmlaq_n_f32 (nw0, fx, matrix[6]);
+        float32x4_t u = vmlaq_n_f32 (nx0, fx, matrix[0]);
+        float32x4_t v = vmlaq_n_f32 (ny0, fx, matrix[3]);
+
+#if defined(__aarch64__)
+        u = vdivq_f32 (u, w);
+        v = vdivq_f32 (v, w);
+#else
+        float32x4_t rw = vrecpeq_f32 (w);
+        rw = vmulq_f32 (vrecpsq_f32 (w, rw), rw);
+        rw = vmulq_f32 (vrecpsq_f32 (w, rw), rw);
+        u = vmulq_f32 (u, rw);
+        v = vmulq_f32 (v, rw);
+#endif
+
+        /* clamp, sending NaN (w == 0) to the lower bound */
+        u = vbslq_f32 (vcgeq_f32 (u, lo), u, lo);
+        v = vbslq_f32 (vcgeq_f32 (v, lo), v, lo);
+        u = vminq_f32 (u, xmax);
+        v = vminq_f32 (v, ymax);
+
+        vst1q_s32 (xs + i, vcvtq_s32_f32 (vmlaq_n_f32 (half, u, NE10_WARP_ONE)));
+        vst1q_s32 (ys + i, vcvtq_s32_f32 (vmlaq_n_f32 (half, v, NE10_WARP_ONE)));
+        vx = vaddq_s32 (vx, vdupq_n_s32 (4));
+    }
+}
+
+static void ne10_img_warp_gather_rgba_neon (ne10_uint8_t *dst,
+        const ne10_uint8_t *src,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        const ne10_int32_t *xs,
+        const ne10_int32_t *ys,
+        ne10_int32_t count,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value)
+{
+    const uint32x4_t xlimit = vdupq_n_u32 (src_size.x - 1);
+    const uint32x4_t ylimit = vdupq_n_u32 (src_size.y - 1);
+    ne10_int32_t i, k;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        int32x4_t vx = vld1q_s32 (xs + i);
+        int32x4_t vy = vld1q_s32 (ys + i);
+        uint32x4_t inside;
+        uint32x2_t inside2;
+
+        /* negative coordinates compare as large unsigned values */
+        inside = vcltq_u32 (vreinterpretq_u32_s32 (vshrq_n_s32 (vx, NE10_WARP_FRAC_BITS)), xlimit);
+        inside = vandq_u32 (inside, vcltq_u32 (vreinterpretq_u32_s32 (vshrq_n_s32 (vy, NE10_WARP_FRAC_BITS)), ylimit));
+        inside2 = vand_u32 (vget_low_u32 (inside), vget_high_u32 (inside));
+
+        if (vget_lane_u32 (inside2, 0) & vget_lane_u32 (inside2, 1))
+        {
+            ne10_img_warp_blend4_rgba_neon (dst + i * NE10_WARP_CH, src, src_stride, vx, vy);
+        }
+        else
+        {
+            for (k = i; k < i + 4; k++)
+                ne10_img_warp_sample_rgba (dst + k * NE10_WARP_CH, src, src_size, src_stride,
+                                           xs[k], ys[k], border, border_value);
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        ne10_img_warp_sample_rgba (dst + i * NE10_WARP_CH, src, src_size, src_stride,
+                                   xs[i], ys[i], border, border_value);
+    }
+}
+
+/**
+ * @ingroup IMG_WARP
+ * Specific implementation of @ref ne10_img_warp_affine_rgba using NEON SIMD capabilities.
+ */
+void ne10_img_warp_affine_rgba_neon (const ne10_uint8_t *src,
+                                     ne10_uint8_t *dst,
+                                     ne10_size_t src_size,
+                                     ne10_int32_t src_stride,
+                                     ne10_size_t dst_size,
+                                     ne10_int32_t dst_stride,
+                                     const ne10_float32_t *matrix,
+                                     ne10_img_border_t border,
+                                     const ne10_uint8_t *border_value)
+{
+    ne10_img_warp_affine_generic_rgba (src, dst, src_size, src_stride, dst_size, dst_stride,
+                                       matrix, border, border_value, ne10_img_warp_affine_row_rgba_neon);
+}
+
+/**
+ * @ingroup IMG_WARP
+ * Specific implementation of @ref ne10_img_warp_perspective_rgba using NEON SIMD capabilities.
+ */
+void ne10_img_warp_perspective_rgba_neon (const ne10_uint8_t *src,
+        ne10_uint8_t *dst,
+        ne10_size_t src_size,
+        ne10_int32_t src_stride,
+        ne10_size_t dst_size,
+        ne10_int32_t dst_stride,
+        const ne10_float32_t *matrix,
+        ne10_img_border_t border,
+        const ne10_uint8_t *border_value)
+{
+    ne10_img_warp_perspective_generic_rgba (src, dst, src_size, src_stride, dst_size, dst_stride,
+                                            matrix, border, border_value,
+                                            ne10_img_warp_perspective_coord_neon, ne10_img_warp_gather_rgba_neon);
+}
@@ -0,0 +1,249 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : imgproc/test/bench_imgproc.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "NE10_imgproc.h"
+#include "NE10_bench.h"
+
+#define NE10_BENCH_PYRAMID_LEVELS 4
+#define NE10_BENCH_GAUSSIAN_SIGMA 1.5f
+
+/*
+ * RGBA8888 images of size x size pixels. The destination is large enough
+ * for the bounding box of any rotation of the source; resizes halve each
+ * dimension.
+ */
+typedef struct
+{
+    ne10_uint32_t side;
+    ne10_int32_t stride;
+    ne10_uint8_t * src;
+    ne10_uint8_t * dst;
+    ne10_uint8_t * arena;
+    ne10_uint32_t arena_size;
+    ne10_img_resize_plan_t plan;
+    ne10_img_pyramid_level_t pyramid[NE10_BENCH_PYRAMID_LEVELS];
+} ne10_bench_img_state_t;
+
+static const ne10_int16_t bench_img_kernel[5] = { 1, 4, 6, 4, 1 };
+static const ne10_uint8_t bench_img_border[4] = { 0, 0, 0, 0xff };
+
+// a rotation of 30 degrees about the centre and a mild perspective
+static const ne10_float32_t bench_img_affine[6] =
+{
+    0.866025f, -0.5f, 0.0f,
+    0.5f, 0.866025f, 0.0f
+};
+static const ne10_float32_t bench_img_perspective[9] =
+{
+    0.9f, 0.1f, 4.0f,
+    -0.1f, 0.95f, 2.0f,
+    0.0001f, 0.0002f, 1.0f
+};
+
+static void bench_img_teardown (void * state)
+{
+    ne10_bench_img_state_t * st = (ne10_bench_img_state_t *) state;
+
+    if (st->plan != NULL)
+        ne10_img_resize_plan_destroy (st->plan);
+    ne10_bench_free (st->src);
+    ne10_bench_free (st->dst);
+    ne10_bench_free (st->arena);
+    free (st);
+}
+
+static void * bench_img_setup (ne10_uint32_t side)
+{
+    ne10_bench_img_state_t * st = (ne10_bench_img_state_t *) calloc (1, sizeof (ne10_bench_img_state_t));
+    ne10_size_t size;
+
+    if (st == NULL)
+        return NULL;
+    size.x = size.y = side;
+    st->side = side;
+    st->stride = side * 4;
+    // the arena serves both the pyramid and the Gaussian buffer
+    st->arena_size = NE10_MAX (ne10_img_pyramid_buffer_size (size, NE10_BENCH_PYRAMID_LEVELS, 1),
+                               ne10_img_gaussian_buffer_size (size, NE10_BENCH_GAUSSIAN_SIGMA));
+    st->src = (ne10_uint8_t *) ne10_bench_alloc (side * side * 4);
+    st->dst = (ne10_uint8_t *) ne10_bench_alloc (4 * side * side * 4);
+    st->arena = (ne10_uint8_t *) ne10_bench_alloc (st->arena_size);
+    st->plan = ne10_img_resize_plan_create (side, side, side / 2, side / 2, 4, NE10_IMG_RESIZE_BILINEAR);
+    if (st->src == NULL || st->dst == NULL || st->arena == NULL || st->plan == NULL)
+    {
+        bench_img_teardown (st);
+        return NULL;
+    }
+    return st;
+}
+
+#define IMG_STATE \
+    ne10_bench_img_state_t * st = (ne10_bench_img_state_t *) state; \
+    ne10_size_t size; \
+    size.x = size.y = st->side
+
+static void bench_img_resize_bilinear_rgba (void * state)
+{
+    IMG_STATE;
+    (void) size;
+    ne10_img_resize_bilinear_rgba (st->dst, st->side / 2, st->side / 2, st->src, st->side, st->side, st->side);
+}
+
+static void bench_img_resize_plan_execute (void * state)
+{
+    IMG_STATE;
+    (void) size;
+    ne10_img_resize_plan_execute (st->plan, st->dst, st->stride / 2, st->src, st->stride);
+}
+
+static void bench_img_rotate_rgba (void * state)
+{
+    ne10_uint32_t width, height;
+    IMG_STATE;
+    (void) size;
+    ne10_img_rotate_rgba (st->dst, &width, &height, st->src, st->side, st->side, 30);
+}
+
+static void bench_img_rotate_right_angle_rgba (void * state)
+{
+    IMG_STATE;
+    ne10_img_rotate_right_angle_rgba (st->src, st->dst, size, st->stride, st->stride, 90);
+}
+
+static void bench_img_rotate_right_angle_inplace_rgba (void * state)
+{
+    IMG_STATE;
+    (void) size;
+    ne10_img_rotate_right_angle_inplace_rgba (st->src, st->side, st->stride, 90);
+}
+
+static void bench_img_flip_rgba (void * state)
+{
+    IMG_STATE;
+    ne10_img_flip_rgba (st->src, st->dst, size, st->stride, st->stride, NE10_IMG_FLIP_HORIZONTAL);
+}
+
+static void bench_img_boxfilter_rgba8888 (void * state)
+{
+    ne10_size_t kernel = { 5, 5 };
+    IMG_STATE;
+    ne10_img_boxfilter_rgba8888 (st->src, st->dst, size, st->stride, st->stride, kernel);
+}
+
+static void bench_img_warp_affine_rgba (void * state)
+{
+    IMG_STATE;
+    ne10_img_warp_affine_rgba (st->src, st->dst, size, st->stride, size, st->stride,
+                               bench_img_affine, NE10_IMG_BORDER_CONSTANT, bench_img_border);
+}
+
+static void bench_img_warp_perspective_rgba (void * state)
+{
+    IMG_STATE;
+    ne10_img_warp_perspective_rgba (st->src, st->dst, size, st->stride, size, st->stride,
+                                    bench_img_perspective, NE10_IMG_BORDER_CONSTANT, bench_img_border);
+}
+
+static void bench_img_sepfilter_rgba8888 (void * state)
+{
+    IMG_STATE;
+    ne10_img_sepfilter_rgba8888 (st->src, st->dst, size, st->stride, st->stride,
+                                 bench_img_kernel, 5, 4, bench_img_kernel, 5, 4, 0,
+                                 NE10_IMG_BORDER_REPLICATE, bench_img_border);
+}
+
+static void bench_img_gaussian_rgba8888 (void * state)
+{
+    IMG_STATE;
+    ne10_img_gaussian_rgba8888 (st->src, st->dst, size, st->stride, st->stride, NE10_BENCH_GAUSSIAN_SIGMA,
+                                NE10_IMG_BORDER_REPLICATE, bench_img_border, st->arena);
+}
+
+static void bench_img_pyramid_rgba8888 (void * state)
+{
+    IMG_STATE;
+    ne10_img_pyramid_rgba8888 (st->src, size, st->stride, NE10_BENCH_PYRAMID_LEVELS, 1,
+                               st->arena, st->arena_size, st->pyramid);
+}
+
+/*
+ * name, run, and bytes read and written per source pixel. Image functions
+ * count no flops; their throughput is in pixels and bytes.
+ */
+static const struct
+{
+    const char * name;
+    ne10_bench_run_t run;
+    ne10_float64_t bytes;
+} bench_img_functions[] =
+{
+    { "ne10_img_resize_bilinear_rgba", bench_img_resize_bilinear_rgba, 5 },
+    { "ne10_img_resize_plan_execute", bench_img_resize_plan_execute, 5 },
+    { "ne10_img_rotate_rgba", bench_img_rotate_rgba, 8 },
+    { "ne10_img_rotate_right_angle_rgba", bench_img_rotate_right_angle_rgba, 8 },
+    { "ne10_img_rotate_right_angle_inplace_rgba", bench_img_rotate_right_angle_inplace_rgba, 8 },
+    { "ne10_img_flip_rgba", bench_img_flip_rgba, 8 },
+    { "ne10_img_boxfilter_rgba8888", bench_img_boxfilter_rgba8888, 8 },
+    { "ne10_img_warp_affine_rgba", bench_img_warp_affine_rgba, 8 },
+    { "ne10_img_warp_perspective_rgba", bench_img_warp_perspective_rgba, 8 },
+    { "ne10_img_sepfilter_rgba8888", bench_img_sepfilter_rgba8888, 8 },
+    { "ne10_img_gaussian_rgba8888", bench_img_gaussian_rgba8888, 8 },
+    { "ne10_img_pyramid_rgba8888", bench_img_pyramid_rgba8888, 4 + 4.0 * 4 / 3 + 8 },
+};
+
+void ne10_bench_register_imgproc (void)
+{
+    static const ne10_uint32_t sides[] = { 256, 1024 };
+    ne10_bench_case_t c;
+    ne10_uint32_t i, s;
+
+    c.module = "imgproc";
+    c.setup = bench_img_setup;
+    c.teardown = bench_img_teardown;
+    c.flops = 0;
+    for (i = 0; i < sizeof (bench_img_functions) / sizeof (bench_img_functions[0]); i++)
+    {
+        for (s = 0; s < sizeof (sides) / sizeof (sides[0]); s++)
+        {
+            ne10_float64_t pixels = (ne10_float64_t) sides[s] * sides[s];
+
+            snprintf (c.name, sizeof (c.name), "%s", bench_img_functions[i].name);
+            c.size = sides[s];
+            c.items = pixels;
+            c.bytes = pixels * bench_img_functions[i].bytes;
+            c.run = bench_img_functions[i].run;
+            ne10_bench_add (&c);
+        }
+    }
+}
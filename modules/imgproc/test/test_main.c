@@ -30,15 +30,22 @@
  */
 
 #include "seatest.h"
+#include "unit_test_common.h"
 
 void test_fixture_resize (void);
 void test_fixture_rotate (void);
+void test_fixture_warp (void);
+void test_fixture_sepfilter (void);
+void test_fixture_pyramid (void);
 
 void all_tests (void)
 {
     test_fixture_resize();
     test_fixture_rotate();
     test_fixture_boxfilter();
+    test_fixture_warp();
+    test_fixture_sepfilter();
+    test_fixture_pyramid();
 }
 
 
@@ -52,7 +59,8 @@ void my_suite_teardown (void)
 
 int main (ne10_int32_t argc, char** argv)
 {
+    ne10_test_init (argc, argv);
     suite_setup (my_suite_setup);
     suite_teardown (my_suite_teardown);
-    return !run_tests (all_tests);
+    return ne10_test_finish (run_tests (all_tests));
 }
@@ -0,0 +1,333 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_pyramid.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "NE10_imgproc.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+#define RGBA_CH 4
+#define MAX_LEVELS 8
+#define TEST_COUNT 10
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+
+static ne10_uint8_t* pyramid_create_image (ne10_size_t size)
+{
+    ne10_int32_t i;
+    ne10_int32_t bytes = size.x * size.y * RGBA_CH;
+    ne10_uint8_t *img = (ne10_uint8_t*) NE10_MALLOC (bytes);
+
+    for (i = 0; i < bytes; i++)
+    {
+        img[i] = (rand() & 0xff);
+    }
+    return img;
+}
+
+static ne10_int32_t pyramid_clamp (ne10_int32_t v, ne10_int32_t lo, ne10_int32_t hi)
+{
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+static ne10_int32_t pyramid_pixel (const ne10_img_pyramid_level_t *level,
+                                   ne10_int32_t x,
+                                   ne10_int32_t y,
+                                   ne10_int32_t k)
+{
+    x = pyramid_clamp (x, 0, level->size.x - 1);
+    y = pyramid_clamp (y, 0, level->size.y - 1);
+    return level->image[y * level->stride + x * RGBA_CH + k];
+}
+
+/* direct 5x5 binomial blur evaluated at the even pixels of the fine level */
+static ne10_int32_t pyramid_reduce_reference (const ne10_img_pyramid_level_t *fine,
+        ne10_int32_t x,
+        ne10_int32_t y,
+        ne10_int32_t k)
+{
+    static const ne10_int32_t w[5] = {1, 4, 6, 4, 1};
+    ne10_int32_t i, j, sum = 0;
+
+    for (j = 0; j < 5; j++)
+        for (i = 0; i < 5; i++)
+            sum += w[j] * w[i] * pyramid_pixel (fine, 2 * x + i - 2, 2 * y + j - 2, k);
+    return (sum + 128) >> 8;
+}
+
+/* upsampling of the coarse level at fine pixel (x, y) */
+static ne10_int32_t pyramid_expand_reference (const ne10_img_pyramid_level_t *coarse,
+        ne10_int32_t x,
+        ne10_int32_t y,
+        ne10_int32_t k)
+{
+    static const ne10_int32_t even[3] = {1, 6, 1};
+    static const ne10_int32_t odd[3] = {0, 4, 4};
+    const ne10_int32_t *wx = (x & 1) ? odd : even;
+    const ne10_int32_t *wy = (y & 1) ? odd : even;
+    ne10_int32_t i, j, sum = 0;
+
+    for (j = 0; j < 3; j++)
+        for (i = 0; i < 3; i++)
+            sum += wy[j] * wx[i] * pyramid_pixel (coarse, (x >> 1) + i - 1, (y >> 1) + j - 1, k);
+    return (sum + 32) >> 6;
+}
+
+/* checks every level against the references; returns the number of mismatches */
+static ne10_int32_t pyramid_check (const ne10_img_pyramid_level_t *pyramid,
+                                   ne10_int32_t levels,
+                                   ne10_int32_t laplacian)
+{
+    ne10_int32_t errors = 0;
+    ne10_int32_t i, x, y, k;
+
+    for (i = 1; i < levels; i++)
+    {
+        const ne10_img_pyramid_level_t *fine = &pyramid[i - 1];
+        const ne10_img_pyramid_level_t *coarse = &pyramid[i];
+
+        if ( (coarse->size.x != (fine->size.x + 1) / 2) || (coarse->size.y != (fine->size.y + 1) / 2))
+            return 1;
+        for (y = 0; y < coarse->size.y; y++)
+            for (x = 0; x < coarse->size.x; x++)
+                for (k = 0; k < RGBA_CH; k++)
+                    errors += (coarse->image[y * coarse->stride + x * RGBA_CH + k]
+                               != pyramid_reduce_reference (fine, x, y, k));
+
+        if (!laplacian)
+            continue;
+        /* the residual plus the expansion gives the fine level back */
+        for (y = 0; y < fine->size.y; y++)
+            for (x = 0; x < fine->size.x; x++)
+                for (k = 0; k < RGBA_CH; k++)
+                    errors += (fine->laplacian[ (y * fine->size.x + x) * RGBA_CH + k]
+                               + pyramid_expand_reference (coarse, x, y, k)
+                               != fine->image[y * fine->stride + x * RGBA_CH + k]);
+    }
+    if (laplacian)
+        errors += (pyramid[levels - 1].laplacian != NULL);
+    return errors;
+}
+
+/* collapses the Laplacian pyramid from the last level; returns the number of mismatches */
+static ne10_int32_t pyramid_collapse_check (const ne10_img_pyramid_level_t *pyramid,
+        ne10_int32_t levels)
+{
+    const ne10_uint8_t *coarse = pyramid[levels - 1].image;
+    ne10_int32_t coarse_stride = pyramid[levels - 1].stride;
+    ne10_uint8_t *recon = NULL;
+    ne10_int32_t errors = 0;
+    ne10_int32_t i, x, y, k;
+
+    for (i = levels - 2; i >= 0; i--)
+    {
+        const ne10_img_pyramid_level_t *fine = &pyramid[i];
+        ne10_int32_t stride = fine->size.x * RGBA_CH;
+        ne10_uint8_t *expanded = (ne10_uint8_t*) NE10_MALLOC (fine->size.y * stride);
+
+        /* the plain expansion matches the reference upsampling */
+        if (ne10_img_pyramid_expand_rgba8888 (pyramid[i + 1].image, pyramid[i + 1].size, pyramid[i + 1].stride,
+                                              NULL, expanded, fine->size, stride) != NE10_OK)
+            errors++;
+        for (y = 0; y < fine->size.y; y++)
+            for (x = 0; x < fine->size.x; x++)
+                for (k = 0; k < RGBA_CH; k++)
+                    errors += (expanded[y * stride + x * RGBA_CH + k]
+                               != pyramid_expand_reference (&pyramid[i + 1], x, y, k));
+
+        /* the reconstructed coarse level plus the residual gives the fine level back */
+        if (ne10_img_pyramid_expand_rgba8888 (coarse, pyramid[i + 1].size, coarse_stride,
+                                              fine->laplacian, expanded, fine->size, stride) != NE10_OK)
+            errors++;
+        for (y = 0; y < fine->size.y; y++)
+            errors += (memcmp (expanded + y * stride, fine->image + y * fine->stride, stride) != 0);
+
+        if (recon != NULL)
+            NE10_FREE (recon);
+        recon = expanded;
+        coarse = recon;
+        coarse_stride = stride;
+    }
+    if (recon != NULL)
+        NE10_FREE (recon);
+    return errors;
+}
+
+static void pyramid_conformance_test (ne10_size_t size, ne10_int32_t levels)
+{
+    ne10_img_pyramid_level_t pyramid_c[MAX_LEVELS];
+    ne10_img_pyramid_level_t pyramid_neon[MAX_LEVELS];
+    /* a stride larger than the row */
+    ne10_int32_t stride = (size.x + 3) * RGBA_CH;
+    ne10_size_t padded = {size.x + 3, size.y};
+    ne10_uint8_t *src = pyramid_create_image (padded);
+    ne10_uint32_t arena_size = ne10_img_pyramid_buffer_size (size, levels, 1);
+    ne10_uint8_t *arena_c = (ne10_uint8_t*) NE10_MALLOC (arena_size);
+    ne10_uint8_t *arena_neon = (ne10_uint8_t*) NE10_MALLOC (arena_size);
+    ne10_int32_t i, y;
+
+    printf ("test pyramid %d x %d, %d levels\n", size.x, size.y, levels);
+
+    /* too small an arena is rejected */
+    assert_true (ne10_img_pyramid_rgba8888_c (src, size, stride, levels, 1, arena_c, arena_size - 1, pyramid_c) == NE10_ERR);
+    assert_true (ne10_img_pyramid_rgba8888_neon (src, size, stride, levels, 1, arena_neon, arena_size - 1, pyramid_neon) == NE10_ERR);
+
+    assert_true (ne10_img_pyramid_rgba8888_c (src, size, stride, levels, 1, arena_c, arena_size, pyramid_c) == NE10_OK);
+    assert_true (pyramid_check (pyramid_c, levels, 1) == 0);
+    assert_true (pyramid_collapse_check (pyramid_c, levels) == 0);
+
+    assert_true (ne10_img_pyramid_rgba8888_neon (src, size, stride, levels, 1, arena_neon, arena_size, pyramid_neon) == NE10_OK);
+    for (i = 0; i < levels; i++)
+    {
+        const ne10_img_pyramid_level_t *c = &pyramid_c[i];
+        const ne10_img_pyramid_level_t *n = &pyramid_neon[i];
+
+        assert_true ( (c->size.x == n->size.x) && (c->size.y == n->size.y));
+        for (y = 0; y < c->size.y; y++)
+            assert_true (memcmp (c->image + y * c->stride, n->image + y * n->stride, c->size.x * RGBA_CH) == 0);
+        if (i < levels - 1)
+            assert_true (memcmp (c->laplacian, n->laplacian,
+                                 c->size.x * c->size.y * RGBA_CH * sizeof (ne10_int16_t)) == 0);
+    }
+
+    /* a coarse level of the wrong size is rejected */
+    if (levels > 1)
+    {
+        ne10_size_t wrong = {pyramid_c[1].size.x + 1, pyramid_c[1].size.y};
+        ne10_uint8_t *dst = (ne10_uint8_t*) NE10_MALLOC (size.x * size.y * RGBA_CH);
+        assert_true (ne10_img_pyramid_expand_rgba8888 (pyramid_c[1].image, wrong, pyramid_c[1].stride,
+                     pyramid_c[0].laplacian, dst, size, size.x * RGBA_CH) == NE10_ERR);
+        NE10_FREE (dst);
+    }
+
+    /* the Gaussian levels alone fit in a smaller arena */
+    arena_size = ne10_img_pyramid_buffer_size (size, levels, 0);
+    assert_true (ne10_img_pyramid_rgba8888_neon (src, size, stride, levels, 0, arena_neon, arena_size, pyramid_neon) == NE10_OK);
+    assert_true (pyramid_check (pyramid_neon, levels, 0) == 0);
+
+    NE10_FREE (src);
+    NE10_FREE (arena_c);
+    NE10_FREE (arena_neon);
+}
+
+void test_pyramid_conformance_case()
+{
+    ne10_size_t sizes[] =
+    {
+        {1, 1}, {2, 3}, {5, 4}, {7, 9}, {16, 16}, {37, 21},
+#if defined(REGRESSION_TEST)
+        {128, 96}, {321, 241},
+#endif
+    };
+    ne10_int32_t i, levels;
+
+    for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+        for (levels = 1; levels <= 5; levels += 2)
+        {
+            pyramid_conformance_test (sizes[i], levels);
+        }
+    }
+}
+
+void test_pyramid_performance_case()
+{
+    ne10_img_pyramid_level_t pyramid[MAX_LEVELS];
+    ne10_size_t size = {1920, 1080};
+    ne10_int32_t levels = 7;
+    ne10_uint8_t *src = pyramid_create_image (size);
+    ne10_int32_t stride = size.x * RGBA_CH;
+    ne10_int64_t time_c, time_neon;
+    ne10_int32_t laplacian, n;
+    char info[128];
+
+    for (laplacian = 0; laplacian <= 1; laplacian++)
+    {
+        ne10_uint32_t arena_size = ne10_img_pyramid_buffer_size (size, levels, laplacian);
+        ne10_uint8_t *arena = (ne10_uint8_t*) NE10_MALLOC (arena_size);
+
+        GET_TIME (time_c,
+        {
+            for (n = 0; n < TEST_COUNT; n++)
+                ne10_img_pyramid_rgba8888_c (src, size, stride, levels, laplacian, arena, arena_size, pyramid);
+        });
+        GET_TIME (time_neon,
+        {
+            for (n = 0; n < TEST_COUNT; n++)
+                ne10_img_pyramid_rgba8888_neon (src, size, stride, levels, laplacian, arena, arena_size, pyramid);
+        });
+        sprintf (info, "name:%s pyramid\nimage size:%dx%d\nlevels:%d",
+                 laplacian ? "laplacian" : "gaussian", size.x, size.y, levels);
+        ne10_performance_print (UBUNTU_COMMAND_LINE, time_neon / TEST_COUNT, time_c / TEST_COUNT, info);
+
+        NE10_FREE (arena);
+    }
+    printf ("\n");
+
+    NE10_FREE (src);
+}
+
+void test_pyramid()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    test_pyramid_conformance_case();
+#endif
+
+#if defined PERFORMANCE_TEST
+    test_pyramid_performance_case();
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+    ne10_init_imgproc (NE10_OK);
+}
+
+void test_fixture_pyramid (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_pyramid);       // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -45,6 +45,10 @@
 
 #define TEST_COUNT 5000
 
+/* bytes between the destination rows of the plan test, and the value they keep */
+#define TEST_ROW_PAD 3
+#define TEST_SENTINEL 0xa5
+
 
 /* ----------------------------------------------------------------------
 ** Defines each of the tests performed
@@ -130,6 +134,117 @@ void test_resize_conformance_case()
     NE10_FREE (out_neon);
 }
 
+void test_resize_plan_conformance_case()
+{
+    ne10_int32_t srcw;
+    ne10_int32_t srch;
+    ne10_int32_t dstw;
+    ne10_int32_t dsth;
+    ne10_int32_t w, h;
+    ne10_int32_t x, y;
+    ne10_int32_t cn;
+    ne10_float32_t PSNR;
+    ne10_int32_t i;
+    ne10_int32_t channels = 4;
+    ne10_int32_t pic_size = MEM_SIZE * MEM_SIZE * channels * sizeof (ne10_uint8_t);
+    ne10_uint8_t * out_ref = NULL;
+    ne10_uint8_t * in_cn = NULL;
+    ne10_img_resize_plan_t plan = NULL;
+
+    /* init input memory */
+    in_c = NE10_MALLOC (pic_size);
+    in_cn = NE10_MALLOC (pic_size);
+
+    /* init dst memory */
+    out_c = NE10_MALLOC (pic_size);
+    out_neon = NE10_MALLOC (pic_size);
+    out_ref = NE10_MALLOC (pic_size);
+
+    for (i = 0; i < pic_size; i++)
+    {
+        in_c[i] = (rand() & 0xff);
+    }
+
+    /* invalid parameters are rejected */
+    assert_true (ne10_img_resize_plan_create (0, 16, 16, 16, 4, NE10_IMG_RESIZE_BILINEAR) == NULL);
+    assert_true (ne10_img_resize_plan_create (16, 16, 16, 16, 5, NE10_IMG_RESIZE_BILINEAR) == NULL);
+
+    for (h = 8; h < MEM_SIZE; h += 7)
+    {
+        for (w = 8; w < MEM_SIZE; w += 11)
+        {
+            srcw = h;
+            srch = h;
+            dstw = w;
+            dsth = w;
+
+            /* a plan must give exactly the result of the one-shot resize */
+            plan = ne10_img_resize_plan_create (srcw, srch, dstw, dsth, channels, NE10_IMG_RESIZE_BILINEAR);
+            assert_true (plan != NULL);
+
+            ne10_img_resize_bilinear_rgba_c (out_ref, dstw, dsth, in_c, srcw, srch, srcw);
+            ne10_img_resize_plan_execute_c (plan, out_c, dstw * channels, in_c, srcw);
+            assert_true (memcmp (out_ref, out_c, dstw * dsth * channels) == 0);
+
+            /* the plan is reusable across frames */
+            ne10_img_resize_plan_execute_neon (plan, out_neon, dstw * channels, in_c, srcw);
+            ne10_img_resize_plan_execute_neon (plan, out_neon, dstw * channels, in_c, srcw);
+            PSNR = CAL_PSNR_UINT8 (out_c, out_neon, dstw * dsth * channels);
+            assert_false ( (PSNR < PSNR_THRESHOLD));
+
+            ne10_img_resize_plan_destroy (plan);
+
+            /*
+             * other channel counts: the channels are resized independently, so each one
+             * must match the same channel of the RGBA result. The destination rows are
+             * dst_stride bytes apart, which is neither packed nor a multiple of 4 here,
+             * and the bytes between them must be left alone.
+             */
+            plan = ne10_img_resize_plan_create (srcw, srch, dstw, dsth, channels, NE10_IMG_RESIZE_BILINEAR);
+            ne10_img_resize_plan_execute_c (plan, out_ref, dstw * channels, in_c, srcw * channels);
+            ne10_img_resize_plan_destroy (plan);
+            for (cn = 1; cn < channels; cn++)
+            {
+                ne10_int32_t dst_stride = dstw * cn + TEST_ROW_PAD;
+
+                for (i = 0; i < srcw * srch; i++)
+                {
+                    memcpy (in_cn + i * cn, in_c + i * channels, cn);
+                }
+                plan = ne10_img_resize_plan_create (srcw, srch, dstw, dsth, cn, NE10_IMG_RESIZE_BILINEAR);
+                assert_true (plan != NULL);
+
+                memset (out_c, TEST_SENTINEL, dsth * dst_stride);
+                memset (out_neon, TEST_SENTINEL, dsth * dst_stride);
+                ne10_img_resize_plan_execute_c (plan, out_c, dst_stride, in_cn, srcw * cn);
+                ne10_img_resize_plan_execute_neon (plan, out_neon, dst_stride, in_cn, srcw * cn);
+                for (y = 0; y < dsth; y++)
+                {
+                    for (x = 0; x < dstw; x++)
+                    {
+                        assert_true (memcmp (out_c + y * dst_stride + x * cn, out_ref + (y * dstw + x) * channels, cn) == 0);
+                    }
+                    for (x = dstw * cn; x < dst_stride; x++)
+                    {
+                        assert_int_equal (TEST_SENTINEL, out_c[y * dst_stride + x]);
+                        assert_int_equal (TEST_SENTINEL, out_neon[y * dst_stride + x]);
+                    }
+                }
+                PSNR = CAL_PSNR_UINT8 (out_c, out_neon, dsth * dst_stride);
+                assert_false ( (PSNR < PSNR_THRESHOLD));
+
+                ne10_img_resize_plan_destroy (plan);
+            }
+        }
+    }
+
+    NE10_FREE (in_c);
+    NE10_FREE (in_cn);
+    NE10_FREE (out_c);
+    NE10_FREE (out_neon);
+    NE10_FREE (out_ref);
+}
+
 void test_resize_performance_case()
 {
     ne10_int32_t srcw;
@@ -197,14 +312,78 @@ void test_resize_performance_case()
     NE10_FREE (out_neon);
 }
 
+void test_resize_plan_performance_case()
+{
+    ne10_int32_t srcw;
+    ne10_int32_t srch;
+    ne10_int32_t dstw;
+    ne10_int32_t dsth;
+    ne10_int32_t i;
+    ne10_int32_t w, h;
+    ne10_int32_t channels = 4;
+    ne10_int32_t pic_size = MEM_SIZE * MEM_SIZE * channels * sizeof (ne10_uint8_t);
+    ne10_int64_t time_oneshot = 0;
+    ne10_int64_t time_plan = 0;
+    ne10_img_resize_plan_t plan = NULL;
+
+    /* init input memory */
+    in_neon = NE10_MALLOC (pic_size);
+
+    /* init dst memory */
+    out_neon = NE10_MALLOC (pic_size);
+
+    for (i = 0; i < pic_size; i++)
+    {
+        in_neon[i] = (rand() & 0xff);
+    }
+
+    for (h = 16; h < MEM_SIZE; h += 16)
+    {
+        for (w = 16; w < MEM_SIZE; w += 16)
+        {
+            srcw = h;
+            srch = h;
+            dstw = w;
+            dsth = w;
+
+            GET_TIME
+            (
+                time_oneshot,
+            {
+                for (i = 0; i < TEST_COUNT; i++)
+                    ne10_img_resize_bilinear_rgba_neon (out_neon, dstw, dsth, in_neon, srcw, srch, srcw);
+            }
+            );
+
+            plan = ne10_img_resize_plan_create (srcw, srch, dstw, dsth, channels, NE10_IMG_RESIZE_BILINEAR);
+            GET_TIME
+            (
+                time_plan,
+            {
+                for (i = 0; i < TEST_COUNT; i++)
+                    ne10_img_resize_plan_execute_neon (plan, out_neon, dstw * channels, in_neon, srcw);
+            }
+            );
+            ne10_img_resize_plan_destroy (plan);
+
+            ne10_log (__FUNCTION__, "IMAGERESIZE PLAN%15d%20lld%20lld%19.2f%%%18.2f:1\n", (h * MEM_SIZE + w), time_oneshot, time_plan,
+                      ( (ne10_float32_t) (time_oneshot - time_plan) / time_oneshot) * 100, (ne10_float32_t) time_oneshot / time_plan);
+        }
+    }
+    NE10_FREE (in_neon);
+    NE10_FREE (out_neon);
+}
+
 void test_resize()
 {
 #if defined (SMOKE_TEST)||(REGRESSION_TEST)
     test_resize_conformance_case();
+    test_resize_plan_conformance_case();
 #endif
 
 #if defined PERFORMANCE_TEST
     test_resize_performance_case();
+    test_resize_plan_performance_case();
 #endif
 }
 
@@ -61,7 +61,6 @@ static ne10_uint8_t * in_neon = NULL;
 static ne10_uint8_t * out_c = NULL;
 static ne10_uint8_t * out_neon = NULL;
 
-#ifdef ENABLE_NE10_IMG_ROTATE_RGBA_NEON
 void test_rotate_conformance_case()
 {
     ne10_int32_t i;
@@ -107,7 +106,107 @@ void test_rotate_conformance_case()
     NE10_FREE (out_c);
     NE10_FREE (out_neon);
 }
-#endif // ENABLE_NE10_IMG_ROTATE_RGBA_NEON
+
+/* pixel of the source image that lands on (x, y) after a clockwise rotation by turns * 90 degrees */
+static const ne10_uint8_t* rotate_right_angle_reference (const ne10_uint8_t *src,
+        ne10_int32_t w,
+        ne10_int32_t h,
+        ne10_int32_t turns,
+        ne10_int32_t x,
+        ne10_int32_t y)
+{
+    switch (turns)
+    {
+    case 1:
+        return src + (h - 1 - x) * w * 4 + y * 4;
+    case 2:
+        return src + (h - 1 - y) * w * 4 + (w - 1 - x) * 4;
+    case 3:
+        return src + x * w * 4 + (w - 1 - y) * 4;
+    default:
+        return src + y * w * 4 + x * 4;
+    }
+}
+
+void test_rotate_right_angle_conformance_case()
+{
+    ne10_int32_t sizes[][2] = {{1, 1}, {3, 2}, {4, 4}, {7, 5}, {16, 9}, {33, 67}, {64, 64}, {131, 97}};
+    ne10_int32_t i, j, angle;
+
+    for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+        ne10_int32_t w = sizes[i][0];
+        ne10_int32_t h = sizes[i][1];
+        ne10_int32_t bytes = w * h * 4;
+        ne10_size_t src_size = {w, h};
+        ne10_uint32_t dstw, dsth;
+        ne10_uint8_t *ref = NE10_MALLOC (bytes);
+
+        in_c = NE10_MALLOC (bytes);
+        out_c = NE10_MALLOC (bytes);
+        out_neon = NE10_MALLOC (bytes);
+        for (j = 0; j < bytes; j++)
+        {
+            in_c[j] = (rand() & 0xff);
+        }
+
+        for (angle = -360; angle <= 360; angle += 90)
+        {
+            ne10_int32_t turns = (angle / 90) & 3;
+            ne10_int32_t rw = (turns & 1) ? h : w;
+            ne10_int32_t rh = (turns & 1) ? w : h;
+            ne10_int32_t x, y;
+
+            printf ("rotate %d x %d by %d \n", w, h, angle);
+            for (y = 0; y < rh; y++)
+            {
+                for (x = 0; x < rw; x++)
+                {
+                    memcpy (ref + (y * rw + x) * 4, rotate_right_angle_reference (in_c, w, h, turns, x, y), 4);
+                }
+            }
+
+            ne10_img_rotate_right_angle_rgba_c (in_c, out_c, src_size, w * 4, rw * 4, angle);
+            assert_true (memcmp (ref, out_c, bytes) == 0);
+            ne10_img_rotate_right_angle_rgba_neon (in_c, out_neon, src_size, w * 4, rw * 4, angle);
+            assert_true (memcmp (ref, out_neon, bytes) == 0);
+
+            /* the generic entry points dispatch to the lossless path */
+            ne10_img_rotate_rgba_c (out_c, &dstw, &dsth, in_c, w, h, angle);
+            assert_true ( (dstw == rw) && (dsth == rh));
+            assert_true (memcmp (ref, out_c, bytes) == 0);
+            ne10_img_rotate_rgba_neon (out_neon, &dstw, &dsth, in_c, w, h, angle);
+            assert_true ( (dstw == rw) && (dsth == rh));
+            assert_true (memcmp (ref, out_neon, bytes) == 0);
+
+            if (w == h)
+            {
+                memcpy (out_c, in_c, bytes);
+                ne10_img_rotate_right_angle_inplace_rgba_c (out_c, w, w * 4, angle);
+                assert_true (memcmp (ref, out_c, bytes) == 0);
+                memcpy (out_neon, in_c, bytes);
+                ne10_img_rotate_right_angle_inplace_rgba_neon (out_neon, w, w * 4, angle);
+                assert_true (memcmp (ref, out_neon, bytes) == 0);
+            }
+        }
+
+        /* horizontal flip, then vertical flip, is a rotation by 180 degrees */
+        ne10_img_rotate_right_angle_rgba_c (in_c, ref, src_size, w * 4, w * 4, 180);
+        ne10_img_flip_rgba_c (in_c, out_c, src_size, w * 4, w * 4, NE10_IMG_FLIP_HORIZONTAL);
+        ne10_img_flip_rgba_c (out_c, out_neon, src_size, w * 4, w * 4, NE10_IMG_FLIP_VERTICAL);
+        assert_true (memcmp (ref, out_neon, bytes) == 0);
+        ne10_img_flip_rgba_neon (in_c, out_neon, src_size, w * 4, w * 4, NE10_IMG_FLIP_HORIZONTAL);
+        assert_true (memcmp (out_c, out_neon, bytes) == 0);
+        ne10_img_flip_rgba_neon (in_c, out_c, src_size, w * 4, w * 4, NE10_IMG_FLIP_VERTICAL);
+        ne10_img_flip_rgba_neon (out_c, out_neon, src_size, w * 4, w * 4, NE10_IMG_FLIP_HORIZONTAL);
+        assert_true (memcmp (ref, out_neon, bytes) == 0);
+
+        NE10_FREE (ref);
+        NE10_FREE (in_c);
+        NE10_FREE (out_c);
+        NE10_FREE (out_neon);
+    }
+}
 
 void test_rotate_performance_case()
 {
@@ -174,16 +273,80 @@ void test_rotate_performance_case()
     NE10_FREE (out_neon);
 }
 
+void test_rotate_right_angle_performance_case()
+{
+    ne10_int32_t i;
+    ne10_int32_t in_size = SRC_HEIGHT * SRC_WIDTH * 4;
+    ne10_size_t src_size = {SRC_WIDTH, SRC_HEIGHT};
+    ne10_int32_t angle;
+    ne10_int64_t time_c = 0;
+    ne10_int64_t time_neon = 0;
+
+    in_c = NE10_MALLOC (in_size * sizeof (ne10_uint8_t));
+    out_c = NE10_MALLOC (in_size * sizeof (ne10_uint8_t));
+    out_neon = NE10_MALLOC (in_size * sizeof (ne10_uint8_t));
+
+    for (i = 0; i < in_size; i++)
+    {
+        in_c[i] = (rand() & 0xff);
+    }
+
+    for (angle = 90; angle <= 270; angle += 90)
+    {
+        GET_TIME
+        (
+            time_c,
+        {
+            for (i = 0; i < TEST_COUNT; i++)
+                ne10_img_rotate_right_angle_rgba_c (in_c, out_c, src_size, SRC_WIDTH * 4, SRC_HEIGHT * 4, angle);
+        }
+        );
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (i = 0; i < TEST_COUNT; i++)
+                ne10_img_rotate_right_angle_rgba_neon (in_c, out_neon, src_size, SRC_WIDTH * 4, SRC_HEIGHT * 4, angle);
+        }
+        );
+        ne10_log (__FUNCTION__, "IMAGEROTATE90%20d%20lld%20lld%19.2f%%%18.2f:1\n", angle, time_c, time_neon,
+                  ( (ne10_float32_t) (time_c - time_neon) / time_c) * 100, (ne10_float32_t) time_c / time_neon);
+
+        GET_TIME
+        (
+            time_c,
+        {
+            for (i = 0; i < TEST_COUNT; i++)
+                ne10_img_rotate_right_angle_inplace_rgba_c (out_c, SRC_WIDTH, SRC_WIDTH * 4, angle);
+        }
+        );
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (i = 0; i < TEST_COUNT; i++)
+                ne10_img_rotate_right_angle_inplace_rgba_neon (out_neon, SRC_WIDTH, SRC_WIDTH * 4, angle);
+        }
+        );
+        ne10_log (__FUNCTION__, "IMAGEROTATE90INPLACE%20d%20lld%20lld%19.2f%%%18.2f:1\n", angle, time_c, time_neon,
+                  ( (ne10_float32_t) (time_c - time_neon) / time_c) * 100, (ne10_float32_t) time_c / time_neon);
+    }
+
+    NE10_FREE (in_c);
+    NE10_FREE (out_c);
+    NE10_FREE (out_neon);
+}
+
 void test_rotate()
 {
-#ifdef ENABLE_NE10_IMG_ROTATE_RGBA_NEON
 #if defined (SMOKE_TEST)||(REGRESSION_TEST)
     test_rotate_conformance_case();
+    test_rotate_right_angle_conformance_case();
 #endif
-#endif // ENABLE_NE10_IMG_ROTATE_RGBA_NEON
 
 #if defined PERFORMANCE_TEST
     test_rotate_performance_case();
+    test_rotate_right_angle_performance_case();
 #endif
 }
 
@@ -0,0 +1,497 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_sepfilter.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "NE10_imgproc.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+#define RGBA_CH 4
+#define TEST_COUNT 20
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+
+static const ne10_uint8_t border_value[RGBA_CH] = {200, 100, 50, 0};
+
+static ne10_uint8_t* sepfilter_create_image (ne10_size_t size)
+{
+    ne10_int32_t i;
+    ne10_int32_t bytes = size.x * size.y * RGBA_CH;
+    ne10_uint8_t *img = (ne10_uint8_t*) NE10_MALLOC (bytes);
+
+    for (i = 0; i < bytes; i++)
+    {
+        img[i] = (rand() & 0xff);
+    }
+    return img;
+}
+
+static ne10_int32_t sepfilter_clamp (ne10_int32_t v, ne10_int32_t lo, ne10_int32_t hi)
+{
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+static ne10_int32_t sepfilter_round_shift (ne10_int32_t v, ne10_int32_t shift)
+{
+    return (shift > 0) ? (ne10_int32_t) (((ne10_int64_t) v + (1 << (shift - 1))) >> shift) : v;
+}
+
+/* channel k of source pixel (x, y), with border handling */
+static ne10_int32_t sepfilter_tap (const ne10_uint8_t *src,
+                                   ne10_size_t size,
+                                   ne10_int32_t x,
+                                   ne10_int32_t y,
+                                   ne10_int32_t k,
+                                   ne10_img_border_t border)
+{
+    if ((x < 0) || (y < 0) || (x >= size.x) || (y >= size.y))
+    {
+        if (border == NE10_IMG_BORDER_CONSTANT)
+            return border_value[k];
+        x = sepfilter_clamp (x, 0, size.x - 1);
+        y = sepfilter_clamp (y, 0, size.y - 1);
+    }
+    return src[(y * size.x + x) * RGBA_CH + k];
+}
+
+/* direct evaluation of the two passes for every pixel */
+static void sepfilter_reference (const ne10_uint8_t *src,
+                                 ne10_uint8_t *dst,
+                                 ne10_size_t size,
+                                 const ne10_int16_t *kx,
+                                 ne10_int32_t ksize_x,
+                                 ne10_int32_t shift_x,
+                                 const ne10_int16_t *ky,
+                                 ne10_int32_t ksize_y,
+                                 ne10_int32_t shift_y,
+                                 ne10_int32_t delta,
+                                 ne10_img_border_t border)
+{
+    ne10_int32_t x, y, k, i, j;
+
+    for (y = 0; y < size.y; y++)
+    {
+        for (x = 0; x < size.x; x++)
+        {
+            for (k = 0; k < RGBA_CH; k++)
+            {
+                ne10_int32_t sum_y = 0;
+                for (j = 0; j < ksize_y; j++)
+                {
+                    ne10_int32_t sy = y + j - ksize_y / 2;
+                    ne10_int32_t sum_x = 0;
+                    if (border == NE10_IMG_BORDER_REPLICATE)
+                        sy = sepfilter_clamp (sy, 0, size.y - 1);
+                    for (i = 0; i < ksize_x; i++)
+                    {
+                        /* rows outside the image are rows of border pixels */
+                        ne10_int32_t v = ((sy < 0) || (sy >= size.y)) ? border_value[k] :
+                                         sepfilter_tap (src, size, x + i - ksize_x / 2, sy, k, border);
+                        sum_x += v * kx[i];
+                    }
+                    sum_x = sepfilter_clamp (sepfilter_round_shift (sum_x, shift_x), -32768, 32767);
+                    sum_y += sum_x * ky[j];
+                }
+                dst[(y * size.x + x) * RGBA_CH + k] =
+                    sepfilter_clamp (sepfilter_round_shift (sum_y, shift_y) + delta, 0, 255);
+            }
+        }
+    }
+}
+
+/* floating point Gaussian with a kernel of radius 4 * sigma */
+static void gaussian_reference (const ne10_uint8_t *src,
+                                ne10_uint8_t *dst,
+                                ne10_size_t size,
+                                ne10_float32_t sigma,
+                                ne10_img_border_t border)
+{
+    ne10_int32_t radius = (ne10_int32_t) ceil (4 * sigma);
+    ne10_int32_t ksize = 2 * radius + 1;
+    ne10_float64_t *w = (ne10_float64_t*) NE10_MALLOC (ksize * sizeof (ne10_float64_t));
+    ne10_float64_t *tmp = (ne10_float64_t*) NE10_MALLOC (size.x * size.y * RGBA_CH * sizeof (ne10_float64_t));
+    ne10_float64_t total = 0;
+    ne10_int32_t x, y, k, i;
+
+    for (i = 0; i < ksize; i++)
+    {
+        w[i] = exp (- (i - radius) * (i - radius) / (2.0 * sigma * sigma));
+        total += w[i];
+    }
+    for (i = 0; i < ksize; i++)
+        w[i] /= total;
+
+    for (y = 0; y < size.y; y++)
+        for (x = 0; x < size.x; x++)
+            for (k = 0; k < RGBA_CH; k++)
+            {
+                ne10_float64_t sum = 0;
+                for (i = 0; i < ksize; i++)
+                    sum += w[i] * sepfilter_tap (src, size, x + i - radius, y, k, border);
+                tmp[(y * size.x + x) * RGBA_CH + k] = sum;
+            }
+
+    for (y = 0; y < size.y; y++)
+        for (x = 0; x < size.x; x++)
+            for (k = 0; k < RGBA_CH; k++)
+            {
+                ne10_float64_t sum = 0;
+                for (i = 0; i < ksize; i++)
+                {
+                    ne10_int32_t sy = y + i - radius;
+                    ne10_float64_t v;
+                    if ((sy < 0) || (sy >= size.y))
+                    {
+                        if (border == NE10_IMG_BORDER_CONSTANT)
+                            v = border_value[k];
+                        else
+                            v = tmp[(sepfilter_clamp (sy, 0, size.y - 1) * size.x + x) * RGBA_CH + k];
+                    }
+                    else
+                    {
+                        v = tmp[(sy * size.x + x) * RGBA_CH + k];
+                    }
+                    sum += w[i] * v;
+                }
+                dst[(y * size.x + x) * RGBA_CH + k] = sepfilter_clamp ((ne10_int32_t) floor (sum + 0.5), 0, 255);
+            }
+
+    NE10_FREE (w);
+    NE10_FREE (tmp);
+}
+
+/* a buffer for the Gaussian of every sigma of the list, with a spare byte to misalign it */
+static ne10_uint8_t* gaussian_create_buffer (ne10_size_t size, const ne10_float32_t *sigmas, ne10_int32_t count)
+{
+    ne10_uint32_t bytes = 0;
+    ne10_int32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        bytes = NE10_MAX (bytes, ne10_img_gaussian_buffer_size (size, sigmas[i]));
+    }
+    return (ne10_uint8_t*) NE10_MALLOC (bytes + 1);
+}
+
+static void sepfilter_conformance_test (ne10_size_t size)
+{
+    static const ne10_int16_t sobel_d[] = {-1, 0, 1};
+    static const ne10_int16_t sobel_s[] = {1, 2, 1};
+    static const ne10_int16_t scharr_s[] = {3, 10, 3};
+    ne10_uint8_t *src = sepfilter_create_image (size);
+    ne10_uint8_t *dst_c = sepfilter_create_image (size);
+    ne10_uint8_t *dst_neon = sepfilter_create_image (size);
+    ne10_uint8_t *dst_ref = sepfilter_create_image (size);
+    ne10_int32_t stride = size.x * RGBA_CH;
+    ne10_int32_t bytes = size.x * size.y * RGBA_CH;
+    ne10_int16_t kx[9], ky[9];
+    ne10_int32_t border, n, i;
+
+    printf ("test sepfilter %d x %d\n", size.x, size.y);
+
+    for (border = NE10_IMG_BORDER_CONSTANT; border <= NE10_IMG_BORDER_REPLICATE; border++)
+    {
+        ne10_img_border_t b = (ne10_img_border_t) border;
+
+        /* Sobel and Scharr derivatives */
+        sepfilter_reference (src, dst_ref, size, sobel_d, 3, 0, sobel_s, 3, 2, 128, b);
+        ne10_img_sepfilter_rgba8888_c (src, dst_c, size, stride, stride, sobel_d, 3, 0, sobel_s, 3, 2, 128, b, border_value);
+        assert_true (memcmp (dst_ref, dst_c, bytes) == 0);
+        ne10_img_sepfilter_rgba8888_neon (src, dst_neon, size, stride, stride, sobel_d, 3, 0, sobel_s, 3, 2, 128, b, border_value);
+        assert_true (memcmp (dst_ref, dst_neon, bytes) == 0);
+
+        sepfilter_reference (src, dst_ref, size, scharr_s, 3, 2, sobel_d, 3, 2, 128, b);
+        ne10_img_sepfilter_rgba8888_c (src, dst_c, size, stride, stride, scharr_s, 3, 2, sobel_d, 3, 2, 128, b, border_value);
+        assert_true (memcmp (dst_ref, dst_c, bytes) == 0);
+        ne10_img_sepfilter_rgba8888_neon (src, dst_neon, size, stride, stride, scharr_s, 3, 2, sobel_d, 3, 2, 128, b, border_value);
+        assert_true (memcmp (dst_ref, dst_neon, bytes) == 0);
+
+        /* random kernels of every size, including saturating ones */
+        for (n = 1; n <= 9; n++)
+        {
+            for (i = 0; i < n; i++)
+            {
+                kx[i] = (rand() % 512) - 200;
+                ky[i] = (rand() % 512) - 200;
+            }
+            sepfilter_reference (src, dst_ref, size, kx, n, 4, ky, n, 10, 3, b);
+            ne10_img_sepfilter_rgba8888_c (src, dst_c, size, stride, stride, kx, n, 4, ky, n, 10, 3, b, border_value);
+            assert_true (memcmp (dst_ref, dst_c, bytes) == 0);
+            ne10_img_sepfilter_rgba8888_neon (src, dst_neon, size, stride, stride, kx, n, 4, ky, n, 10, 3, b, border_value);
+            assert_true (memcmp (dst_ref, dst_neon, bytes) == 0);
+        }
+    }
+
+    NE10_FREE (src);
+    NE10_FREE (dst_c);
+    NE10_FREE (dst_neon);
+    NE10_FREE (dst_ref);
+}
+
+static void gaussian_conformance_test (ne10_size_t size)
+{
+    ne10_float32_t sigmas[] = {0.5f, 1.0f, 2.0f, 3.0f, 4.0f, 8.0f};
+    ne10_uint8_t *src = sepfilter_create_image (size);
+    ne10_uint8_t *dst_c = sepfilter_create_image (size);
+    ne10_uint8_t *dst_neon = sepfilter_create_image (size);
+    ne10_uint8_t *dst_ref = sepfilter_create_image (size);
+    ne10_uint8_t *buffer = gaussian_create_buffer (size, sigmas, sizeof (sigmas) / sizeof (sigmas[0]));
+    ne10_int32_t stride = size.x * RGBA_CH;
+    ne10_int32_t bytes = size.x * size.y * RGBA_CH;
+    ne10_float32_t PSNR;
+    ne10_int32_t border, i;
+
+    printf ("test gaussian %d x %d\n", size.x, size.y);
+
+    for (border = NE10_IMG_BORDER_CONSTANT; border <= NE10_IMG_BORDER_REPLICATE; border++)
+    {
+        ne10_img_border_t b = (ne10_img_border_t) border;
+
+        for (i = 0; i < sizeof (sigmas) / sizeof (sigmas[0]); i++)
+        {
+            ne10_img_gaussian_rgba8888_c (src, dst_c, size, stride, stride, sigmas[i], b, border_value, buffer + 1);
+            ne10_img_gaussian_rgba8888_neon (src, dst_neon, size, stride, stride, sigmas[i], b, border_value, buffer);
+            PSNR = CAL_PSNR_UINT8 (dst_c, dst_neon, bytes);
+            assert_false ((PSNR < PSNR_THRESHOLD));
+
+            gaussian_reference (src, dst_ref, size, sigmas[i], b);
+            PSNR = CAL_PSNR_UINT8 (dst_ref, dst_c, bytes);
+            assert_false ((PSNR < PSNR_THRESHOLD));
+        }
+    }
+
+    /* a flat image stays flat */
+    for (i = 0; i < bytes; i++)
+    {
+        src[i] = border_value[i % RGBA_CH];
+    }
+    for (i = 0; i < sizeof (sigmas) / sizeof (sigmas[0]); i++)
+    {
+        ne10_img_gaussian_rgba8888_c (src, dst_c, size, stride, stride, sigmas[i], NE10_IMG_BORDER_CONSTANT, border_value, buffer);
+        assert_true (memcmp (src, dst_c, bytes) == 0);
+        ne10_img_gaussian_rgba8888_neon (src, dst_neon, size, stride, stride, sigmas[i], NE10_IMG_BORDER_REPLICATE, NULL, buffer);
+        assert_true (memcmp (src, dst_neon, bytes) == 0);
+    }
+
+    NE10_FREE (src);
+    NE10_FREE (dst_c);
+    NE10_FREE (dst_neon);
+    NE10_FREE (dst_ref);
+    NE10_FREE (buffer);
+}
+
+/* largest absolute difference between two images */
+static ne10_int32_t gaussian_max_error (const ne10_uint8_t *a, const ne10_uint8_t *b, ne10_int32_t bytes)
+{
+    ne10_int32_t i, err = 0;
+
+    for (i = 0; i < bytes; i++)
+        err = NE10_MAX (err, abs (a[i] - b[i]));
+    return err;
+}
+
+/*
+ * sigma up to beyond the image: the recursion runs with poles very close to 1.
+ * The Young - van Vliet filter only approximates the Gaussian, more loosely
+ * once sigma reaches the image size, hence a tolerance per sigma.
+ */
+static void gaussian_large_sigma_test (ne10_size_t size)
+{
+    ne10_float32_t sigmas[] = {50.0f, 100.0f, 200.0f};
+    ne10_int32_t tolerance[] = {2, 3, 12};
+    ne10_uint8_t *src = sepfilter_create_image (size);
+    ne10_uint8_t *dst_c = sepfilter_create_image (size);
+    ne10_uint8_t *dst_neon = sepfilter_create_image (size);
+    ne10_uint8_t *dst_ref = sepfilter_create_image (size);
+    ne10_uint8_t *buffer = gaussian_create_buffer (size, sigmas, sizeof (sigmas) / sizeof (sigmas[0]));
+    ne10_int32_t stride = size.x * RGBA_CH;
+    ne10_int32_t bytes = size.x * size.y * RGBA_CH;
+    ne10_int32_t border, i, x, y;
+
+    printf ("test gaussian large sigma %d x %d\n", size.x, size.y);
+
+    /* horizontal and vertical ramps, noise, and a flat channel */
+    for (y = 0; y < size.y; y++)
+        for (x = 0; x < size.x; x++)
+        {
+            ne10_uint8_t *p = src + y * stride + x * RGBA_CH;
+            p[0] = (ne10_uint8_t) (x * 255 / NE10_MAX (size.x - 1, 1));
+            p[1] = (ne10_uint8_t) (y * 255 / NE10_MAX (size.y - 1, 1));
+            p[2] = (ne10_uint8_t) (rand() & 0xff);
+            p[3] = 255;
+        }
+
+    for (border = NE10_IMG_BORDER_CONSTANT; border <= NE10_IMG_BORDER_REPLICATE; border++)
+    {
+        ne10_img_border_t b = (ne10_img_border_t) border;
+
+        for (i = 0; i < sizeof (sigmas) / sizeof (sigmas[0]); i++)
+        {
+            gaussian_reference (src, dst_ref, size, sigmas[i], b);
+            ne10_img_gaussian_rgba8888_c (src, dst_c, size, stride, stride, sigmas[i], b, border_value, buffer + 1);
+            assert_true (gaussian_max_error (dst_ref, dst_c, bytes) <= tolerance[i]);
+            ne10_img_gaussian_rgba8888_neon (src, dst_neon, size, stride, stride, sigmas[i], b, border_value, buffer);
+            assert_true (gaussian_max_error (dst_ref, dst_neon, bytes) <= tolerance[i]);
+        }
+    }
+
+    /* a flat image stays exactly flat */
+    for (i = 0; i < bytes; i++)
+    {
+        src[i] = border_value[i % RGBA_CH];
+    }
+    for (i = 0; i < sizeof (sigmas) / sizeof (sigmas[0]); i++)
+    {
+        ne10_img_gaussian_rgba8888_c (src, dst_c, size, stride, stride, sigmas[i], NE10_IMG_BORDER_REPLICATE, NULL, buffer);
+        assert_true (memcmp (src, dst_c, bytes) == 0);
+        ne10_img_gaussian_rgba8888_neon (src, dst_neon, size, stride, stride, sigmas[i], NE10_IMG_BORDER_CONSTANT, border_value, buffer);
+        assert_true (memcmp (src, dst_neon, bytes) == 0);
+    }
+
+    NE10_FREE (src);
+    NE10_FREE (dst_c);
+    NE10_FREE (dst_neon);
+    NE10_FREE (dst_ref);
+    NE10_FREE (buffer);
+}
+
+void test_sepfilter_conformance_case()
+{
+    ne10_size_t sizes[] =
+    {
+        {1, 1}, {2, 5}, {7, 3}, {16, 16}, {33, 17},
+#if defined(REGRESSION_TEST)
+        {128, 96}, {321, 241},
+#endif
+    };
+    ne10_size_t large[] = {{64, 48}, {400, 3}};
+    ne10_int32_t i;
+
+    for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+        sepfilter_conformance_test (sizes[i]);
+        gaussian_conformance_test (sizes[i]);
+    }
+    for (i = 0; i < sizeof (large) / sizeof (large[0]); i++)
+    {
+        gaussian_large_sigma_test (large[i]);
+    }
+}
+
+void test_sepfilter_performance_case()
+{
+    static const ne10_int16_t sobel_d[] = {-1, 0, 1};
+    static const ne10_int16_t sobel_s[] = {1, 2, 1};
+    ne10_float32_t sigmas[] = {1.0f, 2.0f, 3.0f, 5.0f, 10.0f, 20.0f};
+    ne10_size_t size = {640, 480};
+    ne10_uint8_t *src = sepfilter_create_image (size);
+    ne10_uint8_t *dst = sepfilter_create_image (size);
+    ne10_uint8_t *buffer = gaussian_create_buffer (size, sigmas, sizeof (sigmas) / sizeof (sigmas[0]));
+    ne10_int32_t stride = size.x * RGBA_CH;
+    ne10_int64_t time_c, time_neon;
+    ne10_int32_t i, n;
+    char info[128];
+
+    GET_TIME (time_c,
+    {
+        for (n = 0; n < TEST_COUNT; n++)
+            ne10_img_sepfilter_rgba8888_c (src, dst, size, stride, stride, sobel_d, 3, 0, sobel_s, 3, 2, 128,
+                                           NE10_IMG_BORDER_REPLICATE, NULL);
+    });
+    GET_TIME (time_neon,
+    {
+        for (n = 0; n < TEST_COUNT; n++)
+            ne10_img_sepfilter_rgba8888_neon (src, dst, size, stride, stride, sobel_d, 3, 0, sobel_s, 3, 2, 128,
+                                              NE10_IMG_BORDER_REPLICATE, NULL);
+    });
+    sprintf (info, "name:sobel\nimage size:%dx%d", size.x, size.y);
+    ne10_performance_print (UBUNTU_COMMAND_LINE, time_neon / TEST_COUNT, time_c / TEST_COUNT, info);
+
+    for (i = 0; i < sizeof (sigmas) / sizeof (sigmas[0]); i++)
+    {
+        GET_TIME (time_c,
+        {
+            for (n = 0; n < TEST_COUNT; n++)
+                ne10_img_gaussian_rgba8888_c (src, dst, size, stride, stride, sigmas[i],
+                                              NE10_IMG_BORDER_REPLICATE, NULL, buffer);
+        });
+        GET_TIME (time_neon,
+        {
+            for (n = 0; n < TEST_COUNT; n++)
+                ne10_img_gaussian_rgba8888_neon (src, dst, size, stride, stride, sigmas[i],
+                                                 NE10_IMG_BORDER_REPLICATE, NULL, buffer);
+        });
+        sprintf (info, "name:gaussian\nimage size:%dx%d\nsigma:%.1f", size.x, size.y, sigmas[i]);
+        ne10_performance_print (UBUNTU_COMMAND_LINE, time_neon / TEST_COUNT, time_c / TEST_COUNT, info);
+    }
+    printf ("\n");
+
+    NE10_FREE (src);
+    NE10_FREE (dst);
+    NE10_FREE (buffer);
+}
+
+void test_sepfilter()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    test_sepfilter_conformance_case();
+#endif
+
+#if defined PERFORMANCE_TEST
+    test_sepfilter_performance_case();
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+    ne10_init_imgproc (NE10_OK);
+}
+
+void test_fixture_sepfilter (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_sepfilter);       // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
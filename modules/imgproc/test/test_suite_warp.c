@@ -0,0 +1,351 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_warp.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "NE10_imgproc.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+#define RGBA_CH 4
+#define TEST_COUNT 20
+
+/* ----------------------------------------------------------------------
+** Defines each of the tests performed
+** ------------------------------------------------------------------- */
+
+static const ne10_uint8_t border_value[RGBA_CH] = {12, 34, 56, 78};
+
+static ne10_uint8_t* warp_create_image (ne10_size_t size)
+{
+    ne10_int32_t i;
+    ne10_int32_t bytes = size.x * size.y * RGBA_CH;
+    ne10_uint8_t *img = (ne10_uint8_t*) NE10_MALLOC (bytes);
+
+    for (i = 0; i < bytes; i++)
+    {
+        img[i] = (rand() & 0xff);
+    }
+    return img;
+}
+
+/* rotation by angle (degrees) and scaling around the centre of the destination */
+static void warp_make_affine (ne10_float32_t *m,
+                              ne10_float32_t angle,
+                              ne10_float32_t scale,
+                              ne10_size_t src_sz,
+                              ne10_size_t dst_sz)
+{
+    ne10_float32_t radian = angle * NE10_PI / 180.0f;
+    ne10_float32_t a = sin (radian) * scale, b = cos (radian) * scale;
+    ne10_float32_t dx = (dst_sz.x - 1) * 0.5f;
+    ne10_float32_t dy = (dst_sz.y - 1) * 0.5f;
+
+    m[0] = b;
+    m[1] = a;
+    m[3] = -a;
+    m[4] = b;
+    m[2] = src_sz.x * 0.5f - m[0] * dx - m[1] * dy;
+    m[5] = src_sz.y * 0.5f - m[3] * dx - m[4] * dy;
+}
+
+/* floating point reference of the bilinear sampling with constant border */
+static void warp_affine_reference (const ne10_uint8_t *src,
+                                   ne10_uint8_t *dst,
+                                   ne10_size_t src_sz,
+                                   ne10_size_t dst_sz,
+                                   const ne10_float32_t *m)
+{
+    ne10_int32_t x, y, k, i;
+
+    for (y = 0; y < dst_sz.y; y++)
+    {
+        for (x = 0; x < dst_sz.x; x++)
+        {
+            ne10_float64_t xs = (ne10_float64_t) m[0] * x + (ne10_float64_t) m[1] * y + m[2];
+            ne10_float64_t ys = (ne10_float64_t) m[3] * x + (ne10_float64_t) m[4] * y + m[5];
+            ne10_int32_t ix = (ne10_int32_t) floor (xs);
+            ne10_int32_t iy = (ne10_int32_t) floor (ys);
+            ne10_float64_t a = xs - ix, b = ys - iy;
+
+            for (k = 0; k < RGBA_CH; k++)
+            {
+                ne10_float64_t p[4];
+                for (i = 0; i < 4; i++)
+                {
+                    ne10_int32_t px = ix + (i & 1);
+                    ne10_int32_t py = iy + (i >> 1);
+                    if ( (px >= 0) && (py >= 0) && (px < src_sz.x) && (py < src_sz.y))
+                        p[i] = src[ (py * src_sz.x + px) * RGBA_CH + k];
+                    else
+                        p[i] = border_value[k];
+                }
+                dst[ (y * dst_sz.x + x) * RGBA_CH + k] = (ne10_uint8_t) floor (
+                            (p[0] * (1 - a) + p[1] * a) * (1 - b) + (p[2] * (1 - a) + p[3] * a) * b + 0.5);
+            }
+        }
+    }
+}
+
+static void warp_conformance_test (ne10_size_t src_sz, ne10_size_t dst_sz)
+{
+    ne10_uint8_t *src = warp_create_image (src_sz);
+    ne10_uint8_t *dst_c = warp_create_image (dst_sz);
+    ne10_uint8_t *dst_neon = warp_create_image (dst_sz);
+    ne10_uint8_t *dst_ref = warp_create_image (dst_sz);
+    ne10_int32_t src_stride = src_sz.x * RGBA_CH;
+    ne10_int32_t dst_stride = dst_sz.x * RGBA_CH;
+    ne10_int32_t dst_bytes = dst_sz.x * dst_sz.y * RGBA_CH;
+    ne10_float32_t m[9];
+    ne10_float32_t PSNR;
+    ne10_int32_t angle, border;
+
+    printf ("test warp %d x %d -> %d x %d\n", src_sz.x, src_sz.y, dst_sz.x, dst_sz.y);
+
+    /* identity is an exact copy */
+    if ( (src_sz.x == dst_sz.x) && (src_sz.y == dst_sz.y))
+    {
+        m[0] = 1.0f; m[1] = 0.0f; m[2] = 0.0f;
+        m[3] = 0.0f; m[4] = 1.0f; m[5] = 0.0f;
+        ne10_img_warp_affine_rgba_c (src, dst_c, src_sz, src_stride, dst_sz, dst_stride,
+                                     m, NE10_IMG_BORDER_CONSTANT, border_value);
+        assert_true (memcmp (src, dst_c, dst_bytes) == 0);
+        ne10_img_warp_affine_rgba_neon (src, dst_neon, src_sz, src_stride, dst_sz, dst_stride,
+                                        m, NE10_IMG_BORDER_CONSTANT, border_value);
+        assert_true (memcmp (src, dst_neon, dst_bytes) == 0);
+
+        m[6] = 0.0f; m[7] = 0.0f; m[8] = 1.0f;
+        ne10_img_warp_perspective_rgba_c (src, dst_c, src_sz, src_stride, dst_sz, dst_stride,
+                                          m, NE10_IMG_BORDER_CONSTANT, border_value);
+        assert_true (memcmp (src, dst_c, dst_bytes) == 0);
+        ne10_img_warp_perspective_rgba_neon (src, dst_neon, src_sz, src_stride, dst_sz, dst_stride,
+                                             m, NE10_IMG_BORDER_CONSTANT, border_value);
+        assert_true (memcmp (src, dst_neon, dst_bytes) == 0);
+    }
+
+    for (angle = -180; angle <= 180; angle += 25)
+    {
+        warp_make_affine (m, angle, 0.75f + (angle + 180) / 360.0f, src_sz, dst_sz);
+
+        /* the fixed point walk must stay close to the floating point reference */
+        ne10_img_warp_affine_rgba_c (src, dst_c, src_sz, src_stride, dst_sz, dst_stride,
+                                     m, NE10_IMG_BORDER_CONSTANT, border_value);
+        warp_affine_reference (src, dst_ref, src_sz, dst_sz, m);
+        PSNR = CAL_PSNR_UINT8 (dst_ref, dst_c, dst_bytes);
+        assert_false ( (PSNR < PSNR_THRESHOLD));
+
+        for (border = NE10_IMG_BORDER_CONSTANT; border <= NE10_IMG_BORDER_REPLICATE; border++)
+        {
+            /* affine: NEON is bit exact with C */
+            ne10_img_warp_affine_rgba_c (src, dst_c, src_sz, src_stride, dst_sz, dst_stride,
+                                         m, (ne10_img_border_t) border, border_value);
+            ne10_img_warp_affine_rgba_neon (src, dst_neon, src_sz, src_stride, dst_sz, dst_stride,
+                                            m, (ne10_img_border_t) border, border_value);
+            assert_true (memcmp (dst_c, dst_neon, dst_bytes) == 0);
+
+            /* perspective: the division may round differently */
+            m[6] = 0.0004f * angle / src_sz.x;
+            m[7] = -0.0002f * angle / src_sz.y;
+            m[8] = 1.0f;
+            ne10_img_warp_perspective_rgba_c (src, dst_c, src_sz, src_stride, dst_sz, dst_stride,
+                                              m, (ne10_img_border_t) border, border_value);
+            ne10_img_warp_perspective_rgba_neon (src, dst_neon, src_sz, src_stride, dst_sz, dst_stride,
+                                                 m, (ne10_img_border_t) border, border_value);
+            PSNR = CAL_PSNR_UINT8 (dst_c, dst_neon, dst_bytes);
+            assert_false ( (PSNR < PSNR_THRESHOLD));
+        }
+    }
+
+    NE10_FREE (src);
+    NE10_FREE (dst_c);
+    NE10_FREE (dst_neon);
+    NE10_FREE (dst_ref);
+}
+
+static void warp_border_test()
+{
+    ne10_size_t sz = {16, 8};
+    ne10_uint8_t *src = warp_create_image (sz);
+    ne10_uint8_t *dst = warp_create_image (sz);
+    ne10_int32_t stride = sz.x * RGBA_CH;
+    ne10_int32_t x, y, k;
+    ne10_int32_t ok_constant = 1, ok_replicate = 1;
+    /* shift by (-3, 2) pixels */
+    ne10_float32_t m[6] = {1.0f, 0.0f, -3.0f, 0.0f, 1.0f, 2.0f};
+
+    ne10_img_warp_affine_rgba (src, dst, sz, stride, sz, stride, m, NE10_IMG_BORDER_CONSTANT, border_value);
+    for (y = 0; y < sz.y; y++)
+    {
+        for (x = 0; x < sz.x; x++)
+        {
+            ne10_int32_t sx = x - 3, sy = y + 2;
+            for (k = 0; k < RGBA_CH; k++)
+            {
+                ne10_uint8_t expected = ( (sx >= 0) && (sy < sz.y)) ? src[sy * stride + sx * RGBA_CH + k] : border_value[k];
+                ok_constant &= (dst[y * stride + x * RGBA_CH + k] == expected);
+            }
+        }
+    }
+    assert_true (ok_constant);
+
+    ne10_img_warp_affine_rgba (src, dst, sz, stride, sz, stride, m, NE10_IMG_BORDER_REPLICATE, NULL);
+    for (y = 0; y < sz.y; y++)
+    {
+        for (x = 0; x < sz.x; x++)
+        {
+            ne10_int32_t sx = NE10_MAX (x - 3, 0), sy = NE10_MIN (y + 2, sz.y - 1);
+            for (k = 0; k < RGBA_CH; k++)
+            {
+                ok_replicate &= (dst[y * stride + x * RGBA_CH + k] == src[sy * stride + sx * RGBA_CH + k]);
+            }
+        }
+    }
+    assert_true (ok_replicate);
+
+    NE10_FREE (src);
+    NE10_FREE (dst);
+}
+
+void test_warp_conformance_case()
+{
+    ne10_size_t sizes[][2] =
+    {
+        {{1, 1}, {1, 1}},
+        {{2, 3}, {5, 4}},
+        {{17, 9}, {17, 9}},
+        {{64, 48}, {80, 60}},
+        {{97, 131}, {97, 131}},
+#if defined(REGRESSION_TEST)
+        {{320, 240}, {320, 240}},
+        {{640, 480}, {523, 377}},
+#endif
+    };
+    ne10_int32_t i;
+
+    warp_border_test();
+
+    for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+        warp_conformance_test (sizes[i][0], sizes[i][1]);
+    }
+}
+
+void test_warp_performance_case()
+{
+    ne10_size_t sizes[] = {{320, 240}, {640, 480}, {1280, 720}, {1920, 1080}};
+    ne10_int32_t i, n;
+    ne10_float32_t m[9];
+    char info[160];
+
+    for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    {
+        ne10_uint8_t *src = warp_create_image (sizes[i]);
+        ne10_uint8_t *dst = warp_create_image (sizes[i]);
+        ne10_int32_t stride = sizes[i].x * RGBA_CH;
+        ne10_float32_t mpixels = (ne10_float32_t) sizes[i].x * sizes[i].y * TEST_COUNT / 1000000.0f;
+        ne10_int64_t time_c, time_neon;
+
+        warp_make_affine (m, 30, 0.9f, sizes[i], sizes[i]);
+
+        GET_TIME (time_c,
+        {
+            for (n = 0; n < TEST_COUNT; n++)
+                ne10_img_warp_affine_rgba_c (src, dst, sizes[i], stride, sizes[i], stride,
+                                             m, NE10_IMG_BORDER_CONSTANT, border_value);
+        });
+        GET_TIME (time_neon,
+        {
+            for (n = 0; n < TEST_COUNT; n++)
+                ne10_img_warp_affine_rgba_neon (src, dst, sizes[i], stride, sizes[i], stride,
+                                                m, NE10_IMG_BORDER_CONSTANT, border_value);
+        });
+        sprintf (info, "name:warp affine\nimage size:%dx%d\nc(MP/s): %.2f neon(MP/s): %.2f",
+                 sizes[i].x, sizes[i].y, mpixels * 1000000.0f / time_c, mpixels * 1000000.0f / time_neon);
+        ne10_performance_print (UBUNTU_COMMAND_LINE, time_neon / TEST_COUNT, time_c / TEST_COUNT, info);
+
+        m[6] = 0.0001f;
+        m[7] = -0.00005f;
+        m[8] = 1.0f;
+        GET_TIME (time_c,
+        {
+            for (n = 0; n < TEST_COUNT; n++)
+                ne10_img_warp_perspective_rgba_c (src, dst, sizes[i], stride, sizes[i], stride,
+                                                  m, NE10_IMG_BORDER_REPLICATE, NULL);
+        });
+        GET_TIME (time_neon,
+        {
+            for (n = 0; n < TEST_COUNT; n++)
+                ne10_img_warp_perspective_rgba_neon (src, dst, sizes[i], stride, sizes[i], stride,
+                                                     m, NE10_IMG_BORDER_REPLICATE, NULL);
+        });
+        sprintf (info, "name:warp perspective\nimage size:%dx%d\nc(MP/s): %.2f neon(MP/s): %.2f",
+                 sizes[i].x, sizes[i].y, mpixels * 1000000.0f / time_c, mpixels * 1000000.0f / time_neon);
+        ne10_performance_print (UBUNTU_COMMAND_LINE, time_neon / TEST_COUNT, time_c / TEST_COUNT, info);
+
+        NE10_FREE (src);
+        NE10_FREE (dst);
+    }
+    printf ("\n");
+}
+
+void test_warp()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    test_warp_conformance_case();
+#endif
+
+#if defined PERFORMANCE_TEST
+    test_warp_performance_case();
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+    ne10_init_imgproc (NE10_OK);
+}
+
+void test_fixture_warp (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_warp);       // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
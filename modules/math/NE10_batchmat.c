@@ -0,0 +1,129 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_batchmat.c
+ */
+
+#include <assert.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_batchmat.h"
+
+/*
+ * The strided and pointer-array forms of the matrix functions run the dense
+ * C versions on one element at a time, so their results are the same.
+ */
+
+#define NE10_BATCH_UNARY_C(name, dst_t, src_t) \
+ne10_result_t name##_strided_c (dst_t * dst, ne10_uint32_t dst_stride, \
+        src_t * src, ne10_uint32_t src_stride, ne10_uint32_t count) \
+{ \
+    ne10_uint32_t i; \
+ \
+    if (ne10_batch_check_strides (dst_stride, sizeof (dst_t), src_stride) != NE10_OK) \
+        return NE10_ERR; \
+    for (i = 0; i < count; i++) \
+    { \
+        name##_c (NE10_BATCH_AT (dst_t, dst, dst_stride, i), \
+                  NE10_BATCH_AT (src_t, src, src_stride, i), 1); \
+    } \
+    return NE10_OK; \
+} \
+ \
+ne10_result_t name##_ptr_c (dst_t ** dst, src_t ** src, ne10_uint32_t count) \
+{ \
+    ne10_uint32_t i; \
+ \
+    for (i = 0; i < count; i++) \
+        name##_c (dst[i], src[i], 1); \
+    return NE10_OK; \
+}
+
+#define NE10_BATCH_BINARY_C(name, t) \
+ne10_result_t name##_strided_c (t * dst, ne10_uint32_t dst_stride, \
+        t * src1, ne10_uint32_t src1_stride, \
+        t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count) \
+{ \
+    ne10_uint32_t i; \
+ \
+    if (ne10_batch_check_strides (dst_stride, sizeof (t), src1_stride | src2_stride) != NE10_OK) \
+        return NE10_ERR; \
+    for (i = 0; i < count; i++) \
+    { \
+        name##_c (NE10_BATCH_AT (t, dst, dst_stride, i), \
+                  NE10_BATCH_AT (t, src1, src1_stride, i), \
+                  NE10_BATCH_AT (t, src2, src2_stride, i), 1); \
+    } \
+    return NE10_OK; \
+} \
+ \
+ne10_result_t name##_ptr_c (t ** dst, t ** src1, t ** src2, ne10_uint32_t count) \
+{ \
+    ne10_uint32_t i; \
+ \
+    for (i = 0; i < count; i++) \
+        name##_c (dst[i], src1[i], src2[i], 1); \
+    return NE10_OK; \
+}
+
+#define NE10_BATCH_MATVEC_C(name, vec_t, mat_t) \
+ne10_result_t name##_strided_c (vec_t * dst, ne10_uint32_t dst_stride, const mat_t * cst, \
+        vec_t * src, ne10_uint32_t src_stride, ne10_uint32_t count) \
+{ \
+    ne10_uint32_t i; \
+ \
+    if (ne10_batch_check_strides (dst_stride, sizeof (vec_t), src_stride) != NE10_OK) \
+        return NE10_ERR; \
+    for (i = 0; i < count; i++) \
+    { \
+        name##_c (NE10_BATCH_AT (vec_t, dst, dst_stride, i), cst, \
+                  NE10_BATCH_AT (vec_t, src, src_stride, i), 1); \
+    } \
+    return NE10_OK; \
+} \
+ \
+ne10_result_t name##_ptr_c (vec_t ** dst, const mat_t * cst, vec_t ** src, ne10_uint32_t count) \
+{ \
+    ne10_uint32_t i; \
+ \
+    for (i = 0; i < count; i++) \
+        name##_c (dst[i], cst, src[i], 1); \
+    return NE10_OK; \
+}
+
+NE10_BATCH_BINARY_C (ne10_mulmat_3x3f, ne10_mat3x3f_t)
+NE10_BATCH_BINARY_C (ne10_mulmat_4x4f, ne10_mat4x4f_t)
+NE10_BATCH_UNARY_C (ne10_invmat_3x3f, ne10_mat3x3f_t, ne10_mat3x3f_t)
+NE10_BATCH_UNARY_C (ne10_invmat_4x4f, ne10_mat4x4f_t, ne10_mat4x4f_t)
+NE10_BATCH_UNARY_C (ne10_transmat_3x3f, ne10_mat3x3f_t, ne10_mat3x3f_t)
+NE10_BATCH_UNARY_C (ne10_transmat_4x4f, ne10_mat4x4f_t, ne10_mat4x4f_t)
+NE10_BATCH_UNARY_C (ne10_detmat_3x3f, ne10_float32_t, ne10_mat3x3f_t)
+NE10_BATCH_UNARY_C (ne10_detmat_4x4f, ne10_float32_t, ne10_mat4x4f_t)
+NE10_BATCH_MATVEC_C (ne10_mulcmatvec_cm3x3f_v3f, ne10_vec3f_t, ne10_mat3x3f_t)
+NE10_BATCH_MATVEC_C (ne10_mulcmatvec_cm4x4f_v4f, ne10_vec4f_t, ne10_mat4x4f_t)
@@ -0,0 +1,62 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_batchmat.h
+ */
+
+/*
+ * Addressing shared by the strided and pointer-array matrix functions. Element
+ * i of a strided array lives at byte offset i * stride from its base, so the
+ * matrices (or vectors, or determinants) can be members of larger structures.
+ */
+
+#ifndef NE10_BATCHMAT_H
+#define NE10_BATCHMAT_H
+
+#include <stddef.h>
+
+#include "NE10_types.h"
+
+/* element i of the strided array at base, as a pointer to type */
+#define NE10_BATCH_AT(type, base, stride, i) \
+    ( (type *) ( (ne10_uint8_t *) (base) + (size_t) (stride) * (i)))
+
+/*
+ * Destination elements must not overlap each other, and every stride must keep
+ * the floats aligned. Source strides may be 0, which repeats one element.
+ * src_strides is the bitwise or of the source strides.
+ */
+static inline ne10_result_t ne10_batch_check_strides (ne10_uint32_t dst_stride, ne10_uint32_t dst_size,
+        ne10_uint32_t src_strides)
+{
+    if (dst_stride < dst_size || ( (dst_stride | src_strides) % sizeof (ne10_float32_t)) != 0)
+        return NE10_ERR;
+    return NE10_OK;
+}
+
+#endif // NE10_BATCHMAT_H
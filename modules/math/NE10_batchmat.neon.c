@@ -0,0 +1,300 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_batchmat.neon.c
+ */
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_math.neonintrinsic.h"
+#include "NE10_batchmat.h"
+
+/*
+ * Four matrices are gathered straight from their own addresses into the
+ * structure-of-arrays registers of NE10_math.neonintrinsic.h, worked on one
+ * per lane with the kernels of the dense functions, and scattered back. The
+ * last count % 4 elements go through the C versions.
+ */
+
+static inline void ne10_mulmat_3x3f_x4_neon (ne10_float32_t * const * d,
+        const ne10_float32_t * const * a, const ne10_float32_t * const * b)
+{
+    float32x4_t ma[9], mb[9], md[9];
+
+    ne10_gather_3x3f_soa_neon (a, ma);
+    ne10_gather_3x3f_soa_neon (b, mb);
+    ne10_mulmat_nxnf_soa_neon (md, ma, mb, 3);
+    ne10_scatter_3x3f_soa_neon (d, md);
+}
+
+static inline void ne10_mulmat_4x4f_x4_neon (ne10_float32_t * const * d,
+        const ne10_float32_t * const * a, const ne10_float32_t * const * b)
+{
+    float32x4_t ma[16], mb[16], md[16];
+
+    ne10_gather_4x4f_soa_neon (a, ma);
+    ne10_gather_4x4f_soa_neon (b, mb);
+    ne10_mulmat_nxnf_soa_neon (md, ma, mb, 4);
+    ne10_scatter_4x4f_soa_neon (d, md);
+}
+
+static inline void ne10_invmat_3x3f_x4_neon (ne10_float32_t * const * d, const ne10_float32_t * const * s)
+{
+    float32x4_t m[9], md[9];
+
+    ne10_gather_3x3f_soa_neon (s, m);
+    ne10_invmat_3x3f_soa_neon (md, m);
+    ne10_scatter_3x3f_soa_neon (d, md);
+}
+
+static inline void ne10_invmat_4x4f_x4_neon (ne10_float32_t * const * d, const ne10_float32_t * const * s)
+{
+    float32x4_t m[16], md[16];
+
+    ne10_gather_4x4f_soa_neon (s, m);
+    ne10_invmat_4x4f_soa_neon (md, m);
+    ne10_scatter_4x4f_soa_neon (d, md);
+}
+
+static inline void ne10_transmat_3x3f_x4_neon (ne10_float32_t * const * d, const ne10_float32_t * const * s)
+{
+    float32x4_t m[9], md[9];
+
+    ne10_gather_3x3f_soa_neon (s, m);
+    ne10_transmat_nxnf_soa_neon (md, m, 3);
+    ne10_scatter_3x3f_soa_neon (d, md);
+}
+
+static inline void ne10_transmat_4x4f_x4_neon (ne10_float32_t * const * d, const ne10_float32_t * const * s)
+{
+    float32x4_t m[16], md[16];
+
+    ne10_gather_4x4f_soa_neon (s, m);
+    ne10_transmat_nxnf_soa_neon (md, m, 4);
+    ne10_scatter_4x4f_soa_neon (d, md);
+}
+
+static inline void ne10_detmat_3x3f_x4_neon (ne10_float32_t * const * d, const ne10_float32_t * const * s)
+{
+    float32x4_t m[9];
+
+    ne10_gather_3x3f_soa_neon (s, m);
+    ne10_scatter_lane_f32_neon (d, 0, ne10_detmat_3x3f_soa_neon (m));
+}
+
+static inline void ne10_detmat_4x4f_x4_neon (ne10_float32_t * const * d, const ne10_float32_t * const * s)
+{
+    float32x4_t m[16];
+
+    ne10_gather_4x4f_soa_neon (s, m);
+    ne10_scatter_lane_f32_neon (d, 0, ne10_detmat_4x4f_soa_neon (m));
+}
+
+/* as the C versions: dst = A1 * x + D1 * y + G1 * z, and so on */
+static inline void ne10_mulcmatvec_cm3x3f_v3f_x4_neon (ne10_float32_t * const * d,
+        const ne10_float32_t * m, const ne10_float32_t * const * s)
+{
+    float32x4_t x = ne10_gather_lane_f32_neon (s, 0);
+    float32x4_t y = ne10_gather_lane_f32_neon (s, 1);
+    float32x4_t z = ne10_gather_lane_f32_neon (s, 2);
+    ne10_int32_t r;
+
+    for (r = 0; r < 3; r++)
+    {
+        float32x4_t v = vmulq_n_f32 (x, m[r]);
+        v = vaddq_f32 (v, vmulq_n_f32 (y, m[3 + r]));
+        v = vaddq_f32 (v, vmulq_n_f32 (z, m[6 + r]));
+        ne10_scatter_lane_f32_neon (d, r, v);
+    }
+}
+
+static inline void ne10_mulcmatvec_cm4x4f_v4f_x4_neon (ne10_float32_t * const * d,
+        const ne10_float32_t * m, const ne10_float32_t * const * s)
+{
+    float32x4_t x = vld1q_f32 (s[0]);
+    float32x4_t y = vld1q_f32 (s[1]);
+    float32x4_t z = vld1q_f32 (s[2]);
+    float32x4_t w = vld1q_f32 (s[3]);
+    float32x4_t v[4];
+    ne10_int32_t r;
+
+    NE10_TRANSPOSE_4x4F_NEON (x, y, z, w);
+    for (r = 0; r < 4; r++)
+    {
+        v[r] = vmulq_n_f32 (x, m[r]);
+        v[r] = vaddq_f32 (v[r], vmulq_n_f32 (y, m[4 + r]));
+        v[r] = vaddq_f32 (v[r], vmulq_n_f32 (z, m[8 + r]));
+        v[r] = vaddq_f32 (v[r], vmulq_n_f32 (w, m[12 + r]));
+    }
+    NE10_TRANSPOSE_4x4F_NEON (v[0], v[1], v[2], v[3]);
+    vst1q_f32 (d[0], v[0]);
+    vst1q_f32 (d[1], v[1]);
+    vst1q_f32 (d[2], v[2]);
+    vst1q_f32 (d[3], v[3]);
+}
+
+#define NE10_BATCH_UNARY_NEON(name, dst_t, src_t) \
+ne10_result_t name##_strided_neon (dst_t * dst, ne10_uint32_t dst_stride, \
+        src_t * src, ne10_uint32_t src_stride, ne10_uint32_t count) \
+{ \
+    ne10_float32_t *d[4]; \
+    const ne10_float32_t *s[4]; \
+    ne10_uint32_t i, j; \
+ \
+    if (ne10_batch_check_strides (dst_stride, sizeof (dst_t), src_stride) != NE10_OK) \
+        return NE10_ERR; \
+    for (i = 0; i + 4 <= count; i += 4) \
+    { \
+        for (j = 0; j < 4; j++) \
+        { \
+            d[j] = NE10_BATCH_AT (ne10_float32_t, dst, dst_stride, i + j); \
+            s[j] = NE10_BATCH_AT (const ne10_float32_t, src, src_stride, i + j); \
+        } \
+        name##_x4_neon (d, s); \
+    } \
+    return name##_strided_c (NE10_BATCH_AT (dst_t, dst, dst_stride, i), dst_stride, \
+                             NE10_BATCH_AT (src_t, src, src_stride, i), src_stride, count - i); \
+} \
+ \
+ne10_result_t name##_ptr_neon (dst_t ** dst, src_t ** src, ne10_uint32_t count) \
+{ \
+    ne10_float32_t *d[4]; \
+    const ne10_float32_t *s[4]; \
+    ne10_uint32_t i, j; \
+ \
+    for (i = 0; i + 4 <= count; i += 4) \
+    { \
+        for (j = 0; j < 4; j++) \
+        { \
+            d[j] = (ne10_float32_t*) dst[i + j]; \
+            s[j] = (const ne10_float32_t*) src[i + j]; \
+        } \
+        name##_x4_neon (d, s); \
+    } \
+    return name##_ptr_c (dst + i, src + i, count - i); \
+}
+
+#define NE10_BATCH_BINARY_NEON(name, t) \
+ne10_result_t name##_strided_neon (t * dst, ne10_uint32_t dst_stride, \
+        t * src1, ne10_uint32_t src1_stride, \
+        t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count) \
+{ \
+    ne10_float32_t *d[4]; \
+    const ne10_float32_t *a[4], *b[4]; \
+    ne10_uint32_t i, j; \
+ \
+    if (ne10_batch_check_strides (dst_stride, sizeof (t), src1_stride | src2_stride) != NE10_OK) \
+        return NE10_ERR; \
+    for (i = 0; i + 4 <= count; i += 4) \
+    { \
+        for (j = 0; j < 4; j++) \
+        { \
+            d[j] = NE10_BATCH_AT (ne10_float32_t, dst, dst_stride, i + j); \
+            a[j] = NE10_BATCH_AT (const ne10_float32_t, src1, src1_stride, i + j); \
+            b[j] = NE10_BATCH_AT (const ne10_float32_t, src2, src2_stride, i + j); \
+        } \
+        name##_x4_neon (d, a, b); \
+    } \
+    return name##_strided_c (NE10_BATCH_AT (t, dst, dst_stride, i), dst_stride, \
+                             NE10_BATCH_AT (t, src1, src1_stride, i), src1_stride, \
+                             NE10_BATCH_AT (t, src2, src2_stride, i), src2_stride, count - i); \
+} \
+ \
+ne10_result_t name##_ptr_neon (t ** dst, t ** src1, t ** src2, ne10_uint32_t count) \
+{ \
+    ne10_float32_t *d[4]; \
+    const ne10_float32_t *a[4], *b[4]; \
+    ne10_uint32_t i, j; \
+ \
+    for (i = 0; i + 4 <= count; i += 4) \
+    { \
+        for (j = 0; j < 4; j++) \
+        { \
+            d[j] = (ne10_float32_t*) dst[i + j]; \
+            a[j] = (const ne10_float32_t*) src1[i + j]; \
+            b[j] = (const ne10_float32_t*) src2[i + j]; \
+        } \
+        name##_x4_neon (d, a, b); \
+    } \
+    return name##_ptr_c (dst + i, src1 + i, src2 + i, count - i); \
+}
+
+#define NE10_BATCH_MATVEC_NEON(name, vec_t, mat_t) \
+ne10_result_t name##_strided_neon (vec_t * dst, ne10_uint32_t dst_stride, const mat_t * cst, \
+        vec_t * src, ne10_uint32_t src_stride, ne10_uint32_t count) \
+{ \
+    ne10_float32_t *d[4]; \
+    const ne10_float32_t *s[4]; \
+    ne10_uint32_t i, j; \
+ \
+    if (ne10_batch_check_strides (dst_stride, sizeof (vec_t), src_stride) != NE10_OK) \
+        return NE10_ERR; \
+    for (i = 0; i + 4 <= count; i += 4) \
+    { \
+        for (j = 0; j < 4; j++) \
+        { \
+            d[j] = NE10_BATCH_AT (ne10_float32_t, dst, dst_stride, i + j); \
+            s[j] = NE10_BATCH_AT (const ne10_float32_t, src, src_stride, i + j); \
+        } \
+        name##_x4_neon (d, (const ne10_float32_t*) cst, s); \
+    } \
+    return name##_strided_c (NE10_BATCH_AT (vec_t, dst, dst_stride, i), dst_stride, cst, \
+                             NE10_BATCH_AT (vec_t, src, src_stride, i), src_stride, count - i); \
+} \
+ \
+ne10_result_t name##_ptr_neon (vec_t ** dst, const mat_t * cst, vec_t ** src, ne10_uint32_t count) \
+{ \
+    ne10_float32_t *d[4]; \
+    const ne10_float32_t *s[4]; \
+    ne10_uint32_t i, j; \
+ \
+    for (i = 0; i + 4 <= count; i += 4) \
+    { \
+        for (j = 0; j < 4; j++) \
+        { \
+            d[j] = (ne10_float32_t*) dst[i + j]; \
+            s[j] = (const ne10_float32_t*) src[i + j]; \
+        } \
+        name##_x4_neon (d, (const ne10_float32_t*) cst, s); \
+    } \
+    return name##_ptr_c (dst + i, cst, src + i, count - i); \
+}
+
+NE10_BATCH_BINARY_NEON (ne10_mulmat_3x3f, ne10_mat3x3f_t)
+NE10_BATCH_BINARY_NEON (ne10_mulmat_4x4f, ne10_mat4x4f_t)
+NE10_BATCH_UNARY_NEON (ne10_invmat_3x3f, ne10_mat3x3f_t, ne10_mat3x3f_t)
+NE10_BATCH_UNARY_NEON (ne10_invmat_4x4f, ne10_mat4x4f_t, ne10_mat4x4f_t)
+NE10_BATCH_UNARY_NEON (ne10_transmat_3x3f, ne10_mat3x3f_t, ne10_mat3x3f_t)
+NE10_BATCH_UNARY_NEON (ne10_transmat_4x4f, ne10_mat4x4f_t, ne10_mat4x4f_t)
+NE10_BATCH_UNARY_NEON (ne10_detmat_3x3f, ne10_float32_t, ne10_mat3x3f_t)
+NE10_BATCH_UNARY_NEON (ne10_detmat_4x4f, ne10_float32_t, ne10_mat4x4f_t)
+NE10_BATCH_MATVEC_NEON (ne10_mulcmatvec_cm3x3f_v3f, ne10_vec3f_t, ne10_mat3x3f_t)
+NE10_BATCH_MATVEC_NEON (ne10_mulcmatvec_cm4x4f_v4f, ne10_vec4f_t, ne10_mat4x4f_t)
@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_chain.c
+ */
+
+#include <string.h>
+
+#include "NE10_types.h"
+#include "macros.h"
+#include "NE10_chain.h"
+
+#include <math.h>
+
+/*
+ * Number of elements processed by every operation of the chain before moving
+ * on to the next elements. The tile lives on the stack, so it stays in L1
+ * cache while the whole chain is applied to it, and each operation is a short
+ * loop that the compiler can vectorise.
+ */
+#define NE10_CHAIN_TILE 64
+
+static inline void ne10_chain_apply_c (ne10_float32_t *x,
+        const ne10_chain_op_t *op,
+        ne10_uint32_t offset,
+        ne10_uint32_t len)
+{
+    const ne10_float32_t c0 = op->cst[0];
+    const ne10_float32_t c1 = op->cst[1];
+    const ne10_float32_t *a = (op->src[0] != NULL) ? op->src[0] + offset : NULL;
+    const ne10_float32_t *b = (op->src[1] != NULL) ? op->src[1] + offset : NULL;
+    ne10_uint32_t i;
+
+    switch (op->op)
+    {
+    case NE10_CHAIN_ADDC:
+        for (i = 0; i < len; i++)
+            x[i] = x[i] + c0;
+        break;
+    case NE10_CHAIN_SUBC:
+        for (i = 0; i < len; i++)
+            x[i] = x[i] - c0;
+        break;
+    case NE10_CHAIN_RSBC:
+        for (i = 0; i < len; i++)
+            x[i] = c0 - x[i];
+        break;
+    case NE10_CHAIN_MULC:
+        for (i = 0; i < len; i++)
+            x[i] = x[i] * c0;
+        break;
+    case NE10_CHAIN_ADD:
+        for (i = 0; i < len; i++)
+            x[i] = x[i] + a[i];
+        break;
+    case NE10_CHAIN_SUB:
+        for (i = 0; i < len; i++)
+            x[i] = x[i] - a[i];
+        break;
+    case NE10_CHAIN_MUL:
+        for (i = 0; i < len; i++)
+            x[i] = x[i] * a[i];
+        break;
+    case NE10_CHAIN_MLA:
+        for (i = 0; i < len; i++)
+            x[i] = x[i] + (a[i] * b[i]);
+        break;
+    case NE10_CHAIN_ABS:
+        for (i = 0; i < len; i++)
+            x[i] = fabs (x[i]);
+        break;
+    case NE10_CHAIN_MINC:
+        for (i = 0; i < len; i++)
+            x[i] = (x[i] < c0) ? x[i] : c0;
+        break;
+    case NE10_CHAIN_MAXC:
+        for (i = 0; i < len; i++)
+            x[i] = (x[i] > c0) ? x[i] : c0;
+        break;
+    case NE10_CHAIN_CLAMP:
+        for (i = 0; i < len; i++)
+        {
+            ne10_float32_t t = (x[i] > c0) ? x[i] : c0;
+            x[i] = (t < c1) ? t : c1;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+ne10_result_t ne10_chain_float_c (ne10_float32_t * dst,
+                                  ne10_float32_t * src,
+                                  const ne10_chain_op_t * ops,
+                                  ne10_uint32_t op_count,
+                                  ne10_uint32_t count)
+{
+    ne10_float32_t tile[NE10_CHAIN_TILE];
+    ne10_uint32_t itr, len, k;
+
+    NE10_CHECKPOINTER_DstSrc;
+    if (ne10_chain_check (ops, op_count) != NE10_OK)
+    {
+        return NE10_ERR;
+    }
+
+    // The output is only written once a tile is complete, so operand arrays
+    // may alias the source or destination. Full tiles pass a constant length
+    // so that the loops of ne10_chain_apply_c have a known trip count.
+    for (itr = 0; itr + NE10_CHAIN_TILE <= count; itr += NE10_CHAIN_TILE)
+    {
+        memcpy (tile, src + itr, sizeof (tile));
+        for (k = 0; k < op_count; k++)
+        {
+            ne10_chain_apply_c (tile, &ops[k], itr, NE10_CHAIN_TILE);
+        }
+        memcpy (dst + itr, tile, sizeof (tile));
+    }
+
+    if (itr < count)
+    {
+        len = count - itr;
+        memcpy (tile, src + itr, len * sizeof (ne10_float32_t));
+        for (k = 0; k < op_count; k++)
+        {
+            ne10_chain_apply_c (tile, &ops[k], itr, len);
+        }
+        memcpy (dst + itr, tile, len * sizeof (ne10_float32_t));
+    }
+    return NE10_OK;
+}
@@ -0,0 +1,85 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_chain.h
+ */
+
+/*
+ * Checks shared by the C and NEON implementations of ne10_chain_float, so that
+ * both reject an invalid chain before writing anything.
+ */
+
+#ifndef NE10_CHAIN_H
+#define NE10_CHAIN_H
+
+#include "NE10_types.h"
+
+static inline ne10_result_t ne10_chain_check (const ne10_chain_op_t *ops, ne10_uint32_t op_count)
+{
+    ne10_uint32_t k;
+
+    if ( (op_count > NE10_CHAIN_MAX_OPS) || ( (op_count > 0) && (ops == NULL)))
+    {
+        return NE10_ERR;
+    }
+
+    for (k = 0; k < op_count; k++)
+    {
+        switch (ops[k].op)
+        {
+        case NE10_CHAIN_MLA:
+            if (ops[k].src[1] == NULL)
+            {
+                return NE10_ERR;
+            }
+            // fall through
+        case NE10_CHAIN_ADD:
+        case NE10_CHAIN_SUB:
+        case NE10_CHAIN_MUL:
+            if (ops[k].src[0] == NULL)
+            {
+                return NE10_ERR;
+            }
+            break;
+        case NE10_CHAIN_ADDC:
+        case NE10_CHAIN_SUBC:
+        case NE10_CHAIN_RSBC:
+        case NE10_CHAIN_MULC:
+        case NE10_CHAIN_ABS:
+        case NE10_CHAIN_MINC:
+        case NE10_CHAIN_MAXC:
+        case NE10_CHAIN_CLAMP:
+            break;
+        default:
+            return NE10_ERR;
+        }
+    }
+    return NE10_OK;
+}
+
+#endif // NE10_CHAIN_H
@@ -0,0 +1,154 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_chain.neon.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_chain.h"
+
+#include <arm_neon.h>
+
+/*
+ * Every operation of the chain is applied to NE10_CHAIN_NEON_REGS q registers
+ * (16 elements) before they are stored, so the data makes a single trip
+ * through memory whatever the length of the chain.
+ */
+#define NE10_CHAIN_NEON_REGS 4
+#define NE10_CHAIN_NEON_TILE (NE10_CHAIN_NEON_REGS * 4)
+
+ne10_result_t ne10_chain_float_neon (ne10_float32_t * dst,
+                                     ne10_float32_t * src,
+                                     const ne10_chain_op_t * ops,
+                                     ne10_uint32_t op_count,
+                                     ne10_uint32_t count)
+{
+    ne10_chain_op_t tail_ops[NE10_CHAIN_MAX_OPS];
+    float32x4_t x[NE10_CHAIN_NEON_REGS];
+    float32x4_t c0, c1;
+    ne10_uint32_t itr, k, j;
+
+    NE10_CHECKPOINTER_DstSrc;
+    if (ne10_chain_check (ops, op_count) != NE10_OK)
+    {
+        return NE10_ERR;
+    }
+
+    for (itr = 0; itr + NE10_CHAIN_NEON_TILE <= count; itr += NE10_CHAIN_NEON_TILE)
+    {
+        for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+            x[j] = vld1q_f32 (src + itr + j * 4);
+
+        for (k = 0; k < op_count; k++)
+        {
+            const ne10_chain_op_t *op = &ops[k];
+            const ne10_float32_t *a = (op->src[0] != NULL) ? op->src[0] + itr : NULL;
+            const ne10_float32_t *b = (op->src[1] != NULL) ? op->src[1] + itr : NULL;
+
+            switch (op->op)
+            {
+            case NE10_CHAIN_ADDC:
+                c0 = vdupq_n_f32 (op->cst[0]);
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vaddq_f32 (x[j], c0);
+                break;
+            case NE10_CHAIN_SUBC:
+                c0 = vdupq_n_f32 (op->cst[0]);
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vsubq_f32 (x[j], c0);
+                break;
+            case NE10_CHAIN_RSBC:
+                c0 = vdupq_n_f32 (op->cst[0]);
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vsubq_f32 (c0, x[j]);
+                break;
+            case NE10_CHAIN_MULC:
+                c0 = vdupq_n_f32 (op->cst[0]);
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vmulq_f32 (x[j], c0);
+                break;
+            case NE10_CHAIN_ADD:
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vaddq_f32 (x[j], vld1q_f32 (a + j * 4));
+                break;
+            case NE10_CHAIN_SUB:
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vsubq_f32 (x[j], vld1q_f32 (a + j * 4));
+                break;
+            case NE10_CHAIN_MUL:
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vmulq_f32 (x[j], vld1q_f32 (a + j * 4));
+                break;
+            case NE10_CHAIN_MLA:
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vmlaq_f32 (x[j], vld1q_f32 (a + j * 4), vld1q_f32 (b + j * 4));
+                break;
+            case NE10_CHAIN_ABS:
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vabsq_f32 (x[j]);
+                break;
+            case NE10_CHAIN_MINC:
+                c0 = vdupq_n_f32 (op->cst[0]);
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vminq_f32 (x[j], c0);
+                break;
+            case NE10_CHAIN_MAXC:
+                c0 = vdupq_n_f32 (op->cst[0]);
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vmaxq_f32 (x[j], c0);
+                break;
+            case NE10_CHAIN_CLAMP:
+                c0 = vdupq_n_f32 (op->cst[0]);
+                c1 = vdupq_n_f32 (op->cst[1]);
+                for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+                    x[j] = vminq_f32 (vmaxq_f32 (x[j], c0), c1);
+                break;
+            default:
+                break;
+            }
+        }
+
+        for (j = 0; j < NE10_CHAIN_NEON_REGS; j++)
+            vst1q_f32 (dst + itr + j * 4, x[j]);
+    }
+
+    // The remaining (fewer than 16) elements use the C version
+    if (itr < count)
+    {
+        for (k = 0; k < op_count; k++)
+        {
+            tail_ops[k] = ops[k];
+            tail_ops[k].src[0] = (ops[k].src[0] != NULL) ? ops[k].src[0] + itr : NULL;
+            tail_ops[k].src[1] = (ops[k].src[1] != NULL) ? ops[k].src[1] + itr : NULL;
+        }
+        ne10_chain_float_c (dst + itr, src + itr, tail_ops, op_count, count - itr);
+    }
+    return NE10_OK;
+}
@@ -0,0 +1,346 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_complex.c
+ */
+
+#include <assert.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+
+/*
+ * The C versions evaluate the same operations, in the same order, as the
+ * NEON and x86 versions, which pass their leftover elements to them.
+ */
+
+/*
+ * Q31 and Q15 products, (a * b) >> 31 and (a * b) >> 15 rounded down, and
+ * sums, saturated: the operations of vqdmulh, vqadd and vqsub.
+ */
+static inline ne10_int32_t ne10_qmul_int32 (ne10_int32_t a, ne10_int32_t b)
+{
+    ne10_int64_t p = ( (ne10_int64_t) a * b) >> 31;
+    return (p > 0x7fffffff) ? 0x7fffffff : (ne10_int32_t) p;
+}
+
+static inline ne10_int32_t ne10_qadd_int32 (ne10_int32_t a, ne10_int32_t b)
+{
+    ne10_int64_t s = (ne10_int64_t) a + b;
+    return (s > 0x7fffffff) ? 0x7fffffff : (s < -0x7fffffff - 1) ? -0x7fffffff - 1 : (ne10_int32_t) s;
+}
+
+static inline ne10_int32_t ne10_qsub_int32 (ne10_int32_t a, ne10_int32_t b)
+{
+    ne10_int64_t s = (ne10_int64_t) a - b;
+    return (s > 0x7fffffff) ? 0x7fffffff : (s < -0x7fffffff - 1) ? -0x7fffffff - 1 : (ne10_int32_t) s;
+}
+
+static inline ne10_int16_t ne10_qmul_int16 (ne10_int16_t a, ne10_int16_t b)
+{
+    ne10_int32_t p = ( (ne10_int32_t) a * b) >> 15;
+    return (p > 32767) ? 32767 : (ne10_int16_t) p;
+}
+
+static inline ne10_int16_t ne10_qadd_int16 (ne10_int16_t a, ne10_int16_t b)
+{
+    ne10_int32_t s = (ne10_int32_t) a + b;
+    return (s > 32767) ? 32767 : (s < -32768) ? -32768 : (ne10_int16_t) s;
+}
+
+static inline ne10_int16_t ne10_qsub_int16 (ne10_int16_t a, ne10_int16_t b)
+{
+    ne10_int32_t s = (ne10_int32_t) a - b;
+    return (s > 32767) ? 32767 : (s < -32768) ? -32768 : (ne10_int16_t) s;
+}
+
+ne10_result_t ne10_cmul_float32_c (ne10_fft_cpx_float32_t * dst,
+                                   ne10_fft_cpx_float32_t * src1,
+                                   ne10_fft_cpx_float32_t * src2,
+                                   ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_fft_cpx_float32_t a = src1[itr];
+        ne10_fft_cpx_float32_t b = src2[itr];
+
+        dst[itr].r = a.r * b.r - a.i * b.i;
+        dst[itr].i = a.r * b.i + a.i * b.r;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cmul_conj_float32_c (ne10_fft_cpx_float32_t * dst,
+                                        ne10_fft_cpx_float32_t * src1,
+                                        ne10_fft_cpx_float32_t * src2,
+                                        ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_fft_cpx_float32_t a = src1[itr];
+        ne10_fft_cpx_float32_t b = src2[itr];
+
+        dst[itr].r = a.r * b.r + a.i * b.i;
+        dst[itr].i = a.i * b.r - a.r * b.i;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cmac_float32_c (ne10_fft_cpx_float32_t * dst,
+                                   ne10_fft_cpx_float32_t * acc,
+                                   ne10_fft_cpx_float32_t * src1,
+                                   ne10_fft_cpx_float32_t * src2,
+                                   ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstAccSrc1Src2;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_fft_cpx_float32_t a = src1[itr];
+        ne10_fft_cpx_float32_t b = src2[itr];
+
+        dst[itr].r = acc[itr].r + (a.r * b.r - a.i * b.i);
+        dst[itr].i = acc[itr].i + (a.r * b.i + a.i * b.r);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cabs_float32_c (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+        dst[itr] = sqrtf (src[itr].r * src[itr].r + src[itr].i * src[itr].i);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cabs2_float32_c (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+        dst[itr] = src[itr].r * src[itr].r + src[itr].i * src[itr].i;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cscale_float32_c (ne10_fft_cpx_float32_t * dst,
+                                     ne10_fft_cpx_float32_t * src,
+                                     ne10_float32_t cst,
+                                     ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrcCst;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        dst[itr].r = src[itr].r * cst;
+        dst[itr].i = src[itr].i * cst;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cpolar_float32_c (ne10_float32_t * mag,
+                                     ne10_float32_t * phase,
+                                     ne10_fft_cpx_float32_t * src,
+                                     ne10_uint32_t count)
+{
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_fft_cpx_float32_t a = src[itr];
+
+        mag[itr] = sqrtf (a.r * a.r + a.i * a.i);
+        ne10_atan2_float_c (phase + itr, &a.i, &a.r, 1);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_crect_float32_c (ne10_fft_cpx_float32_t * dst,
+                                    ne10_float32_t * mag,
+                                    ne10_float32_t * phase,
+                                    ne10_uint32_t count)
+{
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_float32_t s, c, m = mag[itr];
+
+        ne10_sincos_float_c (&s, &c, phase + itr, 1);
+        dst[itr].r = m * c;
+        dst[itr].i = m * s;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cmul_int32_c (ne10_fft_cpx_int32_t * dst,
+                                 ne10_fft_cpx_int32_t * src1,
+                                 ne10_fft_cpx_int32_t * src2,
+                                 ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_fft_cpx_int32_t a = src1[itr];
+        ne10_fft_cpx_int32_t b = src2[itr];
+
+        dst[itr].r = ne10_qsub_int32 (ne10_qmul_int32 (a.r, b.r), ne10_qmul_int32 (a.i, b.i));
+        dst[itr].i = ne10_qadd_int32 (ne10_qmul_int32 (a.r, b.i), ne10_qmul_int32 (a.i, b.r));
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cmul_conj_int32_c (ne10_fft_cpx_int32_t * dst,
+                                      ne10_fft_cpx_int32_t * src1,
+                                      ne10_fft_cpx_int32_t * src2,
+                                      ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_fft_cpx_int32_t a = src1[itr];
+        ne10_fft_cpx_int32_t b = src2[itr];
+
+        dst[itr].r = ne10_qadd_int32 (ne10_qmul_int32 (a.r, b.r), ne10_qmul_int32 (a.i, b.i));
+        dst[itr].i = ne10_qsub_int32 (ne10_qmul_int32 (a.i, b.r), ne10_qmul_int32 (a.r, b.i));
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cmac_int32_c (ne10_fft_cpx_int32_t * dst,
+                                 ne10_fft_cpx_int32_t * acc,
+                                 ne10_fft_cpx_int32_t * src1,
+                                 ne10_fft_cpx_int32_t * src2,
+                                 ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstAccSrc1Src2;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_fft_cpx_int32_t a = src1[itr];
+        ne10_fft_cpx_int32_t b = src2[itr];
+        ne10_int32_t r = ne10_qsub_int32 (ne10_qmul_int32 (a.r, b.r), ne10_qmul_int32 (a.i, b.i));
+        ne10_int32_t i = ne10_qadd_int32 (ne10_qmul_int32 (a.r, b.i), ne10_qmul_int32 (a.i, b.r));
+
+        dst[itr].r = ne10_qadd_int32 (acc[itr].r, r);
+        dst[itr].i = ne10_qadd_int32 (acc[itr].i, i);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cabs2_int32_c (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+        dst[itr] = ne10_qadd_int32 (ne10_qmul_int32 (src[itr].r, src[itr].r), ne10_qmul_int32 (src[itr].i, src[itr].i));
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cscale_int32_c (ne10_fft_cpx_int32_t * dst,
+                                   ne10_fft_cpx_int32_t * src,
+                                   ne10_int32_t cst,
+                                   ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrcCst;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        dst[itr].r = ne10_qmul_int32 (src[itr].r, cst);
+        dst[itr].i = ne10_qmul_int32 (src[itr].i, cst);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cmul_int16_c (ne10_fft_cpx_int16_t * dst,
+                                 ne10_fft_cpx_int16_t * src1,
+                                 ne10_fft_cpx_int16_t * src2,
+                                 ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_fft_cpx_int16_t a = src1[itr];
+        ne10_fft_cpx_int16_t b = src2[itr];
+
+        dst[itr].r = ne10_qsub_int16 (ne10_qmul_int16 (a.r, b.r), ne10_qmul_int16 (a.i, b.i));
+        dst[itr].i = ne10_qadd_int16 (ne10_qmul_int16 (a.r, b.i), ne10_qmul_int16 (a.i, b.r));
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cmul_conj_int16_c (ne10_fft_cpx_int16_t * dst,
+                                      ne10_fft_cpx_int16_t * src1,
+                                      ne10_fft_cpx_int16_t * src2,
+                                      ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_fft_cpx_int16_t a = src1[itr];
+        ne10_fft_cpx_int16_t b = src2[itr];
+
+        dst[itr].r = ne10_qadd_int16 (ne10_qmul_int16 (a.r, b.r), ne10_qmul_int16 (a.i, b.i));
+        dst[itr].i = ne10_qsub_int16 (ne10_qmul_int16 (a.i, b.r), ne10_qmul_int16 (a.r, b.i));
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cmac_int16_c (ne10_fft_cpx_int16_t * dst,
+                                 ne10_fft_cpx_int16_t * acc,
+                                 ne10_fft_cpx_int16_t * src1,
+                                 ne10_fft_cpx_int16_t * src2,
+                                 ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstAccSrc1Src2;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        ne10_fft_cpx_int16_t a = src1[itr];
+        ne10_fft_cpx_int16_t b = src2[itr];
+        ne10_int16_t r = ne10_qsub_int16 (ne10_qmul_int16 (a.r, b.r), ne10_qmul_int16 (a.i, b.i));
+        ne10_int16_t i = ne10_qadd_int16 (ne10_qmul_int16 (a.r, b.i), ne10_qmul_int16 (a.i, b.r));
+
+        dst[itr].r = ne10_qadd_int16 (acc[itr].r, r);
+        dst[itr].i = ne10_qadd_int16 (acc[itr].i, i);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cabs2_int16_c (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrc;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+        dst[itr] = ne10_qadd_int16 (ne10_qmul_int16 (src[itr].r, src[itr].r), ne10_qmul_int16 (src[itr].i, src[itr].i));
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cscale_int16_c (ne10_fft_cpx_int16_t * dst,
+                                   ne10_fft_cpx_int16_t * src,
+                                   ne10_int16_t cst,
+                                   ne10_uint32_t count)
+{
+    NE10_CHECKPOINTER_DstSrcCst;
+    for (ne10_uint32_t itr = 0; itr < count; itr++)
+    {
+        dst[itr].r = ne10_qmul_int16 (src[itr].r, cst);
+        dst[itr].i = ne10_qmul_int16 (src[itr].i, cst);
+    }
+    return NE10_OK;
+}
@@ -0,0 +1,396 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_complex.neon.c
+ */
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "NE10_math.neonintrinsic.h"
+#include "macros.h"
+
+/* the polar conversions go through the real functions a block at a time */
+#define NE10_CPX_BLOCK 256
+
+/*
+ * The products of the de-interleaved values, with the operations of the C
+ * versions: separate multiplies and adds for floats, vqdmulh (the Q31 or Q15
+ * product, rounded down) and saturating adds for the fixed-point values.
+ */
+static inline float32x4x2_t ne10_cmul_f32_neon (float32x4x2_t a, float32x4x2_t b)
+{
+    float32x4x2_t d;
+    d.val[0] = vsubq_f32 (vmulq_f32 (a.val[0], b.val[0]), vmulq_f32 (a.val[1], b.val[1]));
+    d.val[1] = vaddq_f32 (vmulq_f32 (a.val[0], b.val[1]), vmulq_f32 (a.val[1], b.val[0]));
+    return d;
+}
+
+static inline float32x4x2_t ne10_cmul_conj_f32_neon (float32x4x2_t a, float32x4x2_t b)
+{
+    float32x4x2_t d;
+    d.val[0] = vaddq_f32 (vmulq_f32 (a.val[0], b.val[0]), vmulq_f32 (a.val[1], b.val[1]));
+    d.val[1] = vsubq_f32 (vmulq_f32 (a.val[1], b.val[0]), vmulq_f32 (a.val[0], b.val[1]));
+    return d;
+}
+
+static inline float32x4_t ne10_cabs2_f32_neon (float32x4x2_t a)
+{
+    return vaddq_f32 (vmulq_f32 (a.val[0], a.val[0]), vmulq_f32 (a.val[1], a.val[1]));
+}
+
+static inline int32x4x2_t ne10_cmul_s32_neon (int32x4x2_t a, int32x4x2_t b)
+{
+    int32x4x2_t d;
+    d.val[0] = vqsubq_s32 (vqdmulhq_s32 (a.val[0], b.val[0]), vqdmulhq_s32 (a.val[1], b.val[1]));
+    d.val[1] = vqaddq_s32 (vqdmulhq_s32 (a.val[0], b.val[1]), vqdmulhq_s32 (a.val[1], b.val[0]));
+    return d;
+}
+
+static inline int32x4x2_t ne10_cmul_conj_s32_neon (int32x4x2_t a, int32x4x2_t b)
+{
+    int32x4x2_t d;
+    d.val[0] = vqaddq_s32 (vqdmulhq_s32 (a.val[0], b.val[0]), vqdmulhq_s32 (a.val[1], b.val[1]));
+    d.val[1] = vqsubq_s32 (vqdmulhq_s32 (a.val[1], b.val[0]), vqdmulhq_s32 (a.val[0], b.val[1]));
+    return d;
+}
+
+static inline int16x8x2_t ne10_cmul_s16_neon (int16x8x2_t a, int16x8x2_t b)
+{
+    int16x8x2_t d;
+    d.val[0] = vqsubq_s16 (vqdmulhq_s16 (a.val[0], b.val[0]), vqdmulhq_s16 (a.val[1], b.val[1]));
+    d.val[1] = vqaddq_s16 (vqdmulhq_s16 (a.val[0], b.val[1]), vqdmulhq_s16 (a.val[1], b.val[0]));
+    return d;
+}
+
+static inline int16x8x2_t ne10_cmul_conj_s16_neon (int16x8x2_t a, int16x8x2_t b)
+{
+    int16x8x2_t d;
+    d.val[0] = vqaddq_s16 (vqdmulhq_s16 (a.val[0], b.val[0]), vqdmulhq_s16 (a.val[1], b.val[1]));
+    d.val[1] = vqsubq_s16 (vqdmulhq_s16 (a.val[1], b.val[0]), vqdmulhq_s16 (a.val[0], b.val[1]));
+    return d;
+}
+
+ne10_result_t ne10_cmul_float32_neon (ne10_fft_cpx_float32_t * dst,
+                                      ne10_fft_cpx_float32_t * src1,
+                                      ne10_fft_cpx_float32_t * src2,
+                                      ne10_uint32_t count)
+{
+    NE10_DstSrc1Src2_DO_COUNT_TIMES_CPX_NEON
+    (
+        FLOAT32,
+        n_dst = ne10_cmul_f32_neon (n_src, n_src2);
+        ,
+        ne10_cmul_float32_c (dst + itr, src1 + itr, src2 + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cmul_conj_float32_neon (ne10_fft_cpx_float32_t * dst,
+        ne10_fft_cpx_float32_t * src1,
+        ne10_fft_cpx_float32_t * src2,
+        ne10_uint32_t count)
+{
+    NE10_DstSrc1Src2_DO_COUNT_TIMES_CPX_NEON
+    (
+        FLOAT32,
+        n_dst = ne10_cmul_conj_f32_neon (n_src, n_src2);
+        ,
+        ne10_cmul_conj_float32_c (dst + itr, src1 + itr, src2 + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cmac_float32_neon (ne10_fft_cpx_float32_t * dst,
+                                      ne10_fft_cpx_float32_t * acc,
+                                      ne10_fft_cpx_float32_t * src1,
+                                      ne10_fft_cpx_float32_t * src2,
+                                      ne10_uint32_t count)
+{
+    NE10_DstAccSrc1Src2_DO_COUNT_TIMES_CPX_NEON
+    (
+        FLOAT32,
+        n_dst = ne10_cmul_f32_neon (n_src, n_src2);
+        n_dst.val[0] = vaddq_f32 (n_acc.val[0], n_dst.val[0]);
+        n_dst.val[1] = vaddq_f32 (n_acc.val[1], n_dst.val[1]);
+        ,
+        ne10_cmac_float32_c (dst + itr, acc + itr, src1 + itr, src2 + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cabs2_float32_neon (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    NE10_DstSrc_DO_COUNT_TIMES_CPX_REAL_NEON
+    (
+        FLOAT32,
+        n_dst = ne10_cabs2_f32_neon (n_src);
+        ,
+        ne10_cabs2_float32_c (dst + itr, src + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cabs_float32_neon (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+#if defined(__aarch64__)
+    NE10_DstSrc_DO_COUNT_TIMES_CPX_REAL_NEON
+    (
+        FLOAT32,
+        n_dst = vsqrtq_f32 (ne10_cabs2_f32_neon (n_src));
+        ,
+        ne10_cabs_float32_c (dst + itr, src + itr, count - itr);
+    );
+#else
+    /* the square roots by estimates need the checks of ne10_sqrt_float_neon */
+    ne10_uint32_t b, n;
+
+    for (b = 0; b < count; b += n)
+    {
+        n = (count - b < NE10_CPX_BLOCK) ? count - b : NE10_CPX_BLOCK;
+        ne10_cabs2_float32_neon (dst + b, src + b, n);
+        ne10_sqrt_float_neon (dst + b, dst + b, n);
+    }
+    return NE10_OK;
+#endif
+}
+
+ne10_result_t ne10_cscale_float32_neon (ne10_fft_cpx_float32_t * dst,
+                                        ne10_fft_cpx_float32_t * src,
+                                        ne10_float32_t cst,
+                                        ne10_uint32_t count)
+{
+    NE10_DstSrcCst_DO_COUNT_TIMES_CPX_NEON
+    (
+        FLOAT32,
+        n_dst.val[0] = vmulq_f32 (n_src.val[0], n_cst);
+        n_dst.val[1] = vmulq_f32 (n_src.val[1], n_cst);
+        ,
+        ne10_cscale_float32_c (dst + itr, src + itr, cst, count - itr);
+    );
+}
+
+ne10_result_t ne10_cpolar_float32_neon (ne10_float32_t * mag,
+                                        ne10_float32_t * phase,
+                                        ne10_fft_cpx_float32_t * src,
+                                        ne10_uint32_t count)
+{
+    ne10_float32_t re[NE10_CPX_BLOCK];
+    ne10_float32_t im[NE10_CPX_BLOCK];
+    ne10_uint32_t b, i, n;
+
+    for (b = 0; b < count; b += n)
+    {
+        n = (count - b < NE10_CPX_BLOCK) ? count - b : NE10_CPX_BLOCK;
+        for (i = 0; i + 4 <= n; i += 4)
+        {
+            float32x4x2_t z = vld2q_f32 ( (ne10_float32_t *) (src + b + i));
+
+            vst1q_f32 (re + i, z.val[0]);
+            vst1q_f32 (im + i, z.val[1]);
+        }
+        for (; i < n; i++)
+        {
+            re[i] = src[b + i].r;
+            im[i] = src[b + i].i;
+        }
+        ne10_cabs_float32_neon (mag + b, src + b, n);
+        ne10_atan2_float_neon (phase + b, im, re, n);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_crect_float32_neon (ne10_fft_cpx_float32_t * dst,
+                                       ne10_float32_t * mag,
+                                       ne10_float32_t * phase,
+                                       ne10_uint32_t count)
+{
+    ne10_float32_t s[NE10_CPX_BLOCK];
+    ne10_float32_t c[NE10_CPX_BLOCK];
+    ne10_uint32_t b, i, n;
+
+    for (b = 0; b < count; b += n)
+    {
+        n = (count - b < NE10_CPX_BLOCK) ? count - b : NE10_CPX_BLOCK;
+        ne10_sincos_float_neon (s, c, phase + b, n);
+        for (i = 0; i + 4 <= n; i += 4)
+        {
+            float32x4_t m = vld1q_f32 (mag + b + i);
+            float32x4x2_t z;
+
+            z.val[0] = vmulq_f32 (m, vld1q_f32 (c + i));
+            z.val[1] = vmulq_f32 (m, vld1q_f32 (s + i));
+            vst2q_f32 ( (ne10_float32_t *) (dst + b + i), z);
+        }
+        for (; i < n; i++)
+        {
+            dst[b + i].r = mag[b + i] * c[i];
+            dst[b + i].i = mag[b + i] * s[i];
+        }
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cmul_int32_neon (ne10_fft_cpx_int32_t * dst,
+                                    ne10_fft_cpx_int32_t * src1,
+                                    ne10_fft_cpx_int32_t * src2,
+                                    ne10_uint32_t count)
+{
+    NE10_DstSrc1Src2_DO_COUNT_TIMES_CPX_NEON
+    (
+        INT32,
+        n_dst = ne10_cmul_s32_neon (n_src, n_src2);
+        ,
+        ne10_cmul_int32_c (dst + itr, src1 + itr, src2 + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cmul_conj_int32_neon (ne10_fft_cpx_int32_t * dst,
+        ne10_fft_cpx_int32_t * src1,
+        ne10_fft_cpx_int32_t * src2,
+        ne10_uint32_t count)
+{
+    NE10_DstSrc1Src2_DO_COUNT_TIMES_CPX_NEON
+    (
+        INT32,
+        n_dst = ne10_cmul_conj_s32_neon (n_src, n_src2);
+        ,
+        ne10_cmul_conj_int32_c (dst + itr, src1 + itr, src2 + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cmac_int32_neon (ne10_fft_cpx_int32_t * dst,
+                                    ne10_fft_cpx_int32_t * acc,
+                                    ne10_fft_cpx_int32_t * src1,
+                                    ne10_fft_cpx_int32_t * src2,
+                                    ne10_uint32_t count)
+{
+    NE10_DstAccSrc1Src2_DO_COUNT_TIMES_CPX_NEON
+    (
+        INT32,
+        n_dst = ne10_cmul_s32_neon (n_src, n_src2);
+        n_dst.val[0] = vqaddq_s32 (n_acc.val[0], n_dst.val[0]);
+        n_dst.val[1] = vqaddq_s32 (n_acc.val[1], n_dst.val[1]);
+        ,
+        ne10_cmac_int32_c (dst + itr, acc + itr, src1 + itr, src2 + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cabs2_int32_neon (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count)
+{
+    NE10_DstSrc_DO_COUNT_TIMES_CPX_REAL_NEON
+    (
+        INT32,
+        n_dst = vqaddq_s32 (vqdmulhq_s32 (n_src.val[0], n_src.val[0]), vqdmulhq_s32 (n_src.val[1], n_src.val[1]));
+        ,
+        ne10_cabs2_int32_c (dst + itr, src + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cscale_int32_neon (ne10_fft_cpx_int32_t * dst,
+                                      ne10_fft_cpx_int32_t * src,
+                                      ne10_int32_t cst,
+                                      ne10_uint32_t count)
+{
+    NE10_DstSrcCst_DO_COUNT_TIMES_CPX_NEON
+    (
+        INT32,
+        n_dst.val[0] = vqdmulhq_s32 (n_src.val[0], n_cst);
+        n_dst.val[1] = vqdmulhq_s32 (n_src.val[1], n_cst);
+        ,
+        ne10_cscale_int32_c (dst + itr, src + itr, cst, count - itr);
+    );
+}
+
+ne10_result_t ne10_cmul_int16_neon (ne10_fft_cpx_int16_t * dst,
+                                    ne10_fft_cpx_int16_t * src1,
+                                    ne10_fft_cpx_int16_t * src2,
+                                    ne10_uint32_t count)
+{
+    NE10_DstSrc1Src2_DO_COUNT_TIMES_CPX_NEON
+    (
+        INT16,
+        n_dst = ne10_cmul_s16_neon (n_src, n_src2);
+        ,
+        ne10_cmul_int16_c (dst + itr, src1 + itr, src2 + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cmul_conj_int16_neon (ne10_fft_cpx_int16_t * dst,
+        ne10_fft_cpx_int16_t * src1,
+        ne10_fft_cpx_int16_t * src2,
+        ne10_uint32_t count)
+{
+    NE10_DstSrc1Src2_DO_COUNT_TIMES_CPX_NEON
+    (
+        INT16,
+        n_dst = ne10_cmul_conj_s16_neon (n_src, n_src2);
+        ,
+        ne10_cmul_conj_int16_c (dst + itr, src1 + itr, src2 + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cmac_int16_neon (ne10_fft_cpx_int16_t * dst,
+                                    ne10_fft_cpx_int16_t * acc,
+                                    ne10_fft_cpx_int16_t * src1,
+                                    ne10_fft_cpx_int16_t * src2,
+                                    ne10_uint32_t count)
+{
+    NE10_DstAccSrc1Src2_DO_COUNT_TIMES_CPX_NEON
+    (
+        INT16,
+        n_dst = ne10_cmul_s16_neon (n_src, n_src2);
+        n_dst.val[0] = vqaddq_s16 (n_acc.val[0], n_dst.val[0]);
+        n_dst.val[1] = vqaddq_s16 (n_acc.val[1], n_dst.val[1]);
+        ,
+        ne10_cmac_int16_c (dst + itr, acc + itr, src1 + itr, src2 + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cabs2_int16_neon (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count)
+{
+    NE10_DstSrc_DO_COUNT_TIMES_CPX_REAL_NEON
+    (
+        INT16,
+        n_dst = vqaddq_s16 (vqdmulhq_s16 (n_src.val[0], n_src.val[0]), vqdmulhq_s16 (n_src.val[1], n_src.val[1]));
+        ,
+        ne10_cabs2_int16_c (dst + itr, src + itr, count - itr);
+    );
+}
+
+ne10_result_t ne10_cscale_int16_neon (ne10_fft_cpx_int16_t * dst,
+                                      ne10_fft_cpx_int16_t * src,
+                                      ne10_int16_t cst,
+                                      ne10_uint32_t count)
+{
+    NE10_DstSrcCst_DO_COUNT_TIMES_CPX_NEON
+    (
+        INT16,
+        n_dst.val[0] = vqdmulhq_s16 (n_src.val[0], n_cst);
+        n_dst.val[1] = vqdmulhq_s16 (n_src.val[1], n_cst);
+        ,
+        ne10_cscale_int16_c (dst + itr, src + itr, cst, count - itr);
+    );
+}
@@ -0,0 +1,62 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_cross.neonintrinsic.c
+ */
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+
+ne10_result_t ne10_cross_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t a = vld3q_f32 ( (ne10_float32_t*) (src1 + i));
+        float32x4x3_t b = vld3q_f32 ( (ne10_float32_t*) (src2 + i));
+        float32x4x3_t c;
+        c.val[0] = vsubq_f32 (vmulq_f32 (a.val[1], b.val[2]), vmulq_f32 (a.val[2], b.val[1]));
+        c.val[1] = vsubq_f32 (vmulq_f32 (a.val[2], b.val[0]), vmulq_f32 (a.val[0], b.val[2]));
+        c.val[2] = vsubq_f32 (vmulq_f32 (a.val[0], b.val[1]), vmulq_f32 (a.val[1], b.val[0]));
+        vst3q_f32 ( (ne10_float32_t*) (dst + i), c);
+    }
+    for (; i < count; i++)
+    {
+        ne10_vec3f_t a = src1[i];
+        ne10_vec3f_t b = src2[i];
+        dst[i].x = (a.y * b.z) - (a.z * b.y);
+        dst[i].y = (a.z * b.x) - (a.x * b.z);
+        dst[i].z = (a.x * b.y) - (a.y * b.x);
+    }
+    return NE10_OK;
+}
@@ -31,6 +31,7 @@
 
 #include "NE10_types.h"
 #include "macros.h"
+#include "NE10_math.neonintrinsic.h"
 
 #include <assert.h>
 #include <arm_neon.h>
@@ -43,16 +44,10 @@ ne10_result_t ne10_divc_float_neon (ne10_float32_t * dst, ne10_float32_t * src,
     NE10_DstSrcCst_DO_COUNT_TIMES_FLOAT_NEON
     (
         /* a single division operation */
-        float32x4_t rec = vrecpeq_f32 (n_cst);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst, rec), rec);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst, rec), rec);
-        n_dst = vmulq_f32 (n_src , rec);
+        n_dst = ne10_div_f32_neon (n_src, n_cst);
         ,
         /* a single division operation */
-        float32x2_t rec = vrecpe_f32 (n_rest_cst);
-        rec = vmul_f32 (vrecps_f32 (n_rest_cst, rec), rec);
-        rec = vmul_f32 (vrecps_f32 (n_rest_cst, rec), rec);
-        n_rest = vmul_f32 (n_rest, rec);
+        n_rest = ne10_div_f32x2_neon (n_rest, n_rest_cst);
     );
 }
 
@@ -61,16 +56,10 @@ ne10_result_t ne10_divc_vec2f_neon (ne10_vec2f_t * dst, ne10_vec2f_t * src, cons
     NE10_DstSrcCst_DO_COUNT_TIMES_VEC2F_NEON
     (
         /* a single division operation */
-        float32x4_t rec = vrecpeq_f32 (n_cst);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst, rec), rec);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst, rec), rec);
-        n_dst = vmulq_f32 (n_src , rec);
+        n_dst = ne10_div_f32_neon (n_src, n_cst);
         ,
         /* a single division operation */
-        float32x2_t rec = vrecpe_f32 (n_rest_cst);
-        rec = vmul_f32 (vrecps_f32 (n_rest_cst, rec), rec);
-        rec = vmul_f32 (vrecps_f32 (n_rest_cst, rec), rec);
-        n_rest = vmul_f32 (n_rest, rec);
+        n_rest = ne10_div_f32x2_neon (n_rest, n_rest_cst);
     );
 }
 
@@ -79,36 +68,14 @@ ne10_result_t ne10_divc_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * src, cons
     NE10_DstSrcCst_DO_COUNT_TIMES_VEC3F_NEON
     (
         /* three division operations */
-        float32x4_t rec = vrecpeq_f32 (n_cst1);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst1, rec), rec);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst1, rec), rec);
-        n_dst1 = vmulq_f32 (n_src1 , rec);
-
-        rec = vrecpeq_f32 (n_cst2);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst2, rec), rec);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst2, rec), rec);
-        n_dst2 = vmulq_f32 (n_src2 , rec);
-
-        rec = vrecpeq_f32 (n_cst3);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst3, rec), rec);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst3, rec), rec);
-        n_dst3 = vmulq_f32 (n_src3 , rec);
+        n_dst1 = ne10_div_f32_neon (n_src1, n_cst1);
+        n_dst2 = ne10_div_f32_neon (n_src2, n_cst2);
+        n_dst3 = ne10_div_f32_neon (n_src3, n_cst3);
         ,
         /* three division operations */
-        float32x2_t rec = vrecpe_f32 (n_rest_cst.val[0]);
-        rec = vmul_f32 (vrecps_f32 (n_rest_cst.val[0], rec), rec);
-        rec = vmul_f32 (vrecps_f32 (n_rest_cst.val[0], rec), rec);
-        n_rest.val[0] = vmul_f32 (n_rest.val[0] , rec);
-
-        rec = vrecpe_f32 (n_rest_cst.val[1]);
-        rec = vmul_f32 (vrecps_f32 (n_rest_cst.val[1], rec), rec);
-        rec = vmul_f32 (vrecps_f32 (n_rest_cst.val[1], rec), rec);
-        n_rest.val[1] = vmul_f32 (n_rest.val[1] , rec);
-
-        rec = vrecpe_f32 (n_rest_cst.val[2]);
-        rec = vmul_f32 (vrecps_f32 (n_rest_cst.val[2], rec), rec);
-        rec = vmul_f32 (vrecps_f32 (n_rest_cst.val[2], rec), rec);
-        n_rest.val[2] = vmul_f32 (n_rest.val[2] , rec);
+        n_rest.val[0] = ne10_div_f32x2_neon (n_rest.val[0], n_rest_cst.val[0]);
+        n_rest.val[1] = ne10_div_f32x2_neon (n_rest.val[1], n_rest_cst.val[1]);
+        n_rest.val[2] = ne10_div_f32x2_neon (n_rest.val[2], n_rest_cst.val[2]);
     );
 }
 
@@ -117,9 +84,6 @@ ne10_result_t ne10_divc_vec4f_neon (ne10_vec4f_t * dst, ne10_vec4f_t * src, cons
     NE10_DstSrcCst_DO_COUNT_TIMES_VEC4F_NEON
     (
         /* a single division operation */
-        float32x4_t rec = vrecpeq_f32 (n_cst);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst, rec), rec);
-        rec = vmulq_f32 (vrecpsq_f32 (n_cst, rec), rec);
-        n_dst = vmulq_f32 (n_src , rec);
+        n_dst = ne10_div_f32_neon (n_src, n_cst);
     );
 }
@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_identitymat.neonintrinsic.c
+ */
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+
+ne10_result_t ne10_identitymat_2x2f_neon (ne10_mat2x2f_t * dst, ne10_uint32_t count)
+{
+    static const ne10_float32_t identity[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+    float32x4_t m = vld1q_f32 (identity);
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        vst1q_f32 ( (ne10_float32_t*) (dst + i), m);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_identitymat_3x3f_neon (ne10_mat3x3f_t * dst, ne10_uint32_t count)
+{
+    /* four consecutive matrices are nine vectors */
+    static const ne10_float32_t identity[36] =
+    {
+        1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+        1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+        1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+        1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f
+    };
+    float32x4_t m[9];
+    ne10_uint32_t i;
+    ne10_int32_t k;
+
+    for (k = 0; k < 9; k++)
+    {
+        m[k] = vld1q_f32 (identity + 4 * k);
+    }
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        ne10_float32_t *d = (ne10_float32_t*) (dst + i);
+        for (k = 0; k < 9; k++)
+        {
+            vst1q_f32 (d + 4 * k, m[k]);
+        }
+    }
+    return ne10_identitymat_3x3f_c (dst + i, count - i);
+}
+
+ne10_result_t ne10_identitymat_4x4f_neon (ne10_mat4x4f_t * dst, ne10_uint32_t count)
+{
+    static const ne10_float32_t identity[16] =
+    {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    float32x4_t c1 = vld1q_f32 (identity);
+    float32x4_t c2 = vld1q_f32 (identity + 4);
+    float32x4_t c3 = vld1q_f32 (identity + 8);
+    float32x4_t c4 = vld1q_f32 (identity + 12);
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t *d = (ne10_float32_t*) (dst + i);
+        vst1q_f32 (d, c1);
+        vst1q_f32 (d + 4, c2);
+        vst1q_f32 (d + 8, c3);
+        vst1q_f32 (d + 12, c4);
+    }
+    return NE10_OK;
+}
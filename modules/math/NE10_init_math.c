@@ -28,9 +28,13 @@
 #include <stdio.h>
 
 #include "NE10_math.h"
+#if defined (NE10_ENABLE_X86)
+#include "NE10_init.h"
+#endif
 
 ne10_result_t ne10_init_math (int is_NEON_available)
 {
+#if !defined (NE10_ENABLE_X86)
     if (NE10_OK == is_NEON_available)
     {
         ne10_addc_float = ne10_addc_float_neon;
@@ -121,8 +125,86 @@ ne10_result_t ne10_init_math (int is_NEON_available)
         ne10_identitymat_3x3f = ne10_identitymat_3x3f_neon;
         ne10_transmat_2x2f = ne10_transmat_2x2f_neon;
         ne10_identitymat_2x2f = ne10_identitymat_2x2f_neon;
+        ne10_chain_float = ne10_chain_float_neon;
+        ne10_vec3f_aos_to_soa = ne10_vec3f_aos_to_soa_neon;
+        ne10_vec3f_soa_to_aos = ne10_vec3f_soa_to_aos_neon;
+        ne10_vec4f_aos_to_soa = ne10_vec4f_aos_to_soa_neon;
+        ne10_vec4f_soa_to_aos = ne10_vec4f_soa_to_aos_neon;
+        ne10_len_vec3f_soa = ne10_len_vec3f_soa_neon;
+        ne10_len_vec4f_soa = ne10_len_vec4f_soa_neon;
+        ne10_normalize_vec3f_soa = ne10_normalize_vec3f_soa_neon;
+        ne10_normalize_vec4f_soa = ne10_normalize_vec4f_soa_neon;
+        ne10_dot_vec3f_soa = ne10_dot_vec3f_soa_neon;
+        ne10_dot_vec4f_soa = ne10_dot_vec4f_soa_neon;
+        ne10_cross_vec3f_soa = ne10_cross_vec3f_soa_neon;
+        ne10_sgemm = ne10_sgemm_neon;
+        ne10_mulmat_3x3f_strided = ne10_mulmat_3x3f_strided_neon;
+        ne10_mulmat_3x3f_ptr = ne10_mulmat_3x3f_ptr_neon;
+        ne10_mulmat_4x4f_strided = ne10_mulmat_4x4f_strided_neon;
+        ne10_mulmat_4x4f_ptr = ne10_mulmat_4x4f_ptr_neon;
+        ne10_invmat_3x3f_strided = ne10_invmat_3x3f_strided_neon;
+        ne10_invmat_3x3f_ptr = ne10_invmat_3x3f_ptr_neon;
+        ne10_invmat_4x4f_strided = ne10_invmat_4x4f_strided_neon;
+        ne10_invmat_4x4f_ptr = ne10_invmat_4x4f_ptr_neon;
+        ne10_transmat_3x3f_strided = ne10_transmat_3x3f_strided_neon;
+        ne10_transmat_3x3f_ptr = ne10_transmat_3x3f_ptr_neon;
+        ne10_transmat_4x4f_strided = ne10_transmat_4x4f_strided_neon;
+        ne10_transmat_4x4f_ptr = ne10_transmat_4x4f_ptr_neon;
+        ne10_detmat_3x3f_strided = ne10_detmat_3x3f_strided_neon;
+        ne10_detmat_3x3f_ptr = ne10_detmat_3x3f_ptr_neon;
+        ne10_detmat_4x4f_strided = ne10_detmat_4x4f_strided_neon;
+        ne10_detmat_4x4f_ptr = ne10_detmat_4x4f_ptr_neon;
+        ne10_mulcmatvec_cm3x3f_v3f_strided = ne10_mulcmatvec_cm3x3f_v3f_strided_neon;
+        ne10_mulcmatvec_cm3x3f_v3f_ptr = ne10_mulcmatvec_cm3x3f_v3f_ptr_neon;
+        ne10_mulcmatvec_cm4x4f_v4f_strided = ne10_mulcmatvec_cm4x4f_v4f_strided_neon;
+        ne10_mulcmatvec_cm4x4f_v4f_ptr = ne10_mulcmatvec_cm4x4f_v4f_ptr_neon;
+        ne10_mul_quatf = ne10_mul_quatf_neon;
+        ne10_normalize_quatf = ne10_normalize_quatf_neon;
+        ne10_nlerp_quatf = ne10_nlerp_quatf_neon;
+        ne10_slerp_quatf = ne10_slerp_quatf_neon;
+        ne10_rotate_vec3f_quatf = ne10_rotate_vec3f_quatf_neon;
+        ne10_quatf_to_mat3x3f = ne10_quatf_to_mat3x3f_neon;
+        ne10_quatf_to_mat4x4f = ne10_quatf_to_mat4x4f_neon;
+        ne10_exp_float = ne10_exp_float_neon;
+        ne10_log_float = ne10_log_float_neon;
+        ne10_sincos_float = ne10_sincos_float_neon;
+        ne10_atan2_float = ne10_atan2_float_neon;
+        ne10_sqrt_float = ne10_sqrt_float_neon;
+        ne10_rsqrt_float = ne10_rsqrt_float_neon;
+        ne10_sum_float = ne10_sum_float_neon;
+        ne10_mean_float = ne10_mean_float_neon;
+        ne10_dotprod_float = ne10_dotprod_float_neon;
+        ne10_norm2_float = ne10_norm2_float_neon;
+        ne10_max_float = ne10_max_float_neon;
+        ne10_min_float = ne10_min_float_neon;
+        ne10_maxabs_float = ne10_maxabs_float_neon;
+        ne10_sum_int16 = ne10_sum_int16_neon;
+        ne10_sum_int32 = ne10_sum_int32_neon;
+        ne10_dotprod_int16 = ne10_dotprod_int16_neon;
+        ne10_dotprod_int32 = ne10_dotprod_int32_neon;
+        ne10_maxabs_int16 = ne10_maxabs_int16_neon;
+        ne10_maxabs_int32 = ne10_maxabs_int32_neon;
+        ne10_cmul_float32 = ne10_cmul_float32_neon;
+        ne10_cmul_conj_float32 = ne10_cmul_conj_float32_neon;
+        ne10_cmac_float32 = ne10_cmac_float32_neon;
+        ne10_cabs_float32 = ne10_cabs_float32_neon;
+        ne10_cabs2_float32 = ne10_cabs2_float32_neon;
+        ne10_cscale_float32 = ne10_cscale_float32_neon;
+        ne10_cpolar_float32 = ne10_cpolar_float32_neon;
+        ne10_crect_float32 = ne10_crect_float32_neon;
+        ne10_cmul_int32 = ne10_cmul_int32_neon;
+        ne10_cmul_conj_int32 = ne10_cmul_conj_int32_neon;
+        ne10_cmac_int32 = ne10_cmac_int32_neon;
+        ne10_cabs2_int32 = ne10_cabs2_int32_neon;
+        ne10_cscale_int32 = ne10_cscale_int32_neon;
+        ne10_cmul_int16 = ne10_cmul_int16_neon;
+        ne10_cmul_conj_int16 = ne10_cmul_conj_int16_neon;
+        ne10_cmac_int16 = ne10_cmac_int16_neon;
+        ne10_cabs2_int16 = ne10_cabs2_int16_neon;
+        ne10_cscale_int16 = ne10_cscale_int16_neon;
     }
     else
+#endif // NE10_ENABLE_X86
     {
         ne10_addc_float = ne10_addc_float_c;
         ne10_addc_vec2f = ne10_addc_vec2f_c;
@@ -212,7 +294,214 @@ ne10_result_t ne10_init_math (int is_NEON_available)
         ne10_identitymat_3x3f = ne10_identitymat_3x3f_c;
         ne10_transmat_2x2f = ne10_transmat_2x2f_c;
         ne10_identitymat_2x2f = ne10_identitymat_2x2f_c;
+        ne10_chain_float = ne10_chain_float_c;
+        ne10_vec3f_aos_to_soa = ne10_vec3f_aos_to_soa_c;
+        ne10_vec3f_soa_to_aos = ne10_vec3f_soa_to_aos_c;
+        ne10_vec4f_aos_to_soa = ne10_vec4f_aos_to_soa_c;
+        ne10_vec4f_soa_to_aos = ne10_vec4f_soa_to_aos_c;
+        ne10_len_vec3f_soa = ne10_len_vec3f_soa_c;
+        ne10_len_vec4f_soa = ne10_len_vec4f_soa_c;
+        ne10_normalize_vec3f_soa = ne10_normalize_vec3f_soa_c;
+        ne10_normalize_vec4f_soa = ne10_normalize_vec4f_soa_c;
+        ne10_dot_vec3f_soa = ne10_dot_vec3f_soa_c;
+        ne10_dot_vec4f_soa = ne10_dot_vec4f_soa_c;
+        ne10_cross_vec3f_soa = ne10_cross_vec3f_soa_c;
+        ne10_sgemm = ne10_sgemm_c;
+        ne10_mulmat_3x3f_strided = ne10_mulmat_3x3f_strided_c;
+        ne10_mulmat_3x3f_ptr = ne10_mulmat_3x3f_ptr_c;
+        ne10_mulmat_4x4f_strided = ne10_mulmat_4x4f_strided_c;
+        ne10_mulmat_4x4f_ptr = ne10_mulmat_4x4f_ptr_c;
+        ne10_invmat_3x3f_strided = ne10_invmat_3x3f_strided_c;
+        ne10_invmat_3x3f_ptr = ne10_invmat_3x3f_ptr_c;
+        ne10_invmat_4x4f_strided = ne10_invmat_4x4f_strided_c;
+        ne10_invmat_4x4f_ptr = ne10_invmat_4x4f_ptr_c;
+        ne10_transmat_3x3f_strided = ne10_transmat_3x3f_strided_c;
+        ne10_transmat_3x3f_ptr = ne10_transmat_3x3f_ptr_c;
+        ne10_transmat_4x4f_strided = ne10_transmat_4x4f_strided_c;
+        ne10_transmat_4x4f_ptr = ne10_transmat_4x4f_ptr_c;
+        ne10_detmat_3x3f_strided = ne10_detmat_3x3f_strided_c;
+        ne10_detmat_3x3f_ptr = ne10_detmat_3x3f_ptr_c;
+        ne10_detmat_4x4f_strided = ne10_detmat_4x4f_strided_c;
+        ne10_detmat_4x4f_ptr = ne10_detmat_4x4f_ptr_c;
+        ne10_mulcmatvec_cm3x3f_v3f_strided = ne10_mulcmatvec_cm3x3f_v3f_strided_c;
+        ne10_mulcmatvec_cm3x3f_v3f_ptr = ne10_mulcmatvec_cm3x3f_v3f_ptr_c;
+        ne10_mulcmatvec_cm4x4f_v4f_strided = ne10_mulcmatvec_cm4x4f_v4f_strided_c;
+        ne10_mulcmatvec_cm4x4f_v4f_ptr = ne10_mulcmatvec_cm4x4f_v4f_ptr_c;
+        ne10_mul_quatf = ne10_mul_quatf_c;
+        ne10_normalize_quatf = ne10_normalize_quatf_c;
+        ne10_nlerp_quatf = ne10_nlerp_quatf_c;
+        ne10_slerp_quatf = ne10_slerp_quatf_c;
+        ne10_rotate_vec3f_quatf = ne10_rotate_vec3f_quatf_c;
+        ne10_quatf_to_mat3x3f = ne10_quatf_to_mat3x3f_c;
+        ne10_quatf_to_mat4x4f = ne10_quatf_to_mat4x4f_c;
+        ne10_exp_float = ne10_exp_float_c;
+        ne10_log_float = ne10_log_float_c;
+        ne10_sincos_float = ne10_sincos_float_c;
+        ne10_atan2_float = ne10_atan2_float_c;
+        ne10_sqrt_float = ne10_sqrt_float_c;
+        ne10_rsqrt_float = ne10_rsqrt_float_c;
+        ne10_sum_float = ne10_sum_float_c;
+        ne10_mean_float = ne10_mean_float_c;
+        ne10_dotprod_float = ne10_dotprod_float_c;
+        ne10_norm2_float = ne10_norm2_float_c;
+        ne10_max_float = ne10_max_float_c;
+        ne10_min_float = ne10_min_float_c;
+        ne10_maxabs_float = ne10_maxabs_float_c;
+        ne10_sum_int16 = ne10_sum_int16_c;
+        ne10_sum_int32 = ne10_sum_int32_c;
+        ne10_dotprod_int16 = ne10_dotprod_int16_c;
+        ne10_dotprod_int32 = ne10_dotprod_int32_c;
+        ne10_maxabs_int16 = ne10_maxabs_int16_c;
+        ne10_maxabs_int32 = ne10_maxabs_int32_c;
+        ne10_cmul_float32 = ne10_cmul_float32_c;
+        ne10_cmul_conj_float32 = ne10_cmul_conj_float32_c;
+        ne10_cmac_float32 = ne10_cmac_float32_c;
+        ne10_cabs_float32 = ne10_cabs_float32_c;
+        ne10_cabs2_float32 = ne10_cabs2_float32_c;
+        ne10_cscale_float32 = ne10_cscale_float32_c;
+        ne10_cpolar_float32 = ne10_cpolar_float32_c;
+        ne10_crect_float32 = ne10_crect_float32_c;
+        ne10_cmul_int32 = ne10_cmul_int32_c;
+        ne10_cmul_conj_int32 = ne10_cmul_conj_int32_c;
+        ne10_cmac_int32 = ne10_cmac_int32_c;
+        ne10_cabs2_int32 = ne10_cabs2_int32_c;
+        ne10_cscale_int32 = ne10_cscale_int32_c;
+        ne10_cmul_int16 = ne10_cmul_int16_c;
+        ne10_cmul_conj_int16 = ne10_cmul_conj_int16_c;
+        ne10_cmac_int16 = ne10_cmac_int16_c;
+        ne10_cabs2_int16 = ne10_cabs2_int16_c;
+        ne10_cscale_int16 = ne10_cscale_int16_c;
     }
+#if defined (NE10_ENABLE_X86)
+    // The element-wise vector operations, the fused chain, the SoA operations,
+    // SGEMM, the transcendental functions, the float reductions and the float
+    // complex-array functions have SSE4.1 and AVX2 versions
+    if (NE10_OK == ne10_HasAVX2 ())
+    {
+        ne10_add_float = ne10_add_float_avx2;
+        ne10_add_vec2f = ne10_add_vec2f_avx2;
+        ne10_add_vec3f = ne10_add_vec3f_avx2;
+        ne10_add_vec4f = ne10_add_vec4f_avx2;
+        ne10_sub_float = ne10_sub_float_avx2;
+        ne10_sub_vec2f = ne10_sub_vec2f_avx2;
+        ne10_sub_vec3f = ne10_sub_vec3f_avx2;
+        ne10_sub_vec4f = ne10_sub_vec4f_avx2;
+        ne10_mul_float = ne10_mul_float_avx2;
+        ne10_vmul_vec2f = ne10_vmul_vec2f_avx2;
+        ne10_vmul_vec3f = ne10_vmul_vec3f_avx2;
+        ne10_vmul_vec4f = ne10_vmul_vec4f_avx2;
+        ne10_mla_float = ne10_mla_float_avx2;
+        ne10_vmla_vec2f = ne10_vmla_vec2f_avx2;
+        ne10_vmla_vec3f = ne10_vmla_vec3f_avx2;
+        ne10_vmla_vec4f = ne10_vmla_vec4f_avx2;
+        ne10_div_float = ne10_div_float_avx2;
+        ne10_vdiv_vec2f = ne10_vdiv_vec2f_avx2;
+        ne10_vdiv_vec3f = ne10_vdiv_vec3f_avx2;
+        ne10_vdiv_vec4f = ne10_vdiv_vec4f_avx2;
+        ne10_abs_float = ne10_abs_float_avx2;
+        ne10_abs_vec2f = ne10_abs_vec2f_avx2;
+        ne10_abs_vec3f = ne10_abs_vec3f_avx2;
+        ne10_abs_vec4f = ne10_abs_vec4f_avx2;
+        ne10_chain_float = ne10_chain_float_avx2;
+        ne10_vec3f_aos_to_soa = ne10_vec3f_aos_to_soa_avx2;
+        ne10_vec3f_soa_to_aos = ne10_vec3f_soa_to_aos_avx2;
+        ne10_vec4f_aos_to_soa = ne10_vec4f_aos_to_soa_avx2;
+        ne10_vec4f_soa_to_aos = ne10_vec4f_soa_to_aos_avx2;
+        ne10_len_vec3f_soa = ne10_len_vec3f_soa_avx2;
+        ne10_len_vec4f_soa = ne10_len_vec4f_soa_avx2;
+        ne10_normalize_vec3f_soa = ne10_normalize_vec3f_soa_avx2;
+        ne10_normalize_vec4f_soa = ne10_normalize_vec4f_soa_avx2;
+        ne10_dot_vec3f_soa = ne10_dot_vec3f_soa_avx2;
+        ne10_dot_vec4f_soa = ne10_dot_vec4f_soa_avx2;
+        ne10_cross_vec3f_soa = ne10_cross_vec3f_soa_avx2;
+        ne10_sgemm = ne10_sgemm_avx2;
+        ne10_exp_float = ne10_exp_float_avx2;
+        ne10_log_float = ne10_log_float_avx2;
+        ne10_sincos_float = ne10_sincos_float_avx2;
+        ne10_atan2_float = ne10_atan2_float_avx2;
+        ne10_sqrt_float = ne10_sqrt_float_avx2;
+        ne10_rsqrt_float = ne10_rsqrt_float_avx2;
+        ne10_sum_float = ne10_sum_float_avx2;
+        ne10_mean_float = ne10_mean_float_avx2;
+        ne10_dotprod_float = ne10_dotprod_float_avx2;
+        ne10_norm2_float = ne10_norm2_float_avx2;
+        ne10_max_float = ne10_max_float_avx2;
+        ne10_min_float = ne10_min_float_avx2;
+        ne10_maxabs_float = ne10_maxabs_float_avx2;
+        ne10_cmul_float32 = ne10_cmul_float32_avx2;
+        ne10_cmul_conj_float32 = ne10_cmul_conj_float32_avx2;
+        ne10_cmac_float32 = ne10_cmac_float32_avx2;
+        ne10_cabs_float32 = ne10_cabs_float32_avx2;
+        ne10_cabs2_float32 = ne10_cabs2_float32_avx2;
+        ne10_cscale_float32 = ne10_cscale_float32_avx2;
+        ne10_cpolar_float32 = ne10_cpolar_float32_avx2;
+        ne10_crect_float32 = ne10_crect_float32_avx2;
+    }
+    else if (NE10_OK == ne10_HasSSE41 ())
+    {
+        ne10_add_float = ne10_add_float_sse;
+        ne10_add_vec2f = ne10_add_vec2f_sse;
+        ne10_add_vec3f = ne10_add_vec3f_sse;
+        ne10_add_vec4f = ne10_add_vec4f_sse;
+        ne10_sub_float = ne10_sub_float_sse;
+        ne10_sub_vec2f = ne10_sub_vec2f_sse;
+        ne10_sub_vec3f = ne10_sub_vec3f_sse;
+        ne10_sub_vec4f = ne10_sub_vec4f_sse;
+        ne10_mul_float = ne10_mul_float_sse;
+        ne10_vmul_vec2f = ne10_vmul_vec2f_sse;
+        ne10_vmul_vec3f = ne10_vmul_vec3f_sse;
+        ne10_vmul_vec4f = ne10_vmul_vec4f_sse;
+        ne10_mla_float = ne10_mla_float_sse;
+        ne10_vmla_vec2f = ne10_vmla_vec2f_sse;
+        ne10_vmla_vec3f = ne10_vmla_vec3f_sse;
+        ne10_vmla_vec4f = ne10_vmla_vec4f_sse;
+        ne10_div_float = ne10_div_float_sse;
+        ne10_vdiv_vec2f = ne10_vdiv_vec2f_sse;
+        ne10_vdiv_vec3f = ne10_vdiv_vec3f_sse;
+        ne10_vdiv_vec4f = ne10_vdiv_vec4f_sse;
+        ne10_abs_float = ne10_abs_float_sse;
+        ne10_abs_vec2f = ne10_abs_vec2f_sse;
+        ne10_abs_vec3f = ne10_abs_vec3f_sse;
+        ne10_abs_vec4f = ne10_abs_vec4f_sse;
+        ne10_chain_float = ne10_chain_float_sse;
+        ne10_vec3f_aos_to_soa = ne10_vec3f_aos_to_soa_sse;
+        ne10_vec3f_soa_to_aos = ne10_vec3f_soa_to_aos_sse;
+        ne10_vec4f_aos_to_soa = ne10_vec4f_aos_to_soa_sse;
+        ne10_vec4f_soa_to_aos = ne10_vec4f_soa_to_aos_sse;
+        ne10_len_vec3f_soa = ne10_len_vec3f_soa_sse;
+        ne10_len_vec4f_soa = ne10_len_vec4f_soa_sse;
+        ne10_normalize_vec3f_soa = ne10_normalize_vec3f_soa_sse;
+        ne10_normalize_vec4f_soa = ne10_normalize_vec4f_soa_sse;
+        ne10_dot_vec3f_soa = ne10_dot_vec3f_soa_sse;
+        ne10_dot_vec4f_soa = ne10_dot_vec4f_soa_sse;
+        ne10_cross_vec3f_soa = ne10_cross_vec3f_soa_sse;
+        ne10_sgemm = ne10_sgemm_sse;
+        ne10_exp_float = ne10_exp_float_sse;
+        ne10_log_float = ne10_log_float_sse;
+        ne10_sincos_float = ne10_sincos_float_sse;
+        ne10_atan2_float = ne10_atan2_float_sse;
+        ne10_sqrt_float = ne10_sqrt_float_sse;
+        ne10_rsqrt_float = ne10_rsqrt_float_sse;
+        ne10_sum_float = ne10_sum_float_sse;
+        ne10_mean_float = ne10_mean_float_sse;
+        ne10_dotprod_float = ne10_dotprod_float_sse;
+        ne10_norm2_float = ne10_norm2_float_sse;
+        ne10_max_float = ne10_max_float_sse;
+        ne10_min_float = ne10_min_float_sse;
+        ne10_maxabs_float = ne10_maxabs_float_sse;
+        ne10_cmul_float32 = ne10_cmul_float32_sse;
+        ne10_cmul_conj_float32 = ne10_cmul_conj_float32_sse;
+        ne10_cmac_float32 = ne10_cmac_float32_sse;
+        ne10_cabs_float32 = ne10_cabs_float32_sse;
+        ne10_cabs2_float32 = ne10_cabs2_float32_sse;
+        ne10_cscale_float32 = ne10_cscale_float32_sse;
+        ne10_cpolar_float32 = ne10_cpolar_float32_sse;
+        ne10_crect_float32 = ne10_crect_float32_sse;
+    }
+#endif // NE10_ENABLE_X86
+#if defined (NE10_ENABLE_TRACE)
+    ne10_trace_wrap_math ();
+#endif
     return NE10_OK;
 }
 
@@ -305,3 +594,80 @@ ne10_result_t (*ne10_transmat_3x3f) (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src,
 ne10_result_t (*ne10_identitymat_3x3f) (ne10_mat3x3f_t * dst, ne10_uint32_t count);
 ne10_result_t (*ne10_transmat_2x2f) (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count);
 ne10_result_t (*ne10_identitymat_2x2f) (ne10_mat2x2f_t * dst, ne10_uint32_t count);
+ne10_result_t (*ne10_chain_float) (ne10_float32_t * dst, ne10_float32_t * src, const ne10_chain_op_t * ops, ne10_uint32_t op_count, ne10_uint32_t count);
+ne10_result_t (*ne10_vec3f_aos_to_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_vec3f_soa_to_aos) (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_vec4f_aos_to_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_vec4f_soa_to_aos) (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_len_vec3f_soa) (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_len_vec4f_soa) (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_normalize_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_normalize_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_dot_vec3f_soa) (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_dot_vec4f_soa) (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cross_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_sgemm) (ne10_transpose_t trans_a, ne10_transpose_t trans_b, ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k, ne10_float32_t alpha, const ne10_float32_t * a, ne10_uint32_t lda, const ne10_float32_t * b, ne10_uint32_t ldb, ne10_float32_t beta, ne10_float32_t * c, ne10_uint32_t ldc);
+ne10_result_t (*ne10_mulmat_3x3f_strided) (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src1, ne10_uint32_t src1_stride, ne10_mat3x3f_t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count);
+ne10_result_t (*ne10_mulmat_3x3f_ptr) (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src1, ne10_mat3x3f_t ** src2, ne10_uint32_t count);
+ne10_result_t (*ne10_mulmat_4x4f_strided) (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src1, ne10_uint32_t src1_stride, ne10_mat4x4f_t * src2, ne10_uint32_t src2_stride, ne10_uint32_t count);
+ne10_result_t (*ne10_mulmat_4x4f_ptr) (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src1, ne10_mat4x4f_t ** src2, ne10_uint32_t count);
+ne10_result_t (*ne10_invmat_3x3f_strided) (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+ne10_result_t (*ne10_invmat_3x3f_ptr) (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+ne10_result_t (*ne10_invmat_4x4f_strided) (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+ne10_result_t (*ne10_invmat_4x4f_ptr) (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+ne10_result_t (*ne10_transmat_3x3f_strided) (ne10_mat3x3f_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+ne10_result_t (*ne10_transmat_3x3f_ptr) (ne10_mat3x3f_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+ne10_result_t (*ne10_transmat_4x4f_strided) (ne10_mat4x4f_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+ne10_result_t (*ne10_transmat_4x4f_ptr) (ne10_mat4x4f_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+ne10_result_t (*ne10_detmat_3x3f_strided) (ne10_float32_t * dst, ne10_uint32_t dst_stride, ne10_mat3x3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+ne10_result_t (*ne10_detmat_3x3f_ptr) (ne10_float32_t ** dst, ne10_mat3x3f_t ** src, ne10_uint32_t count);
+ne10_result_t (*ne10_detmat_4x4f_strided) (ne10_float32_t * dst, ne10_uint32_t dst_stride, ne10_mat4x4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+ne10_result_t (*ne10_detmat_4x4f_ptr) (ne10_float32_t ** dst, ne10_mat4x4f_t ** src, ne10_uint32_t count);
+ne10_result_t (*ne10_mulcmatvec_cm3x3f_v3f_strided) (ne10_vec3f_t * dst, ne10_uint32_t dst_stride, const ne10_mat3x3f_t * cst, ne10_vec3f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+ne10_result_t (*ne10_mulcmatvec_cm3x3f_v3f_ptr) (ne10_vec3f_t ** dst, const ne10_mat3x3f_t * cst, ne10_vec3f_t ** src, ne10_uint32_t count);
+ne10_result_t (*ne10_mulcmatvec_cm4x4f_v4f_strided) (ne10_vec4f_t * dst, ne10_uint32_t dst_stride, const ne10_mat4x4f_t * cst, ne10_vec4f_t * src, ne10_uint32_t src_stride, ne10_uint32_t count);
+ne10_result_t (*ne10_mulcmatvec_cm4x4f_v4f_ptr) (ne10_vec4f_t ** dst, const ne10_mat4x4f_t * cst, ne10_vec4f_t ** src, ne10_uint32_t count);
+ne10_result_t (*ne10_mul_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_normalize_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_nlerp_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count);
+ne10_result_t (*ne10_slerp_quatf) (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count);
+ne10_result_t (*ne10_rotate_vec3f_quatf) (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_quatf_to_mat3x3f) (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_quatf_to_mat4x4f) (ne10_mat4x4f_t * dst, ne10_quatf_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_exp_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_log_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_sincos_float) (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_atan2_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_sqrt_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_rsqrt_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_sum_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_mean_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_dotprod_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_norm2_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_max_float) (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_min_float) (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_maxabs_float) (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_sum_int16) (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_sum_int32) (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_dotprod_int16) (ne10_int64_t * dst, ne10_int16_t * src1, ne10_int16_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_dotprod_int32) (ne10_int64_t * dst, ne10_int32_t * src1, ne10_int32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_maxabs_int16) (ne10_int16_t * dst, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_maxabs_int32) (ne10_int32_t * dst, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cmul_float32) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cmul_conj_float32) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cmac_float32) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * acc, ne10_fft_cpx_float32_t * src1, ne10_fft_cpx_float32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cabs_float32) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cabs2_float32) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cscale_float32) (ne10_fft_cpx_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_float32_t cst, ne10_uint32_t count);
+ne10_result_t (*ne10_cpolar_float32) (ne10_float32_t * mag, ne10_float32_t * phase, ne10_fft_cpx_float32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_crect_float32) (ne10_fft_cpx_float32_t * dst, ne10_float32_t * mag, ne10_float32_t * phase, ne10_uint32_t count);
+ne10_result_t (*ne10_cmul_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cmul_conj_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cmac_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * acc, ne10_fft_cpx_int32_t * src1, ne10_fft_cpx_int32_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cabs2_int32) (ne10_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cscale_int32) (ne10_fft_cpx_int32_t * dst, ne10_fft_cpx_int32_t * src, ne10_int32_t cst, ne10_uint32_t count);
+ne10_result_t (*ne10_cmul_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cmul_conj_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cmac_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * acc, ne10_fft_cpx_int16_t * src1, ne10_fft_cpx_int16_t * src2, ne10_uint32_t count);
+ne10_result_t (*ne10_cabs2_int16) (ne10_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_uint32_t count);
+ne10_result_t (*ne10_cscale_int16) (ne10_fft_cpx_int16_t * dst, ne10_fft_cpx_int16_t * src, ne10_int16_t cst, ne10_uint32_t count);
@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_invmat.neonintrinsic.c
+ */
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_math.neonintrinsic.h"
+
+/* four matrices are inverted at once, one per lane */
+ne10_result_t ne10_invmat_2x2f_neon (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t m = vld4q_f32 ( (ne10_float32_t*) (src + i));
+        float32x4_t rdet = ne10_invmat_rdet_neon (ne10_det2x2f_neon (m.val[0], m.val[1], m.val[2], m.val[3]));
+        float32x4_t ndet = vnegq_f32 (rdet);
+        float32x4x4_t d;
+        d.val[0] = vmulq_f32 (rdet, m.val[3]);
+        d.val[1] = vmulq_f32 (ndet, m.val[1]);
+        d.val[2] = vmulq_f32 (ndet, m.val[2]);
+        d.val[3] = vmulq_f32 (rdet, m.val[0]);
+        vst4q_f32 ( (ne10_float32_t*) (dst + i), d);
+    }
+    return ne10_invmat_2x2f_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_invmat_3x3f_neon (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[9], d[9];
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        ne10_load_3x3f_soa_neon (src + i, m);
+        ne10_invmat_3x3f_soa_neon (d, m);
+        ne10_store_3x3f_soa_neon (dst + i, d);
+    }
+    return ne10_invmat_3x3f_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_invmat_4x4f_neon (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[16], d[16];
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        ne10_load_4x4f_soa_neon (src + i, m);
+        ne10_invmat_4x4f_soa_neon (d, m);
+        ne10_store_4x4f_soa_neon (dst + i, d);
+    }
+    return ne10_invmat_4x4f_c (dst + i, src + i, count - i);
+}
@@ -0,0 +1,390 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_math.neonintrinsic.h
+ */
+
+#ifndef NE10_MATH_NEONINTRINSIC_H
+#define NE10_MATH_NEONINTRINSIC_H
+
+#include <arm_neon.h>
+
+#include "NE10_types.h"
+
+/*
+ * Helpers shared by the intrinsic implementations of the math functions.
+ *
+ * The arithmetic is written with separate multiplies and adds, in the same
+ * order as the C versions, so that the results match them bit for bit where
+ * the hardware allows it: AArch64 has IEEE division and square root, while
+ * ARMv7 NEON only has estimates that are refined by two Newton-Raphson steps.
+ */
+
+static inline float32x4_t ne10_div_f32_neon (float32x4_t a, float32x4_t b)
+{
+#if defined(__aarch64__)
+    return vdivq_f32 (a, b);
+#else
+    float32x4_t r = vrecpeq_f32 (b);
+    r = vmulq_f32 (r, vrecpsq_f32 (b, r));
+    r = vmulq_f32 (r, vrecpsq_f32 (b, r));
+    return vmulq_f32 (a, r);
+#endif
+}
+
+static inline float32x2_t ne10_div_f32x2_neon (float32x2_t a, float32x2_t b)
+{
+#if defined(__aarch64__)
+    return vdiv_f32 (a, b);
+#else
+    float32x2_t r = vrecpe_f32 (b);
+    r = vmul_f32 (r, vrecps_f32 (b, r));
+    r = vmul_f32 (r, vrecps_f32 (b, r));
+    return vmul_f32 (a, r);
+#endif
+}
+
+static inline float32x4_t ne10_sqrt_f32_neon (float32x4_t x)
+{
+#if defined(__aarch64__)
+    return vsqrtq_f32 (x);
+#else
+    /* sqrt (x) = x / sqrt (x); the estimate of 1 / sqrt (0) is infinite */
+    float32x4_t r = vrsqrteq_f32 (x);
+    uint32x4_t zero = vceqq_f32 (x, vdupq_n_f32 (0.0f));
+    r = vmulq_f32 (r, vrsqrtsq_f32 (vmulq_f32 (x, r), r));
+    r = vmulq_f32 (r, vrsqrtsq_f32 (vmulq_f32 (x, r), r));
+    return vbslq_f32 (zero, x, vmulq_f32 (x, r));
+#endif
+}
+
+/* transposes the 4x4 matrix whose rows (or columns) are r0 .. r3, in place */
+#define NE10_TRANSPOSE_4x4F_NEON(r0, r1, r2, r3) do { \
+    float32x4x2_t t01 = vtrnq_f32 (r0, r1); \
+    float32x4x2_t t23 = vtrnq_f32 (r2, r3); \
+    r0 = vcombine_f32 (vget_low_f32 (t01.val[0]), vget_low_f32 (t23.val[0])); \
+    r1 = vcombine_f32 (vget_low_f32 (t01.val[1]), vget_low_f32 (t23.val[1])); \
+    r2 = vcombine_f32 (vget_high_f32 (t01.val[0]), vget_high_f32 (t23.val[0])); \
+    r3 = vcombine_f32 (vget_high_f32 (t01.val[1]), vget_high_f32 (t23.val[1])); \
+} while (0)
+
+/*
+ * Determinants of four matrices at once, one per lane. The arguments are the
+ * elements in column-major order, as in DET2x2 and DET3x3 of NE10_detmat.c.h.
+ */
+static inline float32x4_t ne10_det2x2f_neon (float32x4_t m11, float32x4_t m21,
+        float32x4_t m12, float32x4_t m22)
+{
+    return vsubq_f32 (vmulq_f32 (m11, m22), vmulq_f32 (m12, m21));
+}
+
+static inline float32x4_t ne10_det3x3f_neon (float32x4_t m11, float32x4_t m21, float32x4_t m31,
+        float32x4_t m12, float32x4_t m22, float32x4_t m32,
+        float32x4_t m13, float32x4_t m23, float32x4_t m33)
+{
+    float32x4_t d = vmulq_f32 (m11, ne10_det2x2f_neon (m22, m32, m23, m33));
+    d = vsubq_f32 (d, vmulq_f32 (m12, ne10_det2x2f_neon (m21, m31, m23, m33)));
+    return vaddq_f32 (d, vmulq_f32 (m13, ne10_det2x2f_neon (m21, m31, m22, m32)));
+}
+
+/* element e of p[0] .. p[3], one per lane, and back */
+static inline float32x4_t ne10_gather_lane_f32_neon (const ne10_float32_t * const * p, ne10_int32_t e)
+{
+    float32x4_t v = vld1q_dup_f32 (p[0] + e);
+    v = vld1q_lane_f32 (p[1] + e, v, 1);
+    v = vld1q_lane_f32 (p[2] + e, v, 2);
+    return vld1q_lane_f32 (p[3] + e, v, 3);
+}
+
+static inline void ne10_scatter_lane_f32_neon (ne10_float32_t * const * p, ne10_int32_t e, float32x4_t v)
+{
+    vst1q_lane_f32 (p[0] + e, v, 0);
+    vst1q_lane_f32 (p[1] + e, v, 1);
+    vst1q_lane_f32 (p[2] + e, v, 2);
+    vst1q_lane_f32 (p[3] + e, v, 3);
+}
+
+/*
+ * Structure-of-arrays access to four matrices: m[c * n + r] holds element
+ * (r, c) of the matrices p[0] .. p[3], one per lane. The gathers and scatters
+ * take one pointer per matrix, so the matrices need not be adjacent; the
+ * load and store variants are for four consecutive matrices.
+ */
+static inline void ne10_gather_4x4f_soa_neon (const ne10_float32_t * const * p, float32x4_t * m)
+{
+    ne10_int32_t c;
+
+    for (c = 0; c < 4; c++)
+    {
+        float32x4_t r0 = vld1q_f32 (p[0] + 4 * c);
+        float32x4_t r1 = vld1q_f32 (p[1] + 4 * c);
+        float32x4_t r2 = vld1q_f32 (p[2] + 4 * c);
+        float32x4_t r3 = vld1q_f32 (p[3] + 4 * c);
+        NE10_TRANSPOSE_4x4F_NEON (r0, r1, r2, r3);
+        m[4 * c] = r0;
+        m[4 * c + 1] = r1;
+        m[4 * c + 2] = r2;
+        m[4 * c + 3] = r3;
+    }
+}
+
+static inline void ne10_scatter_4x4f_soa_neon (ne10_float32_t * const * p, const float32x4_t * m)
+{
+    ne10_int32_t c;
+
+    for (c = 0; c < 4; c++)
+    {
+        float32x4_t r0 = m[4 * c];
+        float32x4_t r1 = m[4 * c + 1];
+        float32x4_t r2 = m[4 * c + 2];
+        float32x4_t r3 = m[4 * c + 3];
+        NE10_TRANSPOSE_4x4F_NEON (r0, r1, r2, r3);
+        vst1q_f32 (p[0] + 4 * c, r0);
+        vst1q_f32 (p[1] + 4 * c, r1);
+        vst1q_f32 (p[2] + 4 * c, r2);
+        vst1q_f32 (p[3] + 4 * c, r3);
+    }
+}
+
+/* the first eight elements go through two transposes, the ninth lane by lane */
+static inline void ne10_gather_3x3f_soa_neon (const ne10_float32_t * const * p, float32x4_t * m)
+{
+    ne10_int32_t c;
+
+    for (c = 0; c < 2; c++)
+    {
+        float32x4_t r0 = vld1q_f32 (p[0] + 4 * c);
+        float32x4_t r1 = vld1q_f32 (p[1] + 4 * c);
+        float32x4_t r2 = vld1q_f32 (p[2] + 4 * c);
+        float32x4_t r3 = vld1q_f32 (p[3] + 4 * c);
+        NE10_TRANSPOSE_4x4F_NEON (r0, r1, r2, r3);
+        m[4 * c] = r0;
+        m[4 * c + 1] = r1;
+        m[4 * c + 2] = r2;
+        m[4 * c + 3] = r3;
+    }
+    m[8] = ne10_gather_lane_f32_neon (p, 8);
+}
+
+static inline void ne10_scatter_3x3f_soa_neon (ne10_float32_t * const * p, const float32x4_t * m)
+{
+    ne10_int32_t c;
+
+    for (c = 0; c < 2; c++)
+    {
+        float32x4_t r0 = m[4 * c];
+        float32x4_t r1 = m[4 * c + 1];
+        float32x4_t r2 = m[4 * c + 2];
+        float32x4_t r3 = m[4 * c + 3];
+        NE10_TRANSPOSE_4x4F_NEON (r0, r1, r2, r3);
+        vst1q_f32 (p[0] + 4 * c, r0);
+        vst1q_f32 (p[1] + 4 * c, r1);
+        vst1q_f32 (p[2] + 4 * c, r2);
+        vst1q_f32 (p[3] + 4 * c, r3);
+    }
+    ne10_scatter_lane_f32_neon (p, 8, m[8]);
+}
+
+static inline void ne10_load_4x4f_soa_neon (const ne10_mat4x4f_t * src, float32x4_t * m)
+{
+    const ne10_float32_t *p[4];
+    ne10_int32_t i;
+
+    for (i = 0; i < 4; i++)
+        p[i] = (const ne10_float32_t*) &src[i];
+    ne10_gather_4x4f_soa_neon (p, m);
+}
+
+static inline void ne10_store_4x4f_soa_neon (ne10_mat4x4f_t * dst, const float32x4_t * m)
+{
+    ne10_float32_t *p[4];
+    ne10_int32_t i;
+
+    for (i = 0; i < 4; i++)
+        p[i] = (ne10_float32_t*) &dst[i];
+    ne10_scatter_4x4f_soa_neon (p, m);
+}
+
+static inline void ne10_load_3x3f_soa_neon (const ne10_mat3x3f_t * src, float32x4_t * m)
+{
+    const ne10_float32_t *p[4];
+    ne10_int32_t i;
+
+    for (i = 0; i < 4; i++)
+        p[i] = (const ne10_float32_t*) &src[i];
+    ne10_gather_3x3f_soa_neon (p, m);
+}
+
+static inline void ne10_store_3x3f_soa_neon (ne10_mat3x3f_t * dst, const float32x4_t * m)
+{
+    ne10_float32_t *p[4];
+    ne10_int32_t i;
+
+    for (i = 0; i < 4; i++)
+        p[i] = (ne10_float32_t*) &dst[i];
+    ne10_scatter_3x3f_soa_neon (p, m);
+}
+
+/*
+ * Matrix kernels on the structure-of-arrays form above, with the operation
+ * order of the C versions so that the results match them bit for bit.
+ */
+static inline void ne10_mulmat_nxnf_soa_neon (float32x4_t * d, const float32x4_t * a,
+        const float32x4_t * b, ne10_int32_t n)
+{
+    ne10_int32_t r, c, k;
+
+    for (c = 0; c < n; c++)
+    {
+        for (r = 0; r < n; r++)
+        {
+            float32x4_t acc = vmulq_f32 (a[r], b[c * n]);
+            for (k = 1; k < n; k++)
+                acc = vaddq_f32 (acc, vmulq_f32 (a[k * n + r], b[c * n + k]));
+            d[c * n + r] = acc;
+        }
+    }
+}
+
+static inline void ne10_transmat_nxnf_soa_neon (float32x4_t * d, const float32x4_t * m, ne10_int32_t n)
+{
+    ne10_int32_t r, c;
+
+    for (c = 0; c < n; c++)
+        for (r = 0; r < n; r++)
+            d[c * n + r] = m[r * n + c];
+}
+
+static inline float32x4_t ne10_detmat_3x3f_soa_neon (const float32x4_t * m)
+{
+    return ne10_det3x3f_neon (m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]);
+}
+
+/* first row expansion, as DET4x4 */
+static inline float32x4_t ne10_detmat_4x4f_soa_neon (const float32x4_t * m)
+{
+    float32x4_t det;
+
+    det = vmulq_f32 (m[0], ne10_det3x3f_neon (m[5], m[6], m[7], m[9], m[10], m[11], m[13], m[14], m[15]));
+    det = vsubq_f32 (det, vmulq_f32 (m[4], ne10_det3x3f_neon (m[1], m[2], m[3], m[9], m[10], m[11], m[13], m[14], m[15])));
+    det = vaddq_f32 (det, vmulq_f32 (m[8], ne10_det3x3f_neon (m[1], m[2], m[3], m[5], m[6], m[7], m[13], m[14], m[15])));
+    det = vsubq_f32 (det, vmulq_f32 (m[12], ne10_det3x3f_neon (m[1], m[2], m[3], m[5], m[6], m[7], m[9], m[10], m[11])));
+    return det;
+}
+
+/* 1 / det, with the C versions' substitution of 1 for a determinant close to 0 */
+static inline float32x4_t ne10_invmat_rdet_neon (float32x4_t det)
+{
+    uint32x4_t tiny = vcltq_f32 (vabsq_f32 (det), vdupq_n_f32 (1e-12f));
+    det = vbslq_f32 (tiny, vdupq_n_f32 (1.0f), det);
+    return ne10_div_f32_neon (vdupq_n_f32 (1.0f), det);
+}
+
+/*
+ * Inverses by the cofactor expansion of the C versions: element (r, c) of the
+ * inverse is (-1)^(r + c) times the minor of element (c, r) of the source,
+ * over the determinant. The tables list the source elements of each minor, in
+ * the column-major order of the result.
+ */
+static inline void ne10_invmat_3x3f_soa_neon (float32x4_t * d, const float32x4_t * m)
+{
+    static const ne10_uint8_t minor[9][4] =
+    {
+        { 4,  5,  7,  8},
+        { 1,  2,  7,  8},
+        { 1,  2,  4,  5},
+        { 3,  5,  6,  8},
+        { 0,  2,  6,  8},
+        { 0,  2,  3,  5},
+        { 3,  4,  6,  7},
+        { 0,  1,  6,  7},
+        { 0,  1,  3,  4}
+    };
+    float32x4_t det, rdet, ndet;
+    ne10_int32_t e;
+
+    for (e = 0; e < 9; e++)
+    {
+        const ne10_uint8_t *k = minor[e];
+        d[e] = ne10_det2x2f_neon (m[k[0]], m[k[1]], m[k[2]], m[k[3]]);
+    }
+    /* first row expansion, as DET3x3 */
+    det = vmulq_f32 (m[0], d[0]);
+    det = vsubq_f32 (det, vmulq_f32 (m[3], d[1]));
+    det = vaddq_f32 (det, vmulq_f32 (m[6], d[2]));
+
+    rdet = ne10_invmat_rdet_neon (det);
+    ndet = vnegq_f32 (rdet);
+    for (e = 0; e < 9; e++)
+        d[e] = vmulq_f32 ( ( (e / 3 + e % 3) & 1) ? ndet : rdet, d[e]);
+}
+
+static inline void ne10_invmat_4x4f_soa_neon (float32x4_t * d, const float32x4_t * m)
+{
+    static const ne10_uint8_t minor[16][9] =
+    {
+        { 5,  6,  7,  9, 10, 11, 13, 14, 15},
+        { 1,  2,  3,  9, 10, 11, 13, 14, 15},
+        { 1,  2,  3,  5,  6,  7, 13, 14, 15},
+        { 1,  2,  3,  5,  6,  7,  9, 10, 11},
+        { 4,  6,  7,  8, 10, 11, 12, 14, 15},
+        { 0,  2,  3,  8, 10, 11, 12, 14, 15},
+        { 0,  2,  3,  4,  6,  7, 12, 14, 15},
+        { 0,  2,  3,  4,  6,  7,  8, 10, 11},
+        { 4,  5,  7,  8,  9, 11, 12, 13, 15},
+        { 0,  1,  3,  8,  9, 11, 12, 13, 15},
+        { 0,  1,  3,  4,  5,  7, 12, 13, 15},
+        { 0,  1,  3,  4,  5,  7,  8,  9, 11},
+        { 4,  5,  6,  8,  9, 10, 12, 13, 14},
+        { 0,  1,  2,  8,  9, 10, 12, 13, 14},
+        { 0,  1,  2,  4,  5,  6, 12, 13, 14},
+        { 0,  1,  2,  4,  5,  6,  8,  9, 10}
+    };
+    float32x4_t det, rdet, ndet;
+    ne10_int32_t e;
+
+    for (e = 0; e < 16; e++)
+    {
+        const ne10_uint8_t *k = minor[e];
+        d[e] = ne10_det3x3f_neon (m[k[0]], m[k[1]], m[k[2]],
+                                  m[k[3]], m[k[4]], m[k[5]],
+                                  m[k[6]], m[k[7]], m[k[8]]);
+    }
+    /* first row expansion, as DET4x4 */
+    det = vmulq_f32 (m[0], d[0]);
+    det = vsubq_f32 (det, vmulq_f32 (m[4], d[1]));
+    det = vaddq_f32 (det, vmulq_f32 (m[8], d[2]));
+    det = vsubq_f32 (det, vmulq_f32 (m[12], d[3]));
+
+    rdet = ne10_invmat_rdet_neon (det);
+    ndet = vnegq_f32 (rdet);
+    for (e = 0; e < 16; e++)
+        d[e] = vmulq_f32 ( ( (e / 4 + e % 4) & 1) ? ndet : rdet, d[e]);
+}
+
+#endif // NE10_MATH_NEONINTRINSIC_H
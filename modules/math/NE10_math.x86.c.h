@@ -0,0 +1,1224 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_math.x86.c.h
+ */
+
+/*
+ * Element-wise vector operations for x86. This file is compiled once per
+ * instruction set by NE10_math.sse.c and NE10_math.avx2.c (see
+ * common/NE10_x86.h). The vec2f, vec3f and vec4f versions work on their
+ * arrays as plain arrays of floats.
+ */
+
+#define NE10_X86_BINARY_OP(name, vname, vec_op, op) \
+ne10_result_t NE10_X86_NAME (ne10_##name##_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) \
+{ \
+    ne10_uint32_t i; \
+    NE10_CHECKPOINTER_DstSrc1Src2; \
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES) \
+    { \
+        ne10_x86_store (dst + i, vec_op (ne10_x86_load (src1 + i), ne10_x86_load (src2 + i))); \
+    } \
+    for (; i < count; i++) \
+    { \
+        dst[i] = src1[i] op src2[i]; \
+    } \
+    return NE10_OK; \
+} \
+ne10_result_t NE10_X86_NAME (ne10_##vname##_vec2f) (ne10_vec2f_t * dst, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count) \
+{ \
+    return NE10_X86_NAME (ne10_##name##_float) ( (ne10_float32_t*) dst, (ne10_float32_t*) src1, (ne10_float32_t*) src2, count * 2); \
+} \
+ne10_result_t NE10_X86_NAME (ne10_##vname##_vec3f) (ne10_vec3f_t * dst, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count) \
+{ \
+    return NE10_X86_NAME (ne10_##name##_float) ( (ne10_float32_t*) dst, (ne10_float32_t*) src1, (ne10_float32_t*) src2, count * 3); \
+} \
+ne10_result_t NE10_X86_NAME (ne10_##vname##_vec4f) (ne10_vec4f_t * dst, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count) \
+{ \
+    return NE10_X86_NAME (ne10_##name##_float) ( (ne10_float32_t*) dst, (ne10_float32_t*) src1, (ne10_float32_t*) src2, count * 4); \
+}
+
+NE10_X86_BINARY_OP (add, add, ne10_x86_add, +)
+NE10_X86_BINARY_OP (sub, sub, ne10_x86_sub, -)
+NE10_X86_BINARY_OP (mul, vmul, ne10_x86_mul, *)
+NE10_X86_BINARY_OP (div, vdiv, ne10_x86_div, /)
+
+ne10_result_t NE10_X86_NAME (ne10_mla_float) (ne10_float32_t * dst, ne10_float32_t * acc, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstAccSrc1Src2;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t prod = ne10_x86_mul (ne10_x86_load (src1 + i), ne10_x86_load (src2 + i));
+        ne10_x86_store (dst + i, ne10_x86_add (ne10_x86_load (acc + i), prod));
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = acc[i] + (src1[i] * src2[i]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_vmla_vec2f) (ne10_vec2f_t * dst, ne10_vec2f_t * acc, ne10_vec2f_t * src1, ne10_vec2f_t * src2, ne10_uint32_t count)
+{
+    return NE10_X86_NAME (ne10_mla_float) ( (ne10_float32_t*) dst, (ne10_float32_t*) acc, (ne10_float32_t*) src1, (ne10_float32_t*) src2, count * 2);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_vmla_vec3f) (ne10_vec3f_t * dst, ne10_vec3f_t * acc, ne10_vec3f_t * src1, ne10_vec3f_t * src2, ne10_uint32_t count)
+{
+    return NE10_X86_NAME (ne10_mla_float) ( (ne10_float32_t*) dst, (ne10_float32_t*) acc, (ne10_float32_t*) src1, (ne10_float32_t*) src2, count * 3);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_vmla_vec4f) (ne10_vec4f_t * dst, ne10_vec4f_t * acc, ne10_vec4f_t * src1, ne10_vec4f_t * src2, ne10_uint32_t count)
+{
+    return NE10_X86_NAME (ne10_mla_float) ( (ne10_float32_t*) dst, (ne10_float32_t*) acc, (ne10_float32_t*) src1, (ne10_float32_t*) src2, count * 4);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_abs_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_store (dst + i, ne10_x86_abs (ne10_x86_load (src + i)));
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = fabs (src[i]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_abs_vec2f) (ne10_vec2f_t * dst, ne10_vec2f_t * src, ne10_uint32_t count)
+{
+    return NE10_X86_NAME (ne10_abs_float) ( (ne10_float32_t*) dst, (ne10_float32_t*) src, count * 2);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_abs_vec3f) (ne10_vec3f_t * dst, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    return NE10_X86_NAME (ne10_abs_float) ( (ne10_float32_t*) dst, (ne10_float32_t*) src, count * 3);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_abs_vec4f) (ne10_vec4f_t * dst, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    return NE10_X86_NAME (ne10_abs_float) ( (ne10_float32_t*) dst, (ne10_float32_t*) src, count * 4);
+}
+
+/*
+ * Fused operation chain: as in NE10_chain.neon.c, every operation is applied
+ * to NE10_X86_CHAIN_REGS registers before they are stored.
+ */
+#define NE10_X86_CHAIN_REGS 4
+#define NE10_X86_CHAIN_TILE (NE10_X86_CHAIN_REGS * NE10_X86_LANES)
+
+ne10_result_t NE10_X86_NAME (ne10_chain_float) (ne10_float32_t * dst,
+        ne10_float32_t * src,
+        const ne10_chain_op_t * ops,
+        ne10_uint32_t op_count,
+        ne10_uint32_t count)
+{
+    ne10_chain_op_t tail_ops[NE10_CHAIN_MAX_OPS];
+    ne10_x86_f32_t x[NE10_X86_CHAIN_REGS];
+    ne10_x86_f32_t c0, c1;
+    ne10_uint32_t itr, k, j;
+
+    NE10_CHECKPOINTER_DstSrc;
+    if (ne10_chain_check (ops, op_count) != NE10_OK)
+    {
+        return NE10_ERR;
+    }
+
+    for (itr = 0; itr + NE10_X86_CHAIN_TILE <= count; itr += NE10_X86_CHAIN_TILE)
+    {
+        for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+            x[j] = ne10_x86_load (src + itr + j * NE10_X86_LANES);
+
+        for (k = 0; k < op_count; k++)
+        {
+            const ne10_chain_op_t *op = &ops[k];
+            const ne10_float32_t *a = (op->src[0] != NULL) ? op->src[0] + itr : NULL;
+            const ne10_float32_t *b = (op->src[1] != NULL) ? op->src[1] + itr : NULL;
+
+            switch (op->op)
+            {
+            case NE10_CHAIN_ADDC:
+                c0 = ne10_x86_dup (op->cst[0]);
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_add (x[j], c0);
+                break;
+            case NE10_CHAIN_SUBC:
+                c0 = ne10_x86_dup (op->cst[0]);
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_sub (x[j], c0);
+                break;
+            case NE10_CHAIN_RSBC:
+                c0 = ne10_x86_dup (op->cst[0]);
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_sub (c0, x[j]);
+                break;
+            case NE10_CHAIN_MULC:
+                c0 = ne10_x86_dup (op->cst[0]);
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_mul (x[j], c0);
+                break;
+            case NE10_CHAIN_ADD:
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_add (x[j], ne10_x86_load (a + j * NE10_X86_LANES));
+                break;
+            case NE10_CHAIN_SUB:
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_sub (x[j], ne10_x86_load (a + j * NE10_X86_LANES));
+                break;
+            case NE10_CHAIN_MUL:
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_mul (x[j], ne10_x86_load (a + j * NE10_X86_LANES));
+                break;
+            case NE10_CHAIN_MLA:
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_add (x[j], ne10_x86_mul (ne10_x86_load (a + j * NE10_X86_LANES),
+                                         ne10_x86_load (b + j * NE10_X86_LANES)));
+                break;
+            case NE10_CHAIN_ABS:
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_abs (x[j]);
+                break;
+            case NE10_CHAIN_MINC:
+                c0 = ne10_x86_dup (op->cst[0]);
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_min (x[j], c0);
+                break;
+            case NE10_CHAIN_MAXC:
+                c0 = ne10_x86_dup (op->cst[0]);
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_max (x[j], c0);
+                break;
+            case NE10_CHAIN_CLAMP:
+                c0 = ne10_x86_dup (op->cst[0]);
+                c1 = ne10_x86_dup (op->cst[1]);
+                for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+                    x[j] = ne10_x86_min (ne10_x86_max (x[j], c0), c1);
+                break;
+            default:
+                break;
+            }
+        }
+
+        for (j = 0; j < NE10_X86_CHAIN_REGS; j++)
+            ne10_x86_store (dst + itr + j * NE10_X86_LANES, x[j]);
+    }
+
+    // The remaining elements use the C version
+    if (itr < count)
+    {
+        for (k = 0; k < op_count; k++)
+        {
+            tail_ops[k] = ops[k];
+            tail_ops[k].src[0] = (ops[k].src[0] != NULL) ? ops[k].src[0] + itr : NULL;
+            tail_ops[k].src[1] = (ops[k].src[1] != NULL) ? ops[k].src[1] + itr : NULL;
+        }
+        ne10_chain_float_c (dst + itr, src + itr, tail_ops, op_count, count - itr);
+    }
+    return NE10_OK;
+}
+
+/*
+ * Structure-of-arrays vector operations: every lane holds a different
+ * vector, so these are the C loops NE10_X86_LANES vectors at a time. The
+ * AoS <-> SoA conversions move four vectors per step with 128-bit shuffles
+ * and blends in both builds; they are bound by memory bandwidth anyway.
+ */
+
+ne10_result_t NE10_X86_NAME (ne10_vec3f_aos_to_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    const ne10_float32_t *p = (const ne10_float32_t*) src;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        // a = [x0 y0 z0 x1], b = [y1 z1 x2 y2], c = [z2 x3 y3 z3]
+        __m128 a = _mm_loadu_ps (p + 3 * i);
+        __m128 b = _mm_loadu_ps (p + 3 * i + 4);
+        __m128 c = _mm_loadu_ps (p + 3 * i + 8);
+        // [x0 x3 x2 x1], [y1 y0 y3 y2], [z2 z1 z0 z3]
+        __m128 x = _mm_blend_ps (_mm_blend_ps (a, b, 0x4), c, 0x2);
+        __m128 y = _mm_blend_ps (_mm_blend_ps (a, b, 0x9), c, 0x4);
+        __m128 z = _mm_blend_ps (_mm_blend_ps (a, b, 0x2), c, 0x9);
+        _mm_storeu_ps (dst->x + i, _mm_shuffle_ps (x, x, _MM_SHUFFLE (1, 2, 3, 0)));
+        _mm_storeu_ps (dst->y + i, _mm_shuffle_ps (y, y, _MM_SHUFFLE (2, 3, 0, 1)));
+        _mm_storeu_ps (dst->z + i, _mm_shuffle_ps (z, z, _MM_SHUFFLE (3, 0, 1, 2)));
+    }
+    for (; i < count; i++)
+    {
+        dst->x[i] = src[i].x;
+        dst->y[i] = src[i].y;
+        dst->z[i] = src[i].z;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_vec3f_soa_to_aos) (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    ne10_float32_t *p = (ne10_float32_t*) dst;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        // The inverse of the permutations above
+        __m128 x = _mm_loadu_ps (src->x + i);
+        __m128 y = _mm_loadu_ps (src->y + i);
+        __m128 z = _mm_loadu_ps (src->z + i);
+        x = _mm_shuffle_ps (x, x, _MM_SHUFFLE (1, 2, 3, 0));
+        y = _mm_shuffle_ps (y, y, _MM_SHUFFLE (2, 3, 0, 1));
+        z = _mm_shuffle_ps (z, z, _MM_SHUFFLE (3, 0, 1, 2));
+        _mm_storeu_ps (p + 3 * i, _mm_blend_ps (_mm_blend_ps (x, y, 0x2), z, 0x4));
+        _mm_storeu_ps (p + 3 * i + 4, _mm_blend_ps (_mm_blend_ps (y, z, 0x2), x, 0x4));
+        _mm_storeu_ps (p + 3 * i + 8, _mm_blend_ps (_mm_blend_ps (z, x, 0x2), y, 0x4));
+    }
+    for (; i < count; i++)
+    {
+        dst[i].x = src->x[i];
+        dst[i].y = src->y[i];
+        dst[i].z = src->z[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_vec4f_aos_to_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    const ne10_float32_t *p = (const ne10_float32_t*) src;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        __m128 r0 = _mm_loadu_ps (p + 4 * i);
+        __m128 r1 = _mm_loadu_ps (p + 4 * i + 4);
+        __m128 r2 = _mm_loadu_ps (p + 4 * i + 8);
+        __m128 r3 = _mm_loadu_ps (p + 4 * i + 12);
+        _MM_TRANSPOSE4_PS (r0, r1, r2, r3);
+        _mm_storeu_ps (dst->x + i, r0);
+        _mm_storeu_ps (dst->y + i, r1);
+        _mm_storeu_ps (dst->z + i, r2);
+        _mm_storeu_ps (dst->w + i, r3);
+    }
+    for (; i < count; i++)
+    {
+        dst->x[i] = src[i].x;
+        dst->y[i] = src[i].y;
+        dst->z[i] = src[i].z;
+        dst->w[i] = src[i].w;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_vec4f_soa_to_aos) (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    ne10_float32_t *p = (ne10_float32_t*) dst;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        __m128 r0 = _mm_loadu_ps (src->x + i);
+        __m128 r1 = _mm_loadu_ps (src->y + i);
+        __m128 r2 = _mm_loadu_ps (src->z + i);
+        __m128 r3 = _mm_loadu_ps (src->w + i);
+        _MM_TRANSPOSE4_PS (r0, r1, r2, r3);
+        _mm_storeu_ps (p + 4 * i, r0);
+        _mm_storeu_ps (p + 4 * i + 4, r1);
+        _mm_storeu_ps (p + 4 * i + 8, r2);
+        _mm_storeu_ps (p + 4 * i + 12, r3);
+    }
+    for (; i < count; i++)
+    {
+        dst[i].x = src->x[i];
+        dst[i].y = src->y[i];
+        dst[i].z = src->z[i];
+        dst[i].w = src->w[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_len_vec3f_soa) (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t x = ne10_x86_load (src->x + i);
+        ne10_x86_f32_t y = ne10_x86_load (src->y + i);
+        ne10_x86_f32_t z = ne10_x86_load (src->z + i);
+        ne10_x86_f32_t s = ne10_x86_mul (x, x);
+        s = ne10_x86_add (s, ne10_x86_mul (y, y));
+        s = ne10_x86_add (s, ne10_x86_mul (z, z));
+        ne10_x86_store (dst + i, ne10_x86_sqrt (s));
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = sqrt (src->x[i] * src->x[i] +
+                       src->y[i] * src->y[i] +
+                       src->z[i] * src->z[i]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_len_vec4f_soa) (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t x = ne10_x86_load (src->x + i);
+        ne10_x86_f32_t y = ne10_x86_load (src->y + i);
+        ne10_x86_f32_t z = ne10_x86_load (src->z + i);
+        ne10_x86_f32_t w = ne10_x86_load (src->w + i);
+        ne10_x86_f32_t s = ne10_x86_mul (x, x);
+        s = ne10_x86_add (s, ne10_x86_mul (y, y));
+        s = ne10_x86_add (s, ne10_x86_mul (z, z));
+        s = ne10_x86_add (s, ne10_x86_mul (w, w));
+        ne10_x86_store (dst + i, ne10_x86_sqrt (s));
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = sqrt (src->x[i] * src->x[i] +
+                       src->y[i] * src->y[i] +
+                       src->z[i] * src->z[i] +
+                       src->w[i] * src->w[i]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_normalize_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    ne10_float32_t len;
+
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t x = ne10_x86_load (src->x + i);
+        ne10_x86_f32_t y = ne10_x86_load (src->y + i);
+        ne10_x86_f32_t z = ne10_x86_load (src->z + i);
+        ne10_x86_f32_t s = ne10_x86_mul (x, x);
+        s = ne10_x86_add (s, ne10_x86_mul (y, y));
+        s = ne10_x86_add (s, ne10_x86_mul (z, z));
+        s = ne10_x86_sqrt (s);
+        ne10_x86_store (dst->x + i, ne10_x86_div (x, s));
+        ne10_x86_store (dst->y + i, ne10_x86_div (y, s));
+        ne10_x86_store (dst->z + i, ne10_x86_div (z, s));
+    }
+    for (; i < count; i++)
+    {
+        len = sqrt (src->x[i] * src->x[i] +
+                    src->y[i] * src->y[i] +
+                    src->z[i] * src->z[i]);
+        dst->x[i] = src->x[i] / len;
+        dst->y[i] = src->y[i] / len;
+        dst->z[i] = src->z[i] / len;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_normalize_vec4f_soa) (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    ne10_float32_t len;
+
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t x = ne10_x86_load (src->x + i);
+        ne10_x86_f32_t y = ne10_x86_load (src->y + i);
+        ne10_x86_f32_t z = ne10_x86_load (src->z + i);
+        ne10_x86_f32_t w = ne10_x86_load (src->w + i);
+        ne10_x86_f32_t s = ne10_x86_mul (x, x);
+        s = ne10_x86_add (s, ne10_x86_mul (y, y));
+        s = ne10_x86_add (s, ne10_x86_mul (z, z));
+        s = ne10_x86_add (s, ne10_x86_mul (w, w));
+        s = ne10_x86_sqrt (s);
+        ne10_x86_store (dst->x + i, ne10_x86_div (x, s));
+        ne10_x86_store (dst->y + i, ne10_x86_div (y, s));
+        ne10_x86_store (dst->z + i, ne10_x86_div (z, s));
+        ne10_x86_store (dst->w + i, ne10_x86_div (w, s));
+    }
+    for (; i < count; i++)
+    {
+        len = sqrt (src->x[i] * src->x[i] +
+                    src->y[i] * src->y[i] +
+                    src->z[i] * src->z[i] +
+                    src->w[i] * src->w[i]);
+        dst->x[i] = src->x[i] / len;
+        dst->y[i] = src->y[i] / len;
+        dst->z[i] = src->z[i] / len;
+        dst->w[i] = src->w[i] / len;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_dot_vec3f_soa) (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t s = ne10_x86_mul (ne10_x86_load (src1->x + i), ne10_x86_load (src2->x + i));
+        s = ne10_x86_add (s, ne10_x86_mul (ne10_x86_load (src1->y + i), ne10_x86_load (src2->y + i)));
+        s = ne10_x86_add (s, ne10_x86_mul (ne10_x86_load (src1->z + i), ne10_x86_load (src2->z + i)));
+        ne10_x86_store (dst + i, s);
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = src1->x[i] * src2->x[i] +
+                 src1->y[i] * src2->y[i] +
+                 src1->z[i] * src2->z[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_dot_vec4f_soa) (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t s = ne10_x86_mul (ne10_x86_load (src1->x + i), ne10_x86_load (src2->x + i));
+        s = ne10_x86_add (s, ne10_x86_mul (ne10_x86_load (src1->y + i), ne10_x86_load (src2->y + i)));
+        s = ne10_x86_add (s, ne10_x86_mul (ne10_x86_load (src1->z + i), ne10_x86_load (src2->z + i)));
+        s = ne10_x86_add (s, ne10_x86_mul (ne10_x86_load (src1->w + i), ne10_x86_load (src2->w + i)));
+        ne10_x86_store (dst + i, s);
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = src1->x[i] * src2->x[i] +
+                 src1->y[i] * src2->y[i] +
+                 src1->z[i] * src2->z[i] +
+                 src1->w[i] * src2->w[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_cross_vec3f_soa) (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    ne10_float32_t x, y, z;
+
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t ax = ne10_x86_load (src1->x + i);
+        ne10_x86_f32_t ay = ne10_x86_load (src1->y + i);
+        ne10_x86_f32_t az = ne10_x86_load (src1->z + i);
+        ne10_x86_f32_t bx = ne10_x86_load (src2->x + i);
+        ne10_x86_f32_t by = ne10_x86_load (src2->y + i);
+        ne10_x86_f32_t bz = ne10_x86_load (src2->z + i);
+        ne10_x86_store (dst->x + i, ne10_x86_sub (ne10_x86_mul (ay, bz), ne10_x86_mul (az, by)));
+        ne10_x86_store (dst->y + i, ne10_x86_sub (ne10_x86_mul (az, bx), ne10_x86_mul (ax, bz)));
+        ne10_x86_store (dst->z + i, ne10_x86_sub (ne10_x86_mul (ax, by), ne10_x86_mul (ay, bx)));
+    }
+    for (; i < count; i++)
+    {
+        x = (src1->y[i] * src2->z[i]) - (src1->z[i] * src2->y[i]);
+        y = (src1->z[i] * src2->x[i]) - (src1->x[i] * src2->z[i]);
+        z = (src1->x[i] * src2->y[i]) - (src1->y[i] * src2->x[i]);
+        dst->x[i] = x;
+        dst->y[i] = y;
+        dst->z[i] = z;
+    }
+    return NE10_OK;
+}
+
+/*
+ * SGEMM micro-kernel: a (2 * NE10_X86_LANES) x 4 tile, 8 x 4 with SSE4.1 and
+ * 16 x 4 with AVX2, in eight accumulators. See NE10_sgemm.h for the packing.
+ */
+static void NE10_X86_NAME (ne10_sgemm_kernel) (ne10_uint32_t kc,
+        const ne10_float32_t * a,
+        const ne10_float32_t * b,
+        ne10_float32_t alpha,
+        ne10_float32_t beta,
+        ne10_float32_t * c,
+        ne10_uint32_t ldc)
+{
+    ne10_x86_f32_t acc[4][2];
+    ne10_x86_f32_t a0, a1, bj;
+    ne10_x86_f32_t valpha = ne10_x86_dup (alpha);
+    ne10_x86_f32_t vbeta = ne10_x86_dup (beta);
+    ne10_uint32_t p, j;
+
+    for (j = 0; j < 4; j++)
+    {
+        acc[j][0] = ne10_x86_dup (0.0f);
+        acc[j][1] = acc[j][0];
+    }
+
+    for (p = 0; p < kc; p++)
+    {
+        a0 = ne10_x86_load (a);
+        a1 = ne10_x86_load (a + NE10_X86_LANES);
+        for (j = 0; j < 4; j++)
+        {
+            bj = ne10_x86_dup (b[j]);
+            acc[j][0] = ne10_x86_add (acc[j][0], ne10_x86_mul (a0, bj));
+            acc[j][1] = ne10_x86_add (acc[j][1], ne10_x86_mul (a1, bj));
+        }
+        a += 2 * NE10_X86_LANES;
+        b += 4;
+    }
+
+    for (j = 0; j < 4; j++)
+    {
+        ne10_float32_t *cj = c + j * ldc;
+        a0 = ne10_x86_mul (acc[j][0], valpha);
+        a1 = ne10_x86_mul (acc[j][1], valpha);
+        if (beta != 0.0f)
+        {
+            a0 = ne10_x86_add (a0, ne10_x86_mul (ne10_x86_load (cj), vbeta));
+            a1 = ne10_x86_add (a1, ne10_x86_mul (ne10_x86_load (cj + NE10_X86_LANES), vbeta));
+        }
+        ne10_x86_store (cj, a0);
+        ne10_x86_store (cj + NE10_X86_LANES, a1);
+    }
+}
+
+ne10_result_t NE10_X86_NAME (ne10_sgemm) (ne10_transpose_t trans_a,
+        ne10_transpose_t trans_b,
+        ne10_uint32_t m,
+        ne10_uint32_t n,
+        ne10_uint32_t k,
+        ne10_float32_t alpha,
+        const ne10_float32_t * a,
+        ne10_uint32_t lda,
+        const ne10_float32_t * b,
+        ne10_uint32_t ldb,
+        ne10_float32_t beta,
+        ne10_float32_t * c,
+        ne10_uint32_t ldc)
+{
+    return ne10_sgemm_run (NE10_X86_NAME (ne10_sgemm_kernel), 2 * NE10_X86_LANES, 4,
+                           trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+/*
+ * Transcendental functions: every lane evaluates the scalar kernel of
+ * NE10_transcend.c with the same operations in the same order, and the
+ * blocks with an argument outside the fast path go through the C versions
+ * (see NE10_transcend.neon.c).
+ */
+static inline ne10_x86_f32_t NE10_X86_NAME (ne10_roundf) (ne10_x86_f32_t x)
+{
+    ne10_x86_f32_t m = ne10_x86_dup (NE10_ROUND_MAGIC);
+    return ne10_x86_sub (ne10_x86_add (x, m), m);
+}
+
+/* non-zero if every lane is in [FLT_MIN, FLT_MAX] */
+static inline ne10_int32_t NE10_X86_NAME (ne10_all_normal) (ne10_x86_f32_t x)
+{
+    ne10_x86_f32_t ok = ne10_x86_cmple (ne10_x86_dup (FLT_MIN), x);
+    return ne10_x86_all (ne10_x86_and (ok, ne10_x86_cmple (x, ne10_x86_dup (FLT_MAX))));
+}
+
+static inline ne10_x86_f32_t NE10_X86_NAME (ne10_expf) (ne10_x86_f32_t x)
+{
+    ne10_x86_f32_t n, n1, r, z, p;
+
+    /* the bounds go first so that NaNs pass through */
+    x = ne10_x86_max (ne10_x86_dup (NE10_EXP_MIN), x);
+    x = ne10_x86_min (ne10_x86_dup (NE10_EXP_MAX), x);
+
+    n = NE10_X86_NAME (ne10_roundf) (ne10_x86_mul (x, ne10_x86_dup (NE10_EXP_LOG2E)));
+    r = ne10_x86_sub (x, ne10_x86_mul (n, ne10_x86_dup (NE10_EXP_LN2_HI)));
+    r = ne10_x86_sub (r, ne10_x86_mul (n, ne10_x86_dup (NE10_EXP_LN2_LO)));
+    z = ne10_x86_mul (r, r);
+    p = ne10_x86_add (ne10_x86_mul (ne10_x86_dup (NE10_EXP_P0), r), ne10_x86_dup (NE10_EXP_P1));
+    p = ne10_x86_add (ne10_x86_mul (p, r), ne10_x86_dup (NE10_EXP_P2));
+    p = ne10_x86_add (ne10_x86_mul (p, r), ne10_x86_dup (NE10_EXP_P3));
+    p = ne10_x86_add (ne10_x86_mul (p, r), ne10_x86_dup (NE10_EXP_P4));
+    p = ne10_x86_add (ne10_x86_mul (p, r), ne10_x86_dup (NE10_EXP_P5));
+    p = ne10_x86_add (ne10_x86_add (ne10_x86_mul (p, z), r), ne10_x86_dup (1.0f));
+
+    n1 = NE10_X86_NAME (ne10_roundf) (ne10_x86_mul (n, ne10_x86_dup (0.5f)));
+    p = ne10_x86_mul (p, ne10_x86_pow2 (n1));
+    return ne10_x86_mul (p, ne10_x86_pow2 (ne10_x86_sub (n, n1)));
+}
+
+/* positive normal x only */
+static inline ne10_x86_f32_t NE10_X86_NAME (ne10_logf) (ne10_x86_f32_t x)
+{
+    ne10_x86_f32_t one = ne10_x86_dup (1.0f);
+    ne10_x86_f32_t e, m, lt, z, p;
+
+    m = ne10_x86_frexp (x, &e);
+    lt = ne10_x86_cmplt (m, ne10_x86_dup (NE10_LOG_SQRTHF));
+    e = ne10_x86_sub (e, ne10_x86_and (lt, one));
+    m = ne10_x86_add (m, ne10_x86_and (lt, m));
+    m = ne10_x86_sub (m, one);
+
+    z = ne10_x86_mul (m, m);
+    p = ne10_x86_add (ne10_x86_mul (ne10_x86_dup (NE10_LOG_P0), m), ne10_x86_dup (NE10_LOG_P1));
+    p = ne10_x86_add (ne10_x86_mul (p, m), ne10_x86_dup (NE10_LOG_P2));
+    p = ne10_x86_add (ne10_x86_mul (p, m), ne10_x86_dup (NE10_LOG_P3));
+    p = ne10_x86_add (ne10_x86_mul (p, m), ne10_x86_dup (NE10_LOG_P4));
+    p = ne10_x86_add (ne10_x86_mul (p, m), ne10_x86_dup (NE10_LOG_P5));
+    p = ne10_x86_add (ne10_x86_mul (p, m), ne10_x86_dup (NE10_LOG_P6));
+    p = ne10_x86_add (ne10_x86_mul (p, m), ne10_x86_dup (NE10_LOG_P7));
+    p = ne10_x86_add (ne10_x86_mul (p, m), ne10_x86_dup (NE10_LOG_P8));
+    p = ne10_x86_mul (ne10_x86_mul (p, m), z);
+    p = ne10_x86_add (p, ne10_x86_mul (e, ne10_x86_dup (NE10_EXP_LN2_LO)));
+    p = ne10_x86_sub (p, ne10_x86_mul (ne10_x86_dup (0.5f), z));
+    return ne10_x86_add (ne10_x86_add (m, p), ne10_x86_mul (e, ne10_x86_dup (NE10_EXP_LN2_HI)));
+}
+
+/* |x| <= NE10_TRIG_MAX only */
+static inline void NE10_X86_NAME (ne10_sincosf) (ne10_x86_f32_t * s, ne10_x86_f32_t * c, ne10_x86_f32_t x)
+{
+    ne10_x86_f32_t sign_bit = ne10_x86_dup (-0.0f);
+    ne10_x86_f32_t ax = ne10_x86_abs (x);
+    ne10_x86_f32_t q, r, z, ps, pc, swap, sign;
+
+    q = NE10_X86_NAME (ne10_roundf) (ne10_x86_mul (ax, ne10_x86_dup (NE10_TRIG_2_PI)));
+    r = ne10_x86_sub (ax, ne10_x86_mul (q, ne10_x86_dup (NE10_TRIG_PIO2_1)));
+    r = ne10_x86_sub (r, ne10_x86_mul (q, ne10_x86_dup (NE10_TRIG_PIO2_2)));
+    r = ne10_x86_sub (r, ne10_x86_mul (q, ne10_x86_dup (NE10_TRIG_PIO2_3)));
+    r = ne10_x86_sub (r, ne10_x86_mul (q, ne10_x86_dup (NE10_TRIG_PIO2_4)));
+    z = ne10_x86_mul (r, r);
+
+    ps = ne10_x86_add (ne10_x86_mul (ne10_x86_dup (NE10_SIN_P0), z), ne10_x86_dup (NE10_SIN_P1));
+    ps = ne10_x86_add (ne10_x86_mul (ps, z), ne10_x86_dup (NE10_SIN_P2));
+    ps = ne10_x86_add (ne10_x86_mul (ne10_x86_mul (ps, z), r), r);
+
+    pc = ne10_x86_add (ne10_x86_mul (ne10_x86_dup (NE10_COS_P0), z), ne10_x86_dup (NE10_COS_P1));
+    pc = ne10_x86_add (ne10_x86_mul (pc, z), ne10_x86_dup (NE10_COS_P2));
+    pc = ne10_x86_sub (ne10_x86_mul (ne10_x86_mul (pc, z), z), ne10_x86_mul (ne10_x86_dup (0.5f), z));
+    pc = ne10_x86_add (pc, ne10_x86_dup (1.0f));
+
+    /* odd quadrants swap the results, bit 1 of q (of q + 1) gives the sign of sin (of cos) */
+    swap = ne10_x86_bit_mask (q, 0);
+    sign = ne10_x86_and (ne10_x86_bit_mask (q, 1), sign_bit);
+    sign = ne10_x86_xor (sign, ne10_x86_and (x, sign_bit));
+    *s = ne10_x86_xor (ne10_x86_select (swap, pc, ps), sign);
+    sign = ne10_x86_and (ne10_x86_bit_mask (ne10_x86_add (q, ne10_x86_dup (1.0f)), 1), sign_bit);
+    *c = ne10_x86_xor (ne10_x86_select (swap, ps, pc), sign);
+}
+
+static inline ne10_x86_f32_t NE10_X86_NAME (ne10_atan2f) (ne10_x86_f32_t y, ne10_x86_f32_t x)
+{
+    ne10_x86_f32_t ax = ne10_x86_abs (x), ay = ne10_x86_abs (y);
+    ne10_x86_f32_t mn = ne10_x86_min (ax, ay);
+    ne10_x86_f32_t mx = ne10_x86_max (ax, ay);
+    ne10_x86_f32_t one = ne10_x86_dup (1.0f);
+    ne10_x86_f32_t m, big, num, den, a, z, p, t;
+
+    m = ne10_x86_cmplt (ne10_x86_dup (NE10_ATAN_BIG), mx);
+    mn = ne10_x86_mul (mn, ne10_x86_select (m, ne10_x86_dup (0.25f), one));
+    mx = ne10_x86_mul (mx, ne10_x86_select (m, ne10_x86_dup (0.25f), one));
+    m = ne10_x86_cmpeq (mn, ne10_x86_dup (INFINITY));
+    mn = ne10_x86_select (m, one, mn);
+    mx = ne10_x86_select (m, one, mx);
+
+    big = ne10_x86_cmplt (ne10_x86_mul (ne10_x86_dup (NE10_ATAN_TAN_PI_8), mx), mn);
+    num = ne10_x86_select (big, ne10_x86_sub (mn, mx), mn);
+    den = ne10_x86_select (big, ne10_x86_add (mn, mx), mx);
+    den = ne10_x86_select (ne10_x86_cmpeq (den, ne10_x86_dup (0.0f)), one, den);
+    a = ne10_x86_div (num, den);
+    z = ne10_x86_mul (a, a);
+
+    p = ne10_x86_add (ne10_x86_mul (ne10_x86_dup (NE10_ATAN_P0), z), ne10_x86_dup (NE10_ATAN_P1));
+    p = ne10_x86_add (ne10_x86_mul (p, z), ne10_x86_dup (NE10_ATAN_P2));
+    p = ne10_x86_add (ne10_x86_mul (p, z), ne10_x86_dup (NE10_ATAN_P3));
+    p = ne10_x86_mul (ne10_x86_mul (p, z), a);
+    p = ne10_x86_add (ne10_x86_add (p, ne10_x86_and (big, ne10_x86_dup (NE10_ATAN_PI_4_LO))), a);
+    p = ne10_x86_add (p, ne10_x86_and (big, ne10_x86_dup (NE10_ATAN_PI_4)));
+
+    t = ne10_x86_add (ne10_x86_sub (ne10_x86_dup (NE10_ATAN_PI_2), p), ne10_x86_dup (NE10_ATAN_PI_2_LO));
+    p = ne10_x86_select (ne10_x86_cmplt (ax, ay), t, p);
+    t = ne10_x86_add (ne10_x86_sub (ne10_x86_dup (NE10_ATAN_PI), p), ne10_x86_dup (NE10_ATAN_PI_LO));
+    p = ne10_x86_select (ne10_x86_sign_mask (x), t, p);
+    p = ne10_x86_xor (p, ne10_x86_and (y, ne10_x86_dup (-0.0f)));
+
+    m = ne10_x86_and (ne10_x86_cmpeq (x, x), ne10_x86_cmpeq (y, y));
+    return ne10_x86_select (m, p, ne10_x86_add (x, y));
+}
+
+/* estimate refined by one Newton-Raphson step; positive normal x only */
+static inline ne10_x86_f32_t NE10_X86_NAME (ne10_rsqrtf) (ne10_x86_f32_t x)
+{
+    ne10_x86_f32_t r = ne10_x86_rsqrt_estimate (x);
+    ne10_x86_f32_t t = ne10_x86_mul (ne10_x86_mul (x, r), r);
+    t = ne10_x86_sub (ne10_x86_dup (3.0f), t);
+    return ne10_x86_mul (ne10_x86_mul (r, ne10_x86_dup (0.5f)), t);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_exp_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_store (dst + i, NE10_X86_NAME (ne10_expf) (ne10_x86_load (src + i)));
+    }
+    return ne10_exp_float_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_log_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t x = ne10_x86_load (src + i);
+
+        if (NE10_X86_NAME (ne10_all_normal) (x))
+            ne10_x86_store (dst + i, NE10_X86_NAME (ne10_logf) (x));
+        else
+            ne10_log_float_c (dst + i, src + i, NE10_X86_LANES);
+    }
+    return ne10_log_float_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_sincos_float) (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_3POINTER (dst_sin, dst_cos, src);
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t x = ne10_x86_load (src + i);
+        ne10_x86_f32_t s, c;
+
+        if (!ne10_x86_all (ne10_x86_cmple (ne10_x86_abs (x), ne10_x86_dup (NE10_TRIG_MAX))))
+        {
+            ne10_sincos_float_c (dst_sin + i, dst_cos + i, src + i, NE10_X86_LANES);
+            continue;
+        }
+        NE10_X86_NAME (ne10_sincosf) (&s, &c, x);
+        ne10_x86_store (dst_sin + i, s);
+        ne10_x86_store (dst_cos + i, c);
+    }
+    return ne10_sincos_float_c (dst_sin + i, dst_cos + i, src + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_atan2_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_store (dst + i, NE10_X86_NAME (ne10_atan2f) (ne10_x86_load (src1 + i), ne10_x86_load (src2 + i)));
+    }
+    return ne10_atan2_float_c (dst + i, src1 + i, src2 + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_sqrt_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_store (dst + i, ne10_x86_sqrt (ne10_x86_load (src + i)));
+    }
+    return ne10_sqrt_float_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_rsqrt_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t x = ne10_x86_load (src + i);
+
+        if (NE10_X86_NAME (ne10_all_normal) (x))
+            ne10_x86_store (dst + i, NE10_X86_NAME (ne10_rsqrtf) (x));
+        else
+            ne10_rsqrt_float_c (dst + i, src + i, NE10_X86_LANES);
+    }
+    return ne10_rsqrt_float_c (dst + i, src + i, count - i);
+}
+
+/*
+ * Reductions: NE10_X86_REDUCE_REGS registers hold the NE10_REDUCE_LANES
+ * partial sums (or the extremes of a block) in the order of the elements,
+ * and the elements left over go through the C loops of NE10_reduce.h, so
+ * the results are those of the C versions. The steps are written out once
+ * per register so that the accumulators stay in registers, and the operation
+ * is chosen outside the loops.
+ */
+#define NE10_X86_REDUCE_REGS (NE10_REDUCE_LANES / NE10_X86_LANES)
+
+#if NE10_X86_REDUCE_REGS == 4
+#define NE10_X86_REDUCE_UNROLL(step) step (0) step (1) step (2) step (3)
+#define NE10_X86_REDUCE_FOLD(f) \
+    a[0] = f (a[0], a[2]); a[1] = f (a[1], a[3]); a[0] = f (a[0], a[1]);
+#else
+#define NE10_X86_REDUCE_UNROLL(step) step (0) step (1) step (2) step (3) step (4) step (5) step (6) step (7)
+#define NE10_X86_REDUCE_FOLD(f) \
+    a[0] = f (a[0], a[4]); a[1] = f (a[1], a[5]); a[2] = f (a[2], a[6]); a[3] = f (a[3], a[7]); \
+    a[0] = f (a[0], a[2]); a[1] = f (a[1], a[3]); a[0] = f (a[0], a[1]);
+#endif
+
+#define NE10_X86_REDUCE_AT(p, k) ne10_x86_load ((p) + i + (k) * NE10_X86_LANES)
+#define NE10_X86_REDUCE_DUP(k) a[k] = ne10_x86_dup (init);
+#define NE10_X86_REDUCE_STORE(k) ne10_x86_store (acc + (k) * NE10_X86_LANES, a[k]);
+#define NE10_X86_REDUCE_SUM(k) a[k] = ne10_x86_add (a[k], NE10_X86_REDUCE_AT (src1, k));
+#define NE10_X86_REDUCE_DOT(k) \
+    a[k] = ne10_x86_add (a[k], ne10_x86_mul (NE10_X86_REDUCE_AT (src1, k), NE10_X86_REDUCE_AT (src2, k)));
+#define NE10_X86_REDUCE_SUMSQ(k) \
+    a[k] = ne10_x86_add (a[k], ne10_x86_mul (NE10_X86_REDUCE_AT (src1, k), NE10_X86_REDUCE_AT (src1, k)));
+#define NE10_X86_REDUCE_MIN(k) a[k] = ne10_x86_min (NE10_X86_REDUCE_AT (src, k), a[k]);
+#define NE10_X86_REDUCE_MAX(k) a[k] = ne10_x86_max (NE10_X86_REDUCE_AT (src, k), a[k]);
+#define NE10_X86_REDUCE_MAXABS(k) a[k] = ne10_x86_max (ne10_x86_abs (NE10_X86_REDUCE_AT (src, k)), a[k]);
+#define NE10_X86_REDUCE_LOOP(first, last, step) \
+    for (i = (first); i + NE10_REDUCE_LANES <= (last); i += NE10_REDUCE_LANES) \
+    { \
+        NE10_X86_REDUCE_UNROLL (step) \
+    }
+
+static inline ne10_float32_t NE10_X86_NAME (ne10_reduce_float) (ne10_reduce_op_t op,
+        const ne10_float32_t * src1,
+        const ne10_float32_t * src2,
+        ne10_uint32_t count)
+{
+    ne10_float32_t acc[NE10_REDUCE_LANES];
+    ne10_x86_f32_t a[NE10_X86_REDUCE_REGS];
+    ne10_float32_t init = 0.0f;
+    ne10_uint32_t i = 0;
+
+    NE10_X86_REDUCE_UNROLL (NE10_X86_REDUCE_DUP)
+    switch (op)
+    {
+    case NE10_REDUCE_SUM:
+        NE10_X86_REDUCE_LOOP (0, count, NE10_X86_REDUCE_SUM)
+        break;
+    case NE10_REDUCE_DOT:
+        NE10_X86_REDUCE_LOOP (0, count, NE10_X86_REDUCE_DOT)
+        break;
+    case NE10_REDUCE_SUMSQ:
+        NE10_X86_REDUCE_LOOP (0, count, NE10_X86_REDUCE_SUMSQ)
+        break;
+    }
+    NE10_X86_REDUCE_UNROLL (NE10_X86_REDUCE_STORE)
+    return ne10_reduce_finish (acc, op, src1 + i, src2 + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_sum_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = NE10_X86_NAME (ne10_reduce_float) (NE10_REDUCE_SUM, src, src, count);
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_mean_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    if (count == 0)
+        return NE10_ERR;
+    *dst = NE10_X86_NAME (ne10_reduce_float) (NE10_REDUCE_SUM, src, src, count) / (ne10_float32_t) count;
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_dotprod_float) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    *dst = NE10_X86_NAME (ne10_reduce_float) (NE10_REDUCE_DOT, src1, src2, count);
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_norm2_float) (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = sqrtf (NE10_X86_NAME (ne10_reduce_float) (NE10_REDUCE_SUMSQ, src, src, count));
+    return NE10_OK;
+}
+
+/*
+ * The extremes of a block start at -infinity (+infinity for the minimum);
+ * (x > e) ? x : e skips NaNs. The registers of a block are folded into one,
+ * which does not change the extreme (equal keys are told apart by the search
+ * for the first index). A block whose extreme is still the start value (only
+ * NaNs, or infinities) is searched again in C.
+ */
+static inline ne10_result_t NE10_X86_NAME (ne10_extreme_float) (ne10_float32_t * dst,
+        ne10_uint32_t * index,
+        const ne10_float32_t * src,
+        ne10_uint32_t count,
+        ne10_reduce_cmp_t op)
+{
+    ne10_float32_t acc[NE10_X86_LANES];
+    ne10_float32_t init = (op == NE10_REDUCE_MIN) ? INFINITY : -INFINITY;
+    ne10_float32_t best = NAN;
+    ne10_uint32_t b, i = 0, start = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+    for (b = 0; b < count; b += NE10_REDUCE_BLOCK)
+    {
+        ne10_uint32_t end = (count - b > NE10_REDUCE_BLOCK) ? b + NE10_REDUCE_BLOCK : count;
+        ne10_x86_f32_t a[NE10_X86_REDUCE_REGS];
+        ne10_float32_t m;
+
+        NE10_X86_REDUCE_UNROLL (NE10_X86_REDUCE_DUP)
+        switch (op)
+        {
+        case NE10_REDUCE_MIN:
+            NE10_X86_REDUCE_LOOP (b, end, NE10_X86_REDUCE_MIN)
+            NE10_X86_REDUCE_FOLD (ne10_x86_min)
+            break;
+        case NE10_REDUCE_MAX:
+            NE10_X86_REDUCE_LOOP (b, end, NE10_X86_REDUCE_MAX)
+            NE10_X86_REDUCE_FOLD (ne10_x86_max)
+            break;
+        case NE10_REDUCE_MAXABS:
+            NE10_X86_REDUCE_LOOP (b, end, NE10_X86_REDUCE_MAXABS)
+            NE10_X86_REDUCE_FOLD (ne10_x86_max)
+            break;
+        }
+        ne10_x86_store (acc, a[0]);
+        m = ne10_reduce_extreme_keys (acc, NE10_X86_LANES, op);
+        m = ne10_reduce_extreme (m, src + i, end - i, op);
+        if (m == init)
+            m = ne10_reduce_extreme (NAN, src + b, end - b, op);
+        if (ne10_reduce_better (m, best, op))
+        {
+            best = m;
+            start = b;
+        }
+    }
+    if (best == best)
+    {
+        /* skip the vectors of the winning block that do not hold best */
+        ne10_x86_f32_t t = ne10_x86_dup (best);
+
+        for (; start + NE10_X86_LANES <= count; start += NE10_X86_LANES)
+        {
+            ne10_x86_f32_t x = ne10_x86_load (src + start);
+
+            if (op == NE10_REDUCE_MAXABS)
+                x = ne10_x86_abs (x);
+            if (ne10_x86_any (ne10_x86_cmpeq (x, t)))
+                break;
+        }
+    }
+    ne10_reduce_store_first (dst, index, src, count, start, best, op);
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_max_float) (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return NE10_X86_NAME (ne10_extreme_float) (dst, index, src, count, NE10_REDUCE_MAX);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_min_float) (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return NE10_X86_NAME (ne10_extreme_float) (dst, index, src, count, NE10_REDUCE_MIN);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_maxabs_float) (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return NE10_X86_NAME (ne10_extreme_float) (dst, index, src, count, NE10_REDUCE_MAXABS);
+}
+
+/*
+ * Complex arrays, de-interleaved by ne10_x86_load_cpx and evaluated with the
+ * operations of the C versions, which take the values left over. The polar
+ * conversions go through the real functions a block at a time.
+ */
+#define NE10_X86_CPX_BLOCK 256
+
+ne10_result_t NE10_X86_NAME (ne10_cmul_float32) (ne10_fft_cpx_float32_t * dst,
+        ne10_fft_cpx_float32_t * src1,
+        ne10_fft_cpx_float32_t * src2,
+        ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t ar, ai, br, bi;
+
+        ne10_x86_load_cpx ( (ne10_float32_t *) (src1 + i), &ar, &ai);
+        ne10_x86_load_cpx ( (ne10_float32_t *) (src2 + i), &br, &bi);
+        ne10_x86_store_cpx ( (ne10_float32_t *) (dst + i),
+                             ne10_x86_sub (ne10_x86_mul (ar, br), ne10_x86_mul (ai, bi)),
+                             ne10_x86_add (ne10_x86_mul (ar, bi), ne10_x86_mul (ai, br)));
+    }
+    return ne10_cmul_float32_c (dst + i, src1 + i, src2 + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_cmul_conj_float32) (ne10_fft_cpx_float32_t * dst,
+        ne10_fft_cpx_float32_t * src1,
+        ne10_fft_cpx_float32_t * src2,
+        ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t ar, ai, br, bi;
+
+        ne10_x86_load_cpx ( (ne10_float32_t *) (src1 + i), &ar, &ai);
+        ne10_x86_load_cpx ( (ne10_float32_t *) (src2 + i), &br, &bi);
+        ne10_x86_store_cpx ( (ne10_float32_t *) (dst + i),
+                             ne10_x86_add (ne10_x86_mul (ar, br), ne10_x86_mul (ai, bi)),
+                             ne10_x86_sub (ne10_x86_mul (ai, br), ne10_x86_mul (ar, bi)));
+    }
+    return ne10_cmul_conj_float32_c (dst + i, src1 + i, src2 + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_cmac_float32) (ne10_fft_cpx_float32_t * dst,
+        ne10_fft_cpx_float32_t * acc,
+        ne10_fft_cpx_float32_t * src1,
+        ne10_fft_cpx_float32_t * src2,
+        ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstAccSrc1Src2;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t cr, ci, ar, ai, br, bi;
+
+        ne10_x86_load_cpx ( (ne10_float32_t *) (acc + i), &cr, &ci);
+        ne10_x86_load_cpx ( (ne10_float32_t *) (src1 + i), &ar, &ai);
+        ne10_x86_load_cpx ( (ne10_float32_t *) (src2 + i), &br, &bi);
+        cr = ne10_x86_add (cr, ne10_x86_sub (ne10_x86_mul (ar, br), ne10_x86_mul (ai, bi)));
+        ci = ne10_x86_add (ci, ne10_x86_add (ne10_x86_mul (ar, bi), ne10_x86_mul (ai, br)));
+        ne10_x86_store_cpx ( (ne10_float32_t *) (dst + i), cr, ci);
+    }
+    return ne10_cmac_float32_c (dst + i, acc + i, src1 + i, src2 + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_cabs2_float32) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t r, im;
+
+        ne10_x86_load_cpx ( (ne10_float32_t *) (src + i), &r, &im);
+        ne10_x86_store (dst + i, ne10_x86_add (ne10_x86_mul (r, r), ne10_x86_mul (im, im)));
+    }
+    return ne10_cabs2_float32_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_cabs_float32) (ne10_float32_t * dst, ne10_fft_cpx_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t r, im;
+
+        ne10_x86_load_cpx ( (ne10_float32_t *) (src + i), &r, &im);
+        ne10_x86_store (dst + i, ne10_x86_sqrt (ne10_x86_add (ne10_x86_mul (r, r), ne10_x86_mul (im, im))));
+    }
+    return ne10_cabs_float32_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_cscale_float32) (ne10_fft_cpx_float32_t * dst,
+        ne10_fft_cpx_float32_t * src,
+        ne10_float32_t cst,
+        ne10_uint32_t count)
+{
+    ne10_x86_f32_t c = ne10_x86_dup (cst);
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrcCst;
+    for (i = 0; i + NE10_X86_LANES <= count; i += NE10_X86_LANES)
+    {
+        ne10_x86_f32_t r, im;
+
+        ne10_x86_load_cpx ( (ne10_float32_t *) (src + i), &r, &im);
+        ne10_x86_store_cpx ( (ne10_float32_t *) (dst + i), ne10_x86_mul (r, c), ne10_x86_mul (im, c));
+    }
+    return ne10_cscale_float32_c (dst + i, src + i, cst, count - i);
+}
+
+ne10_result_t NE10_X86_NAME (ne10_cpolar_float32) (ne10_float32_t * mag,
+        ne10_float32_t * phase,
+        ne10_fft_cpx_float32_t * src,
+        ne10_uint32_t count)
+{
+    ne10_float32_t re[NE10_X86_CPX_BLOCK];
+    ne10_float32_t im[NE10_X86_CPX_BLOCK];
+    ne10_uint32_t b, i, n;
+
+    for (b = 0; b < count; b += n)
+    {
+        n = (count - b < NE10_X86_CPX_BLOCK) ? count - b : NE10_X86_CPX_BLOCK;
+        for (i = 0; i + NE10_X86_LANES <= n; i += NE10_X86_LANES)
+        {
+            ne10_x86_f32_t r, m;
+
+            ne10_x86_load_cpx ( (ne10_float32_t *) (src + b + i), &r, &m);
+            ne10_x86_store (re + i, r);
+            ne10_x86_store (im + i, m);
+        }
+        for (; i < n; i++)
+        {
+            re[i] = src[b + i].r;
+            im[i] = src[b + i].i;
+        }
+        NE10_X86_NAME (ne10_cabs_float32) (mag + b, src + b, n);
+        NE10_X86_NAME (ne10_atan2_float) (phase + b, im, re, n);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t NE10_X86_NAME (ne10_crect_float32) (ne10_fft_cpx_float32_t * dst,
+        ne10_float32_t * mag,
+        ne10_float32_t * phase,
+        ne10_uint32_t count)
+{
+    ne10_float32_t s[NE10_X86_CPX_BLOCK];
+    ne10_float32_t c[NE10_X86_CPX_BLOCK];
+    ne10_uint32_t b, i, n;
+
+    for (b = 0; b < count; b += n)
+    {
+        n = (count - b < NE10_X86_CPX_BLOCK) ? count - b : NE10_X86_CPX_BLOCK;
+        NE10_X86_NAME (ne10_sincos_float) (s, c, phase + b, n);
+        for (i = 0; i + NE10_X86_LANES <= n; i += NE10_X86_LANES)
+        {
+            ne10_x86_f32_t m = ne10_x86_load (mag + b + i);
+
+            ne10_x86_store_cpx ( (ne10_float32_t *) (dst + b + i),
+                                 ne10_x86_mul (m, ne10_x86_load (c + i)),
+                                 ne10_x86_mul (m, ne10_x86_load (s + i)));
+        }
+        for (; i < n; i++)
+        {
+            dst[b + i].r = mag[b + i] * c[i];
+            dst[b + i].i = mag[b + i] * s[i];
+        }
+    }
+    return NE10_OK;
+}
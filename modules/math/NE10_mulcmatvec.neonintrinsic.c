@@ -0,0 +1,108 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_mulcmatvec.neonintrinsic.c
+ */
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+
+/*
+ * Four vectors are transformed at once: the structure loads split them into
+ * one register per component, and each component of the result is a sum of
+ * those registers weighted by a row of the constant matrix.
+ */
+
+ne10_result_t ne10_mulcmatvec_cm2x2f_v2f_neon (ne10_vec2f_t * dst, const ne10_mat2x2f_t * cst, ne10_vec2f_t * src, ne10_uint32_t count)
+{
+    const ne10_float32_t *m = (const ne10_float32_t*) cst;
+    ne10_uint32_t i;
+    ne10_int32_t r;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x2_t v = vld2q_f32 ( (ne10_float32_t*) (src + i));
+        float32x4x2_t d;
+        for (r = 0; r < 2; r++)
+        {
+            d.val[r] = vmulq_n_f32 (v.val[0], m[r]);
+            d.val[r] = vaddq_f32 (d.val[r], vmulq_n_f32 (v.val[1], m[2 + r]));
+        }
+        vst2q_f32 ( (ne10_float32_t*) (dst + i), d);
+    }
+    return ne10_mulcmatvec_cm2x2f_v2f_c (dst + i, cst, src + i, count - i);
+}
+
+ne10_result_t ne10_mulcmatvec_cm3x3f_v3f_neon (ne10_vec3f_t * dst, const ne10_mat3x3f_t * cst, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    const ne10_float32_t *m = (const ne10_float32_t*) cst;
+    ne10_uint32_t i;
+    ne10_int32_t r;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32 ( (ne10_float32_t*) (src + i));
+        float32x4x3_t d;
+        for (r = 0; r < 3; r++)
+        {
+            d.val[r] = vmulq_n_f32 (v.val[0], m[r]);
+            d.val[r] = vaddq_f32 (d.val[r], vmulq_n_f32 (v.val[1], m[3 + r]));
+            d.val[r] = vaddq_f32 (d.val[r], vmulq_n_f32 (v.val[2], m[6 + r]));
+        }
+        vst3q_f32 ( (ne10_float32_t*) (dst + i), d);
+    }
+    return ne10_mulcmatvec_cm3x3f_v3f_c (dst + i, cst, src + i, count - i);
+}
+
+ne10_result_t ne10_mulcmatvec_cm4x4f_v4f_neon (ne10_vec4f_t * dst, const ne10_mat4x4f_t * cst, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    const ne10_float32_t *m = (const ne10_float32_t*) cst;
+    ne10_uint32_t i;
+    ne10_int32_t r;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t v = vld4q_f32 ( (ne10_float32_t*) (src + i));
+        float32x4x4_t d;
+        for (r = 0; r < 4; r++)
+        {
+            d.val[r] = vmulq_n_f32 (v.val[0], m[r]);
+            d.val[r] = vaddq_f32 (d.val[r], vmulq_n_f32 (v.val[1], m[4 + r]));
+            d.val[r] = vaddq_f32 (d.val[r], vmulq_n_f32 (v.val[2], m[8 + r]));
+            d.val[r] = vaddq_f32 (d.val[r], vmulq_n_f32 (v.val[3], m[12 + r]));
+        }
+        vst4q_f32 ( (ne10_float32_t*) (dst + i), d);
+    }
+    return ne10_mulcmatvec_cm4x4f_v4f_c (dst + i, cst, src + i, count - i);
+}
@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_mulmat.neonintrinsic.c
+ */
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+
+/*
+ * Column j of the product is the sum of the columns of src1 weighted by the
+ * elements of column j of src2, accumulated in the same order as the C versions.
+ * All the operands of a matrix are loaded before its result is stored.
+ */
+
+ne10_result_t ne10_mulmat_2x2f_neon (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src1, ne10_mat2x2f_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i < count; i++)
+    {
+        float32x4_t a = vld1q_f32 ( (ne10_float32_t*) (src1 + i));
+        float32x4_t b = vld1q_f32 ( (ne10_float32_t*) (src2 + i));
+        /* [b.c1.r1 b.c1.r1 b.c2.r1 b.c2.r1] and [b.c1.r2 b.c1.r2 b.c2.r2 b.c2.r2] */
+        float32x4x2_t w = vtrnq_f32 (b, b);
+        float32x4_t c1 = vcombine_f32 (vget_low_f32 (a), vget_low_f32 (a));
+        float32x4_t c2 = vcombine_f32 (vget_high_f32 (a), vget_high_f32 (a));
+        vst1q_f32 ( (ne10_float32_t*) (dst + i), vaddq_f32 (vmulq_f32 (c1, w.val[0]), vmulq_f32 (c2, w.val[1])));
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mulmat_3x3f_neon (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src1, ne10_mat3x3f_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i < count; i++)
+    {
+        const ne10_float32_t *s1 = (const ne10_float32_t*) (src1 + i);
+        const ne10_float32_t *s2 = (const ne10_float32_t*) (src2 + i);
+        ne10_float32_t *d = (ne10_float32_t*) (dst + i);
+        /* the last column is loaded from one float earlier to stay within the matrix */
+        float32x4_t a1 = vld1q_f32 (s1);
+        float32x4_t a2 = vld1q_f32 (s1 + 3);
+        float32x4_t a3 = vld1q_f32 (s1 + 5);
+        float32x4_t b1 = vld1q_f32 (s2);
+        float32x4_t b2 = vld1q_f32 (s2 + 3);
+        float32x4_t b3 = vld1q_f32 (s2 + 5);
+        float32x4_t d1, d2, d3;
+
+        a3 = vextq_f32 (a3, a3, 1);
+        b3 = vextq_f32 (b3, b3, 1);
+
+        d1 = vmulq_lane_f32 (a1, vget_low_f32 (b1), 0);
+        d1 = vaddq_f32 (d1, vmulq_lane_f32 (a2, vget_low_f32 (b1), 1));
+        d1 = vaddq_f32 (d1, vmulq_lane_f32 (a3, vget_high_f32 (b1), 0));
+        d2 = vmulq_lane_f32 (a1, vget_low_f32 (b2), 0);
+        d2 = vaddq_f32 (d2, vmulq_lane_f32 (a2, vget_low_f32 (b2), 1));
+        d2 = vaddq_f32 (d2, vmulq_lane_f32 (a3, vget_high_f32 (b2), 0));
+        d3 = vmulq_lane_f32 (a1, vget_low_f32 (b3), 0);
+        d3 = vaddq_f32 (d3, vmulq_lane_f32 (a2, vget_low_f32 (b3), 1));
+        d3 = vaddq_f32 (d3, vmulq_lane_f32 (a3, vget_high_f32 (b3), 0));
+
+        /* the fourth lanes of d1 and d2 are overwritten by the next column */
+        vst1q_f32 (d, d1);
+        vst1q_f32 (d + 3, d2);
+        vst1_f32 (d + 6, vget_low_f32 (d3));
+        vst1q_lane_f32 (d + 8, d3, 2);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mulmat_4x4f_neon (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src1, ne10_mat4x4f_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    ne10_int32_t j;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i < count; i++)
+    {
+        const ne10_float32_t *s1 = (const ne10_float32_t*) (src1 + i);
+        const ne10_float32_t *s2 = (const ne10_float32_t*) (src2 + i);
+        ne10_float32_t *d = (ne10_float32_t*) (dst + i);
+        float32x4_t a1 = vld1q_f32 (s1);
+        float32x4_t a2 = vld1q_f32 (s1 + 4);
+        float32x4_t a3 = vld1q_f32 (s1 + 8);
+        float32x4_t a4 = vld1q_f32 (s1 + 12);
+        float32x4_t b[4], c[4];
+
+        for (j = 0; j < 4; j++)
+        {
+            b[j] = vld1q_f32 (s2 + 4 * j);
+        }
+        for (j = 0; j < 4; j++)
+        {
+            c[j] = vmulq_lane_f32 (a1, vget_low_f32 (b[j]), 0);
+            c[j] = vaddq_f32 (c[j], vmulq_lane_f32 (a2, vget_low_f32 (b[j]), 1));
+            c[j] = vaddq_f32 (c[j], vmulq_lane_f32 (a3, vget_high_f32 (b[j]), 0));
+            c[j] = vaddq_f32 (c[j], vmulq_lane_f32 (a4, vget_high_f32 (b[j]), 1));
+        }
+        for (j = 0; j < 4; j++)
+        {
+            vst1q_f32 (d + 4 * j, c[j]);
+        }
+    }
+    return NE10_OK;
+}
@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_normalize.neonintrinsic.c
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_math.neonintrinsic.h"
+
+ne10_result_t ne10_normalize_vec2f_neon (ne10_vec2f_t * dst, ne10_vec2f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x2_t v = vld2q_f32 ( (ne10_float32_t*) (src + i));
+        float32x4_t s = vmulq_f32 (v.val[0], v.val[0]);
+        s = vaddq_f32 (s, vmulq_f32 (v.val[1], v.val[1]));
+        float32x4_t len = ne10_sqrt_f32_neon (s);
+        v.val[0] = ne10_div_f32_neon (v.val[0], len);
+        v.val[1] = ne10_div_f32_neon (v.val[1], len);
+        vst2q_f32 ( (ne10_float32_t*) (dst + i), v);
+    }
+    for (; i < count; i++)
+    {
+        ne10_float32_t len = sqrt (src[i].x * src[i].x +
+                                   src[i].y * src[i].y);
+        dst[i].x = src[i].x / len;
+        dst[i].y = src[i].y / len;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_normalize_vec3f_neon (ne10_vec3f_t * dst, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32 ( (ne10_float32_t*) (src + i));
+        float32x4_t s = vmulq_f32 (v.val[0], v.val[0]);
+        s = vaddq_f32 (s, vmulq_f32 (v.val[1], v.val[1]));
+        s = vaddq_f32 (s, vmulq_f32 (v.val[2], v.val[2]));
+        float32x4_t len = ne10_sqrt_f32_neon (s);
+        v.val[0] = ne10_div_f32_neon (v.val[0], len);
+        v.val[1] = ne10_div_f32_neon (v.val[1], len);
+        v.val[2] = ne10_div_f32_neon (v.val[2], len);
+        vst3q_f32 ( (ne10_float32_t*) (dst + i), v);
+    }
+    for (; i < count; i++)
+    {
+        ne10_float32_t len = sqrt (src[i].x * src[i].x +
+                                   src[i].y * src[i].y +
+                                   src[i].z * src[i].z);
+        dst[i].x = src[i].x / len;
+        dst[i].y = src[i].y / len;
+        dst[i].z = src[i].z / len;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_normalize_vec4f_neon (ne10_vec4f_t * dst, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t v = vld4q_f32 ( (ne10_float32_t*) (src + i));
+        float32x4_t s = vmulq_f32 (v.val[0], v.val[0]);
+        s = vaddq_f32 (s, vmulq_f32 (v.val[1], v.val[1]));
+        s = vaddq_f32 (s, vmulq_f32 (v.val[2], v.val[2]));
+        s = vaddq_f32 (s, vmulq_f32 (v.val[3], v.val[3]));
+        float32x4_t len = ne10_sqrt_f32_neon (s);
+        v.val[0] = ne10_div_f32_neon (v.val[0], len);
+        v.val[1] = ne10_div_f32_neon (v.val[1], len);
+        v.val[2] = ne10_div_f32_neon (v.val[2], len);
+        v.val[3] = ne10_div_f32_neon (v.val[3], len);
+        vst4q_f32 ( (ne10_float32_t*) (dst + i), v);
+    }
+    for (; i < count; i++)
+    {
+        ne10_float32_t len = sqrt (src[i].x * src[i].x +
+                                   src[i].y * src[i].y +
+                                   src[i].z * src[i].z +
+                                   src[i].w * src[i].w);
+        dst[i].x = src[i].x / len;
+        dst[i].y = src[i].y / len;
+        dst[i].z = src[i].z / len;
+        dst[i].w = src[i].w / len;
+    }
+    return NE10_OK;
+}
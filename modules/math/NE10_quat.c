@@ -0,0 +1,224 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_quat.c
+ */
+
+#include <assert.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_quat.h"
+
+/*
+ * Every element is read before any of its results is written, so the
+ * functions with quaternion or vector results may work in-place.
+ */
+
+ne10_result_t ne10_mul_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x1 = src1[i].x, y1 = src1[i].y, z1 = src1[i].z, w1 = src1[i].w;
+        ne10_float32_t x2 = src2[i].x, y2 = src2[i].y, z2 = src2[i].z, w2 = src2[i].w;
+
+        dst[i].x = w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2;
+        dst[i].y = w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2;
+        dst[i].z = w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2;
+        dst[i].w = w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_normalize_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x = src[i].x, y = src[i].y, z = src[i].z, w = src[i].w;
+        ne10_float32_t len = sqrtf (x * x + y * y + z * z + w * w);
+
+        dst[i].x = x / len;
+        dst[i].y = y / len;
+        dst[i].z = z / len;
+        dst[i].w = w / len;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_nlerp_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_4POINTER (dst, src1, src2, t);
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x1 = src1[i].x, y1 = src1[i].y, z1 = src1[i].z, w1 = src1[i].w;
+        ne10_float32_t x2 = src2[i].x, y2 = src2[i].y, z2 = src2[i].z, w2 = src2[i].w;
+        ne10_float32_t d = 1.0f - t[i];
+        ne10_float32_t s = t[i];
+        ne10_float32_t x, y, z, w, len;
+
+        // the shorter way round
+        if (x1 * x2 + y1 * y2 + z1 * z2 + w1 * w2 < 0.0f)
+            s = -s;
+        x = x1 * d + x2 * s;
+        y = y1 * d + y2 * s;
+        z = z1 * d + z2 * s;
+        w = w1 * d + w2 * s;
+        len = sqrtf (x * x + y * y + z * z + w * w);
+
+        dst[i].x = x / len;
+        dst[i].y = y / len;
+        dst[i].z = z / len;
+        dst[i].w = w / len;
+    }
+    return NE10_OK;
+}
+
+/* sin (t * theta) / sin (theta), from xm1 = cos (theta) - 1; see NE10_quat.h */
+static inline ne10_float32_t ne10_slerp_coef (ne10_float32_t xm1, ne10_float32_t t)
+{
+    ne10_float32_t tt = t * t;
+    ne10_float32_t acc = 1.0f;
+    ne10_int32_t k;
+
+    for (k = NE10_SLERP_TERMS - 1; k >= 0; k--)
+        acc = 1.0f + ( (ne10_slerp_u[k] * tt - ne10_slerp_v[k]) * xm1) * acc;
+    return t * acc;
+}
+
+ne10_result_t ne10_slerp_quatf_c (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_4POINTER (dst, src1, src2, t);
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x1 = src1[i].x, y1 = src1[i].y, z1 = src1[i].z, w1 = src1[i].w;
+        ne10_float32_t x2 = src2[i].x, y2 = src2[i].y, z2 = src2[i].z, w2 = src2[i].w;
+        ne10_float32_t cs = x1 * x2 + y1 * y2 + z1 * z2 + w1 * w2;
+        ne10_float32_t c1, c2;
+
+        // the shorter way round
+        c1 = ne10_slerp_coef (fabsf (cs) - 1.0f, 1.0f - t[i]);
+        c2 = ne10_slerp_coef (fabsf (cs) - 1.0f, t[i]);
+        if (cs < 0.0f)
+            c2 = -c2;
+
+        dst[i].x = x1 * c1 + x2 * c2;
+        dst[i].y = y1 * c1 + y2 * c2;
+        dst[i].z = z1 * c1 + z2 * c2;
+        dst[i].w = w1 * c1 + w2 * c2;
+    }
+    return NE10_OK;
+}
+
+/* v + 2w (u x v) + 2u x (u x v), with u the vector part of q */
+ne10_result_t ne10_rotate_vec3f_quatf_c (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_3POINTER (dst, quat, src);
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t qx = quat[i].x, qy = quat[i].y, qz = quat[i].z, qw = quat[i].w;
+        ne10_float32_t vx = src[i].x, vy = src[i].y, vz = src[i].z;
+        ne10_float32_t tx = 2.0f * (qy * vz - qz * vy);
+        ne10_float32_t ty = 2.0f * (qz * vx - qx * vz);
+        ne10_float32_t tz = 2.0f * (qx * vy - qy * vx);
+
+        dst[i].x = vx + qw * tx + (qy * tz - qz * ty);
+        dst[i].y = vy + qw * ty + (qz * tx - qx * tz);
+        dst[i].z = vz + qw * tz + (qx * ty - qy * tx);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_quatf_to_mat3x3f_c (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x = src[i].x, y = src[i].y, z = src[i].z, w = src[i].w;
+        ne10_float32_t xx = x * x, yy = y * y, zz = z * z;
+        ne10_float32_t xy = x * y, xz = x * z, yz = y * z;
+        ne10_float32_t wx = w * x, wy = w * y, wz = w * z;
+
+        dst[i].c1.r1 = 1.0f - 2.0f * (yy + zz);
+        dst[i].c1.r2 = 2.0f * (xy + wz);
+        dst[i].c1.r3 = 2.0f * (xz - wy);
+        dst[i].c2.r1 = 2.0f * (xy - wz);
+        dst[i].c2.r2 = 1.0f - 2.0f * (xx + zz);
+        dst[i].c2.r3 = 2.0f * (yz + wx);
+        dst[i].c3.r1 = 2.0f * (xz + wy);
+        dst[i].c3.r2 = 2.0f * (yz - wx);
+        dst[i].c3.r3 = 1.0f - 2.0f * (xx + yy);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_quatf_to_mat4x4f_c (ne10_mat4x4f_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x = src[i].x, y = src[i].y, z = src[i].z, w = src[i].w;
+        ne10_float32_t xx = x * x, yy = y * y, zz = z * z;
+        ne10_float32_t xy = x * y, xz = x * z, yz = y * z;
+        ne10_float32_t wx = w * x, wy = w * y, wz = w * z;
+
+        dst[i].c1.r1 = 1.0f - 2.0f * (yy + zz);
+        dst[i].c1.r2 = 2.0f * (xy + wz);
+        dst[i].c1.r3 = 2.0f * (xz - wy);
+        dst[i].c1.r4 = 0.0f;
+        dst[i].c2.r1 = 2.0f * (xy - wz);
+        dst[i].c2.r2 = 1.0f - 2.0f * (xx + zz);
+        dst[i].c2.r3 = 2.0f * (yz + wx);
+        dst[i].c2.r4 = 0.0f;
+        dst[i].c3.r1 = 2.0f * (xz + wy);
+        dst[i].c3.r2 = 2.0f * (yz - wx);
+        dst[i].c3.r3 = 1.0f - 2.0f * (xx + yy);
+        dst[i].c3.r4 = 0.0f;
+        dst[i].c4.r1 = 0.0f;
+        dst[i].c4.r2 = 0.0f;
+        dst[i].c4.r3 = 0.0f;
+        dst[i].c4.r4 = 1.0f;
+    }
+    return NE10_OK;
+}
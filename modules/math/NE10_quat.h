@@ -0,0 +1,69 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_quat.h
+ */
+
+/*
+ * The slerp coefficients shared by the C and NEON versions of
+ * ne10_slerp_quatf. For unit quaternions with cos(theta) = x >= 0, slerp is
+ * q0 * c(1 - t) + q1 * c(t), where c(t) = sin(t * theta) / sin(theta). As in
+ * D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP", c(t) is
+ * evaluated from its series in (x - 1),
+ *
+ *     c(t) = t * (1 + b[0] * (1 + b[1] * (1 + ... (1 + b[N - 1]))))
+ *     b[i] = (u[i] * t * t - v[i]) * (x - 1)
+ *     u[i] = 1 / ((i + 1) * (2i + 3)),  v[i] = (i + 1) / (2i + 3)
+ *
+ * with the last term scaled to stand in for the rest of the series. With 14
+ * terms the largest error over 0 <= x, t <= 1 is 1.5e-7. Only multiplies and
+ * adds are needed, and no lane takes a different path.
+ */
+
+#ifndef NE10_QUAT_H
+#define NE10_QUAT_H
+
+#include "NE10_types.h"
+
+#define NE10_SLERP_TERMS 14
+
+static const ne10_float32_t ne10_slerp_u[NE10_SLERP_TERMS] =
+{
+    0.333333333f, 0.1f, 0.0476190476f, 0.0277777778f, 0.0181818182f, 0.0128205128f, 0.00952380952f,
+    0.00735294118f, 0.00584795322f, 0.00476190476f, 0.00395256917f, 0.00333333333f, 0.00284900285f,
+    0.00469603645f
+};
+
+static const ne10_float32_t ne10_slerp_v[NE10_SLERP_TERMS] =
+{
+    0.333333333f, 0.4f, 0.428571429f, 0.444444444f, 0.454545455f, 0.461538462f, 0.466666667f,
+    0.470588235f, 0.473684211f, 0.476190476f, 0.47826087f, 0.48f, 0.481481481f,
+    0.920423145f
+};
+
+#endif // NE10_QUAT_H
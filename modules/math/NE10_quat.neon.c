@@ -0,0 +1,267 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_quat.neon.c
+ */
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_math.neonintrinsic.h"
+#include "NE10_quat.h"
+
+/*
+ * Four quaternions are de-interleaved into x, y, z and w registers with one
+ * structure load, so every lane works on a different quaternion with the
+ * operations of the C versions, in the same order. The last count % 4
+ * elements go through the C versions.
+ */
+
+static inline float32x4_t ne10_dot_quatf_neon (float32x4x4_t a, float32x4x4_t b)
+{
+    float32x4_t d = vmulq_f32 (a.val[0], b.val[0]);
+    d = vaddq_f32 (d, vmulq_f32 (a.val[1], b.val[1]));
+    d = vaddq_f32 (d, vmulq_f32 (a.val[2], b.val[2]));
+    return vaddq_f32 (d, vmulq_f32 (a.val[3], b.val[3]));
+}
+
+/* a * ca + b * cb, component by component */
+static inline float32x4x4_t ne10_blend_quatf_neon (float32x4x4_t a, float32x4_t ca, float32x4x4_t b, float32x4_t cb)
+{
+    float32x4x4_t r;
+    ne10_int32_t k;
+
+    for (k = 0; k < 4; k++)
+        r.val[k] = vaddq_f32 (vmulq_f32 (a.val[k], ca), vmulq_f32 (b.val[k], cb));
+    return r;
+}
+
+static inline float32x4x4_t ne10_normalize_quatf_x4_neon (float32x4x4_t q)
+{
+    float32x4_t len = ne10_sqrt_f32_neon (ne10_dot_quatf_neon (q, q));
+    ne10_int32_t k;
+
+    for (k = 0; k < 4; k++)
+        q.val[k] = ne10_div_f32_neon (q.val[k], len);
+    return q;
+}
+
+ne10_result_t ne10_mul_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t a = vld4q_f32 ( (ne10_float32_t*) (src1 + i));
+        float32x4x4_t b = vld4q_f32 ( (ne10_float32_t*) (src2 + i));
+        float32x4x4_t r;
+
+        r.val[0] = vmulq_f32 (a.val[3], b.val[0]);
+        r.val[0] = vaddq_f32 (r.val[0], vmulq_f32 (a.val[0], b.val[3]));
+        r.val[0] = vaddq_f32 (r.val[0], vmulq_f32 (a.val[1], b.val[2]));
+        r.val[0] = vsubq_f32 (r.val[0], vmulq_f32 (a.val[2], b.val[1]));
+
+        r.val[1] = vmulq_f32 (a.val[3], b.val[1]);
+        r.val[1] = vsubq_f32 (r.val[1], vmulq_f32 (a.val[0], b.val[2]));
+        r.val[1] = vaddq_f32 (r.val[1], vmulq_f32 (a.val[1], b.val[3]));
+        r.val[1] = vaddq_f32 (r.val[1], vmulq_f32 (a.val[2], b.val[0]));
+
+        r.val[2] = vmulq_f32 (a.val[3], b.val[2]);
+        r.val[2] = vaddq_f32 (r.val[2], vmulq_f32 (a.val[0], b.val[1]));
+        r.val[2] = vsubq_f32 (r.val[2], vmulq_f32 (a.val[1], b.val[0]));
+        r.val[2] = vaddq_f32 (r.val[2], vmulq_f32 (a.val[2], b.val[3]));
+
+        r.val[3] = vmulq_f32 (a.val[3], b.val[3]);
+        r.val[3] = vsubq_f32 (r.val[3], vmulq_f32 (a.val[0], b.val[0]));
+        r.val[3] = vsubq_f32 (r.val[3], vmulq_f32 (a.val[1], b.val[1]));
+        r.val[3] = vsubq_f32 (r.val[3], vmulq_f32 (a.val[2], b.val[2]));
+
+        vst4q_f32 ( (ne10_float32_t*) (dst + i), r);
+    }
+    return ne10_mul_quatf_c (dst + i, src1 + i, src2 + i, count - i);
+}
+
+ne10_result_t ne10_normalize_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t q = vld4q_f32 ( (ne10_float32_t*) (src + i));
+        vst4q_f32 ( (ne10_float32_t*) (dst + i), ne10_normalize_quatf_x4_neon (q));
+    }
+    return ne10_normalize_quatf_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_nlerp_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_4POINTER (dst, src1, src2, t);
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t a = vld4q_f32 ( (ne10_float32_t*) (src1 + i));
+        float32x4x4_t b = vld4q_f32 ( (ne10_float32_t*) (src2 + i));
+        float32x4_t s = vld1q_f32 (t + i);
+        float32x4_t d = vsubq_f32 (vdupq_n_f32 (1.0f), s);
+        uint32x4_t flip = vcltq_f32 (ne10_dot_quatf_neon (a, b), vdupq_n_f32 (0.0f));
+
+        s = vbslq_f32 (flip, vnegq_f32 (s), s);
+        vst4q_f32 ( (ne10_float32_t*) (dst + i), ne10_normalize_quatf_x4_neon (ne10_blend_quatf_neon (a, d, b, s)));
+    }
+    return ne10_nlerp_quatf_c (dst + i, src1 + i, src2 + i, t + i, count - i);
+}
+
+/* the series of NE10_quat.h, for four angles and parameters at once */
+static inline float32x4_t ne10_slerp_coef_neon (float32x4_t xm1, float32x4_t t)
+{
+    float32x4_t tt = vmulq_f32 (t, t);
+    float32x4_t one = vdupq_n_f32 (1.0f);
+    float32x4_t acc = one;
+    ne10_int32_t k;
+
+    for (k = NE10_SLERP_TERMS - 1; k >= 0; k--)
+    {
+        float32x4_t b = vsubq_f32 (vmulq_n_f32 (tt, ne10_slerp_u[k]), vdupq_n_f32 (ne10_slerp_v[k]));
+        acc = vaddq_f32 (one, vmulq_f32 (vmulq_f32 (b, xm1), acc));
+    }
+    return vmulq_f32 (t, acc);
+}
+
+ne10_result_t ne10_slerp_quatf_neon (ne10_quatf_t * dst, ne10_quatf_t * src1, ne10_quatf_t * src2, ne10_float32_t * t, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_4POINTER (dst, src1, src2, t);
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t a = vld4q_f32 ( (ne10_float32_t*) (src1 + i));
+        float32x4x4_t b = vld4q_f32 ( (ne10_float32_t*) (src2 + i));
+        float32x4_t s = vld1q_f32 (t + i);
+        float32x4_t cs = ne10_dot_quatf_neon (a, b);
+        float32x4_t xm1 = vsubq_f32 (vabsq_f32 (cs), vdupq_n_f32 (1.0f));
+        float32x4_t c1 = ne10_slerp_coef_neon (xm1, vsubq_f32 (vdupq_n_f32 (1.0f), s));
+        float32x4_t c2 = ne10_slerp_coef_neon (xm1, s);
+        uint32x4_t flip = vcltq_f32 (cs, vdupq_n_f32 (0.0f));
+
+        c2 = vbslq_f32 (flip, vnegq_f32 (c2), c2);
+        vst4q_f32 ( (ne10_float32_t*) (dst + i), ne10_blend_quatf_neon (a, c1, b, c2));
+    }
+    return ne10_slerp_quatf_c (dst + i, src1 + i, src2 + i, t + i, count - i);
+}
+
+ne10_result_t ne10_rotate_vec3f_quatf_neon (ne10_vec3f_t * dst, ne10_quatf_t * quat, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_3POINTER (dst, quat, src);
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t q = vld4q_f32 ( (ne10_float32_t*) (quat + i));
+        float32x4x3_t v = vld3q_f32 ( (ne10_float32_t*) (src + i));
+        float32x4_t two = vdupq_n_f32 (2.0f);
+        float32x4_t tx, ty, tz;
+        float32x4x3_t r;
+
+        tx = vmulq_f32 (two, vsubq_f32 (vmulq_f32 (q.val[1], v.val[2]), vmulq_f32 (q.val[2], v.val[1])));
+        ty = vmulq_f32 (two, vsubq_f32 (vmulq_f32 (q.val[2], v.val[0]), vmulq_f32 (q.val[0], v.val[2])));
+        tz = vmulq_f32 (two, vsubq_f32 (vmulq_f32 (q.val[0], v.val[1]), vmulq_f32 (q.val[1], v.val[0])));
+
+        r.val[0] = vaddq_f32 (vaddq_f32 (v.val[0], vmulq_f32 (q.val[3], tx)),
+                              vsubq_f32 (vmulq_f32 (q.val[1], tz), vmulq_f32 (q.val[2], ty)));
+        r.val[1] = vaddq_f32 (vaddq_f32 (v.val[1], vmulq_f32 (q.val[3], ty)),
+                              vsubq_f32 (vmulq_f32 (q.val[2], tx), vmulq_f32 (q.val[0], tz)));
+        r.val[2] = vaddq_f32 (vaddq_f32 (v.val[2], vmulq_f32 (q.val[3], tz)),
+                              vsubq_f32 (vmulq_f32 (q.val[0], ty), vmulq_f32 (q.val[1], tx)));
+        vst3q_f32 ( (ne10_float32_t*) (dst + i), r);
+    }
+    return ne10_rotate_vec3f_quatf_c (dst + i, quat + i, src + i, count - i);
+}
+
+/* the upper 3x3 block, in the structure-of-arrays order of ne10_store_3x3f_soa_neon */
+static inline void ne10_quatf_to_mat3x3f_x4_neon (float32x4_t * m, float32x4x4_t q)
+{
+    float32x4_t x = q.val[0], y = q.val[1], z = q.val[2], w = q.val[3];
+    float32x4_t xx = vmulq_f32 (x, x), yy = vmulq_f32 (y, y), zz = vmulq_f32 (z, z);
+    float32x4_t xy = vmulq_f32 (x, y), xz = vmulq_f32 (x, z), yz = vmulq_f32 (y, z);
+    float32x4_t wx = vmulq_f32 (w, x), wy = vmulq_f32 (w, y), wz = vmulq_f32 (w, z);
+    float32x4_t one = vdupq_n_f32 (1.0f);
+    float32x4_t two = vdupq_n_f32 (2.0f);
+
+    m[0] = vsubq_f32 (one, vmulq_f32 (two, vaddq_f32 (yy, zz)));
+    m[1] = vmulq_f32 (two, vaddq_f32 (xy, wz));
+    m[2] = vmulq_f32 (two, vsubq_f32 (xz, wy));
+    m[3] = vmulq_f32 (two, vsubq_f32 (xy, wz));
+    m[4] = vsubq_f32 (one, vmulq_f32 (two, vaddq_f32 (xx, zz)));
+    m[5] = vmulq_f32 (two, vaddq_f32 (yz, wx));
+    m[6] = vmulq_f32 (two, vaddq_f32 (xz, wy));
+    m[7] = vmulq_f32 (two, vsubq_f32 (yz, wx));
+    m[8] = vsubq_f32 (one, vmulq_f32 (two, vaddq_f32 (xx, yy)));
+}
+
+ne10_result_t ne10_quatf_to_mat3x3f_neon (ne10_mat3x3f_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    float32x4_t m[9];
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        ne10_quatf_to_mat3x3f_x4_neon (m, vld4q_f32 ( (ne10_float32_t*) (src + i)));
+        ne10_store_3x3f_soa_neon (dst + i, m);
+    }
+    return ne10_quatf_to_mat3x3f_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_quatf_to_mat4x4f_neon (ne10_mat4x4f_t * dst, ne10_quatf_t * src, ne10_uint32_t count)
+{
+    float32x4_t m3[9], m[16];
+    float32x4_t zero = vdupq_n_f32 (0.0f);
+    ne10_uint32_t i;
+    ne10_int32_t c, r;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        ne10_quatf_to_mat3x3f_x4_neon (m3, vld4q_f32 ( (ne10_float32_t*) (src + i)));
+        for (c = 0; c < 3; c++)
+        {
+            for (r = 0; r < 3; r++)
+                m[4 * c + r] = m3[3 * c + r];
+            m[4 * c + 3] = zero;
+            m[12 + c] = zero;
+        }
+        m[15] = vdupq_n_f32 (1.0f);
+        ne10_store_4x4f_soa_neon (dst + i, m);
+    }
+    return ne10_quatf_to_mat4x4f_c (dst + i, src + i, count - i);
+}
@@ -0,0 +1,210 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_reduce.c
+ */
+
+#include <math.h>
+
+#include "NE10_types.h"
+#include "NE10_reduce.h"
+
+/*
+ * The C versions run the whole array through the tail loops of the vector
+ * versions (see NE10_reduce.h), so every version adds in the same order.
+ */
+
+static ne10_float32_t ne10_reduce_float_c (ne10_reduce_op_t op,
+        const ne10_float32_t * src1,
+        const ne10_float32_t * src2,
+        ne10_uint32_t count)
+{
+    ne10_float32_t acc[NE10_REDUCE_LANES] = { 0.0f };
+
+    return ne10_reduce_finish (acc, op, src1, src2, count);
+}
+
+ne10_result_t ne10_sum_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = ne10_reduce_float_c (NE10_REDUCE_SUM, src, src, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mean_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    if (count == 0)
+        return NE10_ERR;
+    *dst = ne10_reduce_float_c (NE10_REDUCE_SUM, src, src, count) / (ne10_float32_t) count;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_dotprod_float_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    *dst = ne10_reduce_float_c (NE10_REDUCE_DOT, src1, src2, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm2_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = sqrtf (ne10_reduce_float_c (NE10_REDUCE_SUMSQ, src, src, count));
+    return NE10_OK;
+}
+
+static ne10_result_t ne10_extreme_float_c (ne10_float32_t * dst,
+        ne10_uint32_t * index,
+        const ne10_float32_t * src,
+        ne10_uint32_t count,
+        ne10_reduce_cmp_t op)
+{
+    ne10_float32_t best = NAN;
+    ne10_uint32_t i, first = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x = ne10_reduce_key (src[i], op);
+
+        if (ne10_reduce_better (x, best, op))
+        {
+            best = x;
+            first = i;
+        }
+    }
+    *dst = ne10_reduce_key (src[first], op);
+    *index = first;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_max_float_c (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return ne10_extreme_float_c (dst, index, src, count, NE10_REDUCE_MAX);
+}
+
+ne10_result_t ne10_min_float_c (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return ne10_extreme_float_c (dst, index, src, count, NE10_REDUCE_MIN);
+}
+
+ne10_result_t ne10_maxabs_float_c (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return ne10_extreme_float_c (dst, index, src, count, NE10_REDUCE_MAXABS);
+}
+
+/*
+ * Fixed-point reductions. The sums are exact, so they do not depend on the
+ * order of the additions.
+ */
+
+ne10_result_t ne10_sum_int16_c (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count)
+{
+    ne10_int64_t acc = 0;
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+        acc += src[i];
+    *dst = acc;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sum_int32_c (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count)
+{
+    ne10_int64_t acc = 0;
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+        acc += src[i];
+    *dst = acc;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_dotprod_int16_c (ne10_int64_t * dst, ne10_int16_t * src1, ne10_int16_t * src2, ne10_uint32_t count)
+{
+    ne10_int64_t acc = 0;
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+        acc += (ne10_int32_t) src1[i] * src2[i];
+    *dst = acc;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_dotprod_int32_c (ne10_int64_t * dst, ne10_int32_t * src1, ne10_int32_t * src2, ne10_uint32_t count)
+{
+    ne10_int64_t acc = 0;
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+        acc += ( (ne10_int64_t) src1[i] * src2[i]) >> 31;
+    *dst = acc;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_maxabs_int16_c (ne10_int16_t * dst, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count)
+{
+    ne10_int16_t best = -1;
+    ne10_uint32_t i, first = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+    for (i = 0; i < count; i++)
+    {
+        ne10_int16_t x = ne10_reduce_qabs16 (src[i]);
+
+        if (x > best)
+        {
+            best = x;
+            first = i;
+        }
+    }
+    *dst = best;
+    *index = first;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_maxabs_int32_c (ne10_int32_t * dst, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count)
+{
+    ne10_int32_t best = -1;
+    ne10_uint32_t i, first = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+    for (i = 0; i < count; i++)
+    {
+        ne10_int32_t x = ne10_reduce_qabs32 (src[i]);
+
+        if (x > best)
+        {
+            best = x;
+            first = i;
+        }
+    }
+    *dst = best;
+    *index = first;
+    return NE10_OK;
+}
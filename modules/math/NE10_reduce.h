@@ -0,0 +1,188 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_reduce.h
+ */
+
+/*
+ * Helpers shared by the C, NEON and x86 reductions, so that all of them
+ * give the same results.
+ *
+ * Sums are kept in NE10_REDUCE_LANES partial sums: element i is added to
+ * partial sum i % NE10_REDUCE_LANES, in order, and the partial sums are then
+ * combined pairwise (the upper half is added to the lower half until one is
+ * left). The vector versions hold the partial sums in registers and finish
+ * with ne10_reduce_finish.
+ *
+ * Searches for an extreme value go through the source in blocks of
+ * NE10_REDUCE_BLOCK elements: the extreme of each block is found with the
+ * vector unit and the first block holding the overall extreme is searched
+ * again for its first index. NaNs are skipped.
+ */
+
+#ifndef NE10_REDUCE_H
+#define NE10_REDUCE_H
+
+#include <math.h>
+
+#include "NE10_types.h"
+
+#define NE10_REDUCE_LANES 32
+#define NE10_REDUCE_BLOCK 1024
+
+typedef enum
+{
+    NE10_REDUCE_SUM,
+    NE10_REDUCE_DOT,
+    NE10_REDUCE_SUMSQ
+} ne10_reduce_op_t;
+
+typedef enum
+{
+    NE10_REDUCE_MAX,
+    NE10_REDUCE_MIN,
+    NE10_REDUCE_MAXABS
+} ne10_reduce_cmp_t;
+
+/*
+ * Adds the terms of src1[0..count) (and src2) to the partial sums acc, the
+ * first to acc[0], and combines the partial sums.
+ */
+static inline ne10_float32_t ne10_reduce_finish (ne10_float32_t * acc,
+        ne10_reduce_op_t op,
+        const ne10_float32_t * src1,
+        const ne10_float32_t * src2,
+        ne10_uint32_t count)
+{
+    ne10_uint32_t i, w;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x = src1[i];
+
+        if (op == NE10_REDUCE_DOT)
+            x = x * src2[i];
+        else if (op == NE10_REDUCE_SUMSQ)
+            x = x * x;
+        acc[i % NE10_REDUCE_LANES] += x;
+    }
+    for (w = NE10_REDUCE_LANES / 2; w > 0; w /= 2)
+    {
+        for (i = 0; i < w; i++)
+            acc[i] += acc[i + w];
+    }
+    return acc[0];
+}
+
+/* the value an element is compared by */
+static inline ne10_float32_t ne10_reduce_key (ne10_float32_t x, ne10_reduce_cmp_t op)
+{
+    return (op == NE10_REDUCE_MAXABS) ? fabsf (x) : x;
+}
+
+/* non-zero if the key x replaces best: it is further out, or best is a NaN and x is not */
+static inline ne10_int32_t ne10_reduce_better (ne10_float32_t x, ne10_float32_t best, ne10_reduce_cmp_t op)
+{
+    if (best != best)
+        return x == x;
+    return (op == NE10_REDUCE_MIN) ? (x < best) : (x > best);
+}
+
+/* the extreme of best and the keys of src[0..count) */
+static inline ne10_float32_t ne10_reduce_extreme (ne10_float32_t best,
+        const ne10_float32_t * src,
+        ne10_uint32_t count,
+        ne10_reduce_cmp_t op)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x = ne10_reduce_key (src[i], op);
+
+        if (ne10_reduce_better (x, best, op))
+            best = x;
+    }
+    return best;
+}
+
+/* the extreme of count keys, NaN if they are all NaNs */
+static inline ne10_float32_t ne10_reduce_extreme_keys (const ne10_float32_t * keys,
+        ne10_uint32_t count,
+        ne10_reduce_cmp_t op)
+{
+    ne10_float32_t best = NAN;
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (ne10_reduce_better (keys[i], best, op))
+            best = keys[i];
+    }
+    return best;
+}
+
+/*
+ * Stores the first element of src[start..start + NE10_REDUCE_BLOCK) (or up to
+ * count) whose key is best, and its index; the element at start if there is
+ * none (every element is a NaN).
+ */
+static inline void ne10_reduce_store_first (ne10_float32_t * dst,
+        ne10_uint32_t * index,
+        const ne10_float32_t * src,
+        ne10_uint32_t count,
+        ne10_uint32_t start,
+        ne10_float32_t best,
+        ne10_reduce_cmp_t op)
+{
+    ne10_uint32_t end = (count - start > NE10_REDUCE_BLOCK) ? start + NE10_REDUCE_BLOCK : count;
+    ne10_uint32_t i;
+
+    for (i = start; i < end; i++)
+    {
+        if (ne10_reduce_key (src[i], op) == best)
+            break;
+    }
+    if (i == end)
+        i = start;
+    *dst = ne10_reduce_key (src[i], op);
+    *index = i;
+}
+
+/* |x|, saturated: -32768 gives 32767 and -2^31 gives 2^31 - 1 */
+static inline ne10_int16_t ne10_reduce_qabs16 (ne10_int16_t x)
+{
+    return (x < 0) ? ( (x == -32768) ? 32767 : -x) : x;
+}
+
+static inline ne10_int32_t ne10_reduce_qabs32 (ne10_int32_t x)
+{
+    return (x < 0) ? ( (x == (ne10_int32_t) 0x80000000) ? 0x7fffffff : -x) : x;
+}
+
+#endif // NE10_REDUCE_H
@@ -0,0 +1,399 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_reduce.neon.c
+ */
+
+#include <math.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "NE10_reduce.h"
+
+/*
+ * NE10_REDUCE_NEON_REGS registers hold the NE10_REDUCE_LANES partial sums
+ * (register k lane j is partial sum 4 * k + j), or the extremes of a block;
+ * the elements left over go through the C loops of NE10_reduce.h.
+ */
+#define NE10_REDUCE_NEON_REGS (NE10_REDUCE_LANES / 4)
+
+/*
+ * One step per register, written out so that the accumulators stay in
+ * registers; the operation is chosen outside the loops.
+ */
+#define NE10_REDUCE_NEON_UNROLL(step) step (0) step (1) step (2) step (3) step (4) step (5) step (6) step (7)
+#define NE10_REDUCE_NEON_FOLD(f) \
+    a[0] = f (a[0], a[4]); a[1] = f (a[1], a[5]); a[2] = f (a[2], a[6]); a[3] = f (a[3], a[7]); \
+    a[0] = f (a[0], a[2]); a[1] = f (a[1], a[3]); a[0] = f (a[0], a[1]);
+#define NE10_REDUCE_NEON_AT(p, k) vld1q_f32 ((p) + i + 4 * (k))
+#define NE10_REDUCE_NEON_DUP(k) a[k] = vdupq_n_f32 (init);
+#define NE10_REDUCE_NEON_STORE(k) vst1q_f32 (acc + 4 * (k), a[k]);
+#define NE10_REDUCE_NEON_SUM(k) a[k] = vaddq_f32 (a[k], NE10_REDUCE_NEON_AT (src1, k));
+#define NE10_REDUCE_NEON_DOT(k) \
+    a[k] = vaddq_f32 (a[k], vmulq_f32 (NE10_REDUCE_NEON_AT (src1, k), NE10_REDUCE_NEON_AT (src2, k)));
+#define NE10_REDUCE_NEON_SUMSQ(k) \
+    a[k] = vaddq_f32 (a[k], vmulq_f32 (NE10_REDUCE_NEON_AT (src1, k), NE10_REDUCE_NEON_AT (src1, k)));
+#define NE10_REDUCE_NEON_MIN(k) a[k] = ne10_reduce_min_neon (NE10_REDUCE_NEON_AT (src, k), a[k]);
+#define NE10_REDUCE_NEON_MAX(k) a[k] = ne10_reduce_max_neon (NE10_REDUCE_NEON_AT (src, k), a[k]);
+#define NE10_REDUCE_NEON_MAXABS(k) a[k] = ne10_reduce_max_neon (vabsq_f32 (NE10_REDUCE_NEON_AT (src, k)), a[k]);
+#define NE10_REDUCE_NEON_LOOP(first, last, step) \
+    for (i = (first); i + NE10_REDUCE_LANES <= (last); i += NE10_REDUCE_LANES) \
+    { \
+        NE10_REDUCE_NEON_UNROLL (step) \
+    }
+
+static inline ne10_float32_t ne10_reduce_float_neon (ne10_reduce_op_t op,
+        const ne10_float32_t * src1,
+        const ne10_float32_t * src2,
+        ne10_uint32_t count)
+{
+    ne10_float32_t acc[NE10_REDUCE_LANES];
+    float32x4_t a[NE10_REDUCE_NEON_REGS];
+    ne10_float32_t init = 0.0f;
+    ne10_uint32_t i = 0;
+
+    NE10_REDUCE_NEON_UNROLL (NE10_REDUCE_NEON_DUP)
+    switch (op)
+    {
+    case NE10_REDUCE_SUM:
+        NE10_REDUCE_NEON_LOOP (0, count, NE10_REDUCE_NEON_SUM)
+        break;
+    case NE10_REDUCE_DOT:
+        NE10_REDUCE_NEON_LOOP (0, count, NE10_REDUCE_NEON_DOT)
+        break;
+    case NE10_REDUCE_SUMSQ:
+        NE10_REDUCE_NEON_LOOP (0, count, NE10_REDUCE_NEON_SUMSQ)
+        break;
+    }
+    NE10_REDUCE_NEON_UNROLL (NE10_REDUCE_NEON_STORE)
+    return ne10_reduce_finish (acc, op, src1 + i, src2 + i, count - i);
+}
+
+ne10_result_t ne10_sum_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = ne10_reduce_float_neon (NE10_REDUCE_SUM, src, src, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_mean_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    if (count == 0)
+        return NE10_ERR;
+    *dst = ne10_reduce_float_neon (NE10_REDUCE_SUM, src, src, count) / (ne10_float32_t) count;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_dotprod_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    *dst = ne10_reduce_float_neon (NE10_REDUCE_DOT, src1, src2, count);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_norm2_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    *dst = sqrtf (ne10_reduce_float_neon (NE10_REDUCE_SUMSQ, src, src, count));
+    return NE10_OK;
+}
+
+/*
+ * (x < e) ? x : e and (x > e) ? x : e, which skip NaNs: vminnm and vmaxnm on
+ * AArch64, a comparison and a select on ARMv7.
+ */
+static inline float32x4_t ne10_reduce_min_neon (float32x4_t x, float32x4_t e)
+{
+#if defined(__aarch64__)
+    return vminnmq_f32 (x, e);
+#else
+    return vbslq_f32 (vcltq_f32 (x, e), x, e);
+#endif
+}
+
+static inline float32x4_t ne10_reduce_max_neon (float32x4_t x, float32x4_t e)
+{
+#if defined(__aarch64__)
+    return vmaxnmq_f32 (x, e);
+#else
+    return vbslq_f32 (vcgtq_f32 (x, e), x, e);
+#endif
+}
+
+/*
+ * The extremes of a block start at -infinity (+infinity for the minimum) and
+ * the registers of a block are folded into one, which does not change the
+ * extreme (equal keys are told apart by the search for the first index). A
+ * block whose extreme is still the start value (only NaNs, or infinities) is
+ * searched again in C.
+ */
+static inline ne10_result_t ne10_extreme_float_neon (ne10_float32_t * dst,
+        ne10_uint32_t * index,
+        const ne10_float32_t * src,
+        ne10_uint32_t count,
+        ne10_reduce_cmp_t op)
+{
+    ne10_float32_t acc[4];
+    ne10_float32_t init = (op == NE10_REDUCE_MIN) ? INFINITY : -INFINITY;
+    ne10_float32_t best = NAN;
+    ne10_uint32_t b, i = 0, start = 0;
+
+    if (count == 0)
+        return NE10_ERR;
+    for (b = 0; b < count; b += NE10_REDUCE_BLOCK)
+    {
+        ne10_uint32_t end = (count - b > NE10_REDUCE_BLOCK) ? b + NE10_REDUCE_BLOCK : count;
+        float32x4_t a[NE10_REDUCE_NEON_REGS];
+        ne10_float32_t m;
+
+        NE10_REDUCE_NEON_UNROLL (NE10_REDUCE_NEON_DUP)
+        switch (op)
+        {
+        case NE10_REDUCE_MIN:
+            NE10_REDUCE_NEON_LOOP (b, end, NE10_REDUCE_NEON_MIN)
+            NE10_REDUCE_NEON_FOLD (ne10_reduce_min_neon)
+            break;
+        case NE10_REDUCE_MAX:
+            NE10_REDUCE_NEON_LOOP (b, end, NE10_REDUCE_NEON_MAX)
+            NE10_REDUCE_NEON_FOLD (ne10_reduce_max_neon)
+            break;
+        case NE10_REDUCE_MAXABS:
+            NE10_REDUCE_NEON_LOOP (b, end, NE10_REDUCE_NEON_MAXABS)
+            NE10_REDUCE_NEON_FOLD (ne10_reduce_max_neon)
+            break;
+        }
+        vst1q_f32 (acc, a[0]);
+        m = ne10_reduce_extreme_keys (acc, 4, op);
+        m = ne10_reduce_extreme (m, src + i, end - i, op);
+        if (m == init)
+            m = ne10_reduce_extreme (NAN, src + b, end - b, op);
+        if (ne10_reduce_better (m, best, op))
+        {
+            best = m;
+            start = b;
+        }
+    }
+    if (best == best)
+    {
+        /* skip the vectors of the winning block that do not hold best */
+        float32x4_t t = vdupq_n_f32 (best);
+
+        for (; start + 4 <= count; start += 4)
+        {
+            float32x4_t x = vld1q_f32 (src + start);
+            uint32x4_t eq;
+
+            if (op == NE10_REDUCE_MAXABS)
+                x = vabsq_f32 (x);
+            eq = vceqq_f32 (x, t);
+#if defined(__aarch64__)
+            if (vmaxvq_u32 (eq))
+                break;
+#else
+            if (vget_lane_u32 (vpmax_u32 (vpmax_u32 (vget_low_u32 (eq), vget_high_u32 (eq)),
+                                          vdup_n_u32 (0)), 0))
+                break;
+#endif
+        }
+    }
+    ne10_reduce_store_first (dst, index, src, count, start, best, op);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_max_float_neon (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return ne10_extreme_float_neon (dst, index, src, count, NE10_REDUCE_MAX);
+}
+
+ne10_result_t ne10_min_float_neon (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return ne10_extreme_float_neon (dst, index, src, count, NE10_REDUCE_MIN);
+}
+
+ne10_result_t ne10_maxabs_float_neon (ne10_float32_t * dst, ne10_uint32_t * index, ne10_float32_t * src, ne10_uint32_t count)
+{
+    return ne10_extreme_float_neon (dst, index, src, count, NE10_REDUCE_MAXABS);
+}
+
+/*
+ * Fixed-point reductions: the sums are widened to 64 bits with pairwise
+ * additions, so they are exact like the C versions.
+ */
+
+static inline ne10_int64_t ne10_reduce_lanes_s64 (int64x2_t a)
+{
+    return vgetq_lane_s64 (a, 0) + vgetq_lane_s64 (a, 1);
+}
+
+ne10_result_t ne10_sum_int16_neon (ne10_int64_t * dst, ne10_int16_t * src, ne10_uint32_t count)
+{
+    int64x2_t a0 = vdupq_n_s64 (0);
+    int64x2_t a1 = a0;
+    ne10_uint32_t i;
+
+    for (i = 0; i + 16 <= count; i += 16)
+    {
+        a0 = vpadalq_s32 (a0, vpaddlq_s16 (vld1q_s16 (src + i)));
+        a1 = vpadalq_s32 (a1, vpaddlq_s16 (vld1q_s16 (src + i + 8)));
+    }
+    ne10_sum_int16_c (dst, src + i, count - i);
+    *dst += ne10_reduce_lanes_s64 (vaddq_s64 (a0, a1));
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sum_int32_neon (ne10_int64_t * dst, ne10_int32_t * src, ne10_uint32_t count)
+{
+    int64x2_t a0 = vdupq_n_s64 (0);
+    int64x2_t a1 = a0;
+    ne10_uint32_t i;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        a0 = vpadalq_s32 (a0, vld1q_s32 (src + i));
+        a1 = vpadalq_s32 (a1, vld1q_s32 (src + i + 4));
+    }
+    ne10_sum_int32_c (dst, src + i, count - i);
+    *dst += ne10_reduce_lanes_s64 (vaddq_s64 (a0, a1));
+    return NE10_OK;
+}
+
+ne10_result_t ne10_dotprod_int16_neon (ne10_int64_t * dst, ne10_int16_t * src1, ne10_int16_t * src2, ne10_uint32_t count)
+{
+    int64x2_t a0 = vdupq_n_s64 (0);
+    int64x2_t a1 = a0;
+    ne10_uint32_t i;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        int16x8_t x = vld1q_s16 (src1 + i);
+        int16x8_t y = vld1q_s16 (src2 + i);
+
+        a0 = vpadalq_s32 (a0, vmull_s16 (vget_low_s16 (x), vget_low_s16 (y)));
+        a1 = vpadalq_s32 (a1, vmull_s16 (vget_high_s16 (x), vget_high_s16 (y)));
+    }
+    ne10_dotprod_int16_c (dst, src1 + i, src2 + i, count - i);
+    *dst += ne10_reduce_lanes_s64 (vaddq_s64 (a0, a1));
+    return NE10_OK;
+}
+
+ne10_result_t ne10_dotprod_int32_neon (ne10_int64_t * dst, ne10_int32_t * src1, ne10_int32_t * src2, ne10_uint32_t count)
+{
+    int64x2_t a0 = vdupq_n_s64 (0);
+    int64x2_t a1 = a0;
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        int32x4_t x = vld1q_s32 (src1 + i);
+        int32x4_t y = vld1q_s32 (src2 + i);
+
+        a0 = vaddq_s64 (a0, vshrq_n_s64 (vmull_s32 (vget_low_s32 (x), vget_low_s32 (y)), 31));
+        a1 = vaddq_s64 (a1, vshrq_n_s64 (vmull_s32 (vget_high_s32 (x), vget_high_s32 (y)), 31));
+    }
+    ne10_dotprod_int32_c (dst, src1 + i, src2 + i, count - i);
+    *dst += ne10_reduce_lanes_s64 (vaddq_s64 (a0, a1));
+    return NE10_OK;
+}
+
+/*
+ * The largest saturated |x| of each block comes from vqabs and vmax; the
+ * first block holding the overall largest is searched again for the index.
+ */
+
+ne10_result_t ne10_maxabs_int16_neon (ne10_int16_t * dst, ne10_uint32_t * index, ne10_int16_t * src, ne10_uint32_t count)
+{
+    ne10_int16_t lanes[8];
+    ne10_int16_t best = -1;
+    ne10_uint32_t b, i, k, start = 0, end;
+
+    if (count == 0)
+        return NE10_ERR;
+    for (b = 0; b < count; b += NE10_REDUCE_BLOCK)
+    {
+        int16x8_t m0 = vdupq_n_s16 (0);
+        int16x8_t m1 = m0;
+        ne10_int16_t m = 0;
+
+        end = (count - b > NE10_REDUCE_BLOCK) ? b + NE10_REDUCE_BLOCK : count;
+        for (i = b; i + 16 <= end; i += 16)
+        {
+            m0 = vmaxq_s16 (m0, vqabsq_s16 (vld1q_s16 (src + i)));
+            m1 = vmaxq_s16 (m1, vqabsq_s16 (vld1q_s16 (src + i + 8)));
+        }
+        vst1q_s16 (lanes, vmaxq_s16 (m0, m1));
+        for (k = 0; k < 8; k++)
+            m = (lanes[k] > m) ? lanes[k] : m;
+        for (; i < end; i++)
+            m = (ne10_reduce_qabs16 (src[i]) > m) ? ne10_reduce_qabs16 (src[i]) : m;
+        if (m > best)
+        {
+            best = m;
+            start = b;
+        }
+    }
+    for (i = start; ne10_reduce_qabs16 (src[i]) != best; i++)
+        ;
+    *dst = best;
+    *index = i;
+    return NE10_OK;
+}
+
+ne10_result_t ne10_maxabs_int32_neon (ne10_int32_t * dst, ne10_uint32_t * index, ne10_int32_t * src, ne10_uint32_t count)
+{
+    ne10_int32_t lanes[4];
+    ne10_int32_t best = -1;
+    ne10_uint32_t b, i, k, start = 0, end;
+
+    if (count == 0)
+        return NE10_ERR;
+    for (b = 0; b < count; b += NE10_REDUCE_BLOCK)
+    {
+        int32x4_t m0 = vdupq_n_s32 (0);
+        int32x4_t m1 = m0;
+        ne10_int32_t m = 0;
+
+        end = (count - b > NE10_REDUCE_BLOCK) ? b + NE10_REDUCE_BLOCK : count;
+        for (i = b; i + 8 <= end; i += 8)
+        {
+            m0 = vmaxq_s32 (m0, vqabsq_s32 (vld1q_s32 (src + i)));
+            m1 = vmaxq_s32 (m1, vqabsq_s32 (vld1q_s32 (src + i + 4)));
+        }
+        vst1q_s32 (lanes, vmaxq_s32 (m0, m1));
+        for (k = 0; k < 4; k++)
+            m = (lanes[k] > m) ? lanes[k] : m;
+        for (; i < end; i++)
+            m = (ne10_reduce_qabs32 (src[i]) > m) ? ne10_reduce_qabs32 (src[i]) : m;
+        if (m > best)
+        {
+            best = m;
+            start = b;
+        }
+    }
+    for (i = start; ne10_reduce_qabs32 (src[i]) != best; i++)
+        ;
+    *dst = best;
+    *index = i;
+    return NE10_OK;
+}
@@ -0,0 +1,380 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_sgemm.c
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_threadpool.h"
+#include "NE10_sgemm.h"
+
+#if defined (NE10_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#define NE10_SGEMM_MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/* op(A) (i0 .. i0 + mc - 1, p0 .. p0 + kc - 1) into panels of mr rows */
+static void ne10_sgemm_pack_a (ne10_float32_t * dst,
+                               const ne10_float32_t * a,
+                               ne10_uint32_t lda,
+                               ne10_transpose_t trans,
+                               ne10_uint32_t i0,
+                               ne10_uint32_t mc,
+                               ne10_uint32_t p0,
+                               ne10_uint32_t kc,
+                               ne10_uint32_t mr)
+{
+    ne10_uint32_t ir, rows, p, r;
+
+    for (ir = 0; ir < mc; ir += mr)
+    {
+        rows = NE10_SGEMM_MIN (mr, mc - ir);
+        if (trans == NE10_NO_TRANSPOSE)
+        {
+            for (p = 0; p < kc; p++)
+            {
+                const ne10_float32_t *src = a + (i0 + ir) + (p0 + p) * lda;
+                for (r = 0; r < rows; r++)
+                    dst[p * mr + r] = src[r];
+                for (; r < mr; r++)
+                    dst[p * mr + r] = 0.0f;
+            }
+        }
+        else
+        {
+            for (r = 0; r < rows; r++)
+            {
+                const ne10_float32_t *src = a + p0 + (i0 + ir + r) * lda;
+                for (p = 0; p < kc; p++)
+                    dst[p * mr + r] = src[p];
+            }
+            for (; r < mr; r++)
+            {
+                for (p = 0; p < kc; p++)
+                    dst[p * mr + r] = 0.0f;
+            }
+        }
+        dst += mr * kc;
+    }
+}
+
+/* op(B) (p0 .. p0 + kc - 1, j0 .. j0 + nc - 1) into panels of nr columns */
+static void ne10_sgemm_pack_b (ne10_float32_t * dst,
+                               const ne10_float32_t * b,
+                               ne10_uint32_t ldb,
+                               ne10_transpose_t trans,
+                               ne10_uint32_t p0,
+                               ne10_uint32_t kc,
+                               ne10_uint32_t j0,
+                               ne10_uint32_t nc,
+                               ne10_uint32_t nr)
+{
+    ne10_uint32_t jr, cols, p, j;
+
+    for (jr = 0; jr < nc; jr += nr)
+    {
+        cols = NE10_SGEMM_MIN (nr, nc - jr);
+        if (trans == NE10_NO_TRANSPOSE)
+        {
+            for (j = 0; j < cols; j++)
+            {
+                const ne10_float32_t *src = b + p0 + (j0 + jr + j) * ldb;
+                for (p = 0; p < kc; p++)
+                    dst[p * nr + j] = src[p];
+            }
+            for (; j < nr; j++)
+            {
+                for (p = 0; p < kc; p++)
+                    dst[p * nr + j] = 0.0f;
+            }
+        }
+        else
+        {
+            for (p = 0; p < kc; p++)
+            {
+                const ne10_float32_t *src = b + (j0 + jr) + (p0 + p) * ldb;
+                for (j = 0; j < cols; j++)
+                    dst[p * nr + j] = src[j];
+                for (; j < nr; j++)
+                    dst[p * nr + j] = 0.0f;
+            }
+        }
+        dst += nr * kc;
+    }
+}
+
+/* C (ic .. ic + mc - 1, jc .. jc + nc - 1) from one packed block of op(A) and panel of op(B) */
+static void ne10_sgemm_block (ne10_sgemm_kernel_t kernel,
+                              ne10_uint32_t mr,
+                              ne10_uint32_t nr,
+                              ne10_uint32_t mc,
+                              ne10_uint32_t nc,
+                              ne10_uint32_t kc,
+                              const ne10_float32_t * packed_a,
+                              const ne10_float32_t * packed_b,
+                              ne10_float32_t alpha,
+                              ne10_float32_t beta,
+                              ne10_float32_t * c,
+                              ne10_uint32_t ldc)
+{
+    ne10_float32_t tile[NE10_SGEMM_MR_MAX * NE10_SGEMM_NR_MAX];
+    ne10_uint32_t ir, jr, rows, cols, i, j;
+
+    for (jr = 0; jr < nc; jr += nr)
+    {
+        cols = NE10_SGEMM_MIN (nr, nc - jr);
+        for (ir = 0; ir < mc; ir += mr)
+        {
+            const ne10_float32_t *pa = packed_a + ir * kc;
+            const ne10_float32_t *pb = packed_b + jr * kc;
+            ne10_float32_t *pc = c + ir + jr * ldc;
+
+            rows = NE10_SGEMM_MIN (mr, mc - ir);
+            if ( (rows == mr) && (cols == nr))
+            {
+                kernel (kc, pa, pb, alpha, beta, pc, ldc);
+                continue;
+            }
+
+            // Edge tiles go through a full tile on the stack, rounding the same way
+            kernel (kc, pa, pb, alpha, 0.0f, tile, mr);
+            for (j = 0; j < cols; j++)
+            {
+                for (i = 0; i < rows; i++)
+                {
+                    if (beta == 0.0f)
+                        pc[i + j * ldc] = tile[i + j * mr];
+                    else
+                        pc[i + j * ldc] = tile[i + j * mr] + beta * pc[i + j * ldc];
+                }
+            }
+        }
+    }
+}
+
+/* One step along k of a column panel, shared by the threads working on its row blocks */
+typedef struct
+{
+    ne10_sgemm_kernel_t kernel;
+    ne10_uint32_t mr, nr;
+    ne10_uint32_t m, nc, kc, jc, pc;
+    ne10_transpose_t trans_a;
+    const ne10_float32_t * a;
+    ne10_uint32_t lda;
+    ne10_float32_t alpha, beta;
+    ne10_float32_t * packed_a;
+    const ne10_float32_t * packed_b;
+    ne10_float32_t * c;
+    ne10_uint32_t ldc;
+} ne10_sgemm_panel_t;
+
+/* Row blocks begin .. end - 1 of a panel; each slot packs its own part of op(A) */
+static void ne10_sgemm_blocks (ne10_uint32_t begin, ne10_uint32_t end, ne10_uint32_t slot, void * arg)
+{
+    const ne10_sgemm_panel_t * panel = (const ne10_sgemm_panel_t *) arg;
+    ne10_float32_t *pa = panel->packed_a + slot * NE10_SGEMM_MC * NE10_SGEMM_KC;
+    ne10_uint32_t ib;
+
+    for (ib = begin; ib < end; ib++)
+    {
+        ne10_uint32_t ic = ib * NE10_SGEMM_MC;
+        ne10_uint32_t mc = NE10_SGEMM_MIN (NE10_SGEMM_MC, panel->m - ic);
+
+        ne10_sgemm_pack_a (pa, panel->a, panel->lda, panel->trans_a, ic, mc, panel->pc, panel->kc, panel->mr);
+        ne10_sgemm_block (panel->kernel, panel->mr, panel->nr, mc, panel->nc, panel->kc, pa, panel->packed_b,
+                          panel->alpha, panel->beta, panel->c + ic + panel->jc * panel->ldc, panel->ldc);
+    }
+}
+
+ne10_result_t ne10_sgemm_run (ne10_sgemm_kernel_t kernel,
+                              ne10_uint32_t mr,
+                              ne10_uint32_t nr,
+                              ne10_transpose_t trans_a,
+                              ne10_transpose_t trans_b,
+                              ne10_uint32_t m,
+                              ne10_uint32_t n,
+                              ne10_uint32_t k,
+                              ne10_float32_t alpha,
+                              const ne10_float32_t * a,
+                              ne10_uint32_t lda,
+                              const ne10_float32_t * b,
+                              ne10_uint32_t ldb,
+                              ne10_float32_t beta,
+                              ne10_float32_t * c,
+                              ne10_uint32_t ldc)
+{
+    ne10_uint32_t rows_a = (trans_a == NE10_NO_TRANSPOSE) ? m : k;
+    ne10_uint32_t rows_b = (trans_b == NE10_NO_TRANSPOSE) ? k : n;
+    ne10_uint32_t blocks, threads = 1;
+    ne10_uint32_t i, j, jc, pc;
+    ne10_float32_t *packed_a, *packed_b;
+    ne10_sgemm_panel_t panel;
+#if defined (NE10_ENABLE_OPENMP)
+    ne10_int32_t ib;
+#endif
+
+    if ( (lda < rows_a) || (lda == 0) || (ldb < rows_b) || (ldb == 0) || (ldc < m) || (ldc == 0)
+            || (mr > NE10_SGEMM_MR_MAX) || (nr > NE10_SGEMM_NR_MAX) || (NE10_SGEMM_MC % mr != 0))
+    {
+        return NE10_ERR;
+    }
+    if ( (m == 0) || (n == 0))
+    {
+        return NE10_OK;
+    }
+
+    // C = beta * C when there is no product to add
+    if ( (k == 0) || (alpha == 0.0f))
+    {
+        for (j = 0; j < n; j++)
+        {
+            for (i = 0; i < m; i++)
+            {
+                if (beta == 0.0f)
+                    c[i + j * ldc] = 0.0f;
+                else
+                    c[i + j * ldc] *= beta;
+            }
+        }
+        return NE10_OK;
+    }
+
+    blocks = (m + NE10_SGEMM_MC - 1) / NE10_SGEMM_MC;
+#if defined (NE10_ENABLE_OPENMP)
+    threads = NE10_SGEMM_MIN ( (ne10_uint32_t) omp_get_max_threads(), blocks);
+#else
+    threads = NE10_SGEMM_MIN (ne10_threadpool_size(), blocks);
+#endif
+    packed_a = (ne10_float32_t*) NE10_MALLOC (threads * NE10_SGEMM_MC * NE10_SGEMM_KC * sizeof (ne10_float32_t));
+    packed_b = (ne10_float32_t*) NE10_MALLOC ( (NE10_SGEMM_NC + nr) * NE10_SGEMM_KC * sizeof (ne10_float32_t));
+    if ( (packed_a == NULL) || (packed_b == NULL))
+    {
+        NE10_FREE (packed_a);
+        NE10_FREE (packed_b);
+        return NE10_ERR;
+    }
+
+    panel.kernel = kernel;
+    panel.mr = mr;
+    panel.nr = nr;
+    panel.m = m;
+    panel.trans_a = trans_a;
+    panel.a = a;
+    panel.lda = lda;
+    panel.alpha = alpha;
+    panel.packed_a = packed_a;
+    panel.packed_b = packed_b;
+    panel.c = c;
+    panel.ldc = ldc;
+    for (jc = 0; jc < n; jc += NE10_SGEMM_NC)
+    {
+        panel.jc = jc;
+        panel.nc = NE10_SGEMM_MIN (NE10_SGEMM_NC, n - jc);
+        for (pc = 0; pc < k; pc += NE10_SGEMM_KC)
+        {
+            // The later steps along k accumulate onto the first one
+            panel.beta = (pc == 0) ? beta : 1.0f;
+            panel.pc = pc;
+            panel.kc = NE10_SGEMM_MIN (NE10_SGEMM_KC, k - pc);
+            ne10_sgemm_pack_b (packed_b, b, ldb, trans_b, pc, panel.kc, jc, panel.nc, nr);
+
+            // The row blocks are independent, and are shared out between the threads
+#if defined (NE10_ENABLE_OPENMP)
+            #pragma omp parallel for num_threads (threads) schedule (static)
+            for (ib = 0; ib < (ne10_int32_t) blocks; ib++)
+            {
+                ne10_sgemm_blocks (ib, ib + 1, omp_get_thread_num(), &panel);
+            }
+#else
+            ne10_parallel_for (0, blocks, 1, ne10_sgemm_blocks, &panel);
+#endif
+        }
+    }
+
+    NE10_FREE (packed_a);
+    NE10_FREE (packed_b);
+    return NE10_OK;
+}
+
+/*
+ * The C micro-kernel: an 8 x 4 tile, the same as the NEON one, so that the
+ * two round identically.
+ */
+static void ne10_sgemm_kernel_c (ne10_uint32_t kc,
+                                 const ne10_float32_t * a,
+                                 const ne10_float32_t * b,
+                                 ne10_float32_t alpha,
+                                 ne10_float32_t beta,
+                                 ne10_float32_t * c,
+                                 ne10_uint32_t ldc)
+{
+    ne10_float32_t ab[4][8] = {{0.0f}};
+    ne10_uint32_t p, i, j;
+
+    for (p = 0; p < kc; p++)
+    {
+        for (j = 0; j < 4; j++)
+        {
+            for (i = 0; i < 8; i++)
+                ab[j][i] += a[i] * b[j];
+        }
+        a += 8;
+        b += 4;
+    }
+
+    for (j = 0; j < 4; j++)
+    {
+        for (i = 0; i < 8; i++)
+        {
+            if (beta == 0.0f)
+                c[i + j * ldc] = alpha * ab[j][i];
+            else
+                c[i + j * ldc] = alpha * ab[j][i] + beta * c[i + j * ldc];
+        }
+    }
+}
+
+ne10_result_t ne10_sgemm_c (ne10_transpose_t trans_a,
+                            ne10_transpose_t trans_b,
+                            ne10_uint32_t m,
+                            ne10_uint32_t n,
+                            ne10_uint32_t k,
+                            ne10_float32_t alpha,
+                            const ne10_float32_t * a,
+                            ne10_uint32_t lda,
+                            const ne10_float32_t * b,
+                            ne10_uint32_t ldb,
+                            ne10_float32_t beta,
+                            ne10_float32_t * c,
+                            ne10_uint32_t ldc)
+{
+    return ne10_sgemm_run (ne10_sgemm_kernel_c, 8, 4, trans_a, trans_b, m, n, k,
+                           alpha, a, lda, b, ldb, beta, c, ldc);
+}
@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_sgemm.h
+ */
+
+/*
+ * The blocked driver shared by every implementation of ne10_sgemm. Each
+ * implementation only supplies a micro-kernel that computes one MR x NR tile
+ * of C from packed panels of A and B; the driver does the cache blocking,
+ * the packing, the edge tiles and the optional OpenMP parallel loop.
+ *
+ * op(A) is packed in panels of MR rows, stored k-major (MR values per k), and
+ * op(B) in panels of NR columns, stored k-major (NR values per k). Partial
+ * panels are padded with zeros, so the micro-kernels never see edges.
+ */
+
+#ifndef NE10_SGEMM_H
+#define NE10_SGEMM_H
+
+#include "NE10_types.h"
+
+/* cache blocking: a KC x NC panel of op(B) is packed once and shared, and
+ * each MC x KC block of op(A) is packed into L2 */
+#define NE10_SGEMM_KC 256
+#define NE10_SGEMM_MC 128
+#define NE10_SGEMM_NC 2048
+
+/* the largest micro-tile of any implementation */
+#define NE10_SGEMM_MR_MAX 16
+#define NE10_SGEMM_NR_MAX 8
+
+/*
+ * Computes the MR x NR tile ab = a * b over kc steps, accumulating in order of
+ * increasing k with separate multiplies and adds, and stores
+ * c = alpha * ab + beta * c (or c = alpha * ab, without reading c, when beta
+ * is zero). c is column major with leading dimension ldc.
+ */
+typedef void (*ne10_sgemm_kernel_t) (ne10_uint32_t kc,
+                                     const ne10_float32_t * a,
+                                     const ne10_float32_t * b,
+                                     ne10_float32_t alpha,
+                                     ne10_float32_t beta,
+                                     ne10_float32_t * c,
+                                     ne10_uint32_t ldc);
+
+extern ne10_result_t ne10_sgemm_run (ne10_sgemm_kernel_t kernel,
+                                     ne10_uint32_t mr,
+                                     ne10_uint32_t nr,
+                                     ne10_transpose_t trans_a,
+                                     ne10_transpose_t trans_b,
+                                     ne10_uint32_t m,
+                                     ne10_uint32_t n,
+                                     ne10_uint32_t k,
+                                     ne10_float32_t alpha,
+                                     const ne10_float32_t * a,
+                                     ne10_uint32_t lda,
+                                     const ne10_float32_t * b,
+                                     ne10_uint32_t ldb,
+                                     ne10_float32_t beta,
+                                     ne10_float32_t * c,
+                                     ne10_uint32_t ldc);
+
+#endif // NE10_SGEMM_H
@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_sgemm.neon.c
+ */
+
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "NE10_sgemm.h"
+
+/*
+ * 8 x 4 micro-kernel: two q registers hold a column of the A panel and each of
+ * the four B values scales them into its own pair of accumulators, which
+ * leaves room for the operands in the sixteen q registers of ARMv7.
+ */
+static void ne10_sgemm_kernel_neon (ne10_uint32_t kc,
+                                    const ne10_float32_t * a,
+                                    const ne10_float32_t * b,
+                                    ne10_float32_t alpha,
+                                    ne10_float32_t beta,
+                                    ne10_float32_t * c,
+                                    ne10_uint32_t ldc)
+{
+    float32x4_t c00 = vdupq_n_f32 (0.0f), c01 = c00, c10 = c00, c11 = c00;
+    float32x4_t c20 = c00, c21 = c00, c30 = c00, c31 = c00;
+    float32x4_t a0, a1, bv;
+    float32x2_t bl, bh;
+    float32x4_t valpha = vdupq_n_f32 (alpha);
+    float32x4_t vbeta = vdupq_n_f32 (beta);
+    ne10_uint32_t p;
+
+    for (p = 0; p < kc; p++)
+    {
+        a0 = vld1q_f32 (a);
+        a1 = vld1q_f32 (a + 4);
+        bv = vld1q_f32 (b);
+        bl = vget_low_f32 (bv);
+        bh = vget_high_f32 (bv);
+        c00 = vaddq_f32 (c00, vmulq_lane_f32 (a0, bl, 0));
+        c01 = vaddq_f32 (c01, vmulq_lane_f32 (a1, bl, 0));
+        c10 = vaddq_f32 (c10, vmulq_lane_f32 (a0, bl, 1));
+        c11 = vaddq_f32 (c11, vmulq_lane_f32 (a1, bl, 1));
+        c20 = vaddq_f32 (c20, vmulq_lane_f32 (a0, bh, 0));
+        c21 = vaddq_f32 (c21, vmulq_lane_f32 (a1, bh, 0));
+        c30 = vaddq_f32 (c30, vmulq_lane_f32 (a0, bh, 1));
+        c31 = vaddq_f32 (c31, vmulq_lane_f32 (a1, bh, 1));
+        a += 8;
+        b += 4;
+    }
+
+    c00 = vmulq_f32 (c00, valpha);
+    c01 = vmulq_f32 (c01, valpha);
+    c10 = vmulq_f32 (c10, valpha);
+    c11 = vmulq_f32 (c11, valpha);
+    c20 = vmulq_f32 (c20, valpha);
+    c21 = vmulq_f32 (c21, valpha);
+    c30 = vmulq_f32 (c30, valpha);
+    c31 = vmulq_f32 (c31, valpha);
+    if (beta != 0.0f)
+    {
+        c00 = vaddq_f32 (c00, vmulq_f32 (vld1q_f32 (c), vbeta));
+        c01 = vaddq_f32 (c01, vmulq_f32 (vld1q_f32 (c + 4), vbeta));
+        c10 = vaddq_f32 (c10, vmulq_f32 (vld1q_f32 (c + ldc), vbeta));
+        c11 = vaddq_f32 (c11, vmulq_f32 (vld1q_f32 (c + ldc + 4), vbeta));
+        c20 = vaddq_f32 (c20, vmulq_f32 (vld1q_f32 (c + 2 * ldc), vbeta));
+        c21 = vaddq_f32 (c21, vmulq_f32 (vld1q_f32 (c + 2 * ldc + 4), vbeta));
+        c30 = vaddq_f32 (c30, vmulq_f32 (vld1q_f32 (c + 3 * ldc), vbeta));
+        c31 = vaddq_f32 (c31, vmulq_f32 (vld1q_f32 (c + 3 * ldc + 4), vbeta));
+    }
+    vst1q_f32 (c, c00);
+    vst1q_f32 (c + 4, c01);
+    vst1q_f32 (c + ldc, c10);
+    vst1q_f32 (c + ldc + 4, c11);
+    vst1q_f32 (c + 2 * ldc, c20);
+    vst1q_f32 (c + 2 * ldc + 4, c21);
+    vst1q_f32 (c + 3 * ldc, c30);
+    vst1q_f32 (c + 3 * ldc + 4, c31);
+}
+
+ne10_result_t ne10_sgemm_neon (ne10_transpose_t trans_a,
+                               ne10_transpose_t trans_b,
+                               ne10_uint32_t m,
+                               ne10_uint32_t n,
+                               ne10_uint32_t k,
+                               ne10_float32_t alpha,
+                               const ne10_float32_t * a,
+                               ne10_uint32_t lda,
+                               const ne10_float32_t * b,
+                               ne10_uint32_t ldb,
+                               ne10_float32_t beta,
+                               ne10_float32_t * c,
+                               ne10_uint32_t ldc)
+{
+    return ne10_sgemm_run (ne10_sgemm_kernel_neon, 8, 4, trans_a, trans_b, m, n, k,
+                           alpha, a, lda, b, ldb, beta, c, ldc);
+}
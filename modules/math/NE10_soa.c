@@ -0,0 +1,182 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_soa.c
+ */
+
+#include "NE10_types.h"
+#include "macros.h"
+
+#include <assert.h>
+
+#include <math.h>
+
+ne10_result_t ne10_vec3f_aos_to_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst->x[ itr ] = src[ itr ].x;
+        dst->y[ itr ] = src[ itr ].y;
+        dst->z[ itr ] = src[ itr ].z;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_vec3f_soa_to_aos_c (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ].x = src->x[ itr ];
+        dst[ itr ].y = src->y[ itr ];
+        dst[ itr ].z = src->z[ itr ];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_vec4f_aos_to_soa_c (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst->x[ itr ] = src[ itr ].x;
+        dst->y[ itr ] = src[ itr ].y;
+        dst->z[ itr ] = src[ itr ].z;
+        dst->w[ itr ] = src[ itr ].w;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_vec4f_soa_to_aos_c (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ].x = src->x[ itr ];
+        dst[ itr ].y = src->y[ itr ];
+        dst[ itr ].z = src->z[ itr ];
+        dst[ itr ].w = src->w[ itr ];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_len_vec3f_soa_c (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = sqrt (src->x[ itr ] * src->x[ itr ] +
+                           src->y[ itr ] * src->y[ itr ] +
+                           src->z[ itr ] * src->z[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_len_vec4f_soa_c (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = sqrt (src->x[ itr ] * src->x[ itr ] +
+                           src->y[ itr ] * src->y[ itr ] +
+                           src->z[ itr ] * src->z[ itr ] +
+                           src->w[ itr ] * src->w[ itr ]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_normalize_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_float32_t len;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        len = sqrt (src->x[ itr ] * src->x[ itr ] +
+                    src->y[ itr ] * src->y[ itr ] +
+                    src->z[ itr ] * src->z[ itr ]);
+
+        dst->x[ itr ] = src->x[ itr ] / len;
+        dst->y[ itr ] = src->y[ itr ] / len;
+        dst->z[ itr ] = src->z[ itr ] / len;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_normalize_vec4f_soa_c (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_float32_t len;
+
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        len = sqrt (src->x[ itr ] * src->x[ itr ] +
+                    src->y[ itr ] * src->y[ itr ] +
+                    src->z[ itr ] * src->z[ itr ] +
+                    src->w[ itr ] * src->w[ itr ]);
+
+        dst->x[ itr ] = src->x[ itr ] / len;
+        dst->y[ itr ] = src->y[ itr ] / len;
+        dst->z[ itr ] = src->z[ itr ] / len;
+        dst->w[ itr ] = src->w[ itr ] / len;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_dot_vec3f_soa_c (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = src1->x[ itr ] * src2->x[ itr ] +
+                     src1->y[ itr ] * src2->y[ itr ] +
+                     src1->z[ itr ] * src2->z[ itr ];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_dot_vec4f_soa_c (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count)
+{
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = src1->x[ itr ] * src2->x[ itr ] +
+                     src1->y[ itr ] * src2->y[ itr ] +
+                     src1->z[ itr ] * src2->z[ itr ] +
+                     src1->w[ itr ] * src2->w[ itr ];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cross_vec3f_soa_c (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    ne10_float32_t x, y, z;
+
+    // Computed into temporaries so that dst may be one of the sources
+    for ( unsigned int itr = 0; itr < count; itr++ )
+    {
+        x = (src1->y[ itr ] * src2->z[ itr ]) - (src1->z[ itr ] * src2->y[ itr ]);
+        y = (src1->z[ itr ] * src2->x[ itr ]) - (src1->x[ itr ] * src2->z[ itr ]);
+        z = (src1->x[ itr ] * src2->y[ itr ]) - (src1->y[ itr ] * src2->x[ itr ]);
+        dst->x[ itr ] = x;
+        dst->y[ itr ] = y;
+        dst->z[ itr ] = z;
+    }
+    return NE10_OK;
+}
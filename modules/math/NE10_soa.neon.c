@@ -0,0 +1,315 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_soa.neon.c
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_math.neonintrinsic.h"
+
+/*
+ * Each lane holds a different vector, so the loops below are the C loops
+ * four vectors at a time. The vec3f and vec4f conversions are a single
+ * de-interleaving (or interleaving) load and store.
+ */
+
+ne10_result_t ne10_vec3f_aos_to_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32 ( (ne10_float32_t*) (src + i));
+        vst1q_f32 (dst->x + i, v.val[0]);
+        vst1q_f32 (dst->y + i, v.val[1]);
+        vst1q_f32 (dst->z + i, v.val[2]);
+    }
+    for (; i < count; i++)
+    {
+        dst->x[i] = src[i].x;
+        dst->y[i] = src[i].y;
+        dst->z[i] = src[i].z;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_vec3f_soa_to_aos_neon (ne10_vec3f_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v;
+        v.val[0] = vld1q_f32 (src->x + i);
+        v.val[1] = vld1q_f32 (src->y + i);
+        v.val[2] = vld1q_f32 (src->z + i);
+        vst3q_f32 ( (ne10_float32_t*) (dst + i), v);
+    }
+    for (; i < count; i++)
+    {
+        dst[i].x = src->x[i];
+        dst[i].y = src->y[i];
+        dst[i].z = src->z[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_vec4f_aos_to_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t v = vld4q_f32 ( (ne10_float32_t*) (src + i));
+        vst1q_f32 (dst->x + i, v.val[0]);
+        vst1q_f32 (dst->y + i, v.val[1]);
+        vst1q_f32 (dst->z + i, v.val[2]);
+        vst1q_f32 (dst->w + i, v.val[3]);
+    }
+    for (; i < count; i++)
+    {
+        dst->x[i] = src[i].x;
+        dst->y[i] = src[i].y;
+        dst->z[i] = src[i].z;
+        dst->w[i] = src[i].w;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_vec4f_soa_to_aos_neon (ne10_vec4f_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t v;
+        v.val[0] = vld1q_f32 (src->x + i);
+        v.val[1] = vld1q_f32 (src->y + i);
+        v.val[2] = vld1q_f32 (src->z + i);
+        v.val[3] = vld1q_f32 (src->w + i);
+        vst4q_f32 ( (ne10_float32_t*) (dst + i), v);
+    }
+    for (; i < count; i++)
+    {
+        dst[i].x = src->x[i];
+        dst[i].y = src->y[i];
+        dst[i].z = src->z[i];
+        dst[i].w = src->w[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_len_vec3f_soa_neon (ne10_float32_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32 (src->x + i);
+        float32x4_t y = vld1q_f32 (src->y + i);
+        float32x4_t z = vld1q_f32 (src->z + i);
+        float32x4_t s = vmulq_f32 (x, x);
+        s = vaddq_f32 (s, vmulq_f32 (y, y));
+        s = vaddq_f32 (s, vmulq_f32 (z, z));
+        vst1q_f32 (dst + i, ne10_sqrt_f32_neon (s));
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = sqrt (src->x[i] * src->x[i] +
+                       src->y[i] * src->y[i] +
+                       src->z[i] * src->z[i]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_len_vec4f_soa_neon (ne10_float32_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32 (src->x + i);
+        float32x4_t y = vld1q_f32 (src->y + i);
+        float32x4_t z = vld1q_f32 (src->z + i);
+        float32x4_t w = vld1q_f32 (src->w + i);
+        float32x4_t s = vmulq_f32 (x, x);
+        s = vaddq_f32 (s, vmulq_f32 (y, y));
+        s = vaddq_f32 (s, vmulq_f32 (z, z));
+        s = vaddq_f32 (s, vmulq_f32 (w, w));
+        vst1q_f32 (dst + i, ne10_sqrt_f32_neon (s));
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = sqrt (src->x[i] * src->x[i] +
+                       src->y[i] * src->y[i] +
+                       src->z[i] * src->z[i] +
+                       src->w[i] * src->w[i]);
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_normalize_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    ne10_float32_t len;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32 (src->x + i);
+        float32x4_t y = vld1q_f32 (src->y + i);
+        float32x4_t z = vld1q_f32 (src->z + i);
+        float32x4_t s = vmulq_f32 (x, x);
+        s = vaddq_f32 (s, vmulq_f32 (y, y));
+        s = vaddq_f32 (s, vmulq_f32 (z, z));
+        s = ne10_sqrt_f32_neon (s);
+        vst1q_f32 (dst->x + i, ne10_div_f32_neon (x, s));
+        vst1q_f32 (dst->y + i, ne10_div_f32_neon (y, s));
+        vst1q_f32 (dst->z + i, ne10_div_f32_neon (z, s));
+    }
+    for (; i < count; i++)
+    {
+        len = sqrt (src->x[i] * src->x[i] +
+                    src->y[i] * src->y[i] +
+                    src->z[i] * src->z[i]);
+        dst->x[i] = src->x[i] / len;
+        dst->y[i] = src->y[i] / len;
+        dst->z[i] = src->z[i] / len;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_normalize_vec4f_soa_neon (ne10_vec4f_soa_t * dst, ne10_vec4f_soa_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    ne10_float32_t len;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32 (src->x + i);
+        float32x4_t y = vld1q_f32 (src->y + i);
+        float32x4_t z = vld1q_f32 (src->z + i);
+        float32x4_t w = vld1q_f32 (src->w + i);
+        float32x4_t s = vmulq_f32 (x, x);
+        s = vaddq_f32 (s, vmulq_f32 (y, y));
+        s = vaddq_f32 (s, vmulq_f32 (z, z));
+        s = vaddq_f32 (s, vmulq_f32 (w, w));
+        s = ne10_sqrt_f32_neon (s);
+        vst1q_f32 (dst->x + i, ne10_div_f32_neon (x, s));
+        vst1q_f32 (dst->y + i, ne10_div_f32_neon (y, s));
+        vst1q_f32 (dst->z + i, ne10_div_f32_neon (z, s));
+        vst1q_f32 (dst->w + i, ne10_div_f32_neon (w, s));
+    }
+    for (; i < count; i++)
+    {
+        len = sqrt (src->x[i] * src->x[i] +
+                    src->y[i] * src->y[i] +
+                    src->z[i] * src->z[i] +
+                    src->w[i] * src->w[i]);
+        dst->x[i] = src->x[i] / len;
+        dst->y[i] = src->y[i] / len;
+        dst->z[i] = src->z[i] / len;
+        dst->w[i] = src->w[i] / len;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_dot_vec3f_soa_neon (ne10_float32_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t s = vmulq_f32 (vld1q_f32 (src1->x + i), vld1q_f32 (src2->x + i));
+        s = vaddq_f32 (s, vmulq_f32 (vld1q_f32 (src1->y + i), vld1q_f32 (src2->y + i)));
+        s = vaddq_f32 (s, vmulq_f32 (vld1q_f32 (src1->z + i), vld1q_f32 (src2->z + i)));
+        vst1q_f32 (dst + i, s);
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = src1->x[i] * src2->x[i] +
+                 src1->y[i] * src2->y[i] +
+                 src1->z[i] * src2->z[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_dot_vec4f_soa_neon (ne10_float32_t * dst, ne10_vec4f_soa_t * src1, ne10_vec4f_soa_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t s = vmulq_f32 (vld1q_f32 (src1->x + i), vld1q_f32 (src2->x + i));
+        s = vaddq_f32 (s, vmulq_f32 (vld1q_f32 (src1->y + i), vld1q_f32 (src2->y + i)));
+        s = vaddq_f32 (s, vmulq_f32 (vld1q_f32 (src1->z + i), vld1q_f32 (src2->z + i)));
+        s = vaddq_f32 (s, vmulq_f32 (vld1q_f32 (src1->w + i), vld1q_f32 (src2->w + i)));
+        vst1q_f32 (dst + i, s);
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = src1->x[i] * src2->x[i] +
+                 src1->y[i] * src2->y[i] +
+                 src1->z[i] * src2->z[i] +
+                 src1->w[i] * src2->w[i];
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_cross_vec3f_soa_neon (ne10_vec3f_soa_t * dst, ne10_vec3f_soa_t * src1, ne10_vec3f_soa_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+    ne10_float32_t x, y, z;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t ax = vld1q_f32 (src1->x + i);
+        float32x4_t ay = vld1q_f32 (src1->y + i);
+        float32x4_t az = vld1q_f32 (src1->z + i);
+        float32x4_t bx = vld1q_f32 (src2->x + i);
+        float32x4_t by = vld1q_f32 (src2->y + i);
+        float32x4_t bz = vld1q_f32 (src2->z + i);
+        vst1q_f32 (dst->x + i, vsubq_f32 (vmulq_f32 (ay, bz), vmulq_f32 (az, by)));
+        vst1q_f32 (dst->y + i, vsubq_f32 (vmulq_f32 (az, bx), vmulq_f32 (ax, bz)));
+        vst1q_f32 (dst->z + i, vsubq_f32 (vmulq_f32 (ax, by), vmulq_f32 (ay, bx)));
+    }
+    for (; i < count; i++)
+    {
+        x = (src1->y[i] * src2->z[i]) - (src1->z[i] * src2->y[i]);
+        y = (src1->z[i] * src2->x[i]) - (src1->x[i] * src2->z[i]);
+        z = (src1->x[i] * src2->y[i]) - (src1->y[i] * src2->x[i]);
+        dst->x[i] = x;
+        dst->y[i] = y;
+        dst->z[i] = z;
+    }
+    return NE10_OK;
+}
@@ -0,0 +1,278 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*
+ * NE10 Library : math/NE10_transcend.c
+ */
+
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_transcend.h"
+
+/*
+ * The scalar kernels below are the reference for the NEON and x86 versions:
+ * those evaluate the same operations in the same order and pass every block
+ * that holds an argument outside the fast path here.
+ */
+
+typedef union
+{
+    ne10_float32_t f;
+    ne10_uint32_t u;
+} ne10_float_bits_t;
+
+/* 2^n for an integral n in [-126, 127] */
+static inline ne10_float32_t ne10_pow2f (ne10_float32_t n)
+{
+    ne10_float_bits_t b;
+    b.u = (ne10_uint32_t) ( (ne10_int32_t) n + 127) << 23;
+    return b.f;
+}
+
+static inline ne10_float32_t ne10_roundf (ne10_float32_t x)
+{
+    return (x + NE10_ROUND_MAGIC) - NE10_ROUND_MAGIC;
+}
+
+static ne10_float32_t ne10_expf (ne10_float32_t x)
+{
+    ne10_float32_t n, n1, r, z, p;
+
+    if (x != x)
+        return x;
+    x = NE10_EXP_MIN > x ? NE10_EXP_MIN : x;
+    x = NE10_EXP_MAX < x ? NE10_EXP_MAX : x;
+
+    n = ne10_roundf (x * NE10_EXP_LOG2E);
+    r = x - n * NE10_EXP_LN2_HI;
+    r = r - n * NE10_EXP_LN2_LO;
+    z = r * r;
+    p = NE10_EXP_P0 * r + NE10_EXP_P1;
+    p = p * r + NE10_EXP_P2;
+    p = p * r + NE10_EXP_P3;
+    p = p * r + NE10_EXP_P4;
+    p = p * r + NE10_EXP_P5;
+    p = (p * z + r) + 1.0f;
+
+    n1 = ne10_roundf (n * 0.5f);
+    return (p * ne10_pow2f (n1)) * ne10_pow2f (n - n1);
+}
+
+static ne10_float32_t ne10_logf (ne10_float32_t x)
+{
+    ne10_float_bits_t b;
+    ne10_float32_t e, m, z, p;
+
+    if (! (x >= FLT_MIN && x <= FLT_MAX))
+    {
+        if (x == 0.0f)
+            return -INFINITY;
+        if (! (x > 0.0f) || x > FLT_MAX)
+            return x < 0.0f ? NAN : x;
+    }
+
+    e = 0.0f;
+    if (x < FLT_MIN)
+    {
+        /* denormal */
+        x = x * 8388608.0f;
+        e = -23.0f;
+    }
+    b.f = x;
+    e = e + (ne10_float32_t) ( (ne10_int32_t) (b.u >> 23) - 126);
+    b.u = (b.u & 0x007fffff) | 0x3f000000;
+    m = b.f;
+    if (m < NE10_LOG_SQRTHF)
+    {
+        e = e - 1.0f;
+        m = m + m;
+    }
+    m = m - 1.0f;
+
+    z = m * m;
+    p = NE10_LOG_P0 * m + NE10_LOG_P1;
+    p = p * m + NE10_LOG_P2;
+    p = p * m + NE10_LOG_P3;
+    p = p * m + NE10_LOG_P4;
+    p = p * m + NE10_LOG_P5;
+    p = p * m + NE10_LOG_P6;
+    p = p * m + NE10_LOG_P7;
+    p = p * m + NE10_LOG_P8;
+    p = (p * m) * z;
+    p = p + e * NE10_EXP_LN2_LO;
+    p = p - 0.5f * z;
+    return (m + p) + e * NE10_EXP_LN2_HI;
+}
+
+static void ne10_sincosf (ne10_float32_t * s, ne10_float32_t * c, ne10_float32_t x)
+{
+    ne10_float32_t ax = fabsf (x);
+    ne10_float32_t q, r, z, ps, pc;
+    ne10_int32_t n;
+
+    if (! (ax <= NE10_TRIG_MAX))
+    {
+        *s = sinf (x);
+        *c = cosf (x);
+        return;
+    }
+
+    q = ne10_roundf (ax * NE10_TRIG_2_PI);
+    r = ax - q * NE10_TRIG_PIO2_1;
+    r = r - q * NE10_TRIG_PIO2_2;
+    r = r - q * NE10_TRIG_PIO2_3;
+    r = r - q * NE10_TRIG_PIO2_4;
+    z = r * r;
+
+    ps = NE10_SIN_P0 * z + NE10_SIN_P1;
+    ps = ps * z + NE10_SIN_P2;
+    ps = (ps * z) * r + r;
+
+    pc = NE10_COS_P0 * z + NE10_COS_P1;
+    pc = pc * z + NE10_COS_P2;
+    pc = ( (pc * z) * z - 0.5f * z) + 1.0f;
+
+    n = (ne10_int32_t) q;
+    if (n & 1)
+    {
+        ne10_float32_t t = ps;
+        ps = pc;
+        pc = t;
+    }
+    *s = ( (n & 2) != 0) != (signbit (x) != 0) ? -ps : ps;
+    *c = ( (n + 1) & 2) ? -pc : pc;
+}
+
+static ne10_float32_t ne10_atan2f (ne10_float32_t y, ne10_float32_t x)
+{
+    ne10_float32_t ax = fabsf (x), ay = fabsf (y);
+    ne10_float32_t mn = ax < ay ? ax : ay;
+    ne10_float32_t mx = ax < ay ? ay : ax;
+    ne10_float32_t num, den, a, z, p;
+    ne10_int32_t big;
+
+    if (x != x || y != y)
+        return x + y;
+    if (mx > NE10_ATAN_BIG)
+    {
+        mn = mn * 0.25f;
+        mx = mx * 0.25f;
+    }
+    if (mn == INFINITY)
+    {
+        mn = 1.0f;
+        mx = 1.0f;
+    }
+
+    big = mn > NE10_ATAN_TAN_PI_8 * mx;
+    num = big ? mn - mx : mn;
+    den = big ? mn + mx : mx;
+    if (den == 0.0f)
+        den = 1.0f;
+    a = num / den;
+    z = a * a;
+
+    p = NE10_ATAN_P0 * z + NE10_ATAN_P1;
+    p = p * z + NE10_ATAN_P2;
+    p = p * z + NE10_ATAN_P3;
+    p = ( (p * z) * a + (big ? NE10_ATAN_PI_4_LO : 0.0f)) + a;
+    p = p + (big ? NE10_ATAN_PI_4 : 0.0f);
+
+    if (ay > ax)
+        p = (NE10_ATAN_PI_2 - p) + NE10_ATAN_PI_2_LO;
+    if (signbit (x))
+        p = (NE10_ATAN_PI - p) + NE10_ATAN_PI_LO;
+    return signbit (y) ? -p : p;
+}
+
+ne10_result_t ne10_exp_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i < count; i++)
+        dst[i] = ne10_expf (src[i]);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_log_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i < count; i++)
+        dst[i] = ne10_logf (src[i]);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sincos_float_c (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_3POINTER (dst_sin, dst_cos, src);
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t s, c;
+        ne10_sincosf (&s, &c, src[i]);
+        dst_sin[i] = s;
+        dst_cos[i] = c;
+    }
+    return NE10_OK;
+}
+
+ne10_result_t ne10_atan2_float_c (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i < count; i++)
+        dst[i] = ne10_atan2f (src1[i], src2[i]);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_sqrt_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i < count; i++)
+        dst[i] = sqrtf (src[i]);
+    return NE10_OK;
+}
+
+ne10_result_t ne10_rsqrt_float_c (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i < count; i++)
+        dst[i] = 1.0f / sqrtf (src[i]);
+    return NE10_OK;
+}
@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*
+ * NE10 Library : math/NE10_transcend.h
+ */
+
+/*
+ * Constants shared by the C, NEON and x86 versions of the transcendental
+ * functions. The polynomials are the single precision ones of the Cephes
+ * library (S. L. Moshier), evaluated in the same order by every version so
+ * that they round alike:
+ *
+ *     exp:   x = n * ln2 + r, |r| <= ln2 / 2, with ln2 split in two parts;
+ *            2^n is applied as two factors so that results down to the
+ *            smallest denormal and up to the largest float are exact.
+ *     log:   x = m * 2^e, sqrt(1/2) <= m < sqrt(2), log (x) = log (m) + e * ln2.
+ *     sin,
+ *     cos:   |x| = q * pi/2 + r, |r| <= pi/4, with pi/2 split in four parts;
+ *            the first three have 11 bits, so that q times each is exact
+ *            while |x| <= NE10_TRIG_MAX, and r keeps its relative accuracy
+ *            close to the zeros of sin and cos.
+ *     atan2: the ratio a of the smaller to the larger of |y| and |x| is
+ *            reduced to |a| <= tan (pi/8) by atan (a) = pi/4 + atan ((a - 1) / (a + 1)).
+ *
+ * Integers are rounded with NE10_ROUND_MAGIC: (x + M) - M rounds x to the
+ * nearest integer (ties to even) for |x| < 2^22.
+ */
+
+#ifndef NE10_TRANSCEND_H
+#define NE10_TRANSCEND_H
+
+#include "NE10_types.h"
+
+#define NE10_ROUND_MAGIC 12582912.0f
+
+#define NE10_EXP_MIN -104.0f
+#define NE10_EXP_MAX 89.0f
+#define NE10_EXP_LOG2E 1.44269504088896341f
+#define NE10_EXP_LN2_HI 0.693359375f
+#define NE10_EXP_LN2_LO -2.12194440e-4f
+#define NE10_EXP_P0 1.9875691500e-4f
+#define NE10_EXP_P1 1.3981999507e-3f
+#define NE10_EXP_P2 8.3334519073e-3f
+#define NE10_EXP_P3 4.1665795894e-2f
+#define NE10_EXP_P4 1.6666665459e-1f
+#define NE10_EXP_P5 5.0000001201e-1f
+
+#define NE10_LOG_SQRTHF 0.707106781186547524f
+#define NE10_LOG_P0 7.0376836292e-2f
+#define NE10_LOG_P1 -1.1514610310e-1f
+#define NE10_LOG_P2 1.1676998740e-1f
+#define NE10_LOG_P3 -1.2420140846e-1f
+#define NE10_LOG_P4 1.4249322787e-1f
+#define NE10_LOG_P5 -1.6668057665e-1f
+#define NE10_LOG_P6 2.0000714765e-1f
+#define NE10_LOG_P7 -2.4999993993e-1f
+#define NE10_LOG_P8 3.3333331174e-1f
+
+#define NE10_TRIG_MAX 8192.0f
+#define NE10_TRIG_2_PI 0.636619772367581343f
+#define NE10_TRIG_PIO2_1 1.5703125f
+#define NE10_TRIG_PIO2_2 4.837512969970703125e-4f
+#define NE10_TRIG_PIO2_3 7.54953362047672271728515625e-8f
+#define NE10_TRIG_PIO2_4 2.56334406825708960298e-12f
+#define NE10_SIN_P0 -1.9515295891e-4f
+#define NE10_SIN_P1 8.3321608736e-3f
+#define NE10_SIN_P2 -1.6666654611e-1f
+#define NE10_COS_P0 2.443315711809948e-5f
+#define NE10_COS_P1 -1.388731625493765e-3f
+#define NE10_COS_P2 4.166664568298827e-2f
+
+#define NE10_ATAN_TAN_PI_8 0.414213562373095049f
+#define NE10_ATAN_BIG 1.0e37f
+#define NE10_ATAN_P0 8.05374449538e-2f
+#define NE10_ATAN_P1 -1.38776856032e-1f
+#define NE10_ATAN_P2 1.99777106478e-1f
+#define NE10_ATAN_P3 -3.33329491539e-1f
+/* pi, pi/2 and pi/4 as the nearest float plus the rest */
+#define NE10_ATAN_PI 3.14159265358979323846f
+#define NE10_ATAN_PI_LO -8.74227766e-8f
+#define NE10_ATAN_PI_2 1.57079632679489661923f
+#define NE10_ATAN_PI_2_LO -4.37113883e-8f
+#define NE10_ATAN_PI_4 0.785398163397448309616f
+#define NE10_ATAN_PI_4_LO -2.18556941e-8f
+
+#endif // NE10_TRANSCEND_H
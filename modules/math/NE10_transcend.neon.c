@@ -0,0 +1,337 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*
+ * NE10 Library : math/NE10_transcend.neon.c
+ */
+
+#include <assert.h>
+#include <float.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+#include "NE10_math.neonintrinsic.h"
+#include "NE10_transcend.h"
+
+/*
+ * Every lane evaluates the scalar kernel of NE10_transcend.c with the same
+ * operations in the same order. A block of four elements with any argument
+ * outside the fast path (denormals, zeros, infinities and NaNs for log and
+ * rsqrt, |x| > NE10_TRIG_MAX for sincos) goes through the C version, as do
+ * the last count % 4 elements.
+ */
+
+static inline float32x4_t ne10_roundf_neon (float32x4_t x)
+{
+    float32x4_t m = vdupq_n_f32 (NE10_ROUND_MAGIC);
+    return vsubq_f32 (vaddq_f32 (x, m), m);
+}
+
+/* 2^n for integral n in [-126, 127] */
+static inline float32x4_t ne10_pow2f_neon (float32x4_t n)
+{
+    int32x4_t e = vaddq_s32 (vcvtq_s32_f32 (n), vdupq_n_s32 (127));
+    return vreinterpretq_f32_s32 (vshlq_n_s32 (e, 23));
+}
+
+static inline float32x4_t ne10_and_f32_neon (uint32x4_t m, float32x4_t a)
+{
+    return vreinterpretq_f32_u32 (vandq_u32 (m, vreinterpretq_u32_f32 (a)));
+}
+
+static inline ne10_uint32_t ne10_any_u32_neon (uint32x4_t m)
+{
+#if defined(__aarch64__)
+    return vmaxvq_u32 (m);
+#else
+    uint32x2_t r = vorr_u32 (vget_low_u32 (m), vget_high_u32 (m));
+    return vget_lane_u32 (vpmax_u32 (r, r), 0);
+#endif
+}
+
+/* lanes outside [FLT_MIN, FLT_MAX], NaNs included */
+static inline uint32x4_t ne10_not_normal_f32_neon (float32x4_t x)
+{
+    uint32x4_t ok = vcgeq_f32 (x, vdupq_n_f32 (FLT_MIN));
+    ok = vandq_u32 (ok, vcleq_f32 (x, vdupq_n_f32 (FLT_MAX)));
+    return vmvnq_u32 (ok);
+}
+
+static inline float32x4_t ne10_expf_neon (float32x4_t x)
+{
+    float32x4_t n, n1, r, z, p;
+
+    /* the bounds go first so that NaNs pass through */
+    x = vmaxq_f32 (vdupq_n_f32 (NE10_EXP_MIN), x);
+    x = vminq_f32 (vdupq_n_f32 (NE10_EXP_MAX), x);
+
+    n = ne10_roundf_neon (vmulq_f32 (x, vdupq_n_f32 (NE10_EXP_LOG2E)));
+    r = vsubq_f32 (x, vmulq_f32 (n, vdupq_n_f32 (NE10_EXP_LN2_HI)));
+    r = vsubq_f32 (r, vmulq_f32 (n, vdupq_n_f32 (NE10_EXP_LN2_LO)));
+    z = vmulq_f32 (r, r);
+    p = vaddq_f32 (vmulq_f32 (vdupq_n_f32 (NE10_EXP_P0), r), vdupq_n_f32 (NE10_EXP_P1));
+    p = vaddq_f32 (vmulq_f32 (p, r), vdupq_n_f32 (NE10_EXP_P2));
+    p = vaddq_f32 (vmulq_f32 (p, r), vdupq_n_f32 (NE10_EXP_P3));
+    p = vaddq_f32 (vmulq_f32 (p, r), vdupq_n_f32 (NE10_EXP_P4));
+    p = vaddq_f32 (vmulq_f32 (p, r), vdupq_n_f32 (NE10_EXP_P5));
+    p = vaddq_f32 (vaddq_f32 (vmulq_f32 (p, z), r), vdupq_n_f32 (1.0f));
+
+    n1 = ne10_roundf_neon (vmulq_f32 (n, vdupq_n_f32 (0.5f)));
+    p = vmulq_f32 (p, ne10_pow2f_neon (n1));
+    return vmulq_f32 (p, ne10_pow2f_neon (vsubq_f32 (n, n1)));
+}
+
+/* positive normal x only */
+static inline float32x4_t ne10_logf_neon (float32x4_t x)
+{
+    uint32x4_t b = vreinterpretq_u32_f32 (x);
+    uint32x4_t lt;
+    float32x4_t e, m, z, p;
+
+    e = vcvtq_f32_s32 (vsubq_s32 (vreinterpretq_s32_u32 (vshrq_n_u32 (b, 23)), vdupq_n_s32 (126)));
+    b = vorrq_u32 (vandq_u32 (b, vdupq_n_u32 (0x007fffff)), vdupq_n_u32 (0x3f000000));
+    m = vreinterpretq_f32_u32 (b);
+    lt = vcltq_f32 (m, vdupq_n_f32 (NE10_LOG_SQRTHF));
+    e = vsubq_f32 (e, ne10_and_f32_neon (lt, vdupq_n_f32 (1.0f)));
+    m = vaddq_f32 (m, ne10_and_f32_neon (lt, m));
+    m = vsubq_f32 (m, vdupq_n_f32 (1.0f));
+
+    z = vmulq_f32 (m, m);
+    p = vaddq_f32 (vmulq_f32 (vdupq_n_f32 (NE10_LOG_P0), m), vdupq_n_f32 (NE10_LOG_P1));
+    p = vaddq_f32 (vmulq_f32 (p, m), vdupq_n_f32 (NE10_LOG_P2));
+    p = vaddq_f32 (vmulq_f32 (p, m), vdupq_n_f32 (NE10_LOG_P3));
+    p = vaddq_f32 (vmulq_f32 (p, m), vdupq_n_f32 (NE10_LOG_P4));
+    p = vaddq_f32 (vmulq_f32 (p, m), vdupq_n_f32 (NE10_LOG_P5));
+    p = vaddq_f32 (vmulq_f32 (p, m), vdupq_n_f32 (NE10_LOG_P6));
+    p = vaddq_f32 (vmulq_f32 (p, m), vdupq_n_f32 (NE10_LOG_P7));
+    p = vaddq_f32 (vmulq_f32 (p, m), vdupq_n_f32 (NE10_LOG_P8));
+    p = vmulq_f32 (vmulq_f32 (p, m), z);
+    p = vaddq_f32 (p, vmulq_f32 (e, vdupq_n_f32 (NE10_EXP_LN2_LO)));
+    p = vsubq_f32 (p, vmulq_f32 (vdupq_n_f32 (0.5f), z));
+    return vaddq_f32 (vaddq_f32 (m, p), vmulq_f32 (e, vdupq_n_f32 (NE10_EXP_LN2_HI)));
+}
+
+/* |x| <= NE10_TRIG_MAX only */
+static inline void ne10_sincosf_neon (float32x4_t * s, float32x4_t * c, float32x4_t x)
+{
+    float32x4_t ax = vabsq_f32 (x);
+    float32x4_t q, r, z, ps, pc;
+    uint32x4_t n, swap, sign;
+
+    q = ne10_roundf_neon (vmulq_f32 (ax, vdupq_n_f32 (NE10_TRIG_2_PI)));
+    r = vsubq_f32 (ax, vmulq_f32 (q, vdupq_n_f32 (NE10_TRIG_PIO2_1)));
+    r = vsubq_f32 (r, vmulq_f32 (q, vdupq_n_f32 (NE10_TRIG_PIO2_2)));
+    r = vsubq_f32 (r, vmulq_f32 (q, vdupq_n_f32 (NE10_TRIG_PIO2_3)));
+    r = vsubq_f32 (r, vmulq_f32 (q, vdupq_n_f32 (NE10_TRIG_PIO2_4)));
+    z = vmulq_f32 (r, r);
+
+    ps = vaddq_f32 (vmulq_f32 (vdupq_n_f32 (NE10_SIN_P0), z), vdupq_n_f32 (NE10_SIN_P1));
+    ps = vaddq_f32 (vmulq_f32 (ps, z), vdupq_n_f32 (NE10_SIN_P2));
+    ps = vaddq_f32 (vmulq_f32 (vmulq_f32 (ps, z), r), r);
+
+    pc = vaddq_f32 (vmulq_f32 (vdupq_n_f32 (NE10_COS_P0), z), vdupq_n_f32 (NE10_COS_P1));
+    pc = vaddq_f32 (vmulq_f32 (pc, z), vdupq_n_f32 (NE10_COS_P2));
+    pc = vsubq_f32 (vmulq_f32 (vmulq_f32 (pc, z), z), vmulq_f32 (vdupq_n_f32 (0.5f), z));
+    pc = vaddq_f32 (pc, vdupq_n_f32 (1.0f));
+
+    /* odd quadrants swap the results, bit 1 of q (of q + 1) gives the sign of sin (of cos) */
+    n = vreinterpretq_u32_s32 (vcvtq_s32_f32 (q));
+    swap = vtstq_u32 (n, vdupq_n_u32 (1));
+    sign = vshlq_n_u32 (vandq_u32 (n, vdupq_n_u32 (2)), 30);
+    sign = veorq_u32 (sign, vandq_u32 (vreinterpretq_u32_f32 (x), vdupq_n_u32 (0x80000000)));
+    *s = vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (vbslq_f32 (swap, pc, ps)), sign));
+    sign = vshlq_n_u32 (vandq_u32 (vaddq_u32 (n, vdupq_n_u32 (1)), vdupq_n_u32 (2)), 30);
+    *c = vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (vbslq_f32 (swap, ps, pc)), sign));
+}
+
+static inline float32x4_t ne10_atan2f_neon (float32x4_t y, float32x4_t x)
+{
+    float32x4_t ax = vabsq_f32 (x), ay = vabsq_f32 (y);
+    float32x4_t mn = vminq_f32 (ax, ay);
+    float32x4_t mx = vmaxq_f32 (ax, ay);
+    float32x4_t one = vdupq_n_f32 (1.0f);
+    float32x4_t num, den, a, z, p, t;
+    uint32x4_t m, big;
+
+    m = vcgtq_f32 (mx, vdupq_n_f32 (NE10_ATAN_BIG));
+    mn = vmulq_f32 (mn, vbslq_f32 (m, vdupq_n_f32 (0.25f), one));
+    mx = vmulq_f32 (mx, vbslq_f32 (m, vdupq_n_f32 (0.25f), one));
+    m = vceqq_f32 (mn, vdupq_n_f32 (INFINITY));
+    mn = vbslq_f32 (m, one, mn);
+    mx = vbslq_f32 (m, one, mx);
+
+    big = vcgtq_f32 (mn, vmulq_f32 (vdupq_n_f32 (NE10_ATAN_TAN_PI_8), mx));
+    num = vbslq_f32 (big, vsubq_f32 (mn, mx), mn);
+    den = vbslq_f32 (big, vaddq_f32 (mn, mx), mx);
+    den = vbslq_f32 (vceqq_f32 (den, vdupq_n_f32 (0.0f)), one, den);
+    a = ne10_div_f32_neon (num, den);
+    z = vmulq_f32 (a, a);
+
+    p = vaddq_f32 (vmulq_f32 (vdupq_n_f32 (NE10_ATAN_P0), z), vdupq_n_f32 (NE10_ATAN_P1));
+    p = vaddq_f32 (vmulq_f32 (p, z), vdupq_n_f32 (NE10_ATAN_P2));
+    p = vaddq_f32 (vmulq_f32 (p, z), vdupq_n_f32 (NE10_ATAN_P3));
+    p = vmulq_f32 (vmulq_f32 (p, z), a);
+    p = vaddq_f32 (vaddq_f32 (p, ne10_and_f32_neon (big, vdupq_n_f32 (NE10_ATAN_PI_4_LO))), a);
+    p = vaddq_f32 (p, ne10_and_f32_neon (big, vdupq_n_f32 (NE10_ATAN_PI_4)));
+
+    t = vaddq_f32 (vsubq_f32 (vdupq_n_f32 (NE10_ATAN_PI_2), p), vdupq_n_f32 (NE10_ATAN_PI_2_LO));
+    p = vbslq_f32 (vcgtq_f32 (ay, ax), t, p);
+    t = vaddq_f32 (vsubq_f32 (vdupq_n_f32 (NE10_ATAN_PI), p), vdupq_n_f32 (NE10_ATAN_PI_LO));
+    p = vbslq_f32 (vcltq_s32 (vreinterpretq_s32_f32 (x), vdupq_n_s32 (0)), t, p);
+    p = vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (p),
+                               vandq_u32 (vreinterpretq_u32_f32 (y), vdupq_n_u32 (0x80000000))));
+
+    m = vandq_u32 (vceqq_f32 (x, x), vceqq_f32 (y, y));
+    return vbslq_f32 (m, p, vaddq_f32 (x, y));
+}
+
+/* estimate refined by two Newton-Raphson steps; positive normal x only */
+static inline float32x4_t ne10_rsqrtf_neon (float32x4_t x)
+{
+    float32x4_t r = vrsqrteq_f32 (x);
+    r = vmulq_f32 (r, vrsqrtsq_f32 (vmulq_f32 (x, r), r));
+    return vmulq_f32 (r, vrsqrtsq_f32 (vmulq_f32 (x, r), r));
+}
+
+ne10_result_t ne10_exp_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        vst1q_f32 (dst + i, ne10_expf_neon (vld1q_f32 (src + i)));
+    }
+    return ne10_exp_float_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_log_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32 (src + i);
+
+        if (ne10_any_u32_neon (ne10_not_normal_f32_neon (x)))
+            ne10_log_float_c (dst + i, src + i, 4);
+        else
+            vst1q_f32 (dst + i, ne10_logf_neon (x));
+    }
+    return ne10_log_float_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_sincos_float_neon (ne10_float32_t * dst_sin, ne10_float32_t * dst_cos, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_3POINTER (dst_sin, dst_cos, src);
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32 (src + i);
+        float32x4_t s, c;
+
+        if (ne10_any_u32_neon (vmvnq_u32 (vcleq_f32 (vabsq_f32 (x), vdupq_n_f32 (NE10_TRIG_MAX)))))
+        {
+            ne10_sincos_float_c (dst_sin + i, dst_cos + i, src + i, 4);
+            continue;
+        }
+        ne10_sincosf_neon (&s, &c, x);
+        vst1q_f32 (dst_sin + i, s);
+        vst1q_f32 (dst_cos + i, c);
+    }
+    return ne10_sincos_float_c (dst_sin + i, dst_cos + i, src + i, count - i);
+}
+
+ne10_result_t ne10_atan2_float_neon (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc1Src2;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t y = vld1q_f32 (src1 + i);
+        float32x4_t x = vld1q_f32 (src2 + i);
+
+#if !defined(__aarch64__)
+        /* the division by estimates needs a larger of |y| and |x| that is zero, or
+           normal and small enough for its reciprocal to be normal */
+        float32x4_t mx = vmaxq_f32 (vabsq_f32 (y), vabsq_f32 (x));
+        uint32x4_t ok = vandq_u32 (vcgeq_f32 (mx, vdupq_n_f32 (FLT_MIN)), vcleq_f32 (mx, vdupq_n_f32 (NE10_ATAN_BIG)));
+        ok = vorrq_u32 (ok, vceqq_f32 (mx, vdupq_n_f32 (0.0f)));
+        if (ne10_any_u32_neon (vmvnq_u32 (ok)))
+        {
+            ne10_atan2_float_c (dst + i, src1 + i, src2 + i, 4);
+            continue;
+        }
+#endif
+        vst1q_f32 (dst + i, ne10_atan2f_neon (y, x));
+    }
+    return ne10_atan2_float_c (dst + i, src1 + i, src2 + i, count - i);
+}
+
+ne10_result_t ne10_sqrt_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32 (src + i);
+
+#if !defined(__aarch64__)
+        /* the estimates of ne10_sqrt_f32_neon need finite, normal or zero arguments */
+        uint32x4_t bad = ne10_not_normal_f32_neon (x);
+        bad = vandq_u32 (bad, vmvnq_u32 (vceqq_f32 (x, vdupq_n_f32 (0.0f))));
+        if (ne10_any_u32_neon (bad))
+        {
+            ne10_sqrt_float_c (dst + i, src + i, 4);
+            continue;
+        }
+#endif
+        vst1q_f32 (dst + i, ne10_sqrt_f32_neon (x));
+    }
+    return ne10_sqrt_float_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_rsqrt_float_neon (ne10_float32_t * dst, ne10_float32_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32 (src + i);
+
+        if (ne10_any_u32_neon (ne10_not_normal_f32_neon (x)))
+            ne10_rsqrt_float_c (dst + i, src + i, 4);
+        else
+            vst1q_f32 (dst + i, ne10_rsqrtf_neon (x));
+    }
+    return ne10_rsqrt_float_c (dst + i, src + i, count - i);
+}
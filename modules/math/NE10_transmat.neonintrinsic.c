@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/NE10_transmat.neonintrinsic.c
+ */
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#include "NE10_math.h"
+#include "macros.h"
+
+ne10_result_t ne10_transmat_2x2f_neon (ne10_mat2x2f_t * dst, ne10_mat2x2f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x4_t m = vld4q_f32 ( (ne10_float32_t*) (src + i));
+        float32x4_t t = m.val[1];
+        m.val[1] = m.val[2];
+        m.val[2] = t;
+        vst4q_f32 ( (ne10_float32_t*) (dst + i), m);
+    }
+    return ne10_transmat_2x2f_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_transmat_3x3f_neon (ne10_mat3x3f_t * dst, ne10_mat3x3f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    /*
+     * A 3-element structure load of a column-major matrix returns its rows, and
+     * also reads the first column of the next matrix: the last one is left to C.
+     */
+    for (i = 0; i + 1 < count; i++)
+    {
+        ne10_float32_t *d = (ne10_float32_t*) (dst + i);
+        float32x4x3_t m = vld3q_f32 ( (ne10_float32_t*) (src + i));
+        vst1_f32 (d, vget_low_f32 (m.val[0]));
+        vst1q_lane_f32 (d + 2, m.val[0], 2);
+        vst1_f32 (d + 3, vget_low_f32 (m.val[1]));
+        vst1q_lane_f32 (d + 5, m.val[1], 2);
+        vst1_f32 (d + 6, vget_low_f32 (m.val[2]));
+        vst1q_lane_f32 (d + 8, m.val[2], 2);
+    }
+    return ne10_transmat_3x3f_c (dst + i, src + i, count - i);
+}
+
+ne10_result_t ne10_transmat_4x4f_neon (ne10_mat4x4f_t * dst, ne10_mat4x4f_t * src, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    NE10_CHECKPOINTER_DstSrc;
+    for (i = 0; i < count; i++)
+    {
+        /* the 4-element structure load returns the rows */
+        float32x4x4_t m = vld4q_f32 ( (ne10_float32_t*) (src + i));
+        ne10_float32_t *d = (ne10_float32_t*) (dst + i);
+        vst1q_f32 (d, m.val[0]);
+        vst1q_f32 (d + 4, m.val[1]);
+        vst1q_f32 (d + 8, m.val[2]);
+        vst1q_f32 (d + 12, m.val[3]);
+    }
+    return NE10_OK;
+}
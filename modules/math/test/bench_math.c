@@ -0,0 +1,447 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : math/test/bench_math.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "NE10_math.h"
+#include "NE10_bench.h"
+
+/*
+ * Every dispatched math function, called through its function pointer on
+ * count elements of dense arrays. The pointer-array forms point at elements
+ * NE10_BENCH_SPACING bytes apart; the strided forms use dense strides.
+ */
+#define NE10_BENCH_SPACING 64
+#define NE10_BENCH_CHAIN_OPS 4
+
+typedef struct
+{
+    ne10_uint32_t count;
+    void * dst;
+    void * dst2;
+    void * acc;
+    void * src1;
+    void * src2;
+    void * src3;
+    void * cst;
+    void ** ptr_dst;
+    void ** ptr_src1;
+    void ** ptr_src2;
+    ne10_vec3f_soa_t soa3_dst;
+    ne10_vec3f_soa_t soa3_src1;
+    ne10_vec3f_soa_t soa3_src2;
+    ne10_vec4f_soa_t soa4_dst;
+    ne10_vec4f_soa_t soa4_src1;
+    ne10_vec4f_soa_t soa4_src2;
+    ne10_chain_op_t chain[NE10_BENCH_CHAIN_OPS];
+} ne10_bench_math_state_t;
+
+// the arguments of the calls in NE10_BENCH_MATH_LIST
+#define DST st->dst
+#define DST2 st->dst2
+#define ACC st->acc
+#define SRC1 st->src1
+#define SRC2 st->src2
+#define SRC3 st->src3
+#define CST st->cst
+#define COUNT st->count
+#define PTR(type, p) ( (type **) st->ptr_##p)
+#define SOA(p) (&st->p)
+
+/*
+ * X (function, arguments, bytes read and written per element, flops per
+ * element). The flops are those of the arithmetic (a division or a square
+ * root counts as one); they are 0 for the functions that only move data and
+ * for those whose cost depends on the algorithm (inverses, determinants,
+ * interpolations and transcendental functions).
+ */
+#define NE10_BENCH_MATH_LIST(X) \
+    X (ne10_addc_float, (DST, SRC1, 1.5f, COUNT), 8, 1) \
+    X (ne10_addc_vec2f, (DST, SRC1, CST, COUNT), 16, 2) \
+    X (ne10_addc_vec3f, (DST, SRC1, CST, COUNT), 24, 3) \
+    X (ne10_addc_vec4f, (DST, SRC1, CST, COUNT), 32, 4) \
+    X (ne10_subc_float, (DST, SRC1, 1.5f, COUNT), 8, 1) \
+    X (ne10_subc_vec2f, (DST, SRC1, CST, COUNT), 16, 2) \
+    X (ne10_subc_vec3f, (DST, SRC1, CST, COUNT), 24, 3) \
+    X (ne10_subc_vec4f, (DST, SRC1, CST, COUNT), 32, 4) \
+    X (ne10_rsbc_float, (DST, SRC1, 1.5f, COUNT), 8, 1) \
+    X (ne10_rsbc_vec2f, (DST, SRC1, CST, COUNT), 16, 2) \
+    X (ne10_rsbc_vec3f, (DST, SRC1, CST, COUNT), 24, 3) \
+    X (ne10_rsbc_vec4f, (DST, SRC1, CST, COUNT), 32, 4) \
+    X (ne10_mulc_float, (DST, SRC1, 1.5f, COUNT), 8, 1) \
+    X (ne10_mulc_vec2f, (DST, SRC1, CST, COUNT), 16, 2) \
+    X (ne10_mulc_vec3f, (DST, SRC1, CST, COUNT), 24, 3) \
+    X (ne10_mulc_vec4f, (DST, SRC1, CST, COUNT), 32, 4) \
+    X (ne10_divc_float, (DST, SRC1, 1.5f, COUNT), 8, 1) \
+    X (ne10_divc_vec2f, (DST, SRC1, CST, COUNT), 16, 2) \
+    X (ne10_divc_vec3f, (DST, SRC1, CST, COUNT), 24, 3) \
+    X (ne10_divc_vec4f, (DST, SRC1, CST, COUNT), 32, 4) \
+    X (ne10_setc_float, (DST, 1.5f, COUNT), 4, 0) \
+    X (ne10_setc_vec2f, (DST, CST, COUNT), 8, 0) \
+    X (ne10_setc_vec3f, (DST, CST, COUNT), 12, 0) \
+    X (ne10_setc_vec4f, (DST, CST, COUNT), 16, 0) \
+    X (ne10_mlac_float, (DST, ACC, SRC1, 1.5f, COUNT), 12, 2) \
+    X (ne10_mlac_vec2f, (DST, ACC, SRC1, CST, COUNT), 24, 4) \
+    X (ne10_mlac_vec3f, (DST, ACC, SRC1, CST, COUNT), 36, 6) \
+    X (ne10_mlac_vec4f, (DST, ACC, SRC1, CST, COUNT), 48, 8) \
+    X (ne10_add_float, (DST, SRC1, SRC2, COUNT), 12, 1) \
+    X (ne10_sub_float, (DST, SRC1, SRC2, COUNT), 12, 1) \
+    X (ne10_mul_float, (DST, SRC1, SRC2, COUNT), 12, 1) \
+    X (ne10_div_float, (DST, SRC1, SRC2, COUNT), 12, 1) \
+    X (ne10_mla_float, (DST, ACC, SRC1, SRC2, COUNT), 16, 2) \
+    X (ne10_abs_float, (DST, SRC1, COUNT), 8, 0) \
+    X (ne10_len_vec2f, (DST, SRC1, COUNT), 12, 4) \
+    X (ne10_len_vec3f, (DST, SRC1, COUNT), 16, 6) \
+    X (ne10_len_vec4f, (DST, SRC1, COUNT), 20, 8) \
+    X (ne10_normalize_vec2f, (DST, SRC1, COUNT), 16, 6) \
+    X (ne10_normalize_vec3f, (DST, SRC1, COUNT), 24, 9) \
+    X (ne10_normalize_vec4f, (DST, SRC1, COUNT), 32, 12) \
+    X (ne10_abs_vec2f, (DST, SRC1, COUNT), 16, 0) \
+    X (ne10_abs_vec3f, (DST, SRC1, COUNT), 24, 0) \
+    X (ne10_abs_vec4f, (DST, SRC1, COUNT), 32, 0) \
+    X (ne10_vmul_vec2f, (DST, SRC1, SRC2, COUNT), 24, 2) \
+    X (ne10_vmul_vec3f, (DST, SRC1, SRC2, COUNT), 36, 3) \
+    X (ne10_vmul_vec4f, (DST, SRC1, SRC2, COUNT), 48, 4) \
+    X (ne10_vdiv_vec2f, (DST, SRC1, SRC2, COUNT), 24, 2) \
+    X (ne10_vdiv_vec3f, (DST, SRC1, SRC2, COUNT), 36, 3) \
+    X (ne10_vdiv_vec4f, (DST, SRC1, SRC2, COUNT), 48, 4) \
+    X (ne10_vmla_vec2f, (DST, ACC, SRC1, SRC2, COUNT), 32, 4) \
+    X (ne10_vmla_vec3f, (DST, ACC, SRC1, SRC2, COUNT), 48, 6) \
+    X (ne10_vmla_vec4f, (DST, ACC, SRC1, SRC2, COUNT), 64, 8) \
+    X (ne10_add_vec2f, (DST, SRC1, SRC2, COUNT), 24, 2) \
+    X (ne10_add_vec3f, (DST, SRC1, SRC2, COUNT), 36, 3) \
+    X (ne10_add_vec4f, (DST, SRC1, SRC2, COUNT), 48, 4) \
+    X (ne10_sub_vec2f, (DST, SRC1, SRC2, COUNT), 24, 2) \
+    X (ne10_sub_vec3f, (DST, SRC1, SRC2, COUNT), 36, 3) \
+    X (ne10_sub_vec4f, (DST, SRC1, SRC2, COUNT), 48, 4) \
+    X (ne10_dot_vec2f, (DST, SRC1, SRC2, COUNT), 20, 3) \
+    X (ne10_dot_vec3f, (DST, SRC1, SRC2, COUNT), 28, 5) \
+    X (ne10_dot_vec4f, (DST, SRC1, SRC2, COUNT), 36, 7) \
+    X (ne10_cross_vec3f, (DST, SRC1, SRC2, COUNT), 36, 9) \
+    X (ne10_addmat_2x2f, (DST, SRC1, SRC2, COUNT), 48, 4) \
+    X (ne10_addmat_3x3f, (DST, SRC1, SRC2, COUNT), 108, 9) \
+    X (ne10_addmat_4x4f, (DST, SRC1, SRC2, COUNT), 192, 16) \
+    X (ne10_submat_2x2f, (DST, SRC1, SRC2, COUNT), 48, 4) \
+    X (ne10_submat_3x3f, (DST, SRC1, SRC2, COUNT), 108, 9) \
+    X (ne10_submat_4x4f, (DST, SRC1, SRC2, COUNT), 192, 16) \
+    X (ne10_mulmat_2x2f, (DST, SRC1, SRC2, COUNT), 48, 12) \
+    X (ne10_mulmat_3x3f, (DST, SRC1, SRC2, COUNT), 108, 45) \
+    X (ne10_mulmat_4x4f, (DST, SRC1, SRC2, COUNT), 192, 112) \
+    X (ne10_mulcmatvec_cm4x4f_v4f, (DST, CST, SRC1, COUNT), 32, 28) \
+    X (ne10_mulcmatvec_cm3x3f_v3f, (DST, CST, SRC1, COUNT), 24, 15) \
+    X (ne10_mulcmatvec_cm2x2f_v2f, (DST, CST, SRC1, COUNT), 16, 6) \
+    X (ne10_detmat_4x4f, (DST, SRC1, COUNT), 68, 0) \
+    X (ne10_detmat_3x3f, (DST, SRC1, COUNT), 40, 0) \
+    X (ne10_detmat_2x2f, (DST, SRC1, COUNT), 20, 0) \
+    X (ne10_invmat_4x4f, (DST, SRC1, COUNT), 128, 0) \
+    X (ne10_invmat_3x3f, (DST, SRC1, COUNT), 72, 0) \
+    X (ne10_invmat_2x2f, (DST, SRC1, COUNT), 32, 0) \
+    X (ne10_transmat_4x4f, (DST, SRC1, COUNT), 128, 0) \
+    X (ne10_transmat_3x3f, (DST, SRC1, COUNT), 72, 0) \
+    X (ne10_transmat_2x2f, (DST, SRC1, COUNT), 32, 0) \
+    X (ne10_identitymat_4x4f, (DST, COUNT), 64, 0) \
+    X (ne10_identitymat_3x3f, (DST, COUNT), 36, 0) \
+    X (ne10_identitymat_2x2f, (DST, COUNT), 16, 0) \
+    X (ne10_chain_float, (DST, SRC1, st->chain, NE10_BENCH_CHAIN_OPS, COUNT), 16, 6) \
+    X (ne10_vec3f_aos_to_soa, (SOA (soa3_dst), SRC1, COUNT), 24, 0) \
+    X (ne10_vec3f_soa_to_aos, (DST, SOA (soa3_src1), COUNT), 24, 0) \
+    X (ne10_vec4f_aos_to_soa, (SOA (soa4_dst), SRC1, COUNT), 32, 0) \
+    X (ne10_vec4f_soa_to_aos, (DST, SOA (soa4_src1), COUNT), 32, 0) \
+    X (ne10_len_vec3f_soa, (DST, SOA (soa3_src1), COUNT), 16, 6) \
+    X (ne10_len_vec4f_soa, (DST, SOA (soa4_src1), COUNT), 20, 8) \
+    X (ne10_normalize_vec3f_soa, (SOA (soa3_dst), SOA (soa3_src1), COUNT), 24, 9) \
+    X (ne10_normalize_vec4f_soa, (SOA (soa4_dst), SOA (soa4_src1), COUNT), 32, 12) \
+    X (ne10_dot_vec3f_soa, (DST, SOA (soa3_src1), SOA (soa3_src2), COUNT), 28, 5) \
+    X (ne10_dot_vec4f_soa, (DST, SOA (soa4_src1), SOA (soa4_src2), COUNT), 36, 7) \
+    X (ne10_cross_vec3f_soa, (SOA (soa3_dst), SOA (soa3_src1), SOA (soa3_src2), COUNT), 36, 9) \
+    X (ne10_mulmat_3x3f_strided, (DST, sizeof (ne10_mat3x3f_t), SRC1, sizeof (ne10_mat3x3f_t), SRC2, sizeof (ne10_mat3x3f_t), COUNT), 108, 45) \
+    X (ne10_mulmat_3x3f_ptr, (PTR (ne10_mat3x3f_t, dst), PTR (ne10_mat3x3f_t, src1), PTR (ne10_mat3x3f_t, src2), COUNT), 108, 45) \
+    X (ne10_mulmat_4x4f_strided, (DST, sizeof (ne10_mat4x4f_t), SRC1, sizeof (ne10_mat4x4f_t), SRC2, sizeof (ne10_mat4x4f_t), COUNT), 192, 112) \
+    X (ne10_mulmat_4x4f_ptr, (PTR (ne10_mat4x4f_t, dst), PTR (ne10_mat4x4f_t, src1), PTR (ne10_mat4x4f_t, src2), COUNT), 192, 112) \
+    X (ne10_invmat_3x3f_strided, (DST, sizeof (ne10_mat3x3f_t), SRC1, sizeof (ne10_mat3x3f_t), COUNT), 72, 0) \
+    X (ne10_invmat_3x3f_ptr, (PTR (ne10_mat3x3f_t, dst), PTR (ne10_mat3x3f_t, src1), COUNT), 72, 0) \
+    X (ne10_invmat_4x4f_strided, (DST, sizeof (ne10_mat4x4f_t), SRC1, sizeof (ne10_mat4x4f_t), COUNT), 128, 0) \
+    X (ne10_invmat_4x4f_ptr, (PTR (ne10_mat4x4f_t, dst), PTR (ne10_mat4x4f_t, src1), COUNT), 128, 0) \
+    X (ne10_transmat_3x3f_strided, (DST, sizeof (ne10_mat3x3f_t), SRC1, sizeof (ne10_mat3x3f_t), COUNT), 72, 0) \
+    X (ne10_transmat_3x3f_ptr, (PTR (ne10_mat3x3f_t, dst), PTR (ne10_mat3x3f_t, src1), COUNT), 72, 0) \
+    X (ne10_transmat_4x4f_strided, (DST, sizeof (ne10_mat4x4f_t), SRC1, sizeof (ne10_mat4x4f_t), COUNT), 128, 0) \
+    X (ne10_transmat_4x4f_ptr, (PTR (ne10_mat4x4f_t, dst), PTR (ne10_mat4x4f_t, src1), COUNT), 128, 0) \
+    X (ne10_detmat_3x3f_strided, (DST, sizeof (ne10_float32_t), SRC1, sizeof (ne10_mat3x3f_t), COUNT), 40, 0) \
+    X (ne10_detmat_3x3f_ptr, (PTR (ne10_float32_t, dst), PTR (ne10_mat3x3f_t, src1), COUNT), 40, 0) \
+    X (ne10_detmat_4x4f_strided, (DST, sizeof (ne10_float32_t), SRC1, sizeof (ne10_mat4x4f_t), COUNT), 68, 0) \
+    X (ne10_detmat_4x4f_ptr, (PTR (ne10_float32_t, dst), PTR (ne10_mat4x4f_t, src1), COUNT), 68, 0) \
+    X (ne10_mulcmatvec_cm3x3f_v3f_strided, (DST, sizeof (ne10_vec3f_t), CST, SRC1, sizeof (ne10_vec3f_t), COUNT), 24, 15) \
+    X (ne10_mulcmatvec_cm3x3f_v3f_ptr, (PTR (ne10_vec3f_t, dst), CST, PTR (ne10_vec3f_t, src1), COUNT), 24, 15) \
+    X (ne10_mulcmatvec_cm4x4f_v4f_strided, (DST, sizeof (ne10_vec4f_t), CST, SRC1, sizeof (ne10_vec4f_t), COUNT), 32, 28) \
+    X (ne10_mulcmatvec_cm4x4f_v4f_ptr, (PTR (ne10_vec4f_t, dst), CST, PTR (ne10_vec4f_t, src1), COUNT), 32, 28) \
+    X (ne10_mul_quatf, (DST, SRC1, SRC2, COUNT), 48, 28) \
+    X (ne10_normalize_quatf, (DST, SRC1, COUNT), 32, 12) \
+    X (ne10_nlerp_quatf, (DST, SRC1, SRC2, SRC3, COUNT), 52, 0) \
+    X (ne10_slerp_quatf, (DST, SRC1, SRC2, SRC3, COUNT), 52, 0) \
+    X (ne10_rotate_vec3f_quatf, (DST, SRC1, SRC2, COUNT), 40, 0) \
+    X (ne10_quatf_to_mat3x3f, (DST, SRC1, COUNT), 52, 0) \
+    X (ne10_quatf_to_mat4x4f, (DST, SRC1, COUNT), 80, 0) \
+    X (ne10_exp_float, (DST, SRC1, COUNT), 8, 0) \
+    X (ne10_log_float, (DST, SRC1, COUNT), 8, 0) \
+    X (ne10_sincos_float, (DST, DST2, SRC1, COUNT), 12, 0) \
+    X (ne10_atan2_float, (DST, SRC1, SRC2, COUNT), 12, 0) \
+    X (ne10_sqrt_float, (DST, SRC1, COUNT), 8, 0) \
+    X (ne10_rsqrt_float, (DST, SRC1, COUNT), 8, 0) \
+    X (ne10_sum_float, (DST, SRC1, COUNT), 4, 1) \
+    X (ne10_mean_float, (DST, SRC1, COUNT), 4, 1) \
+    X (ne10_dotprod_float, (DST, SRC1, SRC2, COUNT), 8, 2) \
+    X (ne10_norm2_float, (DST, SRC1, COUNT), 4, 2) \
+    X (ne10_max_float, (DST, DST2, SRC1, COUNT), 4, 0) \
+    X (ne10_min_float, (DST, DST2, SRC1, COUNT), 4, 0) \
+    X (ne10_maxabs_float, (DST, DST2, SRC1, COUNT), 4, 0) \
+    X (ne10_sum_int16, (DST, SRC1, COUNT), 2, 0) \
+    X (ne10_sum_int32, (DST, SRC1, COUNT), 4, 0) \
+    X (ne10_dotprod_int16, (DST, SRC1, SRC2, COUNT), 4, 0) \
+    X (ne10_dotprod_int32, (DST, SRC1, SRC2, COUNT), 8, 0) \
+    X (ne10_maxabs_int16, (DST, DST2, SRC1, COUNT), 2, 0) \
+    X (ne10_maxabs_int32, (DST, DST2, SRC1, COUNT), 4, 0) \
+    X (ne10_cmul_float32, (DST, SRC1, SRC2, COUNT), 24, 6) \
+    X (ne10_cmul_conj_float32, (DST, SRC1, SRC2, COUNT), 24, 6) \
+    X (ne10_cmac_float32, (DST, ACC, SRC1, SRC2, COUNT), 32, 8) \
+    X (ne10_cabs_float32, (DST, SRC1, COUNT), 12, 4) \
+    X (ne10_cabs2_float32, (DST, SRC1, COUNT), 12, 3) \
+    X (ne10_cscale_float32, (DST, SRC1, 1.5f, COUNT), 16, 2) \
+    X (ne10_cpolar_float32, (DST, DST2, SRC1, COUNT), 16, 0) \
+    X (ne10_crect_float32, (DST, SRC1, SRC2, COUNT), 16, 0) \
+    X (ne10_cmul_int32, (DST, SRC1, SRC2, COUNT), 24, 0) \
+    X (ne10_cmul_conj_int32, (DST, SRC1, SRC2, COUNT), 24, 0) \
+    X (ne10_cmac_int32, (DST, ACC, SRC1, SRC2, COUNT), 32, 0) \
+    X (ne10_cabs2_int32, (DST, SRC1, COUNT), 12, 0) \
+    X (ne10_cscale_int32, (DST, SRC1, 0x40000000, COUNT), 16, 0) \
+    X (ne10_cmul_int16, (DST, SRC1, SRC2, COUNT), 12, 0) \
+    X (ne10_cmul_conj_int16, (DST, SRC1, SRC2, COUNT), 12, 0) \
+    X (ne10_cmac_int16, (DST, ACC, SRC1, SRC2, COUNT), 16, 0) \
+    X (ne10_cabs2_int16, (DST, SRC1, COUNT), 6, 0) \
+    X (ne10_cscale_int16, (DST, SRC1, 0x4000, COUNT), 8, 0)
+
+#define NE10_BENCH_MATH_RUN(function, args, bytes, flops) \
+    static void bench_##function (void * state) \
+    { \
+        ne10_bench_math_state_t * st = (ne10_bench_math_state_t *) state; \
+        function args; \
+    }
+
+NE10_BENCH_MATH_LIST (NE10_BENCH_MATH_RUN)
+
+#define NE10_BENCH_MATH_ENTRY(function, args, bytes, flops) \
+    { #function, bench_##function, bytes, flops },
+
+static const struct
+{
+    const char * name;
+    ne10_bench_run_t run;
+    ne10_float64_t bytes;
+    ne10_float64_t flops;
+} bench_math_functions[] =
+{
+    NE10_BENCH_MATH_LIST (NE10_BENCH_MATH_ENTRY)
+};
+
+/* an array of count pointers, NE10_BENCH_SPACING bytes apart from base */
+static void ** bench_pointers (void * base, ne10_uint32_t count)
+{
+    void ** p = (void **) malloc (count * sizeof (void *));
+    ne10_uint32_t i;
+
+    if (p != NULL)
+    {
+        for (i = 0; i < count; i++)
+            p[i] = (ne10_uint8_t *) base + i * NE10_BENCH_SPACING;
+    }
+    return p;
+}
+
+/* the planes of a vector array in structure-of-arrays form, one after another in base */
+static void bench_soa (ne10_float32_t * base, ne10_uint32_t count, ne10_vec3f_soa_t * soa3, ne10_vec4f_soa_t * soa4)
+{
+    soa3->x = soa4->x = base;
+    soa3->y = soa4->y = base + count;
+    soa3->z = soa4->z = base + 2 * count;
+    soa4->w = base + 3 * count;
+}
+
+static void bench_math_teardown (void * state)
+{
+    ne10_bench_math_state_t * st = (ne10_bench_math_state_t *) state;
+
+    ne10_bench_free (st->dst);
+    ne10_bench_free (st->dst2);
+    ne10_bench_free (st->acc);
+    ne10_bench_free (st->src1);
+    ne10_bench_free (st->src2);
+    ne10_bench_free (st->src3);
+    ne10_bench_free (st->cst);
+    free (st->ptr_dst);
+    free (st->ptr_src1);
+    free (st->ptr_src2);
+    free (st);
+}
+
+static void * bench_math_setup (ne10_uint32_t count)
+{
+    ne10_bench_math_state_t * st = (ne10_bench_math_state_t *) calloc (1, sizeof (ne10_bench_math_state_t));
+    // room for count of the largest elements, 4x4 matrices
+    ne10_uint32_t size = count * sizeof (ne10_mat4x4f_t);
+    ne10_float32_t * s2;
+    ne10_float32_t * s3;
+
+    if (st == NULL)
+        return NULL;
+    st->count = count;
+    st->dst = ne10_bench_alloc (size);
+    st->dst2 = ne10_bench_alloc (size);
+    st->acc = ne10_bench_alloc (size);
+    st->src1 = ne10_bench_alloc (size);
+    st->src2 = ne10_bench_alloc (size);
+    st->src3 = ne10_bench_alloc (size);
+    st->cst = ne10_bench_alloc (sizeof (ne10_mat4x4f_t));
+    st->ptr_dst = bench_pointers (st->dst, count);
+    st->ptr_src1 = bench_pointers (st->src1, count);
+    st->ptr_src2 = bench_pointers (st->src2, count);
+    if (st->dst == NULL || st->dst2 == NULL || st->acc == NULL || st->src1 == NULL || st->src2 == NULL
+            || st->src3 == NULL || st->cst == NULL || st->ptr_dst == NULL || st->ptr_src1 == NULL
+            || st->ptr_src2 == NULL)
+    {
+        bench_math_teardown (st);
+        return NULL;
+    }
+
+    bench_soa ( (ne10_float32_t *) st->dst, count, &st->soa3_dst, &st->soa4_dst);
+    bench_soa ( (ne10_float32_t *) st->src1, count, &st->soa3_src1, &st->soa4_src1);
+    bench_soa ( (ne10_float32_t *) st->src2, count, &st->soa3_src2, &st->soa4_src2);
+
+    // dst = clamp (src1 * 0.5 + src2 + src2 * src3, 0.5, 4)
+    s2 = (ne10_float32_t *) st->src2;
+    s3 = (ne10_float32_t *) st->src3;
+    st->chain[0].op = NE10_CHAIN_MULC;
+    st->chain[0].cst[0] = 0.5f;
+    st->chain[1].op = NE10_CHAIN_ADD;
+    st->chain[1].src[0] = s2;
+    st->chain[2].op = NE10_CHAIN_MLA;
+    st->chain[2].src[0] = s2;
+    st->chain[2].src[1] = s3;
+    st->chain[3].op = NE10_CHAIN_CLAMP;
+    st->chain[3].cst[0] = 0.5f;
+    st->chain[3].cst[1] = 4.0f;
+    return st;
+}
+
+/* square n x n matrices, C = A * B */
+typedef struct
+{
+    ne10_uint32_t n;
+    ne10_float32_t * a;
+    ne10_float32_t * b;
+    ne10_float32_t * c;
+} ne10_bench_sgemm_state_t;
+
+static void bench_sgemm_teardown (void * state)
+{
+    ne10_bench_sgemm_state_t * st = (ne10_bench_sgemm_state_t *) state;
+
+    ne10_bench_free (st->a);
+    ne10_bench_free (st->b);
+    ne10_bench_free (st->c);
+    free (st);
+}
+
+static void * bench_sgemm_setup (ne10_uint32_t n)
+{
+    ne10_bench_sgemm_state_t * st = (ne10_bench_sgemm_state_t *) calloc (1, sizeof (ne10_bench_sgemm_state_t));
+
+    if (st == NULL)
+        return NULL;
+    st->n = n;
+    st->a = (ne10_float32_t *) ne10_bench_alloc (n * n * sizeof (ne10_float32_t));
+    st->b = (ne10_float32_t *) ne10_bench_alloc (n * n * sizeof (ne10_float32_t));
+    st->c = (ne10_float32_t *) ne10_bench_alloc (n * n * sizeof (ne10_float32_t));
+    if (st->a == NULL || st->b == NULL || st->c == NULL)
+    {
+        bench_sgemm_teardown (st);
+        return NULL;
+    }
+    return st;
+}
+
+static void bench_sgemm (void * state)
+{
+    ne10_bench_sgemm_state_t * st = (ne10_bench_sgemm_state_t *) state;
+
+    ne10_sgemm (NE10_NO_TRANSPOSE, NE10_NO_TRANSPOSE, st->n, st->n, st->n,
+                1.0f, st->a, st->n, st->b, st->n, 0.0f, st->c, st->n);
+}
+
+void ne10_bench_register_math (void)
+{
+    // arrays that stay in the L1 cache, and ones that only fit in the last level
+    static const ne10_uint32_t counts[] = { 1024, 65536 };
+    static const ne10_uint32_t sgemm_sizes[] = { 64, 256 };
+    ne10_bench_case_t c;
+    ne10_uint32_t i, s;
+
+    c.module = "math";
+    c.setup = bench_math_setup;
+    c.teardown = bench_math_teardown;
+    for (i = 0; i < sizeof (bench_math_functions) / sizeof (bench_math_functions[0]); i++)
+    {
+        for (s = 0; s < sizeof (counts) / sizeof (counts[0]); s++)
+        {
+            snprintf (c.name, sizeof (c.name), "%s", bench_math_functions[i].name);
+            c.size = counts[s];
+            c.items = counts[s];
+            c.bytes = counts[s] * bench_math_functions[i].bytes;
+            c.flops = counts[s] * bench_math_functions[i].flops;
+            c.run = bench_math_functions[i].run;
+            ne10_bench_add (&c);
+        }
+    }
+
+    snprintf (c.name, sizeof (c.name), "ne10_sgemm");
+    c.setup = bench_sgemm_setup;
+    c.teardown = bench_sgemm_teardown;
+    c.run = bench_sgemm;
+    for (s = 0; s < sizeof (sgemm_sizes) / sizeof (sgemm_sizes[0]); s++)
+    {
+        ne10_float64_t n = sgemm_sizes[s];
+
+        c.size = sgemm_sizes[s];
+        c.items = n * n;
+        c.bytes = 3.0 * n * n * sizeof (ne10_float32_t);
+        c.flops = 2.0 * n * n * n;
+        ne10_bench_add (&c);
+    }
+}
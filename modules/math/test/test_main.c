@@ -30,12 +30,38 @@
  */
 
 #include "seatest.h"
+#include "unit_test_common.h"
 
+void test_fixture_chain (void);
+void test_fixture_soa (void);
+void test_fixture_sgemm (void);
+void test_fixture_batchmat (void);
+void test_fixture_quat (void);
+void test_fixture_transcend (void);
+void test_fixture_reduce (void);
+void test_fixture_complex (void);
+#if defined (NE10_ENABLE_X86)
+void test_fixture_math_x86 (void);
+#else
 void test_fixture_math (void);
+#endif // NE10_ENABLE_X86
 
 void all_tests (void)
 {
+#if defined (NE10_ENABLE_X86)
+    // x86 builds have no NEON versions to test, only the SSE4.1 and AVX2 ones
+    test_fixture_math_x86();
+#else
     test_fixture_math();
+#endif // NE10_ENABLE_X86
+    test_fixture_chain();
+    test_fixture_soa();
+    test_fixture_sgemm();
+    test_fixture_batchmat();
+    test_fixture_quat();
+    test_fixture_transcend();
+    test_fixture_reduce();
+    test_fixture_complex();
 }
 
 
@@ -51,7 +77,8 @@ void my_suite_teardown (void)
 
 int main (ne10_int32_t argc, char** argv)
 {
+    ne10_test_init (argc, argv);
     suite_setup (my_suite_setup);
     suite_teardown (my_suite_teardown);
-    return !run_tests (all_tests);
+    return ne10_test_finish (run_tests (all_tests));
 }
@@ -0,0 +1,459 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_batchmat.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#if defined (REGRESSION_TEST)
+#define TEST_LENGTH_MAX 1031
+#else
+#define TEST_LENGTH_MAX 67
+#endif
+
+#define PERF_LENGTH 4096
+#define PERF_MATRICES (4 * 1024 * 1024)
+
+#define TEST_BUFFER_LEN (TEST_LENGTH_MAX > PERF_LENGTH ? TEST_LENGTH_MAX : PERF_LENGTH)
+
+/*
+ * The operands live in records, as they would in an application's own
+ * structures: the matrices are neither adjacent nor 16-byte aligned. A 3x3
+ * matrix uses the first 9 floats of a and b.
+ */
+typedef struct
+{
+    ne10_float32_t tag;
+    ne10_mat4x4f_t a;
+    ne10_mat4x4f_t b;
+    ne10_float32_t det;
+    ne10_vec4f_t v;
+} test_record_t;
+
+#define REC_STRIDE ( (ne10_uint32_t) sizeof (test_record_t))
+
+//input and output
+static ne10_float32_t * guarded_src = NULL;
+static ne10_float32_t * guarded_init = NULL;
+static ne10_float32_t * guarded_dst = NULL;
+static ne10_float32_t * guarded_sentinel = NULL;
+static ne10_float32_t * guarded_dense1 = NULL;
+static ne10_float32_t * guarded_dense2 = NULL;
+static ne10_float32_t * guarded_ref = NULL;
+static ne10_float32_t * guarded_out = NULL;
+static ne10_float32_t * thesrc = NULL;
+static ne10_float32_t * theinit = NULL;
+static ne10_float32_t * thedst = NULL;
+static ne10_float32_t * thesentinel = NULL;
+static test_record_t * src_rec = NULL;
+static test_record_t * dst_rec = NULL;
+static test_record_t * sentinel_rec = NULL;
+static ne10_float32_t * dense1 = NULL;
+static ne10_float32_t * dense2 = NULL;
+static ne10_float32_t * theref = NULL;
+static ne10_float32_t * theout = NULL;
+
+/* the pointer-array operands, and the record each of them points into */
+static void * src1_ptr[TEST_BUFFER_LEN];
+static void * src2_ptr[TEST_BUFFER_LEN];
+static void * dst_ptr[TEST_BUFFER_LEN];
+static ne10_uint32_t src_idx[TEST_BUFFER_LEN];
+static ne10_uint32_t dst_idx[TEST_BUFFER_LEN];
+
+/* the constant matrix of mulcmatvec */
+static ne10_mat4x4f_t cst;
+
+/*
+ * Every operation is reached through three adaptors with common signatures:
+ * the dense function on dense arrays (the reference), and the strided and
+ * pointer-array forms on the records.
+ */
+typedef struct
+{
+    const char *name;
+    size_t src_off;             /* field of src1; src2 is always b */
+    size_t dst_off;
+    ne10_uint32_t src_floats;
+    ne10_uint32_t dst_floats;
+    ne10_uint32_t binary;
+    void (*dense) (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count);
+    ne10_result_t (*strided) (test_record_t * dst, ne10_uint32_t dst_stride, test_record_t * src,
+                              ne10_uint32_t src_stride, ne10_uint32_t src2_stride, ne10_uint32_t count);
+    ne10_result_t (*ptr) (void ** dst, void ** src1, void ** src2, ne10_uint32_t count);
+} test_batch_op_t;
+
+#define TEST_MAT_OP(op, n, t) \
+static void dense_##op##_##n (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) \
+{ \
+    ne10_##op##_##n##f ( (t*) dst, (t*) src1, count); \
+} \
+static ne10_result_t strided_##op##_##n (test_record_t * dst, ne10_uint32_t dst_stride, test_record_t * src, \
+        ne10_uint32_t src_stride, ne10_uint32_t src2_stride, ne10_uint32_t count) \
+{ \
+    return ne10_##op##_##n##f_strided ( (t*) &dst->a, dst_stride, (t*) &src->a, src_stride, count); \
+} \
+static ne10_result_t ptr_##op##_##n (void ** dst, void ** src1, void ** src2, ne10_uint32_t count) \
+{ \
+    return ne10_##op##_##n##f_ptr ( (t**) dst, (t**) src1, count); \
+}
+
+TEST_MAT_OP (invmat, 3x3, ne10_mat3x3f_t)
+TEST_MAT_OP (invmat, 4x4, ne10_mat4x4f_t)
+TEST_MAT_OP (transmat, 3x3, ne10_mat3x3f_t)
+TEST_MAT_OP (transmat, 4x4, ne10_mat4x4f_t)
+
+#define TEST_MULMAT_OP(n, t) \
+static void dense_mulmat_##n (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) \
+{ \
+    ne10_mulmat_##n##f ( (t*) dst, (t*) src1, (t*) src2, count); \
+} \
+static ne10_result_t strided_mulmat_##n (test_record_t * dst, ne10_uint32_t dst_stride, test_record_t * src, \
+        ne10_uint32_t src_stride, ne10_uint32_t src2_stride, ne10_uint32_t count) \
+{ \
+    return ne10_mulmat_##n##f_strided ( (t*) &dst->a, dst_stride, (t*) &src->a, src_stride, \
+                                        (t*) &src->b, src2_stride, count); \
+} \
+static ne10_result_t ptr_mulmat_##n (void ** dst, void ** src1, void ** src2, ne10_uint32_t count) \
+{ \
+    return ne10_mulmat_##n##f_ptr ( (t**) dst, (t**) src1, (t**) src2, count); \
+}
+
+TEST_MULMAT_OP (3x3, ne10_mat3x3f_t)
+TEST_MULMAT_OP (4x4, ne10_mat4x4f_t)
+
+#define TEST_DETMAT_OP(n, t) \
+static void dense_detmat_##n (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) \
+{ \
+    ne10_detmat_##n##f (dst, (t*) src1, count); \
+} \
+static ne10_result_t strided_detmat_##n (test_record_t * dst, ne10_uint32_t dst_stride, test_record_t * src, \
+        ne10_uint32_t src_stride, ne10_uint32_t src2_stride, ne10_uint32_t count) \
+{ \
+    return ne10_detmat_##n##f_strided (&dst->det, dst_stride, (t*) &src->a, src_stride, count); \
+} \
+static ne10_result_t ptr_detmat_##n (void ** dst, void ** src1, void ** src2, ne10_uint32_t count) \
+{ \
+    return ne10_detmat_##n##f_ptr ( (ne10_float32_t**) dst, (t**) src1, count); \
+}
+
+TEST_DETMAT_OP (3x3, ne10_mat3x3f_t)
+TEST_DETMAT_OP (4x4, ne10_mat4x4f_t)
+
+#define TEST_MATVEC_OP(n, t, vt) \
+static void dense_mulcmatvec_##n (ne10_float32_t * dst, ne10_float32_t * src1, ne10_float32_t * src2, ne10_uint32_t count) \
+{ \
+    ne10_mulcmatvec_cm##n##f_v##vt ( (ne10_vec##vt##_t*) dst, (t*) &cst, (ne10_vec##vt##_t*) src1, count); \
+} \
+static ne10_result_t strided_mulcmatvec_##n (test_record_t * dst, ne10_uint32_t dst_stride, test_record_t * src, \
+        ne10_uint32_t src_stride, ne10_uint32_t src2_stride, ne10_uint32_t count) \
+{ \
+    return ne10_mulcmatvec_cm##n##f_v##vt##_strided ( (ne10_vec##vt##_t*) &dst->v, dst_stride, (t*) &cst, \
+            (ne10_vec##vt##_t*) &src->v, src_stride, count); \
+} \
+static ne10_result_t ptr_mulcmatvec_##n (void ** dst, void ** src1, void ** src2, ne10_uint32_t count) \
+{ \
+    return ne10_mulcmatvec_cm##n##f_v##vt##_ptr ( (ne10_vec##vt##_t**) dst, (t*) &cst, (ne10_vec##vt##_t**) src1, count); \
+}
+
+TEST_MATVEC_OP (3x3, ne10_mat3x3f_t, 3f)
+TEST_MATVEC_OP (4x4, ne10_mat4x4f_t, 4f)
+
+#define OFF_A offsetof (test_record_t, a)
+#define OFF_B offsetof (test_record_t, b)
+#define OFF_DET offsetof (test_record_t, det)
+#define OFF_V offsetof (test_record_t, v)
+
+static const test_batch_op_t ops[] =
+{
+    {"mulmat_3x3f", OFF_A, OFF_A, 9, 9, 1, dense_mulmat_3x3, strided_mulmat_3x3, ptr_mulmat_3x3},
+    {"mulmat_4x4f", OFF_A, OFF_A, 16, 16, 1, dense_mulmat_4x4, strided_mulmat_4x4, ptr_mulmat_4x4},
+    {"invmat_3x3f", OFF_A, OFF_A, 9, 9, 0, dense_invmat_3x3, strided_invmat_3x3, ptr_invmat_3x3},
+    {"invmat_4x4f", OFF_A, OFF_A, 16, 16, 0, dense_invmat_4x4, strided_invmat_4x4, ptr_invmat_4x4},
+    {"transmat_3x3f", OFF_A, OFF_A, 9, 9, 0, dense_transmat_3x3, strided_transmat_3x3, ptr_transmat_3x3},
+    {"transmat_4x4f", OFF_A, OFF_A, 16, 16, 0, dense_transmat_4x4, strided_transmat_4x4, ptr_transmat_4x4},
+    {"detmat_3x3f", OFF_A, OFF_DET, 9, 1, 0, dense_detmat_3x3, strided_detmat_3x3, ptr_detmat_3x3},
+    {"detmat_4x4f", OFF_A, OFF_DET, 16, 1, 0, dense_detmat_4x4, strided_detmat_4x4, ptr_detmat_4x4},
+    {"mulcmatvec_cm3x3f_v3f", OFF_V, OFF_V, 3, 3, 0, dense_mulcmatvec_3x3, strided_mulcmatvec_3x3, ptr_mulcmatvec_3x3},
+    {"mulcmatvec_cm4x4f_v4f", OFF_V, OFF_V, 4, 4, 0, dense_mulcmatvec_4x4, strided_mulcmatvec_4x4, ptr_mulcmatvec_4x4},
+};
+
+#define FIELD(rec, off) ( (ne10_float32_t*) ( (ne10_uint8_t*) (rec) + (off)))
+
+/* copies a field of the records idx[0] .. idx[count - 1] (or 0 .. count - 1) to a dense array */
+static void gather_field (ne10_float32_t * dense, const test_record_t * rec, size_t off,
+                          ne10_uint32_t floats, const ne10_uint32_t * idx, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+        memcpy (dense + i * floats, FIELD (&rec[idx ? idx[i] : i], off), floats * sizeof (ne10_float32_t));
+}
+
+static void scatter_field (test_record_t * rec, size_t off, const ne10_float32_t * dense,
+                           ne10_uint32_t floats, const ne10_uint32_t * idx, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+        memcpy (FIELD (&rec[idx ? idx[i] : i], off), dense + i * floats, floats * sizeof (ne10_float32_t));
+}
+
+/*
+ * Checks that nothing but the destination fields of the first count records
+ * was written, then the destination fields against the dense reference. The
+ * elements of inverses run into the thousands, and ARMv7 NEON divides with a
+ * refined estimate, so the comparison is relative to the size of the values.
+ */
+static void check_records (const test_batch_op_t * op, const ne10_uint32_t * idx, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    gather_field (theout, dst_rec, op->dst_off, op->dst_floats, idx, count);
+    scatter_field (sentinel_rec, op->dst_off, theout, op->dst_floats, idx, count);
+    assert_int_equal (0, memcmp (sentinel_rec, dst_rec, TEST_LENGTH_MAX * sizeof (test_record_t)));
+
+    for (i = 0; i < count * op->dst_floats; i++)
+    {
+        ne10_float32_t scale = fabsf (theref[i]) > 1.0f ? fabsf (theref[i]) : 1.0f;
+        theref[i] /= scale;
+        theout[i] /= scale;
+    }
+    assert_float_vec_equal (theref, theout, ERROR_MARGIN_LARGE, count * op->dst_floats);
+}
+
+/* every test starts from the same random destination records */
+static void reset_records (void)
+{
+    memcpy (dst_rec, theinit, TEST_LENGTH_MAX * sizeof (test_record_t));
+    memcpy (sentinel_rec, dst_rec, TEST_LENGTH_MAX * sizeof (test_record_t));
+}
+
+/* a random permutation of 0 .. count - 1 */
+static void shuffle (ne10_uint32_t * idx, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+        idx[i] = i;
+    for (i = count; i > 1; i--)
+    {
+        ne10_uint32_t j = NE10_rng_next() % i;
+        ne10_uint32_t t = idx[i - 1];
+        idx[i - 1] = idx[j];
+        idx[j] = t;
+    }
+}
+
+void test_batchmat_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_uint32_t p, count, i;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    NE10_rng_init (NE10_rng_test_seed());
+    for (p = 0; p < sizeof (ops) / sizeof (ops[0]); p++)
+    {
+        const test_batch_op_t *op = &ops[p];
+
+        for (count = 0; count <= TEST_LENGTH_MAX; count++)
+        {
+            // Strided, over the records
+            reset_records();
+            assert_int_equal (NE10_OK, op->strided (dst_rec, REC_STRIDE, src_rec, REC_STRIDE, REC_STRIDE, count));
+            gather_field (dense1, src_rec, op->src_off, op->src_floats, NULL, count);
+            gather_field (dense2, src_rec, OFF_B, op->src_floats, NULL, count);
+            op->dense (theref, dense1, dense2, count);
+            check_records (op, NULL, count);
+
+            // A source stride of 0 repeats the first element
+            if (op->binary)
+            {
+                reset_records();
+                assert_int_equal (NE10_OK, op->strided (dst_rec, REC_STRIDE, src_rec, REC_STRIDE, 0, count));
+                for (i = 0; i < count; i++)
+                    memcpy (dense2 + i * op->src_floats, &src_rec[0].b, op->src_floats * sizeof (ne10_float32_t));
+                op->dense (theref, dense1, dense2, count);
+                check_records (op, NULL, count);
+            }
+
+            // Pointer arrays, in random order on both sides
+            reset_records();
+            shuffle (src_idx, count);
+            shuffle (dst_idx, count);
+            for (i = 0; i < count; i++)
+            {
+                src1_ptr[i] = FIELD (&src_rec[src_idx[i]], op->src_off);
+                src2_ptr[i] = &src_rec[src_idx[i]].b;
+                dst_ptr[i] = FIELD (&dst_rec[dst_idx[i]], op->dst_off);
+            }
+            assert_int_equal (NE10_OK, op->ptr (dst_ptr, src1_ptr, src2_ptr, count));
+            gather_field (dense1, src_rec, op->src_off, op->src_floats, src_idx, count);
+            gather_field (dense2, src_rec, OFF_B, op->src_floats, src_idx, count);
+            op->dense (theref, dense1, dense2, count);
+            check_records (op, dst_idx, count);
+        }
+
+        // Strides that would overlap the destinations or misalign the floats
+        reset_records();
+        assert_int_equal (NE10_ERR, op->strided (dst_rec, op->dst_floats * sizeof (ne10_float32_t) - 4,
+                          src_rec, REC_STRIDE, REC_STRIDE, TEST_LENGTH_MAX));
+        assert_int_equal (NE10_ERR, op->strided (dst_rec, REC_STRIDE + 2, src_rec, REC_STRIDE, REC_STRIDE, TEST_LENGTH_MAX));
+        assert_int_equal (NE10_ERR, op->strided (dst_rec, REC_STRIDE, src_rec, REC_STRIDE + 1, REC_STRIDE, TEST_LENGTH_MAX));
+        assert_int_equal (0, memcmp (sentinel_rec, dst_rec, TEST_LENGTH_MAX * sizeof (test_record_t)));
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+void test_batchmat_performance()
+{
+#ifdef PERFORMANCE_TEST
+    ne10_int64_t time_dense = 0;
+    ne10_int64_t time_copy = 0;
+    ne10_int64_t time_strided = 0;
+    ne10_int64_t time_ptr = 0;
+    ne10_uint32_t repeats = PERF_MATRICES / PERF_LENGTH;
+    ne10_uint32_t p, k, i;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    for (i = 0; i < PERF_LENGTH; i++)
+        src_idx[i] = dst_idx[i] = i;
+    fprintf (stdout, "%25s%22s%22s%22s%22s\n", "matrices in records", "dense (micro-s)", "copy+dense (micro-s)",
+             "strided (micro-s)", "ptr (micro-s)");
+    for (p = 0; p < sizeof (ops) / sizeof (ops[0]); p++)
+    {
+        const test_batch_op_t *op = &ops[p];
+
+        for (i = 0; i < PERF_LENGTH; i++)
+        {
+            src1_ptr[i] = FIELD (&src_rec[i], op->src_off);
+            src2_ptr[i] = &src_rec[i].b;
+            dst_ptr[i] = FIELD (&dst_rec[i], op->dst_off);
+        }
+
+        // dense: the operands are already in dense arrays
+        GET_TIME
+        (
+            time_dense,
+        {
+            for (k = 0; k < repeats; k++)
+                op->dense (theout, dense1, dense2, PERF_LENGTH);
+        }
+        );
+        // copy+dense: what the caller has to do without the strided forms
+        GET_TIME
+        (
+            time_copy,
+        {
+            for (k = 0; k < repeats; k++)
+            {
+                gather_field (dense1, src_rec, op->src_off, op->src_floats, NULL, PERF_LENGTH);
+                gather_field (dense2, src_rec, OFF_B, op->src_floats, NULL, PERF_LENGTH);
+                op->dense (theout, dense1, dense2, PERF_LENGTH);
+                scatter_field (dst_rec, op->dst_off, theout, op->dst_floats, NULL, PERF_LENGTH);
+            }
+        }
+        );
+        GET_TIME
+        (
+            time_strided,
+        {
+            for (k = 0; k < repeats; k++)
+                op->strided (dst_rec, REC_STRIDE, src_rec, REC_STRIDE, REC_STRIDE, PERF_LENGTH);
+        }
+        );
+        GET_TIME
+        (
+            time_ptr,
+        {
+            for (k = 0; k < repeats; k++)
+                op->ptr (dst_ptr, src1_ptr, src2_ptr, PERF_LENGTH);
+        }
+        );
+        fprintf (stdout, "%25s%22lld%22lld%22lld%22lld\n", op->name, time_dense, time_copy, time_strided, time_ptr);
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_batchmat (void)
+{
+    ne10_uint32_t rec_floats = TEST_BUFFER_LEN * sizeof (test_record_t) / sizeof (ne10_float32_t);
+
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The tests go through the function pointers, as applications do
+    ne10_init();
+
+    NE10_SRC_ALLOC_LIMIT (thesrc, guarded_src, rec_floats);
+    NE10_SRC_ALLOC_LIMIT (theinit, guarded_init, rec_floats);
+    NE10_DST_ALLOC (thedst, guarded_dst, rec_floats);
+    NE10_DST_ALLOC (thesentinel, guarded_sentinel, rec_floats);
+    NE10_DST_ALLOC (dense1, guarded_dense1, TEST_BUFFER_LEN * 16);
+    NE10_DST_ALLOC (dense2, guarded_dense2, TEST_BUFFER_LEN * 16);
+    NE10_DST_ALLOC (theref, guarded_ref, TEST_BUFFER_LEN * 16);
+    NE10_DST_ALLOC (theout, guarded_out, TEST_BUFFER_LEN * 16);
+    src_rec = (test_record_t*) thesrc;
+    dst_rec = (test_record_t*) thedst;
+    sentinel_rec = (test_record_t*) thesentinel;
+    memcpy (&cst, thesrc, sizeof (cst));
+
+    run_test (test_batchmat_conformance);       // run tests
+    run_test (test_batchmat_performance);
+
+    free (guarded_src);
+    free (guarded_init);
+    free (guarded_dst);
+    free (guarded_sentinel);
+    free (guarded_dense1);
+    free (guarded_dense2);
+    free (guarded_ref);
+    free (guarded_out);
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -0,0 +1,308 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_chain.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#if defined (REGRESSION_TEST)
+#define TEST_LENGTH_MAX 1031
+#else
+#define TEST_LENGTH_MAX 67
+#endif
+
+/* Performance lengths: L1-resident, L2-resident and larger than the caches */
+#define PERF_LENGTH_MAX (1024 * 1024)
+#if defined (PERFORMANCE_TEST)
+static const ne10_uint32_t PERF_LENGTHS[] = {2048, 64 * 1024, PERF_LENGTH_MAX};
+#define NUM_PERF_LENGTHS (sizeof (PERF_LENGTHS) / sizeof (PERF_LENGTHS[0]))
+#define PERF_ELEMENTS (64 * 1024 * 1024)
+#endif
+
+#define TEST_BUFFER_LEN (TEST_LENGTH_MAX > PERF_LENGTH_MAX ? TEST_LENGTH_MAX : PERF_LENGTH_MAX)
+
+//input and output
+static ne10_float32_t * guarded_src = NULL;
+static ne10_float32_t * guarded_src1 = NULL;
+static ne10_float32_t * guarded_src2 = NULL;
+static ne10_float32_t * thesrc = NULL;
+static ne10_float32_t * thesrc1 = NULL;
+static ne10_float32_t * thesrc2 = NULL;
+
+static ne10_float32_t * guarded_dst_ref = NULL;
+static ne10_float32_t * guarded_dst_chain = NULL;
+static ne10_float32_t * thedst_ref = NULL;
+static ne10_float32_t * thedst_chain = NULL;
+
+#if defined (PERFORMANCE_TEST)
+/* scale, offset, rectify and accumulate: the pipeline the chain API fuses */
+static void test_chain_separate (ne10_float32_t *dst, ne10_uint32_t count)
+{
+    ne10_mulc_float (dst, thesrc, 0.75f, count);
+    ne10_addc_float (dst, dst, -1.5f, count);
+    ne10_abs_float (dst, dst, count);
+    ne10_mla_float (dst, dst, thesrc1, thesrc2, count);
+}
+
+/* the same without the array operands of mla, limited by the one input stream */
+static void test_chain_separate_cst (ne10_float32_t *dst, ne10_uint32_t count)
+{
+    ne10_mulc_float (dst, thesrc, 0.75f, count);
+    ne10_addc_float (dst, dst, -1.5f, count);
+    ne10_abs_float (dst, dst, count);
+    ne10_subc_float (dst, dst, 2.0f, count);
+}
+
+static ne10_uint32_t test_chain_pipeline_cst (ne10_chain_op_t *ops)
+{
+    ops[0].op = NE10_CHAIN_MULC;
+    ops[0].cst[0] = 0.75f;
+    ops[1].op = NE10_CHAIN_ADDC;
+    ops[1].cst[0] = -1.5f;
+    ops[2].op = NE10_CHAIN_ABS;
+    ops[3].op = NE10_CHAIN_SUBC;
+    ops[3].cst[0] = 2.0f;
+    return 4;
+}
+#endif
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static void test_chain_separate_c (ne10_float32_t *dst, ne10_uint32_t count)
+{
+    ne10_mulc_float_c (dst, thesrc, 0.75f, count);
+    ne10_addc_float_c (dst, dst, -1.5f, count);
+    ne10_abs_float_c (dst, dst, count);
+    ne10_mla_float_c (dst, dst, thesrc1, thesrc2, count);
+}
+#endif
+
+static ne10_uint32_t test_chain_pipeline (ne10_chain_op_t *ops)
+{
+    ops[0].op = NE10_CHAIN_MULC;
+    ops[0].cst[0] = 0.75f;
+    ops[1].op = NE10_CHAIN_ADDC;
+    ops[1].cst[0] = -1.5f;
+    ops[2].op = NE10_CHAIN_ABS;
+    ops[3].op = NE10_CHAIN_MLA;
+    ops[3].src[0] = thesrc1;
+    ops[3].src[1] = thesrc2;
+    return 4;
+}
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+/* one of every operation */
+static ne10_uint32_t test_chain_all_ops (ne10_chain_op_t *ops)
+{
+    ne10_uint32_t k;
+
+    for (k = 0; k < NE10_CHAIN_OP_COUNT; k++)
+    {
+        ops[k].op = (ne10_chain_opcode_t) k;
+        ops[k].cst[0] = 0.5f + k;
+        ops[k].cst[1] = 100.0f * (k + 1);
+        ops[k].src[0] = (k & 1) ? thesrc1 : thesrc2;
+        ops[k].src[1] = (k & 1) ? thesrc2 : thesrc1;
+    }
+    // keep the values away from the clamp bounds used above
+    ops[NE10_CHAIN_MINC].cst[0] = 50.0f;
+    ops[NE10_CHAIN_MAXC].cst[0] = -50.0f;
+    ops[NE10_CHAIN_CLAMP].cst[0] = -20.0f;
+    ops[NE10_CHAIN_CLAMP].cst[1] = 20.0f;
+    return NE10_CHAIN_OP_COUNT;
+}
+#endif
+
+void test_chain_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_chain_op_t ops[NE10_CHAIN_MAX_OPS] = {{0}};
+    ne10_uint32_t op_count;
+    ne10_uint32_t count;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    // The fused pipeline rounds exactly like the separate functions
+    op_count = test_chain_pipeline (ops);
+    for (count = 0; count <= TEST_LENGTH_MAX; count++)
+    {
+        GUARD_ARRAY (thedst_ref, count);
+        GUARD_ARRAY (thedst_chain, count);
+
+        test_chain_separate_c (thedst_ref, count);
+        assert_int_equal (NE10_OK, ne10_chain_float (thedst_chain, thesrc, ops, op_count, count));
+
+        assert_true (CHECK_ARRAY_GUARD (thedst_ref, count));
+        assert_true (CHECK_ARRAY_GUARD (thedst_chain, count));
+        assert_float_vec_equal (thedst_ref, thedst_chain, ERROR_MARGIN_SMALL, count);
+    }
+
+    // Every operation, selected version against the C one
+    op_count = test_chain_all_ops (ops);
+    for (count = 0; count <= TEST_LENGTH_MAX; count++)
+    {
+        GUARD_ARRAY (thedst_ref, count);
+        GUARD_ARRAY (thedst_chain, count);
+
+        assert_int_equal (NE10_OK, ne10_chain_float_c (thedst_ref, thesrc, ops, op_count, count));
+        assert_int_equal (NE10_OK, ne10_chain_float (thedst_chain, thesrc, ops, op_count, count));
+
+        assert_true (CHECK_ARRAY_GUARD (thedst_ref, count));
+        assert_true (CHECK_ARRAY_GUARD (thedst_chain, count));
+        assert_float_vec_equal (thedst_ref, thedst_chain, ERROR_MARGIN_SMALL, count);
+    }
+
+    // In-place, with the destination also used as an operand
+    memcpy (thedst_chain, thesrc, TEST_LENGTH_MAX * sizeof (ne10_float32_t));
+    ops[0].op = NE10_CHAIN_MLA;
+    ops[0].src[0] = thedst_chain;
+    ops[0].src[1] = thesrc1;
+    ops[1].op = NE10_CHAIN_MULC;
+    ops[1].cst[0] = 0.25f;
+    ne10_mla_float_c (thedst_ref, thesrc, thesrc, thesrc1, TEST_LENGTH_MAX);
+    ne10_mulc_float_c (thedst_ref, thedst_ref, 0.25f, TEST_LENGTH_MAX);
+    assert_int_equal (NE10_OK, ne10_chain_float (thedst_chain, thedst_chain, ops, 2, TEST_LENGTH_MAX));
+    assert_float_vec_equal (thedst_ref, thedst_chain, ERROR_MARGIN_SMALL, TEST_LENGTH_MAX);
+
+    // Invalid chains are rejected without touching the output
+    GUARD_ARRAY (thedst_chain, TEST_LENGTH_MAX);
+    thedst_chain[0] = 0.0f;
+    ops[0].op = NE10_CHAIN_OP_COUNT;
+    assert_int_equal (NE10_ERR, ne10_chain_float (thedst_chain, thesrc, ops, 1, TEST_LENGTH_MAX));
+    ops[0].op = NE10_CHAIN_ADD;
+    ops[0].src[0] = NULL;
+    assert_int_equal (NE10_ERR, ne10_chain_float (thedst_chain, thesrc, ops, 1, TEST_LENGTH_MAX));
+    ops[0].op = NE10_CHAIN_ABS;
+    assert_int_equal (NE10_ERR, ne10_chain_float (thedst_chain, thesrc, ops, NE10_CHAIN_MAX_OPS + 1, TEST_LENGTH_MAX));
+    assert_true (CHECK_ARRAY_GUARD (thedst_chain, TEST_LENGTH_MAX));
+    assert_true (thedst_chain[0] == 0.0f);
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+typedef struct
+{
+    const char *name;
+    void (*separate) (ne10_float32_t *dst, ne10_uint32_t count);
+    ne10_uint32_t (*build) (ne10_chain_op_t *ops);
+} test_pipeline_t;
+
+void test_chain_performance()
+{
+#ifdef PERFORMANCE_TEST
+    static const test_pipeline_t pipelines[] =
+    {
+        {"mulc+addc+abs+mla", test_chain_separate, test_chain_pipeline},
+        {"mulc+addc+abs+subc", test_chain_separate_cst, test_chain_pipeline_cst},
+    };
+    ne10_chain_op_t ops[NE10_CHAIN_MAX_OPS] = {{0}};
+    ne10_uint32_t op_count;
+    ne10_int64_t time_separate = 0;
+    ne10_int64_t time_fused = 0;
+    ne10_float32_t time_speedup = 0.0f;
+    ne10_float32_t time_savings = 0.0f;
+    ne10_uint32_t p, loop, k;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    for (p = 0; p < sizeof (pipelines) / sizeof (pipelines[0]); p++)
+    {
+        op_count = pipelines[p].build (ops);
+        fprintf (stdout, "%25s%20s%20s%20s%20s\n", pipelines[p].name, "Separate (micro-s)", "Fused (micro-s)", "Time Savings", "Performance Ratio");
+        for (loop = 0; loop < NUM_PERF_LENGTHS; loop++)
+        {
+            ne10_uint32_t count = PERF_LENGTHS[loop];
+            ne10_uint32_t repeats = PERF_ELEMENTS / count;
+
+            GET_TIME
+            (
+                time_separate,
+            {
+                for (k = 0; k < repeats; k++)
+                    pipelines[p].separate (thedst_ref, count);
+            }
+            );
+            GET_TIME
+            (
+                time_fused,
+            {
+                for (k = 0; k < repeats; k++)
+                    ne10_chain_float (thedst_chain, thesrc, ops, op_count, count);
+            }
+            );
+
+            time_speedup = (ne10_float32_t) time_separate / time_fused;
+            time_savings = ( ( (ne10_float32_t) (time_separate - time_fused)) / time_separate) * 100;
+            ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", count, time_separate, time_fused, time_savings, time_speedup);
+        }
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_chain (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The tests go through the function pointers, as applications do
+    ne10_init();
+
+    NE10_SRC_ALLOC_LIMIT (thesrc, guarded_src, TEST_BUFFER_LEN);
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, TEST_BUFFER_LEN);
+    NE10_SRC_ALLOC_LIMIT (thesrc2, guarded_src2, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (thedst_ref, guarded_dst_ref, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (thedst_chain, guarded_dst_chain, TEST_BUFFER_LEN);
+
+    run_test (test_chain_conformance);       // run tests
+    run_test (test_chain_performance);
+
+    free (guarded_src);
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_dst_ref);
+    free (guarded_dst_chain);
+
+    test_fixture_end();                 // ends a fixture
+}
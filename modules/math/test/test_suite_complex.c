@@ -0,0 +1,690 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_complex.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "NE10_init.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#if defined (REGRESSION_TEST)
+#define TEST_LENGTH_MAX 1031
+#else
+#define TEST_LENGTH_MAX 67
+#endif
+
+/* more than four blocks of the polar and rectangular conversions */
+#define TEST_LENGTH_LONG 1117
+
+/* an array that stays in the caches, and one that does not */
+#define PERF_LENGTH_SHORT 1024
+#define PERF_LENGTH_LONG (1024 * 1024)
+#define PERF_ELEMENTS (16 * 1024 * 1024)
+
+#if defined (PERFORMANCE_TEST)
+#define TEST_BUFFER_LEN PERF_LENGTH_LONG
+#else
+#define TEST_BUFFER_LEN TEST_LENGTH_LONG
+#endif
+
+/*
+ * The relative errors allowed against the results in double precision. On
+ * ARMv7, the magnitudes, phases and sines and cosines of the NEON versions
+ * are those of the NEON square root, arctangent and sine and cosine, which
+ * are less accurate than the C ones.
+ */
+#define REL_MUL (2.0 * FLT_EPSILON)
+#define REL_MAC (3.0 * FLT_EPSILON)
+#if defined(__arm__)
+#define REL_ABS (4.0 * FLT_EPSILON)
+#define REL_PHASE (4.0 * FLT_EPSILON)
+#define REL_RECT (4.5 * FLT_EPSILON)
+#else
+#define REL_ABS (1.5 * FLT_EPSILON)
+#define REL_PHASE (3.0 * FLT_EPSILON)
+#define REL_RECT (3.5 * FLT_EPSILON)
+#endif
+
+//input
+static ne10_fft_cpx_float32_t * thesrc1 = NULL;
+static ne10_fft_cpx_float32_t * thesrc2 = NULL;
+static ne10_fft_cpx_float32_t * theacc = NULL;
+static ne10_float32_t * themag = NULL;
+static ne10_float32_t * thephase = NULL;
+static ne10_fft_cpx_int32_t * thesrc1_32 = NULL;
+static ne10_fft_cpx_int32_t * thesrc2_32 = NULL;
+static ne10_fft_cpx_int32_t * theacc_32 = NULL;
+static ne10_fft_cpx_int16_t * thesrc1_16 = NULL;
+static ne10_fft_cpx_int16_t * thesrc2_16 = NULL;
+static ne10_fft_cpx_int16_t * theacc_16 = NULL;
+static ne10_float32_t thecst;
+static ne10_int32_t thecst_32;
+static ne10_int16_t thecst_16;
+
+//output, with room for the guards of GUARD_ARRAY_UINT8 on both sides
+#define OUT_GUARD 16
+static ne10_uint8_t * guarded_out_c = NULL;
+static ne10_uint8_t * guarded_out2_c = NULL;
+static ne10_uint8_t * guarded_out = NULL;
+static ne10_uint8_t * guarded_out2 = NULL;
+static ne10_uint8_t * theout_c = NULL;
+static ne10_uint8_t * theout2_c = NULL;
+static ne10_uint8_t * theout = NULL;
+static ne10_uint8_t * theout2 = NULL;
+
+typedef enum
+{
+    TEST_CMUL,
+    TEST_CMUL_CONJ,
+    TEST_CMAC,
+    TEST_CABS,
+    TEST_CABS2,
+    TEST_CSCALE,
+    TEST_CPOLAR,
+    TEST_CRECT,
+    TEST_CMUL_INT32,
+    TEST_CMUL_CONJ_INT32,
+    TEST_CMAC_INT32,
+    TEST_CABS2_INT32,
+    TEST_CSCALE_INT32,
+    TEST_CMUL_INT16,
+    TEST_CMUL_CONJ_INT16,
+    TEST_CMAC_INT16,
+    TEST_CABS2_INT16,
+    TEST_CSCALE_INT16,
+    TEST_FUNCTIONS
+} test_function_t;
+
+#define TEST_FLOAT_FUNCTIONS TEST_CMUL_INT32
+
+#if defined (PERFORMANCE_TEST)
+static const char * const test_names[TEST_FUNCTIONS] =
+{
+    "cmul_float32", "cmul_conj_float32", "cmac_float32", "cabs_float32", "cabs2_float32",
+    "cscale_float32", "cpolar_float32", "crect_float32",
+    "cmul_int32", "cmul_conj_int32", "cmac_int32", "cabs2_int32", "cscale_int32",
+    "cmul_int16", "cmul_conj_int16", "cmac_int16", "cabs2_int16", "cscale_int16"
+};
+#endif
+
+/* the bytes of each element of the first and the second output of a function */
+static ne10_uint32_t out_size (test_function_t fn)
+{
+    switch (fn)
+    {
+    case TEST_CABS:
+    case TEST_CABS2:
+    case TEST_CPOLAR:
+    case TEST_CABS2_INT32:
+        return 4;
+    case TEST_CABS2_INT16:
+        return 2;
+    default:
+        return (fn >= TEST_CMUL_INT16) ? 4 : 8;
+    }
+}
+
+static ne10_uint32_t out2_size (test_function_t fn)
+{
+    return (fn == TEST_CPOLAR) ? 4 : 0;
+}
+
+/* uniform in [lo, hi] */
+static ne10_float32_t rand_range (ne10_float32_t lo, ne10_float32_t hi)
+{
+    return lo + (hi - lo) * ( (ne10_float32_t) NE10_rng_next() / NE10_rng_max());
+}
+
+static ne10_uint32_t rand_bits (void)
+{
+    return ( (ne10_uint32_t) NE10_rng_next() << 16) ^ NE10_rng_next();
+}
+
+/*
+ * Finite sources of mixed magnitudes, with zeros, and for the fixed-point
+ * functions the most negative values, whose products saturate.
+ */
+static void fill_sources (ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t scale = (i % 3) ? 1.0f : 1000.0f;
+
+        thesrc1[i].r = rand_range (-1.0f, 1.0f) * scale;
+        thesrc1[i].i = rand_range (-1.0f, 1.0f) * scale;
+        thesrc2[i].r = rand_range (-1.0f, 1.0f);
+        thesrc2[i].i = rand_range (-1.0f, 1.0f);
+        theacc[i].r = rand_range (-1.0f, 1.0f) * scale;
+        theacc[i].i = rand_range (-1.0f, 1.0f) * scale;
+        themag[i] = rand_range (0.0f, 100.0f);
+        thephase[i] = rand_range (- (ne10_float32_t) M_PI, (ne10_float32_t) M_PI);
+        if (i % 17 == 3)
+            thesrc1[i].i = 0.0f;
+        if (i % 29 == 5)
+            thesrc1[i].r = (i & 1) ? -0.0f : 0.0f;
+
+        thesrc1_32[i].r = (ne10_int32_t) rand_bits();
+        thesrc1_32[i].i = (ne10_int32_t) rand_bits();
+        thesrc2_32[i].r = (ne10_int32_t) rand_bits();
+        thesrc2_32[i].i = (ne10_int32_t) rand_bits();
+        theacc_32[i].r = (ne10_int32_t) rand_bits();
+        theacc_32[i].i = (ne10_int32_t) rand_bits();
+        thesrc1_16[i].r = (ne10_int16_t) rand_bits();
+        thesrc1_16[i].i = (ne10_int16_t) rand_bits();
+        thesrc2_16[i].r = (ne10_int16_t) rand_bits();
+        thesrc2_16[i].i = (ne10_int16_t) rand_bits();
+        theacc_16[i].r = (ne10_int16_t) rand_bits();
+        theacc_16[i].i = (ne10_int16_t) rand_bits();
+        if (i % 11 == 7)
+        {
+            thesrc1_32[i].r = thesrc2_32[i].r = (ne10_int32_t) 0x80000000;
+            thesrc1_32[i].i = thesrc2_32[i].i = (ne10_int32_t) 0x80000000;
+            thesrc1_16[i].r = thesrc2_16[i].r = -32768;
+            thesrc1_16[i].i = thesrc2_16[i].i = -32768;
+        }
+    }
+    thecst = rand_range (-4.0f, 4.0f);
+    thecst_32 = (ne10_int32_t) rand_bits();
+    thecst_16 = (ne10_int16_t) rand_bits();
+}
+
+typedef enum
+{
+    TEST_IMPL_C,
+    TEST_IMPL_DISPATCH,
+    TEST_IMPL_SSE,
+    TEST_IMPL_AVX2
+} test_impl_t;
+
+#if defined (NE10_ENABLE_X86)
+#define TEST_CALL_X86(name, args) \
+    case TEST_IMPL_SSE: \
+        return name##_sse args; \
+    case TEST_IMPL_AVX2: \
+        return name##_avx2 args;
+#else
+#define TEST_CALL_X86(name, args)
+#endif
+
+#define TEST_CALL(name, impl, args) \
+    switch (impl) \
+    { \
+    case TEST_IMPL_C: \
+        return name##_c args; \
+    TEST_CALL_X86 (name, args) \
+    default: \
+        return name args; \
+    }
+
+// the fixed-point functions have no x86 versions
+#define TEST_CALL_INT(name, impl, args) \
+    return (impl == TEST_IMPL_C) ? name##_c args : name args;
+
+static ne10_result_t run_function (test_function_t fn, test_impl_t impl, void * out, void * out2, ne10_uint32_t count)
+{
+    ne10_fft_cpx_float32_t * dst = (ne10_fft_cpx_float32_t *) out;
+    ne10_float32_t * dst_real = (ne10_float32_t *) out;
+    ne10_fft_cpx_int32_t * dst_32 = (ne10_fft_cpx_int32_t *) out;
+    ne10_fft_cpx_int16_t * dst_16 = (ne10_fft_cpx_int16_t *) out;
+
+    switch (fn)
+    {
+    case TEST_CMUL:
+        TEST_CALL (ne10_cmul_float32, impl, (dst, thesrc1, thesrc2, count));
+    case TEST_CMUL_CONJ:
+        TEST_CALL (ne10_cmul_conj_float32, impl, (dst, thesrc1, thesrc2, count));
+    case TEST_CMAC:
+        TEST_CALL (ne10_cmac_float32, impl, (dst, theacc, thesrc1, thesrc2, count));
+    case TEST_CABS:
+        TEST_CALL (ne10_cabs_float32, impl, (dst_real, thesrc1, count));
+    case TEST_CABS2:
+        TEST_CALL (ne10_cabs2_float32, impl, (dst_real, thesrc1, count));
+    case TEST_CSCALE:
+        TEST_CALL (ne10_cscale_float32, impl, (dst, thesrc1, thecst, count));
+    case TEST_CPOLAR:
+        TEST_CALL (ne10_cpolar_float32, impl, (dst_real, (ne10_float32_t *) out2, thesrc1, count));
+    case TEST_CRECT:
+        TEST_CALL (ne10_crect_float32, impl, (dst, themag, thephase, count));
+    case TEST_CMUL_INT32:
+        TEST_CALL_INT (ne10_cmul_int32, impl, (dst_32, thesrc1_32, thesrc2_32, count));
+    case TEST_CMUL_CONJ_INT32:
+        TEST_CALL_INT (ne10_cmul_conj_int32, impl, (dst_32, thesrc1_32, thesrc2_32, count));
+    case TEST_CMAC_INT32:
+        TEST_CALL_INT (ne10_cmac_int32, impl, (dst_32, theacc_32, thesrc1_32, thesrc2_32, count));
+    case TEST_CABS2_INT32:
+        TEST_CALL_INT (ne10_cabs2_int32, impl, ( (ne10_int32_t *) out, thesrc1_32, count));
+    case TEST_CSCALE_INT32:
+        TEST_CALL_INT (ne10_cscale_int32, impl, (dst_32, thesrc1_32, thecst_32, count));
+    case TEST_CMUL_INT16:
+        TEST_CALL_INT (ne10_cmul_int16, impl, (dst_16, thesrc1_16, thesrc2_16, count));
+    case TEST_CMUL_CONJ_INT16:
+        TEST_CALL_INT (ne10_cmul_conj_int16, impl, (dst_16, thesrc1_16, thesrc2_16, count));
+    case TEST_CMAC_INT16:
+        TEST_CALL_INT (ne10_cmac_int16, impl, (dst_16, theacc_16, thesrc1_16, thesrc2_16, count));
+    case TEST_CABS2_INT16:
+        TEST_CALL_INT (ne10_cabs2_int16, impl, ( (ne10_int16_t *) out, thesrc1_16, count));
+    default:
+        TEST_CALL_INT (ne10_cscale_int16, impl, (dst_16, thesrc1_16, thecst_16, count));
+    }
+}
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+/* the Q31 and Q15 operations, from their definitions */
+static ne10_int64_t sat (ne10_int64_t x, ne10_int32_t bits)
+{
+    ne10_int64_t max = ( (ne10_int64_t) 1 << (bits - 1)) - 1;
+    return (x > max) ? max : (x < -max - 1) ? -max - 1 : x;
+}
+
+static ne10_int64_t qmul (ne10_int64_t a, ne10_int64_t b, ne10_int32_t bits)
+{
+    // an arithmetic shift rounds down
+    return sat ( (a * b) >> (bits - 1), bits);
+}
+
+/* checks element i of the result of a fixed-point function of the given width */
+static void check_int_element (test_function_t fn, ne10_int32_t bits, ne10_uint32_t i)
+{
+    ne10_int64_t ar, ai, br, bi, cr, ci, cst, r, im, out_r, out_i = 0;
+    ne10_int32_t op = (bits == 32) ? fn - TEST_CMUL_INT32 : fn - TEST_CMUL_INT16;
+
+    if (bits == 32)
+    {
+        ar = thesrc1_32[i].r;
+        ai = thesrc1_32[i].i;
+        br = thesrc2_32[i].r;
+        bi = thesrc2_32[i].i;
+        cr = theacc_32[i].r;
+        ci = theacc_32[i].i;
+        cst = thecst_32;
+    }
+    else
+    {
+        ar = thesrc1_16[i].r;
+        ai = thesrc1_16[i].i;
+        br = thesrc2_16[i].r;
+        bi = thesrc2_16[i].i;
+        cr = theacc_16[i].r;
+        ci = theacc_16[i].i;
+        cst = thecst_16;
+    }
+
+    switch (op)
+    {
+    case TEST_CMUL_INT32 - TEST_CMUL_INT32:
+    case TEST_CMAC_INT32 - TEST_CMUL_INT32:
+        r = sat (qmul (ar, br, bits) - qmul (ai, bi, bits), bits);
+        im = sat (qmul (ar, bi, bits) + qmul (ai, br, bits), bits);
+        if (op == TEST_CMAC_INT32 - TEST_CMUL_INT32)
+        {
+            r = sat (cr + r, bits);
+            im = sat (ci + im, bits);
+        }
+        break;
+    case TEST_CMUL_CONJ_INT32 - TEST_CMUL_INT32:
+        r = sat (qmul (ar, br, bits) + qmul (ai, bi, bits), bits);
+        im = sat (qmul (ai, br, bits) - qmul (ar, bi, bits), bits);
+        break;
+    case TEST_CABS2_INT32 - TEST_CMUL_INT32:
+        r = sat (qmul (ar, ar, bits) + qmul (ai, ai, bits), bits);
+        im = 0;
+        break;
+    default:
+        r = qmul (ar, cst, bits);
+        im = qmul (ai, cst, bits);
+        break;
+    }
+
+    if (op == TEST_CABS2_INT32 - TEST_CMUL_INT32)
+        out_r = (bits == 32) ? ( (ne10_int32_t *) theout_c) [i] : ( (ne10_int16_t *) theout_c) [i];
+    else if (bits == 32)
+    {
+        out_r = ( (ne10_fft_cpx_int32_t *) theout_c) [i].r;
+        out_i = ( (ne10_fft_cpx_int32_t *) theout_c) [i].i;
+    }
+    else
+    {
+        out_r = ( (ne10_fft_cpx_int16_t *) theout_c) [i].r;
+        out_i = ( (ne10_fft_cpx_int16_t *) theout_c) [i].i;
+    }
+    assert_true (out_r == r && out_i == im);
+}
+
+/* checks element i of the result of a float function against the result in double precision */
+static void check_float_element (test_function_t fn, void * out, void * out2, ne10_uint32_t i)
+{
+    ne10_fft_cpx_float32_t * dst = (ne10_fft_cpx_float32_t *) out;
+    ne10_float32_t * dst_real = (ne10_float32_t *) out;
+    double ar = thesrc1[i].r, ai = thesrc1[i].i, br = thesrc2[i].r, bi = thesrc2[i].i;
+    double r, im, bound_r, bound_i;
+
+    switch (fn)
+    {
+    case TEST_CMUL:
+    case TEST_CMUL_CONJ:
+    case TEST_CMAC:
+        if (fn == TEST_CMUL_CONJ)
+            bi = -bi;
+        r = ar * br - ai * bi;
+        im = ar * bi + ai * br;
+        bound_r = REL_MUL * (fabs (ar * br) + fabs (ai * bi));
+        bound_i = REL_MUL * (fabs (ar * bi) + fabs (ai * br));
+        if (fn == TEST_CMAC)
+        {
+            r += theacc[i].r;
+            im += theacc[i].i;
+            bound_r = (REL_MAC / REL_MUL) * bound_r + REL_MAC * fabs (theacc[i].r);
+            bound_i = (REL_MAC / REL_MUL) * bound_i + REL_MAC * fabs (theacc[i].i);
+        }
+        assert_true (fabs (dst[i].r - r) <= bound_r && fabs (dst[i].i - im) <= bound_i);
+        break;
+    case TEST_CABS2:
+        r = ar * ar + ai * ai;
+        assert_true (fabs (dst_real[i] - r) <= REL_MUL * r);
+        break;
+    case TEST_CABS:
+    case TEST_CPOLAR:
+        r = sqrt (ar * ar + ai * ai);
+        assert_true (fabs (dst_real[i] - r) <= REL_ABS * r);
+        if (fn == TEST_CPOLAR)
+        {
+            im = atan2 (ai, ar);
+            assert_true (fabs ( ( (ne10_float32_t *) out2) [i] - im) <= REL_PHASE * fabs (im) + FLT_MIN);
+        }
+        break;
+    case TEST_CSCALE:
+        // a single product, correctly rounded
+        assert_true (dst[i].r == (ne10_float32_t) (ar * thecst) && dst[i].i == (ne10_float32_t) (ai * thecst));
+        break;
+    default:
+        r = themag[i] * cos (thephase[i]);
+        im = themag[i] * sin (thephase[i]);
+        assert_true (fabs (dst[i].r - r) <= REL_RECT * fabs (r) + FLT_MIN
+                     && fabs (dst[i].i - im) <= REL_RECT * fabs (im) + FLT_MIN);
+        break;
+    }
+}
+
+static void check_function (test_function_t fn, ne10_uint32_t count)
+{
+    ne10_uint32_t bytes = out_size (fn) * count;
+    ne10_uint32_t bytes2 = out2_size (fn) * count;
+    ne10_uint32_t i;
+    ne10_int32_t impl;
+
+    GUARD_ARRAY_UINT8 (theout_c, bytes);
+    GUARD_ARRAY_UINT8 (theout2_c, bytes2);
+    assert_int_equal (NE10_OK, run_function (fn, TEST_IMPL_C, theout_c, theout2_c, count));
+    assert_true (CHECK_ARRAY_GUARD_UINT8 (theout_c, bytes));
+    assert_true (CHECK_ARRAY_GUARD_UINT8 (theout2_c, bytes2));
+    for (i = 0; i < count; i++)
+    {
+        if (fn < TEST_FLOAT_FUNCTIONS)
+            check_float_element (fn, theout_c, theout2_c, i);
+        else
+            check_int_element (fn, (fn < TEST_CMUL_INT16) ? 32 : 16, i);
+    }
+
+    for (impl = TEST_IMPL_DISPATCH; impl <= TEST_IMPL_AVX2; impl++)
+    {
+#if defined (NE10_ENABLE_X86)
+        if ( (impl == TEST_IMPL_SSE && ne10_HasSSE41() != NE10_OK)
+                || (impl == TEST_IMPL_AVX2 && ne10_HasAVX2() != NE10_OK))
+            continue;
+#else
+        if (impl > TEST_IMPL_DISPATCH)
+            break;
+#endif
+        memset (theout, 0, bytes);
+        GUARD_ARRAY_UINT8 (theout, bytes);
+        GUARD_ARRAY_UINT8 (theout2, bytes2);
+        assert_int_equal (NE10_OK, run_function (fn, (test_impl_t) impl, theout, theout2, count));
+        assert_true (CHECK_ARRAY_GUARD_UINT8 (theout, bytes));
+        assert_true (CHECK_ARRAY_GUARD_UINT8 (theout2, bytes2));
+
+#if defined(__arm__)
+        // the ARMv7 NEON square root, arctangent, sine and cosine differ from the C ones
+        if (fn == TEST_CABS || fn == TEST_CPOLAR || fn == TEST_CRECT)
+        {
+            for (i = 0; i < count; i++)
+                check_float_element (fn, theout, theout2, i);
+            continue;
+        }
+#endif
+        // otherwise every version gives the result of the C version, bit for bit
+        assert_true (memcmp (theout, theout_c, bytes) == 0);
+        assert_true (memcmp (theout2, theout2_c, bytes2) == 0);
+    }
+}
+
+/* the products computed in place, with the destination as the first source */
+static void check_in_place (ne10_uint32_t count)
+{
+    ne10_fft_cpx_float32_t * dst = (ne10_fft_cpx_float32_t *) theout;
+    ne10_fft_cpx_int16_t * dst_16 = (ne10_fft_cpx_int16_t *) theout;
+    ne10_int32_t impl;
+
+    for (impl = TEST_IMPL_C; impl <= TEST_IMPL_DISPATCH; impl++)
+    {
+        run_function (TEST_CMUL, TEST_IMPL_C, theout_c, NULL, count);
+        memcpy (dst, thesrc1, count * sizeof (ne10_fft_cpx_float32_t));
+        if (impl == TEST_IMPL_C)
+            ne10_cmul_float32_c (dst, dst, thesrc2, count);
+        else
+            ne10_cmul_float32 (dst, dst, thesrc2, count);
+        assert_true (memcmp (dst, theout_c, count * sizeof (ne10_fft_cpx_float32_t)) == 0);
+
+        run_function (TEST_CSCALE_INT16, TEST_IMPL_C, theout_c, NULL, count);
+        memcpy (dst_16, thesrc1_16, count * sizeof (ne10_fft_cpx_int16_t));
+        if (impl == TEST_IMPL_C)
+            ne10_cscale_int16_c (dst_16, dst_16, thecst_16, count);
+        else
+            ne10_cscale_int16 (dst_16, dst_16, thecst_16, count);
+        assert_true (memcmp (dst_16, theout_c, count * sizeof (ne10_fft_cpx_int16_t)) == 0);
+    }
+}
+
+static void check_all (ne10_uint32_t count)
+{
+    ne10_uint32_t fn;
+
+    fill_sources (count);
+    for (fn = 0; fn < TEST_FUNCTIONS; fn++)
+        check_function ( (test_function_t) fn, count);
+    check_in_place (count);
+}
+#endif
+
+void test_complex_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_uint32_t count;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    NE10_rng_init (NE10_rng_test_seed());
+    for (count = 0; count <= TEST_LENGTH_MAX; count++)
+        check_all (count);
+    check_all (TEST_LENGTH_LONG);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+#if defined (PERFORMANCE_TEST)
+/* the bytes read and written by a function over count elements */
+static double traffic_bytes (test_function_t fn, ne10_uint32_t count)
+{
+    ne10_uint32_t in = (fn < TEST_CMUL_INT16) ? 8 : 4;
+    ne10_uint32_t sources;
+
+    switch (fn)
+    {
+    case TEST_CMUL:
+    case TEST_CMUL_CONJ:
+    case TEST_CMUL_INT32:
+    case TEST_CMUL_CONJ_INT32:
+    case TEST_CMUL_INT16:
+    case TEST_CMUL_CONJ_INT16:
+    case TEST_CRECT:
+        sources = 2;
+        break;
+    case TEST_CMAC:
+    case TEST_CMAC_INT32:
+    case TEST_CMAC_INT16:
+        sources = 3;
+        break;
+    default:
+        sources = 1;
+        break;
+    }
+    if (fn == TEST_CRECT)
+        in = 4;
+    return (double) count * (sources * in + out_size (fn) + out2_size (fn));
+}
+#endif
+
+void test_complex_performance()
+{
+#ifdef PERFORMANCE_TEST
+    static const ne10_uint32_t lengths[2] = { PERF_LENGTH_SHORT, PERF_LENGTH_LONG };
+    ne10_int64_t time_c = 0;
+    ne10_int64_t time_neon = 0;
+    ne10_float32_t time_speedup = 0.0f;
+    ne10_float32_t time_savings = 0.0f;
+    ne10_uint32_t fn, l, k, count, repeats;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    NE10_rng_init (NE10_rng_test_seed());
+    fill_sources (PERF_LENGTH_LONG);
+    for (fn = 0; fn < TEST_FUNCTIONS; fn++)
+    {
+        fprintf (stdout, "%25s%20s%20s%20s%20s\n", test_names[fn],
+                 "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+        for (l = 0; l < 2; l++)
+        {
+            count = lengths[l];
+            repeats = PERF_ELEMENTS / count;
+            GET_TIME
+            (
+                time_c,
+            {
+                for (k = 0; k < repeats; k++)
+                    run_function ( (test_function_t) fn, TEST_IMPL_C, theout_c, theout2_c, count);
+            }
+            );
+            GET_TIME
+            (
+                time_neon,
+            {
+                for (k = 0; k < repeats; k++)
+                    run_function ( (test_function_t) fn, TEST_IMPL_DISPATCH, theout, theout2, count);
+            }
+            );
+
+            time_speedup = (ne10_float32_t) time_c / time_neon;
+            time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+            ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", count, time_c, time_neon, time_savings, time_speedup);
+            fprintf (stdout, "%45s%20.2f GB/s\n", "NEON memory throughput",
+                     traffic_bytes ( (test_function_t) fn, count) * repeats / (time_neon * 1000.0));
+        }
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_complex (void)
+{
+    ne10_uint32_t out_bytes = TEST_BUFFER_LEN * sizeof (ne10_fft_cpx_float32_t) + 2 * OUT_GUARD;
+
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The tests go through the function pointers, as applications do
+    ne10_init();
+
+    // the sources are filled by each test, from the seeded generator
+    thesrc1 = (ne10_fft_cpx_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_fft_cpx_float32_t));
+    thesrc2 = (ne10_fft_cpx_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_fft_cpx_float32_t));
+    theacc = (ne10_fft_cpx_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_fft_cpx_float32_t));
+    themag = (ne10_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_float32_t));
+    thephase = (ne10_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_float32_t));
+    thesrc1_32 = (ne10_fft_cpx_int32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_fft_cpx_int32_t));
+    thesrc2_32 = (ne10_fft_cpx_int32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_fft_cpx_int32_t));
+    theacc_32 = (ne10_fft_cpx_int32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_fft_cpx_int32_t));
+    thesrc1_16 = (ne10_fft_cpx_int16_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_fft_cpx_int16_t));
+    thesrc2_16 = (ne10_fft_cpx_int16_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_fft_cpx_int16_t));
+    theacc_16 = (ne10_fft_cpx_int16_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_fft_cpx_int16_t));
+    guarded_out_c = (ne10_uint8_t*) malloc (out_bytes);
+    guarded_out2_c = (ne10_uint8_t*) malloc (out_bytes);
+    guarded_out = (ne10_uint8_t*) malloc (out_bytes);
+    guarded_out2 = (ne10_uint8_t*) malloc (out_bytes);
+    theout_c = guarded_out_c + OUT_GUARD;
+    theout2_c = guarded_out2_c + OUT_GUARD;
+    theout = guarded_out + OUT_GUARD;
+    theout2 = guarded_out2 + OUT_GUARD;
+
+    run_test (test_complex_conformance);       // run tests
+    run_test (test_complex_performance);
+
+    free (thesrc1);
+    free (thesrc2);
+    free (theacc);
+    free (themag);
+    free (thephase);
+    free (thesrc1_32);
+    free (thesrc2_32);
+    free (theacc_32);
+    free (thesrc1_16);
+    free (thesrc2_16);
+    free (theacc_16);
+    free (guarded_out_c);
+    free (guarded_out2_c);
+    free (guarded_out);
+    free (guarded_out2);
+
+    test_fixture_end();                 // ends a fixture
+}
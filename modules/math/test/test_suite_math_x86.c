@@ -0,0 +1,248 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_math_x86.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "NE10_init.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+/* Every count from 1 up to this is tested, which covers all the main loop
+ * and tail combinations of both the 4-lane and the 8-lane kernels. */
+#if defined (REGRESSION_TEST)
+#define TEST_LENGTH_MAX 2051
+#else
+#define TEST_LENGTH_MAX 67
+#endif
+
+#define PERF_TEST_LENGTH 4096
+#define TEST_COUNT 5000
+
+/* The x86 kernels are compared with the C ones; the vec4f operations need
+ * the most room, four floats per element. */
+#define TEST_BUFFER_LEN (TEST_LENGTH_MAX > PERF_TEST_LENGTH ? TEST_LENGTH_MAX * 4 : PERF_TEST_LENGTH * 4)
+
+typedef union
+{
+    ne10_func_3args_t f3;
+    ne10_func_4args_t f4;
+    ne10_func_5args_t f5;
+} test_func_t;
+
+typedef struct
+{
+    const char *name;
+    ne10_uint32_t vec_size;
+    ne10_uint32_t args;
+    test_func_t func_c;
+    test_func_t func_sse;
+    test_func_t func_avx2;
+} test_op_t;
+
+#define TEST_OP(name, fn, vec_size, args) \
+    { name, vec_size, args, \
+      { .f##args = (ne10_func_##args##args_t) fn##_c }, \
+      { .f##args = (ne10_func_##args##args_t) fn##_sse }, \
+      { .f##args = (ne10_func_##args##args_t) fn##_avx2 } }
+
+static test_op_t TEST_OPS[] =
+{
+    TEST_OP ("add_float", ne10_add_float, 1, 4),
+    TEST_OP ("add_vec2f", ne10_add_vec2f, 2, 4),
+    TEST_OP ("add_vec3f", ne10_add_vec3f, 3, 4),
+    TEST_OP ("add_vec4f", ne10_add_vec4f, 4, 4),
+    TEST_OP ("sub_float", ne10_sub_float, 1, 4),
+    TEST_OP ("sub_vec2f", ne10_sub_vec2f, 2, 4),
+    TEST_OP ("sub_vec3f", ne10_sub_vec3f, 3, 4),
+    TEST_OP ("sub_vec4f", ne10_sub_vec4f, 4, 4),
+    TEST_OP ("mul_float", ne10_mul_float, 1, 4),
+    TEST_OP ("vmul_vec2f", ne10_vmul_vec2f, 2, 4),
+    TEST_OP ("vmul_vec3f", ne10_vmul_vec3f, 3, 4),
+    TEST_OP ("vmul_vec4f", ne10_vmul_vec4f, 4, 4),
+    TEST_OP ("div_float", ne10_div_float, 1, 4),
+    TEST_OP ("vdiv_vec2f", ne10_vdiv_vec2f, 2, 4),
+    TEST_OP ("vdiv_vec3f", ne10_vdiv_vec3f, 3, 4),
+    TEST_OP ("vdiv_vec4f", ne10_vdiv_vec4f, 4, 4),
+    TEST_OP ("mla_float", ne10_mla_float, 1, 5),
+    TEST_OP ("vmla_vec2f", ne10_vmla_vec2f, 2, 5),
+    TEST_OP ("vmla_vec3f", ne10_vmla_vec3f, 3, 5),
+    TEST_OP ("vmla_vec4f", ne10_vmla_vec4f, 4, 5),
+    TEST_OP ("abs_float", ne10_abs_float, 1, 3),
+    TEST_OP ("abs_vec2f", ne10_abs_vec2f, 2, 3),
+    TEST_OP ("abs_vec3f", ne10_abs_vec3f, 3, 3),
+    TEST_OP ("abs_vec4f", ne10_abs_vec4f, 4, 3),
+};
+#define NUM_TEST_OPS (sizeof (TEST_OPS) / sizeof (TEST_OPS[0]))
+
+//input and output
+static ne10_float32_t * guarded_acc = NULL;
+static ne10_float32_t * guarded_src1 = NULL;
+static ne10_float32_t * guarded_src2 = NULL;
+static ne10_float32_t * theacc = NULL;
+static ne10_float32_t * thesrc1 = NULL;
+static ne10_float32_t * thesrc2 = NULL;
+
+static ne10_float32_t * guarded_dst_c = NULL;
+static ne10_float32_t * guarded_dst_x86 = NULL;
+static ne10_float32_t * thedst_c = NULL;
+static ne10_float32_t * thedst_x86 = NULL;
+
+#ifdef PERFORMANCE_TEST
+static ne10_int64_t time_c = 0;
+static ne10_int64_t time_x86 = 0;
+static ne10_float32_t time_speedup = 0.0f;
+static ne10_float32_t time_savings = 0.0f;
+#endif
+
+static void test_call (const test_op_t *op, test_func_t func, ne10_float32_t *dst, ne10_uint32_t count)
+{
+    switch (op->args)
+    {
+    case 3:
+        func.f3 (dst, thesrc1, count);
+        break;
+    case 4:
+        func.f4 (dst, thesrc1, thesrc2, count);
+        break;
+    default:
+        func.f5 (dst, theacc, thesrc1, thesrc2, count);
+        break;
+    }
+}
+
+static void test_x86_impl (const char *isa, ne10_result_t available, ne10_uint32_t use_avx2)
+{
+    ne10_uint32_t loop;
+
+    if (available != NE10_OK)
+    {
+        fprintf (stdout, "%s not supported by this CPU, skipped\n", isa);
+        return;
+    }
+
+    for (loop = 0; loop < NUM_TEST_OPS; loop++)
+    {
+        const test_op_t *op = &TEST_OPS[loop];
+        test_func_t func_x86 = use_avx2 ? op->func_avx2 : op->func_sse;
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+        ne10_uint32_t count;
+        for (count = 1; count <= TEST_LENGTH_MAX; count++)
+        {
+            ne10_uint32_t len = count * op->vec_size;
+
+            GUARD_ARRAY (thedst_c, len);
+            GUARD_ARRAY (thedst_x86, len);
+
+            test_call (op, op->func_c, thedst_c, count);
+            test_call (op, func_x86, thedst_x86, count);
+
+            assert_true (CHECK_ARRAY_GUARD (thedst_c, len));
+            assert_true (CHECK_ARRAY_GUARD (thedst_x86, len));
+            assert_float_vec_equal (thedst_c, thedst_x86, ERROR_MARGIN_SMALL, len);
+        }
+#endif
+
+#ifdef PERFORMANCE_TEST
+        ne10_uint32_t k;
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+                test_call (op, op->func_c, thedst_c, PERF_TEST_LENGTH);
+        }
+        );
+        GET_TIME
+        (
+            time_x86,
+        {
+            for (k = 0; k < TEST_COUNT; k++)
+                test_call (op, func_x86, thedst_x86, PERF_TEST_LENGTH);
+        }
+        );
+        time_speedup = (ne10_float32_t) time_c / time_x86;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_x86)) / time_c) * 100;
+        fprintf (stdout, "%s %-12s", isa, op->name);
+        ne10_log (__FUNCTION__, "%20d%20lld%20lld%19.2f%%%18.2f:1\n", PERF_TEST_LENGTH, time_c, time_x86, time_savings, time_speedup);
+#endif
+    }
+}
+
+void test_math_x86()
+{
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    test_x86_impl ("SSE4.1", ne10_HasSSE41(), 0);
+    test_x86_impl ("AVX2", ne10_HasAVX2(), 1);
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_math_x86 (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The feature flags are only filled in by ne10_init
+    ne10_init();
+
+    NE10_SRC_ALLOC_LIMIT (theacc, guarded_acc, TEST_BUFFER_LEN);
+    NE10_SRC_ALLOC_LIMIT (thesrc1, guarded_src1, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (thesrc2, guarded_src2, TEST_BUFFER_LEN);
+    // Divisors are kept away from zero
+    FILL_FLOAT_ARRAY_LIMIT_GT1 (thesrc2, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (thedst_c, guarded_dst_c, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (thedst_x86, guarded_dst_x86, TEST_BUFFER_LEN);
+
+    run_test (test_math_x86);       // run tests
+
+    free (guarded_acc);
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_dst_c);
+    free (guarded_dst_x86);
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -0,0 +1,440 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_quat.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#if defined (REGRESSION_TEST)
+#define TEST_LENGTH_MAX 1031
+#else
+#define TEST_LENGTH_MAX 67
+#endif
+
+#define PERF_LENGTH 4096
+#define PERF_QUATERNIONS (8 * 1024 * 1024)
+
+#define TEST_BUFFER_LEN (TEST_LENGTH_MAX > PERF_LENGTH ? TEST_LENGTH_MAX : PERF_LENGTH)
+
+//input and output: the outputs have room for TEST_BUFFER_LEN 4x4 matrices
+static ne10_float32_t * guarded_q1 = NULL;
+static ne10_float32_t * guarded_q2 = NULL;
+static ne10_float32_t * guarded_t = NULL;
+static ne10_float32_t * guarded_v = NULL;
+static ne10_float32_t * guarded_ref = NULL;
+static ne10_float32_t * guarded_out = NULL;
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_quatf_t * theq1 = NULL;
+static ne10_quatf_t * theq2 = NULL;
+static ne10_float32_t * thet = NULL;
+static ne10_vec3f_t * thev = NULL;
+static ne10_float32_t * theref = NULL;
+static ne10_float32_t * theout = NULL;
+static ne10_float32_t * theout_c = NULL;
+
+/* uniform in [-1, 1] */
+static double rand_unit (void)
+{
+    return 2.0 * NE10_rng_next() / NE10_rng_max() - 1.0;
+}
+
+/*
+ * Random unit quaternions. Every fourth pair is nearly equal, or nearly
+ * opposite, to exercise the small angles of slerp and the choice of the
+ * shorter way round.
+ */
+static void fill_quaternions (ne10_uint32_t count)
+{
+    ne10_uint32_t i, k;
+
+    for (i = 0; i < count; i++)
+    {
+        double q[2][4], len;
+        ne10_quatf_t *dst[2] = {&theq1[i], &theq2[i]};
+
+        for (k = 0; k < 4; k++)
+        {
+            q[0][k] = rand_unit();
+            q[1][k] = rand_unit();
+        }
+        if (i % 4 == 3)
+        {
+            double sign = (i % 8 == 3) ? 1.0 : -1.0;
+            for (k = 0; k < 4; k++)
+                q[1][k] = sign * q[0][k] + 1e-4 * q[1][k];
+        }
+        for (k = 0; k < 2; k++)
+        {
+            len = sqrt (q[k][0] * q[k][0] + q[k][1] * q[k][1] + q[k][2] * q[k][2] + q[k][3] * q[k][3]);
+            dst[k]->x = (ne10_float32_t) (q[k][0] / len);
+            dst[k]->y = (ne10_float32_t) (q[k][1] / len);
+            dst[k]->z = (ne10_float32_t) (q[k][2] / len);
+            dst[k]->w = (ne10_float32_t) (q[k][3] / len);
+        }
+        thet[i] = (ne10_float32_t) (0.5 + 0.5 * rand_unit());
+        thev[i].x = (ne10_float32_t) rand_unit();
+        thev[i].y = (ne10_float32_t) rand_unit();
+        thev[i].z = (ne10_float32_t) rand_unit();
+    }
+    thet[0] = 0.0f;
+    if (count > 1)
+        thet[1] = 1.0f;
+}
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static void quat_to_double (double * d, const ne10_quatf_t * q)
+{
+    d[0] = q->x;
+    d[1] = q->y;
+    d[2] = q->z;
+    d[3] = q->w;
+}
+
+static void store_quat (ne10_float32_t * dst, const double * q)
+{
+    ne10_int32_t k;
+
+    for (k = 0; k < 4; k++)
+        dst[k] = (ne10_float32_t) q[k];
+}
+
+/* Hamilton product, as (x, y, z, w) */
+static void ref_mul (double * r, const double * a, const double * b)
+{
+    r[0] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+    r[1] = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+    r[2] = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+    r[3] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+}
+
+static double ref_dot (const double * a, const double * b)
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+}
+
+/* slerp from the definition, or nlerp for t_slerp = 0 */
+static void ref_interp (double * r, const double * a, const double * b, double t, ne10_int32_t is_slerp)
+{
+    double cs = ref_dot (a, b);
+    double sign = cs < 0.0 ? -1.0 : 1.0;
+    double c1 = 1.0 - t, c2 = t, len;
+    ne10_int32_t k;
+
+    cs = fabs (cs);
+    if (is_slerp && cs < 1.0)
+    {
+        double theta = acos (cs);
+        if (sin (theta) > 0.0)
+        {
+            c1 = sin ( (1.0 - t) * theta) / sin (theta);
+            c2 = sin (t * theta) / sin (theta);
+        }
+    }
+    for (k = 0; k < 4; k++)
+        r[k] = a[k] * c1 + sign * b[k] * c2;
+    len = sqrt (ref_dot (r, r));
+    for (k = 0; k < 4; k++)
+        r[k] /= len;
+}
+
+/* compares the dispatched results with the double precision reference and with C */
+static void check_results (ne10_uint32_t floats)
+{
+    assert_float_vec_equal (theref, theout, ERROR_MARGIN_LARGE, floats);
+    assert_float_vec_equal (theout_c, theout, ERROR_MARGIN_SMALL, floats);
+}
+#endif
+
+void test_quat_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_quatf_t *out = (ne10_quatf_t*) theout;
+    ne10_quatf_t *out_c = (ne10_quatf_t*) theout_c;
+    ne10_uint32_t count, i, k;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    NE10_rng_init (NE10_rng_test_seed());
+    for (count = 0; count <= TEST_LENGTH_MAX; count++)
+    {
+        fill_quaternions (count);
+
+        // multiply
+        for (i = 0; i < count; i++)
+        {
+            double a[4], b[4], r[4];
+            quat_to_double (a, &theq1[i]);
+            quat_to_double (b, &theq2[i]);
+            ref_mul (r, a, b);
+            store_quat (theref + 4 * i, r);
+        }
+        GUARD_ARRAY (theout, count * 4);
+        assert_int_equal (NE10_OK, ne10_mul_quatf (out, theq1, theq2, count));
+        assert_true (CHECK_ARRAY_GUARD (theout, count * 4));
+        ne10_mul_quatf_c (out_c, theq1, theq2, count);
+        check_results (count * 4);
+
+        // normalize, of the products scaled away from unit length
+        for (i = 0; i < count * 4; i++)
+            theout_c[i] = theref[i] * (1.0f + 0.5f * ( (i / 4) % 7));
+        GUARD_ARRAY (theout, count * 4);
+        assert_int_equal (NE10_OK, ne10_normalize_quatf (out, out_c, count));
+        assert_true (CHECK_ARRAY_GUARD (theout, count * 4));
+        ne10_normalize_quatf_c (out_c, out_c, count);
+        check_results (count * 4);
+
+        // nlerp and slerp
+        for (k = 0; k < 2; k++)
+        {
+            for (i = 0; i < count; i++)
+            {
+                double a[4], b[4], r[4];
+                quat_to_double (a, &theq1[i]);
+                quat_to_double (b, &theq2[i]);
+                ref_interp (r, a, b, thet[i], k);
+                store_quat (theref + 4 * i, r);
+            }
+            GUARD_ARRAY (theout, count * 4);
+            if (k == 0)
+            {
+                assert_int_equal (NE10_OK, ne10_nlerp_quatf (out, theq1, theq2, thet, count));
+                ne10_nlerp_quatf_c (out_c, theq1, theq2, thet, count);
+            }
+            else
+            {
+                assert_int_equal (NE10_OK, ne10_slerp_quatf (out, theq1, theq2, thet, count));
+                ne10_slerp_quatf_c (out_c, theq1, theq2, thet, count);
+            }
+            assert_true (CHECK_ARRAY_GUARD (theout, count * 4));
+            check_results (count * 4);
+        }
+
+        // rotation, as q v conj (q)
+        for (i = 0; i < count; i++)
+        {
+            double q[4], v[4] = {thev[i].x, thev[i].y, thev[i].z, 0.0}, c[4], t[4], r[4];
+            quat_to_double (q, &theq1[i]);
+            c[0] = -q[0];
+            c[1] = -q[1];
+            c[2] = -q[2];
+            c[3] = q[3];
+            ref_mul (t, q, v);
+            ref_mul (r, t, c);
+            for (k = 0; k < 3; k++)
+                theref[3 * i + k] = (ne10_float32_t) r[k];
+        }
+        GUARD_ARRAY (theout, count * 3);
+        assert_int_equal (NE10_OK, ne10_rotate_vec3f_quatf ( (ne10_vec3f_t*) theout, theq1, thev, count));
+        assert_true (CHECK_ARRAY_GUARD (theout, count * 3));
+        ne10_rotate_vec3f_quatf_c ( (ne10_vec3f_t*) theout_c, theq1, thev, count);
+        check_results (count * 3);
+
+        // matrices: column j is the rotation of the j-th unit vector
+        for (i = 0; i < count; i++)
+        {
+            double q[4], c[4], t[4], r[4];
+            ne10_int32_t j;
+
+            quat_to_double (q, &theq1[i]);
+            c[0] = -q[0];
+            c[1] = -q[1];
+            c[2] = -q[2];
+            c[3] = q[3];
+            for (j = 0; j < 4; j++)
+            {
+                double e[4] = {0.0, 0.0, 0.0, 0.0};
+                e[j] = 1.0;
+                ref_mul (t, q, e);
+                ref_mul (r, t, c);
+                for (k = 0; k < 4; k++)
+                    theref[16 * i + 4 * j + k] = (j < 3 && k < 3) ? (ne10_float32_t) r[k] : (j == k ? 1.0f : 0.0f);
+                if (j < 3)
+                {
+                    for (k = 0; k < 3; k++)
+                        theref[16 * count + 9 * i + 3 * j + k] = (ne10_float32_t) r[k];
+                }
+            }
+        }
+        GUARD_ARRAY (theout, count * 16);
+        assert_int_equal (NE10_OK, ne10_quatf_to_mat4x4f ( (ne10_mat4x4f_t*) theout, theq1, count));
+        assert_true (CHECK_ARRAY_GUARD (theout, count * 16));
+        ne10_quatf_to_mat4x4f_c ( (ne10_mat4x4f_t*) theout_c, theq1, count);
+        check_results (count * 16);
+
+        memmove (theref, theref + 16 * count, count * 9 * sizeof (ne10_float32_t));
+        GUARD_ARRAY (theout, count * 9);
+        assert_int_equal (NE10_OK, ne10_quatf_to_mat3x3f ( (ne10_mat3x3f_t*) theout, theq1, count));
+        assert_true (CHECK_ARRAY_GUARD (theout, count * 9));
+        ne10_quatf_to_mat3x3f_c ( (ne10_mat3x3f_t*) theout_c, theq1, count);
+        check_results (count * 9);
+
+        // In-place, writing over a source
+        memcpy (theout, theq1, count * sizeof (ne10_quatf_t));
+        ne10_mul_quatf_c (out_c, theq1, theq2, count);
+        ne10_mul_quatf (out, out, theq2, count);
+        assert_float_vec_equal (theout_c, theout, ERROR_MARGIN_SMALL, count * 4);
+        ne10_slerp_quatf_c (out_c, out_c, theq2, thet, count);
+        ne10_slerp_quatf (out, out, theq2, thet, count);
+        assert_float_vec_equal (theout_c, theout, ERROR_MARGIN_SMALL, count * 4);
+        memcpy (theout, thev, count * sizeof (ne10_vec3f_t));
+        ne10_rotate_vec3f_quatf_c ( (ne10_vec3f_t*) theout_c, theq1, thev, count);
+        ne10_rotate_vec3f_quatf ( (ne10_vec3f_t*) theout, theq1, (ne10_vec3f_t*) theout, count);
+        assert_float_vec_equal (theout_c, theout, ERROR_MARGIN_SMALL, count * 3);
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+#if defined (PERFORMANCE_TEST)
+typedef struct
+{
+    const char *name;
+    void (*run) (ne10_int32_t use_c, ne10_uint32_t count);
+} test_quat_op_t;
+
+#define TEST_QUAT_PERF(op, call_args) \
+static void perf_##op (ne10_int32_t use_c, ne10_uint32_t count) \
+{ \
+    if (use_c) \
+        ne10_##op##_c call_args; \
+    else \
+        ne10_##op call_args; \
+}
+
+TEST_QUAT_PERF (mul_quatf, ( (ne10_quatf_t*) theout, theq1, theq2, count))
+TEST_QUAT_PERF (normalize_quatf, ( (ne10_quatf_t*) theout, theq1, count))
+TEST_QUAT_PERF (nlerp_quatf, ( (ne10_quatf_t*) theout, theq1, theq2, thet, count))
+TEST_QUAT_PERF (slerp_quatf, ( (ne10_quatf_t*) theout, theq1, theq2, thet, count))
+TEST_QUAT_PERF (rotate_vec3f_quatf, ( (ne10_vec3f_t*) theout, theq1, thev, count))
+TEST_QUAT_PERF (quatf_to_mat3x3f, ( (ne10_mat3x3f_t*) theout, theq1, count))
+TEST_QUAT_PERF (quatf_to_mat4x4f, ( (ne10_mat4x4f_t*) theout, theq1, count))
+#endif
+
+void test_quat_performance()
+{
+#ifdef PERFORMANCE_TEST
+    static const test_quat_op_t ops[] =
+    {
+        {"mul_quatf", perf_mul_quatf},
+        {"normalize_quatf", perf_normalize_quatf},
+        {"nlerp_quatf", perf_nlerp_quatf},
+        {"slerp_quatf", perf_slerp_quatf},
+        {"rotate_vec3f_quatf", perf_rotate_vec3f_quatf},
+        {"quatf_to_mat3x3f", perf_quatf_to_mat3x3f},
+        {"quatf_to_mat4x4f", perf_quatf_to_mat4x4f},
+    };
+    ne10_int64_t time_c = 0;
+    ne10_int64_t time_neon = 0;
+    ne10_float32_t time_speedup = 0.0f;
+    ne10_float32_t time_savings = 0.0f;
+    ne10_uint32_t repeats = PERF_QUATERNIONS / PERF_LENGTH;
+    ne10_uint32_t p, k;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    NE10_rng_init (NE10_rng_test_seed());
+    fill_quaternions (PERF_LENGTH);
+    for (p = 0; p < sizeof (ops) / sizeof (ops[0]); p++)
+    {
+        fprintf (stdout, "%25s%20s%20s%20s%20s\n", ops[p].name, "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+        GET_TIME
+        (
+            time_c,
+        {
+            for (k = 0; k < repeats; k++)
+                ops[p].run (1, PERF_LENGTH);
+        }
+        );
+        GET_TIME
+        (
+            time_neon,
+        {
+            for (k = 0; k < repeats; k++)
+                ops[p].run (0, PERF_LENGTH);
+        }
+        );
+
+        time_speedup = (ne10_float32_t) time_c / time_neon;
+        time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+        ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", PERF_LENGTH, time_c, time_neon, time_savings, time_speedup);
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_quat (void)
+{
+    ne10_float32_t *data;
+
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The tests go through the function pointers, as applications do
+    ne10_init();
+
+    NE10_DST_ALLOC (thet, guarded_t, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (theref, guarded_ref, TEST_BUFFER_LEN * 16 * 2);
+    NE10_DST_ALLOC (theout, guarded_out, TEST_BUFFER_LEN * 16);
+    NE10_DST_ALLOC (theout_c, guarded_out_c, TEST_BUFFER_LEN * 16);
+    // the sources are filled by each test, from the seeded generator
+    NE10_DST_ALLOC (data, guarded_q1, TEST_BUFFER_LEN * 4);
+    theq1 = (ne10_quatf_t*) data;
+    NE10_DST_ALLOC (data, guarded_q2, TEST_BUFFER_LEN * 4);
+    theq2 = (ne10_quatf_t*) data;
+    NE10_DST_ALLOC (data, guarded_v, TEST_BUFFER_LEN * 3);
+    thev = (ne10_vec3f_t*) data;
+
+    run_test (test_quat_conformance);       // run tests
+    run_test (test_quat_performance);
+
+    free (guarded_q1);
+    free (guarded_q2);
+    free (guarded_t);
+    free (guarded_v);
+    free (guarded_ref);
+    free (guarded_out);
+    free (guarded_out_c);
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -0,0 +1,573 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_reduce.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "NE10_init.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#if defined (REGRESSION_TEST)
+#define TEST_LENGTH_MAX 1031
+#else
+#define TEST_LENGTH_MAX 67
+#endif
+
+/* more than three blocks of the minimum and maximum searches */
+#define TEST_LENGTH_LONG 3117
+
+/* an array that stays in the caches, and one that does not */
+#define PERF_LENGTH_SHORT 4096
+#define PERF_LENGTH_LONG (4 * 1024 * 1024)
+#define PERF_ELEMENTS (64 * 1024 * 1024)
+
+#if defined (PERFORMANCE_TEST)
+#define TEST_BUFFER_LEN PERF_LENGTH_LONG
+#else
+#define TEST_BUFFER_LEN TEST_LENGTH_LONG
+#endif
+
+//input
+static ne10_float32_t * thesrc1 = NULL;
+static ne10_float32_t * thesrc2 = NULL;
+static ne10_int16_t * thesrc1_16 = NULL;
+static ne10_int16_t * thesrc2_16 = NULL;
+static ne10_int32_t * thesrc1_32 = NULL;
+static ne10_int32_t * thesrc2_32 = NULL;
+
+typedef enum
+{
+    TEST_SUM,
+    TEST_MEAN,
+    TEST_DOTPROD,
+    TEST_NORM2,
+    TEST_MAX,
+    TEST_MIN,
+    TEST_MAXABS,
+    TEST_FLOAT_FUNCTIONS
+} test_float_function_t;
+
+typedef enum
+{
+    TEST_SUM_INT16,
+    TEST_SUM_INT32,
+    TEST_DOTPROD_INT16,
+    TEST_DOTPROD_INT32,
+    TEST_MAXABS_INT16,
+    TEST_MAXABS_INT32,
+    TEST_INT_FUNCTIONS
+} test_int_function_t;
+
+#if defined (PERFORMANCE_TEST)
+static const char * const test_float_names[TEST_FLOAT_FUNCTIONS] =
+{
+    "sum_float", "mean_float", "dotprod_float", "norm2_float", "max_float", "min_float", "maxabs_float"
+};
+
+static const char * const test_int_names[TEST_INT_FUNCTIONS] =
+{
+    "sum_int16", "sum_int32", "dotprod_int16", "dotprod_int32", "maxabs_int16", "maxabs_int32"
+};
+#endif
+
+/* uniform in [lo, hi] */
+static ne10_float32_t rand_range (ne10_float32_t lo, ne10_float32_t hi)
+{
+    return lo + (hi - lo) * ( (ne10_float32_t) NE10_rng_next() / NE10_rng_max());
+}
+
+static ne10_uint32_t rand_bits (void)
+{
+    return ( (ne10_uint32_t) NE10_rng_next() << 16) ^ NE10_rng_next();
+}
+
+/*
+ * Finite sources of mixed magnitudes; for the searches, also NaNs,
+ * infinities, signed zeros and repeated values.
+ */
+static void fill_float (ne10_uint32_t count, ne10_int32_t search)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        thesrc1[i] = rand_range (-1.0f, 1.0f) * ( (i % 3) ? 1.0f : 1000.0f);
+        thesrc2[i] = rand_range (-1.0f, 1.0f);
+        if (!search)
+            continue;
+        if (i % 13 == 5)
+            thesrc1[i] = NAN;
+        else if (i % 97 == 11)
+            thesrc1[i] = (i & 1) ? -0.0f : 0.0f;
+        else if (i % 389 == 7)
+            thesrc1[i] = (i & 1) ? -INFINITY : INFINITY;
+    }
+    if (search && count > 1)
+    {
+        for (i = 0; i < 8; i++)
+            thesrc1[rand_bits() % count] = thesrc1[rand_bits() % count];
+    }
+}
+
+static void fill_int (ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        thesrc1_16[i] = (ne10_int16_t) rand_bits();
+        thesrc2_16[i] = (ne10_int16_t) rand_bits();
+        thesrc1_32[i] = (ne10_int32_t) rand_bits();
+        thesrc2_32[i] = (ne10_int32_t) rand_bits();
+    }
+    if (count > 0)
+    {
+        // the values whose absolute values saturate
+        thesrc1_16[rand_bits() % count] = -32768;
+        thesrc1_32[rand_bits() % count] = (ne10_int32_t) 0x80000000;
+    }
+}
+
+typedef enum
+{
+    TEST_IMPL_C,
+    TEST_IMPL_DISPATCH,
+    TEST_IMPL_SSE,
+    TEST_IMPL_AVX2
+} test_impl_t;
+
+#if defined (NE10_ENABLE_X86)
+#define TEST_CALL_X86(name, args) \
+    case TEST_IMPL_SSE: \
+        return name##_sse args; \
+    case TEST_IMPL_AVX2: \
+        return name##_avx2 args;
+#else
+#define TEST_CALL_X86(name, args)
+#endif
+
+#define TEST_CALL(name, impl, args) \
+    switch (impl) \
+    { \
+    case TEST_IMPL_C: \
+        return name##_c args; \
+    TEST_CALL_X86 (name, args) \
+    default: \
+        return name args; \
+    }
+
+// the fixed-point functions have no x86 versions
+#define TEST_CALL_INT(name, impl, args) \
+    return (impl == TEST_IMPL_C) ? name##_c args : name args;
+
+static ne10_result_t run_float (test_float_function_t fn, test_impl_t impl, ne10_float32_t * out, ne10_uint32_t * index, ne10_uint32_t count)
+{
+    switch (fn)
+    {
+    case TEST_SUM:
+        TEST_CALL (ne10_sum_float, impl, (out, thesrc1, count));
+    case TEST_MEAN:
+        TEST_CALL (ne10_mean_float, impl, (out, thesrc1, count));
+    case TEST_DOTPROD:
+        TEST_CALL (ne10_dotprod_float, impl, (out, thesrc1, thesrc2, count));
+    case TEST_NORM2:
+        TEST_CALL (ne10_norm2_float, impl, (out, thesrc1, count));
+    case TEST_MAX:
+        TEST_CALL (ne10_max_float, impl, (out, index, thesrc1, count));
+    case TEST_MIN:
+        TEST_CALL (ne10_min_float, impl, (out, index, thesrc1, count));
+    default:
+        TEST_CALL (ne10_maxabs_float, impl, (out, index, thesrc1, count));
+    }
+}
+
+/* the int16 and int32 results are returned in out */
+static ne10_result_t run_int (test_int_function_t fn, test_impl_t impl, ne10_int64_t * out, ne10_uint32_t * index, ne10_uint32_t count)
+{
+    ne10_int16_t v16 = 0;
+    ne10_int32_t v32 = 0;
+    ne10_result_t r;
+
+    switch (fn)
+    {
+    case TEST_SUM_INT16:
+        TEST_CALL_INT (ne10_sum_int16, impl, (out, thesrc1_16, count));
+    case TEST_SUM_INT32:
+        TEST_CALL_INT (ne10_sum_int32, impl, (out, thesrc1_32, count));
+    case TEST_DOTPROD_INT16:
+        TEST_CALL_INT (ne10_dotprod_int16, impl, (out, thesrc1_16, thesrc2_16, count));
+    case TEST_DOTPROD_INT32:
+        TEST_CALL_INT (ne10_dotprod_int32, impl, (out, thesrc1_32, thesrc2_32, count));
+    case TEST_MAXABS_INT16:
+        r = (impl == TEST_IMPL_C) ? ne10_maxabs_int16_c (&v16, index, thesrc1_16, count)
+            : ne10_maxabs_int16 (&v16, index, thesrc1_16, count);
+        *out = v16;
+        return r;
+    default:
+        r = (impl == TEST_IMPL_C) ? ne10_maxabs_int32_c (&v32, index, thesrc1_32, count)
+            : ne10_maxabs_int32 (&v32, index, thesrc1_32, count);
+        *out = v32;
+        return r;
+    }
+}
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+/* the largest error allowed for a sum of count terms whose absolute values add up to sum_abs */
+static double sum_bound (ne10_uint32_t count, double sum_abs)
+{
+    return (count / 32 + 6) * FLT_EPSILON * sum_abs;
+}
+
+/* checks the C result of a sum against the sum in double precision */
+static void check_float_sum (test_float_function_t fn, ne10_float32_t r, ne10_uint32_t count)
+{
+    double ref = 0.0, sum_abs = 0.0;
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        double t = thesrc1[i];
+
+        if (fn == TEST_DOTPROD)
+            t *= thesrc2[i];
+        else if (fn == TEST_NORM2)
+            t *= t;
+        ref += t;
+        sum_abs += fabs (t);
+    }
+    switch (fn)
+    {
+    case TEST_MEAN:
+        assert_true (fabs (r - ref / count) <= sum_bound (count, sum_abs) / count + FLT_EPSILON * fabs (ref / count));
+        break;
+    case TEST_NORM2:
+        assert_true (fabs (r - sqrt (ref)) <= sum_bound (count, sqrt (ref)));
+        break;
+    default:
+        assert_true (fabs (r - ref) <= sum_bound (count, sum_abs));
+        break;
+    }
+}
+
+/* checks the C result of a search against the first extreme found in order */
+static void check_float_search (test_float_function_t fn, ne10_float32_t r, ne10_uint32_t index, ne10_uint32_t count)
+{
+    ne10_float32_t best = 0.0f;
+    ne10_uint32_t i, first = 0;
+    ne10_int32_t found = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x = (fn == TEST_MAXABS) ? fabsf (thesrc1[i]) : thesrc1[i];
+
+        if (x != x)
+            continue;
+        if (!found || ( (fn == TEST_MIN) ? (x < best) : (x > best)))
+        {
+            best = x;
+            first = i;
+            found = 1;
+        }
+    }
+    assert_int_equal (first, index);
+    best = (fn == TEST_MAXABS) ? fabsf (thesrc1[first]) : thesrc1[first];
+    assert_true (memcmp (&best, &r, sizeof (r)) == 0);
+}
+
+static void check_float (test_float_function_t fn, ne10_uint32_t count)
+{
+    ne10_float32_t out_c = 0.0f, out;
+    ne10_uint32_t index_c = 0, index;
+    ne10_result_t r_c;
+    ne10_int32_t impl;
+
+    r_c = run_float (fn, TEST_IMPL_C, &out_c, &index_c, count);
+    if (count == 0 && fn != TEST_SUM && fn != TEST_DOTPROD && fn != TEST_NORM2)
+    {
+        assert_int_equal (NE10_ERR, r_c);
+    }
+    else
+    {
+        assert_int_equal (NE10_OK, r_c);
+        if (fn >= TEST_MAX)
+            check_float_search (fn, out_c, index_c, count);
+        else
+            check_float_sum (fn, out_c, count);
+    }
+
+    // every version gives the result of the C version, bit for bit
+    for (impl = TEST_IMPL_DISPATCH; impl <= TEST_IMPL_AVX2; impl++)
+    {
+#if defined (NE10_ENABLE_X86)
+        if ( (impl == TEST_IMPL_SSE && ne10_HasSSE41() != NE10_OK)
+                || (impl == TEST_IMPL_AVX2 && ne10_HasAVX2() != NE10_OK))
+            continue;
+#else
+        if (impl > TEST_IMPL_DISPATCH)
+            break;
+#endif
+        out = out_c;
+        index = index_c;
+        assert_int_equal (r_c, run_float (fn, (test_impl_t) impl, &out, &index, count));
+        assert_true (memcmp (&out, &out_c, sizeof (out)) == 0);
+        assert_int_equal (index_c, index);
+    }
+}
+
+static void check_int (test_int_function_t fn, ne10_uint32_t count)
+{
+    ne10_int64_t ref = 0, out_c = 0, out = 0;
+    ne10_uint32_t i, first = 0, index_c = 0, index = 0;
+    ne10_result_t r_c;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_int64_t a;
+
+        switch (fn)
+        {
+        case TEST_SUM_INT16:
+            ref += thesrc1_16[i];
+            break;
+        case TEST_SUM_INT32:
+            ref += thesrc1_32[i];
+            break;
+        case TEST_DOTPROD_INT16:
+            ref += (ne10_int64_t) thesrc1_16[i] * thesrc2_16[i];
+            break;
+        case TEST_DOTPROD_INT32:
+            ref += ( (ne10_int64_t) thesrc1_32[i] * thesrc2_32[i]) >> 31;
+            break;
+        case TEST_MAXABS_INT16:
+            a = llabs ( (ne10_int64_t) thesrc1_16[i]);
+            a = (a > 32767) ? 32767 : a;
+            if (i == 0 || a > ref)
+            {
+                ref = a;
+                first = i;
+            }
+            break;
+        default:
+            a = llabs ( (ne10_int64_t) thesrc1_32[i]);
+            a = (a > 0x7fffffff) ? 0x7fffffff : a;
+            if (i == 0 || a > ref)
+            {
+                ref = a;
+                first = i;
+            }
+            break;
+        }
+    }
+
+    r_c = run_int (fn, TEST_IMPL_C, &out_c, &index_c, count);
+    if (count == 0 && fn >= TEST_MAXABS_INT16)
+    {
+        assert_int_equal (NE10_ERR, r_c);
+        assert_int_equal (NE10_ERR, run_int (fn, TEST_IMPL_DISPATCH, &out, &index, count));
+        return;
+    }
+    assert_int_equal (NE10_OK, r_c);
+    assert_true (out_c == ref);
+    assert_int_equal (NE10_OK, run_int (fn, TEST_IMPL_DISPATCH, &out, &index, count));
+    assert_true (out == ref);
+    if (fn >= TEST_MAXABS_INT16)
+    {
+        assert_int_equal (first, index_c);
+        assert_int_equal (first, index);
+    }
+}
+
+static void check_all (ne10_uint32_t count)
+{
+    ne10_uint32_t fn;
+
+    fill_float (count, 0);
+    for (fn = TEST_SUM; fn < TEST_MAX; fn++)
+        check_float ( (test_float_function_t) fn, count);
+    fill_float (count, 1);
+    for (fn = TEST_MAX; fn < TEST_FLOAT_FUNCTIONS; fn++)
+        check_float ( (test_float_function_t) fn, count);
+    fill_int (count);
+    for (fn = 0; fn < TEST_INT_FUNCTIONS; fn++)
+        check_int ( (test_int_function_t) fn, count);
+}
+#endif
+
+void test_reduce_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_uint32_t count, i, fn;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    NE10_rng_init (NE10_rng_test_seed());
+    for (count = 0; count <= TEST_LENGTH_MAX; count++)
+        check_all (count);
+    check_all (TEST_LENGTH_LONG);
+
+    // no value but NaNs: the first element is the result
+    for (i = 0; i < TEST_LENGTH_LONG; i++)
+        thesrc1[i] = NAN;
+    for (fn = TEST_MAX; fn < TEST_FLOAT_FUNCTIONS; fn++)
+        check_float ( (test_float_function_t) fn, TEST_LENGTH_LONG);
+
+    // the extreme as the last element, in the last of several blocks
+    fill_float (TEST_LENGTH_LONG, 1);
+    thesrc1[TEST_LENGTH_LONG - 1] = 3.0e6f;
+    check_float (TEST_MAX, TEST_LENGTH_LONG);
+    check_float (TEST_MAXABS, TEST_LENGTH_LONG);
+    thesrc1[TEST_LENGTH_LONG - 1] = -3.0e6f;
+    check_float (TEST_MIN, TEST_LENGTH_LONG);
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+#if defined (PERFORMANCE_TEST)
+/* the bytes of the sources of a function over count elements */
+static double source_bytes (ne10_int32_t is_int, ne10_uint32_t fn, ne10_uint32_t count)
+{
+    if (is_int)
+    {
+        double size = (fn == TEST_SUM_INT16 || fn == TEST_DOTPROD_INT16 || fn == TEST_MAXABS_INT16) ? 2.0 : 4.0;
+        return size * count * ( (fn == TEST_DOTPROD_INT16 || fn == TEST_DOTPROD_INT32) ? 2 : 1);
+    }
+    return 4.0 * count * ( (fn == TEST_DOTPROD) ? 2 : 1);
+}
+#endif
+
+void test_reduce_performance()
+{
+#ifdef PERFORMANCE_TEST
+    static const ne10_uint32_t lengths[2] = { PERF_LENGTH_SHORT, PERF_LENGTH_LONG };
+    ne10_int64_t time_c = 0;
+    ne10_int64_t time_neon = 0;
+    ne10_float32_t time_speedup = 0.0f;
+    ne10_float32_t time_savings = 0.0f;
+    ne10_float32_t out;
+    ne10_int64_t out_int;
+    ne10_uint32_t index;
+    ne10_uint32_t fn, l, k, count, repeats, is_int;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    NE10_rng_init (NE10_rng_test_seed());
+    fill_float (PERF_LENGTH_LONG, 0);
+    fill_int (PERF_LENGTH_LONG);
+    for (is_int = 0; is_int < 2; is_int++)
+    {
+        for (fn = 0; fn < (is_int ? TEST_INT_FUNCTIONS : TEST_FLOAT_FUNCTIONS); fn++)
+        {
+            fprintf (stdout, "%25s%20s%20s%20s%20s\n", is_int ? test_int_names[fn] : test_float_names[fn],
+                     "C Time (micro-s)", "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+            for (l = 0; l < 2; l++)
+            {
+                count = lengths[l];
+                repeats = PERF_ELEMENTS / count;
+                GET_TIME
+                (
+                    time_c,
+                {
+                    for (k = 0; k < repeats; k++)
+                    {
+                        if (is_int)
+                            run_int ( (test_int_function_t) fn, TEST_IMPL_C, &out_int, &index, count);
+                        else
+                            run_float ( (test_float_function_t) fn, TEST_IMPL_C, &out, &index, count);
+                    }
+                }
+                );
+                GET_TIME
+                (
+                    time_neon,
+                {
+                    for (k = 0; k < repeats; k++)
+                    {
+                        if (is_int)
+                            run_int ( (test_int_function_t) fn, TEST_IMPL_DISPATCH, &out_int, &index, count);
+                        else
+                            run_float ( (test_float_function_t) fn, TEST_IMPL_DISPATCH, &out, &index, count);
+                    }
+                }
+                );
+
+                time_speedup = (ne10_float32_t) time_c / time_neon;
+                time_savings = ( ( (ne10_float32_t) (time_c - time_neon)) / time_c) * 100;
+                ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", count, time_c, time_neon, time_savings, time_speedup);
+                fprintf (stdout, "%45s%20.2f GB/s\n", "NEON source throughput",
+                         source_bytes (is_int, fn, count) * repeats / (time_neon * 1000.0));
+            }
+        }
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_reduce (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The tests go through the function pointers, as applications do
+    ne10_init();
+
+    // the sources are filled by each test, from the seeded generator
+    thesrc1 = (ne10_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_float32_t));
+    thesrc2 = (ne10_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_float32_t));
+    thesrc1_16 = (ne10_int16_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_int16_t));
+    thesrc2_16 = (ne10_int16_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_int16_t));
+    thesrc1_32 = (ne10_int32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_int32_t));
+    thesrc2_32 = (ne10_int32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_int32_t));
+
+    run_test (test_reduce_conformance);       // run tests
+    run_test (test_reduce_performance);
+
+    free (thesrc1);
+    free (thesrc2);
+    free (thesrc1_16);
+    free (thesrc2_16);
+    free (thesrc1_32);
+    free (thesrc2_32);
+
+    test_fixture_end();                 // ends a fixture
+}
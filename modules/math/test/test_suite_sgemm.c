@@ -0,0 +1,329 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_sgemm.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#include "NE10_math.h"
+#include "NE10_random.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+/* matrix sizes, around the 8 x 4 and 16 x 4 tiles and, for the regression
+ * test, the 128-row and 256-deep cache blocks */
+#if defined (REGRESSION_TEST)
+static const ne10_uint32_t TEST_SIZES[] = {1, 3, 8, 9, 17, 33, 129, 260};
+#elif defined (SMOKE_TEST)
+static const ne10_uint32_t TEST_SIZES[] = {1, 3, 8, 9, 17, 33};
+#endif
+#define NUM_TEST_SIZES (sizeof (TEST_SIZES) / sizeof (TEST_SIZES[0]))
+#define TEST_SIZE_MAX 260
+/* extra rows between the columns of each matrix */
+#define TEST_LD_PAD 3
+#define TEST_LD_MAX (TEST_SIZE_MAX + TEST_LD_PAD)
+
+#if defined (PERFORMANCE_TEST)
+static const ne10_uint32_t PERF_SIZES[] = {16, 32, 64, 128, 256, 512};
+#define NUM_PERF_SIZES (sizeof (PERF_SIZES) / sizeof (PERF_SIZES[0]))
+#endif
+#define PERF_SIZE_MAX 512
+#define PERF_FLOPS (1 << 28)
+
+#define TEST_BUFFER_LEN (TEST_LD_MAX * TEST_SIZE_MAX > PERF_SIZE_MAX * PERF_SIZE_MAX ? \
+                         TEST_LD_MAX * TEST_SIZE_MAX : PERF_SIZE_MAX * PERF_SIZE_MAX)
+
+#define TEST_SENTINEL 12345.0f
+
+static ne10_float32_t * thea = NULL;
+static ne10_float32_t * theb = NULL;
+static ne10_float32_t * thec0 = NULL;
+static ne10_float32_t * thec_ref = NULL;
+static ne10_float32_t * thec_out = NULL;
+static ne10_float32_t * thec_c = NULL;
+
+/* values in [-1, 1], so that the sums stay well inside the float range */
+static void test_sgemm_fill (ne10_float32_t *arr, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+        arr[i] = 2.0f * ( (ne10_float32_t) NE10_rng_next() / NE10_rng_max()) - 1.0f;
+}
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static ne10_float32_t test_sgemm_op (const ne10_float32_t *x, ne10_uint32_t ld, ne10_transpose_t trans,
+                                     ne10_uint32_t row, ne10_uint32_t col)
+{
+    return (trans == NE10_NO_TRANSPOSE) ? x[row + col * ld] : x[col + row * ld];
+}
+
+/*
+ * Checks C against a double precision reference, to within the usual bound on
+ * the rounding error of a sum of k products, and checks that the padding
+ * between the columns of C is untouched.
+ */
+static int test_sgemm_check (ne10_transpose_t ta, ne10_transpose_t tb,
+                             ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k,
+                             ne10_float32_t alpha, ne10_uint32_t lda, ne10_uint32_t ldb,
+                             ne10_float32_t beta, const ne10_float32_t *c0, const ne10_float32_t *c, ne10_uint32_t ldc)
+{
+    ne10_uint32_t i, j, p;
+
+    for (j = 0; j < n; j++)
+    {
+        for (i = 0; i < m; i++)
+        {
+            ne10_float64_t sum = 0.0, bound = 0.0, ref, err;
+            for (p = 0; p < k; p++)
+            {
+                ne10_float64_t prod = (ne10_float64_t) test_sgemm_op (thea, lda, ta, i, p)
+                                      * test_sgemm_op (theb, ldb, tb, p, j);
+                sum += prod;
+                bound += fabs (prod);
+            }
+            ref = alpha * sum;
+            bound = fabs (alpha) * bound;
+            if (beta != 0.0f)
+            {
+                ref += beta * (ne10_float64_t) c0[i + j * ldc];
+                bound += fabs (beta * (ne10_float64_t) c0[i + j * ldc]);
+            }
+            err = fabs (c[i + j * ldc] - ref);
+            if (! (err <= (k + 2) * FLT_EPSILON * bound + FLT_MIN))
+            {
+                fprintf (stdout, "sgemm %c%c m=%d n=%d k=%d: C(%d, %d) = %g, expected %g\n",
+                         ta ? 'T' : 'N', tb ? 'T' : 'N', m, n, k, i, j, c[i + j * ldc], ref);
+                return 0;
+            }
+        }
+        for (i = m; i < ldc; i++)
+        {
+            if (c[i + j * ldc] != TEST_SENTINEL)
+                return 0;
+        }
+    }
+    return 1;
+}
+
+static void test_sgemm_case (ne10_transpose_t ta, ne10_transpose_t tb,
+                             ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k,
+                             ne10_float32_t alpha, ne10_float32_t beta)
+{
+    ne10_uint32_t lda = ( (ta == NE10_NO_TRANSPOSE) ? m : k) + TEST_LD_PAD;
+    ne10_uint32_t ldb = ( (tb == NE10_NO_TRANSPOSE) ? k : n) + TEST_LD_PAD;
+    ne10_uint32_t ldc = m + TEST_LD_PAD;
+    ne10_uint32_t i, j;
+
+    // The initial C, with sentinels in the padding; NaN when beta is zero, as it must not be read
+    for (j = 0; j < n; j++)
+    {
+        for (i = 0; i < ldc; i++)
+        {
+            if (i >= m)
+                thec0[i + j * ldc] = TEST_SENTINEL;
+            else if (beta == 0.0f)
+                thec0[i + j * ldc] = NAN;
+            else
+                thec0[i + j * ldc] = thec_ref[i + j * ldc];
+        }
+    }
+    memcpy (thec_out, thec0, ldc * n * sizeof (ne10_float32_t));
+    memcpy (thec_c, thec0, ldc * n * sizeof (ne10_float32_t));
+
+    assert_int_equal (NE10_OK, ne10_sgemm (ta, tb, m, n, k, alpha, thea, lda, theb, ldb, beta, thec_out, ldc));
+    assert_int_equal (NE10_OK, ne10_sgemm_c (ta, tb, m, n, k, alpha, thea, lda, theb, ldb, beta, thec_c, ldc));
+    assert_true (test_sgemm_check (ta, tb, m, n, k, alpha, lda, ldb, beta, thec0, thec_out, ldc));
+
+    // Every implementation adds the products of each element in the same order
+    assert_float_vec_equal (thec_c, thec_out, ERROR_MARGIN_SMALL, ldc * n);
+}
+#endif
+
+void test_sgemm_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    static const ne10_float32_t alphas[] = {1.0f, -0.5f, 0.0f};
+    static const ne10_float32_t betas[] = {0.0f, 1.0f, 2.0f};
+    ne10_uint32_t t, im, in, ik, s;
+    ne10_float32_t saved;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    for (t = 0; t < 4; t++)
+    {
+        ne10_transpose_t ta = (t & 1) ? NE10_TRANSPOSE : NE10_NO_TRANSPOSE;
+        ne10_transpose_t tb = (t & 2) ? NE10_TRANSPOSE : NE10_NO_TRANSPOSE;
+
+        for (im = 0; im < NUM_TEST_SIZES; im++)
+        {
+            for (in = 0; in < NUM_TEST_SIZES; in++)
+            {
+                for (ik = 0; ik < NUM_TEST_SIZES; ik++)
+                {
+                    s = im + in + ik;
+                    test_sgemm_case (ta, tb, TEST_SIZES[im], TEST_SIZES[in], TEST_SIZES[ik],
+                                     alphas[s % 2], betas[s % 3]);
+                }
+            }
+        }
+    }
+
+#if defined (REGRESSION_TEST)
+    // More columns than one packed panel of op(B)
+    test_sgemm_case (NE10_NO_TRANSPOSE, NE10_TRANSPOSE, 9, 2100, 5, 1.0f, 1.0f);
+#endif
+
+    // No product: C = beta * C
+    test_sgemm_case (NE10_NO_TRANSPOSE, NE10_NO_TRANSPOSE, 17, 9, 0, 1.0f, 2.0f);
+    test_sgemm_case (NE10_NO_TRANSPOSE, NE10_NO_TRANSPOSE, 17, 9, 33, alphas[2], 0.0f);
+    test_sgemm_case (NE10_NO_TRANSPOSE, NE10_NO_TRANSPOSE, 17, 9, 33, alphas[2], 2.0f);
+
+    // Leading dimensions that are too small are rejected without touching C
+    saved = thec_out[0];
+    assert_int_equal (NE10_ERR, ne10_sgemm (NE10_NO_TRANSPOSE, NE10_NO_TRANSPOSE, 9, 8, 3, 1.0f, thea, 8, theb, 3, 0.0f, thec_out, 9));
+    assert_int_equal (NE10_ERR, ne10_sgemm (NE10_TRANSPOSE, NE10_NO_TRANSPOSE, 9, 8, 3, 1.0f, thea, 2, theb, 3, 0.0f, thec_out, 9));
+    assert_int_equal (NE10_ERR, ne10_sgemm (NE10_NO_TRANSPOSE, NE10_TRANSPOSE, 9, 8, 3, 1.0f, thea, 9, theb, 7, 0.0f, thec_out, 9));
+    assert_int_equal (NE10_ERR, ne10_sgemm (NE10_NO_TRANSPOSE, NE10_NO_TRANSPOSE, 9, 8, 3, 1.0f, thea, 9, theb, 3, 0.0f, thec_out, 8));
+    assert_true (thec_out[0] == saved);
+
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+#if defined (PERFORMANCE_TEST)
+/* the textbook loop, in the column order of the reference BLAS */
+static void test_sgemm_naive (ne10_uint32_t m, ne10_uint32_t n, ne10_uint32_t k,
+                              const ne10_float32_t *a, const ne10_float32_t *b, ne10_float32_t *c)
+{
+    ne10_uint32_t i, j, p;
+
+    for (j = 0; j < n; j++)
+    {
+        for (i = 0; i < m; i++)
+            c[i + j * m] = 0.0f;
+        for (p = 0; p < k; p++)
+        {
+            ne10_float32_t bpj = b[p + j * k];
+            for (i = 0; i < m; i++)
+                c[i + j * m] += a[i + p * m] * bpj;
+        }
+    }
+}
+#endif
+
+void test_sgemm_performance()
+{
+#ifdef PERFORMANCE_TEST
+    ne10_int64_t time_naive = 0;
+    ne10_int64_t time_sgemm = 0;
+    ne10_float32_t gflops_naive, gflops_sgemm;
+    ne10_uint32_t loop, r;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    fprintf (stdout, "%25s%20s%20s%20s\n", "m = n = k", "Naive (GFLOPS)", "ne10_sgemm (GFLOPS)", "Performance Ratio");
+    for (loop = 0; loop < NUM_PERF_SIZES; loop++)
+    {
+        ne10_uint32_t size = PERF_SIZES[loop];
+        ne10_float64_t flops = 2.0 * size * size * size;
+        ne10_uint32_t repeats = (ne10_uint32_t) (PERF_FLOPS / flops);
+
+        if (repeats == 0)
+            repeats = 1;
+        GET_TIME
+        (
+            time_naive,
+        {
+            for (r = 0; r < repeats; r++)
+                test_sgemm_naive (size, size, size, thea, theb, thec_ref);
+        }
+        );
+        GET_TIME
+        (
+            time_sgemm,
+        {
+            for (r = 0; r < repeats; r++)
+                ne10_sgemm (NE10_NO_TRANSPOSE, NE10_NO_TRANSPOSE, size, size, size,
+                            1.0f, thea, size, theb, size, 0.0f, thec_out, size);
+        }
+        );
+
+        gflops_naive = flops * repeats / (time_naive * 1e3);
+        gflops_sgemm = flops * repeats / (time_sgemm * 1e3);
+        fprintf (stdout, "%25d%20.2f%20.2f%18.2f:1\n", size, gflops_naive, gflops_sgemm, gflops_sgemm / gflops_naive);
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_sgemm (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The tests go through the function pointers, as applications do
+    ne10_init();
+
+    thea = (ne10_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_float32_t));
+    theb = (ne10_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_float32_t));
+    thec0 = (ne10_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_float32_t));
+    thec_ref = (ne10_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_float32_t));
+    thec_out = (ne10_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_float32_t));
+    thec_c = (ne10_float32_t*) malloc (TEST_BUFFER_LEN * sizeof (ne10_float32_t));
+    NE10_rng_init (0x5EED);
+    test_sgemm_fill (thea, TEST_BUFFER_LEN);
+    test_sgemm_fill (theb, TEST_BUFFER_LEN);
+    test_sgemm_fill (thec_ref, TEST_BUFFER_LEN);
+
+    run_test (test_sgemm_conformance);       // run tests
+    run_test (test_sgemm_performance);
+
+    free (thea);
+    free (theb);
+    free (thec0);
+    free (thec_ref);
+    free (thec_out);
+    free (thec_c);
+
+    test_fixture_end();                 // ends a fixture
+}
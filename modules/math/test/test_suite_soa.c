@@ -0,0 +1,448 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_soa.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#if defined (REGRESSION_TEST)
+#define TEST_LENGTH_MAX 1031
+#else
+#define TEST_LENGTH_MAX 67
+#endif
+
+/* Performance lengths, in vectors: L1-resident, L2-resident and larger than the caches */
+#define PERF_LENGTH_MAX (256 * 1024)
+#if defined (PERFORMANCE_TEST)
+static const ne10_uint32_t PERF_LENGTHS[] = {512, 8 * 1024, PERF_LENGTH_MAX};
+#define NUM_PERF_LENGTHS (sizeof (PERF_LENGTHS) / sizeof (PERF_LENGTHS[0]))
+#define PERF_VECTORS (16 * 1024 * 1024)
+#endif
+
+#define TEST_BUFFER_LEN (TEST_LENGTH_MAX > PERF_LENGTH_MAX ? TEST_LENGTH_MAX : PERF_LENGTH_MAX)
+
+/* the SoA component arrays of the two sources and of the destination */
+#define SRC1 0
+#define SRC2 1
+#define DST 2
+
+//input and output: the AoS arrays have room for TEST_BUFFER_LEN vec4f
+static ne10_float32_t * guarded_aos1 = NULL;
+static ne10_float32_t * guarded_aos2 = NULL;
+static ne10_float32_t * guarded_aos_ref = NULL;
+static ne10_float32_t * guarded_aos_out = NULL;
+static ne10_float32_t * guarded_ref = NULL;
+static ne10_float32_t * guarded_out = NULL;
+static ne10_float32_t * theaos1 = NULL;
+static ne10_float32_t * theaos2 = NULL;
+static ne10_float32_t * theaos_ref = NULL;
+static ne10_float32_t * theaos_out = NULL;
+static ne10_float32_t * theref = NULL;
+static ne10_float32_t * theout = NULL;
+
+static ne10_float32_t * guarded_soa[3][4];
+static ne10_float32_t * thesoa[3][4];
+static ne10_vec3f_soa_t soa3[3];
+static ne10_vec4f_soa_t soa4[3];
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+static void guard_soa (ne10_uint32_t set, ne10_uint32_t count)
+{
+    ne10_uint32_t k;
+
+    for (k = 0; k < 4; k++)
+        GUARD_ARRAY (thesoa[set][k], count);
+}
+
+static int check_soa_guard (ne10_uint32_t set, ne10_uint32_t count)
+{
+    ne10_uint32_t k;
+
+    for (k = 0; k < 4; k++)
+    {
+        if (!CHECK_ARRAY_GUARD (thesoa[set][k], count))
+            return 0;
+    }
+    return 1;
+}
+
+/* compares the components of one SoA set with the vec3f (comps = 3) or vec4f AoS reference */
+static void check_soa_equal (ne10_uint32_t set, ne10_uint32_t comps, ne10_uint32_t count)
+{
+    ne10_uint32_t i, k;
+
+    for (k = 0; k < comps; k++)
+    {
+        for (i = 0; i < count; i++)
+            theout[i] = theaos_ref[i * comps + k];
+        assert_float_vec_equal (theout, thesoa[set][k], ERROR_MARGIN_SMALL, count);
+    }
+}
+#endif
+
+void test_soa_vec3f_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_vec3f_t *aos1 = (ne10_vec3f_t*) theaos1;
+    ne10_vec3f_t *aos2 = (ne10_vec3f_t*) theaos2;
+    ne10_vec3f_t *aos_ref = (ne10_vec3f_t*) theaos_ref;
+    ne10_uint32_t count;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    for (count = 0; count <= TEST_LENGTH_MAX; count++)
+    {
+        // Conversion in both directions gives back the original vectors
+        guard_soa (SRC1, count);
+        guard_soa (SRC2, count);
+        GUARD_ARRAY (theaos_out, count * 3);
+        assert_int_equal (NE10_OK, ne10_vec3f_aos_to_soa (&soa3[SRC1], aos1, count));
+        assert_int_equal (NE10_OK, ne10_vec3f_aos_to_soa (&soa3[SRC2], aos2, count));
+        assert_int_equal (NE10_OK, ne10_vec3f_soa_to_aos ( (ne10_vec3f_t*) theaos_out, &soa3[SRC1], count));
+        assert_true (check_soa_guard (SRC1, count));
+        assert_true (check_soa_guard (SRC2, count));
+        assert_true (CHECK_ARRAY_GUARD (theaos_out, count * 3));
+        memcpy (theaos_ref, theaos1, count * sizeof (ne10_vec3f_t));
+        check_soa_equal (SRC1, 3, count);
+        assert_float_vec_equal (theaos1, theaos_out, ERROR_MARGIN_SMALL, count * 3);
+
+        // Every operation against the AoS C version
+        GUARD_ARRAY (theout, count);
+        ne10_len_vec3f_c (theref, aos1, count);
+        assert_int_equal (NE10_OK, ne10_len_vec3f_soa (theout, &soa3[SRC1], count));
+        assert_true (CHECK_ARRAY_GUARD (theout, count));
+        assert_float_vec_equal (theref, theout, ERROR_MARGIN_SMALL, count);
+
+        GUARD_ARRAY (theout, count);
+        ne10_dot_vec3f_c (theref, aos1, aos2, count);
+        assert_int_equal (NE10_OK, ne10_dot_vec3f_soa (theout, &soa3[SRC1], &soa3[SRC2], count));
+        assert_true (CHECK_ARRAY_GUARD (theout, count));
+        assert_float_vec_equal (theref, theout, ERROR_MARGIN_SMALL, count);
+
+        guard_soa (DST, count);
+        ne10_normalize_vec3f_c (aos_ref, aos1, count);
+        assert_int_equal (NE10_OK, ne10_normalize_vec3f_soa (&soa3[DST], &soa3[SRC1], count));
+        assert_true (check_soa_guard (DST, count));
+        check_soa_equal (DST, 3, count);
+
+        guard_soa (DST, count);
+        ne10_cross_vec3f_c (aos_ref, aos1, aos2, count);
+        assert_int_equal (NE10_OK, ne10_cross_vec3f_soa (&soa3[DST], &soa3[SRC1], &soa3[SRC2], count));
+        assert_true (check_soa_guard (DST, count));
+        check_soa_equal (DST, 3, count);
+
+        // In-place, writing over a source
+        ne10_cross_vec3f_soa (&soa3[SRC2], &soa3[SRC1], &soa3[SRC2], count);
+        check_soa_equal (SRC2, 3, count);
+        ne10_normalize_vec3f_c (aos_ref, aos_ref, count);
+        ne10_normalize_vec3f_soa (&soa3[SRC2], &soa3[SRC2], count);
+        check_soa_equal (SRC2, 3, count);
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+void test_soa_vec4f_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_vec4f_t *aos1 = (ne10_vec4f_t*) theaos1;
+    ne10_vec4f_t *aos2 = (ne10_vec4f_t*) theaos2;
+    ne10_vec4f_t *aos_ref = (ne10_vec4f_t*) theaos_ref;
+    ne10_uint32_t count;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    for (count = 0; count <= TEST_LENGTH_MAX; count++)
+    {
+        // Conversion in both directions gives back the original vectors
+        guard_soa (SRC1, count);
+        guard_soa (SRC2, count);
+        GUARD_ARRAY (theaos_out, count * 4);
+        assert_int_equal (NE10_OK, ne10_vec4f_aos_to_soa (&soa4[SRC1], aos1, count));
+        assert_int_equal (NE10_OK, ne10_vec4f_aos_to_soa (&soa4[SRC2], aos2, count));
+        assert_int_equal (NE10_OK, ne10_vec4f_soa_to_aos ( (ne10_vec4f_t*) theaos_out, &soa4[SRC1], count));
+        assert_true (check_soa_guard (SRC1, count));
+        assert_true (check_soa_guard (SRC2, count));
+        assert_true (CHECK_ARRAY_GUARD (theaos_out, count * 4));
+        memcpy (theaos_ref, theaos1, count * sizeof (ne10_vec4f_t));
+        check_soa_equal (SRC1, 4, count);
+        assert_float_vec_equal (theaos1, theaos_out, ERROR_MARGIN_SMALL, count * 4);
+
+        // Every operation against the AoS C version
+        GUARD_ARRAY (theout, count);
+        ne10_len_vec4f_c (theref, aos1, count);
+        assert_int_equal (NE10_OK, ne10_len_vec4f_soa (theout, &soa4[SRC1], count));
+        assert_true (CHECK_ARRAY_GUARD (theout, count));
+        assert_float_vec_equal (theref, theout, ERROR_MARGIN_SMALL, count);
+
+        GUARD_ARRAY (theout, count);
+        ne10_dot_vec4f_c (theref, aos1, aos2, count);
+        assert_int_equal (NE10_OK, ne10_dot_vec4f_soa (theout, &soa4[SRC1], &soa4[SRC2], count));
+        assert_true (CHECK_ARRAY_GUARD (theout, count));
+        assert_float_vec_equal (theref, theout, ERROR_MARGIN_SMALL, count);
+
+        guard_soa (DST, count);
+        ne10_normalize_vec4f_c (aos_ref, aos1, count);
+        assert_int_equal (NE10_OK, ne10_normalize_vec4f_soa (&soa4[DST], &soa4[SRC1], count));
+        assert_true (check_soa_guard (DST, count));
+        check_soa_equal (DST, 4, count);
+
+        // In-place
+        ne10_normalize_vec4f_soa (&soa4[SRC1], &soa4[SRC1], count);
+        check_soa_equal (SRC1, 4, count);
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+#if defined (PERFORMANCE_TEST)
+/*
+ * Each operation in AoS form (on the vec3f/vec4f arrays) and in SoA form (on
+ * the same vectors, converted once beforehand), through the function pointers.
+ */
+static void perf_len3_aos (ne10_uint32_t n)
+{
+    ne10_len_vec3f (theout, (ne10_vec3f_t*) theaos1, n);
+}
+static void perf_len3_soa (ne10_uint32_t n)
+{
+    ne10_len_vec3f_soa (theout, &soa3[SRC1], n);
+}
+static void perf_len4_aos (ne10_uint32_t n)
+{
+    ne10_len_vec4f (theout, (ne10_vec4f_t*) theaos1, n);
+}
+static void perf_len4_soa (ne10_uint32_t n)
+{
+    ne10_len_vec4f_soa (theout, &soa4[SRC1], n);
+}
+static void perf_normalize3_aos (ne10_uint32_t n)
+{
+    ne10_normalize_vec3f ( (ne10_vec3f_t*) theaos_out, (ne10_vec3f_t*) theaos1, n);
+}
+static void perf_normalize3_soa (ne10_uint32_t n)
+{
+    ne10_normalize_vec3f_soa (&soa3[DST], &soa3[SRC1], n);
+}
+static void perf_normalize4_aos (ne10_uint32_t n)
+{
+    ne10_normalize_vec4f ( (ne10_vec4f_t*) theaos_out, (ne10_vec4f_t*) theaos1, n);
+}
+static void perf_normalize4_soa (ne10_uint32_t n)
+{
+    ne10_normalize_vec4f_soa (&soa4[DST], &soa4[SRC1], n);
+}
+static void perf_dot3_aos (ne10_uint32_t n)
+{
+    ne10_dot_vec3f (theout, (ne10_vec3f_t*) theaos1, (ne10_vec3f_t*) theaos2, n);
+}
+static void perf_dot3_soa (ne10_uint32_t n)
+{
+    ne10_dot_vec3f_soa (theout, &soa3[SRC1], &soa3[SRC2], n);
+}
+static void perf_dot4_aos (ne10_uint32_t n)
+{
+    ne10_dot_vec4f (theout, (ne10_vec4f_t*) theaos1, (ne10_vec4f_t*) theaos2, n);
+}
+static void perf_dot4_soa (ne10_uint32_t n)
+{
+    ne10_dot_vec4f_soa (theout, &soa4[SRC1], &soa4[SRC2], n);
+}
+static void perf_cross3_aos (ne10_uint32_t n)
+{
+    ne10_cross_vec3f ( (ne10_vec3f_t*) theaos_out, (ne10_vec3f_t*) theaos1, (ne10_vec3f_t*) theaos2, n);
+}
+static void perf_cross3_soa (ne10_uint32_t n)
+{
+    ne10_cross_vec3f_soa (&soa3[DST], &soa3[SRC1], &soa3[SRC2], n);
+}
+
+typedef struct
+{
+    const char *name;
+    void (*aos) (ne10_uint32_t count);
+    void (*soa) (ne10_uint32_t count);
+} test_soa_op_t;
+#endif
+
+void test_soa_performance()
+{
+#ifdef PERFORMANCE_TEST
+    static const test_soa_op_t ops[] =
+    {
+        {"len_vec3f", perf_len3_aos, perf_len3_soa},
+        {"len_vec4f", perf_len4_aos, perf_len4_soa},
+        {"normalize_vec3f", perf_normalize3_aos, perf_normalize3_soa},
+        {"normalize_vec4f", perf_normalize4_aos, perf_normalize4_soa},
+        {"dot_vec3f", perf_dot3_aos, perf_dot3_soa},
+        {"dot_vec4f", perf_dot4_aos, perf_dot4_soa},
+        {"cross_vec3f", perf_cross3_aos, perf_cross3_soa},
+    };
+    ne10_int64_t time_aos = 0;
+    ne10_int64_t time_soa = 0;
+    ne10_int64_t time_convert = 0;
+    ne10_float32_t time_speedup = 0.0f;
+    ne10_float32_t time_savings = 0.0f;
+    ne10_uint32_t p, loop, k;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    ne10_vec3f_aos_to_soa (&soa3[SRC1], (ne10_vec3f_t*) theaos1, PERF_LENGTH_MAX);
+    ne10_vec3f_aos_to_soa (&soa3[SRC2], (ne10_vec3f_t*) theaos2, PERF_LENGTH_MAX);
+    for (p = 0; p < sizeof (ops) / sizeof (ops[0]); p++)
+    {
+        // the vec4f operations need the w components as well
+        if (p == 1)
+        {
+            ne10_vec4f_aos_to_soa (&soa4[SRC1], (ne10_vec4f_t*) theaos1, PERF_LENGTH_MAX);
+            ne10_vec4f_aos_to_soa (&soa4[SRC2], (ne10_vec4f_t*) theaos2, PERF_LENGTH_MAX);
+        }
+        fprintf (stdout, "%25s%20s%20s%20s%20s\n", ops[p].name, "AoS (micro-s)", "SoA (micro-s)", "Time Savings", "Performance Ratio");
+        for (loop = 0; loop < NUM_PERF_LENGTHS; loop++)
+        {
+            ne10_uint32_t count = PERF_LENGTHS[loop];
+            ne10_uint32_t repeats = PERF_VECTORS / count;
+
+            GET_TIME
+            (
+                time_aos,
+            {
+                for (k = 0; k < repeats; k++)
+                    ops[p].aos (count);
+            }
+            );
+            GET_TIME
+            (
+                time_soa,
+            {
+                for (k = 0; k < repeats; k++)
+                    ops[p].soa (count);
+            }
+            );
+
+            time_speedup = (ne10_float32_t) time_aos / time_soa;
+            time_savings = ( ( (ne10_float32_t) (time_aos - time_soa)) / time_aos) * 100;
+            ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", count, time_aos, time_soa, time_savings, time_speedup);
+        }
+    }
+
+    // The cost of converting one source, to weigh against the savings above
+    fprintf (stdout, "%25s%20s%20s\n", "aos_to_soa + soa_to_aos", "vec3f (micro-s)", "vec4f (micro-s)");
+    for (loop = 0; loop < NUM_PERF_LENGTHS; loop++)
+    {
+        ne10_uint32_t count = PERF_LENGTHS[loop];
+        ne10_uint32_t repeats = PERF_VECTORS / count;
+
+        GET_TIME
+        (
+            time_aos,
+        {
+            for (k = 0; k < repeats; k++)
+            {
+                ne10_vec3f_aos_to_soa (&soa3[DST], (ne10_vec3f_t*) theaos1, count);
+                ne10_vec3f_soa_to_aos ( (ne10_vec3f_t*) theaos_out, &soa3[DST], count);
+            }
+        }
+        );
+        GET_TIME
+        (
+            time_convert,
+        {
+            for (k = 0; k < repeats; k++)
+            {
+                ne10_vec4f_aos_to_soa (&soa4[DST], (ne10_vec4f_t*) theaos1, count);
+                ne10_vec4f_soa_to_aos ( (ne10_vec4f_t*) theaos_out, &soa4[DST], count);
+            }
+        }
+        );
+        fprintf (stdout, "%25d%20lld%20lld\n", count, time_aos, time_convert);
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_soa (void)
+{
+    ne10_uint32_t set, k;
+
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The tests go through the function pointers, as applications do
+    ne10_init();
+
+    NE10_SRC_ALLOC_LIMIT (theaos1, guarded_aos1, TEST_BUFFER_LEN * 4);
+    NE10_SRC_ALLOC_LIMIT (theaos2, guarded_aos2, TEST_BUFFER_LEN * 4);
+    NE10_DST_ALLOC (theaos_ref, guarded_aos_ref, TEST_BUFFER_LEN * 4);
+    NE10_DST_ALLOC (theaos_out, guarded_aos_out, TEST_BUFFER_LEN * 4);
+    NE10_DST_ALLOC (theref, guarded_ref, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (theout, guarded_out, TEST_BUFFER_LEN);
+    for (set = 0; set < 3; set++)
+    {
+        for (k = 0; k < 4; k++)
+            NE10_DST_ALLOC (thesoa[set][k], guarded_soa[set][k], TEST_BUFFER_LEN);
+        soa3[set].x = soa4[set].x = thesoa[set][0];
+        soa3[set].y = soa4[set].y = thesoa[set][1];
+        soa3[set].z = soa4[set].z = thesoa[set][2];
+        soa4[set].w = thesoa[set][3];
+    }
+
+    run_test (test_soa_vec3f_conformance);       // run tests
+    run_test (test_soa_vec4f_conformance);
+    run_test (test_soa_performance);
+
+    free (guarded_aos1);
+    free (guarded_aos2);
+    free (guarded_aos_ref);
+    free (guarded_aos_out);
+    free (guarded_ref);
+    free (guarded_out);
+    for (set = 0; set < 3; set++)
+    {
+        for (k = 0; k < 4; k++)
+            free (guarded_soa[set][k]);
+    }
+
+    test_fixture_end();                 // ends a fixture
+}
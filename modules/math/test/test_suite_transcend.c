@@ -0,0 +1,539 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*
+ * NE10 Library : test_suite_transcend.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#include "NE10_math.h"
+#include "NE10_init.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#if defined (REGRESSION_TEST)
+#define TEST_LENGTH_MAX 1031
+#define SWEEP_STEP 251
+#else
+#define TEST_LENGTH_MAX 67
+#define SWEEP_STEP 65521
+#endif
+
+#define PERF_LENGTH 4096
+#define PERF_ELEMENTS (4 * 1024 * 1024)
+
+#define TEST_BUFFER_LEN (TEST_LENGTH_MAX > PERF_LENGTH ? TEST_LENGTH_MAX : PERF_LENGTH)
+
+/*
+ * The largest errors in ulp documented in NE10_math.h, for the C versions
+ * and for the versions the function pointers are bound to.
+ */
+#define ULP_EXP 1.0
+#define ULP_LOG 1.0
+#define ULP_SIN 2.5
+#define ULP_COS 2.5
+#define ULP_ATAN2 2.5
+#define ULP_SQRT 0.5
+#define ULP_RSQRT 1.5
+#if defined(__arm__)
+#define ULP_ATAN2_SIMD 3.5
+#define ULP_SQRT_SIMD 3.0
+#else
+#define ULP_ATAN2_SIMD ULP_ATAN2
+#define ULP_SQRT_SIMD ULP_SQRT
+#endif
+#if defined (NE10_ENABLE_X86)
+#define ULP_RSQRT_SIMD 4.5
+#else
+#define ULP_RSQRT_SIMD 2.5
+#endif
+
+//input and output
+static ne10_float32_t * guarded_src1 = NULL;
+static ne10_float32_t * guarded_src2 = NULL;
+static ne10_float32_t * guarded_out = NULL;
+static ne10_float32_t * guarded_out2 = NULL;
+static ne10_float32_t * guarded_out_c = NULL;
+static ne10_float32_t * guarded_out2_c = NULL;
+static ne10_float32_t * thesrc1 = NULL;
+static ne10_float32_t * thesrc2 = NULL;
+static ne10_float32_t * theout = NULL;
+static ne10_float32_t * theout2 = NULL;
+static ne10_float32_t * theout_c = NULL;
+static ne10_float32_t * theout2_c = NULL;
+
+typedef enum
+{
+    TEST_EXP,
+    TEST_LOG,
+    TEST_SINCOS,
+    TEST_ATAN2,
+    TEST_SQRT,
+    TEST_RSQRT,
+    TEST_FUNCTIONS
+} test_function_t;
+
+static const char * const test_names[TEST_FUNCTIONS] =
+{
+    "exp_float", "log_float", "sincos_float", "atan2_float", "sqrt_float", "rsqrt_float"
+};
+
+/* uniform in [lo, hi] */
+static ne10_float32_t rand_range (ne10_float32_t lo, ne10_float32_t hi)
+{
+    return lo + (hi - lo) * ( (ne10_float32_t) NE10_rng_next() / NE10_rng_max());
+}
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+/* arguments every source gets mixed with, for the special cases and the fallback paths */
+static const ne10_float32_t special_args[] =
+{
+    0.0f, -0.0f, 1.0f, -1.0f, INFINITY, -INFINITY, NAN, FLT_MIN, 1.0e-40f, FLT_MAX, -FLT_MAX,
+    88.7228394f, -103.9f, 8192.0f, -8192.5f, 1.0e5f, 3.14159274f
+};
+
+#define SPECIAL_ARGS (sizeof (special_args) / sizeof (special_args[0]))
+
+static ne10_float32_t bits_to_float (ne10_uint32_t u)
+{
+    ne10_float32_t f;
+
+    memcpy (&f, &u, sizeof (f));
+    return f;
+}
+
+/* a float of any sign and magnitude, NaNs excepted */
+static ne10_float32_t rand_any (void)
+{
+    ne10_uint32_t u = ( (ne10_uint32_t) NE10_rng_next() << 16) ^ NE10_rng_next();
+    ne10_float32_t f = bits_to_float (u & 0xbfffffff);
+
+    /* halve the exponent range around 1 */
+    return (u & 0x40000000) ? f : 1.0f / (f + 1.0f);
+}
+
+static void fill_args (test_function_t fn, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        switch (fn)
+        {
+        case TEST_EXP:
+            thesrc1[i] = rand_range (-110.0f, 95.0f);
+            break;
+        case TEST_SINCOS:
+            thesrc1[i] = (i % 3) ? rand_range (-10.0f, 10.0f) : rand_range (-9000.0f, 9000.0f);
+            break;
+        case TEST_ATAN2:
+            thesrc1[i] = rand_any();
+            thesrc2[i] = (i % 5) ? rand_any() : thesrc1[i] * rand_range (-2.0f, 2.0f);
+            break;
+        default:
+            thesrc1[i] = fabsf (rand_any());
+            break;
+        }
+        if (i % 7 == 3)
+            thesrc1[i] = special_args[NE10_rng_next() % SPECIAL_ARGS];
+        if (i % 11 == 5)
+            thesrc2[i] = special_args[NE10_rng_next() % SPECIAL_ARGS];
+    }
+}
+
+/* the error of r in ulp of the reference; NaNs and infinities must match */
+static double ulp_error (ne10_float32_t r, double ref)
+{
+    double a = fabs (ref);
+    int e;
+
+    if (ref != ref || r != r)
+        return (ref != ref && r != r) ? 0.0 : HUGE_VAL;
+    if (isinf (r) || isinf (ref))
+        return r == (ne10_float32_t) ref ? 0.0 : HUGE_VAL;
+#if defined(__arm__)
+    /* ARMv7 NEON flushes denormals to zero */
+    if (a < FLT_MIN && fabsf (r) < FLT_MIN)
+        return 0.0;
+#endif
+    frexp (a < FLT_MIN ? FLT_MIN : a, &e);
+    return fabs (r - ref) / ldexp (1.0, e - 24);
+}
+
+static double ref_rsqrt (double x)
+{
+    return 1.0 / sqrt (x);
+}
+#endif
+
+typedef enum
+{
+    TEST_IMPL_C,
+    TEST_IMPL_DISPATCH,
+    TEST_IMPL_SSE,
+    TEST_IMPL_AVX2
+} test_impl_t;
+
+#if defined (NE10_ENABLE_X86)
+#define TEST_CALL_X86(name, args) \
+    case TEST_IMPL_SSE: \
+        return name##_sse args; \
+    case TEST_IMPL_AVX2: \
+        return name##_avx2 args;
+#else
+#define TEST_CALL_X86(name, args)
+#endif
+
+#define TEST_CALL(name, impl, args) \
+    switch (impl) \
+    { \
+    case TEST_IMPL_C: \
+        return name##_c args; \
+    TEST_CALL_X86 (name, args) \
+    default: \
+        return name args; \
+    }
+
+/* calls one implementation of a function on the first count arguments */
+static ne10_result_t run_function (test_function_t fn, test_impl_t impl, ne10_float32_t * out, ne10_float32_t * out2, ne10_uint32_t count)
+{
+    switch (fn)
+    {
+    case TEST_EXP:
+        TEST_CALL (ne10_exp_float, impl, (out, thesrc1, count));
+    case TEST_LOG:
+        TEST_CALL (ne10_log_float, impl, (out, thesrc1, count));
+    case TEST_SINCOS:
+        TEST_CALL (ne10_sincos_float, impl, (out, out2, thesrc1, count));
+    case TEST_ATAN2:
+        TEST_CALL (ne10_atan2_float, impl, (out, thesrc1, thesrc2, count));
+    case TEST_SQRT:
+        TEST_CALL (ne10_sqrt_float, impl, (out, thesrc1, count));
+    default:
+        TEST_CALL (ne10_rsqrt_float, impl, (out, thesrc1, count));
+    }
+}
+
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+/* the largest error of out (and out2 for sincos) over count results */
+static double max_error (test_function_t fn, const ne10_float32_t * out, const ne10_float32_t * out2, ne10_uint32_t count, double * max_cos)
+{
+    double max = 0.0, e;
+    ne10_uint32_t i;
+
+    *max_cos = 0.0;
+    for (i = 0; i < count; i++)
+    {
+        double x = thesrc1[i];
+
+        switch (fn)
+        {
+        case TEST_EXP:
+            e = ulp_error (out[i], exp (x));
+            break;
+        case TEST_LOG:
+            e = ulp_error (out[i], log (x));
+            break;
+        case TEST_SINCOS:
+            e = ulp_error (out[i], sin (x));
+            *max_cos = fmax (*max_cos, ulp_error (out2[i], cos (x)));
+            break;
+        case TEST_ATAN2:
+            e = ulp_error (out[i], atan2 (x, (double) thesrc2[i]));
+            break;
+        case TEST_SQRT:
+            e = ulp_error (out[i], sqrt (x));
+            break;
+        default:
+            e = ulp_error (out[i], ref_rsqrt (x));
+            break;
+        }
+        max = fmax (max, e);
+    }
+    return max;
+}
+
+static double bound (test_function_t fn, test_impl_t impl, double * bound_cos)
+{
+    static const double bounds[TEST_FUNCTIONS][2] =
+    {
+        {ULP_EXP, ULP_EXP},
+        {ULP_LOG, ULP_LOG},
+        {ULP_SIN, ULP_SIN},
+        {ULP_ATAN2, ULP_ATAN2_SIMD},
+        {ULP_SQRT, ULP_SQRT_SIMD},
+        {ULP_RSQRT, ULP_RSQRT_SIMD},
+    };
+
+    *bound_cos = ULP_COS;
+    return bounds[fn][impl == TEST_IMPL_C ? 0 : 1];
+}
+
+static void check_function (test_function_t fn, ne10_uint32_t count)
+{
+    ne10_int32_t impl;
+
+    for (impl = TEST_IMPL_C; impl <= TEST_IMPL_AVX2; impl++)
+    {
+        double b, b_cos, e, e_cos;
+
+#if defined (NE10_ENABLE_X86)
+        if ( (impl == TEST_IMPL_SSE && ne10_HasSSE41() != NE10_OK)
+                || (impl == TEST_IMPL_AVX2 && ne10_HasAVX2() != NE10_OK))
+            continue;
+#else
+        if (impl > TEST_IMPL_DISPATCH)
+            break;
+#endif
+        GUARD_ARRAY (theout, count);
+        GUARD_ARRAY (theout2, count);
+        assert_int_equal (NE10_OK, run_function (fn, (test_impl_t) impl, theout, theout2, count));
+        assert_true (CHECK_ARRAY_GUARD (theout, count));
+        assert_true (CHECK_ARRAY_GUARD (theout2, count));
+
+        b = bound (fn, (test_impl_t) impl, &b_cos);
+        e = max_error (fn, theout, theout2, count, &e_cos);
+        assert_true (e <= b && e_cos <= b_cos);
+    }
+}
+#endif
+
+void test_transcend_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_uint32_t count, fn;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    NE10_rng_init (NE10_rng_test_seed());
+    for (count = 0; count <= TEST_LENGTH_MAX; count++)
+    {
+        for (fn = 0; fn < TEST_FUNCTIONS; fn++)
+        {
+            fill_args ( (test_function_t) fn, count);
+            check_function ( (test_function_t) fn, count);
+        }
+
+        // In-place, writing over the source
+        fill_args (TEST_SINCOS, count);
+        ne10_sincos_float (theout_c, theout2_c, thesrc1, count);
+        memcpy (theout, thesrc1, count * sizeof (ne10_float32_t));
+        ne10_sincos_float (theout, theout2, theout, count);
+        assert_true (memcmp (theout_c, theout, count * sizeof (ne10_float32_t)) == 0);
+        assert_true (memcmp (theout2_c, theout2, count * sizeof (ne10_float32_t)) == 0);
+        fill_args (TEST_EXP, count);
+        ne10_exp_float (theout_c, thesrc1, count);
+        ne10_exp_float (thesrc1, thesrc1, count);
+        assert_true (memcmp (theout_c, thesrc1, count * sizeof (ne10_float32_t)) == 0);
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+/*
+ * Accuracy against the C library over every SWEEP_STEP-th float (every
+ * SWEEP_STEP-th y, against x from another stride, for atan2), through the
+ * function pointers.
+ */
+void test_transcend_accuracy()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_uint32_t fn;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    for (fn = 0; fn < TEST_FUNCTIONS; fn++)
+    {
+        double b, b_cos, max = 0.0, max_cos = 0.0, e, e_cos;
+        ne10_uint64_t u = 0;
+
+        while (u <= 0xffffffffULL)
+        {
+            ne10_uint32_t n = 0;
+
+            for (; n < PERF_LENGTH && u <= 0xffffffffULL; n++, u += SWEEP_STEP)
+            {
+                thesrc1[n] = bits_to_float ( (ne10_uint32_t) u);
+                thesrc2[n] = bits_to_float ( (ne10_uint32_t) (u * 2654435761ULL));
+            }
+            run_function ( (test_function_t) fn, TEST_IMPL_DISPATCH, theout, theout2, n);
+            e = max_error ( (test_function_t) fn, theout, theout2, n, &e_cos);
+            max = fmax (max, e);
+            max_cos = fmax (max_cos, e_cos);
+        }
+        b = bound ( (test_function_t) fn, TEST_IMPL_DISPATCH, &b_cos);
+        if (fn == TEST_SINCOS)
+            fprintf (stdout, "%25s: max error %.2f ulp (sin), %.2f ulp (cos)\n", test_names[fn], max, max_cos);
+        else
+            fprintf (stdout, "%25s: max error %.2f ulp\n", test_names[fn], max);
+        assert_true (max <= b && max_cos <= b_cos);
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+#if defined (PERFORMANCE_TEST)
+/* the C library, one element at a time */
+static void run_libm (test_function_t fn, ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    switch (fn)
+    {
+    case TEST_EXP:
+        for (i = 0; i < count; i++)
+            theout[i] = expf (thesrc1[i]);
+        break;
+    case TEST_LOG:
+        for (i = 0; i < count; i++)
+            theout[i] = logf (thesrc1[i]);
+        break;
+    case TEST_SINCOS:
+        for (i = 0; i < count; i++)
+        {
+            theout[i] = sinf (thesrc1[i]);
+            theout2[i] = cosf (thesrc1[i]);
+        }
+        break;
+    case TEST_ATAN2:
+        for (i = 0; i < count; i++)
+            theout[i] = atan2f (thesrc1[i], thesrc2[i]);
+        break;
+    case TEST_SQRT:
+        for (i = 0; i < count; i++)
+            theout[i] = sqrtf (thesrc1[i]);
+        break;
+    default:
+        for (i = 0; i < count; i++)
+            theout[i] = 1.0f / sqrtf (thesrc1[i]);
+        break;
+    }
+}
+#endif
+
+void test_transcend_performance()
+{
+#ifdef PERFORMANCE_TEST
+    ne10_int64_t time_ref = 0;
+    ne10_int64_t time_neon = 0;
+    ne10_float32_t time_speedup = 0.0f;
+    ne10_float32_t time_savings = 0.0f;
+    ne10_uint32_t repeats = PERF_ELEMENTS / PERF_LENGTH;
+    ne10_uint32_t fn, k, v;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+    NE10_rng_init (NE10_rng_test_seed());
+    for (fn = 0; fn < TEST_FUNCTIONS; fn++)
+    {
+        // arguments in the fast paths
+        for (k = 0; k < PERF_LENGTH; k++)
+        {
+            if (fn == TEST_EXP)
+                thesrc1[k] = rand_range (-80.0f, 80.0f);
+            else if (fn == TEST_SINCOS || fn == TEST_ATAN2)
+                thesrc1[k] = rand_range (-100.0f, 100.0f);
+            else
+                thesrc1[k] = rand_range (1.0e-3f, 1.0e3f);
+            thesrc2[k] = rand_range (-100.0f, 100.0f);
+        }
+        // against the C library, then against the C version
+        for (v = 0; v < 2; v++)
+        {
+            fprintf (stdout, "%25s%20s%20s%20s%20s\n", test_names[fn], v ? "C Time (micro-s)" : "libm Time (micro-s)",
+                     "NEON Time (micro-s)", "Time Savings", "Performance Ratio");
+            GET_TIME
+            (
+                time_ref,
+            {
+                for (k = 0; k < repeats; k++)
+                {
+                    if (v)
+                        run_function ( (test_function_t) fn, TEST_IMPL_C, theout, theout2, PERF_LENGTH);
+                    else
+                        run_libm ( (test_function_t) fn, PERF_LENGTH);
+                }
+            }
+            );
+            GET_TIME
+            (
+                time_neon,
+            {
+                for (k = 0; k < repeats; k++)
+                    run_function ( (test_function_t) fn, TEST_IMPL_DISPATCH, theout, theout2, PERF_LENGTH);
+            }
+            );
+
+            time_speedup = (ne10_float32_t) time_ref / time_neon;
+            time_savings = ( ( (ne10_float32_t) (time_ref - time_neon)) / time_ref) * 100;
+            ne10_log (__FUNCTION__, "%25d%20lld%20lld%19.2f%%%18.2f:1\n", PERF_LENGTH, time_ref, time_neon, time_savings, time_speedup);
+        }
+    }
+    fprintf (stdout, "----------%30s end\n", __FUNCTION__);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_transcend (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The tests go through the function pointers, as applications do
+    ne10_init();
+
+    // the sources are filled by each test, from the seeded generator
+    NE10_DST_ALLOC (thesrc1, guarded_src1, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (thesrc2, guarded_src2, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (theout, guarded_out, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (theout2, guarded_out2, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (theout_c, guarded_out_c, TEST_BUFFER_LEN);
+    NE10_DST_ALLOC (theout2_c, guarded_out2_c, TEST_BUFFER_LEN);
+
+    run_test (test_transcend_conformance);       // run tests
+    run_test (test_transcend_accuracy);
+    run_test (test_transcend_performance);
+
+    free (guarded_src1);
+    free (guarded_src2);
+    free (guarded_out);
+    free (guarded_out2);
+    free (guarded_out_c);
+    free (guarded_out2_c);
+
+    test_fixture_end();                 // ends a fixture
+}
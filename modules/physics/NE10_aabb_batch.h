@@ -0,0 +1,61 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : physics/NE10_aabb_batch.h
+ */
+
+#include "NE10_types.h"
+
+#ifndef NE10_AABB_BATCH_H
+#define NE10_AABB_BATCH_H
+
+///////////////////////////
+// Internal macro define
+///////////////////////////
+
+/* polygons per piece of a batch shared out between the pool threads */
+#define NE10_AABB_BATCH_GRAIN 512
+
+/* The boxes of shape_count polygons, on the calling thread */
+typedef void (*ne10_physics_aabb_batch_kernel_t) (ne10_mat2x2f_t *aabbs,
+        const ne10_vec2f_t *vertices,
+        const ne10_uint32_t *offsets,
+        const ne10_mat2x2f_t *xfs,
+        const ne10_vec2f_t *radii,
+        ne10_uint32_t shape_count);
+
+/* Runs kernel over the batch, in pieces on the pool threads if the batch is large */
+extern void ne10_physics_compute_aabb_batch_generic (ne10_mat2x2f_t *aabbs,
+        const ne10_vec2f_t *vertices,
+        const ne10_uint32_t *offsets,
+        const ne10_mat2x2f_t *xfs,
+        const ne10_vec2f_t *radii,
+        ne10_uint32_t shape_count,
+        ne10_physics_aabb_batch_kernel_t kernel);
+
+#endif // NE10_AABB_BATCH_H
@@ -0,0 +1,522 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : physics/NE10_broadphase.c
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_broadphase.h"
+
+/**
+ * @ingroup groupPhysics
+ */
+/**
+ * @defgroup BROAD_PHASE Broad Phase
+ *
+ * \par
+ * The broad phase of collision detection finds the pairs of bodies whose axis aligned
+ * bounding boxes overlap, so that only these are handed to the exact tests, rather than
+ * every pair of bodies.
+ * \par
+ * Two algorithms are available. Sort and sweep sorts the boxes by their lower x bound and
+ * tests each box against the following ones until their lower x bound passes its upper
+ * one; it needs no tuning, and from one frame to the next only re-sorts what moved. The
+ * uniform grid hashes each box into the cells it covers and tests the boxes sharing a cell;
+ * it suits many boxes of similar size spread over a large world.
+ */
+
+/* boxes covering more cells than this are tested against every box instead */
+#define NE10_BROADPHASE_GRID_MAX_CELLS 16
+/* bound of the grid cell coordinates, whatever the boxes */
+#define NE10_BROADPHASE_GRID_COORD_MAX 1073741824.0f
+/* the incremental sort gives up for a radix sort after this many moves per box */
+#define NE10_BROADPHASE_MAX_MOVES 8
+#define NE10_BROADPHASE_RADIX_BITS 11
+#define NE10_BROADPHASE_RADIX_SIZE (1 << NE10_BROADPHASE_RADIX_BITS)
+#define NE10_BROADPHASE_RADIX_PASSES 3
+
+/* maps a float to an unsigned integer of the same order */
+static inline ne10_uint32_t ne10_broadphase_key (ne10_float32_t v)
+{
+    union
+    {
+        ne10_float32_t f;
+        ne10_uint32_t u;
+    } bits;
+
+    bits.f = v;
+    return bits.u ^ ( (ne10_uint32_t) - (ne10_int32_t) (bits.u >> 31) | 0x80000000u);
+}
+
+/*
+ * Stable radix sort of bp->order by bp->keys, 11 bits at a time, skipping
+ * the passes in which all keys have the same digit.
+ */
+static void ne10_broadphase_radix_sort (ne10_physics_broadphase_t bp, ne10_uint32_t count)
+{
+    ne10_uint32_t hist[NE10_BROADPHASE_RADIX_PASSES][NE10_BROADPHASE_RADIX_SIZE];
+    ne10_uint32_t *tmp;
+    ne10_uint32_t i, pass, sum, digit;
+
+    memset (hist, 0, sizeof (hist));
+    for (i = 0; i < count; i++)
+    {
+        ne10_uint32_t key = bp->keys[i];
+        for (pass = 0; pass < NE10_BROADPHASE_RADIX_PASSES; pass++)
+        {
+            hist[pass][ (key >> (pass * NE10_BROADPHASE_RADIX_BITS)) & (NE10_BROADPHASE_RADIX_SIZE - 1)]++;
+        }
+    }
+
+    for (pass = 0; pass < NE10_BROADPHASE_RADIX_PASSES; pass++)
+    {
+        ne10_uint32_t shift = pass * NE10_BROADPHASE_RADIX_BITS;
+        ne10_uint32_t *h = hist[pass];
+
+        if (h[ (bp->keys[0] >> shift) & (NE10_BROADPHASE_RADIX_SIZE - 1)] == count)
+        {
+            continue;
+        }
+        for (digit = 0, sum = 0; digit < NE10_BROADPHASE_RADIX_SIZE; digit++)
+        {
+            ne10_uint32_t n = h[digit];
+            h[digit] = sum;
+            sum += n;
+        }
+        for (i = 0; i < count; i++)
+        {
+            ne10_uint32_t key = bp->keys[i];
+            ne10_uint32_t pos = h[ (key >> shift) & (NE10_BROADPHASE_RADIX_SIZE - 1)]++;
+            bp->keys_tmp[pos] = key;
+            bp->order_tmp[pos] = bp->order[i];
+        }
+        tmp = bp->keys;
+        bp->keys = bp->keys_tmp;
+        bp->keys_tmp = tmp;
+        tmp = bp->order;
+        bp->order = bp->order_tmp;
+        bp->order_tmp = tmp;
+    }
+}
+
+/*
+ * Insertion sort of bp->order by bp->keys, which is linear when the order is
+ * nearly right. Returns 0 if it gave up after max_moves moves, leaving the
+ * order a permutation of the boxes still.
+ */
+static ne10_int32_t ne10_broadphase_insertion_sort (ne10_physics_broadphase_t bp,
+        ne10_uint32_t count,
+        ne10_uint32_t max_moves)
+{
+    ne10_uint32_t *keys = bp->keys;
+    ne10_uint32_t *order = bp->order;
+    ne10_uint32_t i, j, moves = 0;
+
+    for (i = 1; i < count; i++)
+    {
+        ne10_uint32_t key = keys[i];
+        ne10_uint32_t body = order[i];
+
+        for (j = i; j > 0 && keys[j - 1] > key; j--)
+        {
+            keys[j] = keys[j - 1];
+            order[j] = order[j - 1];
+        }
+        keys[j] = key;
+        order[j] = body;
+        moves += i - j;
+        if (moves > max_moves)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* sorts the boxes by lower x, and gathers their bounds in that order */
+static void ne10_broadphase_sort (ne10_physics_broadphase_t bp,
+                                  const ne10_mat2x2f_t *aabbs,
+                                  ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    if (count == bp->count)
+    {
+        for (i = 0; i < count; i++)
+        {
+            bp->keys[i] = ne10_broadphase_key (aabbs[bp->order[i]].c1.r1);
+        }
+        if (!ne10_broadphase_insertion_sort (bp, count, count * NE10_BROADPHASE_MAX_MOVES))
+        {
+            ne10_broadphase_radix_sort (bp, count);
+        }
+    }
+    else
+    {
+        for (i = 0; i < count; i++)
+        {
+            bp->order[i] = i;
+            bp->keys[i] = ne10_broadphase_key (aabbs[i].c1.r1);
+        }
+        ne10_broadphase_radix_sort (bp, count);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        const ne10_mat2x2f_t *box = &aabbs[bp->order[i]];
+        bp->min_x[i] = box->c1.r1;
+        bp->min_y[i] = box->c1.r2;
+        bp->max_x[i] = box->c2.r1;
+        bp->max_y[i] = box->c2.r2;
+    }
+    for (i = count; i < count + NE10_BROADPHASE_PADDING; i++)
+    {
+        bp->min_x[i] = NAN;
+        bp->min_y[i] = NAN;
+        bp->max_x[i] = NAN;
+        bp->max_y[i] = NAN;
+    }
+}
+
+static inline ne10_int32_t ne10_broadphase_cell (ne10_float32_t v, ne10_float32_t inv_cell)
+{
+    v *= inv_cell;
+    v = NE10_MAX (v, -NE10_BROADPHASE_GRID_COORD_MAX);
+    v = NE10_MIN (v, NE10_BROADPHASE_GRID_COORD_MAX);
+    return (ne10_int32_t) floorf (v);
+}
+
+static inline ne10_uint32_t ne10_broadphase_hash (ne10_int32_t x, ne10_int32_t y, ne10_uint32_t buckets)
+{
+    return ( ( (ne10_uint32_t) x * 73856093u) ^ ( (ne10_uint32_t) y * 19349663u)) & (buckets - 1);
+}
+
+static inline ne10_int32_t ne10_broadphase_overlap (const ne10_mat2x2f_t *p, const ne10_mat2x2f_t *q)
+{
+    return p->c1.r1 <= q->c2.r1 && q->c1.r1 <= p->c2.r1
+           && p->c1.r2 <= q->c2.r2 && q->c1.r2 <= p->c2.r2;
+}
+
+/*
+ * Uniform grid. Each box is listed in every cell it covers, and the lists are
+ * grouped by hash bucket with a counting sort. Two boxes sharing a cell are
+ * reported only from the cell holding the lower corner of their overlap, which
+ * both of them cover, so that each pair is found once. The boxes covering too
+ * many cells are listed in order_tmp, marked in keys, and tested against all.
+ */
+static ne10_uint32_t ne10_broadphase_grid (ne10_physics_broadphase_t bp,
+        ne10_physics_pair_t *pairs,
+        ne10_uint32_t max_pairs,
+        const ne10_mat2x2f_t *aabbs,
+        ne10_uint32_t count)
+{
+    ne10_float32_t inv_cell = 1.0f / bp->cell_size;
+    ne10_uint32_t *start = bp->bucket_start;
+    ne10_uint32_t *large = bp->order_tmp;
+    ne10_uint32_t large_count = 0;
+    ne10_uint32_t total, i, b, n = 0;
+    ne10_int32_t x, y;
+
+    memset (start, 0, (bp->buckets + 1) * sizeof (ne10_uint32_t));
+    for (i = 0; i < count; i++)
+    {
+        ne10_int32_t x0 = ne10_broadphase_cell (aabbs[i].c1.r1, inv_cell);
+        ne10_int32_t y0 = ne10_broadphase_cell (aabbs[i].c1.r2, inv_cell);
+        ne10_int32_t x1 = ne10_broadphase_cell (aabbs[i].c2.r1, inv_cell);
+        ne10_int32_t y1 = ne10_broadphase_cell (aabbs[i].c2.r2, inv_cell);
+
+        bp->keys[i] = ( (ne10_int64_t) x1 - x0 + 1) * ( (ne10_int64_t) y1 - y0 + 1) > NE10_BROADPHASE_GRID_MAX_CELLS;
+        if (bp->keys[i])
+        {
+            large[large_count++] = i;
+            continue;
+        }
+        for (y = y0; y <= y1; y++)
+        {
+            for (x = x0; x <= x1; x++)
+            {
+                start[ne10_broadphase_hash (x, y, bp->buckets)]++;
+            }
+        }
+    }
+
+    /* the end of each bucket, which the entries are then put before */
+    for (b = 0, total = 0; b < bp->buckets; b++)
+    {
+        total += start[b];
+        start[b] = total;
+    }
+    start[bp->buckets] = total;
+    if (total > bp->entry_capacity)
+    {
+        ne10_uint32_t capacity = total + total / 2;
+
+        NE10_FREE (bp->entries);
+        bp->entries = (ne10_physics_grid_entry_t *) NE10_MALLOC (capacity * sizeof (ne10_physics_grid_entry_t));
+        bp->entry_capacity = (bp->entries != NULL) ? capacity : 0;
+        if (bp->entries == NULL)
+        {
+            return 0;
+        }
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_int32_t x0, y0, x1, y1;
+
+        if (bp->keys[i])
+        {
+            continue;
+        }
+        x0 = ne10_broadphase_cell (aabbs[i].c1.r1, inv_cell);
+        y0 = ne10_broadphase_cell (aabbs[i].c1.r2, inv_cell);
+        x1 = ne10_broadphase_cell (aabbs[i].c2.r1, inv_cell);
+        y1 = ne10_broadphase_cell (aabbs[i].c2.r2, inv_cell);
+        for (y = y0; y <= y1; y++)
+        {
+            for (x = x0; x <= x1; x++)
+            {
+                ne10_physics_grid_entry_t *e = &bp->entries[--start[ne10_broadphase_hash (x, y, bp->buckets)]];
+                e->body = i;
+                e->x = x;
+                e->y = y;
+            }
+        }
+    }
+
+    for (b = 0; b < bp->buckets; b++)
+    {
+        ne10_physics_grid_entry_t *first = &bp->entries[start[b]];
+        ne10_physics_grid_entry_t *last = &bp->entries[start[b + 1]];
+        ne10_physics_grid_entry_t *p, *q;
+
+        for (p = first; p < last; p++)
+        {
+            const ne10_mat2x2f_t *box_p = &aabbs[p->body];
+
+            for (q = p + 1; q < last; q++)
+            {
+                const ne10_mat2x2f_t *box_q = &aabbs[q->body];
+
+                if (p->x != q->x || p->y != q->y || !ne10_broadphase_overlap (box_p, box_q))
+                {
+                    continue;
+                }
+                if (ne10_broadphase_cell (NE10_MAX (box_p->c1.r1, box_q->c1.r1), inv_cell) != p->x
+                        || ne10_broadphase_cell (NE10_MAX (box_p->c1.r2, box_q->c1.r2), inv_cell) != p->y)
+                {
+                    continue;
+                }
+                NE10_BROADPHASE_EMIT (pairs, max_pairs, n, p->body, q->body);
+            }
+        }
+    }
+
+    for (b = 0; b < large_count; b++)
+    {
+        ne10_uint32_t body = large[b];
+
+        for (i = 0; i < count; i++)
+        {
+            if (i == body || (bp->keys[i] && i < body))
+            {
+                continue;
+            }
+            if (ne10_broadphase_overlap (&aabbs[body], &aabbs[i]))
+            {
+                NE10_BROADPHASE_EMIT (pairs, max_pairs, n, body, i);
+            }
+        }
+    }
+    return n;
+}
+
+ne10_uint32_t ne10_physics_broadphase_generic (ne10_physics_broadphase_t bp,
+        ne10_physics_pair_t *pairs,
+        ne10_uint32_t max_pairs,
+        const ne10_mat2x2f_t *aabbs,
+        ne10_uint32_t count,
+        ne10_physics_broadphase_sweep_t sweep)
+{
+    ne10_uint32_t n;
+
+    if (count > bp->capacity)
+    {
+        return 0;
+    }
+    if (count < 2)
+    {
+        bp->count = 0;
+        return 0;
+    }
+
+    if (bp->mode == NE10_PHYSICS_BROADPHASE_GRID)
+    {
+        n = ne10_broadphase_grid (bp, pairs, max_pairs, aabbs, count);
+    }
+    else
+    {
+        ne10_broadphase_sort (bp, aabbs, count);
+        n = sweep (bp, count, pairs, max_pairs);
+    }
+    bp->count = count;
+    return n;
+}
+
+/**
+ * @ingroup BROAD_PHASE
+ * @brief Creates a broad phase (see @ref ne10_physics_broadphase_create in NE10_physics.h).
+ */
+ne10_physics_broadphase_t ne10_physics_broadphase_create (ne10_uint32_t capacity,
+        ne10_physics_broadphase_mode_t mode,
+        ne10_float32_t cell_size)
+{
+    ne10_physics_broadphase_t bp = NULL;
+    ne10_uint32_t buckets = 0;
+    ne10_uint32_t ints, floats;
+    uintptr_t address;
+
+    if (capacity == 0 || capacity > (1u << 26))
+    {
+        return NULL;
+    }
+    if (mode == NE10_PHYSICS_BROADPHASE_GRID)
+    {
+        if (! (cell_size > 0.0f) || isinf (cell_size))
+        {
+            return NULL;
+        }
+        buckets = 16;
+        while (buckets < 2 * capacity)
+        {
+            buckets <<= 1;
+        }
+    }
+    else if (mode != NE10_PHYSICS_BROADPHASE_SAP)
+    {
+        return NULL;
+    }
+
+    /* every array is a whole number of 16 bytes */
+    ints = (capacity + 3) & ~3u;
+    floats = (capacity + NE10_BROADPHASE_PADDING + 3) & ~3u;
+    bp = (ne10_physics_broadphase_t) NE10_MALLOC (sizeof (ne10_physics_broadphase_state_t) + 16
+            + sizeof (ne10_uint32_t) * ints * 4
+            + sizeof (ne10_float32_t) * floats * 4
+            + sizeof (ne10_uint32_t) * (buckets + 4));
+    if (bp == NULL)
+    {
+        return NULL;
+    }
+
+    address = (uintptr_t) bp + sizeof (ne10_physics_broadphase_state_t);
+    NE10_BYTE_ALIGNMENT (address, 16);
+    bp->min_x = (ne10_float32_t *) address;
+    bp->max_x = bp->min_x + floats;
+    bp->min_y = bp->max_x + floats;
+    bp->max_y = bp->min_y + floats;
+    bp->order = (ne10_uint32_t *) (bp->max_y + floats);
+    bp->order_tmp = bp->order + ints;
+    bp->keys = bp->order_tmp + ints;
+    bp->keys_tmp = bp->keys + ints;
+    bp->bucket_start = (buckets != 0) ? bp->keys_tmp + ints : NULL;
+
+    bp->mode = mode;
+    bp->capacity = capacity;
+    bp->count = 0;
+    bp->cell_size = cell_size;
+    bp->buckets = buckets;
+    bp->entry_capacity = 0;
+    bp->entries = NULL;
+    if (mode == NE10_PHYSICS_BROADPHASE_GRID)
+    {
+        /* room for every box covering up to 4 cells */
+        bp->entries = (ne10_physics_grid_entry_t *) NE10_MALLOC (4 * capacity * sizeof (ne10_physics_grid_entry_t));
+        bp->entry_capacity = (bp->entries != NULL) ? 4 * capacity : 0;
+    }
+    return bp;
+}
+
+/**
+ * @ingroup BROAD_PHASE
+ * @brief Destroys a broad phase created by @ref ne10_physics_broadphase_create.
+ */
+void ne10_physics_broadphase_destroy (ne10_physics_broadphase_t bp)
+{
+    if (bp == NULL)
+    {
+        return;
+    }
+    NE10_FREE (bp->entries);
+    NE10_FREE (bp);
+}
+
+/* the sweep of the boxes sorted by lower x */
+static ne10_uint32_t ne10_broadphase_sweep_c (const ne10_physics_broadphase_state_t *bp,
+        ne10_uint32_t count,
+        ne10_physics_pair_t *pairs,
+        ne10_uint32_t max_pairs)
+{
+    const ne10_float32_t *min_x = bp->min_x;
+    const ne10_float32_t *min_y = bp->min_y;
+    const ne10_float32_t *max_y = bp->max_y;
+    ne10_uint32_t i, j, n = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t hx = bp->max_x[i];
+        ne10_float32_t ly = min_y[i];
+        ne10_float32_t hy = max_y[i];
+
+        /* the NaN bounds after the last box end the loop */
+        for (j = i + 1; min_x[j] <= hx; j++)
+        {
+            if (min_y[j] <= hy && max_y[j] >= ly)
+            {
+                NE10_BROADPHASE_EMIT (pairs, max_pairs, n, bp->order[i], bp->order[j]);
+            }
+        }
+    }
+    return n;
+}
+
+/**
+ * @ingroup BROAD_PHASE
+ * Specific implementation of @ref ne10_physics_broadphase_find_pairs using plain C.
+ */
+ne10_uint32_t ne10_physics_broadphase_find_pairs_c (ne10_physics_broadphase_t bp,
+        ne10_physics_pair_t *pairs,
+        ne10_uint32_t max_pairs,
+        const ne10_mat2x2f_t *aabbs,
+        ne10_uint32_t count)
+{
+    return ne10_physics_broadphase_generic (bp, pairs, max_pairs, aabbs, count, ne10_broadphase_sweep_c);
+}
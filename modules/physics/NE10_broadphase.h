@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : physics/NE10_broadphase.h
+ */
+
+#include "NE10_types.h"
+#include "NE10_macros.h"
+
+#ifndef NE10_BROADPHASE_H
+#define NE10_BROADPHASE_H
+
+///////////////////////////
+// Internal macro define
+///////////////////////////
+
+/* entries past the last box of the sorted bounds, whose NaN bounds stop a sweep of 4 boxes at a time */
+#define NE10_BROADPHASE_PADDING 4
+
+/* adds a pair, whether or not it fits */
+#define NE10_BROADPHASE_EMIT(pairs, max_pairs, n, i, j) \
+    do { \
+        if ((n) < (max_pairs)) \
+        { \
+            (pairs)[(n)].a = ((i) < (j)) ? (i) : (j); \
+            (pairs)[(n)].b = ((i) < (j)) ? (j) : (i); \
+        } \
+        (n)++; \
+    } while (0)
+
+/*
+ * Sweep: the overlapping pairs of the count boxes whose bounds bp->min_x,
+ * max_x, min_y and max_y are sorted by min_x. Returns their number, of which
+ * the first max_pairs are written.
+ */
+typedef ne10_uint32_t (*ne10_physics_broadphase_sweep_t) (const ne10_physics_broadphase_state_t *bp,
+        ne10_uint32_t count,
+        ne10_physics_pair_t *pairs,
+        ne10_uint32_t max_pairs);
+
+extern ne10_uint32_t ne10_physics_broadphase_generic (ne10_physics_broadphase_t bp,
+        ne10_physics_pair_t *pairs,
+        ne10_uint32_t max_pairs,
+        const ne10_mat2x2f_t *aabbs,
+        ne10_uint32_t count,
+        ne10_physics_broadphase_sweep_t sweep);
+
+#endif // NE10_BROADPHASE_H
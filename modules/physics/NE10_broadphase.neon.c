@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : physics/NE10_broadphase.neon.c
+ */
+
+#include <arm_neon.h>
+
+#include "NE10_physics.h"
+#include "NE10_broadphase.h"
+
+/* one bit per lane of a comparison */
+static inline ne10_uint32_t ne10_broadphase_lanes (uint32x4_t mask)
+{
+    static const ne10_uint32_t bits[4] = { 1, 2, 4, 8 };
+    uint32x4_t m = vandq_u32 (mask, vld1q_u32 (bits));
+#if defined (__aarch64__)
+    return vaddvq_u32 (m);
+#else
+    uint32x2_t s = vadd_u32 (vget_low_u32 (m), vget_high_u32 (m));
+    return vget_lane_u32 (vpadd_u32 (s, s), 0);
+#endif
+}
+
+/*
+ * The sweep, testing each box against the following ones 4 at a time. As the
+ * boxes are sorted by lower x, the lanes that pass the x test come first, and
+ * the sweep of a box ends with the first group whose last lane does not; the
+ * NaN bounds after the last box fail every test.
+ */
+static ne10_uint32_t ne10_broadphase_sweep_neon (const ne10_physics_broadphase_state_t *bp,
+        ne10_uint32_t count,
+        ne10_physics_pair_t *pairs,
+        ne10_uint32_t max_pairs)
+{
+    const ne10_float32_t *min_x = bp->min_x;
+    const ne10_float32_t *min_y = bp->min_y;
+    const ne10_float32_t *max_y = bp->max_y;
+    ne10_uint32_t i, j, n = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        float32x4_t hx = vdupq_n_f32 (bp->max_x[i]);
+        float32x4_t ly = vdupq_n_f32 (min_y[i]);
+        float32x4_t hy = vdupq_n_f32 (max_y[i]);
+        uint32x4_t in_x;
+
+        j = i + 1;
+        do
+        {
+            uint32x4_t hit;
+            ne10_uint32_t lanes;
+
+            in_x = vcleq_f32 (vld1q_f32 (min_x + j), hx);
+            hit = vandq_u32 (vcleq_f32 (vld1q_f32 (min_y + j), hy), vcgeq_f32 (vld1q_f32 (max_y + j), ly));
+            lanes = ne10_broadphase_lanes (vandq_u32 (in_x, hit));
+            while (lanes != 0)
+            {
+                ne10_uint32_t k = __builtin_ctz (lanes);
+                NE10_BROADPHASE_EMIT (pairs, max_pairs, n, bp->order[i], bp->order[j + k]);
+                lanes &= lanes - 1;
+            }
+            j += 4;
+        }
+        while (vgetq_lane_u32 (in_x, 3) != 0);
+    }
+    return n;
+}
+
+/**
+ * @ingroup BROAD_PHASE
+ * Specific implementation of @ref ne10_physics_broadphase_find_pairs using NEON SIMD capabilities.
+ */
+ne10_uint32_t ne10_physics_broadphase_find_pairs_neon (ne10_physics_broadphase_t bp,
+        ne10_physics_pair_t *pairs,
+        ne10_uint32_t max_pairs,
+        const ne10_mat2x2f_t *aabbs,
+        ne10_uint32_t count)
+{
+    return ne10_physics_broadphase_generic (bp, pairs, max_pairs, aabbs, count, ne10_broadphase_sweep_neon);
+}
@@ -32,6 +32,7 @@
 #include <stdio.h>
 
 #include "NE10_physics.h"
+#include "NE10_trace.h"
 
 ne10_result_t ne10_init_physics (ne10_int32_t is_NEON_available)
 {
@@ -54,13 +55,29 @@ ne10_result_t ne10_init_physics (ne10_int32_t is_NEON_available)
 #else
         ne10_physics_apply_impulse_vec2f = ne10_physics_apply_impulse_vec2f_c;
 #endif // ENABLE_NE10_PHYSICS_RELATIVE_V_VEC2F_NEON
+
+#if !defined (NE10_ENABLE_X86)
+        ne10_physics_compute_aabb_batch_vec2f = ne10_physics_compute_aabb_batch_vec2f_neon;
+        ne10_physics_broadphase_find_pairs = ne10_physics_broadphase_find_pairs_neon;
+        ne10_physics_solve_contacts_vec2f = ne10_physics_solve_contacts_vec2f_neon;
+#else
+        ne10_physics_compute_aabb_batch_vec2f = ne10_physics_compute_aabb_batch_vec2f_c;
+        ne10_physics_broadphase_find_pairs = ne10_physics_broadphase_find_pairs_c;
+        ne10_physics_solve_contacts_vec2f = ne10_physics_solve_contacts_vec2f_c;
+#endif // NE10_ENABLE_X86
     }
     else
     {
         ne10_physics_compute_aabb_vec2f = ne10_physics_compute_aabb_vec2f_c;
+        ne10_physics_compute_aabb_batch_vec2f = ne10_physics_compute_aabb_batch_vec2f_c;
         ne10_physics_relative_v_vec2f = ne10_physics_relative_v_vec2f_c;
         ne10_physics_apply_impulse_vec2f = ne10_physics_apply_impulse_vec2f_c;
+        ne10_physics_broadphase_find_pairs = ne10_physics_broadphase_find_pairs_c;
+        ne10_physics_solve_contacts_vec2f = ne10_physics_solve_contacts_vec2f_c;
     }
+#if defined (NE10_ENABLE_TRACE)
+    ne10_trace_wrap_physics ();
+#endif
     return NE10_OK;
 }
 
@@ -70,6 +87,12 @@ void (*ne10_physics_compute_aabb_vec2f) (ne10_mat2x2f_t *aabb,
         ne10_mat2x2f_t *xf,
         ne10_vec2f_t *radius,
         ne10_uint32_t vertex_count);
+void (*ne10_physics_compute_aabb_batch_vec2f) (ne10_mat2x2f_t *aabbs,
+        const ne10_vec2f_t *vertices,
+        const ne10_uint32_t *offsets,
+        const ne10_mat2x2f_t *xfs,
+        const ne10_vec2f_t *radii,
+        ne10_uint32_t shape_count);
 void (*ne10_physics_relative_v_vec2f) (ne10_vec2f_t *dv,
                                        ne10_vec3f_t *v_wa,
                                        ne10_vec2f_t *ra,
@@ -84,3 +107,15 @@ void (*ne10_physics_apply_impulse_vec2f) (ne10_vec3f_t *v_wa,
         ne10_vec2f_t *imb,
         ne10_vec2f_t *p,
         ne10_uint32_t count);
+ne10_uint32_t (*ne10_physics_broadphase_find_pairs) (ne10_physics_broadphase_t bp,
+        ne10_physics_pair_t *pairs,
+        ne10_uint32_t max_pairs,
+        const ne10_mat2x2f_t *aabbs,
+        ne10_uint32_t count);
+ne10_result_t (*ne10_physics_solve_contacts_vec2f) (ne10_physics_solver_t solver,
+        ne10_vec3f_t *v_w,
+        const ne10_vec2f_t *inv_mass,
+        ne10_uint32_t body_count,
+        ne10_physics_contacts_t *contacts,
+        ne10_uint32_t contact_count,
+        ne10_uint32_t iterations);
@@ -30,6 +30,8 @@
  */
 
 #include "NE10_types.h"
+#include "NE10_threadpool.h"
+#include "NE10_aabb_batch.h"
 
 /**
  * @ingroup groupPhysics
@@ -105,6 +107,93 @@ void ne10_physics_compute_aabb_vec2f_c (ne10_mat2x2f_t *aabb,
 
 }
 
+typedef struct
+{
+    ne10_mat2x2f_t *aabbs;
+    const ne10_vec2f_t *vertices;
+    const ne10_uint32_t *offsets;
+    const ne10_mat2x2f_t *xfs;
+    const ne10_vec2f_t *radii;
+    ne10_physics_aabb_batch_kernel_t kernel;
+} ne10_physics_aabb_batch_t;
+
+static void ne10_physics_aabb_batch_range (ne10_uint32_t begin, ne10_uint32_t end, ne10_uint32_t slot, void *arg)
+{
+    ne10_physics_aabb_batch_t *batch = (ne10_physics_aabb_batch_t *) arg;
+
+    (void) slot;
+    batch->kernel (batch->aabbs + begin, batch->vertices, batch->offsets + begin,
+                   batch->xfs + begin, batch->radii + begin, end - begin);
+}
+
+void ne10_physics_compute_aabb_batch_generic (ne10_mat2x2f_t *aabbs,
+        const ne10_vec2f_t *vertices,
+        const ne10_uint32_t *offsets,
+        const ne10_mat2x2f_t *xfs,
+        const ne10_vec2f_t *radii,
+        ne10_uint32_t shape_count,
+        ne10_physics_aabb_batch_kernel_t kernel)
+{
+    ne10_physics_aabb_batch_t batch;
+
+    if (shape_count < 2 * NE10_AABB_BATCH_GRAIN || ne10_threadpool_size () < 2)
+    {
+        kernel (aabbs, vertices, offsets, xfs, radii, shape_count);
+        return;
+    }
+    batch.aabbs = aabbs;
+    batch.vertices = vertices;
+    batch.offsets = offsets;
+    batch.xfs = xfs;
+    batch.radii = radii;
+    batch.kernel = kernel;
+    ne10_parallel_for (0, shape_count, NE10_AABB_BATCH_GRAIN, ne10_physics_aabb_batch_range, &batch);
+}
+
+static void ne10_physics_compute_aabb_batch_kernel_c (ne10_mat2x2f_t *aabbs,
+        const ne10_vec2f_t *vertices,
+        const ne10_uint32_t *offsets,
+        const ne10_mat2x2f_t *xfs,
+        const ne10_vec2f_t *radii,
+        ne10_uint32_t shape_count)
+{
+    ne10_uint32_t i, j;
+
+    for (i = 0; i < shape_count; i++)
+    {
+        ne10_vec2f_t lower = ne10_mul_matvec_float (xfs[i], vertices[offsets[i]]);
+        ne10_vec2f_t upper = lower;
+        ne10_vec2f_t v;
+
+        for (j = offsets[i] + 1; j < offsets[i + 1]; j++)
+        {
+            v = ne10_mul_matvec_float (xfs[i], vertices[j]);
+            lower = min_2f (lower, v);
+            upper = max_2f (upper, v);
+        }
+
+        aabbs[i].c1.r1 = lower.x - radii[i].x;
+        aabbs[i].c1.r2 = lower.y - radii[i].y;
+        aabbs[i].c2.r1 = upper.x + radii[i].x;
+        aabbs[i].c2.r2 = upper.y + radii[i].y;
+    }
+}
+
+/**
+ * @ingroup COLLISION_DETECT
+ * Specific implementation of @ref ne10_physics_compute_aabb_batch_vec2f using plain C.
+ */
+void ne10_physics_compute_aabb_batch_vec2f_c (ne10_mat2x2f_t *aabbs,
+        const ne10_vec2f_t *vertices,
+        const ne10_uint32_t *offsets,
+        const ne10_mat2x2f_t *xfs,
+        const ne10_vec2f_t *radii,
+        ne10_uint32_t shape_count)
+{
+    ne10_physics_compute_aabb_batch_generic (aabbs, vertices, offsets, xfs, radii, shape_count,
+            ne10_physics_compute_aabb_batch_kernel_c);
+}
+
 /**
  * @ingroup COLLISION_DETECT
  * Specific implementation of @ref ne10_physics_relative_v_vec2f using plain C.
@@ -29,9 +29,15 @@
  * NE10 Library : physics/NE10_physics.c
  */
 
+#include <arm_neon.h>
+
 #include "NE10_types.h"
+#include "NE10_macros.h"
+#include "NE10_physics.h"
+#include "NE10_aabb_batch.h"
 
-#ifdef ENABLE_NE10_PHYSICS_COMPUTE_AABB_VEC2F_NEON
+/* On AArch64, the intrinsic version in NE10_physics.neonintrinsic.c is used instead. */
+#if defined (ENABLE_NE10_PHYSICS_COMPUTE_AABB_VEC2F_NEON) && !defined (__aarch64__)
 extern void ne10_physics_compute_aabb_vertex4_vec2f_neon (ne10_mat2x2f_t *aabb,
         ne10_vec2f_t *vertices,
         ne10_mat2x2f_t *xf,
@@ -75,10 +81,10 @@ static inline ne10_vec2f_t max_2f (ne10_vec2f_t a, ne10_vec2f_t b)
 /**
  * @ingroup COLLISION_DETECT
  * Specific implementation of @ref ne10_physics_compute_aabb_vec2f using NEON SIMD capabilities.
- * To improve performance, four vertices are processed per loop iteration. As such, vertex_count
- * must be a multiple of four.
+ * The armv7 assembly kernel processes four vertices per loop iteration and so requires a
+ * multiple of four; the remaining vertices are handled here in C.
  */
-#ifdef ENABLE_NE10_PHYSICS_COMPUTE_AABB_VEC2F_NEON
+#if defined (ENABLE_NE10_PHYSICS_COMPUTE_AABB_VEC2F_NEON) && !defined (__aarch64__)
 void ne10_physics_compute_aabb_vec2f_neon (ne10_mat2x2f_t *aabb,
         ne10_vec2f_t *vertices,
         ne10_mat2x2f_t *xf,
@@ -133,3 +139,101 @@ void ne10_physics_compute_aabb_vec2f_neon (ne10_mat2x2f_t *aabb,
     }
 }
 #endif // ENABLE_NE10_PHYSICS_COMPUTE_AABB_VEC2F_NEON
+
+/*
+ * Four polygons at a time, one per lane: vertex v of each polygon is loaded
+ * into its lane, or the last vertex of the polygon once v has run past it,
+ * which leaves its bounds unchanged. The transforms, radii and boxes of the
+ * four polygons are loaded and stored de-interleaved.
+ */
+static void ne10_physics_compute_aabb_batch_kernel_neon (ne10_mat2x2f_t *aabbs,
+        const ne10_vec2f_t *vertices,
+        const ne10_uint32_t *offsets,
+        const ne10_mat2x2f_t *xfs,
+        const ne10_vec2f_t *radii,
+        ne10_uint32_t shape_count)
+{
+    ne10_uint32_t i, v, k;
+
+    for (i = 0; i + 4 <= shape_count; i += 4)
+    {
+        float32x4x4_t xf = vld4q_f32 ( (const ne10_float32_t *) (xfs + i));
+        float32x4x2_t radius = vld2q_f32 ( (const ne10_float32_t *) (radii + i));
+        float32x4x4_t box;
+        float32x4x2_t p;
+        float32x4_t x, y;
+        ne10_uint32_t first[4], last[4];
+        ne10_uint32_t max_count = 0;
+
+        for (k = 0; k < 4; k++)
+        {
+            first[k] = offsets[i + k];
+            last[k] = offsets[i + k + 1] - 1;
+            max_count = NE10_MAX (max_count, last[k] - first[k] + 1);
+        }
+        p.val[0] = p.val[1] = vdupq_n_f32 (0.0f);
+
+        for (v = 0; v < max_count; v++)
+        {
+            p = vld2q_lane_f32 (&vertices[NE10_MIN (first[0] + v, last[0])].x, p, 0);
+            p = vld2q_lane_f32 (&vertices[NE10_MIN (first[1] + v, last[1])].x, p, 1);
+            p = vld2q_lane_f32 (&vertices[NE10_MIN (first[2] + v, last[2])].x, p, 2);
+            p = vld2q_lane_f32 (&vertices[NE10_MIN (first[3] + v, last[3])].x, p, 3);
+
+            /* x = (c * px - s * py) + tx, y = (s * px + c * py) + ty */
+            x = vaddq_f32 (vmlsq_f32 (vmulq_f32 (xf.val[3], p.val[0]), xf.val[2], p.val[1]), xf.val[0]);
+            y = vaddq_f32 (vmlaq_f32 (vmulq_f32 (xf.val[2], p.val[0]), xf.val[3], p.val[1]), xf.val[1]);
+            if (v == 0)
+            {
+                box.val[0] = box.val[2] = x;
+                box.val[1] = box.val[3] = y;
+            }
+            else
+            {
+                box.val[0] = vminq_f32 (box.val[0], x);
+                box.val[1] = vminq_f32 (box.val[1], y);
+                box.val[2] = vmaxq_f32 (box.val[2], x);
+                box.val[3] = vmaxq_f32 (box.val[3], y);
+            }
+        }
+
+        box.val[0] = vsubq_f32 (box.val[0], radius.val[0]);
+        box.val[1] = vsubq_f32 (box.val[1], radius.val[1]);
+        box.val[2] = vaddq_f32 (box.val[2], radius.val[0]);
+        box.val[3] = vaddq_f32 (box.val[3], radius.val[1]);
+        vst4q_f32 ( (ne10_float32_t *) (aabbs + i), box);
+    }
+
+    for (; i < shape_count; i++)
+    {
+        ne10_vec2f_t lower = ne10_mul_matvec_float (xfs[i], vertices[offsets[i]]);
+        ne10_vec2f_t upper = lower;
+        ne10_vec2f_t p;
+
+        for (v = offsets[i] + 1; v < offsets[i + 1]; v++)
+        {
+            p = ne10_mul_matvec_float (xfs[i], vertices[v]);
+            lower = min_2f (lower, p);
+            upper = max_2f (upper, p);
+        }
+        aabbs[i].c1.r1 = lower.x - radii[i].x;
+        aabbs[i].c1.r2 = lower.y - radii[i].y;
+        aabbs[i].c2.r1 = upper.x + radii[i].x;
+        aabbs[i].c2.r2 = upper.y + radii[i].y;
+    }
+}
+
+/**
+ * @ingroup COLLISION_DETECT
+ * Specific implementation of @ref ne10_physics_compute_aabb_batch_vec2f using NEON SIMD capabilities.
+ */
+void ne10_physics_compute_aabb_batch_vec2f_neon (ne10_mat2x2f_t *aabbs,
+        const ne10_vec2f_t *vertices,
+        const ne10_uint32_t *offsets,
+        const ne10_mat2x2f_t *xfs,
+        const ne10_vec2f_t *radii,
+        ne10_uint32_t shape_count)
+{
+    ne10_physics_compute_aabb_batch_generic (aabbs, vertices, offsets, xfs, radii, shape_count,
+            ne10_physics_compute_aabb_batch_kernel_neon);
+}
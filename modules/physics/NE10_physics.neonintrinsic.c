@@ -0,0 +1,187 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : physics/NE10_physics.neonintrinsic.c
+ */
+
+#include <arm_neon.h>
+
+#include "NE10_types.h"
+#include "NE10_physics.h"
+
+#ifdef ENABLE_NE10_PHYSICS_COMPUTE_AABB_VEC2F_NEON
+/* the smallest and the largest of 4 lanes */
+static inline ne10_float32_t ne10_physics_min_lanes (float32x4_t a)
+{
+    float32x2_t m = vmin_f32 (vget_low_f32 (a), vget_high_f32 (a));
+    return vget_lane_f32 (vpmin_f32 (m, m), 0);
+}
+
+static inline ne10_float32_t ne10_physics_max_lanes (float32x4_t a)
+{
+    float32x2_t m = vmax_f32 (vget_low_f32 (a), vget_high_f32 (a));
+    return vget_lane_f32 (vpmax_f32 (m, m), 0);
+}
+
+void ne10_physics_compute_aabb_vec2f_neon (ne10_mat2x2f_t *aabb,
+        ne10_vec2f_t *vertices,
+        ne10_mat2x2f_t *xf,
+        ne10_vec2f_t *radius,
+        ne10_uint32_t vertex_count)
+{
+    ne10_float32_t tx = xf->c1.r1;
+    ne10_float32_t ty = xf->c1.r2;
+    ne10_float32_t s = xf->c2.r1;
+    ne10_float32_t c = xf->c2.r2;
+    ne10_float32_t lower_x, lower_y, upper_x, upper_y;
+    ne10_uint32_t i;
+
+    if (vertex_count >= 4)
+    {
+        float32x4_t vtx = vdupq_n_f32 (tx);
+        float32x4_t vty = vdupq_n_f32 (ty);
+        float32x4_t vs = vdupq_n_f32 (s);
+        float32x4_t vc = vdupq_n_f32 (c);
+        float32x4x2_t v = vld2q_f32 ( (const ne10_float32_t *) vertices);
+        float32x4_t x = vaddq_f32 (vmlsq_f32 (vmulq_f32 (vc, v.val[0]), vs, v.val[1]), vtx);
+        float32x4_t y = vaddq_f32 (vmlaq_f32 (vmulq_f32 (vs, v.val[0]), vc, v.val[1]), vty);
+        float32x4_t lx = x, ux = x;
+        float32x4_t ly = y, uy = y;
+
+        for (i = 4; i + 4 <= vertex_count; i += 4)
+        {
+            v = vld2q_f32 ( (const ne10_float32_t *) (vertices + i));
+            x = vaddq_f32 (vmlsq_f32 (vmulq_f32 (vc, v.val[0]), vs, v.val[1]), vtx);
+            y = vaddq_f32 (vmlaq_f32 (vmulq_f32 (vs, v.val[0]), vc, v.val[1]), vty);
+            lx = vminq_f32 (lx, x);
+            ly = vminq_f32 (ly, y);
+            ux = vmaxq_f32 (ux, x);
+            uy = vmaxq_f32 (uy, y);
+        }
+        lower_x = ne10_physics_min_lanes (lx);
+        lower_y = ne10_physics_min_lanes (ly);
+        upper_x = ne10_physics_max_lanes (ux);
+        upper_y = ne10_physics_max_lanes (uy);
+    }
+    else
+    {
+        lower_x = upper_x = (c * vertices[0].x - s * vertices[0].y) + tx;
+        lower_y = upper_y = (s * vertices[0].x + c * vertices[0].y) + ty;
+        i = 1;
+    }
+
+    for (; i < vertex_count; i++)
+    {
+        ne10_float32_t x = (c * vertices[i].x - s * vertices[i].y) + tx;
+        ne10_float32_t y = (s * vertices[i].x + c * vertices[i].y) + ty;
+
+        lower_x = (x < lower_x) ? x : lower_x;
+        lower_y = (y < lower_y) ? y : lower_y;
+        upper_x = (x > upper_x) ? x : upper_x;
+        upper_y = (y > upper_y) ? y : upper_y;
+    }
+
+    aabb->c1.r1 = lower_x - radius->x;
+    aabb->c1.r2 = lower_y - radius->y;
+    aabb->c2.r1 = upper_x + radius->x;
+    aabb->c2.r2 = upper_y + radius->y;
+}
+#endif // ENABLE_NE10_PHYSICS_COMPUTE_AABB_VEC2F_NEON
+
+#ifdef ENABLE_NE10_PHYSICS_RELATIVE_V_VEC2F_NEON
+void ne10_physics_relative_v_vec2f_neon (ne10_vec2f_t *dv,
+        ne10_vec3f_t *v_wa,
+        ne10_vec2f_t *ra,
+        ne10_vec3f_t *v_wb,
+        ne10_vec2f_t *rb,
+        ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t a = vld3q_f32 ( (const ne10_float32_t *) (v_wa + i));
+        float32x4x3_t b = vld3q_f32 ( (const ne10_float32_t *) (v_wb + i));
+        float32x4x2_t r_a = vld2q_f32 ( (const ne10_float32_t *) (ra + i));
+        float32x4x2_t r_b = vld2q_f32 ( (const ne10_float32_t *) (rb + i));
+        float32x4x2_t d;
+
+        d.val[0] = vsubq_f32 (vmlsq_f32 (b.val[0], b.val[2], r_b.val[1]), vmlsq_f32 (a.val[0], a.val[2], r_a.val[1]));
+        d.val[1] = vsubq_f32 (vmlaq_f32 (b.val[1], b.val[2], r_b.val[0]), vmlaq_f32 (a.val[1], a.val[2], r_a.val[0]));
+        vst2q_f32 ( (ne10_float32_t *) (dv + i), d);
+    }
+    for (; i < count; i++)
+    {
+        dv[i].x = (v_wb[i].x - v_wb[i].z * rb[i].y) - (v_wa[i].x - v_wa[i].z * ra[i].y);
+        dv[i].y = (v_wb[i].y + v_wb[i].z * rb[i].x) - (v_wa[i].y + v_wa[i].z * ra[i].x);
+    }
+}
+#endif // ENABLE_NE10_PHYSICS_RELATIVE_V_VEC2F_NEON
+
+#ifdef ENABLE_NE10_PHYSICS_APPLY_IMPULSE_VEC2F_NEON
+void ne10_physics_apply_impulse_vec2f_neon (ne10_vec3f_t *v_wa,
+        ne10_vec3f_t *v_wb,
+        ne10_vec2f_t *ra,
+        ne10_vec2f_t *rb,
+        ne10_vec2f_t *ima,
+        ne10_vec2f_t *imb,
+        ne10_vec2f_t *p,
+        ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t a = vld3q_f32 ( (const ne10_float32_t *) (v_wa + i));
+        float32x4x3_t b = vld3q_f32 ( (const ne10_float32_t *) (v_wb + i));
+        float32x4x2_t r_a = vld2q_f32 ( (const ne10_float32_t *) (ra + i));
+        float32x4x2_t r_b = vld2q_f32 ( (const ne10_float32_t *) (rb + i));
+        float32x4x2_t im_a = vld2q_f32 ( (const ne10_float32_t *) (ima + i));
+        float32x4x2_t im_b = vld2q_f32 ( (const ne10_float32_t *) (imb + i));
+        float32x4x2_t q = vld2q_f32 ( (const ne10_float32_t *) (p + i));
+
+        a.val[0] = vmlsq_f32 (a.val[0], im_a.val[0], q.val[0]);
+        a.val[1] = vmlsq_f32 (a.val[1], im_a.val[0], q.val[1]);
+        a.val[2] = vmlsq_f32 (a.val[2], im_a.val[1], vmlsq_f32 (vmulq_f32 (r_a.val[0], q.val[1]), r_a.val[1], q.val[0]));
+        b.val[0] = vmlaq_f32 (b.val[0], im_b.val[0], q.val[0]);
+        b.val[1] = vmlaq_f32 (b.val[1], im_b.val[0], q.val[1]);
+        b.val[2] = vmlaq_f32 (b.val[2], im_b.val[1], vmlsq_f32 (vmulq_f32 (r_b.val[0], q.val[1]), r_b.val[1], q.val[0]));
+        vst3q_f32 ( (ne10_float32_t *) (v_wa + i), a);
+        vst3q_f32 ( (ne10_float32_t *) (v_wb + i), b);
+    }
+    for (; i < count; i++)
+    {
+        v_wa[i].x -= ima[i].x * p[i].x;
+        v_wa[i].y -= ima[i].x * p[i].y;
+        v_wa[i].z -= ima[i].y * (ra[i].x * p[i].y - ra[i].y * p[i].x);
+        v_wb[i].x += imb[i].x * p[i].x;
+        v_wb[i].y += imb[i].x * p[i].y;
+        v_wb[i].z += imb[i].y * (rb[i].x * p[i].y - rb[i].y * p[i].x);
+    }
+}
+#endif // ENABLE_NE10_PHYSICS_APPLY_IMPULSE_VEC2F_NEON
@@ -0,0 +1,471 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : physics/NE10_solver.c
+ */
+
+#include <string.h>
+
+#include "NE10_types.h"
+#include "NE10_solver.h"
+
+/**
+ * @ingroup groupPhysics
+ */
+/**
+ * @defgroup CONTACT_SOLVER Contact Solver
+ *
+ * \par
+ * The contact solver computes the impulses that stop bodies in contact from moving
+ * into each other, with friction and restitution, by sequential impulses: each contact
+ * in turn is given the impulse that corrects its relative velocity, and the sweep over
+ * the contacts is repeated a few times, starting from the impulses of the previous step.
+ * \par
+ * Contacts that share a body must be solved one after the other, as each one changes
+ * the velocity the next one sees. The solver therefore batches the contacts into groups
+ * of 4 that share no moving body, whose lanes can be solved at once; static bodies are
+ * not changed by any contact, and may be shared.
+ */
+
+/* number of groups being filled at a time while batching, one bit each */
+#define NE10_SOLVER_OPEN_GROUPS 32
+/* approach speed below which contacts do not bounce */
+#define NE10_SOLVER_RESTITUTION_THRESHOLD 1.0f
+
+typedef struct
+{
+    ne10_uint32_t count;
+    ne10_uint32_t contact[4];
+} ne10_solver_open_group_t;
+
+/**
+ * @ingroup CONTACT_SOLVER
+ * @brief Creates a contact solver (see @ref ne10_physics_solver_create in NE10_physics.h).
+ */
+ne10_physics_solver_t ne10_physics_solver_create (ne10_uint32_t max_contacts,
+        ne10_uint32_t max_bodies)
+{
+    ne10_physics_solver_t solver = NULL;
+    ne10_uint32_t lanes, bodies;
+    uintptr_t address;
+
+    if (max_contacts == 0 || max_contacts > (1u << 22)
+            || max_bodies == 0 || max_bodies > (1u << 26))
+    {
+        return NULL;
+    }
+
+    /* each contact may be alone in its group; every array is a whole number of 16 bytes */
+    lanes = 4 * max_contacts;
+    bodies = (max_bodies + 3) & ~3u;
+    solver = (ne10_physics_solver_t) NE10_MALLOC (sizeof (ne10_physics_solver_state_t) + 16
+             + sizeof (ne10_float32_t) * lanes * 16
+             + sizeof (ne10_float32_t) * 4 * (max_bodies + 1)
+             + sizeof (ne10_uint32_t) * lanes * 3
+             + sizeof (ne10_uint32_t) * bodies);
+    if (solver == NULL)
+    {
+        return NULL;
+    }
+
+    address = (uintptr_t) solver + sizeof (ne10_physics_solver_state_t);
+    NE10_BYTE_ALIGNMENT (address, 16);
+    solver->normal_x = (ne10_float32_t *) address;
+    solver->normal_y = solver->normal_x + lanes;
+    solver->ra_x = solver->normal_y + lanes;
+    solver->ra_y = solver->ra_x + lanes;
+    solver->rb_x = solver->ra_y + lanes;
+    solver->rb_y = solver->rb_x + lanes;
+    solver->inv_mass_a = solver->rb_y + lanes;
+    solver->inv_inertia_a = solver->inv_mass_a + lanes;
+    solver->inv_mass_b = solver->inv_inertia_a + lanes;
+    solver->inv_inertia_b = solver->inv_mass_b + lanes;
+    solver->normal_mass = solver->inv_inertia_b + lanes;
+    solver->tangent_mass = solver->normal_mass + lanes;
+    solver->friction = solver->tangent_mass + lanes;
+    solver->velocity_bias = solver->friction + lanes;
+    solver->normal_impulse = solver->velocity_bias + lanes;
+    solver->tangent_impulse = solver->normal_impulse + lanes;
+    solver->bodies = solver->tangent_impulse + lanes;
+    solver->contact = (ne10_uint32_t *) (solver->bodies + 4 * (max_bodies + 1));
+    solver->body_a = solver->contact + lanes;
+    solver->body_b = solver->body_a + lanes;
+    solver->body_mask = solver->body_b + lanes;
+
+    solver->max_contacts = max_contacts;
+    solver->max_bodies = max_bodies;
+    solver->group_count = 0;
+    return solver;
+}
+
+/**
+ * @ingroup CONTACT_SOLVER
+ * @brief Destroys a contact solver created by @ref ne10_physics_solver_create.
+ */
+void ne10_physics_solver_destroy (ne10_physics_solver_t solver)
+{
+    NE10_FREE (solver);
+}
+
+/* appends an open group to the groups, the lanes it does not fill empty, and empties it */
+static void ne10_solver_close_group (ne10_physics_solver_state_t *solver,
+                                     ne10_solver_open_group_t *group,
+                                     ne10_uint32_t slot,
+                                     const ne10_physics_contacts_t *contacts)
+{
+    ne10_uint32_t *lane = solver->contact + 4 * solver->group_count;
+    ne10_uint32_t i;
+
+    for (i = 0; i < 4; i++)
+    {
+        if (i < group->count)
+        {
+            ne10_uint32_t c = group->contact[i];
+
+            lane[i] = c;
+            solver->body_mask[contacts->body_a[c]] &= ~ (1u << slot);
+            solver->body_mask[contacts->body_b[c]] &= ~ (1u << slot);
+        }
+        else
+        {
+            lane[i] = NE10_PHYSICS_SOLVER_NO_CONTACT;
+        }
+    }
+    group->count = 0;
+    solver->group_count++;
+}
+
+/*
+ * Batches the contacts into groups of 4 sharing no moving body. Each contact
+ * goes into the first of up to 32 open groups holding neither of its moving
+ * bodies, which the bits of body_mask tell at once, and a group is appended
+ * to the others as soon as it is full. When every open group conflicts, the
+ * fullest is appended as it is to make room. Returns NE10_ERR if a contact
+ * refers to a body past body_count.
+ */
+static ne10_result_t ne10_solver_batch (ne10_physics_solver_state_t *solver,
+                                        const ne10_vec2f_t *inv_mass,
+                                        ne10_uint32_t body_count,
+                                        const ne10_physics_contacts_t *contacts,
+                                        ne10_uint32_t contact_count)
+{
+    ne10_solver_open_group_t open[NE10_SOLVER_OPEN_GROUPS];
+    ne10_uint32_t *mask = solver->body_mask;
+    ne10_uint32_t used = 0;
+    ne10_uint32_t c, slot;
+
+    memset (mask, 0, body_count * sizeof (ne10_uint32_t));
+    solver->group_count = 0;
+    for (c = 0; c < contact_count; c++)
+    {
+        ne10_uint32_t a = contacts->body_a[c];
+        ne10_uint32_t b = contacts->body_b[c];
+        ne10_uint32_t moving_a, moving_b, free_groups;
+
+        if (a >= body_count || b >= body_count)
+        {
+            return NE10_ERR;
+        }
+        moving_a = (inv_mass[a].x != 0.0f || inv_mass[a].y != 0.0f) ? ~0u : 0;
+        moving_b = (inv_mass[b].x != 0.0f || inv_mass[b].y != 0.0f) ? ~0u : 0;
+        free_groups = used & ~ ( (mask[a] & moving_a) | (mask[b] & moving_b));
+
+        if (free_groups != 0)
+        {
+            slot = __builtin_ctz (free_groups);
+        }
+        else if (used != ~0u)
+        {
+            slot = __builtin_ctz (~used);
+            open[slot].count = 0;
+        }
+        else
+        {
+            ne10_uint32_t i;
+
+            for (slot = 0, i = 1; i < NE10_SOLVER_OPEN_GROUPS; i++)
+            {
+                if (open[i].count > open[slot].count)
+                {
+                    slot = i;
+                }
+            }
+            ne10_solver_close_group (solver, &open[slot], slot, contacts);
+        }
+
+        open[slot].contact[open[slot].count++] = c;
+        used |= 1u << slot;
+        mask[a] |= (1u << slot) & moving_a;
+        mask[b] |= (1u << slot) & moving_b;
+        if (open[slot].count == 4)
+        {
+            ne10_solver_close_group (solver, &open[slot], slot, contacts);
+            used &= ~ (1u << slot);
+        }
+    }
+
+    for (slot = 0; slot < NE10_SOLVER_OPEN_GROUPS; slot++)
+    {
+        if (used & (1u << slot))
+        {
+            ne10_solver_close_group (solver, &open[slot], slot, contacts);
+        }
+    }
+    return NE10_OK;
+}
+
+/*
+ * Gathers the contacts into the lanes of the groups, with the effective
+ * masses and the restitution targets, from the velocities in solver->bodies
+ * before any impulse.
+ */
+static void ne10_solver_prepare (ne10_physics_solver_state_t *solver,
+                                 const ne10_vec2f_t *inv_mass,
+                                 const ne10_physics_contacts_t *contacts)
+{
+    const ne10_float32_t *bodies = solver->bodies;
+    ne10_uint32_t lanes = 4 * solver->group_count;
+    ne10_uint32_t i;
+
+    for (i = 0; i < lanes; i++)
+    {
+        ne10_uint32_t c = solver->contact[i];
+        ne10_uint32_t a, b;
+        ne10_float32_t nx, ny, rax, ray, rbx, rby, ima, iia, imb, iib;
+        ne10_float32_t rna, rnb, rta, rtb, k, dvx, dvy, vn;
+        const ne10_float32_t *va, *vb;
+
+        if (c == NE10_PHYSICS_SOLVER_NO_CONTACT)
+        {
+            /* an empty lane, between the resting dummy body and itself, which no impulse moves */
+            solver->body_a[i] = solver->max_bodies;
+            solver->body_b[i] = solver->max_bodies;
+            solver->normal_x[i] = solver->normal_y[i] = 0.0f;
+            solver->ra_x[i] = solver->ra_y[i] = solver->rb_x[i] = solver->rb_y[i] = 0.0f;
+            solver->inv_mass_a[i] = solver->inv_inertia_a[i] = 0.0f;
+            solver->inv_mass_b[i] = solver->inv_inertia_b[i] = 0.0f;
+            solver->normal_mass[i] = solver->tangent_mass[i] = 0.0f;
+            solver->friction[i] = solver->velocity_bias[i] = 0.0f;
+            solver->normal_impulse[i] = solver->tangent_impulse[i] = 0.0f;
+            continue;
+        }
+
+        a = contacts->body_a[c];
+        b = contacts->body_b[c];
+        nx = contacts->normal_x[c];
+        ny = contacts->normal_y[c];
+        rax = contacts->ra_x[c];
+        ray = contacts->ra_y[c];
+        rbx = contacts->rb_x[c];
+        rby = contacts->rb_y[c];
+        ima = inv_mass[a].x;
+        iia = inv_mass[a].y;
+        imb = inv_mass[b].x;
+        iib = inv_mass[b].y;
+
+        /* the tangent is (ny, -nx) */
+        rna = rax * ny - ray * nx;
+        rnb = rbx * ny - rby * nx;
+        rta = -rax * nx - ray * ny;
+        rtb = -rbx * nx - rby * ny;
+        k = ima + imb + iia * rna * rna + iib * rnb * rnb;
+        solver->normal_mass[i] = (k > 0.0f) ? 1.0f / k : 0.0f;
+        k = ima + imb + iia * rta * rta + iib * rtb * rtb;
+        solver->tangent_mass[i] = (k > 0.0f) ? 1.0f / k : 0.0f;
+
+        va = bodies + 4 * a;
+        vb = bodies + 4 * b;
+        dvx = (vb[0] - vb[2] * rby) - (va[0] - va[2] * ray);
+        dvy = (vb[1] + vb[2] * rbx) - (va[1] + va[2] * rax);
+        vn = dvx * nx + dvy * ny;
+        solver->velocity_bias[i] = (vn < -NE10_SOLVER_RESTITUTION_THRESHOLD) ? -contacts->restitution[c] * vn : 0.0f;
+
+        solver->body_a[i] = a;
+        solver->body_b[i] = b;
+        solver->normal_x[i] = nx;
+        solver->normal_y[i] = ny;
+        solver->ra_x[i] = rax;
+        solver->ra_y[i] = ray;
+        solver->rb_x[i] = rbx;
+        solver->rb_y[i] = rby;
+        solver->inv_mass_a[i] = ima;
+        solver->inv_inertia_a[i] = iia;
+        solver->inv_mass_b[i] = imb;
+        solver->inv_inertia_b[i] = iib;
+        solver->friction[i] = contacts->friction[c];
+        solver->normal_impulse[i] = contacts->normal_impulse[c];
+        solver->tangent_impulse[i] = contacts->tangent_impulse[c];
+    }
+}
+
+/*
+ * The solver step, with the kernel that applies the impulses: batching and
+ * the preparation of the lanes are shared, on copies of the velocities laid
+ * out 4 floats per body, which are copied back with the impulses at the end.
+ */
+ne10_result_t ne10_physics_solve_contacts_generic (ne10_physics_solver_t solver,
+        ne10_vec3f_t *v_w,
+        const ne10_vec2f_t *inv_mass,
+        ne10_uint32_t body_count,
+        ne10_physics_contacts_t *contacts,
+        ne10_uint32_t contact_count,
+        ne10_uint32_t iterations,
+        ne10_physics_solver_kernel_t kernel)
+{
+    ne10_float32_t *bodies = solver->bodies;
+    ne10_uint32_t i;
+
+    if (contact_count > solver->max_contacts || body_count > solver->max_bodies)
+    {
+        return NE10_ERR;
+    }
+    if (ne10_solver_batch (solver, inv_mass, body_count, contacts, contact_count) != NE10_OK)
+    {
+        return NE10_ERR;
+    }
+
+    for (i = 0; i < body_count; i++)
+    {
+        bodies[4 * i] = v_w[i].x;
+        bodies[4 * i + 1] = v_w[i].y;
+        bodies[4 * i + 2] = v_w[i].z;
+        bodies[4 * i + 3] = 0.0f;
+    }
+    memset (bodies + 4 * solver->max_bodies, 0, 4 * sizeof (ne10_float32_t));
+
+    ne10_solver_prepare (solver, inv_mass, contacts);
+    kernel (solver, iterations);
+
+    for (i = 0; i < body_count; i++)
+    {
+        v_w[i].x = bodies[4 * i];
+        v_w[i].y = bodies[4 * i + 1];
+        v_w[i].z = bodies[4 * i + 2];
+    }
+    for (i = 0; i < 4 * solver->group_count; i++)
+    {
+        ne10_uint32_t c = solver->contact[i];
+
+        if (c != NE10_PHYSICS_SOLVER_NO_CONTACT)
+        {
+            contacts->normal_impulse[c] = solver->normal_impulse[i];
+            contacts->tangent_impulse[c] = solver->tangent_impulse[i];
+        }
+    }
+    return NE10_OK;
+}
+
+/* applies the impulse (px, py) of lane i to its bodies */
+static inline void ne10_solver_apply_c (const ne10_physics_solver_state_t *solver,
+                                        ne10_uint32_t i,
+                                        ne10_float32_t *va,
+                                        ne10_float32_t *vb,
+                                        ne10_float32_t px,
+                                        ne10_float32_t py)
+{
+    va[0] -= solver->inv_mass_a[i] * px;
+    va[1] -= solver->inv_mass_a[i] * py;
+    va[2] -= solver->inv_inertia_a[i] * (solver->ra_x[i] * py - solver->ra_y[i] * px);
+    vb[0] += solver->inv_mass_b[i] * px;
+    vb[1] += solver->inv_mass_b[i] * py;
+    vb[2] += solver->inv_inertia_b[i] * (solver->rb_x[i] * py - solver->rb_y[i] * px);
+}
+
+/* the kernel, one lane after another */
+static void ne10_solver_kernel_c (ne10_physics_solver_state_t *solver, ne10_uint32_t iterations)
+{
+    ne10_float32_t *bodies = solver->bodies;
+    ne10_uint32_t lanes = 4 * solver->group_count;
+    ne10_uint32_t i, iter;
+
+    for (i = 0; i < lanes; i++)
+    {
+        ne10_float32_t nx = solver->normal_x[i];
+        ne10_float32_t ny = solver->normal_y[i];
+        ne10_float32_t pn = solver->normal_impulse[i];
+        ne10_float32_t pt = solver->tangent_impulse[i];
+
+        ne10_solver_apply_c (solver, i, bodies + 4 * solver->body_a[i], bodies + 4 * solver->body_b[i],
+                             pn * nx + pt * ny, pn * ny - pt * nx);
+    }
+
+    for (iter = 0; iter < iterations; iter++)
+    {
+        for (i = 0; i < lanes; i++)
+        {
+            ne10_float32_t *va = bodies + 4 * solver->body_a[i];
+            ne10_float32_t *vb = bodies + 4 * solver->body_b[i];
+            ne10_float32_t nx = solver->normal_x[i];
+            ne10_float32_t ny = solver->normal_y[i];
+            ne10_float32_t pn = solver->normal_impulse[i];
+            ne10_float32_t pt = solver->tangent_impulse[i];
+            ne10_float32_t dvx, dvy, lambda, max_f, p;
+
+            /* friction first, within the bounds of the normal impulse so far */
+            dvx = (vb[0] - vb[2] * solver->rb_y[i]) - (va[0] - va[2] * solver->ra_y[i]);
+            dvy = (vb[1] + vb[2] * solver->rb_x[i]) - (va[1] + va[2] * solver->ra_x[i]);
+            lambda = -solver->tangent_mass[i] * (dvx * ny - dvy * nx);
+            max_f = solver->friction[i] * pn;
+            p = pt + lambda;
+            p = (p > -max_f) ? p : -max_f;
+            p = (p < max_f) ? p : max_f;
+            lambda = p - pt;
+            pt = p;
+            ne10_solver_apply_c (solver, i, va, vb, lambda * ny, -lambda * nx);
+
+            /* then the normal impulse, which only pushes */
+            dvx = (vb[0] - vb[2] * solver->rb_y[i]) - (va[0] - va[2] * solver->ra_y[i]);
+            dvy = (vb[1] + vb[2] * solver->rb_x[i]) - (va[1] + va[2] * solver->ra_x[i]);
+            lambda = -solver->normal_mass[i] * ( (dvx * nx + dvy * ny) - solver->velocity_bias[i]);
+            p = pn + lambda;
+            p = (p > 0.0f) ? p : 0.0f;
+            lambda = p - pn;
+            pn = p;
+            ne10_solver_apply_c (solver, i, va, vb, lambda * nx, lambda * ny);
+
+            solver->normal_impulse[i] = pn;
+            solver->tangent_impulse[i] = pt;
+        }
+    }
+}
+
+/**
+ * @ingroup CONTACT_SOLVER
+ * Specific implementation of @ref ne10_physics_solve_contacts_vec2f using plain C.
+ */
+ne10_result_t ne10_physics_solve_contacts_vec2f_c (ne10_physics_solver_t solver,
+        ne10_vec3f_t *v_w,
+        const ne10_vec2f_t *inv_mass,
+        ne10_uint32_t body_count,
+        ne10_physics_contacts_t *contacts,
+        ne10_uint32_t contact_count,
+        ne10_uint32_t iterations)
+{
+    return ne10_physics_solve_contacts_generic (solver, v_w, inv_mass, body_count, contacts, contact_count,
+            iterations, ne10_solver_kernel_c);
+}
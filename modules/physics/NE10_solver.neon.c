@@ -0,0 +1,189 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : physics/NE10_solver.neon.c
+ */
+
+#include <arm_neon.h>
+
+#include "NE10_physics.h"
+#include "NE10_solver.h"
+
+/* the velocities of the 4 bodies of a group's lanes, one vector per component */
+static inline void ne10_solver_gather (const ne10_float32_t *bodies,
+                                       const ne10_uint32_t *index,
+                                       float32x4_t *vx,
+                                       float32x4_t *vy,
+                                       float32x4_t *w)
+{
+    float32x4x2_t b01 = vtrnq_f32 (vld1q_f32 (bodies + 4 * index[0]), vld1q_f32 (bodies + 4 * index[1]));
+    float32x4x2_t b23 = vtrnq_f32 (vld1q_f32 (bodies + 4 * index[2]), vld1q_f32 (bodies + 4 * index[3]));
+
+    *vx = vcombine_f32 (vget_low_f32 (b01.val[0]), vget_low_f32 (b23.val[0]));
+    *vy = vcombine_f32 (vget_low_f32 (b01.val[1]), vget_low_f32 (b23.val[1]));
+    *w = vcombine_f32 (vget_high_f32 (b01.val[0]), vget_high_f32 (b23.val[0]));
+}
+
+/*
+ * Stores them back. Lanes only share static bodies and the dummy body of the
+ * empty lanes, whose velocities no impulse changes, so the order of the
+ * stores does not matter.
+ */
+static inline void ne10_solver_scatter (ne10_float32_t *bodies,
+                                        const ne10_uint32_t *index,
+                                        float32x4_t vx,
+                                        float32x4_t vy,
+                                        float32x4_t w)
+{
+    float32x4x2_t xy = vtrnq_f32 (vx, vy);
+    float32x4x2_t wz = vtrnq_f32 (w, vdupq_n_f32 (0.0f));
+
+    vst1q_f32 (bodies + 4 * index[0], vcombine_f32 (vget_low_f32 (xy.val[0]), vget_low_f32 (wz.val[0])));
+    vst1q_f32 (bodies + 4 * index[1], vcombine_f32 (vget_low_f32 (xy.val[1]), vget_low_f32 (wz.val[1])));
+    vst1q_f32 (bodies + 4 * index[2], vcombine_f32 (vget_high_f32 (xy.val[0]), vget_high_f32 (wz.val[0])));
+    vst1q_f32 (bodies + 4 * index[3], vcombine_f32 (vget_high_f32 (xy.val[1]), vget_high_f32 (wz.val[1])));
+}
+
+/* the lanes of a group, with the velocities of their bodies */
+typedef struct
+{
+    float32x4_t vax, vay, wa;
+    float32x4_t vbx, vby, wb;
+    float32x4_t nx, ny;
+    float32x4_t rax, ray, rbx, rby;
+    float32x4_t ima, iia, imb, iib;
+} ne10_solver_group_t;
+
+static inline void ne10_solver_load (const ne10_physics_solver_state_t *solver,
+                                     ne10_uint32_t o,
+                                     ne10_solver_group_t *g)
+{
+    ne10_solver_gather (solver->bodies, solver->body_a + o, &g->vax, &g->vay, &g->wa);
+    ne10_solver_gather (solver->bodies, solver->body_b + o, &g->vbx, &g->vby, &g->wb);
+    g->nx = vld1q_f32 (solver->normal_x + o);
+    g->ny = vld1q_f32 (solver->normal_y + o);
+    g->rax = vld1q_f32 (solver->ra_x + o);
+    g->ray = vld1q_f32 (solver->ra_y + o);
+    g->rbx = vld1q_f32 (solver->rb_x + o);
+    g->rby = vld1q_f32 (solver->rb_y + o);
+    g->ima = vld1q_f32 (solver->inv_mass_a + o);
+    g->iia = vld1q_f32 (solver->inv_inertia_a + o);
+    g->imb = vld1q_f32 (solver->inv_mass_b + o);
+    g->iib = vld1q_f32 (solver->inv_inertia_b + o);
+}
+
+/* applies the impulses (px, py) of the lanes to their bodies */
+static inline void ne10_solver_apply (ne10_solver_group_t *g, float32x4_t px, float32x4_t py)
+{
+    g->vax = vmlsq_f32 (g->vax, g->ima, px);
+    g->vay = vmlsq_f32 (g->vay, g->ima, py);
+    g->wa = vmlsq_f32 (g->wa, g->iia, vmlsq_f32 (vmulq_f32 (g->rax, py), g->ray, px));
+    g->vbx = vmlaq_f32 (g->vbx, g->imb, px);
+    g->vby = vmlaq_f32 (g->vby, g->imb, py);
+    g->wb = vmlaq_f32 (g->wb, g->iib, vmlsq_f32 (vmulq_f32 (g->rbx, py), g->rby, px));
+}
+
+/* the relative velocity of the contact points */
+static inline void ne10_solver_relative_v (const ne10_solver_group_t *g, float32x4_t *dvx, float32x4_t *dvy)
+{
+    *dvx = vsubq_f32 (vmlsq_f32 (g->vbx, g->wb, g->rby), vmlsq_f32 (g->vax, g->wa, g->ray));
+    *dvy = vsubq_f32 (vmlaq_f32 (g->vby, g->wb, g->rbx), vmlaq_f32 (g->vay, g->wa, g->rax));
+}
+
+/* the kernel, the 4 lanes of a group at once */
+static void ne10_solver_kernel_neon (ne10_physics_solver_state_t *solver, ne10_uint32_t iterations)
+{
+    ne10_uint32_t lanes = 4 * solver->group_count;
+    float32x4_t zero = vdupq_n_f32 (0.0f);
+    ne10_uint32_t o, iter;
+    ne10_solver_group_t g;
+
+    for (o = 0; o < lanes; o += 4)
+    {
+        float32x4_t pn = vld1q_f32 (solver->normal_impulse + o);
+        float32x4_t pt = vld1q_f32 (solver->tangent_impulse + o);
+
+        ne10_solver_load (solver, o, &g);
+        ne10_solver_apply (&g, vmlaq_f32 (vmulq_f32 (pn, g.nx), pt, g.ny), vmlsq_f32 (vmulq_f32 (pn, g.ny), pt, g.nx));
+        ne10_solver_scatter (solver->bodies, solver->body_a + o, g.vax, g.vay, g.wa);
+        ne10_solver_scatter (solver->bodies, solver->body_b + o, g.vbx, g.vby, g.wb);
+    }
+
+    for (iter = 0; iter < iterations; iter++)
+    {
+        for (o = 0; o < lanes; o += 4)
+        {
+            float32x4_t pn = vld1q_f32 (solver->normal_impulse + o);
+            float32x4_t pt = vld1q_f32 (solver->tangent_impulse + o);
+            float32x4_t dvx, dvy, lambda, max_f, p;
+
+            ne10_solver_load (solver, o, &g);
+
+            /* friction first, within the bounds of the normal impulse so far */
+            ne10_solver_relative_v (&g, &dvx, &dvy);
+            lambda = vmulq_f32 (vnegq_f32 (vld1q_f32 (solver->tangent_mass + o)),
+                                vmlsq_f32 (vmulq_f32 (dvx, g.ny), dvy, g.nx));
+            max_f = vmulq_f32 (vld1q_f32 (solver->friction + o), pn);
+            p = vminq_f32 (vmaxq_f32 (vaddq_f32 (pt, lambda), vnegq_f32 (max_f)), max_f);
+            lambda = vsubq_f32 (p, pt);
+            pt = p;
+            ne10_solver_apply (&g, vmulq_f32 (lambda, g.ny), vnegq_f32 (vmulq_f32 (lambda, g.nx)));
+
+            /* then the normal impulse, which only pushes */
+            ne10_solver_relative_v (&g, &dvx, &dvy);
+            lambda = vmulq_f32 (vnegq_f32 (vld1q_f32 (solver->normal_mass + o)),
+                                vsubq_f32 (vmlaq_f32 (vmulq_f32 (dvx, g.nx), dvy, g.ny),
+                                           vld1q_f32 (solver->velocity_bias + o)));
+            p = vmaxq_f32 (vaddq_f32 (pn, lambda), zero);
+            lambda = vsubq_f32 (p, pn);
+            pn = p;
+            ne10_solver_apply (&g, vmulq_f32 (lambda, g.nx), vmulq_f32 (lambda, g.ny));
+
+            vst1q_f32 (solver->normal_impulse + o, pn);
+            vst1q_f32 (solver->tangent_impulse + o, pt);
+            ne10_solver_scatter (solver->bodies, solver->body_a + o, g.vax, g.vay, g.wa);
+            ne10_solver_scatter (solver->bodies, solver->body_b + o, g.vbx, g.vby, g.wb);
+        }
+    }
+}
+
+/**
+ * @ingroup CONTACT_SOLVER
+ * Specific implementation of @ref ne10_physics_solve_contacts_vec2f using NEON SIMD capabilities.
+ */
+ne10_result_t ne10_physics_solve_contacts_vec2f_neon (ne10_physics_solver_t solver,
+        ne10_vec3f_t *v_w,
+        const ne10_vec2f_t *inv_mass,
+        ne10_uint32_t body_count,
+        ne10_physics_contacts_t *contacts,
+        ne10_uint32_t contact_count,
+        ne10_uint32_t iterations)
+{
+    return ne10_physics_solve_contacts_generic (solver, v_w, inv_mass, body_count, contacts, contact_count,
+            iterations, ne10_solver_kernel_neon);
+}
@@ -0,0 +1,569 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : physics/test/bench_physics.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "NE10_physics.h"
+#include "NE10_bench.h"
+
+/*
+ * size contacts, or a polygon of size vertices; size is a multiple of 4 as
+ * the NEON AABB computation requires.
+ */
+typedef struct
+{
+    ne10_uint32_t count;
+    ne10_vec2f_t * vertices;
+    ne10_vec2f_t * dv;
+    ne10_vec3f_t * v_wa;
+    ne10_vec3f_t * v_wb;
+    ne10_vec2f_t * ra;
+    ne10_vec2f_t * rb;
+    ne10_vec2f_t * ima;
+    ne10_vec2f_t * imb;
+    ne10_vec2f_t * p;
+    ne10_mat2x2f_t aabb;
+    ne10_mat2x2f_t xf;
+    ne10_vec2f_t radius;
+} ne10_bench_physics_state_t;
+
+static void bench_physics_teardown (void * state)
+{
+    ne10_bench_physics_state_t * st = (ne10_bench_physics_state_t *) state;
+
+    ne10_bench_free (st->vertices);
+    ne10_bench_free (st->dv);
+    ne10_bench_free (st->v_wa);
+    ne10_bench_free (st->v_wb);
+    ne10_bench_free (st->ra);
+    ne10_bench_free (st->rb);
+    ne10_bench_free (st->ima);
+    ne10_bench_free (st->imb);
+    ne10_bench_free (st->p);
+    free (st);
+}
+
+static void * bench_physics_setup (ne10_uint32_t count)
+{
+    ne10_bench_physics_state_t * st = (ne10_bench_physics_state_t *) calloc (1, sizeof (ne10_bench_physics_state_t));
+    ne10_uint32_t size2 = count * sizeof (ne10_vec2f_t);
+    ne10_uint32_t size3 = count * sizeof (ne10_vec3f_t);
+
+    if (st == NULL)
+        return NULL;
+    st->count = count;
+    st->vertices = (ne10_vec2f_t *) ne10_bench_alloc (size2);
+    st->dv = (ne10_vec2f_t *) ne10_bench_alloc (size2);
+    st->v_wa = (ne10_vec3f_t *) ne10_bench_alloc (size3);
+    st->v_wb = (ne10_vec3f_t *) ne10_bench_alloc (size3);
+    st->ra = (ne10_vec2f_t *) ne10_bench_alloc (size2);
+    st->rb = (ne10_vec2f_t *) ne10_bench_alloc (size2);
+    st->ima = (ne10_vec2f_t *) ne10_bench_alloc (size2);
+    st->imb = (ne10_vec2f_t *) ne10_bench_alloc (size2);
+    st->p = (ne10_vec2f_t *) ne10_bench_alloc (size2);
+    if (st->vertices == NULL || st->dv == NULL || st->v_wa == NULL || st->v_wb == NULL || st->ra == NULL
+            || st->rb == NULL || st->ima == NULL || st->imb == NULL || st->p == NULL)
+    {
+        bench_physics_teardown (st);
+        return NULL;
+    }
+
+    // a translation of (1, 2) and a rotation of 30 degrees
+    st->xf.c1.r1 = 1.0f;
+    st->xf.c1.r2 = 2.0f;
+    st->xf.c2.r1 = 0.5f;
+    st->xf.c2.r2 = 0.866025f;
+    st->radius.x = st->radius.y = 0.1f;
+    return st;
+}
+
+#define PHYSICS_STATE ne10_bench_physics_state_t * st = (ne10_bench_physics_state_t *) state
+
+static void bench_physics_compute_aabb_vec2f (void * state)
+{
+    PHYSICS_STATE;
+    ne10_physics_compute_aabb_vec2f (&st->aabb, st->vertices, &st->xf, &st->radius, st->count);
+}
+
+static void bench_physics_relative_v_vec2f (void * state)
+{
+    PHYSICS_STATE;
+    ne10_physics_relative_v_vec2f (st->dv, st->v_wa, st->ra, st->v_wb, st->rb, st->count);
+}
+
+static void bench_physics_apply_impulse_vec2f (void * state)
+{
+    PHYSICS_STATE;
+    ne10_physics_apply_impulse_vec2f (st->v_wa, st->v_wb, st->ra, st->rb, st->ima, st->imb, st->p, st->count);
+}
+
+/* name, run, bytes read and written per item, and flops per item */
+static const struct
+{
+    const char * name;
+    ne10_bench_run_t run;
+    ne10_float64_t bytes;
+    ne10_float64_t flops;
+} bench_physics_functions[] =
+{
+    { "ne10_physics_compute_aabb_vec2f", bench_physics_compute_aabb_vec2f, 8, 8 },
+    { "ne10_physics_relative_v_vec2f", bench_physics_relative_v_vec2f, 48, 10 },
+    { "ne10_physics_apply_impulse_vec2f", bench_physics_apply_impulse_vec2f, 88, 20 },
+};
+
+/*
+ * The boxes of size polygons of NE10_BENCH_AABB_VERTICES vertices each, with
+ * one call for all of them, or one call per polygon as before the batch.
+ */
+#define NE10_BENCH_AABB_VERTICES 8
+
+typedef struct
+{
+    ne10_uint32_t count;
+    ne10_vec2f_t * vertices;
+    ne10_uint32_t * offsets;
+    ne10_mat2x2f_t * xfs;
+    ne10_vec2f_t * radii;
+    ne10_mat2x2f_t * aabbs;
+} ne10_bench_aabb_batch_state_t;
+
+static void bench_aabb_batch_teardown (void * state)
+{
+    ne10_bench_aabb_batch_state_t * st = (ne10_bench_aabb_batch_state_t *) state;
+
+    ne10_bench_free (st->vertices);
+    ne10_bench_free (st->offsets);
+    ne10_bench_free (st->xfs);
+    ne10_bench_free (st->radii);
+    ne10_bench_free (st->aabbs);
+    free (st);
+}
+
+static void * bench_aabb_batch_setup (ne10_uint32_t count)
+{
+    ne10_bench_aabb_batch_state_t * st = (ne10_bench_aabb_batch_state_t *) calloc (1, sizeof (ne10_bench_aabb_batch_state_t));
+    ne10_uint32_t i;
+
+    if (st == NULL)
+        return NULL;
+    st->count = count;
+    st->vertices = (ne10_vec2f_t *) ne10_bench_alloc (count * NE10_BENCH_AABB_VERTICES * sizeof (ne10_vec2f_t));
+    st->offsets = (ne10_uint32_t *) ne10_bench_alloc ( (count + 1) * sizeof (ne10_uint32_t));
+    st->xfs = (ne10_mat2x2f_t *) ne10_bench_alloc (count * sizeof (ne10_mat2x2f_t));
+    st->radii = (ne10_vec2f_t *) ne10_bench_alloc (count * sizeof (ne10_vec2f_t));
+    st->aabbs = (ne10_mat2x2f_t *) ne10_bench_alloc (count * sizeof (ne10_mat2x2f_t));
+    if (st->vertices == NULL || st->offsets == NULL || st->xfs == NULL || st->radii == NULL || st->aabbs == NULL)
+    {
+        bench_aabb_batch_teardown (st);
+        return NULL;
+    }
+    for (i = 0; i <= count; i++)
+        st->offsets[i] = i * NE10_BENCH_AABB_VERTICES;
+    return st;
+}
+
+static void bench_aabb_batch (void * state)
+{
+    ne10_bench_aabb_batch_state_t * st = (ne10_bench_aabb_batch_state_t *) state;
+
+    ne10_physics_compute_aabb_batch_vec2f (st->aabbs, st->vertices, st->offsets, st->xfs, st->radii, st->count);
+}
+
+static void bench_aabb_per_shape (void * state)
+{
+    ne10_bench_aabb_batch_state_t * st = (ne10_bench_aabb_batch_state_t *) state;
+    ne10_uint32_t i;
+
+    for (i = 0; i < st->count; i++)
+        ne10_physics_compute_aabb_vec2f (&st->aabbs[i], &st->vertices[st->offsets[i]], &st->xfs[i], &st->radii[i],
+                                         NE10_BENCH_AABB_VERTICES);
+}
+
+/*
+ * Broad phase of size boxes of half sizes in [0.5, 2), spread over a square
+ * whose area grows with size so that each box overlaps about two others.
+ * Each call alternates between two frames in which every box has moved by a
+ * little, as a simulation step does, so the SAP times its incremental sort.
+ */
+typedef struct
+{
+    ne10_uint32_t count;
+    ne10_uint32_t frame;
+    ne10_mat2x2f_t * boxes[2];
+    ne10_physics_pair_t * pairs;
+    ne10_physics_broadphase_t bp;
+} ne10_bench_broadphase_state_t;
+
+#define NE10_BENCH_BROADPHASE_PAIRS 8
+
+static void bench_broadphase_teardown (void * state)
+{
+    ne10_bench_broadphase_state_t * st = (ne10_bench_broadphase_state_t *) state;
+
+    ne10_bench_free (st->boxes[0]);
+    ne10_bench_free (st->boxes[1]);
+    ne10_bench_free (st->pairs);
+    ne10_physics_broadphase_destroy (st->bp);
+    free (st);
+}
+
+static void * bench_broadphase_setup (ne10_uint32_t count, ne10_physics_broadphase_mode_t mode)
+{
+    ne10_bench_broadphase_state_t * st = (ne10_bench_broadphase_state_t *) calloc (1, sizeof (ne10_bench_broadphase_state_t));
+    ne10_float32_t world = 6.0f * sqrtf ( (ne10_float32_t) count);
+    ne10_float32_t * r;
+    ne10_uint32_t i;
+
+    if (st == NULL)
+        return NULL;
+    st->count = count;
+    st->boxes[0] = (ne10_mat2x2f_t *) ne10_bench_alloc (count * sizeof (ne10_mat2x2f_t));
+    st->boxes[1] = (ne10_mat2x2f_t *) ne10_bench_alloc (count * sizeof (ne10_mat2x2f_t));
+    st->pairs = (ne10_physics_pair_t *) ne10_bench_alloc (count * NE10_BENCH_BROADPHASE_PAIRS * sizeof (ne10_physics_pair_t));
+    st->bp = ne10_physics_broadphase_create (count, mode, 4.0f);
+    if (st->boxes[0] == NULL || st->boxes[1] == NULL || st->pairs == NULL || st->bp == NULL)
+    {
+        bench_broadphase_teardown (st);
+        return NULL;
+    }
+
+    // the random values in [0.5, 2) of ne10_bench_alloc, 4 per box
+    r = (ne10_float32_t *) st->boxes[0];
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x = (r[4 * i] - 0.5f) / 1.5f * world;
+        ne10_float32_t y = (r[4 * i + 1] - 0.5f) / 1.5f * world;
+        ne10_float32_t hx = r[4 * i + 2];
+        ne10_float32_t hy = r[4 * i + 3];
+        ne10_float32_t dx = (r[4 * i + 2] - 1.25f) * 0.1f;
+        ne10_float32_t dy = (r[4 * i + 3] - 1.25f) * 0.1f;
+
+        st->boxes[0][i].c1.r1 = x - hx;
+        st->boxes[0][i].c1.r2 = y - hy;
+        st->boxes[0][i].c2.r1 = x + hx;
+        st->boxes[0][i].c2.r2 = y + hy;
+        st->boxes[1][i].c1.r1 = x - hx + dx;
+        st->boxes[1][i].c1.r2 = y - hy + dy;
+        st->boxes[1][i].c2.r1 = x + hx + dx;
+        st->boxes[1][i].c2.r2 = y + hy + dy;
+    }
+    return st;
+}
+
+static void * bench_broadphase_sap_setup (ne10_uint32_t count)
+{
+    return bench_broadphase_setup (count, NE10_PHYSICS_BROADPHASE_SAP);
+}
+
+static void * bench_broadphase_grid_setup (ne10_uint32_t count)
+{
+    return bench_broadphase_setup (count, NE10_PHYSICS_BROADPHASE_GRID);
+}
+
+static void bench_broadphase_find_pairs (void * state)
+{
+    ne10_bench_broadphase_state_t * st = (ne10_bench_broadphase_state_t *) state;
+
+    ne10_physics_broadphase_find_pairs (st->bp, st->pairs, st->count * NE10_BENCH_BROADPHASE_PAIRS,
+                                        st->boxes[st->frame], st->count);
+    st->frame ^= 1;
+}
+
+/*
+ * A step of the contact solver over size contacts between size / 2 bodies,
+ * each touching a few of its neighbours in index order, and the same step
+ * composed of ne10_physics_relative_v_vec2f and ne10_physics_apply_impulse_vec2f
+ * with the impulses computed in between, one contact at a time. Each call
+ * starts from the velocities and impulses left by the previous one.
+ */
+typedef struct
+{
+    ne10_uint32_t count;
+    ne10_uint32_t bodies;
+    ne10_uint32_t * body_a;
+    ne10_uint32_t * body_b;
+    ne10_float32_t * normal;        /* normal_x, normal_y, ra_x, ra_y, rb_x, rb_y, friction, restitution */
+    ne10_float32_t * impulses;      /* normal_impulse, tangent_impulse */
+    ne10_float32_t * masses;        /* normal and tangent masses and velocity bias of the composed step */
+    ne10_vec3f_t * v_w;
+    ne10_vec2f_t * inv_mass;
+    ne10_physics_contacts_t contacts;
+    ne10_physics_solver_t solver;
+} ne10_bench_solver_state_t;
+
+#define NE10_BENCH_SOLVER_ITERATIONS 8
+
+static void bench_solver_teardown (void * state)
+{
+    ne10_bench_solver_state_t * st = (ne10_bench_solver_state_t *) state;
+
+    ne10_bench_free (st->body_a);
+    ne10_bench_free (st->body_b);
+    ne10_bench_free (st->normal);
+    ne10_bench_free (st->impulses);
+    ne10_bench_free (st->masses);
+    ne10_bench_free (st->v_w);
+    ne10_bench_free (st->inv_mass);
+    ne10_physics_solver_destroy (st->solver);
+    free (st);
+}
+
+static void * bench_solver_setup (ne10_uint32_t count)
+{
+    ne10_bench_solver_state_t * st = (ne10_bench_solver_state_t *) calloc (1, sizeof (ne10_bench_solver_state_t));
+    ne10_float32_t * r;
+    ne10_uint32_t i;
+
+    if (st == NULL)
+        return NULL;
+    st->count = count;
+    st->bodies = count / 2;
+    st->body_a = (ne10_uint32_t *) ne10_bench_alloc (count * sizeof (ne10_uint32_t));
+    st->body_b = (ne10_uint32_t *) ne10_bench_alloc (count * sizeof (ne10_uint32_t));
+    st->normal = (ne10_float32_t *) ne10_bench_alloc (8 * count * sizeof (ne10_float32_t));
+    st->impulses = (ne10_float32_t *) ne10_bench_alloc (2 * count * sizeof (ne10_float32_t));
+    st->masses = (ne10_float32_t *) ne10_bench_alloc (3 * count * sizeof (ne10_float32_t));
+    st->v_w = (ne10_vec3f_t *) ne10_bench_alloc (st->bodies * sizeof (ne10_vec3f_t));
+    st->inv_mass = (ne10_vec2f_t *) ne10_bench_alloc (st->bodies * sizeof (ne10_vec2f_t));
+    st->solver = ne10_physics_solver_create (count, st->bodies);
+    if (st->body_a == NULL || st->body_b == NULL || st->normal == NULL || st->impulses == NULL
+            || st->masses == NULL || st->v_w == NULL || st->inv_mass == NULL || st->solver == NULL)
+    {
+        bench_solver_teardown (st);
+        return NULL;
+    }
+
+    // the random values in [0.5, 2) of ne10_bench_alloc
+    r = st->normal;
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t angle = 4.0f * r[8 * i];
+
+        st->body_a[i] = i / 2;
+        st->body_b[i] = (i / 2 + 1 + (ne10_uint32_t) (4.0f * r[8 * i + 1])) % st->bodies;
+        r[8 * i] = cosf (angle);
+        r[8 * i + 1] = sinf (angle);
+        r[8 * i + 2] -= 1.25f;
+        r[8 * i + 3] -= 1.25f;
+        r[8 * i + 4] -= 1.25f;
+        r[8 * i + 5] -= 1.25f;
+        r[8 * i + 6] *= 0.25f;
+        r[8 * i + 7] *= 0.25f;
+    }
+    for (i = 0; i < 2 * count; i++)
+        st->impulses[i] = 0.0f;
+    for (i = 0; i < st->bodies; i++)
+    {
+        st->v_w[i].x -= 1.25f;
+        st->v_w[i].y -= 1.25f;
+        st->v_w[i].z -= 1.25f;
+        if (i % 10 == 0)
+            st->inv_mass[i].x = st->inv_mass[i].y = 0.0f;
+    }
+
+    st->contacts.body_a = st->body_a;
+    st->contacts.body_b = st->body_b;
+    st->contacts.normal_x = r;
+    st->contacts.normal_y = r + count;
+    st->contacts.ra_x = r + 2 * count;
+    st->contacts.ra_y = r + 3 * count;
+    st->contacts.rb_x = r + 4 * count;
+    st->contacts.rb_y = r + 5 * count;
+    st->contacts.friction = r + 6 * count;
+    st->contacts.restitution = r + 7 * count;
+    st->contacts.normal_impulse = st->impulses;
+    st->contacts.tangent_impulse = st->impulses + count;
+    return st;
+}
+
+static void bench_solve_contacts (void * state)
+{
+    ne10_bench_solver_state_t * st = (ne10_bench_solver_state_t *) state;
+
+    ne10_physics_solve_contacts_vec2f (st->solver, st->v_w, st->inv_mass, st->bodies, &st->contacts, st->count,
+                                       NE10_BENCH_SOLVER_ITERATIONS);
+}
+
+static void bench_solve_contacts_composed (void * state)
+{
+    ne10_bench_solver_state_t * st = (ne10_bench_solver_state_t *) state;
+    const ne10_physics_contacts_t * c = &st->contacts;
+    ne10_float32_t * normal_mass = st->masses;
+    ne10_float32_t * tangent_mass = st->masses + st->count;
+    ne10_float32_t * bias = st->masses + 2 * st->count;
+    ne10_uint32_t i, iter;
+
+    for (iter = 0; iter <= NE10_BENCH_SOLVER_ITERATIONS; iter++)
+    {
+        for (i = 0; i < st->count; i++)
+        {
+            ne10_vec3f_t * va = &st->v_w[c->body_a[i]];
+            ne10_vec3f_t * vb = &st->v_w[c->body_b[i]];
+            ne10_vec2f_t * ima = &st->inv_mass[c->body_a[i]];
+            ne10_vec2f_t * imb = &st->inv_mass[c->body_b[i]];
+            ne10_float32_t nx = c->normal_x[i];
+            ne10_float32_t ny = c->normal_y[i];
+            ne10_float32_t pn = c->normal_impulse[i];
+            ne10_float32_t pt = c->tangent_impulse[i];
+            ne10_float32_t lambda, max_f, sum;
+            ne10_vec2f_t ra, rb, dv, p;
+
+            ra.x = c->ra_x[i];
+            ra.y = c->ra_y[i];
+            rb.x = c->rb_x[i];
+            rb.y = c->rb_y[i];
+            if (iter == 0)
+            {
+                // the effective masses and restitution, then the warm start
+                ne10_float32_t rna = ra.x * ny - ra.y * nx;
+                ne10_float32_t rnb = rb.x * ny - rb.y * nx;
+                ne10_float32_t rta = -ra.x * nx - ra.y * ny;
+                ne10_float32_t rtb = -rb.x * nx - rb.y * ny;
+                ne10_float32_t k = ima->x + imb->x + ima->y * rna * rna + imb->y * rnb * rnb;
+
+                normal_mass[i] = (k > 0.0f) ? 1.0f / k : 0.0f;
+                k = ima->x + imb->x + ima->y * rta * rta + imb->y * rtb * rtb;
+                tangent_mass[i] = (k > 0.0f) ? 1.0f / k : 0.0f;
+                ne10_physics_relative_v_vec2f (&dv, va, &ra, vb, &rb, 1);
+                sum = dv.x * nx + dv.y * ny;
+                bias[i] = (sum < -1.0f) ? -c->restitution[i] * sum : 0.0f;
+                p.x = pn * nx + pt * ny;
+                p.y = pn * ny - pt * nx;
+                ne10_physics_apply_impulse_vec2f (va, vb, &ra, &rb, ima, imb, &p, 1);
+                continue;
+            }
+
+            ne10_physics_relative_v_vec2f (&dv, va, &ra, vb, &rb, 1);
+            lambda = -tangent_mass[i] * (dv.x * ny - dv.y * nx);
+            max_f = c->friction[i] * pn;
+            sum = pt + lambda;
+            sum = (sum > -max_f) ? sum : -max_f;
+            sum = (sum < max_f) ? sum : max_f;
+            lambda = sum - pt;
+            c->tangent_impulse[i] = sum;
+            p.x = lambda * ny;
+            p.y = -lambda * nx;
+            ne10_physics_apply_impulse_vec2f (va, vb, &ra, &rb, ima, imb, &p, 1);
+
+            ne10_physics_relative_v_vec2f (&dv, va, &ra, vb, &rb, 1);
+            lambda = -normal_mass[i] * ( (dv.x * nx + dv.y * ny) - bias[i]);
+            sum = pn + lambda;
+            sum = (sum > 0.0f) ? sum : 0.0f;
+            lambda = sum - pn;
+            c->normal_impulse[i] = sum;
+            p.x = lambda * nx;
+            p.y = lambda * ny;
+            ne10_physics_apply_impulse_vec2f (va, vb, &ra, &rb, ima, imb, &p, 1);
+        }
+    }
+}
+
+void ne10_bench_register_physics (void)
+{
+    static const ne10_uint32_t counts[] = { 1024, 65536 };
+    static const ne10_uint32_t bodies[] = { 1000, 10000, 100000 };
+    ne10_bench_case_t c;
+    ne10_uint32_t i, s;
+
+    c.module = "physics";
+    c.setup = bench_physics_setup;
+    c.teardown = bench_physics_teardown;
+    for (i = 0; i < sizeof (bench_physics_functions) / sizeof (bench_physics_functions[0]); i++)
+    {
+        for (s = 0; s < sizeof (counts) / sizeof (counts[0]); s++)
+        {
+            snprintf (c.name, sizeof (c.name), "%s", bench_physics_functions[i].name);
+            c.size = counts[s];
+            c.items = counts[s];
+            c.bytes = counts[s] * bench_physics_functions[i].bytes;
+            c.flops = counts[s] * bench_physics_functions[i].flops;
+            c.run = bench_physics_functions[i].run;
+            ne10_bench_add (&c);
+        }
+    }
+
+    c.setup = bench_aabb_batch_setup;
+    c.teardown = bench_aabb_batch_teardown;
+    for (s = 0; s < sizeof (counts) / sizeof (counts[0]); s++)
+    {
+        c.size = counts[s];
+        c.items = counts[s];
+        c.bytes = counts[s] * (NE10_BENCH_AABB_VERTICES * sizeof (ne10_vec2f_t) + 2 * sizeof (ne10_mat2x2f_t) + sizeof (ne10_vec2f_t));
+        c.flops = counts[s] * NE10_BENCH_AABB_VERTICES * 10;
+
+        snprintf (c.name, sizeof (c.name), "ne10_physics_compute_aabb_batch_vec2f");
+        c.run = bench_aabb_batch;
+        ne10_bench_add (&c);
+
+        snprintf (c.name, sizeof (c.name), "ne10_physics_compute_aabb_vec2f (per shape)");
+        c.run = bench_aabb_per_shape;
+        ne10_bench_add (&c);
+    }
+
+    c.run = bench_broadphase_find_pairs;
+    c.teardown = bench_broadphase_teardown;
+    c.flops = 0;
+    for (s = 0; s < sizeof (bodies) / sizeof (bodies[0]); s++)
+    {
+        c.size = bodies[s];
+        c.items = bodies[s];
+        c.bytes = bodies[s] * sizeof (ne10_mat2x2f_t);
+
+        snprintf (c.name, sizeof (c.name), "ne10_physics_broadphase_find_pairs (sap)");
+        c.setup = bench_broadphase_sap_setup;
+        ne10_bench_add (&c);
+
+        snprintf (c.name, sizeof (c.name), "ne10_physics_broadphase_find_pairs (grid)");
+        c.setup = bench_broadphase_grid_setup;
+        ne10_bench_add (&c);
+    }
+
+    // items are contacts, solved NE10_BENCH_SOLVER_ITERATIONS times each
+    c.setup = bench_solver_setup;
+    c.teardown = bench_solver_teardown;
+    c.flops = 0;
+    for (s = 0; s < sizeof (counts) / sizeof (counts[0]); s++)
+    {
+        c.size = counts[s];
+        c.items = counts[s];
+        c.bytes = counts[s] * (2 * sizeof (ne10_uint32_t) + 10 * sizeof (ne10_float32_t));
+
+        snprintf (c.name, sizeof (c.name), "ne10_physics_solve_contacts_vec2f");
+        c.run = bench_solve_contacts;
+        ne10_bench_add (&c);
+
+        snprintf (c.name, sizeof (c.name), "ne10_physics_solve_contacts_vec2f (composed)");
+        c.run = bench_solve_contacts_composed;
+        ne10_bench_add (&c);
+    }
+}
@@ -30,12 +30,17 @@
  */
 
 #include "seatest.h"
+#include "unit_test_common.h"
 
 void test_fixture_physics (void);
+void test_fixture_broadphase (void);
+void test_fixture_solver (void);
 
 void all_tests (void)
 {
     test_fixture_physics();
+    test_fixture_broadphase();
+    test_fixture_solver();
 }
 
 
@@ -51,7 +56,8 @@ void my_suite_teardown (void)
 
 int main (ne10_int32_t argc, char** argv)
 {
+    ne10_test_init (argc, argv);
     suite_setup (my_suite_setup);
     suite_teardown (my_suite_teardown);
-    return !run_tests (all_tests);
+    return ne10_test_finish (run_tests (all_tests));
 }
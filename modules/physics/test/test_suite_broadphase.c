@@ -0,0 +1,269 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test/test_suite_broadphase.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "NE10_physics.h"
+#include "NE10_init.h"
+#include "NE10_random.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+#define TEST_BODIES 1000
+#define TEST_WORLD 400.0f
+#define TEST_HALF_SIZE 4.0f
+#define TEST_MAX_PAIRS (TEST_BODIES * 32)
+#define TEST_FRAMES 8
+
+typedef ne10_uint32_t (*test_find_pairs_t) (ne10_physics_broadphase_t bp,
+        ne10_physics_pair_t *pairs,
+        ne10_uint32_t max_pairs,
+        const ne10_mat2x2f_t *aabbs,
+        ne10_uint32_t count);
+
+static ne10_mat2x2f_t *boxes = NULL;
+static ne10_physics_pair_t *pairs_ref = NULL;
+static ne10_physics_pair_t *pairs_out = NULL;
+static ne10_float32_t *random_values = NULL;
+
+/* boxes of half sizes in (0, half_size] around centres in [0, world) */
+static void fill_boxes (NE10_philox_t *rng, ne10_mat2x2f_t *dst, ne10_uint32_t count,
+                        ne10_float32_t world, ne10_float32_t half_size)
+{
+    ne10_uint32_t i;
+
+    NE10_philox_fill_float (rng, random_values, 4 * count, 0.0f, 1.0f);
+    for (i = 0; i < count; i++)
+    {
+        ne10_float32_t x = random_values[4 * i] * world;
+        ne10_float32_t y = random_values[4 * i + 1] * world;
+        ne10_float32_t hx = (random_values[4 * i + 2] + 0.01f) * half_size;
+        ne10_float32_t hy = (random_values[4 * i + 3] + 0.01f) * half_size;
+
+        dst[i].c1.r1 = x - hx;
+        dst[i].c1.r2 = y - hy;
+        dst[i].c2.r1 = x + hx;
+        dst[i].c2.r2 = y + hy;
+    }
+}
+
+/* moves every box by up to step along each axis */
+static void move_boxes (NE10_philox_t *rng, ne10_mat2x2f_t *dst, ne10_uint32_t count, ne10_float32_t step)
+{
+    ne10_uint32_t i;
+
+    NE10_philox_fill_float (rng, random_values, 2 * count, -step, step);
+    for (i = 0; i < count; i++)
+    {
+        dst[i].c1.r1 += random_values[2 * i];
+        dst[i].c2.r1 += random_values[2 * i];
+        dst[i].c1.r2 += random_values[2 * i + 1];
+        dst[i].c2.r2 += random_values[2 * i + 1];
+    }
+}
+
+static int compare_pairs (const void *p, const void *q)
+{
+    const ne10_physics_pair_t *a = (const ne10_physics_pair_t *) p;
+    const ne10_physics_pair_t *b = (const ne10_physics_pair_t *) q;
+
+    if (a->a != b->a)
+        return (a->a < b->a) ? -1 : 1;
+    return (a->b < b->b) ? -1 : (a->b > b->b);
+}
+
+/* every pair, sorted */
+static ne10_uint32_t find_pairs_ref (ne10_physics_pair_t *pairs, const ne10_mat2x2f_t *aabbs, ne10_uint32_t count)
+{
+    ne10_uint32_t i, j, n = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        for (j = i + 1; j < count; j++)
+        {
+            if (aabbs[i].c1.r1 <= aabbs[j].c2.r1 && aabbs[j].c1.r1 <= aabbs[i].c2.r1
+                    && aabbs[i].c1.r2 <= aabbs[j].c2.r2 && aabbs[j].c1.r2 <= aabbs[i].c2.r2)
+            {
+                pairs[n].a = i;
+                pairs[n].b = j;
+                n++;
+            }
+        }
+    }
+    return n;
+}
+
+/* the pairs found by find_pairs are those of the reference, each once */
+static void check_pairs (test_find_pairs_t find_pairs, ne10_physics_broadphase_t bp,
+                         const ne10_mat2x2f_t *aabbs, ne10_uint32_t count)
+{
+    ne10_uint32_t n_ref = find_pairs_ref (pairs_ref, aabbs, count);
+    ne10_uint32_t n = find_pairs (bp, pairs_out, TEST_MAX_PAIRS, aabbs, count);
+
+    assert_true (n_ref <= TEST_MAX_PAIRS);
+    assert_int_equal (n_ref, n);
+    qsort (pairs_out, n, sizeof (ne10_physics_pair_t), compare_pairs);
+    assert_true (memcmp (pairs_ref, pairs_out, n * sizeof (ne10_physics_pair_t)) == 0);
+}
+
+/* a few frames of moving boxes, then a shuffle, then one box less */
+static void check_frames (test_find_pairs_t find_pairs, ne10_physics_broadphase_mode_t mode)
+{
+    ne10_physics_broadphase_t bp = ne10_physics_broadphase_create (TEST_BODIES, mode, 2.0f * TEST_HALF_SIZE);
+    NE10_philox_t rng;
+    ne10_uint32_t frame;
+
+    assert_true (bp != NULL);
+    NE10_philox_init_test (&rng);
+    fill_boxes (&rng, boxes, TEST_BODIES, TEST_WORLD, TEST_HALF_SIZE);
+    for (frame = 0; frame < TEST_FRAMES; frame++)
+    {
+        check_pairs (find_pairs, bp, boxes, TEST_BODIES);
+        move_boxes (&rng, boxes, TEST_BODIES, TEST_HALF_SIZE / 4);
+    }
+    fill_boxes (&rng, boxes, TEST_BODIES, TEST_WORLD, TEST_HALF_SIZE);
+    check_pairs (find_pairs, bp, boxes, TEST_BODIES);
+    check_pairs (find_pairs, bp, boxes, TEST_BODIES - 1);
+    check_pairs (find_pairs, bp, boxes + 1, TEST_BODIES - 1);
+
+    // dense: every box overlaps many others, and the pairs do not all fit
+    fill_boxes (&rng, boxes, TEST_BODIES, 4 * TEST_HALF_SIZE, TEST_HALF_SIZE);
+    assert_int_equal (find_pairs_ref (pairs_ref, boxes, TEST_BODIES),
+                      find_pairs (bp, pairs_out, 7, boxes, TEST_BODIES));
+    check_pairs (find_pairs, bp, boxes, 300);
+    ne10_physics_broadphase_destroy (bp);
+}
+
+/* boxes that touch, negative coordinates, boxes covering many grid cells, and the limits */
+static void check_edges (test_find_pairs_t find_pairs, ne10_physics_broadphase_mode_t mode)
+{
+    ne10_physics_broadphase_t bp = ne10_physics_broadphase_create (64, mode, 1.0f);
+    ne10_uint32_t i;
+
+    assert_true (bp != NULL);
+    for (i = 0; i < 64; i++)
+    {
+        ne10_float32_t x = (ne10_float32_t) (i % 8) - 4.0f;
+        ne10_float32_t y = (ne10_float32_t) (i / 8) - 4.0f;
+
+        // a grid of unit squares, each touching its 8 neighbours
+        boxes[i].c1.r1 = x;
+        boxes[i].c1.r2 = y;
+        boxes[i].c2.r1 = x + 1.0f;
+        boxes[i].c2.r2 = y + 1.0f;
+    }
+    check_pairs (find_pairs, bp, boxes, 64);
+
+    // boxes far larger than the cells
+    boxes[5].c1.r1 = -100.0f;
+    boxes[5].c2.r1 = 100.0f;
+    boxes[40].c1.r2 = -3.5f;
+    boxes[40].c2.r2 = 1000.0f;
+    boxes[41] = boxes[40];
+    check_pairs (find_pairs, bp, boxes, 64);
+
+    assert_int_equal (0, find_pairs (bp, pairs_out, TEST_MAX_PAIRS, boxes, 0));
+    assert_int_equal (0, find_pairs (bp, pairs_out, TEST_MAX_PAIRS, boxes, 1));
+    assert_int_equal (0, find_pairs (bp, pairs_out, TEST_MAX_PAIRS, boxes, 65));
+    check_pairs (find_pairs, bp, boxes, 64);
+    ne10_physics_broadphase_destroy (bp);
+}
+
+void test_broadphase_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    static const ne10_physics_broadphase_mode_t modes[] = { NE10_PHYSICS_BROADPHASE_SAP, NE10_PHYSICS_BROADPHASE_GRID };
+    ne10_uint32_t m;
+
+    boxes = (ne10_mat2x2f_t *) NE10_MALLOC (TEST_BODIES * sizeof (ne10_mat2x2f_t));
+    pairs_ref = (ne10_physics_pair_t *) NE10_MALLOC (TEST_BODIES * TEST_BODIES / 2 * sizeof (ne10_physics_pair_t));
+    pairs_out = (ne10_physics_pair_t *) NE10_MALLOC (TEST_MAX_PAIRS * sizeof (ne10_physics_pair_t));
+    random_values = (ne10_float32_t *) NE10_MALLOC (4 * TEST_BODIES * sizeof (ne10_float32_t));
+
+    for (m = 0; m < sizeof (modes) / sizeof (modes[0]); m++)
+    {
+        check_frames (ne10_physics_broadphase_find_pairs_c, modes[m]);
+        check_edges (ne10_physics_broadphase_find_pairs_c, modes[m]);
+#if !defined (NE10_ENABLE_X86)
+        check_frames (ne10_physics_broadphase_find_pairs_neon, modes[m]);
+        check_edges (ne10_physics_broadphase_find_pairs_neon, modes[m]);
+#endif
+        check_frames (ne10_physics_broadphase_find_pairs, modes[m]);
+    }
+
+    NE10_FREE (boxes);
+    NE10_FREE (pairs_ref);
+    NE10_FREE (pairs_out);
+    NE10_FREE (random_values);
+#endif
+}
+
+void test_broadphase_create()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_physics_broadphase_t bp;
+
+    assert_true (ne10_physics_broadphase_create (0, NE10_PHYSICS_BROADPHASE_SAP, 0.0f) == NULL);
+    assert_true (ne10_physics_broadphase_create (16, NE10_PHYSICS_BROADPHASE_GRID, 0.0f) == NULL);
+    assert_true (ne10_physics_broadphase_create (16, NE10_PHYSICS_BROADPHASE_GRID, -1.0f) == NULL);
+    assert_true (ne10_physics_broadphase_create (16, (ne10_physics_broadphase_mode_t) 7, 1.0f) == NULL);
+
+    bp = ne10_physics_broadphase_create (16, NE10_PHYSICS_BROADPHASE_SAP, 0.0f);
+    assert_true (bp != NULL);
+    ne10_physics_broadphase_destroy (bp);
+    ne10_physics_broadphase_destroy (NULL);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_broadphase (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // binds ne10_physics_broadphase_find_pairs
+    ne10_init();
+
+    run_test (test_broadphase_create);          // run tests
+    run_test (test_broadphase_conformance);
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -34,6 +34,7 @@
 #include <math.h>
 
 #include "NE10_physics.h"
+#include "NE10_init.h"
 #include "seatest.h"
 #include "unit_test_common.h"
 
@@ -42,6 +43,10 @@
 ** ------------------------------------------------------------------- */
 #define TEST_LENGTH_SAMPLES 1024
 #define TEST_COUNT 5000
+#define TEST_SHAPES 1001
+#define TEST_POOL_SHAPES 5003
+#define TEST_MAX_VERTICES 12
+#define TEST_POOL_THREADS 4
 
 static ne10_int64_t time_c = 0;
 static ne10_int64_t time_neon = 0;
@@ -164,6 +169,145 @@ void test_compute_aabb_vec2f_performance()
     free (vertices_neon);
 }
 
+/* shapes of 1 to TEST_MAX_VERTICES vertices, in one pool */
+static ne10_uint32_t aabb_batch_assignment (ne10_vec2f_t **vertices,
+        ne10_uint32_t *offsets,
+        ne10_mat2x2f_t *xfs,
+        ne10_vec2f_t *radii,
+        ne10_uint32_t shape_count,
+        ne10_uint32_t vertices_per_shape)
+{
+    ne10_uint32_t i;
+
+    offsets[0] = 0;
+    for (i = 0; i < shape_count; i++)
+    {
+        ne10_float32_t angle = (ne10_float32_t) (drand48() * 64.0f - 32.0f);
+
+        offsets[i + 1] = offsets[i] + ( (vertices_per_shape != 0) ? vertices_per_shape : 1 + (i * 7) % TEST_MAX_VERTICES);
+        xfs[i].c1.r1 = (ne10_float32_t) (drand48() * 16.0f - 8.0f);
+        xfs[i].c1.r2 = (ne10_float32_t) (drand48() * 16.0f - 8.0f);
+        xfs[i].c2.r1 = sin (angle);
+        xfs[i].c2.r2 = cos (angle);
+        radii[i].x = radii[i].y = (ne10_float32_t) drand48();
+    }
+    *vertices = (ne10_vec2f_t*) NE10_MALLOC (offsets[shape_count] * sizeof (ne10_vec2f_t));
+    float_array_assignment ( (ne10_float32_t *) *vertices, offsets[shape_count] * 2);
+    return offsets[shape_count];
+}
+
+static void aabb_batch_loop (ne10_mat2x2f_t *aabbs,
+                             ne10_vec2f_t *vertices,
+                             ne10_uint32_t *offsets,
+                             ne10_mat2x2f_t *xfs,
+                             ne10_vec2f_t *radii,
+                             ne10_uint32_t shape_count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < shape_count; i++)
+        ne10_physics_compute_aabb_vec2f (&aabbs[i], &vertices[offsets[i]], &xfs[i], &radii[i], offsets[i + 1] - offsets[i]);
+}
+
+void test_compute_aabb_batch_vec2f_conformance()
+{
+    ne10_vec2f_t *vertices;
+    ne10_uint32_t *offsets;
+    ne10_mat2x2f_t *xfs, *aabbs_ref, *aabbs;
+    ne10_vec2f_t *radii;
+    ne10_uint32_t count;
+    ne10_int32_t vec_size = sizeof (ne10_mat2x2f_t) / sizeof (ne10_float32_t);
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    /* the C version of each box is the reference */
+    ne10_init();
+    ne10_physics_compute_aabb_vec2f = ne10_physics_compute_aabb_vec2f_c;
+
+    offsets = (ne10_uint32_t*) NE10_MALLOC ( (TEST_POOL_SHAPES + 1) * sizeof (ne10_uint32_t));
+    xfs = (ne10_mat2x2f_t*) NE10_MALLOC (TEST_POOL_SHAPES * sizeof (ne10_mat2x2f_t));
+    radii = (ne10_vec2f_t*) NE10_MALLOC (TEST_POOL_SHAPES * sizeof (ne10_vec2f_t));
+    aabbs_ref = (ne10_mat2x2f_t*) NE10_MALLOC (TEST_POOL_SHAPES * sizeof (ne10_mat2x2f_t));
+    aabbs = (ne10_mat2x2f_t*) NE10_MALLOC ( (TEST_POOL_SHAPES + 1) * sizeof (ne10_mat2x2f_t));
+    aabb_batch_assignment (&vertices, offsets, xfs, radii, TEST_POOL_SHAPES, 0);
+    aabb_batch_loop (aabbs_ref, vertices, offsets, xfs, radii, TEST_POOL_SHAPES);
+
+    for (count = 1; count <= TEST_SHAPES; count += (count < 16) ? 1 : 97)
+    {
+        /* the box after the last must not be written */
+        memset (aabbs, 0xff, (count + 1) * sizeof (ne10_mat2x2f_t));
+        ne10_physics_compute_aabb_batch_vec2f_c (aabbs, vertices, offsets, xfs, radii, count);
+        assert_float_vec_equal ( (ne10_float32_t*) aabbs_ref, (ne10_float32_t*) aabbs, ERROR_MARGIN_SMALL, count * vec_size);
+        assert_int_equal (0xffffffff, ( (ne10_uint32_t*) &aabbs[count])[0]);
+#if !defined (NE10_ENABLE_X86)
+        memset (aabbs, 0xff, (count + 1) * sizeof (ne10_mat2x2f_t));
+        ne10_physics_compute_aabb_batch_vec2f_neon (aabbs, vertices, offsets, xfs, radii, count);
+        assert_float_vec_equal ( (ne10_float32_t*) aabbs_ref, (ne10_float32_t*) aabbs, ERROR_MARGIN_LARGE, count * vec_size);
+        assert_int_equal (0xffffffff, ( (ne10_uint32_t*) &aabbs[count])[0]);
+#endif
+    }
+
+    /* shared out between the threads of the pool */
+    assert_int_equal (NE10_OK, ne10_threadpool_init (TEST_POOL_THREADS, 0));
+    memset (aabbs, 0, TEST_POOL_SHAPES * sizeof (ne10_mat2x2f_t));
+    ne10_physics_compute_aabb_batch_vec2f (aabbs, vertices, offsets, xfs, radii, TEST_POOL_SHAPES);
+    assert_float_vec_equal ( (ne10_float32_t*) aabbs_ref, (ne10_float32_t*) aabbs, ERROR_MARGIN_LARGE, TEST_POOL_SHAPES * vec_size);
+    ne10_threadpool_destroy();
+
+    NE10_FREE (vertices);
+    NE10_FREE (offsets);
+    NE10_FREE (xfs);
+    NE10_FREE (radii);
+    NE10_FREE (aabbs_ref);
+    NE10_FREE (aabbs);
+    ne10_init();
+}
+
+void test_compute_aabb_batch_vec2f_performance()
+{
+    ne10_vec2f_t *vertices;
+    ne10_uint32_t *offsets;
+    ne10_mat2x2f_t *xfs, *aabbs;
+    ne10_vec2f_t *radii;
+    ne10_uint32_t vertex_count;
+    ne10_int32_t i;
+    ne10_int64_t time_loop, time_batch;
+
+    fprintf (stdout, "----------%30s start\n", __FUNCTION__);
+
+    ne10_init();
+    offsets = (ne10_uint32_t*) NE10_MALLOC ( (TEST_SHAPES + 1) * sizeof (ne10_uint32_t));
+    xfs = (ne10_mat2x2f_t*) NE10_MALLOC (TEST_SHAPES * sizeof (ne10_mat2x2f_t));
+    radii = (ne10_vec2f_t*) NE10_MALLOC (TEST_SHAPES * sizeof (ne10_vec2f_t));
+    aabbs = (ne10_mat2x2f_t*) NE10_MALLOC (TEST_SHAPES * sizeof (ne10_mat2x2f_t));
+
+    /* multiples of 4 vertices, which the NEON version of the single polygon needs */
+    for (vertex_count = 4; vertex_count <= 8; vertex_count += 4)
+    {
+        aabb_batch_assignment (&vertices, offsets, xfs, radii, TEST_SHAPES, vertex_count);
+        GET_TIME
+        (time_loop,
+        {
+            for (i = 0; i < TEST_COUNT / 10; i++)
+                aabb_batch_loop (aabbs, vertices, offsets, xfs, radii, TEST_SHAPES);
+        }
+        );
+        GET_TIME
+        (time_batch,
+        {
+            for (i = 0; i < TEST_COUNT / 10; i++)
+                ne10_physics_compute_aabb_batch_vec2f (aabbs, vertices, offsets, xfs, radii, TEST_SHAPES);
+        }
+        );
+        printf ("%d shapes of %d vertices: time per shape: %10lld batch: %10lld\n", TEST_SHAPES, vertex_count, time_loop, time_batch);
+        NE10_FREE (vertices);
+    }
+    NE10_FREE (offsets);
+    NE10_FREE (xfs);
+    NE10_FREE (radii);
+    NE10_FREE (aabbs);
+}
+
 void test_relative_v_vec2f_conformance()
 {
 #if defined ENABLE_NE10_PHYSICS_RELATIVE_V_VEC2F_NEON
@@ -487,6 +631,17 @@ void test_compute_aabb_vec2f()
 #endif
 }
 
+void test_compute_aabb_batch_vec2f()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    test_compute_aabb_batch_vec2f_conformance();
+#endif
+
+#if defined (PERFORMANCE_TEST)
+    test_compute_aabb_batch_vec2f_performance();
+#endif
+}
+
 void test_relative_v_vec2f()
 {
 #if defined (SMOKE_TEST)||(REGRESSION_TEST)
@@ -527,6 +682,7 @@ void test_fixture_physics (void)
     fixture_teardown (my_test_teardown);
 
     run_test (test_compute_aabb_vec2f);       // run tests
+    run_test (test_compute_aabb_batch_vec2f);
     run_test (test_relative_v_vec2f);
     run_test (test_apply_impulse_vec2f);
 
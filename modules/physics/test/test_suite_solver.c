@@ -0,0 +1,533 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test/test_suite_solver.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "NE10_physics.h"
+#include "NE10_init.h"
+#include "NE10_random.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+#define TEST_BODIES 256
+#define TEST_STATIC_BODIES 16
+#define TEST_CONTACTS 2000
+#define TEST_ITERATIONS 8
+#define TEST_TOLERANCE 1e-4f
+
+typedef ne10_result_t (*test_solve_t) (ne10_physics_solver_t solver,
+                                       ne10_vec3f_t *v_w,
+                                       const ne10_vec2f_t *inv_mass,
+                                       ne10_uint32_t body_count,
+                                       ne10_physics_contacts_t *contacts,
+                                       ne10_uint32_t contact_count,
+                                       ne10_uint32_t iterations);
+
+/* one contact of the arrays of contacts_t, and its accumulated impulses */
+typedef struct
+{
+    ne10_uint32_t body_a[TEST_CONTACTS];
+    ne10_uint32_t body_b[TEST_CONTACTS];
+    ne10_float32_t normal_x[TEST_CONTACTS];
+    ne10_float32_t normal_y[TEST_CONTACTS];
+    ne10_float32_t ra_x[TEST_CONTACTS];
+    ne10_float32_t ra_y[TEST_CONTACTS];
+    ne10_float32_t rb_x[TEST_CONTACTS];
+    ne10_float32_t rb_y[TEST_CONTACTS];
+    ne10_float32_t friction[TEST_CONTACTS];
+    ne10_float32_t restitution[TEST_CONTACTS];
+    ne10_float32_t normal_impulse[TEST_CONTACTS];
+    ne10_float32_t tangent_impulse[TEST_CONTACTS];
+} test_contact_arrays_t;
+
+static test_contact_arrays_t *arrays = NULL;
+static ne10_vec3f_t *v_w_init = NULL;
+static ne10_vec3f_t *v_w_ref = NULL;
+static ne10_vec3f_t *v_w_out = NULL;
+static ne10_vec2f_t *inv_mass = NULL;
+static ne10_float32_t *pn_init = NULL;
+static ne10_float32_t *pt_init = NULL;
+
+static void bind_contacts (ne10_physics_contacts_t *contacts)
+{
+    contacts->body_a = arrays->body_a;
+    contacts->body_b = arrays->body_b;
+    contacts->normal_x = arrays->normal_x;
+    contacts->normal_y = arrays->normal_y;
+    contacts->ra_x = arrays->ra_x;
+    contacts->ra_y = arrays->ra_y;
+    contacts->rb_x = arrays->rb_x;
+    contacts->rb_y = arrays->rb_y;
+    contacts->friction = arrays->friction;
+    contacts->restitution = arrays->restitution;
+    contacts->normal_impulse = arrays->normal_impulse;
+    contacts->tangent_impulse = arrays->tangent_impulse;
+}
+
+/* random bodies, the first TEST_STATIC_BODIES static, and random contacts between them */
+static void fill_scene (void)
+{
+    NE10_philox_t rng;
+    ne10_float32_t values[8];
+    ne10_uint32_t pair[2];
+    ne10_uint32_t i;
+
+    NE10_philox_init_test (&rng);
+    for (i = 0; i < TEST_BODIES; i++)
+    {
+        NE10_philox_fill_float (&rng, values, 5, -1.0f, 1.0f);
+        v_w_init[i].x = 5.0f * values[0];
+        v_w_init[i].y = 5.0f * values[1];
+        v_w_init[i].z = 2.0f * values[2];
+        inv_mass[i].x = (i < TEST_STATIC_BODIES) ? 0.0f : 1.5f + values[3];
+        inv_mass[i].y = (i < TEST_STATIC_BODIES) ? 0.0f : 3.0f + 2.0f * values[4];
+    }
+    for (i = 0; i < TEST_CONTACTS; i++)
+    {
+        ne10_float32_t length;
+
+        NE10_philox_fill_uint32 (&rng, pair, 2);
+        arrays->body_a[i] = pair[0] % TEST_BODIES;
+        arrays->body_b[i] = (arrays->body_a[i] + 1 + pair[1] % (TEST_BODIES - 1)) % TEST_BODIES;
+        NE10_philox_fill_float (&rng, values, 8, -1.0f, 1.0f);
+        length = sqrtf (values[0] * values[0] + values[1] * values[1]) + 1e-3f;
+        arrays->normal_x[i] = (values[0] + 1e-3f) / length;
+        arrays->normal_y[i] = values[1] / length;
+        arrays->ra_x[i] = values[2];
+        arrays->ra_y[i] = values[3];
+        arrays->rb_x[i] = values[4];
+        arrays->rb_y[i] = values[5];
+        arrays->friction[i] = 0.5f * (values[6] + 1.0f);
+        arrays->restitution[i] = 0.5f * (values[7] + 1.0f);
+        NE10_philox_fill_float (&rng, values, 2, 0.0f, 1.0f);
+        pn_init[i] = values[0];
+        pt_init[i] = arrays->friction[i] * pn_init[i] * (2.0f * values[1] - 1.0f);
+    }
+}
+
+static void reset_scene (ne10_vec3f_t *v_w)
+{
+    memcpy (v_w, v_w_init, TEST_BODIES * sizeof (ne10_vec3f_t));
+    memcpy (arrays->normal_impulse, pn_init, TEST_CONTACTS * sizeof (ne10_float32_t));
+    memcpy (arrays->tangent_impulse, pt_init, TEST_CONTACTS * sizeof (ne10_float32_t));
+}
+
+static ne10_int32_t is_moving (ne10_uint32_t body)
+{
+    return inv_mass[body].x != 0.0f || inv_mass[body].y != 0.0f;
+}
+
+/* every contact is in one lane, and the lanes of a group share no moving body */
+static void check_batches (const ne10_physics_solver_state_t *solver, ne10_uint32_t contact_count)
+{
+    static ne10_uint8_t seen[TEST_CONTACTS];
+    ne10_uint32_t g, i, j, found = 0;
+
+    memset (seen, 0, sizeof (seen));
+    assert_true (solver->group_count >= (contact_count + 3) / 4);
+    assert_true (solver->group_count <= contact_count);
+    for (g = 0; g < solver->group_count; g++)
+    {
+        const ne10_uint32_t *lane = solver->contact + 4 * g;
+
+        for (i = 0; i < 4; i++)
+        {
+            if (lane[i] == NE10_PHYSICS_SOLVER_NO_CONTACT)
+                continue;
+            assert_true (lane[i] < contact_count);
+            assert_true (seen[lane[i]] == 0);
+            seen[lane[i]] = 1;
+            found++;
+            for (j = i + 1; j < 4; j++)
+            {
+                ne10_uint32_t bodies_i[2], bodies_j[2], m, n;
+
+                if (lane[j] == NE10_PHYSICS_SOLVER_NO_CONTACT)
+                    continue;
+                bodies_i[0] = arrays->body_a[lane[i]];
+                bodies_i[1] = arrays->body_b[lane[i]];
+                bodies_j[0] = arrays->body_a[lane[j]];
+                bodies_j[1] = arrays->body_b[lane[j]];
+                for (m = 0; m < 2; m++)
+                    for (n = 0; n < 2; n++)
+                        assert_true (bodies_i[m] != bodies_j[n] || !is_moving (bodies_i[m]));
+            }
+        }
+    }
+    assert_int_equal (contact_count, found);
+}
+
+/*
+ * The solver step composed of the building blocks: the contacts one at a
+ * time, in the order of the solver's lanes, with the impulses computed in
+ * scalar code between ne10_physics_relative_v_vec2f_c and
+ * ne10_physics_apply_impulse_vec2f_c.
+ */
+static void solve_ref (const ne10_physics_solver_state_t *solver, ne10_vec3f_t *v_w,
+                       ne10_float32_t *pn, ne10_float32_t *pt, ne10_uint32_t iterations)
+{
+    static ne10_float32_t normal_mass[TEST_CONTACTS], tangent_mass[TEST_CONTACTS], bias[TEST_CONTACTS];
+    ne10_uint32_t i, iter;
+
+    for (i = 0; i < 4 * solver->group_count; i++)
+    {
+        ne10_uint32_t c = solver->contact[i];
+        ne10_vec2f_t ra, rb, n, dv, ima, imb;
+        ne10_float32_t rna, rnb, rta, rtb, k, vn;
+
+        if (c == NE10_PHYSICS_SOLVER_NO_CONTACT)
+            continue;
+        ima = inv_mass[arrays->body_a[c]];
+        imb = inv_mass[arrays->body_b[c]];
+
+        ra.x = arrays->ra_x[c];
+        ra.y = arrays->ra_y[c];
+        rb.x = arrays->rb_x[c];
+        rb.y = arrays->rb_y[c];
+        n.x = arrays->normal_x[c];
+        n.y = arrays->normal_y[c];
+        rna = ra.x * n.y - ra.y * n.x;
+        rnb = rb.x * n.y - rb.y * n.x;
+        rta = -ra.x * n.x - ra.y * n.y;
+        rtb = -rb.x * n.x - rb.y * n.y;
+        k = ima.x + imb.x + ima.y * rna * rna + imb.y * rnb * rnb;
+        normal_mass[c] = (k > 0.0f) ? 1.0f / k : 0.0f;
+        k = ima.x + imb.x + ima.y * rta * rta + imb.y * rtb * rtb;
+        tangent_mass[c] = (k > 0.0f) ? 1.0f / k : 0.0f;
+        ne10_physics_relative_v_vec2f_c (&dv, &v_w[arrays->body_a[c]], &ra, &v_w[arrays->body_b[c]], &rb, 1);
+        vn = dv.x * n.x + dv.y * n.y;
+        bias[c] = (vn < -1.0f) ? -arrays->restitution[c] * vn : 0.0f;
+    }
+
+    for (iter = 0; iter <= iterations; iter++)
+    {
+        for (i = 0; i < 4 * solver->group_count; i++)
+        {
+            ne10_uint32_t c = solver->contact[i];
+            ne10_vec3f_t *va, *vb;
+            ne10_vec2f_t ra, rb, ima, imb, p, dv;
+            ne10_float32_t nx, ny, lambda, max_f, sum;
+
+            if (c == NE10_PHYSICS_SOLVER_NO_CONTACT)
+                continue;
+            va = &v_w[arrays->body_a[c]];
+            vb = &v_w[arrays->body_b[c]];
+            ima = inv_mass[arrays->body_a[c]];
+            imb = inv_mass[arrays->body_b[c]];
+            ra.x = arrays->ra_x[c];
+            ra.y = arrays->ra_y[c];
+            rb.x = arrays->rb_x[c];
+            rb.y = arrays->rb_y[c];
+            nx = arrays->normal_x[c];
+            ny = arrays->normal_y[c];
+
+            if (iter == 0)
+            {
+                // warm start
+                p.x = pn[c] * nx + pt[c] * ny;
+                p.y = pn[c] * ny - pt[c] * nx;
+                ne10_physics_apply_impulse_vec2f_c (va, vb, &ra, &rb, &ima, &imb, &p, 1);
+                continue;
+            }
+
+            ne10_physics_relative_v_vec2f_c (&dv, va, &ra, vb, &rb, 1);
+            lambda = -tangent_mass[c] * (dv.x * ny - dv.y * nx);
+            max_f = arrays->friction[c] * pn[c];
+            sum = pt[c] + lambda;
+            sum = (sum > -max_f) ? sum : -max_f;
+            sum = (sum < max_f) ? sum : max_f;
+            lambda = sum - pt[c];
+            pt[c] = sum;
+            p.x = lambda * ny;
+            p.y = -lambda * nx;
+            ne10_physics_apply_impulse_vec2f_c (va, vb, &ra, &rb, &ima, &imb, &p, 1);
+
+            ne10_physics_relative_v_vec2f_c (&dv, va, &ra, vb, &rb, 1);
+            lambda = -normal_mass[c] * ( (dv.x * nx + dv.y * ny) - bias[c]);
+            sum = pn[c] + lambda;
+            sum = (sum > 0.0f) ? sum : 0.0f;
+            lambda = sum - pn[c];
+            pn[c] = sum;
+            p.x = lambda * nx;
+            p.y = lambda * ny;
+            ne10_physics_apply_impulse_vec2f_c (va, vb, &ra, &rb, &ima, &imb, &p, 1);
+        }
+    }
+}
+
+static ne10_int32_t nearly_equal (ne10_float32_t expected, ne10_float32_t actual)
+{
+    ne10_float32_t scale = fabsf (expected) > 1.0f ? fabsf (expected) : 1.0f;
+
+    return fabsf (expected - actual) <= TEST_TOLERANCE * scale;
+}
+
+/* the step of solve against the composed one */
+static void check_step (test_solve_t solve, ne10_physics_solver_t solver)
+{
+    ne10_physics_contacts_t contacts;
+    static ne10_float32_t pn_ref[TEST_CONTACTS], pt_ref[TEST_CONTACTS];
+    ne10_uint32_t i;
+
+    bind_contacts (&contacts);
+    reset_scene (v_w_out);
+    assert_int_equal (NE10_OK, solve (solver, v_w_out, inv_mass, TEST_BODIES, &contacts, TEST_CONTACTS, TEST_ITERATIONS));
+    check_batches (solver, TEST_CONTACTS);
+
+    memcpy (v_w_ref, v_w_init, TEST_BODIES * sizeof (ne10_vec3f_t));
+    memcpy (pn_ref, pn_init, sizeof (pn_ref));
+    memcpy (pt_ref, pt_init, sizeof (pt_ref));
+    solve_ref (solver, v_w_ref, pn_ref, pt_ref, TEST_ITERATIONS);
+
+    for (i = 0; i < TEST_BODIES; i++)
+    {
+        assert_true (nearly_equal (v_w_ref[i].x, v_w_out[i].x));
+        assert_true (nearly_equal (v_w_ref[i].y, v_w_out[i].y));
+        assert_true (nearly_equal (v_w_ref[i].z, v_w_out[i].z));
+    }
+    for (i = 0; i < TEST_CONTACTS; i++)
+    {
+        assert_true (nearly_equal (pn_ref[i], arrays->normal_impulse[i]));
+        assert_true (nearly_equal (pt_ref[i], arrays->tangent_impulse[i]));
+        assert_true (arrays->normal_impulse[i] >= 0.0f);
+    }
+}
+
+/* the random scene, then the same contacts between 2 static and 4 moving bodies, which fill few lanes */
+static void check_random_scene (test_solve_t solve)
+{
+    ne10_physics_solver_t solver = ne10_physics_solver_create (TEST_CONTACTS, TEST_BODIES);
+    ne10_uint32_t i;
+
+    assert_true (solver != NULL);
+    fill_scene ();
+    check_step (solve, solver);
+    for (i = 0; i < TEST_CONTACTS; i++)
+    {
+        ne10_uint32_t a = arrays->body_a[i] % 6;
+
+        arrays->body_b[i] = TEST_STATIC_BODIES - 2 + (a + 1 + arrays->body_b[i] % 5) % 6;
+        arrays->body_a[i] = TEST_STATIC_BODIES - 2 + a;
+    }
+    check_step (solve, solver);
+    ne10_physics_solver_destroy (solver);
+}
+
+/* a contact between a static ground, body 0, and body 1 above it, of unit mass and no rotation */
+static void set_ground_contact (ne10_uint32_t c, ne10_float32_t x, ne10_float32_t friction, ne10_float32_t restitution)
+{
+    arrays->body_a[c] = 0;
+    arrays->body_b[c] = 1;
+    arrays->normal_x[c] = 0.0f;
+    arrays->normal_y[c] = 1.0f;
+    arrays->ra_x[c] = x;
+    arrays->ra_y[c] = 0.0f;
+    arrays->rb_x[c] = x;
+    arrays->rb_y[c] = -0.5f;
+    arrays->friction[c] = friction;
+    arrays->restitution[c] = restitution;
+    arrays->normal_impulse[c] = 0.0f;
+    arrays->tangent_impulse[c] = 0.0f;
+}
+
+/* resting, bouncing, sliding and separating bodies */
+static void check_ground (test_solve_t solve)
+{
+    ne10_physics_solver_t solver = ne10_physics_solver_create (4, 2);
+    ne10_physics_contacts_t contacts;
+    ne10_vec3f_t v_w[2];
+    ne10_vec2f_t im[2] = { { 0.0f, 0.0f }, { 1.0f, 0.0f } };
+
+    assert_true (solver != NULL);
+    bind_contacts (&contacts);
+    memset (v_w, 0, sizeof (v_w));
+
+    // a box resting on two corners after a step of gravity: the contacts stop it
+    set_ground_contact (0, -0.5f, 0.5f, 0.0f);
+    set_ground_contact (1, 0.5f, 0.5f, 0.0f);
+    v_w[1].y = -0.2f;
+    assert_int_equal (NE10_OK, solve (solver, v_w, im, 2, &contacts, 2, 10));
+    assert_true (fabsf (v_w[1].y) < 1e-5f);
+    assert_true (fabsf (arrays->normal_impulse[0] + arrays->normal_impulse[1] - 0.2f) < 1e-5f);
+    // next step, the impulses of the previous one stop it without iterating
+    v_w[1].y = -0.2f;
+    assert_int_equal (NE10_OK, solve (solver, v_w, im, 2, &contacts, 2, 0));
+    assert_true (fabsf (v_w[1].y) < 1e-5f);
+
+    // bounces above the threshold only
+    set_ground_contact (0, 0.0f, 0.0f, 0.5f);
+    v_w[1].x = 0.0f;
+    v_w[1].y = -10.0f;
+    assert_int_equal (NE10_OK, solve (solver, v_w, im, 2, &contacts, 1, 4));
+    assert_true (fabsf (v_w[1].y - 5.0f) < 1e-4f);
+    arrays->normal_impulse[0] = 0.0f;
+    v_w[1].y = -0.5f;
+    assert_int_equal (NE10_OK, solve (solver, v_w, im, 2, &contacts, 1, 4));
+    assert_true (fabsf (v_w[1].y) < 1e-5f);
+
+    // sliding: friction takes at most its coefficient times the normal impulse
+    set_ground_contact (0, 0.0f, 0.2f, 0.0f);
+    arrays->rb_y[0] = 0.0f;
+    v_w[1].x = 10.0f;
+    v_w[1].y = -1.0f;
+    assert_int_equal (NE10_OK, solve (solver, v_w, im, 2, &contacts, 1, 4));
+    assert_true (fabsf (v_w[1].x - 9.8f) < 1e-5f);
+    assert_true (fabsf (v_w[1].y) < 1e-5f);
+    assert_true (fabsf (arrays->tangent_impulse[0] + 0.2f) < 1e-5f);
+
+    // separating: no impulse
+    set_ground_contact (0, 0.0f, 0.2f, 0.0f);
+    v_w[1].x = 1.0f;
+    v_w[1].y = 3.0f;
+    assert_int_equal (NE10_OK, solve (solver, v_w, im, 2, &contacts, 1, 4));
+    assert_true (v_w[1].x == 1.0f && v_w[1].y == 3.0f && v_w[1].z == 0.0f);
+    assert_true (arrays->normal_impulse[0] == 0.0f && arrays->tangent_impulse[0] == 0.0f);
+
+    // the limits of the solver, which leave everything unchanged
+    arrays->body_b[0] = 2;
+    assert_int_equal (NE10_ERR, solve (solver, v_w, im, 2, &contacts, 1, 4));
+    arrays->body_b[0] = 1;
+    assert_int_equal (NE10_ERR, solve (solver, v_w, im, 3, &contacts, 1, 4));
+    assert_int_equal (NE10_ERR, solve (solver, v_w, im, 2, &contacts, 5, 4));
+    assert_true (v_w[1].x == 1.0f && v_w[1].y == 3.0f);
+    assert_int_equal (NE10_OK, solve (solver, v_w, im, 2, &contacts, 0, 4));
+    assert_int_equal (0, solver->group_count);
+    ne10_physics_solver_destroy (solver);
+}
+
+/* contacts that all share a moving body take a group each; a static one does not count */
+static void check_shared (test_solve_t solve)
+{
+    ne10_physics_solver_t solver = ne10_physics_solver_create (40, 41);
+    ne10_physics_contacts_t contacts;
+    ne10_uint32_t i;
+
+    assert_true (solver != NULL);
+    bind_contacts (&contacts);
+    for (i = 0; i < 40; i++)
+    {
+        set_ground_contact (i, 0.0f, 0.5f, 0.0f);
+        arrays->body_a[i] = 0;
+        arrays->body_b[i] = i + 1;
+        v_w_out[i + 1].x = v_w_out[i + 1].y = v_w_out[i + 1].z = 0.0f;
+        inv_mass[i + 1].x = inv_mass[i + 1].y = 1.0f;
+    }
+    v_w_out[0].x = v_w_out[0].y = v_w_out[0].z = 0.0f;
+    inv_mass[0].x = inv_mass[0].y = 0.0f;
+    assert_int_equal (NE10_OK, solve (solver, v_w_out, inv_mass, 41, &contacts, 40, 1));
+    assert_int_equal (10, solver->group_count);
+    check_batches (solver, 40);
+
+    inv_mass[0].x = 1.0f;
+    assert_int_equal (NE10_OK, solve (solver, v_w_out, inv_mass, 41, &contacts, 40, 1));
+    assert_int_equal (40, solver->group_count);
+    check_batches (solver, 40);
+    ne10_physics_solver_destroy (solver);
+}
+
+void test_solver_conformance()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    static const test_solve_t solves[] =
+    {
+        ne10_physics_solve_contacts_vec2f_c,
+#if !defined (NE10_ENABLE_X86)
+        ne10_physics_solve_contacts_vec2f_neon,
+#endif
+    };
+    ne10_uint32_t s;
+
+    arrays = (test_contact_arrays_t *) NE10_MALLOC (sizeof (test_contact_arrays_t));
+    v_w_init = (ne10_vec3f_t *) NE10_MALLOC (TEST_BODIES * sizeof (ne10_vec3f_t));
+    v_w_ref = (ne10_vec3f_t *) NE10_MALLOC (TEST_BODIES * sizeof (ne10_vec3f_t));
+    v_w_out = (ne10_vec3f_t *) NE10_MALLOC (TEST_BODIES * sizeof (ne10_vec3f_t));
+    inv_mass = (ne10_vec2f_t *) NE10_MALLOC (TEST_BODIES * sizeof (ne10_vec2f_t));
+    pn_init = (ne10_float32_t *) NE10_MALLOC (TEST_CONTACTS * sizeof (ne10_float32_t));
+    pt_init = (ne10_float32_t *) NE10_MALLOC (TEST_CONTACTS * sizeof (ne10_float32_t));
+
+    for (s = 0; s < sizeof (solves) / sizeof (solves[0]); s++)
+    {
+        check_random_scene (solves[s]);
+        check_ground (solves[s]);
+        check_shared (solves[s]);
+    }
+    check_random_scene (ne10_physics_solve_contacts_vec2f);
+
+    NE10_FREE (arrays);
+    NE10_FREE (v_w_init);
+    NE10_FREE (v_w_ref);
+    NE10_FREE (v_w_out);
+    NE10_FREE (inv_mass);
+    NE10_FREE (pn_init);
+    NE10_FREE (pt_init);
+#endif
+}
+
+void test_solver_create()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_physics_solver_t solver;
+
+    assert_true (ne10_physics_solver_create (0, 16) == NULL);
+    assert_true (ne10_physics_solver_create (16, 0) == NULL);
+
+    solver = ne10_physics_solver_create (16, 16);
+    assert_true (solver != NULL);
+    assert_int_equal (0, solver->group_count);
+    ne10_physics_solver_destroy (solver);
+    ne10_physics_solver_destroy (NULL);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_solver (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // binds ne10_physics_solve_contacts_vec2f
+    ne10_init();
+
+    run_test (test_solver_create);      // run tests
+    run_test (test_solver_conformance);
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_init.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "NE10.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Test cases
+** ------------------------------------------------------------------- */
+
+/*
+ * Each row gives a set of capability bits and the features and implementations that
+ * ne10_init_features must select for them. The pointers are only compared, never called,
+ * so the rows can describe CPUs other than the running one.
+ */
+typedef enum
+{
+    TEST_IMPL_C,
+    TEST_IMPL_SIMD,     // NEON on ARM, SSE4.1 on x86
+    TEST_IMPL_AVX2
+} test_impl_t;
+
+typedef struct
+{
+    const char *name;
+    ne10_uint64_t hwcap;
+    ne10_cpu_features_t expected;
+    test_impl_t impl;
+} test_dispatch_t;
+
+#define TEST_FEATURES(neon, asimd, sse41, avx2) \
+    { neon, asimd, sse41, avx2 }
+
+#if defined (NE10_ENABLE_X86)
+// The x86 features come from cpuid rather than capability bits; the rows give them directly
+static const test_dispatch_t test_dispatch_table[] =
+{
+    { "none", 0, TEST_FEATURES (0, 0, 0, 0), TEST_IMPL_C },
+    { "sse4.1", 0, TEST_FEATURES (0, 0, 1, 0), TEST_IMPL_SIMD },
+    { "sse4.1 avx2", 0, TEST_FEATURES (0, 0, 1, 1), TEST_IMPL_AVX2 },
+    { "avx2", 0, TEST_FEATURES (0, 0, 0, 1), TEST_IMPL_AVX2 },
+};
+#elif defined (__aarch64__)
+// The other bits are HWCAP_CRC32, HWCAP_ASIMDHP, HWCAP_ASIMDDP and HWCAP_SVE, which are ignored
+#define TEST_HWCAP_OTHERS ( (1ULL << 7) | (1ULL << 10) | (1ULL << 20) | (1ULL << 22))
+static const test_dispatch_t test_dispatch_table[] =
+{
+    { "none", 0, TEST_FEATURES (0, 0, 0, 0), TEST_IMPL_C },
+    { "asimd", NE10_HWCAP_ASIMD, TEST_FEATURES (1, 1, 0, 0), TEST_IMPL_SIMD },
+    { "asimd and others", NE10_HWCAP_ASIMD | TEST_HWCAP_OTHERS, TEST_FEATURES (1, 1, 0, 0), TEST_IMPL_SIMD },
+    { "others", TEST_HWCAP_OTHERS, TEST_FEATURES (0, 0, 0, 0), TEST_IMPL_C },
+};
+#else
+// The other bits are HWCAP_VFPv4, HWCAP_IDIVA, HWCAP_ASIMDHP and HWCAP_ASIMDDP, which are ignored
+#define TEST_HWCAP_OTHERS ( (1ULL << 16) | (1ULL << 17) | (1ULL << 23) | (1ULL << 24))
+static const test_dispatch_t test_dispatch_table[] =
+{
+    { "none", 0, TEST_FEATURES (0, 0, 0, 0), TEST_IMPL_C },
+    { "neon", NE10_HWCAP_NEON, TEST_FEATURES (1, 0, 0, 0), TEST_IMPL_SIMD },
+    { "neon and others", NE10_HWCAP_NEON | TEST_HWCAP_OTHERS, TEST_FEATURES (1, 0, 0, 0), TEST_IMPL_SIMD },
+    { "others", TEST_HWCAP_OTHERS, TEST_FEATURES (0, 0, 0, 0), TEST_IMPL_C },
+};
+#endif
+
+#define TEST_DISPATCH_COUNT (sizeof (test_dispatch_table) / sizeof (test_dispatch_table[0]))
+
+static void assert_features_equal (const ne10_cpu_features_t *expected, const ne10_cpu_features_t *actual)
+{
+    assert_int_equal (expected->neon, actual->neon);
+    assert_int_equal (expected->asimd, actual->asimd);
+    assert_int_equal (expected->sse41, actual->sse41);
+    assert_int_equal (expected->avx2, actual->avx2);
+}
+
+#if !defined (NE10_ENABLE_TRACE)
+#if defined (NE10_ENABLE_X86)
+#define assert_dispatch(ptr, fn, impl) \
+    assert_true ((void *) (ptr) == ((impl) == TEST_IMPL_AVX2 ? (void *) fn##_avx2 \
+                                  : (impl) == TEST_IMPL_SIMD ? (void *) fn##_sse : (void *) fn##_c))
+#else
+#define assert_dispatch(ptr, fn, impl) \
+    assert_true ((void *) (ptr) == ((impl) == TEST_IMPL_SIMD ? (void *) fn##_neon : (void *) fn##_c))
+#endif
+#else
+// The traced builds bind wrappers, so only the features are checked
+#define assert_dispatch(ptr, fn, impl)
+#endif
+
+void test_init_dispatch()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_cpu_features_t features;
+    ne10_uint32_t i;
+
+    for (i = 0; i < TEST_DISPATCH_COUNT; i++)
+    {
+        const test_dispatch_t *row = &test_dispatch_table[i];
+
+        fprintf (stdout, "%-30s %s\n", "dispatch", row->name);
+#if defined (NE10_ENABLE_X86)
+        features = row->expected;
+#else
+        ne10_cpu_features_from_hwcap (&features, row->hwcap);
+        assert_features_equal (&row->expected, &features);
+#endif
+        assert_int_equal (NE10_OK, ne10_init_features (&features));
+        assert_features_equal (&row->expected, ne10_get_cpu_features ());
+        assert_int_equal (row->expected.neon ? NE10_OK : NE10_ERR, ne10_HasNEON ());
+        assert_int_equal (row->expected.sse41 ? NE10_OK : NE10_ERR, ne10_HasSSE41 ());
+        assert_int_equal (row->expected.avx2 ? NE10_OK : NE10_ERR, ne10_HasAVX2 ());
+
+#if defined (NE10_ENABLE_MATH)
+        assert_dispatch (ne10_add_float, ne10_add_float, row->impl);
+        assert_dispatch (ne10_vmul_vec4f, ne10_vmul_vec4f, row->impl);
+        assert_dispatch (ne10_sgemm, ne10_sgemm, row->impl);
+        assert_dispatch (ne10_exp_float, ne10_exp_float, row->impl);
+        assert_dispatch (ne10_sum_float, ne10_sum_float, row->impl);
+        assert_dispatch (ne10_cmul_float32, ne10_cmul_float32, row->impl);
+#endif // NE10_ENABLE_MATH
+    }
+
+    // The other suites run on the detected features
+    assert_int_equal (NE10_OK, ne10_init ());
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_init (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    run_test (test_init_dispatch);      // run tests
+
+    test_fixture_end();                 // ends a fixture
+}
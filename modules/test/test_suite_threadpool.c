@@ -0,0 +1,295 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_threadpool.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "NE10.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define TEST_THREADS 4
+
+/* more tasks than a worker queue holds, so that some of them run inline */
+#define TEST_TASKS 3000
+#define TEST_NESTED_TASKS 16
+
+#define TEST_RANGE_BEGIN 3
+#define TEST_RANGE_END 20011
+
+/* several row blocks of NE10_SGEMM_MC rows and two steps along k */
+#define TEST_SGEMM_M 700
+#define TEST_SGEMM_N 40
+#define TEST_SGEMM_K 300
+
+/* several ranges of NE10_AABB_BATCH_GRAIN polygons */
+#define TEST_AABB_SHAPES 3000
+
+static ne10_uint32_t task_runs[TEST_TASKS];
+static ne10_task_t tasks[TEST_TASKS];
+static ne10_uint8_t range_hits[TEST_RANGE_END];
+static ne10_uint32_t max_slot = 0;
+
+static void count_task (void *arg)
+{
+    __atomic_add_fetch ( (ne10_uint32_t *) arg, 1, __ATOMIC_RELAXED);
+}
+
+static void count_range (ne10_uint32_t begin, ne10_uint32_t end, ne10_uint32_t slot, void *arg)
+{
+    ne10_uint32_t i, seen;
+
+    (void) arg;
+    for (i = begin; i < end; i++)
+    {
+        __atomic_add_fetch (&range_hits[i], 1, __ATOMIC_RELAXED);
+    }
+    seen = __atomic_load_n (&max_slot, __ATOMIC_RELAXED);
+    while (slot > seen && !__atomic_compare_exchange_n (&max_slot, &seen, slot, 1,
+            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+}
+
+/* A task that queues a group of its own from a worker, then a parallel loop */
+static void nested_task (void *arg)
+{
+    ne10_uint32_t first = (ne10_uint32_t) (uintptr_t) arg * (TEST_TASKS / TEST_NESTED_TASKS);
+    ne10_task_group_t group;
+    ne10_uint32_t i;
+
+    ne10_task_group_init (&group);
+    for (i = first; i < first + TEST_TASKS / TEST_NESTED_TASKS; i++)
+    {
+        ne10_task_group_run (&group, &tasks[i], count_task, &task_runs[i]);
+    }
+    ne10_task_group_wait (&group);
+}
+
+static ne10_int32_t check_range (void)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < TEST_RANGE_END; i++)
+    {
+        if (range_hits[i] != (i >= TEST_RANGE_BEGIN))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static ne10_int32_t check_tasks (ne10_uint32_t count)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (task_runs[i] != 1)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* ----------------------------------------------------------------------
+** Test cases
+** ------------------------------------------------------------------- */
+
+void test_threadpool_inline()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_task_group_t group;
+    ne10_uint32_t runs = 0;
+
+    // Without the pool, tasks run as they are queued
+    ne10_threadpool_destroy ();
+    assert_int_equal (1, ne10_threadpool_size ());
+    ne10_task_group_init (&group);
+    ne10_task_group_run (&group, &tasks[0], count_task, &runs);
+    assert_int_equal (1, runs);
+    ne10_task_group_wait (&group);
+
+    memset (range_hits, 0, sizeof (range_hits));
+    max_slot = 0;
+    ne10_parallel_for (TEST_RANGE_BEGIN, TEST_RANGE_END, 100, count_range, NULL);
+    assert_true (check_range ());
+    assert_int_equal (0, max_slot);
+#endif
+}
+
+void test_threadpool_tasks()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    ne10_task_group_t group;
+    ne10_task_t nested[TEST_NESTED_TASKS];
+    ne10_uint32_t i, grain;
+
+    assert_int_equal (NE10_OK, ne10_threadpool_init (TEST_THREADS, 0));
+    assert_int_equal (TEST_THREADS, ne10_threadpool_size ());
+    assert_int_equal (NE10_ERR, ne10_threadpool_init (TEST_THREADS, 0));
+
+    // From a thread that is not a worker
+    memset (task_runs, 0, sizeof (task_runs));
+    ne10_task_group_init (&group);
+    for (i = 0; i < TEST_TASKS; i++)
+    {
+        ne10_task_group_run (&group, &tasks[i], count_task, &task_runs[i]);
+    }
+    ne10_task_group_wait (&group);
+    assert_true (check_tasks (TEST_TASKS));
+
+    // From the workers, which queue on their own deques
+    memset (task_runs, 0, sizeof (task_runs));
+    ne10_task_group_init (&group);
+    for (i = 0; i < TEST_NESTED_TASKS; i++)
+    {
+        ne10_task_group_run (&group, &nested[i], nested_task, (void *) (uintptr_t) i);
+    }
+    ne10_task_group_wait (&group);
+    assert_true (check_tasks (TEST_TASKS / TEST_NESTED_TASKS * TEST_NESTED_TASKS));
+
+    for (grain = 1; grain <= 10000; grain *= 10)
+    {
+        memset (range_hits, 0, sizeof (range_hits));
+        max_slot = 0;
+        ne10_parallel_for (TEST_RANGE_BEGIN, TEST_RANGE_END, grain, count_range, NULL);
+        assert_true (check_range ());
+        assert_true (max_slot < TEST_THREADS);
+    }
+
+    ne10_threadpool_destroy ();
+    assert_int_equal (1, ne10_threadpool_size ());
+
+    // Pinned to the first CPU
+    assert_int_equal (NE10_OK, ne10_threadpool_init (2, 1));
+    memset (range_hits, 0, sizeof (range_hits));
+    ne10_parallel_for (TEST_RANGE_BEGIN, TEST_RANGE_END, 10, count_range, NULL);
+    assert_true (check_range ());
+    ne10_threadpool_destroy ();
+#endif
+}
+
+void test_threadpool_sgemm()
+{
+#if defined (NE10_ENABLE_MATH) && (defined (SMOKE_TEST)||(REGRESSION_TEST))
+    ne10_float32_t *a = (ne10_float32_t *) malloc (TEST_SGEMM_M * TEST_SGEMM_K * sizeof (ne10_float32_t));
+    ne10_float32_t *b = (ne10_float32_t *) malloc (TEST_SGEMM_K * TEST_SGEMM_N * sizeof (ne10_float32_t));
+    ne10_float32_t *c_inline = (ne10_float32_t *) malloc (TEST_SGEMM_M * TEST_SGEMM_N * sizeof (ne10_float32_t));
+    ne10_float32_t *c_pool = (ne10_float32_t *) malloc (TEST_SGEMM_M * TEST_SGEMM_N * sizeof (ne10_float32_t));
+
+    FILL_FLOAT_ARRAY (a, TEST_SGEMM_M * TEST_SGEMM_K);
+    FILL_FLOAT_ARRAY (b, TEST_SGEMM_K * TEST_SGEMM_N);
+    FILL_FLOAT_ARRAY (c_inline, TEST_SGEMM_M * TEST_SGEMM_N);
+    memcpy (c_pool, c_inline, TEST_SGEMM_M * TEST_SGEMM_N * sizeof (ne10_float32_t));
+
+    // The row blocks are the same whichever thread computes them, so the results are identical
+    assert_int_equal (NE10_OK, ne10_sgemm (NE10_NO_TRANSPOSE, NE10_NO_TRANSPOSE, TEST_SGEMM_M, TEST_SGEMM_N, TEST_SGEMM_K,
+                                           0.5f, a, TEST_SGEMM_M, b, TEST_SGEMM_K, 2.0f, c_inline, TEST_SGEMM_M));
+    assert_int_equal (NE10_OK, ne10_threadpool_init (TEST_THREADS, 0));
+    assert_int_equal (NE10_OK, ne10_sgemm (NE10_NO_TRANSPOSE, NE10_NO_TRANSPOSE, TEST_SGEMM_M, TEST_SGEMM_N, TEST_SGEMM_K,
+                                           0.5f, a, TEST_SGEMM_M, b, TEST_SGEMM_K, 2.0f, c_pool, TEST_SGEMM_M));
+    ne10_threadpool_destroy ();
+    assert_true (memcmp (c_inline, c_pool, TEST_SGEMM_M * TEST_SGEMM_N * sizeof (ne10_float32_t)) == 0);
+
+    free (a);
+    free (b);
+    free (c_inline);
+    free (c_pool);
+#endif
+}
+
+void test_threadpool_aabb_batch()
+{
+#if defined (NE10_ENABLE_PHYSICS) && (defined (SMOKE_TEST)||(REGRESSION_TEST))
+    ne10_uint32_t *offsets = (ne10_uint32_t *) malloc ( (TEST_AABB_SHAPES + 1) * sizeof (ne10_uint32_t));
+    ne10_mat2x2f_t *xfs = (ne10_mat2x2f_t *) malloc (TEST_AABB_SHAPES * sizeof (ne10_mat2x2f_t));
+    ne10_vec2f_t *radii = (ne10_vec2f_t *) malloc (TEST_AABB_SHAPES * sizeof (ne10_vec2f_t));
+    ne10_mat2x2f_t *aabbs_inline = (ne10_mat2x2f_t *) malloc (TEST_AABB_SHAPES * sizeof (ne10_mat2x2f_t));
+    ne10_mat2x2f_t *aabbs_pool = (ne10_mat2x2f_t *) malloc (TEST_AABB_SHAPES * sizeof (ne10_mat2x2f_t));
+    ne10_vec2f_t *vertices;
+    ne10_uint32_t i;
+
+    // Polygons of 1 to 7 vertices
+    offsets[0] = 0;
+    for (i = 0; i < TEST_AABB_SHAPES; i++)
+    {
+        offsets[i + 1] = offsets[i] + 1 + i % 7;
+    }
+    vertices = (ne10_vec2f_t *) malloc (offsets[TEST_AABB_SHAPES] * sizeof (ne10_vec2f_t));
+    FILL_FLOAT_ARRAY ( (ne10_float32_t *) vertices, 2 * offsets[TEST_AABB_SHAPES]);
+    FILL_FLOAT_ARRAY ( (ne10_float32_t *) xfs, 4 * TEST_AABB_SHAPES);
+    FILL_FLOAT_ARRAY ( (ne10_float32_t *) radii, 2 * TEST_AABB_SHAPES);
+
+    // Each box is computed the same way whichever thread computes it
+    ne10_physics_compute_aabb_batch_vec2f (aabbs_inline, vertices, offsets, xfs, radii, TEST_AABB_SHAPES);
+    assert_int_equal (NE10_OK, ne10_threadpool_init (TEST_THREADS, 0));
+    ne10_physics_compute_aabb_batch_vec2f (aabbs_pool, vertices, offsets, xfs, radii, TEST_AABB_SHAPES);
+    ne10_threadpool_destroy ();
+    assert_true (memcmp (aabbs_inline, aabbs_pool, TEST_AABB_SHAPES * sizeof (ne10_mat2x2f_t)) == 0);
+
+    free (offsets);
+    free (xfs);
+    free (radii);
+    free (aabbs_inline);
+    free (aabbs_pool);
+    free (vertices);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_threadpool (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // The tests go through the function pointers, as applications do
+    ne10_init();
+
+    run_test (test_threadpool_inline);  // run tests
+    run_test (test_threadpool_tasks);
+    run_test (test_threadpool_sgemm);
+    run_test (test_threadpool_aabb_batch);
+
+    test_fixture_end();                 // ends a fixture
+}
@@ -0,0 +1,554 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test_suite_trace.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "NE10.h"
+#include "seatest.h"
+#include "unit_test_common.h"
+
+/* ----------------------------------------------------------------------
+** Global defines
+** ------------------------------------------------------------------- */
+
+#define TEST_THREADS 2
+#define TEST_CALLS 50
+
+#define TEST_LENGTH 100
+#define TEST_NUMTAPS 15
+#define TEST_BLOCKSIZE 64
+#define TEST_NFFT 64
+
+#define TEST_JSON_MAX_FUNCTIONS 16
+
+/*
+ * Each thread calls the traced functions with its own problem sizes, so that
+ * the items of the snapshot tell whether the calls of both threads were summed.
+ */
+typedef struct
+{
+    ne10_uint32_t length;
+#if defined (NE10_ENABLE_MATH)
+    ne10_float32_t *src1;
+    ne10_float32_t *src2;
+    ne10_float32_t *dst;
+#endif
+#if defined (NE10_ENABLE_DSP)
+    ne10_fir_instance_f32_t fir;
+    ne10_float32_t *fir_coeffs;
+    ne10_float32_t *fir_state;
+    ne10_float32_t *fir_src;
+    ne10_float32_t *fir_dst;
+    ne10_fft_cfg_float32_t fft_cfg;
+    ne10_fft_cpx_float32_t *fft_in;
+    ne10_fft_cpx_float32_t *fft_out;
+#endif
+} test_trace_thread_t;
+
+/* one entry of the "functions" array of the JSON dump */
+typedef struct
+{
+    char name[64];
+    ne10_uint64_t calls;
+    ne10_uint64_t items;
+} test_json_function_t;
+
+typedef struct
+{
+    const char *p;
+    ne10_uint32_t count;
+    test_json_function_t functions[TEST_JSON_MAX_FUNCTIONS];
+} test_json_t;
+
+static test_trace_thread_t trace_threads[TEST_THREADS];
+
+/* ----------------------------------------------------------------------
+** Helpers
+** ------------------------------------------------------------------- */
+
+static void trace_thread_init (test_trace_thread_t *t, ne10_uint32_t index)
+{
+    t->length = TEST_LENGTH + index;
+#if defined (NE10_ENABLE_MATH)
+    t->src1 = (ne10_float32_t *) malloc (t->length * sizeof (ne10_float32_t));
+    t->src2 = (ne10_float32_t *) malloc (t->length * sizeof (ne10_float32_t));
+    t->dst = (ne10_float32_t *) malloc (t->length * sizeof (ne10_float32_t));
+    FILL_FLOAT_ARRAY (t->src1, t->length);
+    FILL_FLOAT_ARRAY (t->src2, t->length);
+#endif
+#if defined (NE10_ENABLE_DSP)
+    t->fir_coeffs = (ne10_float32_t *) malloc (TEST_NUMTAPS * sizeof (ne10_float32_t));
+    t->fir_state = (ne10_float32_t *) malloc ( (TEST_NUMTAPS + t->length) * sizeof (ne10_float32_t));
+    t->fir_src = (ne10_float32_t *) malloc (t->length * sizeof (ne10_float32_t));
+    t->fir_dst = (ne10_float32_t *) malloc (t->length * sizeof (ne10_float32_t));
+    FILL_FLOAT_ARRAY (t->fir_coeffs, TEST_NUMTAPS);
+    FILL_FLOAT_ARRAY (t->fir_src, t->length);
+    ne10_fir_init_float (&t->fir, TEST_NUMTAPS, t->fir_coeffs, t->fir_state, t->length);
+
+    // The FFT buffer of the configuration is scratch space, so each thread has its own
+    t->fft_cfg = ne10_fft_alloc_c2c_float32 (TEST_NFFT << index);
+    t->fft_in = (ne10_fft_cpx_float32_t *) malloc ( (TEST_NFFT << index) * sizeof (ne10_fft_cpx_float32_t));
+    t->fft_out = (ne10_fft_cpx_float32_t *) malloc ( (TEST_NFFT << index) * sizeof (ne10_fft_cpx_float32_t));
+    FILL_FLOAT_ARRAY ( (ne10_float32_t *) t->fft_in, 2 * (TEST_NFFT << index));
+#endif
+}
+
+static void trace_thread_free (test_trace_thread_t *t)
+{
+#if defined (NE10_ENABLE_MATH)
+    free (t->src1);
+    free (t->src2);
+    free (t->dst);
+#endif
+#if defined (NE10_ENABLE_DSP)
+    free (t->fir_coeffs);
+    free (t->fir_state);
+    free (t->fir_src);
+    free (t->fir_dst);
+    ne10_fft_destroy_c2c_float32 (t->fft_cfg);
+    free (t->fft_in);
+    free (t->fft_out);
+#endif
+}
+
+static void trace_thread_calls (test_trace_thread_t *t, ne10_uint32_t calls)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < calls; i++)
+    {
+#if defined (NE10_ENABLE_MATH)
+        ne10_add_float (t->dst, t->src1, t->src2, t->length);
+#endif
+#if defined (NE10_ENABLE_DSP)
+        ne10_fir_float (&t->fir, t->fir_src, t->fir_dst, t->length);
+        ne10_fft_c2c_1d_float32 (t->fft_out, t->fft_in, t->fft_cfg, 0);
+#endif
+    }
+}
+
+static void *trace_thread_main (void *arg)
+{
+    trace_thread_calls ( (test_trace_thread_t *) arg, TEST_CALLS);
+    return NULL;
+}
+
+static const ne10_trace_entry_t *find_entry (const ne10_trace_entry_t *entries, ne10_uint32_t count, const char *name)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (strcmp (entries[i].name, name) == 0)
+        {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void assert_entry (const ne10_trace_entry_t *entries, ne10_uint32_t count, const char *name,
+                          ne10_uint64_t calls, ne10_uint64_t items)
+{
+    const ne10_trace_entry_t *entry = find_entry (entries, count, name);
+
+    assert_true (entry != NULL);
+    if (entry != NULL)
+    {
+        fprintf (stdout, "%-30s calls %llu items %llu\n", name,
+                 (unsigned long long) entry->calls, (unsigned long long) entry->items);
+        assert_true (entry->calls == calls);
+        assert_true (entry->items == items);
+    }
+}
+
+/*
+ * A minimal JSON reader, enough to check that the dump is well formed and to
+ * collect the name, calls and items of the objects of its "functions" array.
+ * Each routine returns 0 on a syntax error.
+ */
+static ne10_int32_t json_value (test_json_t *json, test_json_function_t *function, const char *key);
+
+static void json_space (test_json_t *json)
+{
+    while (*json->p == ' ' || *json->p == '\n' || *json->p == '\r' || *json->p == '\t')
+    {
+        json->p++;
+    }
+}
+
+static ne10_int32_t json_string (test_json_t *json, char *out, ne10_uint32_t size)
+{
+    ne10_uint32_t n = 0;
+
+    if (*json->p++ != '"')
+    {
+        return 0;
+    }
+    while (*json->p != '"')
+    {
+        if (*json->p == '\0' || (unsigned char) *json->p < 0x20)
+        {
+            return 0;
+        }
+        if (*json->p == '\\')
+        {
+            json->p++;
+            if (*json->p == '\0')
+            {
+                return 0;
+            }
+        }
+        if (out != NULL && n + 1 < size)
+        {
+            out[n++] = *json->p;
+        }
+        json->p++;
+    }
+    json->p++;
+    if (out != NULL)
+    {
+        out[n] = '\0';
+    }
+    return 1;
+}
+
+static ne10_int32_t json_number (test_json_t *json, ne10_uint64_t *out)
+{
+    char *end;
+    ne10_float64_t value = strtod (json->p, &end);
+
+    if (end == json->p)
+    {
+        return 0;
+    }
+    if (out != NULL)
+    {
+        *out = (ne10_uint64_t) value;
+    }
+    json->p = end;
+    return 1;
+}
+
+static ne10_int32_t json_object (test_json_t *json, test_json_function_t *function)
+{
+    char key[64];
+
+    json->p++;
+    json_space (json);
+    if (*json->p == '}')
+    {
+        json->p++;
+        return 1;
+    }
+    for (;;)
+    {
+        json_space (json);
+        if (!json_string (json, key, sizeof (key)))
+        {
+            return 0;
+        }
+        json_space (json);
+        if (*json->p++ != ':')
+        {
+            return 0;
+        }
+        json_space (json);
+        if (!json_value (json, function, key))
+        {
+            return 0;
+        }
+        json_space (json);
+        if (*json->p == '}')
+        {
+            json->p++;
+            return 1;
+        }
+        if (*json->p++ != ',')
+        {
+            return 0;
+        }
+    }
+}
+
+static ne10_int32_t json_array (test_json_t *json, ne10_int32_t functions)
+{
+    json->p++;
+    json_space (json);
+    if (*json->p == ']')
+    {
+        json->p++;
+        return 1;
+    }
+    for (;;)
+    {
+        test_json_function_t *function = NULL;
+
+        json_space (json);
+        if (functions && *json->p == '{' && json->count < TEST_JSON_MAX_FUNCTIONS)
+        {
+            function = &json->functions[json->count++];
+            memset (function, 0, sizeof (*function));
+        }
+        if (!json_value (json, function, NULL))
+        {
+            return 0;
+        }
+        json_space (json);
+        if (*json->p == ']')
+        {
+            json->p++;
+            return 1;
+        }
+        if (*json->p++ != ',')
+        {
+            return 0;
+        }
+    }
+}
+
+static ne10_int32_t json_value (test_json_t *json, test_json_function_t *function, const char *key)
+{
+    json_space (json);
+    switch (*json->p)
+    {
+    case '{':
+        return json_object (json, function);
+    case '[':
+        return json_array (json, key != NULL && strcmp (key, "functions") == 0);
+    case '"':
+        if (function != NULL && key != NULL && strcmp (key, "name") == 0)
+        {
+            return json_string (json, function->name, sizeof (function->name));
+        }
+        return json_string (json, NULL, 0);
+    case 't':
+    case 'f':
+    case 'n':
+    {
+        const char *word = (*json->p == 't') ? "true" : (*json->p == 'f') ? "false" : "null";
+        if (strncmp (json->p, word, strlen (word)) != 0)
+        {
+            return 0;
+        }
+        json->p += strlen (word);
+        return 1;
+    }
+    default:
+        if (function != NULL && key != NULL && strcmp (key, "calls") == 0)
+        {
+            return json_number (json, &function->calls);
+        }
+        if (function != NULL && key != NULL && strcmp (key, "items") == 0)
+        {
+            return json_number (json, &function->items);
+        }
+        return json_number (json, NULL);
+    }
+}
+
+static ne10_int32_t json_parse (test_json_t *json, const char *text)
+{
+    json->p = text;
+    json->count = 0;
+    json_space (json);
+    if (*json->p != '{' || !json_value (json, NULL, NULL))
+    {
+        return 0;
+    }
+    json_space (json);
+    return *json->p == '\0';
+}
+
+static const test_json_function_t *json_find (const test_json_t *json, const char *name)
+{
+    ne10_uint32_t i;
+
+    for (i = 0; i < json->count; i++)
+    {
+        if (strcmp (json->functions[i].name, name) == 0)
+        {
+            return &json->functions[i];
+        }
+    }
+    return NULL;
+}
+
+static void assert_json_function (const test_json_t *json, const char *name, ne10_uint64_t calls, ne10_uint64_t items)
+{
+    const test_json_function_t *function = json_find (json, name);
+
+    assert_true (function != NULL);
+    if (function != NULL)
+    {
+        assert_true (function->calls == calls);
+        assert_true (function->items == items);
+    }
+}
+
+/* ----------------------------------------------------------------------
+** Test cases
+** ------------------------------------------------------------------- */
+
+void test_trace_threads()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    pthread_t threads[TEST_THREADS];
+    ne10_trace_entry_t *entries;
+    ne10_uint32_t count, i;
+
+    count = ne10_trace_snapshot (NULL, 0);
+    assert_true (count > 0);
+    entries = (ne10_trace_entry_t *) malloc (count * sizeof (ne10_trace_entry_t));
+    assert_true (ne10_trace_ticks_per_second () > 0.0);
+
+    for (i = 0; i < TEST_THREADS; i++)
+    {
+        trace_thread_init (&trace_threads[i], i);
+    }
+    ne10_trace_reset ();
+
+    for (i = 0; i < TEST_THREADS; i++)
+    {
+        assert_int_equal (0, pthread_create (&threads[i], NULL, trace_thread_main, &trace_threads[i]));
+    }
+    for (i = 0; i < TEST_THREADS; i++)
+    {
+        pthread_join (threads[i], NULL);
+    }
+
+    assert_int_equal (count, ne10_trace_snapshot (entries, count));
+#if defined (NE10_ENABLE_MATH)
+    assert_entry (entries, count, "ne10_add_float", TEST_THREADS * TEST_CALLS,
+                  TEST_CALLS * (2 * TEST_LENGTH + 1));
+    assert_entry (entries, count, "ne10_sub_float", 0, 0);
+#endif
+#if defined (NE10_ENABLE_DSP)
+    assert_entry (entries, count, "ne10_fir_float", TEST_THREADS * TEST_CALLS,
+                  TEST_CALLS * (2 * TEST_LENGTH + 1));
+    assert_entry (entries, count, "ne10_fft_c2c_1d_float32", TEST_THREADS * TEST_CALLS,
+                  TEST_CALLS * (TEST_NFFT + 2 * TEST_NFFT));
+    // Allocated before the reset
+    assert_entry (entries, count, "ne10_fft_alloc_c2c_float32", 0, 0);
+#endif
+
+    // The counters start again from zero
+    ne10_trace_reset ();
+    ne10_trace_snapshot (entries, count);
+    for (i = 0; i < count; i++)
+    {
+        assert_true (entries[i].calls == 0);
+        assert_true (entries[i].items == 0);
+        assert_true (entries[i].ticks == 0);
+    }
+
+    trace_thread_calls (&trace_threads[1], 2);
+    ne10_trace_snapshot (entries, count);
+#if defined (NE10_ENABLE_MATH)
+    assert_entry (entries, count, "ne10_add_float", 2, 2 * (TEST_LENGTH + 1));
+#endif
+#if defined (NE10_ENABLE_DSP)
+    assert_entry (entries, count, "ne10_fft_c2c_1d_float32", 2, 2 * 2 * TEST_NFFT);
+#endif
+
+    for (i = 0; i < TEST_THREADS; i++)
+    {
+        trace_thread_free (&trace_threads[i]);
+    }
+    free (entries);
+#endif
+}
+
+void test_trace_json()
+{
+#if defined (SMOKE_TEST)||(REGRESSION_TEST)
+    FILE *file = tmpfile ();
+    test_json_t json;
+    char *text;
+    long length;
+
+    assert_true (file != NULL);
+    if (file == NULL)
+    {
+        return;
+    }
+
+    trace_thread_init (&trace_threads[0], 0);
+    ne10_trace_reset ();
+    trace_thread_calls (&trace_threads[0], 3);
+
+    assert_int_equal (NE10_OK, ne10_trace_dump_json (file));
+    length = ftell (file);
+    rewind (file);
+    text = (char *) malloc (length + 1);
+    assert_int_equal (length, fread (text, 1, length, file));
+    text[length] = '\0';
+    fclose (file);
+
+    assert_true (json_parse (&json, text));
+    // Only the functions that have been called are listed
+#if defined (NE10_ENABLE_MATH)
+    assert_json_function (&json, "ne10_add_float", 3, 3 * TEST_LENGTH);
+    assert_true (json_find (&json, "ne10_sub_float") == NULL);
+#endif
+#if defined (NE10_ENABLE_DSP)
+    assert_json_function (&json, "ne10_fir_float", 3, 3 * TEST_LENGTH);
+    assert_json_function (&json, "ne10_fft_c2c_1d_float32", 3, 3 * TEST_NFFT);
+#endif
+
+    free (text);
+    trace_thread_free (&trace_threads[0]);
+#endif
+}
+
+static void my_test_setup (void)
+{
+    ne10_log_buffer_ptr = ne10_log_buffer;
+}
+
+void test_fixture_trace (void)
+{
+    test_fixture_start();               // starts a fixture
+
+    fixture_setup (my_test_setup);
+
+    // A second ne10_init must not wrap the wrappers, which would count every call twice
+    ne10_init();
+    ne10_init();
+
+    run_test (test_trace_threads);      // run tests
+    run_test (test_trace_json);
+
+    test_fixture_end();                 // ends a fixture
+}
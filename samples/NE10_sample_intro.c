@@ -68,14 +68,17 @@ void test_add_dynamic(void)
 
 /*
  * A simple example of calling the C and NEON specific versions of Ne10 functions
- * directly -- in this case, `ne10_addc_float_c` and `ne10_addc_float_neon`.
+ * directly -- in this case, `ne10_addc_float_c` and `ne10_addc_float_neon`. (x86
+ * builds have no NEON versions, so only the C one is called there.)
  */
 void test_add_static(void)
 {
     ne10_float32_t src[ARR_LEN];
     ne10_float32_t cst;
     ne10_float32_t dst_c[ARR_LEN];
+#if !defined (NE10_ENABLE_X86)
     ne10_float32_t dst_neon[ARR_LEN];
+#endif // NE10_ENABLE_X86
 
     for (int i = 0; i < ARR_LEN; i++)
     {
@@ -84,13 +87,17 @@ void test_add_static(void)
     cst = (ne10_float32_t)rand() / RAND_MAX * 5.0f;
 
     ne10_addc_float_c(dst_c, src, cst, ARR_LEN);
+#if !defined (NE10_ENABLE_X86)
     ne10_addc_float_neon(dst_neon, src, cst, ARR_LEN);
+#endif // NE10_ENABLE_X86
 
     printf("test_intro[test_add_static]:\n");
     for (int i = 0; i < ARR_LEN; i++)
     {
         printf("\tne10_addc_float_c:\t%f + %f = %f\n", src[i], cst, dst_c[i]);
+#if !defined (NE10_ENABLE_X86)
         printf("\tne10_addc_float_neon:\t%f + %f = %f\n", src[i], cst, dst_neon[i]);
+#endif // NE10_ENABLE_X86
     }
 }
 
@@ -0,0 +1,605 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test/benchmark/NE10_bench.c
+ */
+
+/*
+ * The benchmark runner. Every case is calibrated so that one sample (a batch
+ * of back-to-back calls) lasts at least the minimum sample time, warmed up,
+ * and then timed over a number of samples; the results are the median, the
+ * 95th percentile and the spread of the time per call, the throughputs at the
+ * median, and, where perf_event_open is allowed, the CPU cycles and
+ * instructions per call. They are printed as a table and can also be written
+ * as JSON or CSV for tracking regressions.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#define NE10_BENCH_HAVE_PERF
+#endif
+
+#include "NE10_init.h"
+#include "NE10_bench.h"
+
+#define NE10_BENCH_SAMPLES_DEFAULT 21
+#define NE10_BENCH_WARMUP_DEFAULT 3
+#define NE10_BENCH_MIN_TIME_DEFAULT 2000    /* micro-seconds per sample */
+#define NE10_BENCH_SAMPLES_MAX 1000
+
+typedef struct
+{
+    ne10_uint32_t samples;
+    ne10_uint32_t warmup;
+    ne10_int64_t min_time_ns;
+    const char * filter;
+    const char * json_path;
+    const char * csv_path;
+    ne10_int32_t list_only;
+    ne10_int32_t use_perf;
+    ne10_int32_t threads;
+} ne10_bench_options_t;
+
+typedef struct
+{
+    ne10_uint64_t iterations;   /* calls per sample */
+    ne10_float64_t median_ns;
+    ne10_float64_t p95_ns;
+    ne10_float64_t min_ns;
+    ne10_float64_t mean_ns;
+    ne10_float64_t stddev_ns;
+    ne10_float64_t cycles;      /* per call, the median over the samples; < 0 if not counted */
+    ne10_float64_t instructions;
+} ne10_bench_result_t;
+
+static ne10_bench_case_t * bench_cases = NULL;
+static ne10_uint32_t bench_case_count = 0;
+static ne10_uint32_t bench_case_capacity = 0;
+
+void ne10_bench_add (const ne10_bench_case_t * c)
+{
+    if (bench_case_count == bench_case_capacity)
+    {
+        ne10_uint32_t capacity = bench_case_capacity ? 2 * bench_case_capacity : 256;
+        ne10_bench_case_t * cases = (ne10_bench_case_t *) realloc (bench_cases, capacity * sizeof (ne10_bench_case_t));
+
+        if (cases == NULL)
+        {
+            fprintf (stderr, "error: out of memory adding %s\n", c->name);
+            return;
+        }
+        bench_cases = cases;
+        bench_case_capacity = capacity;
+    }
+    bench_cases[bench_case_count++] = *c;
+}
+
+void * ne10_bench_alloc (ne10_uint32_t size)
+{
+    static ne10_uint32_t seed = 0x2545f491;
+    ne10_float32_t * p = NULL;
+    ne10_uint32_t i;
+
+    // rounded up to whole floats, and never 0 so that setup can test for NULL
+    size = (size + 2 * sizeof (ne10_float32_t) - 1) & ~ (sizeof (ne10_float32_t) - 1);
+    if (posix_memalign ( (void **) &p, 64, size) != 0)
+        return NULL;
+    for (i = 0; i < size / sizeof (ne10_float32_t); i++)
+    {
+        // xorshift32, mapped to [0.5, 2)
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        p[i] = 0.5f + 1.5f * (ne10_float32_t) (seed >> 8) / (ne10_float32_t) (1 << 24);
+    }
+    return p;
+}
+
+void ne10_bench_free (void * p)
+{
+    free (p);
+}
+
+static ne10_int64_t bench_now_ns (void)
+{
+    struct timespec ts;
+
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (ne10_int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/*
+ * CPU cycles and instructions of this thread, in user space, read as one
+ * group so that both cover exactly the same interval.
+ */
+static int bench_perf_fd = -1;
+static int bench_perf_instructions_fd = -1;
+
+static void bench_perf_open (void)
+{
+#if defined(NE10_BENCH_HAVE_PERF)
+    struct perf_event_attr attr;
+
+    memset (&attr, 0, sizeof (attr));
+    attr.size = sizeof (attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    bench_perf_fd = (int) syscall (__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    if (bench_perf_fd < 0)
+        return;
+
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 0;
+    bench_perf_instructions_fd = (int) syscall (__NR_perf_event_open, &attr, 0, -1, bench_perf_fd, 0);
+    if (bench_perf_instructions_fd < 0)
+    {
+        close (bench_perf_fd);
+        bench_perf_fd = -1;
+        return;
+    }
+    ioctl (bench_perf_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl (bench_perf_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+/* the running counts, or 0 if they are not available */
+static void bench_perf_read (ne10_uint64_t * cycles, ne10_uint64_t * instructions)
+{
+    *cycles = 0;
+    *instructions = 0;
+#if defined(NE10_BENCH_HAVE_PERF)
+    if (bench_perf_fd >= 0)
+    {
+        ne10_uint64_t values[3];
+
+        if (read (bench_perf_fd, values, sizeof (values)) == (ssize_t) sizeof (values) && values[0] == 2)
+        {
+            *cycles = values[1];
+            *instructions = values[2];
+        }
+    }
+#endif
+}
+
+static int bench_compare (const void * a, const void * b)
+{
+    ne10_float64_t x = * (const ne10_float64_t *) a;
+    ne10_float64_t y = * (const ne10_float64_t *) b;
+    return (x > y) - (x < y);
+}
+
+static ne10_float64_t bench_median (ne10_float64_t * sorted, ne10_uint32_t n)
+{
+    return (n & 1) ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+}
+
+static void bench_measure (const ne10_bench_case_t * c, void * state, const ne10_bench_options_t * opt,
+                           ne10_bench_result_t * r)
+{
+    ne10_float64_t ns[NE10_BENCH_SAMPLES_MAX];
+    ne10_float64_t cycles[NE10_BENCH_SAMPLES_MAX];
+    ne10_float64_t instructions[NE10_BENCH_SAMPLES_MAX];
+    ne10_uint64_t iterations = 1, k;
+    ne10_uint32_t i, n = opt->samples;
+    ne10_float64_t sum = 0.0, sum2 = 0.0;
+    ne10_int32_t counted = (bench_perf_fd >= 0);
+
+    // calibration: double the batch until it lasts the minimum sample time
+    c->run (state);
+    for (;;)
+    {
+        ne10_int64_t t = bench_now_ns();
+
+        for (k = 0; k < iterations; k++)
+            c->run (state);
+        t = bench_now_ns() - t;
+        if (t >= opt->min_time_ns || iterations >= ( (ne10_uint64_t) 1 << 40))
+            break;
+        // jump close to the target once the batch is long enough to be timed reliably
+        if (t > opt->min_time_ns / 16)
+            iterations = (ne10_uint64_t) ( (ne10_float64_t) iterations * opt->min_time_ns / t * 1.1) + 1;
+        else
+            iterations *= 2;
+    }
+
+    for (i = 0; i < opt->warmup + n; i++)
+    {
+        ne10_uint64_t c0, i0, c1, i1;
+        ne10_int64_t t;
+
+        bench_perf_read (&c0, &i0);
+        t = bench_now_ns();
+        for (k = 0; k < iterations; k++)
+            c->run (state);
+        t = bench_now_ns() - t;
+        bench_perf_read (&c1, &i1);
+        if (i < opt->warmup)
+            continue;
+        ns[i - opt->warmup] = (ne10_float64_t) t / iterations;
+        cycles[i - opt->warmup] = (ne10_float64_t) (c1 - c0) / iterations;
+        instructions[i - opt->warmup] = (ne10_float64_t) (i1 - i0) / iterations;
+        if (c1 == 0)
+            counted = 0;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        sum += ns[i];
+        sum2 += ns[i] * ns[i];
+    }
+    qsort (ns, n, sizeof (ns[0]), bench_compare);
+    qsort (cycles, n, sizeof (cycles[0]), bench_compare);
+    qsort (instructions, n, sizeof (instructions[0]), bench_compare);
+
+    r->iterations = iterations;
+    r->median_ns = bench_median (ns, n);
+    // nearest rank
+    r->p95_ns = ns[ (ne10_uint32_t) ceil (0.95 * n) - 1];
+    r->min_ns = ns[0];
+    r->mean_ns = sum / n;
+    r->stddev_ns = (n > 1) ? sqrt (fmax (0.0, (sum2 - sum * sum / n) / (n - 1))) : 0.0;
+    r->cycles = counted ? bench_median (cycles, n) : -1.0;
+    r->instructions = counted ? bench_median (instructions, n) : -1.0;
+}
+
+static const char * bench_arch (void)
+{
+#if defined(__aarch64__)
+    return "aarch64";
+#elif defined(__arm__)
+    return "armv7";
+#elif defined(__x86_64__)
+    return "x86_64";
+#else
+    return "unknown";
+#endif
+}
+
+/* the instruction set the function pointers were bound to by ne10_init */
+static const char * bench_isa (void)
+{
+#if defined (NE10_ENABLE_X86)
+    if (ne10_HasAVX2() == NE10_OK)
+        return "avx2";
+    if (ne10_HasSSE41() == NE10_OK)
+        return "sse4.1";
+    return "c";
+#else
+    return (ne10_HasNEON() == NE10_OK) ? "neon" : "c";
+#endif
+}
+
+/* a throughput per second, or a negative value if the cost is not counted */
+static ne10_float64_t bench_rate (ne10_float64_t amount, ne10_float64_t ns)
+{
+    return (amount > 0.0 && ns > 0.0) ? amount / ns * 1e9 : -1.0;
+}
+
+static void bench_print_header (void)
+{
+    fprintf (stdout, "%-8s %-34s %9s %12s %12s %7s %12s %10s %8s %10s %6s\n",
+             "module", "function", "size", "median ns", "p95 ns", "cv %",
+             "Mitems/s", "MB/s", "GFLOPS", "cycles", "IPC");
+}
+
+static void bench_print (const ne10_bench_case_t * c, const ne10_bench_result_t * r)
+{
+    ne10_float64_t items = bench_rate (c->items, r->median_ns);
+    ne10_float64_t bytes = bench_rate (c->bytes, r->median_ns);
+    ne10_float64_t flops = bench_rate (c->flops, r->median_ns);
+
+    fprintf (stdout, "%-8s %-34s %9u %12.1f %12.1f %7.2f ", c->module, c->name, c->size,
+             r->median_ns, r->p95_ns, 100.0 * r->stddev_ns / r->mean_ns);
+    if (items >= 0.0)
+        fprintf (stdout, "%12.2f ", items / 1e6);
+    else
+        fprintf (stdout, "%12s ", "-");
+    if (bytes >= 0.0)
+        fprintf (stdout, "%10.0f ", bytes / 1e6);
+    else
+        fprintf (stdout, "%10s ", "-");
+    if (flops >= 0.0)
+        fprintf (stdout, "%8.2f ", flops / 1e9);
+    else
+        fprintf (stdout, "%8s ", "-");
+    if (r->cycles >= 0.0)
+        fprintf (stdout, "%10.0f %6.2f\n", r->cycles, (r->cycles > 0.0) ? r->instructions / r->cycles : 0.0);
+    else
+        fprintf (stdout, "%10s %6s\n", "-", "-");
+    fflush (stdout);
+}
+
+/* a number, or null (JSON) or nothing (CSV) if it is negative */
+static void bench_write_number (FILE * f, ne10_float64_t x, const char * none)
+{
+    if (x >= 0.0)
+        fprintf (f, "%.6g", x);
+    else
+        fputs (none, f);
+}
+
+static void bench_write_json_header (FILE * f, const ne10_bench_options_t * opt)
+{
+    char date[32];
+    time_t now = time (NULL);
+
+    strftime (date, sizeof (date), "%Y-%m-%dT%H:%M:%SZ", gmtime (&now));
+    fprintf (f, "{\n  \"context\": {\"library\": \"Ne10\", \"arch\": \"%s\", \"isa\": \"%s\", "
+             "\"date\": \"%s\", \"samples\": %u, \"warmup\": %u, \"min_sample_ns\": %lld, "
+             "\"threads\": %u, \"perf_counters\": %s},\n  \"results\": [",
+             bench_arch(), bench_isa(), date, opt->samples, opt->warmup,
+             (long long) opt->min_time_ns, ne10_threadpool_size(), (bench_perf_fd >= 0) ? "true" : "false");
+}
+
+static void bench_write_json (FILE * f, const ne10_bench_case_t * c, const ne10_bench_result_t * r, ne10_int32_t first)
+{
+    // the names are C identifiers, which need no escaping
+    fprintf (f, "%s\n    {\"module\": \"%s\", \"name\": \"%s\", \"size\": %u, \"iterations\": %llu, "
+             "\"median_ns\": %.6g, \"p95_ns\": %.6g, \"min_ns\": %.6g, \"mean_ns\": %.6g, \"stddev_ns\": %.6g, ",
+             first ? "" : ",", c->module, c->name, c->size, (unsigned long long) r->iterations,
+             r->median_ns, r->p95_ns, r->min_ns, r->mean_ns, r->stddev_ns);
+    fputs ("\"items_per_s\": ", f);
+    bench_write_number (f, bench_rate (c->items, r->median_ns), "null");
+    fputs (", \"mb_per_s\": ", f);
+    bench_write_number (f, bench_rate (c->bytes, r->median_ns) / 1e6, "null");
+    fputs (", \"gflops\": ", f);
+    bench_write_number (f, bench_rate (c->flops, r->median_ns) / 1e9, "null");
+    fputs (", \"cycles\": ", f);
+    bench_write_number (f, r->cycles, "null");
+    fputs (", \"instructions\": ", f);
+    bench_write_number (f, r->instructions, "null");
+    fputs ("}", f);
+}
+
+static void bench_write_csv (FILE * f, const ne10_bench_case_t * c, const ne10_bench_result_t * r)
+{
+    fprintf (f, "%s,%s,%u,%llu,%.6g,%.6g,%.6g,%.6g,%.6g,", c->module, c->name, c->size,
+             (unsigned long long) r->iterations, r->median_ns, r->p95_ns, r->min_ns, r->mean_ns, r->stddev_ns);
+    bench_write_number (f, bench_rate (c->items, r->median_ns), "");
+    fputc (',', f);
+    bench_write_number (f, bench_rate (c->bytes, r->median_ns) / 1e6, "");
+    fputc (',', f);
+    bench_write_number (f, bench_rate (c->flops, r->median_ns) / 1e9, "");
+    fputc (',', f);
+    bench_write_number (f, r->cycles, "");
+    fputc (',', f);
+    bench_write_number (f, r->instructions, "");
+    fputc ('\n', f);
+}
+
+static void bench_usage (const char * program)
+{
+    fprintf (stderr,
+             "usage: %s [options]\n"
+             "  --filter TEXT    run only the cases whose module or function name contains TEXT\n"
+             "  --samples N      timed samples per case (default %d, at most %d)\n"
+             "  --warmup N       untimed samples before them (default %d)\n"
+             "  --min-time US    minimum length of a sample, in micro-seconds (default %d)\n"
+             "  --json FILE      also write the results as JSON\n"
+             "  --csv FILE       also write the results as CSV\n"
+             "  --threads N      run the library's parallel kernels on N threads (default:\n"
+             "                   NE10_NUM_THREADS, or none)\n"
+             "  --no-perf        do not read the hardware cycle counters\n"
+             "  --list           list the cases without running them\n",
+             program, NE10_BENCH_SAMPLES_DEFAULT, NE10_BENCH_SAMPLES_MAX,
+             NE10_BENCH_WARMUP_DEFAULT, NE10_BENCH_MIN_TIME_DEFAULT);
+}
+
+static ne10_int32_t bench_parse (int argc, char ** argv, ne10_bench_options_t * opt)
+{
+    int i;
+
+    opt->samples = NE10_BENCH_SAMPLES_DEFAULT;
+    opt->warmup = NE10_BENCH_WARMUP_DEFAULT;
+    opt->min_time_ns = (ne10_int64_t) NE10_BENCH_MIN_TIME_DEFAULT * 1000;
+    opt->filter = NULL;
+    opt->json_path = NULL;
+    opt->csv_path = NULL;
+    opt->list_only = 0;
+    opt->use_perf = 1;
+    opt->threads = -1;
+
+    for (i = 1; i < argc; i++)
+    {
+        const char * arg = argv[i];
+        const char * value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp (arg, "--list") == 0)
+            opt->list_only = 1;
+        else if (strcmp (arg, "--no-perf") == 0)
+            opt->use_perf = 0;
+        else if (value == NULL)
+            return NE10_ERR;
+        else
+        {
+            if (strcmp (arg, "--filter") == 0)
+                opt->filter = value;
+            else if (strcmp (arg, "--samples") == 0)
+                opt->samples = (ne10_uint32_t) atoi (value);
+            else if (strcmp (arg, "--warmup") == 0)
+                opt->warmup = (ne10_uint32_t) atoi (value);
+            else if (strcmp (arg, "--min-time") == 0)
+                opt->min_time_ns = (ne10_int64_t) atoi (value) * 1000;
+            else if (strcmp (arg, "--json") == 0)
+                opt->json_path = value;
+            else if (strcmp (arg, "--csv") == 0)
+                opt->csv_path = value;
+            else if (strcmp (arg, "--threads") == 0)
+                opt->threads = atoi (value);
+            else
+                return NE10_ERR;
+            i++;
+        }
+    }
+    if (opt->samples < 1 || opt->samples > NE10_BENCH_SAMPLES_MAX || opt->min_time_ns <= 0)
+        return NE10_ERR;
+    return NE10_OK;
+}
+
+static ne10_int32_t bench_selected (const ne10_bench_case_t * c, const char * filter)
+{
+    return filter == NULL || strstr (c->name, filter) != NULL || strstr (c->module, filter) != NULL;
+}
+
+int main (int argc, char ** argv)
+{
+    ne10_bench_options_t opt;
+    FILE * json = NULL;
+    FILE * csv = NULL;
+    ne10_uint32_t i, failed = 0;
+    ne10_int32_t first = 1;
+
+    if (bench_parse (argc, argv, &opt) != NE10_OK)
+    {
+        bench_usage (argv[0]);
+        return 2;
+    }
+    if (ne10_init() != NE10_OK)
+    {
+        fprintf (stderr, "error: ne10_init failed\n");
+        return 1;
+    }
+    if (opt.threads >= 0)
+    {
+        // replaces the pool ne10_init started from NE10_NUM_THREADS, if any
+        ne10_threadpool_destroy();
+        if (opt.threads > 0 && ne10_threadpool_init ( (ne10_uint32_t) opt.threads, 0) != NE10_OK)
+        {
+            fprintf (stderr, "error: cannot start %d threads\n", opt.threads);
+            return 1;
+        }
+    }
+
+#if defined (NE10_BENCH_MATH)
+    ne10_bench_register_math();
+#endif
+#if defined (NE10_BENCH_DSP)
+    ne10_bench_register_dsp();
+#endif
+#if defined (NE10_BENCH_IMGPROC)
+    ne10_bench_register_imgproc();
+#endif
+#if defined (NE10_BENCH_PHYSICS)
+    ne10_bench_register_physics();
+#endif
+    ne10_bench_register_threadpool();
+
+    if (opt.list_only)
+    {
+        for (i = 0; i < bench_case_count; i++)
+        {
+            if (bench_selected (&bench_cases[i], opt.filter))
+                fprintf (stdout, "%-8s %-34s %9u\n", bench_cases[i].module, bench_cases[i].name, bench_cases[i].size);
+        }
+        free (bench_cases);
+        return 0;
+    }
+
+    if (opt.json_path != NULL && (json = fopen (opt.json_path, "w")) == NULL)
+    {
+        fprintf (stderr, "error: cannot write %s\n", opt.json_path);
+        return 1;
+    }
+    if (opt.csv_path != NULL && (csv = fopen (opt.csv_path, "w")) == NULL)
+    {
+        fprintf (stderr, "error: cannot write %s\n", opt.csv_path);
+        return 1;
+    }
+
+    if (opt.use_perf)
+        bench_perf_open();
+    fprintf (stdout, "Ne10 benchmark: %s, %s, %u samples of at least %lld us, %u threads, cycle counters %s\n\n",
+             bench_arch(), bench_isa(), opt.samples, (long long) (opt.min_time_ns / 1000),
+             ne10_threadpool_size(), (bench_perf_fd >= 0) ? "on" : "off");
+    bench_print_header();
+    if (json != NULL)
+        bench_write_json_header (json, &opt);
+    if (csv != NULL)
+        fputs ("module,name,size,iterations,median_ns,p95_ns,min_ns,mean_ns,stddev_ns,"
+               "items_per_s,mb_per_s,gflops,cycles,instructions\n", csv);
+
+    for (i = 0; i < bench_case_count; i++)
+    {
+        const ne10_bench_case_t * c = &bench_cases[i];
+        ne10_bench_result_t r;
+        void * state;
+
+        if (!bench_selected (c, opt.filter))
+            continue;
+        state = c->setup (c->size);
+        if (state == NULL)
+        {
+            fprintf (stderr, "error: setup of %s (%u) failed\n", c->name, c->size);
+            failed++;
+            continue;
+        }
+        bench_measure (c, state, &opt, &r);
+        c->teardown (state);
+
+        bench_print (c, &r);
+        if (json != NULL)
+            bench_write_json (json, c, &r, first);
+        if (csv != NULL)
+            bench_write_csv (csv, c, &r);
+        first = 0;
+    }
+
+    if (json != NULL)
+    {
+        fputs ("\n  ]\n}\n", json);
+        fclose (json);
+    }
+    if (csv != NULL)
+        fclose (csv);
+#if defined(NE10_BENCH_HAVE_PERF)
+    if (bench_perf_fd >= 0)
+    {
+        close (bench_perf_instructions_fd);
+        close (bench_perf_fd);
+    }
+#endif
+    free (bench_cases);
+    return failed ? 1 : 0;
+}
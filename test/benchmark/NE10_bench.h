@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test/benchmark/NE10_bench.h
+ */
+
+#ifndef NE10_BENCH_H
+#define NE10_BENCH_H
+
+#include "NE10.h"
+
+/*
+ * A benchmark case times one call of a dispatched function on a problem of a
+ * given size. The setup function allocates and fills whatever the call needs
+ * and returns it as the state passed to run and teardown; run makes exactly
+ * one call. The cost of a call, used for the throughputs, is given by items
+ * (samples, points or pixels), bytes (read and written) and flops, each 0 if
+ * it is not meaningful for the function.
+ */
+typedef void * (*ne10_bench_setup_t) (ne10_uint32_t size);
+typedef void (*ne10_bench_run_t) (void * state);
+typedef void (*ne10_bench_teardown_t) (void * state);
+
+#define NE10_BENCH_NAME_MAX 64
+
+typedef struct
+{
+    const char * module;
+    char name[NE10_BENCH_NAME_MAX];
+    ne10_uint32_t size;
+    ne10_float64_t items;
+    ne10_float64_t bytes;
+    ne10_float64_t flops;
+    ne10_bench_setup_t setup;
+    ne10_bench_run_t run;
+    ne10_bench_teardown_t teardown;
+} ne10_bench_case_t;
+
+/* adds a copy of a case to the list the runner goes through */
+extern void ne10_bench_add (const ne10_bench_case_t * c);
+
+/*
+ * Allocates size bytes aligned to a cache line, filled with floats that are
+ * uniform in [0.5, 2) so that every math function stays on its fast path
+ * (logarithms, divisions and inverses included). Free with ne10_bench_free.
+ */
+extern void * ne10_bench_alloc (ne10_uint32_t size);
+extern void ne10_bench_free (void * p);
+
+/* the cases of each module, added by ne10_bench_add */
+extern void ne10_bench_register_math (void);
+extern void ne10_bench_register_dsp (void);
+extern void ne10_bench_register_imgproc (void);
+extern void ne10_bench_register_physics (void);
+
+/* the dispatch overhead of the thread pool, whatever the modules */
+extern void ne10_bench_register_threadpool (void);
+
+#endif // NE10_BENCH_H
@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2016 ARM Limited and Contributors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of ARM Limited nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY ARM LIMITED AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL ARM LIMITED AND CONTRIBUTORS BE LIABLE FOR ANY
+ *  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * NE10 Library : test/benchmark/bench_threadpool.c
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "NE10_bench.h"
+
+/*
+ * The cost of handing work to the thread pool: a group of empty tasks, and
+ * a parallel loop over size indices of which each does nothing, so that the
+ * time per item is the dispatch overhead per task or per index. Without a
+ * pool (--threads 0) both measure the inline fallback.
+ */
+typedef struct
+{
+    ne10_uint32_t count;
+    ne10_task_t * tasks;
+} ne10_bench_threadpool_state_t;
+
+static void bench_threadpool_teardown (void * state)
+{
+    ne10_bench_threadpool_state_t * st = (ne10_bench_threadpool_state_t *) state;
+
+    if (st != NULL)
+    {
+        free (st->tasks);
+        free (st);
+    }
+}
+
+static void * bench_threadpool_setup (ne10_uint32_t count)
+{
+    ne10_bench_threadpool_state_t * st = (ne10_bench_threadpool_state_t *) calloc (1, sizeof (ne10_bench_threadpool_state_t));
+
+    if (st == NULL)
+        return NULL;
+    st->count = count;
+    st->tasks = (ne10_task_t *) calloc (count, sizeof (ne10_task_t));
+    if (st->tasks == NULL)
+    {
+        bench_threadpool_teardown (st);
+        return NULL;
+    }
+    return st;
+}
+
+static void bench_empty_task (void * arg)
+{
+    (void) arg;
+}
+
+static void bench_empty_range (ne10_uint32_t begin, ne10_uint32_t end, ne10_uint32_t slot, void * arg)
+{
+    (void) begin;
+    (void) end;
+    (void) slot;
+    (void) arg;
+}
+
+static void bench_task_group (void * state)
+{
+    ne10_bench_threadpool_state_t * st = (ne10_bench_threadpool_state_t *) state;
+    ne10_task_group_t group;
+    ne10_uint32_t i;
+
+    ne10_task_group_init (&group);
+    for (i = 0; i < st->count; i++)
+        ne10_task_group_run (&group, &st->tasks[i], bench_empty_task, NULL);
+    ne10_task_group_wait (&group);
+}
+
+static void bench_parallel_for (void * state)
+{
+    ne10_bench_threadpool_state_t * st = (ne10_bench_threadpool_state_t *) state;
+
+    ne10_parallel_for (0, st->count, 1, bench_empty_range, NULL);
+}
+
+void ne10_bench_register_threadpool (void)
+{
+    static const ne10_uint32_t counts[] = { 64, 1024 };
+    ne10_bench_case_t c;
+    ne10_uint32_t s;
+
+    c.module = "pool";
+    c.setup = bench_threadpool_setup;
+    c.teardown = bench_threadpool_teardown;
+    c.bytes = 0;
+    c.flops = 0;
+    for (s = 0; s < sizeof (counts) / sizeof (counts[0]); s++)
+    {
+        c.size = counts[s];
+        c.items = counts[s];
+
+        snprintf (c.name, sizeof (c.name), "ne10_task_group_run");
+        c.run = bench_task_group;
+        ne10_bench_add (&c);
+
+        snprintf (c.name, sizeof (c.name), "ne10_parallel_for");
+        c.run = bench_parallel_for;
+        ne10_bench_add (&c);
+    }
+}
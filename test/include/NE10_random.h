@@ -102,5 +102,43 @@ extern float NE10_float_rng_limit_gt1_next();
 
 extern float NE10_float_rng_limit_gt1_max();
 
+// a counter-based generator (Philox4x32-10): output n is a function of the key
+// and n only, so blocks are independent of each other and any stream can be
+// reproduced from its seed and stream number alone
+typedef struct
+{
+    // these are used as internal values, please do not change them directly
+    uint32_t _private_m_key[2];         // the seed and the stream number
+    uint64_t _private_m_counter;        // index of the next block of four outputs
+} NE10_philox_t;
+
+extern void NE10_philox_init (NE10_philox_t *rng, uint32_t seed, uint32_t stream);
+
+// bulk fills, each consuming whole blocks of four 32-bit outputs
+extern void NE10_philox_fill_uint32 (NE10_philox_t *rng, uint32_t *dst, uint32_t count);
+
+extern void NE10_philox_fill_uint8 (NE10_philox_t *rng, uint8_t *dst, uint32_t count);
+
+extern void NE10_philox_fill_int16 (NE10_philox_t *rng, int16_t *dst, uint32_t count);
+
+extern void NE10_philox_fill_int32 (NE10_philox_t *rng, int32_t *dst, uint32_t count);
+
+// uniform values in [lo, hi)
+extern void NE10_philox_fill_float (NE10_philox_t *rng, float *dst, uint32_t count, float lo, float hi);
+
+// normal (neither subnormal, infinite nor NAN) values of any sign and exponent
+extern void NE10_philox_fill_float_normal (NE10_philox_t *rng, float *dst, uint32_t count);
+
+// values of any sign with min_abs <= |x| <= max_abs, the exponent being uniformly distributed
+extern void NE10_philox_fill_float_magnitude (NE10_philox_t *rng, float *dst, uint32_t count, float min_abs, float max_abs);
+
+// the seed of a test run, and generators for it: each call to
+// NE10_philox_init_test gives the next stream of the seed
+extern void NE10_rng_set_test_seed (uint32_t seed);
+
+extern uint32_t NE10_rng_test_seed();
+
+extern void NE10_philox_init_test (NE10_philox_t *rng);
+
 #endif // NE10_RANDOM
 
@@ -130,6 +130,10 @@ extern void FILL_FLOAT_ARRAY( ne10_float32_t *arr, ne10_uint32_t count );
 extern void FILL_FLOAT_ARRAY_LIMIT( ne10_float32_t *arr, ne10_uint32_t count );
 extern void FILL_FLOAT_ARRAY_LIMIT_GT1( ne10_float32_t *arr, ne10_uint32_t count );
 
+// sets the seed of the run's random inputs from the command line, and reports it when tests fail
+extern void ne10_test_init (int argc, char **argv);
+extern int ne10_test_finish (int passed);
+
 // this function checks whether the difference between two ne10_float32_t values is within the acceptable error range
 extern int EQUALS_FLOAT( ne10_float32_t fa, ne10_float32_t fb , ne10_uint32_t err );
 extern int GUARD_ARRAY( ne10_float32_t* array, ne10_uint32_t array_length );
@@ -29,6 +29,8 @@
  * NE10 Library : test/src/NE10_random.c
  */
 
+#include <string.h>
+
 #include "NE10_random.h"
 
 // Please look at http://en.wikipedia.org/wiki/Linear_congruential_generator
@@ -201,3 +203,195 @@ float NE10_float_rng_limit_gt1_max()
 {
     return NE10_float_rng_max_g (NULL);
 }
+
+// Philox4x32-10, see Salmon et al., "Parallel random numbers: as easy as 1, 2, 3"
+
+#define PHILOX_M0 0xD2511F53U
+#define PHILOX_M1 0xCD9E8D57U
+#define PHILOX_W0 0x9E3779B9U
+#define PHILOX_W1 0xBB67AE85U
+#define PHILOX_ROUNDS 10
+
+static void NE10_philox_block (const uint32_t key[2], uint64_t n, uint32_t out[4])
+{
+    uint32_t c0 = (uint32_t) n, c1 = (uint32_t) (n >> 32), c2 = 0, c3 = 0;
+    uint32_t k0 = key[0], k1 = key[1];
+    int r;
+
+    for (r = 0; r < PHILOX_ROUNDS; r++)
+    {
+        uint64_t p0 = (uint64_t) PHILOX_M0 * c0;
+        uint64_t p1 = (uint64_t) PHILOX_M1 * c2;
+
+        c0 = (uint32_t) (p1 >> 32) ^ c1 ^ k0;
+        c1 = (uint32_t) p1;
+        c2 = (uint32_t) (p0 >> 32) ^ c3 ^ k1;
+        c3 = (uint32_t) p0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+void NE10_philox_init (NE10_philox_t *rng, uint32_t seed, uint32_t stream)
+{
+    assert (rng != NULL);
+    rng->_private_m_key[0] = seed;
+    rng->_private_m_key[1] = stream;
+    rng->_private_m_counter = 0;
+}
+
+void NE10_philox_fill_uint32 (NE10_philox_t *rng, uint32_t *dst, uint32_t count)
+{
+    uint32_t i;
+    uint32_t tail[4];
+
+    assert (rng != NULL);
+    for (i = 0; i + 4 <= count; i += 4)
+        NE10_philox_block (rng->_private_m_key, rng->_private_m_counter++, dst + i);
+    if (i < count)
+    {
+        NE10_philox_block (rng->_private_m_key, rng->_private_m_counter++, tail);
+        memcpy (dst + i, tail, (count - i) * sizeof (uint32_t));
+    }
+}
+
+// the small types are cut from 32-bit outputs, a block at a time
+static void NE10_philox_fill_bytes (NE10_philox_t *rng, void *dst, uint32_t bytes)
+{
+    uint8_t *p = (uint8_t*) dst;
+    uint32_t block[4];
+
+    while (bytes >= sizeof (block))
+    {
+        NE10_philox_block (rng->_private_m_key, rng->_private_m_counter++, block);
+        memcpy (p, block, sizeof (block));
+        p += sizeof (block);
+        bytes -= sizeof (block);
+    }
+    if (bytes > 0)
+    {
+        NE10_philox_block (rng->_private_m_key, rng->_private_m_counter++, block);
+        memcpy (p, block, bytes);
+    }
+}
+
+void NE10_philox_fill_uint8 (NE10_philox_t *rng, uint8_t *dst, uint32_t count)
+{
+    assert (rng != NULL);
+    NE10_philox_fill_bytes (rng, dst, count);
+}
+
+void NE10_philox_fill_int16 (NE10_philox_t *rng, int16_t *dst, uint32_t count)
+{
+    assert (rng != NULL);
+    NE10_philox_fill_bytes (rng, dst, count * sizeof (int16_t));
+}
+
+void NE10_philox_fill_int32 (NE10_philox_t *rng, int32_t *dst, uint32_t count)
+{
+    assert (rng != NULL);
+    NE10_philox_fill_bytes (rng, dst, count * sizeof (int32_t));
+}
+
+// the floats are built from one 32-bit output each, a block at a time
+static float NE10_philox_uniform (uint32_t bits, float lo, float hi)
+{
+    return lo + (hi - lo) * ( (float) (bits >> 8) * (1.0f / 16777216.0f));
+}
+
+void NE10_philox_fill_float (NE10_philox_t *rng, float *dst, uint32_t count, float lo, float hi)
+{
+    uint32_t block[4];
+    uint32_t i, j;
+
+    assert (rng != NULL);
+    for (i = 0; i < count; i += 4)
+    {
+        NE10_philox_block (rng->_private_m_key, rng->_private_m_counter++, block);
+        for (j = 0; j < 4 && i + j < count; j++)
+            dst[i + j] = NE10_philox_uniform (block[j], lo, hi);
+    }
+}
+
+static float NE10_philox_normal (uint32_t bits)
+{
+    // map the exponent field 0..255 onto the normal exponents 1..254
+    uint32_t exp = 1 + ( ( ( (bits >> 23) & 0xFF) * 254) >> 8);
+    float ret;
+
+    bits = (bits & 0x807FFFFF) | (exp << 23);
+    memcpy (&ret, &bits, sizeof (ret));
+    return ret;
+}
+
+void NE10_philox_fill_float_normal (NE10_philox_t *rng, float *dst, uint32_t count)
+{
+    uint32_t block[4];
+    uint32_t i, j;
+
+    assert (rng != NULL);
+    for (i = 0; i < count; i += 4)
+    {
+        NE10_philox_block (rng->_private_m_key, rng->_private_m_counter++, block);
+        for (j = 0; j < 4 && i + j < count; j++)
+            dst[i + j] = NE10_philox_normal (block[j]);
+    }
+}
+
+static float NE10_philox_magnitude (uint32_t bits, int exp_lo, int exp_span)
+{
+    float frc = 1.0f + (float) (bits & 0x7FFFFF) * (1.0f / 8388608.0f);
+    int exp = exp_lo + (int) ( ( (uint64_t) ( (bits >> 8) & 0x7FFFFF) * exp_span) >> 23);
+    float ret = ldexpf (frc, exp);
+
+    return (bits & 0x80000000) ? -ret : ret;
+}
+
+void NE10_philox_fill_float_magnitude (NE10_philox_t *rng, float *dst, uint32_t count, float min_abs, float max_abs)
+{
+    uint32_t block[4];
+    int exp_lo, exp_hi;
+    uint32_t i = 0, j;
+
+    assert (rng != NULL);
+    assert (min_abs > 0.0f && min_abs <= max_abs);
+    frexpf (min_abs, &exp_lo);
+    frexpf (max_abs, &exp_hi);
+
+    while (i < count)
+    {
+        NE10_philox_block (rng->_private_m_key, rng->_private_m_counter++, block);
+        for (j = 0; j < 4 && i < count; j++)
+        {
+            float f = NE10_philox_magnitude (block[j], exp_lo - 1, exp_hi - exp_lo + 1);
+
+            // the end binades are only partly in range; the few values outside it are dropped
+            if (fabsf (f) >= min_abs && fabsf (f) <= max_abs)
+                dst[i++] = f;
+        }
+    }
+}
+
+// the seed shared by a test run, and the number of streams handed out for it
+static uint32_t __NE10_test_seed = 1;
+static uint32_t __NE10_test_stream = 0;
+
+void NE10_rng_set_test_seed (uint32_t seed)
+{
+    __NE10_test_seed = seed;
+    __NE10_test_stream = 0;
+}
+
+uint32_t NE10_rng_test_seed()
+{
+    return __NE10_test_seed;
+}
+
+void NE10_philox_init_test (NE10_philox_t *rng)
+{
+    NE10_philox_init (rng, __NE10_test_seed, __NE10_test_stream++);
+}
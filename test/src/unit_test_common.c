@@ -33,46 +33,62 @@
 #include<unistd.h>
 #include "unit_test_common.h"
 
+/* each fill draws the next stream of the run's seed, so rerunning the same
+ * tests with the same seed reproduces their inputs */
 void FILL_FLOAT_ARRAY (ne10_float32_t *arr, ne10_uint32_t count)
 {
-    ne10_uint32_t i = 0;
+    NE10_philox_t rng;
 
-    sleep (1);
-
-    NE10_float_rng_init (time (NULL));
-
-    for (i = 0; i < count; i++)
-    {
-        arr[i] = NE10_float_rng_next();
-    }
+    NE10_philox_init_test (&rng);
+    NE10_philox_fill_float_normal (&rng, arr, count);
 }
 
 void FILL_FLOAT_ARRAY_LIMIT (ne10_float32_t *arr, ne10_uint32_t count)
 {
-    ne10_uint32_t i = 0;
+    NE10_philox_t rng;
 
-    sleep (1);
+    NE10_philox_init_test (&rng);
+    NE10_philox_fill_float_magnitude (&rng, arr, count, 1.0e-3f, 1.0e3f);
+}
 
-    NE10_float_rng_limit_init (time (NULL));
+void FILL_FLOAT_ARRAY_LIMIT_GT1 (ne10_float32_t *arr, ne10_uint32_t count)
+{
+    NE10_philox_t rng;
 
-    for (i = 0; i < count; i++)
-    {
-        arr[ i ] = NE10_float_rng_limit_next();
-    }
+    NE10_philox_init_test (&rng);
+    NE10_philox_fill_float_magnitude (&rng, arr, count, 1.0e-6f, 1.0e3f);
 }
 
-void FILL_FLOAT_ARRAY_LIMIT_GT1 (ne10_float32_t *arr, ne10_uint32_t count)
+/* the seed is taken from "-s <seed>" or "--seed <seed>" on the command line, or
+ * else from the NE10_TEST_SEED environment variable, and is 1 by default */
+void ne10_test_init (int argc, char **argv)
 {
-    ne10_uint32_t i = 0;
+    const char *value = getenv ("NE10_TEST_SEED");
+    uint32_t seed = 1;
+    int i;
 
-    sleep (1);
+    for (i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp (argv[i], "-s") == 0 || strcmp (argv[i], "--seed") == 0)
+            value = argv[i + 1];
+    }
+    if (value != NULL)
+        seed = (uint32_t) strtoul (value, NULL, 0);
 
-    NE10_float_rng_limit_gt1_init (time (NULL));
+    NE10_rng_set_test_seed (seed);
+    NE10_rng_init (seed);
+    srand (seed);
+    printf ("random seed: %u\n", seed);
+}
 
-    for (i = 0; i < count; i++)
+int ne10_test_finish (int passed)
+{
+    if (!passed)
     {
-        arr[ i ] = NE10_float_rng_limit_gt1_next();
+        printf ("tests failed with random seed %u; rerun them with --seed %u\n",
+                NE10_rng_test_seed(), NE10_rng_test_seed());
     }
+    return !passed;
 }
 
 // this function checks whether the difference between two ne10_float32_t values is within the acceptable error range
@@ -230,11 +246,22 @@ void ne10_log(const char *func_name,
               ne10_float32_t time_speedup)
 {
     int byte_count = 0;
-    byte_count = sprintf(ne10_log_buffer_ptr,
-                         "{ \"name\" : \"%s %d\", \"time_c\" : %d, "
-                         "\"time_neon\" : %d },",
-                         func_name, n, time_c, time_neon);
-    ne10_log_buffer_ptr += byte_count;
+    size_t space;
+
+    if (ne10_log_buffer_ptr == NULL)
+        ne10_log_buffer_ptr = ne10_log_buffer;
+    space = ne10_log_buffer + sizeof (ne10_log_buffer) - ne10_log_buffer_ptr;
+
+    /* entries that no longer fit are dropped rather than overrunning the buffer;
+     * test/benchmark keeps complete results */
+    byte_count = snprintf(ne10_log_buffer_ptr, space,
+                          "{ \"name\" : \"%s %d\", \"time_c\" : %d, "
+                          "\"time_neon\" : %d },",
+                          func_name, n, time_c, time_neon);
+    if (byte_count > 0 && (size_t) byte_count < space)
+        ne10_log_buffer_ptr += byte_count;
+    else
+        *ne10_log_buffer_ptr = '\0';
 
     /* print the result, which is needed by command line performance test. */
     fprintf (stdout,